@@ -0,0 +1,433 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using UnityEngine;
+using Debug = UnityEngine.Debug;
+using Object = UnityEngine.Object;
+
+public enum DiagCategory
+{
+    General,
+    Movement,
+    Interaction,
+    Save,
+    Drops
+}
+
+public enum DiagVerbosity
+{
+    Off,
+    Error,
+    Warning,
+    Log,
+    Verbose
+}
+
+public struct DiagEntry
+{
+    public int frame;
+    public DiagCategory category;
+    public DiagVerbosity verbosity;
+    public string message;
+}
+
+/* --------------------------------------------------------------------------
+   Diagnostics facade shared by logging and debug drawing.
+
+   • Every call names a category. A message goes out when its verbosity is at or
+     below the category's level in DiagSettings (Resources/DiagSettings, or the
+     defaults when there is none). SetVerbosity / SetDraw change levels at runtime.
+   • Log, Verbose and the draw calls are [Conditional]: outside the editor and
+     development builds (unless DIAG_ENABLED is defined) the calls and their
+     arguments are removed by the compiler. Error and Warning are always compiled.
+   • Arguments are generic and only formatted once the category is known to be on,
+     so a disabled call doesn't format, box or allocate. Pass values (Unity objects
+     print as their name), not interpolated strings, or the caller builds the
+     string anyway.
+   • Messages that pass go to a ring buffer (Recent, Dropped counts the ones
+     overwritten) and, with echoToConsole, to the console.
+   • Line / Sphere / Box queue shapes for categories with draw on. A hidden runner
+     sends the whole queue to Debug.DrawLine in one pass in LateUpdate.
+   -------------------------------------------------------------------------- */
+public static class Diag
+{
+    private enum ShapeKind { Line, Sphere, Box }
+
+    private struct Shape
+    {
+        public ShapeKind kind;
+        public Vector3 a; // Line start, sphere / box center
+        public Vector3 b; // Line end, box size, sphere radius in x
+        public Color color;
+        public float duration;
+    }
+
+    // Sends the queued shapes once per frame
+    private class Runner : MonoBehaviour
+    {
+        private void LateUpdate() => FlushShapes();
+    }
+
+    private const int SphereSegments = 16;
+    private static readonly int CategoryCount = Enum.GetValues(typeof(DiagCategory)).Length;
+
+    private static readonly object gate = new object();
+    private static DiagSettings settings;
+    private static int[] levels;
+    private static int drawMask;
+    private static bool echo;
+
+    private static DiagEntry[] ring = new DiagEntry[0];
+    private static int ringHead;
+    private static int ringCount;
+    private static long dropped;
+    private static long workCount;
+
+    private static readonly List<Shape> shapes = new List<Shape>();
+    private static readonly List<Shape> flushing = new List<Shape>();
+    private static Runner runner;
+
+    public static DiagSettings Settings
+    {
+        get
+        {
+            EnsureSettings();
+            return settings;
+        }
+    }
+
+    public static long Dropped
+    {
+        get { lock (gate) return dropped; }
+    }
+
+    // Messages formatted plus shapes queued so far, what the disabled-cost tests expect to stay put
+    public static long WorkCount
+    {
+        get { lock (gate) return workCount; }
+    }
+
+    [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.SubsystemRegistration)]
+    private static void ResetStatics() // Play mode without domain reload
+    {
+        settings = null;
+        levels = null;
+        ring = new DiagEntry[0];
+        ringHead = ringCount = 0;
+        dropped = workCount = 0;
+        shapes.Clear();
+        runner = null;
+    }
+
+    public static void Apply(DiagSettings source)
+    {
+        lock (gate)
+        {
+            settings = source;
+            var newLevels = new int[CategoryCount];
+            for (int i = 0; i < newLevels.Length; i++)
+                newLevels[i] = (int)source.defaultVerbosity;
+
+            int mask = 0;
+            foreach (var category in source.categories)
+            {
+                newLevels[(int)category.category] = (int)category.verbosity;
+                if (category.draw)
+                    mask |= 1 << (int)category.category;
+            }
+
+            int capacity = Mathf.Max(1, source.ringCapacity);
+            if (ring.Length != capacity)
+            {
+                ring = new DiagEntry[capacity];
+                ringHead = ringCount = 0;
+            }
+
+            drawMask = mask;
+            echo = source.echoToConsole;
+            levels = newLevels;
+        }
+    }
+
+    private static void EnsureSettings()
+    {
+        if (levels == null)
+            Apply(DiagSettings.GetOrDefault());
+    }
+
+    public static bool IsEnabled(DiagCategory category, DiagVerbosity verbosity)
+    {
+        EnsureSettings();
+        return (int)verbosity <= levels[(int)category];
+    }
+
+    public static bool IsDrawEnabled(DiagCategory category)
+    {
+        EnsureSettings();
+        return (drawMask & (1 << (int)category)) != 0;
+    }
+
+    public static DiagVerbosity GetVerbosity(DiagCategory category)
+    {
+        EnsureSettings();
+        return (DiagVerbosity)levels[(int)category];
+    }
+
+    public static void SetVerbosity(DiagCategory category, DiagVerbosity verbosity)
+    {
+        EnsureSettings();
+        levels[(int)category] = (int)verbosity;
+    }
+
+    public static void SetDraw(DiagCategory category, bool draw)
+    {
+        EnsureSettings();
+        if (draw) drawMask |= 1 << (int)category;
+        else drawMask &= ~(1 << (int)category);
+    }
+
+    /* ---------------- Logging ---------------- */
+
+    public static void Error(DiagCategory category, Object context, string message)
+    {
+        if (IsEnabled(category, DiagVerbosity.Error)) Write(category, DiagVerbosity.Error, context, message);
+    }
+
+    public static void Error<T0>(DiagCategory category, Object context, string format, T0 arg0)
+    {
+        if (IsEnabled(category, DiagVerbosity.Error)) Write(category, DiagVerbosity.Error, context, string.Format(format, Arg(arg0)));
+    }
+
+    public static void Error<T0, T1>(DiagCategory category, Object context, string format, T0 arg0, T1 arg1)
+    {
+        if (IsEnabled(category, DiagVerbosity.Error)) Write(category, DiagVerbosity.Error, context, string.Format(format, Arg(arg0), Arg(arg1)));
+    }
+
+    public static void Error<T0, T1, T2>(DiagCategory category, Object context, string format, T0 arg0, T1 arg1, T2 arg2)
+    {
+        if (IsEnabled(category, DiagVerbosity.Error)) Write(category, DiagVerbosity.Error, context, string.Format(format, Arg(arg0), Arg(arg1), Arg(arg2)));
+    }
+
+    public static void Warning(DiagCategory category, Object context, string message)
+    {
+        if (IsEnabled(category, DiagVerbosity.Warning)) Write(category, DiagVerbosity.Warning, context, message);
+    }
+
+    public static void Warning<T0>(DiagCategory category, Object context, string format, T0 arg0)
+    {
+        if (IsEnabled(category, DiagVerbosity.Warning)) Write(category, DiagVerbosity.Warning, context, string.Format(format, Arg(arg0)));
+    }
+
+    public static void Warning<T0, T1>(DiagCategory category, Object context, string format, T0 arg0, T1 arg1)
+    {
+        if (IsEnabled(category, DiagVerbosity.Warning)) Write(category, DiagVerbosity.Warning, context, string.Format(format, Arg(arg0), Arg(arg1)));
+    }
+
+    public static void Warning<T0, T1, T2>(DiagCategory category, Object context, string format, T0 arg0, T1 arg1, T2 arg2)
+    {
+        if (IsEnabled(category, DiagVerbosity.Warning)) Write(category, DiagVerbosity.Warning, context, string.Format(format, Arg(arg0), Arg(arg1), Arg(arg2)));
+    }
+
+    [Conditional("UNITY_EDITOR"), Conditional("DEVELOPMENT_BUILD"), Conditional("DIAG_ENABLED")]
+    public static void Log(DiagCategory category, Object context, string message)
+    {
+        if (IsEnabled(category, DiagVerbosity.Log)) Write(category, DiagVerbosity.Log, context, message);
+    }
+
+    [Conditional("UNITY_EDITOR"), Conditional("DEVELOPMENT_BUILD"), Conditional("DIAG_ENABLED")]
+    public static void Log<T0>(DiagCategory category, Object context, string format, T0 arg0)
+    {
+        if (IsEnabled(category, DiagVerbosity.Log)) Write(category, DiagVerbosity.Log, context, string.Format(format, Arg(arg0)));
+    }
+
+    [Conditional("UNITY_EDITOR"), Conditional("DEVELOPMENT_BUILD"), Conditional("DIAG_ENABLED")]
+    public static void Log<T0, T1>(DiagCategory category, Object context, string format, T0 arg0, T1 arg1)
+    {
+        if (IsEnabled(category, DiagVerbosity.Log)) Write(category, DiagVerbosity.Log, context, string.Format(format, Arg(arg0), Arg(arg1)));
+    }
+
+    [Conditional("UNITY_EDITOR"), Conditional("DEVELOPMENT_BUILD"), Conditional("DIAG_ENABLED")]
+    public static void Log<T0, T1, T2>(DiagCategory category, Object context, string format, T0 arg0, T1 arg1, T2 arg2)
+    {
+        if (IsEnabled(category, DiagVerbosity.Log)) Write(category, DiagVerbosity.Log, context, string.Format(format, Arg(arg0), Arg(arg1), Arg(arg2)));
+    }
+
+    [Conditional("UNITY_EDITOR"), Conditional("DEVELOPMENT_BUILD"), Conditional("DIAG_ENABLED")]
+    public static void Verbose(DiagCategory category, Object context, string message)
+    {
+        if (IsEnabled(category, DiagVerbosity.Verbose)) Write(category, DiagVerbosity.Verbose, context, message);
+    }
+
+    [Conditional("UNITY_EDITOR"), Conditional("DEVELOPMENT_BUILD"), Conditional("DIAG_ENABLED")]
+    public static void Verbose<T0>(DiagCategory category, Object context, string format, T0 arg0)
+    {
+        if (IsEnabled(category, DiagVerbosity.Verbose)) Write(category, DiagVerbosity.Verbose, context, string.Format(format, Arg(arg0)));
+    }
+
+    [Conditional("UNITY_EDITOR"), Conditional("DEVELOPMENT_BUILD"), Conditional("DIAG_ENABLED")]
+    public static void Verbose<T0, T1>(DiagCategory category, Object context, string format, T0 arg0, T1 arg1)
+    {
+        if (IsEnabled(category, DiagVerbosity.Verbose)) Write(category, DiagVerbosity.Verbose, context, string.Format(format, Arg(arg0), Arg(arg1)));
+    }
+
+    [Conditional("UNITY_EDITOR"), Conditional("DEVELOPMENT_BUILD"), Conditional("DIAG_ENABLED")]
+    public static void Verbose<T0, T1, T2>(DiagCategory category, Object context, string format, T0 arg0, T1 arg1, T2 arg2)
+    {
+        if (IsEnabled(category, DiagVerbosity.Verbose)) Write(category, DiagVerbosity.Verbose, context, string.Format(format, Arg(arg0), Arg(arg1), Arg(arg2)));
+    }
+
+    // Unity objects print as their name, so callers pass the object instead of building its name string up front
+    private static object Arg<T>(T value)
+    {
+        if (value is Object unityObject)
+            return unityObject != null ? unityObject.name : "null";
+        return value;
+    }
+
+    private static void Write(DiagCategory category, DiagVerbosity verbosity, Object context, string message)
+    {
+        lock (gate)
+        {
+            workCount++;
+            if (ringCount == ring.Length)
+            {
+                ringHead = (ringHead + 1) % ring.Length;
+                ringCount--;
+                dropped++;
+            }
+
+            ring[(ringHead + ringCount) % ring.Length] = new DiagEntry
+            {
+                frame = Time.frameCount,
+                category = category,
+                verbosity = verbosity,
+                message = message
+            };
+            ringCount++;
+        }
+
+        if (!echo)
+            return;
+
+        switch (verbosity)
+        {
+            case DiagVerbosity.Error:
+                Debug.LogError(message, context);
+                break;
+            case DiagVerbosity.Warning:
+                Debug.LogWarning(message, context);
+                break;
+            default:
+                Debug.Log(message, context);
+                break;
+        }
+    }
+
+    // Oldest first
+    public static DiagEntry[] Recent()
+    {
+        lock (gate)
+        {
+            var result = new DiagEntry[ringCount];
+            for (int i = 0; i < ringCount; i++)
+                result[i] = ring[(ringHead + i) % ring.Length];
+            return result;
+        }
+    }
+
+    /* ---------------- Debug draw ---------------- */
+
+    [Conditional("UNITY_EDITOR"), Conditional("DEVELOPMENT_BUILD"), Conditional("DIAG_ENABLED")]
+    public static void Line(DiagCategory category, Vector3 start, Vector3 end, Color color, float duration = 0f)
+    {
+        if (IsDrawEnabled(category)) Queue(new Shape { kind = ShapeKind.Line, a = start, b = end, color = color, duration = duration });
+    }
+
+    [Conditional("UNITY_EDITOR"), Conditional("DEVELOPMENT_BUILD"), Conditional("DIAG_ENABLED")]
+    public static void Sphere(DiagCategory category, Vector3 center, float radius, Color color, float duration = 0f)
+    {
+        if (IsDrawEnabled(category)) Queue(new Shape { kind = ShapeKind.Sphere, a = center, b = new Vector3(radius, 0f, 0f), color = color, duration = duration });
+    }
+
+    [Conditional("UNITY_EDITOR"), Conditional("DEVELOPMENT_BUILD"), Conditional("DIAG_ENABLED")]
+    public static void Box(DiagCategory category, Vector3 center, Vector3 size, Color color, float duration = 0f)
+    {
+        if (IsDrawEnabled(category)) Queue(new Shape { kind = ShapeKind.Box, a = center, b = size, color = color, duration = duration });
+    }
+
+    private static void Queue(Shape shape)
+    {
+        if (!Application.isPlaying)
+            return;
+
+        if (runner == null)
+        {
+            var go = new GameObject("DiagRunner") { hideFlags = HideFlags.HideInHierarchy };
+            Object.DontDestroyOnLoad(go);
+            runner = go.AddComponent<Runner>();
+        }
+
+        lock (gate)
+        {
+            workCount++;
+            shapes.Add(shape);
+        }
+    }
+
+    private static void FlushShapes()
+    {
+        lock (gate)
+        {
+            flushing.AddRange(shapes);
+            shapes.Clear();
+        }
+
+        foreach (var shape in flushing)
+        {
+            switch (shape.kind)
+            {
+                case ShapeKind.Line:
+                    Debug.DrawLine(shape.a, shape.b, shape.color, shape.duration);
+                    break;
+                case ShapeKind.Sphere:
+                    DrawSphere(shape);
+                    break;
+                case ShapeKind.Box:
+                    DrawBox(shape);
+                    break;
+            }
+        }
+        flushing.Clear();
+    }
+
+    // One circle per axis plane
+    private static void DrawSphere(Shape shape)
+    {
+        float radius = shape.b.x;
+        for (int i = 0; i < SphereSegments; i++)
+        {
+            float a0 = 2f * Mathf.PI * i / SphereSegments;
+            float a1 = 2f * Mathf.PI * (i + 1) / SphereSegments;
+            Vector2 p0 = new Vector2(Mathf.Cos(a0), Mathf.Sin(a0)) * radius;
+            Vector2 p1 = new Vector2(Mathf.Cos(a1), Mathf.Sin(a1)) * radius;
+            Debug.DrawLine(shape.a + new Vector3(p0.x, p0.y, 0f), shape.a + new Vector3(p1.x, p1.y, 0f), shape.color, shape.duration);
+            Debug.DrawLine(shape.a + new Vector3(p0.x, 0f, p0.y), shape.a + new Vector3(p1.x, 0f, p1.y), shape.color, shape.duration);
+            Debug.DrawLine(shape.a + new Vector3(0f, p0.x, p0.y), shape.a + new Vector3(0f, p1.x, p1.y), shape.color, shape.duration);
+        }
+    }
+
+    private static void DrawBox(Shape shape)
+    {
+        Vector3 e = shape.b * 0.5f;
+        for (int i = 0; i < 4; i++)
+        {
+            float x0 = (i == 0 || i == 3) ? -e.x : e.x;
+            float z0 = (i < 2) ? -e.z : e.z;
+            float x1 = (i == 0 || i == 1) ? e.x : -e.x;
+            float z1 = (i == 0 || i == 3) ? -e.z : e.z;
+            Debug.DrawLine(shape.a + new Vector3(x0, -e.y, z0), shape.a + new Vector3(x1, -e.y, z1), shape.color, shape.duration); // Bottom edge
+            Debug.DrawLine(shape.a + new Vector3(x0, e.y, z0), shape.a + new Vector3(x1, e.y, z1), shape.color, shape.duration);   // Top edge
+            Debug.DrawLine(shape.a + new Vector3(x0, -e.y, z0), shape.a + new Vector3(x0, e.y, z0), shape.color, shape.duration);  // Vertical edge
+        }
+    }
+}
@@ -0,0 +1,59 @@
+using System;
+using UnityEngine;
+
+[CreateAssetMenu(fileName = "DiagSettings", menuName = "Scriptable Objects/DiagSettings")]
+public class DiagSettings : ScriptableObject
+{
+    [Serializable]
+    public struct CategorySettings
+    {
+        public DiagCategory category;
+        public DiagVerbosity verbosity;
+        [Tooltip("Draw this category's debug shapes")]
+        public bool draw;
+    }
+
+    [Header("Logging")]
+    [Tooltip("Verbosity of the categories not listed below")]
+    public DiagVerbosity defaultVerbosity = DiagVerbosity.Log;
+    public CategorySettings[] categories = new CategorySettings[0];
+    [Tooltip("Also print messages to the console. The ring buffer keeps them either way.")]
+    public bool echoToConsole = true;
+    [Tooltip("Messages kept in the ring buffer before the oldest are dropped")]
+    public int ringCapacity = 256;
+
+    // Loaded from Resources/DiagSettings, default instance if there is none
+    private static DiagSettings defaultSettings;
+
+    public static DiagSettings GetOrDefault()
+    {
+        if (defaultSettings == null)
+        {
+            defaultSettings = Resources.Load<DiagSettings>("DiagSettings");
+            if (defaultSettings == null)
+            {
+                defaultSettings = CreateInstance<DiagSettings>();
+                defaultSettings.defaultVerbosity = DiagVerbosity.Log;
+                defaultSettings.echoToConsole = true;
+                defaultSettings.ringCapacity = 256;
+            }
+        }
+        return defaultSettings;
+    }
+
+    private void OnValidate()
+    {
+        // Live edits while playing
+        if (Application.isPlaying && Diag.Settings == this)
+            Diag.Apply(this);
+    }
+
+    [ContextMenu("Log Recent Messages")]
+    private void LogRecentMessages()
+    {
+        var recent = Diag.Recent();
+        Debug.Log($"[Diag] {recent.Length} messages, {Diag.Dropped} dropped:");
+        foreach (var entry in recent)
+            Debug.Log($"[Diag]   frame {entry.frame} [{entry.category}/{entry.verbosity}] {entry.message}");
+    }
+}
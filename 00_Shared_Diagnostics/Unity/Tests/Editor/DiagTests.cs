@@ -0,0 +1,88 @@
+using System;
+using NUnit.Framework;
+using UnityEngine;
+
+// Runs the facade on its own settings with console echo off: disabled calls of every kind must allocate and do nothing,
+// enabled ones format once into the ring buffer, which drops its oldest messages when full.
+public class DiagTests
+{
+    private const int Calls = 10000;
+
+    private DiagSettings settings;
+
+    [SetUp]
+    public void SetUp()
+    {
+        settings = ScriptableObject.CreateInstance<DiagSettings>();
+        settings.defaultVerbosity = DiagVerbosity.Off;
+        settings.echoToConsole = false;
+        settings.ringCapacity = 8;
+        Diag.Apply(settings);
+    }
+
+    [TearDown]
+    public void TearDown()
+    {
+        Diag.Apply(DiagSettings.GetOrDefault());
+        UnityEngine.Object.DestroyImmediate(settings);
+    }
+
+    private static void MakeDisabledCalls(int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            Diag.Error(DiagCategory.Save, null, "Disabled {0}", i);
+            Diag.Warning(DiagCategory.Drops, null, "Disabled {0} {1}", i, Vector3.one);
+            Diag.Log(DiagCategory.Interaction, null, "Disabled {0} {1} {2}", i, 1.5f, "label");
+            Diag.Verbose(DiagCategory.Movement, null, "Disabled {0}", Vector3.up);
+            Diag.Line(DiagCategory.Movement, Vector3.zero, Vector3.one * i, Color.green);
+            Diag.Sphere(DiagCategory.Drops, Vector3.one * i, 0.5f, Color.red);
+            Diag.Box(DiagCategory.Interaction, Vector3.one * i, Vector3.one, Color.blue);
+        }
+    }
+
+    [Test]
+    public void DisabledCalls_AllocateNothingAndDoNoWork()
+    {
+        MakeDisabledCalls(1); // JIT and first-use costs out of the measurement
+
+        long workBefore = Diag.WorkCount;
+        long bytesBefore = GC.GetAllocatedBytesForCurrentThread();
+        MakeDisabledCalls(Calls);
+        long bytes = GC.GetAllocatedBytesForCurrentThread() - bytesBefore;
+
+        Assert.AreEqual(0, bytes, $"{Calls} disabled calls of each kind allocated");
+        Assert.AreEqual(0, Diag.WorkCount - workBefore, "Disabled calls formatted or queued something");
+    }
+
+    [Test]
+    public void EnabledCall_IsFormattedOnceIntoTheRing()
+    {
+        Diag.SetVerbosity(DiagCategory.Save, DiagVerbosity.Log);
+        long workBefore = Diag.WorkCount;
+
+        Diag.Log(DiagCategory.Save, null, "Saved slot {0} in {1} ms", 3, 12);
+        Diag.Verbose(DiagCategory.Save, null, "Above the category's level {0}", 4);
+
+        DiagEntry[] recent = Diag.Recent();
+        Assert.AreEqual(1, Diag.WorkCount - workBefore);
+        Assert.AreEqual("Saved slot 3 in 12 ms", recent[recent.Length - 1].message);
+        Assert.AreEqual(DiagCategory.Save, recent[recent.Length - 1].category);
+    }
+
+    [Test]
+    public void FullRing_DropsTheOldestMessages()
+    {
+        Diag.SetVerbosity(DiagCategory.General, DiagVerbosity.Log);
+        long droppedBefore = Diag.Dropped;
+
+        for (int i = 0; i < settings.ringCapacity + 3; i++)
+            Diag.Log(DiagCategory.General, null, "Message {0}", i);
+
+        DiagEntry[] recent = Diag.Recent();
+        Assert.AreEqual(settings.ringCapacity, recent.Length);
+        Assert.AreEqual(3, Diag.Dropped - droppedBefore);
+        Assert.AreEqual("Message 3", recent[0].message, "Oldest first");
+        Assert.AreEqual($"Message {settings.ringCapacity + 2}", recent[recent.Length - 1].message);
+    }
+}
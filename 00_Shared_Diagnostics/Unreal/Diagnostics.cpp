@@ -0,0 +1,246 @@
+#include "Diagnostics.h"
+#include "Components/LineBatchComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+int32 GDiagVerbosity[static_cast<int32>(EDiagCategory::Count)] =
+{
+    3, // General
+    3, // Movement
+    3, // Interaction
+    3, // Save
+    3  // Drops
+};
+
+int32 GDiagDrawCategories = 0;
+
+static int32 GDiagEcho = 1;
+
+static FAutoConsoleVariableRef CVarDiagGeneral(TEXT("Diag.General"), GDiagVerbosity[0], TEXT("General diagnostics verbosity (0 off, 1 error, 2 warning, 3 log, 4 verbose)"));
+static FAutoConsoleVariableRef CVarDiagMovement(TEXT("Diag.Movement"), GDiagVerbosity[1], TEXT("Movement diagnostics verbosity (0 off, 1 error, 2 warning, 3 log, 4 verbose)"));
+static FAutoConsoleVariableRef CVarDiagInteraction(TEXT("Diag.Interaction"), GDiagVerbosity[2], TEXT("Interaction diagnostics verbosity (0 off, 1 error, 2 warning, 3 log, 4 verbose)"));
+static FAutoConsoleVariableRef CVarDiagSave(TEXT("Diag.Save"), GDiagVerbosity[3], TEXT("Save diagnostics verbosity (0 off, 1 error, 2 warning, 3 log, 4 verbose)"));
+static FAutoConsoleVariableRef CVarDiagDrops(TEXT("Diag.Drops"), GDiagVerbosity[4], TEXT("Drops diagnostics verbosity (0 off, 1 error, 2 warning, 3 log, 4 verbose)"));
+static FAutoConsoleVariableRef CVarDiagDraw(TEXT("Diag.DrawCategories"), GDiagDrawCategories, TEXT("Bitmask of the categories whose debug shapes are drawn (1 General, 2 Movement, 4 Interaction, 8 Save, 16 Drops)"));
+static FAutoConsoleVariableRef CVarDiagEcho(TEXT("Diag.Echo"), GDiagEcho, TEXT("Also print diagnostics messages to the output log"));
+
+namespace
+{
+    constexpr int32 RingCapacity = 256;
+
+    enum class EShape : uint8 { Line, Sphere, Box };
+
+    struct FShape
+    {
+        TWeakObjectPtr<const UWorld> World;
+        EShape Kind = EShape::Line;
+        FVector A = FVector::ZeroVector; // Line start, sphere / box center
+        FVector B = FVector::ZeroVector; // Line end, box extent, sphere radius in X
+        FColor Color = FColor::White;
+        float Duration = 0.f;
+    };
+
+    FCriticalSection Lock;
+    TArray<FDiagEntry> Ring;
+    int32 RingHead = 0;
+    uint64 Dropped = 0;
+    uint64 WorkCount = 0;
+    TArray<FShape> Shapes;
+    FDelegateHandle FlushHandle;
+
+    void AppendLines(const FShape& Shape, TArray<FBatchedLine>& OutLines)
+    {
+        auto Add = [&](const FVector& Start, const FVector& End)
+        {
+            OutLines.Emplace(Start, End, FLinearColor(Shape.Color), Shape.Duration, 1.f, SDPG_World);
+        };
+
+        switch (Shape.Kind)
+        {
+        case EShape::Line:
+            Add(Shape.A, Shape.B);
+            break;
+        case EShape::Sphere:
+        {
+            // One circle per axis plane
+            constexpr int32 Segments = 16;
+            const float Radius = Shape.B.X;
+            for (int32 i = 0; i < Segments; ++i)
+            {
+                const float A0 = 2.f * PI * i / Segments;
+                const float A1 = 2.f * PI * (i + 1) / Segments;
+                const FVector2D P0(FMath::Cos(A0) * Radius, FMath::Sin(A0) * Radius);
+                const FVector2D P1(FMath::Cos(A1) * Radius, FMath::Sin(A1) * Radius);
+                Add(Shape.A + FVector(P0.X, P0.Y, 0.f), Shape.A + FVector(P1.X, P1.Y, 0.f));
+                Add(Shape.A + FVector(P0.X, 0.f, P0.Y), Shape.A + FVector(P1.X, 0.f, P1.Y));
+                Add(Shape.A + FVector(0.f, P0.X, P0.Y), Shape.A + FVector(0.f, P1.X, P1.Y));
+            }
+            break;
+        }
+        case EShape::Box:
+        {
+            const FVector& C = Shape.A;
+            const FVector& E = Shape.B;
+            for (int32 i = 0; i < 4; ++i)
+            {
+                const float X0 = (i == 0 || i == 3) ? -E.X : E.X;
+                const float Y0 = (i < 2) ? -E.Y : E.Y;
+                const float X1 = (i == 0 || i == 1) ? E.X : -E.X;
+                const float Y1 = (i == 0 || i == 3) ? -E.Y : E.Y;
+                Add(C + FVector(X0, Y0, -E.Z), C + FVector(X1, Y1, -E.Z)); // Bottom edge
+                Add(C + FVector(X0, Y0, E.Z), C + FVector(X1, Y1, E.Z));   // Top edge
+                Add(C + FVector(X0, Y0, -E.Z), C + FVector(X0, Y0, E.Z));  // Vertical edge
+            }
+            break;
+        }
+        }
+    }
+
+    // Sends the world's queued shapes to its line batcher in one call
+    void FlushWorld(UWorld* World, ELevelTick, float)
+    {
+        TArray<FBatchedLine> Lines;
+        {
+            FScopeLock ScopeLock(&Lock);
+            for (int32 i = Shapes.Num() - 1; i >= 0; --i)
+            {
+                if (!Shapes[i].World.IsValid())
+                {
+                    Shapes.RemoveAtSwap(i);
+                }
+                else if (Shapes[i].World.Get() == World)
+                {
+                    AppendLines(Shapes[i], Lines);
+                    Shapes.RemoveAtSwap(i);
+                }
+            }
+        }
+
+        if (Lines.Num() > 0 && World->LineBatcher)
+            World->LineBatcher->DrawLines(Lines);
+    }
+
+    void Queue(FShape&& Shape)
+    {
+        if (!Shape.World.IsValid())
+            return;
+
+        FScopeLock ScopeLock(&Lock);
+        if (!FlushHandle.IsValid())
+            FlushHandle = FWorldDelegates::OnWorldPostActorTick.AddStatic(&FlushWorld);
+
+        Shapes.Add(MoveTemp(Shape));
+        ++WorkCount;
+    }
+}
+
+void FDiagnostics::Log(EDiagCategory Category, EDiagVerbosity Verbosity, FString&& Message)
+{
+    if (GDiagEcho)
+    {
+        switch (Verbosity)
+        {
+        case EDiagVerbosity::Error:
+            UE_LOG(LogTemp, Error, TEXT("%s"), *Message);
+            break;
+        case EDiagVerbosity::Warning:
+            UE_LOG(LogTemp, Warning, TEXT("%s"), *Message);
+            break;
+        case EDiagVerbosity::Verbose:
+            UE_LOG(LogTemp, Verbose, TEXT("%s"), *Message);
+            break;
+        default:
+            UE_LOG(LogTemp, Log, TEXT("%s"), *Message);
+            break;
+        }
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    ++WorkCount;
+
+    FDiagEntry Entry;
+    Entry.Frame = GFrameCounter;
+    Entry.Category = Category;
+    Entry.Verbosity = Verbosity;
+    Entry.Message = MoveTemp(Message);
+
+    if (Ring.Num() < RingCapacity)
+    {
+        Ring.Add(MoveTemp(Entry));
+        return;
+    }
+
+    Ring[RingHead] = MoveTemp(Entry);
+    RingHead = (RingHead + 1) % RingCapacity;
+    ++Dropped;
+}
+
+void FDiagnostics::QueueLine(const UWorld* World, const FVector& Start, const FVector& End, const FColor& Color, float Duration)
+{
+    FShape Shape;
+    Shape.World = World;
+    Shape.Kind = EShape::Line;
+    Shape.A = Start;
+    Shape.B = End;
+    Shape.Color = Color;
+    Shape.Duration = Duration;
+    Queue(MoveTemp(Shape));
+}
+
+void FDiagnostics::QueueSphere(const UWorld* World, const FVector& Center, float Radius, const FColor& Color, float Duration)
+{
+    FShape Shape;
+    Shape.World = World;
+    Shape.Kind = EShape::Sphere;
+    Shape.A = Center;
+    Shape.B = FVector(Radius, 0.f, 0.f);
+    Shape.Color = Color;
+    Shape.Duration = Duration;
+    Queue(MoveTemp(Shape));
+}
+
+void FDiagnostics::QueueBox(const UWorld* World, const FVector& Center, const FVector& Extent, const FColor& Color, float Duration)
+{
+    FShape Shape;
+    Shape.World = World;
+    Shape.Kind = EShape::Box;
+    Shape.A = Center;
+    Shape.B = Extent;
+    Shape.Color = Color;
+    Shape.Duration = Duration;
+    Queue(MoveTemp(Shape));
+}
+
+TArray<FDiagEntry> FDiagnostics::GetRecent()
+{
+    FScopeLock ScopeLock(&Lock);
+    TArray<FDiagEntry> Result;
+    Result.Reserve(Ring.Num());
+    for (int32 i = 0; i < Ring.Num(); ++i)
+        Result.Add(Ring[(RingHead + i) % Ring.Num()]);
+    return Result;
+}
+
+uint64 FDiagnostics::GetDropped()
+{
+    FScopeLock ScopeLock(&Lock);
+    return Dropped;
+}
+
+uint64 FDiagnostics::GetWorkCount()
+{
+    FScopeLock ScopeLock(&Lock);
+    return WorkCount;
+}
+
+static FAutoConsoleCommand GDiagRecentCommand(
+    TEXT("Diag.Recent"),
+    TEXT("Prints the diagnostics messages still in the ring buffer"),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        const TArray<FDiagEntry> Recent = FDiagnostics::GetRecent();
+        UE_LOG(LogTemp, Log, TEXT("%d diagnostics messages, %llu dropped:"), Recent.Num(), FDiagnostics::GetDropped());
+        for (const FDiagEntry& Entry : Recent)
+            UE_LOG(LogTemp, Log, TEXT("  frame %llu [%d:%d] %s"), Entry.Frame, static_cast<int32>(Entry.Category), static_cast<int32>(Entry.Verbosity), *Entry.Message);
+    }));
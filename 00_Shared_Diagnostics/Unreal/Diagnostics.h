@@ -0,0 +1,102 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Compiled out of shipping builds, unless the project defines DIAG_ENABLED itself
+#ifndef DIAG_ENABLED
+#define DIAG_ENABLED !UE_BUILD_SHIPPING
+#endif
+
+enum class EDiagCategory : uint8
+{
+    General,
+    Movement,
+    Interaction,
+    Save,
+    Drops,
+    Count
+};
+
+enum class EDiagVerbosity : uint8
+{
+    Off,
+    Error,
+    Warning,
+    Log,
+    Verbose
+};
+
+struct FDiagEntry
+{
+    uint64 Frame = 0;
+    EDiagCategory Category = EDiagCategory::General;
+    EDiagVerbosity Verbosity = EDiagVerbosity::Log;
+    FString Message;
+};
+
+// Per category verbosity (Diag.<Category> cvars) and the categories that draw (Diag.DrawCategories bitmask)
+extern MECHANICS_TEST_LVN_API int32 GDiagVerbosity[static_cast<int32>(EDiagCategory::Count)];
+extern MECHANICS_TEST_LVN_API int32 GDiagDrawCategories;
+
+/* --------------------------------------------------------------------------
+   Diagnostics facade shared by logging and debug drawing.
+
+   • Use the macros. DIAG_LOG checks the category's verbosity before FString::Printf
+     runs, so a disabled call does no formatting and no allocation. With DIAG_ENABLED 0
+     the macros are empty and their arguments are never evaluated.
+   • Verbosity per category comes from the Diag.General / Diag.Movement / ... cvars
+     (0 off, 1 error, 2 warning, 3 log, 4 verbose).
+   • Messages that pass go to a ring buffer (GetRecent, GetDropped counts the ones
+     overwritten) and, with Diag.Echo, to the output log.
+   • DIAG_LINE / DIAG_SPHERE / DIAG_BOX queue shapes for categories in
+     Diag.DrawCategories. The queue is sent to the world's line batcher in one batch
+     per frame, after the actors tick.
+   • Diag.Recent prints the buffer. Tests/DiagnosticsTests.cpp checks that disabled
+     calls do no work.
+   -------------------------------------------------------------------------- */
+class MECHANICS_TEST_LVN_API FDiagnostics
+{
+public:
+    static bool IsEnabled(EDiagCategory Category, EDiagVerbosity Verbosity)
+    {
+        return static_cast<int32>(Verbosity) <= GDiagVerbosity[static_cast<int32>(Category)];
+    }
+
+    static bool IsDrawEnabled(EDiagCategory Category)
+    {
+        return (GDiagDrawCategories & (1 << static_cast<int32>(Category))) != 0;
+    }
+
+    // Called by the macros once the category is known to be enabled
+    static void Log(EDiagCategory Category, EDiagVerbosity Verbosity, FString&& Message);
+    static void QueueLine(const UWorld* World, const FVector& Start, const FVector& End, const FColor& Color, float Duration);
+    static void QueueSphere(const UWorld* World, const FVector& Center, float Radius, const FColor& Color, float Duration);
+    static void QueueBox(const UWorld* World, const FVector& Center, const FVector& Extent, const FColor& Color, float Duration);
+
+    static TArray<FDiagEntry> GetRecent(); // Oldest first
+    static uint64 GetDropped();
+
+    // Messages formatted plus shapes queued so far, what the disabled-cost test expects to stay put
+    static uint64 GetWorkCount();
+};
+
+#if DIAG_ENABLED
+    #define DIAG_LOG(Category, Verbosity, Format, ...) \
+        do { if (FDiagnostics::IsEnabled(EDiagCategory::Category, EDiagVerbosity::Verbosity)) \
+            FDiagnostics::Log(EDiagCategory::Category, EDiagVerbosity::Verbosity, FString::Printf(Format, ##__VA_ARGS__)); } while (0)
+#else
+    #define DIAG_LOG(Category, Verbosity, Format, ...) do {} while (0)
+#endif
+
+#if DIAG_ENABLED && ENABLE_DRAW_DEBUG
+    #define DIAG_LINE(World, Category, Start, End, Color, Duration) \
+        do { if (FDiagnostics::IsDrawEnabled(EDiagCategory::Category)) FDiagnostics::QueueLine(World, Start, End, Color, Duration); } while (0)
+    #define DIAG_SPHERE(World, Category, Center, Radius, Color, Duration) \
+        do { if (FDiagnostics::IsDrawEnabled(EDiagCategory::Category)) FDiagnostics::QueueSphere(World, Center, Radius, Color, Duration); } while (0)
+    #define DIAG_BOX(World, Category, Center, Extent, Color, Duration) \
+        do { if (FDiagnostics::IsDrawEnabled(EDiagCategory::Category)) FDiagnostics::QueueBox(World, Center, Extent, Color, Duration); } while (0)
+#else
+    #define DIAG_LINE(World, Category, Start, End, Color, Duration) do {} while (0)
+    #define DIAG_SPHERE(World, Category, Center, Radius, Color, Duration) do {} while (0)
+    #define DIAG_BOX(World, Category, Center, Extent, Color, Duration) do {} while (0)
+#endif
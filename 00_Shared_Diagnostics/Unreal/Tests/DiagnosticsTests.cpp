@@ -0,0 +1,88 @@
+#include "Misc/AutomationTest.h"
+#include "Diagnostics.h"
+#include "HAL/IConsoleManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && DIAG_ENABLED
+
+// Turns every category off and makes calls of each kind: none may evaluate its arguments (so FString::Printf never runs
+// and nothing is allocated) or format, buffer or queue anything. Enabled calls format once into the ring buffer.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Diagnostics; Quit" -nullrhi -unattended
+
+namespace DiagnosticsTests
+{
+    // Puts the cvars back when the test ends, echo off in between so the test doesn't flood the log
+    struct FScopedDiagState
+    {
+        int32 SavedVerbosity[UE_ARRAY_COUNT(GDiagVerbosity)];
+        int32 SavedDraw = GDiagDrawCategories;
+        IConsoleVariable* Echo = IConsoleManager::Get().FindConsoleVariable(TEXT("Diag.Echo"));
+        int32 SavedEcho = Echo ? Echo->GetInt() : 1;
+
+        FScopedDiagState()
+        {
+            FMemory::Memcpy(SavedVerbosity, GDiagVerbosity, sizeof(GDiagVerbosity));
+            FMemory::Memzero(GDiagVerbosity, sizeof(GDiagVerbosity));
+            GDiagDrawCategories = 0;
+            if (Echo)
+                Echo->Set(0);
+        }
+
+        ~FScopedDiagState()
+        {
+            FMemory::Memcpy(GDiagVerbosity, SavedVerbosity, sizeof(GDiagVerbosity));
+            GDiagDrawCategories = SavedDraw;
+            if (Echo)
+                Echo->Set(SavedEcho);
+        }
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDiagnosticsDisabledCostTest, "LVN.Diagnostics.DisabledCost", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FDiagnosticsDisabledCostTest::RunTest(const FString& Parameters)
+{
+    using namespace DiagnosticsTests;
+
+    FScopedDiagState State;
+
+    int32 Evaluated = 0;
+    auto Count = [&Evaluated](int32 Value) { ++Evaluated; return Value; };
+
+    const uint64 WorkBefore = FDiagnostics::GetWorkCount();
+    constexpr int32 Calls = 10000;
+    for (int32 i = 0; i < Calls; ++i)
+    {
+        DIAG_LOG(Movement, Verbose, TEXT("Disabled %d at %s"), Count(i), *FVector(i).ToString());
+        DIAG_LOG(Save, Error, TEXT("Disabled %d"), Count(i));
+        DIAG_LINE(nullptr, Movement, FVector::ZeroVector, FVector(Count(i)), FColor::Green, 0.f);
+        DIAG_SPHERE(nullptr, Drops, FVector(Count(i)), 10.f, FColor::Red, 0.f);
+        DIAG_BOX(nullptr, Interaction, FVector(Count(i)), FVector(10.f), FColor::Blue, 0.f);
+    }
+
+    TestEqual(TEXT("Arguments of disabled calls are never evaluated"), Evaluated, 0);
+    TestEqual(TEXT("Disabled calls format, buffer and queue nothing"), FDiagnostics::GetWorkCount() - WorkBefore, static_cast<uint64>(0));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDiagnosticsEnabledTest, "LVN.Diagnostics.Enabled", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FDiagnosticsEnabledTest::RunTest(const FString& Parameters)
+{
+    using namespace DiagnosticsTests;
+
+    FScopedDiagState State;
+    GDiagVerbosity[static_cast<int32>(EDiagCategory::Save)] = static_cast<int32>(EDiagVerbosity::Log);
+
+    const uint64 WorkBefore = FDiagnostics::GetWorkCount();
+    DIAG_LOG(Save, Log, TEXT("Saved slot %d in %d ms"), 3, 12);
+    DIAG_LOG(Save, Verbose, TEXT("Above the category's level %d"), 4);
+
+    const TArray<FDiagEntry> Recent = FDiagnostics::GetRecent();
+    TestEqual(TEXT("One message formatted"), FDiagnostics::GetWorkCount() - WorkBefore, static_cast<uint64>(1));
+    if (TestTrue(TEXT("Ring buffer has the message"), Recent.Num() > 0))
+    {
+        TestEqual(TEXT("Message"), Recent.Last().Message, FString(TEXT("Saved slot 3 in 12 ms")));
+        TestTrue(TEXT("Category"), Recent.Last().Category == EDiagCategory::Save);
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,194 @@
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Runtime.CompilerServices;
+using NUnit.Framework;
+using Unity.PerformanceTesting;
+using UnityEngine;
+
+/* --------------------------------------------------------------------------
+   Committed baselines for the modules' [Performance] tests.
+
+   • A module keeps PerfBaselines/<Suite>.json next to its performance tests: one
+     entry per sample group, with the test that records it and its median and p95.
+   • AssertWithin(suite) ends a test. It fails when the file is missing, when it has
+     no entries for the test, when the test recorded a sample group the baseline
+     doesn't list or skipped one it does, when a time grows more than 25% (plus a
+     0.05 ms noise floor), or when a .GC() allocation count grows at all.
+   • Times are only compared once recorded: entries without recordedOn are budgets
+     nobody has measured, and only their allocation counts are checked.
+   • With -perfUpdateBaseline on the command line the test's entries are written
+     from this run instead, stamped with the machine, to be reviewed and committed
+     with the change.
+   • AssertBudget checks a sample group's median against a fixed budget, a design
+     target that holds on any machine, whether or not the baseline is recorded.
+   • Frames samples real frames while a callback runs once per frame, which
+     Measure.Frames can't do. Vsync and the frame rate cap are off while it samples.
+     Times are in ms.
+   -------------------------------------------------------------------------- */
+public static class PerfBaseline
+{
+    [Serializable]
+    private class Entry
+    {
+        public string test;
+        public string name;
+        public double median;
+        public double p95;
+        public string recordedOn; // Machine and Unity version, empty for a budget nobody measured
+    }
+
+    [Serializable]
+    private class Suite
+    {
+        public string suite;
+        public List<Entry> metrics = new List<Entry>();
+    }
+
+    private const double Threshold = 0.25;
+    private const double NoiseFloorMs = 0.05;
+    private const string UpdateArgument = "-perfUpdateBaseline";
+
+    public static IEnumerator Frames(string name, int frames, Action<int> perFrame = null, int warmup = 10)
+    {
+        // Otherwise every frame waits for the display, and the samples are its refresh interval
+        int vSyncCount = QualitySettings.vSyncCount;
+        int targetFrameRate = Application.targetFrameRate;
+        QualitySettings.vSyncCount = 0;
+        Application.targetFrameRate = -1;
+
+        try
+        {
+            var group = new SampleGroup(name, SampleUnit.Millisecond);
+            for (int i = 0; i < warmup; i++)
+            {
+                perFrame?.Invoke(i);
+                yield return null;
+            }
+
+            long last = Stopwatch.GetTimestamp();
+            for (int i = 0; i < frames; i++)
+            {
+                perFrame?.Invoke(warmup + i);
+                yield return null;
+
+                long now = Stopwatch.GetTimestamp();
+                Measure.Custom(group, (now - last) * 1000.0 / Stopwatch.Frequency);
+                last = now;
+            }
+        }
+        finally
+        {
+            QualitySettings.vSyncCount = vSyncCount;
+            Application.targetFrameRate = targetFrameRate;
+        }
+    }
+
+    // testFile is filled in by the compiler, so the baseline is found next to the calling test
+    public static void AssertWithin(string suite, [CallerFilePath] string testFile = "")
+    {
+        string test = TestContext.CurrentContext.Test.MethodName;
+        string path = Path.Combine(Path.GetDirectoryName(testFile), "PerfBaselines", suite + ".json");
+        List<SampleGroup> groups = PerformanceTest.Active.SampleGroups;
+        Assert.IsNotEmpty(groups, $"{test} recorded nothing to compare");
+
+        if (Array.IndexOf(Environment.GetCommandLineArgs(), UpdateArgument) >= 0)
+        {
+            Update(path, suite, test, groups);
+            Assert.Warn($"{test}: baseline entries written to {path}, review and commit them");
+            return;
+        }
+
+        Assert.IsTrue(File.Exists(path), $"No performance baseline at {path}. Record one with {UpdateArgument} and commit it.");
+        Suite baseline = JsonUtility.FromJson<Suite>(File.ReadAllText(path));
+        List<Entry> expected = baseline?.metrics?.FindAll(entry => entry.test == test) ?? new List<Entry>();
+        Assert.IsNotEmpty(expected, $"{path} has no entries for {test}");
+
+        var failures = new List<string>();
+        var unrecorded = new List<string>();
+        foreach (Entry reference in expected)
+        {
+            SampleGroup group = groups.Find(candidate => candidate.Name == reference.name);
+            if (group == null)
+            {
+                failures.Add($"{reference.name}: in the baseline but not recorded");
+                continue;
+            }
+
+            double median = Percentile(group.Samples, 0.5);
+            double p95 = Percentile(group.Samples, 0.95);
+            if (IsAllocationCount(group))
+            {
+                if (median > reference.median || p95 > reference.p95)
+                    failures.Add($"{group.Name}: allocations {reference.median}/{reference.p95} -> {median}/{p95} (median/p95)");
+            }
+            else if (string.IsNullOrEmpty(reference.recordedOn))
+                unrecorded.Add($"{group.Name}: median {median:F3} ms, p95 {p95:F3} ms");
+            else if (median > reference.median * (1.0 + Threshold) + NoiseFloorMs)
+                failures.Add($"{group.Name}: median {reference.median:F3} -> {median:F3} ms");
+            else if (p95 > reference.p95 * (1.0 + Threshold) + NoiseFloorMs)
+                failures.Add($"{group.Name}: p95 {reference.p95:F3} -> {p95:F3} ms");
+        }
+
+        foreach (SampleGroup group in groups)
+        {
+            if (!expected.Exists(entry => entry.name == group.Name))
+                failures.Add($"{group.Name}: recorded but not in the baseline");
+        }
+
+        Assert.IsEmpty(failures, $"{suite}/{test} against {path}:\n{string.Join("\n", failures)}");
+        if (unrecorded.Count > 0)
+            Assert.Warn($"{suite}/{test}: times not compared, {path} has no recorded times for them. " +
+                        $"Record them with {UpdateArgument} on the reference machine:\n{string.Join("\n", unrecorded)}");
+    }
+
+    public static void AssertBudget(string sampleGroup, double budgetMs)
+    {
+        SampleGroup group = PerformanceTest.Active.SampleGroups.Find(candidate => candidate.Name == sampleGroup);
+        Assert.IsNotNull(group, $"{sampleGroup} wasn't recorded");
+
+        double median = Percentile(group.Samples, 0.5);
+        Assert.LessOrEqual(median, budgetMs, $"{sampleGroup}: median {median:F4} ms over the {budgetMs:F3} ms budget");
+    }
+
+    private static void Update(string path, string suite, string test, List<SampleGroup> groups)
+    {
+        Suite baseline = File.Exists(path) ? JsonUtility.FromJson<Suite>(File.ReadAllText(path)) : null;
+        baseline ??= new Suite();
+        baseline.suite = suite;
+        baseline.metrics.RemoveAll(entry => entry.test == test);
+
+        foreach (SampleGroup group in groups)
+        {
+            baseline.metrics.Add(new Entry
+            {
+                test = test,
+                name = group.Name,
+                median = Percentile(group.Samples, 0.5),
+                p95 = Percentile(group.Samples, 0.95),
+                recordedOn = IsAllocationCount(group) ? null : Machine
+            });
+        }
+
+        Directory.CreateDirectory(Path.GetDirectoryName(path));
+        File.WriteAllText(path, JsonUtility.ToJson(baseline, true));
+    }
+
+    private static string Machine => $"{SystemInfo.processorType}, {SystemInfo.graphicsDeviceName}, Unity {Application.unityVersion}";
+
+    // The .GC() group Measure.Method adds counts allocations, it isn't a time
+    private static bool IsAllocationCount(SampleGroup group) => group.Name.EndsWith(".GC()", StringComparison.Ordinal);
+
+    private static double Percentile(List<double> samples, double percentile)
+    {
+        if (samples.Count == 0) return 0.0;
+
+        var sorted = new List<double>(samples);
+        sorted.Sort();
+        if (percentile == 0.5 && sorted.Count % 2 == 0)
+            return (sorted[sorted.Count / 2 - 1] + sorted[sorted.Count / 2]) * 0.5;
+        return sorted[Mathf.Clamp(Mathf.CeilToInt((float)(sorted.Count * percentile)) - 1, 0, sorted.Count - 1)];
+    }
+}
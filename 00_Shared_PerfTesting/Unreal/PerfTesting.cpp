@@ -0,0 +1,315 @@
+#include "PerfTesting.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/UObjectArray.h"
+
+namespace
+{
+    constexpr double Threshold = 0.25;
+    constexpr double NoiseFloorMs = 0.05;
+    constexpr double ObjectSlack = 0.5; // Per sample
+
+    // Counts every UObject created while at least one recorder exists
+    class FObjectCounter : public FUObjectArray::FUObjectCreateListener
+    {
+    public:
+        TAtomic<uint64> Created{ 0 };
+
+        void Start()
+        {
+            if (Users++ == 0)
+                GUObjectArray.AddUObjectCreateListener(this);
+        }
+
+        void Stop()
+        {
+            if (--Users == 0)
+                GUObjectArray.RemoveUObjectCreateListener(this);
+        }
+
+        virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override { ++Created; }
+        virtual void OnUObjectArrayShutdown() override
+        {
+            if (Users > 0)
+                GUObjectArray.RemoveUObjectCreateListener(this);
+            Users = 0;
+        }
+
+    private:
+        int32 Users = 0;
+    };
+
+    FObjectCounter ObjectCounter;
+
+    FString Machine()
+    {
+        return FString::Printf(TEXT("%s, %s, Unreal %s"), *FPlatformMisc::GetCPUBrand().TrimStartAndEnd(),
+            *FPlatformMisc::GetPrimaryGPUBrand(), *FEngineVersion::Current().ToString(EVersionComponent::Patch));
+    }
+
+    TSharedRef<FJsonObject> ToJson(const FString& TestName, const FPerfMetric& Metric)
+    {
+        TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+        Object->SetStringField(TEXT("test"), TestName);
+        Object->SetStringField(TEXT("name"), Metric.Name);
+        Object->SetNumberField(TEXT("medianMs"), Metric.MedianMs);
+        Object->SetNumberField(TEXT("p95Ms"), Metric.P95Ms);
+        Object->SetNumberField(TEXT("objectsPerSample"), Metric.ObjectsPerSample);
+        Object->SetStringField(TEXT("recordedOn"), Machine());
+        return Object;
+    }
+
+    // Replaces the test's entries and keeps the other tests'
+    bool UpdateBaseline(const FString& Path, const FString& Suite, const FString& TestName, const TArray<FPerfMetric>& Metrics)
+    {
+        TArray<TSharedPtr<FJsonValue>> Entries;
+        FString Text;
+        TSharedPtr<FJsonObject> Existing;
+        const TArray<TSharedPtr<FJsonValue>>* ExistingEntries = nullptr;
+        if (FFileHelper::LoadFileToString(Text, *Path) && FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Text), Existing)
+            && Existing.IsValid() && Existing->TryGetArrayField(TEXT("metrics"), ExistingEntries))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *ExistingEntries)
+            {
+                const TSharedPtr<FJsonObject>* Entry = nullptr;
+                if (Value->TryGetObject(Entry) && (*Entry)->GetStringField(TEXT("test")) != TestName)
+                    Entries.Add(Value);
+            }
+        }
+
+        for (const FPerfMetric& Metric : Metrics)
+            Entries.Add(MakeShared<FJsonValueObject>(ToJson(TestName, Metric)));
+
+        TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+        Root->SetStringField(TEXT("suite"), Suite);
+        Root->SetArrayField(TEXT("metrics"), Entries);
+
+        FString Output;
+        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+        return FJsonSerializer::Serialize(Root, Writer) && FFileHelper::SaveStringToFile(Output, *Path);
+    }
+}
+
+FPerfRecorder::FPerfRecorder()
+{
+    ObjectCounter.Start();
+}
+
+FPerfRecorder::~FPerfRecorder()
+{
+    ObjectCounter.Stop();
+}
+
+void FPerfRecorder::Measure(const FString& Name, int32 Iterations, TFunctionRef<void(int32)> Body, int32 Warmup)
+{
+    for (int32 i = 0; i < Warmup; ++i)
+        Body(i);
+
+    TArray<double> Samples;
+    Samples.SetNumUninitialized(Iterations);
+    const uint64 ObjectsBefore = ObjectCounter.Created;
+    for (int32 i = 0; i < Iterations; ++i)
+    {
+        const double Start = FPlatformTime::Seconds();
+        Body(Warmup + i);
+        Samples[i] = (FPlatformTime::Seconds() - Start) * 1000.0;
+    }
+
+    AddMetric(Name, Samples, ObjectCounter.Created - ObjectsBefore);
+}
+
+void FPerfRecorder::MeasureTicks(const FString& Name, FPerfTestWorld& World, int32 Ticks, TFunctionRef<void(int32)> PerTick, int32 Warmup)
+{
+    Measure(Name, Ticks, [&World, &PerTick](int32 Tick)
+    {
+        PerTick(Tick);
+        World.Tick();
+    }, Warmup);
+}
+
+void FPerfRecorder::AddMetric(const FString& Name, TArray<double>& Samples, uint64 Objects)
+{
+    Samples.Sort();
+
+    FPerfMetric Metric;
+    Metric.Name = Name;
+    Metric.Samples = Samples.Num();
+    if (Samples.Num() > 0)
+    {
+        const int32 Half = Samples.Num() / 2;
+        Metric.MedianMs = Samples.Num() % 2 == 1 ? Samples[Half] : (Samples[Half - 1] + Samples[Half]) * 0.5;
+        Metric.P95Ms = Samples[FMath::Clamp(FMath::CeilToInt(Samples.Num() * 0.95) - 1, 0, Samples.Num() - 1)];
+        Metric.ObjectsPerSample = static_cast<double>(Objects) / Samples.Num();
+    }
+
+    Metrics.RemoveAll([&Name](const FPerfMetric& Existing) { return Existing.Name == Name; });
+    Metrics.Add(Metric);
+}
+
+bool FPerfRecorder::CheckBaseline(FAutomationTestBase& Test, const FString& Suite, const ANSICHAR* TestFile) const
+{
+    const FString TestName = Test.GetBeautifiedTestName();
+    const FString Path = FPaths::GetPath(FString(UTF8_TO_TCHAR(TestFile))) / TEXT("PerfBaselines") / (Suite + TEXT(".json"));
+
+    for (const FPerfMetric& Metric : Metrics)
+    {
+        Test.AddInfo(FString::Printf(TEXT("%s: median %.3f ms, p95 %.3f ms, %.2f objects per sample (%d samples)"),
+            *Metric.Name, Metric.MedianMs, Metric.P95Ms, Metric.ObjectsPerSample, Metric.Samples));
+    }
+
+    if (Metrics.Num() == 0)
+    {
+        Test.AddError(FString::Printf(TEXT("%s recorded nothing to compare"), *TestName));
+        return false;
+    }
+
+    if (FParse::Param(FCommandLine::Get(), TEXT("PerfUpdateBaseline")))
+    {
+        if (!UpdateBaseline(Path, Suite, TestName, Metrics))
+        {
+            Test.AddError(FString::Printf(TEXT("Could not write %s"), *Path));
+            return false;
+        }
+        Test.AddWarning(FString::Printf(TEXT("%s: baseline entries written to %s, review and commit them"), *TestName, *Path));
+        return true;
+    }
+
+    FString Text;
+    TSharedPtr<FJsonObject> Baseline;
+    const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+    if (!FFileHelper::LoadFileToString(Text, *Path) || !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Text), Baseline)
+        || !Baseline.IsValid() || !Baseline->TryGetArrayField(TEXT("metrics"), Entries))
+    {
+        Test.AddError(FString::Printf(TEXT("No performance baseline at %s. Record one with -PerfUpdateBaseline and commit it."), *Path));
+        return false;
+    }
+
+    bool bPassed = true;
+    TSet<FString> Expected;
+    TArray<FString> Unrecorded;
+    for (const TSharedPtr<FJsonValue>& Value : *Entries)
+    {
+        const TSharedPtr<FJsonObject>* Entry = nullptr;
+        if (!Value->TryGetObject(Entry) || (*Entry)->GetStringField(TEXT("test")) != TestName)
+            continue;
+
+        const FString Name = (*Entry)->GetStringField(TEXT("name"));
+        Expected.Add(Name);
+
+        const FPerfMetric* Metric = Metrics.FindByPredicate([&Name](const FPerfMetric& Candidate) { return Candidate.Name == Name; });
+        if (!Metric)
+        {
+            Test.AddError(FString::Printf(TEXT("%s: in the baseline but not recorded"), *Name));
+            bPassed = false;
+            continue;
+        }
+
+        const double BaseMedian = (*Entry)->GetNumberField(TEXT("medianMs"));
+        const double BaseP95 = (*Entry)->GetNumberField(TEXT("p95Ms"));
+        const double BaseObjects = (*Entry)->GetNumberField(TEXT("objectsPerSample"));
+
+        // Times without recordedOn are budgets nobody measured, only their object counts are compared
+        FString RecordedOn;
+        const bool bTimesRecorded = (*Entry)->TryGetStringField(TEXT("recordedOn"), RecordedOn) && !RecordedOn.IsEmpty();
+        if (!bTimesRecorded)
+            Unrecorded.Add(FString::Printf(TEXT("%s: median %.3f ms, p95 %.3f ms"), *Name, Metric->MedianMs, Metric->P95Ms));
+
+        FString Failure;
+        if (bTimesRecorded && Metric->MedianMs > BaseMedian * (1.0 + Threshold) + NoiseFloorMs)
+            Failure = FString::Printf(TEXT("median %.3f -> %.3f ms"), BaseMedian, Metric->MedianMs);
+        else if (bTimesRecorded && Metric->P95Ms > BaseP95 * (1.0 + Threshold) + NoiseFloorMs)
+            Failure = FString::Printf(TEXT("p95 %.3f -> %.3f ms"), BaseP95, Metric->P95Ms);
+        else if (Metric->ObjectsPerSample > BaseObjects + ObjectSlack)
+            Failure = FString::Printf(TEXT("objects %.2f -> %.2f per sample"), BaseObjects, Metric->ObjectsPerSample);
+
+        if (!Failure.IsEmpty())
+        {
+            Test.AddError(FString::Printf(TEXT("%s regressed: %s"), *Name, *Failure));
+            bPassed = false;
+        }
+    }
+
+    if (Expected.Num() == 0)
+    {
+        Test.AddError(FString::Printf(TEXT("%s has no entries for %s"), *Path, *TestName));
+        return false;
+    }
+
+    for (const FPerfMetric& Metric : Metrics)
+    {
+        if (!Expected.Contains(Metric.Name))
+        {
+            Test.AddError(FString::Printf(TEXT("%s: recorded but not in the baseline"), *Metric.Name));
+            bPassed = false;
+        }
+    }
+
+    if (Unrecorded.Num() > 0)
+    {
+        Test.AddWarning(FString::Printf(TEXT("Times not compared, %s has no recorded times for them. Record them with -PerfUpdateBaseline on the reference machine: %s"),
+            *Path, *FString::Join(Unrecorded, TEXT("; "))));
+    }
+    return bPassed;
+}
+
+bool FPerfRecorder::CheckBudget(FAutomationTestBase& Test, const FString& Name, double BudgetMs) const
+{
+    const FPerfMetric* Metric = Metrics.FindByPredicate([&Name](const FPerfMetric& Candidate) { return Candidate.Name == Name; });
+    if (!Metric)
+    {
+        Test.AddError(FString::Printf(TEXT("%s wasn't recorded"), *Name));
+        return false;
+    }
+
+    if (Metric->MedianMs > BudgetMs)
+    {
+        Test.AddError(FString::Printf(TEXT("%s: median %.4f ms over the %.3f ms budget"), *Name, Metric->MedianMs, BudgetMs));
+        return false;
+    }
+    return true;
+}
+
+FPerfTestWorld::FPerfTestWorld(float InDeltaTime)
+    : DeltaTime(InDeltaTime)
+{
+    // A standalone game instance creates the world, so game instance subsystems exist as they do in a game
+    GameInstance = NewObject<UGameInstance>(GEngine);
+    GameInstance->AddToRoot();
+    GameInstance->InitializeStandalone();
+    World = GameInstance->GetWorld();
+
+    // No game mode in a bare world, so play begins through the world settings
+    World->InitializeActorsForPlay(FURL());
+    World->GetWorldSettings()->NotifyBeginPlay();
+}
+
+FPerfTestWorld::~FPerfTestWorld()
+{
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+    GameInstance->Shutdown();
+    GameInstance->RemoveFromRoot();
+}
+
+void FPerfTestWorld::Tick()
+{
+    World->Tick(LEVELTICK_All, DeltaTime);
+}
+
+#endif
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class UGameInstance;
+class UWorld;
+class FPerfTestWorld;
+
+struct FPerfMetric
+{
+    FString Name;
+    int32 Samples = 0;
+    double MedianMs = 0.0;
+    double P95Ms = 0.0;
+    double ObjectsPerSample = 0.0; // UObjects created per sample
+};
+
+/* --------------------------------------------------------------------------
+   Measurement and committed baselines for the modules' performance automation tests.
+
+   • Measure times a synchronous body per iteration. Each metric keeps the median and
+     p95 in ms and the UObjects created per sample, the garbage the collector later
+     has to walk and free (Unreal has no per-thread allocation counter).
+   • MeasureTicks ticks an FPerfTestWorld by hand and samples each world tick, with
+     PerTick run before it.
+   • CheckBaseline compares the metrics with PerfBaselines/<Suite>.json next to the
+     test file (pass __FILE__), entries keyed by the test's name. The test fails when
+     the file is missing, when it has no entries for the test, when a metric is missing
+     on either side, when a time grows more than 25% (plus a 0.05 ms noise floor) or
+     when more objects are created than before.
+   • Times are only compared once recorded: entries without recordedOn are budgets
+     nobody has measured, and only their object counts are checked.
+   • With -PerfUpdateBaseline the test's entries are written from this run instead,
+     stamped with the machine, to be reviewed and committed with the change.
+   • CheckBudget checks a metric's median against a fixed budget, a design target
+     that holds on any machine, whether or not the baseline is recorded.
+   • MeasureTicks samples world ticks called by hand, which never wait on vsync or
+     the frame rate cap, so frame samples need no Unreal equivalent of turning them off.
+   -------------------------------------------------------------------------- */
+class MECHANICS_TEST_LVN_API FPerfRecorder
+{
+public:
+    FPerfRecorder();
+    ~FPerfRecorder();
+
+    void Measure(const FString& Name, int32 Iterations, TFunctionRef<void(int32)> Body, int32 Warmup = 10);
+    void MeasureTicks(const FString& Name, FPerfTestWorld& World, int32 Ticks, TFunctionRef<void(int32)> PerTick, int32 Warmup = 10);
+
+    bool CheckBaseline(FAutomationTestBase& Test, const FString& Suite, const ANSICHAR* TestFile) const;
+    bool CheckBudget(FAutomationTestBase& Test, const FString& Name, double BudgetMs) const;
+
+    const TArray<FPerfMetric>& GetMetrics() const { return Metrics; }
+
+private:
+    void AddMetric(const FString& Name, TArray<double>& Samples, uint64 Objects);
+
+    TArray<FPerfMetric> Metrics;
+};
+
+// A game world that has begun play, with its own game instance, ticked by hand at DeltaTime. Destroyed with the scope.
+class MECHANICS_TEST_LVN_API FPerfTestWorld
+{
+public:
+    explicit FPerfTestWorld(float InDeltaTime = 1.f / 60.f);
+    ~FPerfTestWorld();
+
+    UWorld* Get() const { return World; }
+    UGameInstance* GetGameInstance() const { return GameInstance; }
+    void Tick();
+
+private:
+    UGameInstance* GameInstance = nullptr;
+    UWorld* World = nullptr;
+    float DeltaTime;
+};
+
+#endif
@@ -0,0 +1,132 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+/* --------------------------------------------------------------------------
+   Fades the renderers standing between the camera and its target.
+
+   • Several rays (center, then up / down / left / right of the pivot) are cast from the
+     pivot towards the camera, so a thin pole in front of the player's head doesn't fade
+     the whole wall behind it, and a wall covering only half the body is still caught.
+   • Fading goes through MaterialPropertyBlocks on the color property, so shared materials
+     are never instanced. The materials must support transparency (or dithering) on that
+     property for the fade to show.
+   • Steady state allocates nothing: hit buffer, renderer lookups and scratch lists are reused.
+   -------------------------------------------------------------------------- */
+public class CameraOcclusionFader
+{
+    private static readonly Vector2[] ProbeOffsets =
+    {
+        Vector2.zero, Vector2.up, Vector2.down, Vector2.left, Vector2.right,
+        new Vector2(0.7f, 0.7f), new Vector2(-0.7f, 0.7f), new Vector2(0.7f, -0.7f), new Vector2(-0.7f, -0.7f)
+    };
+
+    private readonly Dictionary<Renderer, float> _alphas = new();
+    private readonly HashSet<Renderer> _occluding = new();
+    private readonly Dictionary<Collider, Renderer[]> _renderersByCollider = new();
+    private readonly List<Renderer> _scratch = new();
+    private readonly RaycastHit[] _hits = new RaycastHit[16];
+    private readonly MaterialPropertyBlock _block = new();
+    private readonly int _colorId;
+
+    public LayerMask mask = ~0;
+    public Transform ignoreRoot; // The player: its own colliders never fade
+    public int rayCount = 5;
+    public float probeSpread = 0.35f;
+    public float fadedAlpha = 0.25f;
+    public float fadeSpeed = 6f;
+
+    public int FadedCount => _alphas.Count;
+
+    public CameraOcclusionFader(string colorProperty)
+    {
+        _colorId = Shader.PropertyToID(colorProperty);
+    }
+
+    // Collects the renderers hit between the pivot and the camera this frame
+    public void Detect(Vector3 pivot, Vector3 cameraPosition, Quaternion cameraRotation)
+    {
+        _occluding.Clear();
+
+        Vector3 right = cameraRotation * Vector3.right;
+        Vector3 up = cameraRotation * Vector3.up;
+        int rays = Mathf.Clamp(rayCount, 1, ProbeOffsets.Length);
+
+        for (int i = 0; i < rays; i++)
+        {
+            Vector3 origin = pivot + (right * ProbeOffsets[i].x + up * ProbeOffsets[i].y) * probeSpread;
+            Vector3 toCamera = cameraPosition - origin;
+            float length = toCamera.magnitude;
+            if (length < 0.01f) continue;
+
+            int count = Physics.RaycastNonAlloc(origin, toCamera / length, _hits, length, mask, QueryTriggerInteraction.Ignore);
+            for (int h = 0; h < count; h++)
+            {
+                if (ignoreRoot && _hits[h].collider.transform.IsChildOf(ignoreRoot)) continue;
+                foreach (Renderer r in GetRenderers(_hits[h].collider))
+                    _occluding.Add(r);
+            }
+        }
+    }
+
+    // Eases every tracked renderer towards faded or opaque, and drops the ones that are opaque again
+    public void Tick(float deltaTime)
+    {
+        foreach (Renderer r in _occluding)
+            if (!_alphas.ContainsKey(r)) _alphas.Add(r, 1f);
+
+        _scratch.Clear();
+        foreach (Renderer r in _alphas.Keys) _scratch.Add(r);
+
+        foreach (Renderer r in _scratch)
+        {
+            if (r == null)
+            {
+                _alphas.Remove(r);
+                continue;
+            }
+
+            bool occluding = _occluding.Contains(r);
+            float alpha = Mathf.MoveTowards(_alphas[r], occluding ? fadedAlpha : 1f, fadeSpeed * deltaTime);
+
+            if (!occluding && alpha >= 1f)
+            {
+                r.SetPropertyBlock(null);
+                _alphas.Remove(r);
+                continue;
+            }
+
+            _alphas[r] = alpha;
+            Apply(r, alpha);
+        }
+    }
+
+    public void RestoreAll()
+    {
+        foreach (Renderer r in _alphas.Keys)
+            if (r != null) r.SetPropertyBlock(null);
+
+        _alphas.Clear();
+        _occluding.Clear();
+    }
+
+    private void Apply(Renderer r, float alpha)
+    {
+        Material shared = r.sharedMaterial;
+        Color color = shared != null && shared.HasProperty(_colorId) ? shared.GetColor(_colorId) : Color.white;
+        color.a *= alpha;
+
+        r.GetPropertyBlock(_block);
+        _block.SetColor(_colorId, color);
+        r.SetPropertyBlock(_block);
+    }
+
+    private Renderer[] GetRenderers(Collider collider)
+    {
+        if (!_renderersByCollider.TryGetValue(collider, out Renderer[] renderers))
+        {
+            renderers = collider.GetComponentsInChildren<Renderer>();
+            _renderersByCollider.Add(collider, renderers);
+        }
+        return renderers;
+    }
+}
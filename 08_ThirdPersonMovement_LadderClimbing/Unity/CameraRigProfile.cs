@@ -0,0 +1,69 @@
+using UnityEngine;
+
+public enum CameraRigState { Crouch, Prone, Slide, Roll, Ledge, Glide, Ladder }
+
+// Framing values the camera blends between. The camera's own orbit settings are the base every profile blends over.
+public struct CameraRigSettings
+{
+    public float distance;
+    public float fieldOfView;
+    public Vector3 targetOffset; // Pivot offset in the yaw frame (x right, y up, z forward)
+    public float smoothTime;
+    public float lookAhead;
+
+    public static CameraRigSettings Lerp(in CameraRigSettings a, in CameraRigSettings b, float t)
+    {
+        return new CameraRigSettings
+        {
+            distance = Mathf.Lerp(a.distance, b.distance, t),
+            fieldOfView = Mathf.Lerp(a.fieldOfView, b.fieldOfView, t),
+            targetOffset = Vector3.Lerp(a.targetOffset, b.targetOffset, t),
+            smoothTime = Mathf.Lerp(a.smoothTime, b.smoothTime, t),
+            lookAhead = Mathf.Lerp(a.lookAhead, b.lookAhead, t)
+        };
+    }
+}
+
+// Per movement state framing. While its state is active a profile's weight eases to 1 over blendTime,
+// and profiles are layered over the base in ascending priority, so the most specific state wins.
+[System.Serializable]
+public class CameraRigProfile
+{
+    public string name = "Profile";
+    public CameraRigState state;
+    [Tooltip("Higher priority profiles blend on top of lower ones when several states are active.")]
+    public int priority;
+
+    public float distance = 5f;
+    public float fieldOfView = 60f;
+    public Vector3 targetOffset = new Vector3(0f, 1.6f, 0f);
+    [Tooltip("Orbit damping while this profile is active.")]
+    public float smoothTime = 0.15f;
+    [Tooltip("Seconds of horizontal velocity the pivot leads by. Used by the glide profile.")]
+    public float lookAhead;
+    [Tooltip("Seconds to blend in and out.")]
+    public float blendTime = 0.35f;
+
+    [System.NonSerialized] public float weight;
+    [System.NonSerialized] public float weightVelocity;
+
+    public CameraRigSettings Settings => new CameraRigSettings
+    {
+        distance = distance,
+        fieldOfView = fieldOfView,
+        targetOffset = targetOffset,
+        smoothTime = smoothTime,
+        lookAhead = lookAhead
+    };
+
+    public static CameraRigProfile Create(string name, CameraRigState state, int priority, float distance, float fieldOfView,
+                                          float height, float smoothTime = 0.15f, float lookAhead = 0f)
+    {
+        return new CameraRigProfile
+        {
+            name = name, state = state, priority = priority,
+            distance = distance, fieldOfView = fieldOfView, targetOffset = new Vector3(0f, height, 0f),
+            smoothTime = smoothTime, lookAhead = lookAhead
+        };
+    }
+}
@@ -0,0 +1,200 @@
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+
+// Actions that play a timeline of movement events when they start
+public enum MovementAction
+{
+    Jump,
+    AirJump
+}
+
+// What PlayerMovement does when an event fires. The animation events of the same name (Jump, BeginFlip, EndFlip) can sync them.
+public enum MovementEvent
+{
+    JumpImpulse,
+    FlipImpulse,
+    FlipEnd
+}
+
+[Serializable]
+public struct MovementTimedEvent
+{
+    public MovementEvent type;
+    [Tooltip("Seconds after the action starts, on the simulation clock")]
+    public float time;
+    [Tooltip("While the animation is visible, wait for its animation event instead (at most maxSyncDelay past 'time')")]
+    public bool syncToAnimation;
+}
+
+[Serializable]
+public class MovementActionTimeline
+{
+    public MovementAction action;
+    public List<MovementTimedEvent> events = new List<MovementTimedEvent>();
+}
+
+// How far a playing action has got. Part of MovementState, so snapshots and replays restore pending events.
+[Serializable]
+public struct MovementEventPlayback
+{
+    public MovementAction action;
+    public float time;
+    public int nextEvent;
+    public float force; // Impulse force this playback fires with, 0 uses the default one
+}
+
+[CreateAssetMenu(fileName = "MovementEventTimeline", menuName = "Scriptable Objects/MovementEventTimeline")]
+public class MovementEventTimeline : ScriptableObject
+{
+    [Tooltip("How long past its time a synced event waits for its animation event before firing anyway")]
+    public float maxSyncDelay = 0.1f;
+    public List<MovementActionTimeline> actions = new List<MovementActionTimeline>();
+
+    // Default instance if no SO is assigned, timed like the animation events
+    private static MovementEventTimeline defaultTimeline;
+
+    public static MovementEventTimeline GetOrDefault()
+    {
+        if (defaultTimeline == null)
+        {
+            defaultTimeline = CreateInstance<MovementEventTimeline>();
+            defaultTimeline.actions.Add(new MovementActionTimeline
+            {
+                action = MovementAction.Jump,
+                events = { new MovementTimedEvent { type = MovementEvent.JumpImpulse, time = 0.15f, syncToAnimation = true } }
+            });
+            defaultTimeline.actions.Add(new MovementActionTimeline
+            {
+                action = MovementAction.AirJump,
+                events =
+                {
+                    new MovementTimedEvent { type = MovementEvent.FlipImpulse, time = 0.15f, syncToAnimation = true },
+                    new MovementTimedEvent { type = MovementEvent.FlipEnd, time = 0.55f, syncToAnimation = true }
+                }
+            });
+        }
+        return defaultTimeline;
+    }
+}
+
+/* --------------------------------------------------------------------------
+   Fires movement events from the simulation clock.
+
+   • Play starts an action's timeline. Advance, called once per movement tick, fires
+     every event whose time has come, so gameplay doesn't need the animation to run
+     (culled, low LOD, no animator at all).
+   • With sync on, an event marked syncToAnimation waits for its animation event
+     (Notify) instead, but never longer than maxSyncDelay past its time. An animation
+     event that comes early fires it early.
+   • PlayerMovement only syncs in variable step while the mesh is visible. Fixed step
+     never does, so replays stay deterministic.
+   • Each playback carries its impulse force. An animation event that brings its own
+     force sets it, so the impulse uses it whichever of the clock or the animation fires it.
+   • Capture / Restore hold the playing actions for MovementState.
+   -------------------------------------------------------------------------- */
+public class MovementEventPlayer
+{
+    public event Action<MovementEvent, float> Fired; // Event and the force of the playback that fired it
+
+    private readonly Dictionary<MovementAction, MovementTimedEvent[]> _events = new Dictionary<MovementAction, MovementTimedEvent[]>();
+    private readonly List<MovementEventPlayback> _playing = new List<MovementEventPlayback>();
+    private readonly List<(MovementEvent type, float force)> _due = new List<(MovementEvent, float)>();
+    private readonly float _maxSyncDelay;
+
+    public MovementEventPlayer(MovementEventTimeline timeline)
+    {
+        _maxSyncDelay = timeline.maxSyncDelay;
+
+        // Sorted once, so a tick only looks at the next event of each action
+        foreach (MovementActionTimeline actionTimeline in timeline.actions)
+        {
+            var events = actionTimeline.events.ToArray();
+            Array.Sort(events, (a, b) => a.time.CompareTo(b.time));
+            _events[actionTimeline.action] = events;
+        }
+    }
+
+    // Restarts the action's timeline. Actions without one, or with an empty one, do nothing.
+    public void Play(MovementAction action, float force = 0f)
+    {
+        Stop(action);
+        if (_events.TryGetValue(action, out MovementTimedEvent[] events) && events.Length > 0)
+            _playing.Add(new MovementEventPlayback { action = action, force = force });
+    }
+
+    public void Stop(MovementAction action) => _playing.RemoveAll(p => p.action == action);
+
+    public bool IsPlaying(MovementAction action) => _playing.Exists(p => p.action == action);
+
+    public void Advance(float deltaTime, bool syncToAnimation)
+    {
+        _due.Clear();
+
+        for (int i = _playing.Count - 1; i >= 0; i--)
+        {
+            MovementEventPlayback playback = _playing[i];
+            MovementTimedEvent[] events = _events[playback.action];
+            playback.time += deltaTime;
+
+            while (playback.nextEvent < events.Length)
+            {
+                MovementTimedEvent next = events[playback.nextEvent];
+                bool waitingForAnimation = syncToAnimation && next.syncToAnimation && playback.time < next.time + _maxSyncDelay;
+                if (playback.time < next.time || waitingForAnimation)
+                    break;
+
+                _due.Add((next.type, playback.force));
+                playback.nextEvent++;
+            }
+
+            if (playback.nextEvent >= events.Length)
+                _playing.RemoveAt(i);
+            else
+                _playing[i] = playback;
+        }
+
+        // Fired after the bookkeeping, so a handler can Play or Stop
+        foreach ((MovementEvent type, float force) in _due)
+            Fired?.Invoke(type, force);
+    }
+
+    // Animation event: fires the next pending event of this type now, with 'force' when one is given.
+    // False when no synced event is waiting for it.
+    public bool Notify(MovementEvent type, float force = 0f)
+    {
+        for (int i = 0; i < _playing.Count; i++)
+        {
+            MovementEventPlayback playback = _playing[i];
+            MovementTimedEvent[] events = _events[playback.action];
+            if (playback.nextEvent >= events.Length || !events[playback.nextEvent].syncToAnimation || events[playback.nextEvent].type != type)
+                continue;
+
+            if (force > 0f) playback.force = force;
+            playback.nextEvent++;
+            if (playback.nextEvent >= events.Length)
+                _playing.RemoveAt(i);
+            else
+                _playing[i] = playback;
+
+            Fired?.Invoke(type, playback.force);
+            return true;
+        }
+        return false;
+    }
+
+    public MovementEventPlayback[] Capture() => _playing.ToArray();
+
+    public void Restore(MovementEventPlayback[] playing)
+    {
+        _playing.Clear();
+        if (playing == null)
+            return;
+
+        foreach (MovementEventPlayback playback in playing)
+        {
+            if (_events.TryGetValue(playback.action, out MovementTimedEvent[] events) && playback.nextEvent < events.Length)
+                _playing.Add(playback);
+        }
+    }
+}
@@ -0,0 +1,193 @@
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+
+// States of PlayerMovement's state machine. Locomotion, Crouched and Traversal are parents,
+// the rest are the leaves the player is actually in.
+public enum MovementStateId
+{
+    Locomotion,
+    Standing,
+    Crouched,
+    Crouching,
+    Proning,
+    Sliding,
+    Rolling,
+    Gliding,
+    Traversal,
+    OnLedge,
+    LadderClimbing,
+    LadderExiting
+}
+
+// Everything one movement tick reads from the player. In fixed-step mode this is what gets recorded and replayed.
+[Serializable]
+public struct MovementInput
+{
+    public Vector2 move;
+    public Vector3 cameraForward; // Raw camera axes, movement flattens them itself
+    public Vector3 cameraRight;
+
+    // Held buttons
+    public bool run;
+    public bool crouchHeld;
+    public bool glideHeld;
+
+    // Pressed this tick
+    public bool jumpPressed;
+    public bool crouchPressed;
+    public bool pronePressed;
+    public bool rollPressed;
+    public bool dancePressed;
+    public bool climbPressed;
+
+    // Merges a newer frame of input into this one: held values and camera take the latest frame,
+    // presses stay set until a tick consumes them, so a press in a frame without a tick isn't lost
+    public void Accumulate(in MovementInput frame)
+    {
+        move = frame.move;
+        cameraForward = frame.cameraForward;
+        cameraRight = frame.cameraRight;
+        run = frame.run;
+        crouchHeld = frame.crouchHeld;
+        glideHeld = frame.glideHeld;
+
+        jumpPressed |= frame.jumpPressed;
+        crouchPressed |= frame.crouchPressed;
+        pronePressed |= frame.pronePressed;
+        rollPressed |= frame.rollPressed;
+        dancePressed |= frame.dancePressed;
+        climbPressed |= frame.climbPressed;
+    }
+
+    public void ClearPresses()
+    {
+        jumpPressed = crouchPressed = pronePressed = rollPressed = dancePressed = climbPressed = false;
+    }
+}
+
+// The part of PlayerMovement that changes from tick to tick. Capturing and restoring it (plus the
+// transform) puts the player back exactly where a recorded trace started.
+[Serializable]
+public struct MovementState
+{
+    public Vector3 position;
+    public Quaternion rotation;
+    public float controllerHeight;
+    public float controllerCenterY;
+
+    public Vector3 velocity;
+    public Vector3 slideVelocity;
+    public Vector3 rollDirection;
+    public float rollSpeed;
+    public float rollTimer;
+    public float fallTimer;
+    public float slideFallTimer;
+    public float jumpInputTimer;
+    public int jumpCount;
+
+    public MovementStateId state;
+    public bool jumpInputQueued;
+    public bool jumpPending;
+    public bool isFalling;
+    public bool isJumping;
+    public bool isFlipping;
+    public bool isDancing;
+
+    public MovementEventPlayback[] events; // Jump / flip timelines still playing
+}
+
+// A recorded run: the state it started from, one input per tick, and where it ended
+[Serializable]
+public class MovementTrace
+{
+    public int tickRate;
+    public MovementState start;
+    public List<MovementInput> inputs = new List<MovementInput>();
+    public Vector3 endPosition;
+
+    // The frame of live input a player following this trace would have given between previousTime and time
+    // (seconds from the start): held values and camera of the latest tick, presses of every tick in between.
+    // Feeding it through the fixed-step clock plays the trace back as if it was performed at another frame rate.
+    public MovementInput SampleFrame(double previousTime, double time)
+    {
+        if (inputs.Count == 0) return default;
+
+        int first = (int)Math.Ceiling(previousTime * tickRate);
+        int last = Mathf.Clamp((int)Math.Ceiling(time * tickRate) - 1, 0, inputs.Count - 1);
+
+        MovementInput frame = inputs[last];
+        frame.ClearPresses();
+        for (int i = Mathf.Max(first, 0); i <= last; i++)
+            frame.Accumulate(inputs[i]);
+        return frame;
+    }
+
+    public int CountPresses()
+    {
+        int count = 0;
+        foreach (MovementInput input in inputs)
+        {
+            if (input.jumpPressed) count++;
+            if (input.crouchPressed) count++;
+            if (input.pronePressed) count++;
+            if (input.rollPressed) count++;
+            if (input.dancePressed) count++;
+            if (input.climbPressed) count++;
+        }
+        return count;
+    }
+}
+
+/* --------------------------------------------------------------------------
+   Fixed-step accumulator.
+
+   • Frame time is added up and spent in whole steps, so the simulation always
+     advances by the same dt whatever the frame rate.
+   • The time left over is the fraction of a step the frame sits between the last two
+     ticks (Alpha), used to interpolate what is rendered.
+   • A frame never runs more than maxStepsPerFrame ticks. After a long hitch the rest
+     is dropped instead of trying to catch up.
+   -------------------------------------------------------------------------- */
+public class FixedStepClock
+{
+    public float Step { get; }
+    public int MaxStepsPerFrame { get; }
+    public long Ticks { get; private set; }
+
+    private double _accumulator; // Double, so a long session doesn't lose precision
+
+    public float Alpha => (float)(_accumulator / Step);
+
+    public FixedStepClock(int tickRate, int maxStepsPerFrame)
+    {
+        Step = 1f / Mathf.Max(1, tickRate);
+        MaxStepsPerFrame = Mathf.Max(1, maxStepsPerFrame);
+    }
+
+    // Returns how many ticks to run this frame
+    public int Advance(float deltaTime)
+    {
+        _accumulator += deltaTime;
+
+        int steps = (int)(_accumulator / Step);
+        if (steps > MaxStepsPerFrame)
+        {
+            steps = MaxStepsPerFrame;
+            _accumulator = 0;
+        }
+        else
+        {
+            _accumulator -= steps * (double)Step;
+        }
+
+        Ticks += steps;
+        return steps;
+    }
+
+    public void Reset()
+    {
+        _accumulator = 0;
+        Ticks = 0;
+    }
+}
@@ -0,0 +1,79 @@
+// What the movement state table needs from its owner: the guards on its transitions and the hooks its states run.
+public interface IMovementStateHooks
+{
+    bool IsGrounded();
+    bool CanStartSlide();
+    bool CanStartGlide();
+    bool CanGrabLedge();
+    bool CanGrabLadder();
+    bool CanStandUp();
+    bool CanCrouchUp();
+
+    void OnEnter(MovementStateId state, MovementStateId from); // from: the leaf being left
+    void OnExit(MovementStateId state, MovementStateId to);    // to: the leaf being entered
+    void OnTick(MovementStateId state, float deltaTime);
+}
+
+/* --------------------------------------------------------------------------
+   Movement state table.
+
+   • Locomotion  : Standing, Crouched (Crouching, Proning), Sliding, Rolling, Gliding
+   • Traversal   : OnLedge, LadderClimbing, LadderExiting
+   • Every state forwards its enter and exit to the hooks. Only Locomotion, Rolling and the
+     traversal leaves tick; the other leaves run Locomotion's tick from their parent.
+   • Guards come from IMovementStateHooks, so the table can be built and driven without
+     a scene (see Tests/Editor/MovementStateTableTests).
+   -------------------------------------------------------------------------- */
+public static class MovementStateTable
+{
+    public static StateMachine<MovementStateId> Build(IMovementStateHooks hooks, int historyLength = 32)
+    {
+        var machine = new StateMachine<MovementStateId>(historyLength);
+
+        void Add(MovementStateId state, MovementStateId? parent = null, bool ticks = false)
+        {
+            machine.AddState(state, parent,
+                enter: from => hooks.OnEnter(state, from),
+                exit: to => hooks.OnExit(state, to),
+                tick: ticks ? dt => hooks.OnTick(state, dt) : null);
+        }
+
+        Add(MovementStateId.Locomotion, ticks: true);
+        Add(MovementStateId.Standing, MovementStateId.Locomotion);
+        Add(MovementStateId.Crouched, MovementStateId.Locomotion);
+        Add(MovementStateId.Crouching, MovementStateId.Crouched);
+        Add(MovementStateId.Proning, MovementStateId.Crouched);
+        Add(MovementStateId.Sliding, MovementStateId.Locomotion);
+        Add(MovementStateId.Rolling, MovementStateId.Locomotion, ticks: true);
+        Add(MovementStateId.Gliding, MovementStateId.Locomotion);
+        Add(MovementStateId.Traversal);
+        Add(MovementStateId.OnLedge, MovementStateId.Traversal, ticks: true);
+        Add(MovementStateId.LadderClimbing, MovementStateId.Traversal, ticks: true);
+        Add(MovementStateId.LadderExiting, MovementStateId.Traversal, ticks: true);
+
+        // Every transition the player can make. Anything not listed here can't happen.
+        machine
+            .AddTransition(MovementStateId.Standing, MovementStateId.Crouching, hooks.IsGrounded)
+            .AddTransition(MovementStateId.Standing, MovementStateId.Sliding, hooks.CanStartSlide)
+            .AddTransition(MovementStateId.Standing, MovementStateId.Rolling, hooks.IsGrounded)
+            .AddTransition(MovementStateId.Standing, MovementStateId.Gliding, hooks.CanStartGlide)
+            .AddTransition(MovementStateId.Standing, MovementStateId.OnLedge, hooks.CanGrabLedge)
+            .AddTransition(MovementStateId.Standing, MovementStateId.LadderClimbing, hooks.CanGrabLadder)
+            .AddTransition(MovementStateId.Crouching, MovementStateId.Standing, hooks.CanStandUp)
+            .AddTransition(MovementStateId.Crouching, MovementStateId.Proning)
+            .AddTransition(MovementStateId.Proning, MovementStateId.Crouching, hooks.CanCrouchUp)
+            .AddTransition(MovementStateId.Proning, MovementStateId.Standing, () => hooks.CanCrouchUp() && hooks.CanStandUp())
+            .AddTransition(MovementStateId.Sliding, MovementStateId.Standing, () => hooks.CanCrouchUp() && hooks.CanStandUp())
+            .AddTransition(MovementStateId.Sliding, MovementStateId.Crouching, hooks.CanCrouchUp)
+            .AddTransition(MovementStateId.Sliding, MovementStateId.Proning)
+            .AddTransition(MovementStateId.Rolling, MovementStateId.Standing, hooks.CanStandUp)
+            .AddTransition(MovementStateId.Rolling, MovementStateId.Crouching)
+            .AddTransition(MovementStateId.Gliding, MovementStateId.Standing)
+            .AddTransition(MovementStateId.OnLedge, MovementStateId.Standing)
+            .AddTransition(MovementStateId.LadderClimbing, MovementStateId.Standing)
+            .AddTransition(MovementStateId.LadderClimbing, MovementStateId.LadderExiting)
+            .AddTransition(MovementStateId.LadderExiting, MovementStateId.Standing);
+
+        return machine;
+    }
+}
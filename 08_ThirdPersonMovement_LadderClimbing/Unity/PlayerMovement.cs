@@ -1,8 +1,10 @@
 using System.Collections;
+using System.Collections.Generic;
+using System.IO;
 using UnityEngine;
 
 [RequireComponent(typeof(CharacterController))]
-public class PlayerMovement : MonoBehaviour
+public class PlayerMovement : MonoBehaviour, IMovementStateHooks
 {
     public Transform playerMesh;
     private ThirdPersonCamera thirdPersonCamera;
@@ -29,7 +31,9 @@ public class PlayerMovement : MonoBehaviour
     private float _jumpInputTimer;
     private bool _jumpPending;
     private int _jumpCount;
+    private bool _isJumping;
     private bool _isFlipping;
+    private bool _isDancing;
 
     [Header("Crouch Settings")]
     [SerializeField] private float ceilingCheckOffset = 0.15f;
@@ -39,19 +43,16 @@ public class PlayerMovement : MonoBehaviour
     [SerializeField] private float standCenterY = 0.9f;
     [SerializeField] private float crouchSpeed = 1.67f;
     [SerializeField] private float crouchBackwardsSpeed = 1.5f;
-    private bool _isCrouching;
 
     [Header("Prone Settings")]
     [SerializeField] private float proneHeight = 0.4f;
     [SerializeField] private float proneCenterY = 0.2f;
     [SerializeField] private float proneSpeed = 1.25f;
     [SerializeField] private float proneBackwardsSpeed = 1.0f;
-    private bool _isProning;
 
     [Header("Slide Settings")]
     [SerializeField] private float slideHeight = 0.2f;
     [SerializeField] private float slideCenterY = 0.4f;
-    private bool _isSliding;
     [SerializeField] private float slideFallGraceTime = 1f;
     [SerializeField] private float slideSlopeBoost = 15f;
     [SerializeField] private float slideFriction = 1f;
@@ -66,7 +67,6 @@ public class PlayerMovement : MonoBehaviour
     [SerializeField] private float rollGravityDivider = 3f;
     private float rollSpeed = 7f;
     [SerializeField] private float rollDuration = 0.8f;
-    private bool _isRolling;
     private float _rollTimer;
     private Vector3 _rollDirection;
 
@@ -75,7 +75,6 @@ public class PlayerMovement : MonoBehaviour
     [SerializeField] private float ledgeSpeed = 2f;
     [SerializeField] private float ledgeWallOffset = 0.3f;
     private bool _lastIdleLeft;
-    private bool _isOnLedge;
     private bool _ledgeExitCooldown = false;
     private Transform _currentLedge;
     private Vector3 _ledgeForward;
@@ -89,19 +88,61 @@ public class PlayerMovement : MonoBehaviour
     [SerializeField] private float minGlideActivationHeight = 5f;
     [SerializeField] private float glideFallVelocityThreshold = -2f;
     [SerializeField] private GameObject glider;
-    private bool _isGliding;
 
     [Header("Ladder Climbing Settings")]
     [SerializeField] private float ladderClimbSpeed = 2.5f;
     [SerializeField] private float ladderOffset = 0.3f;
     [SerializeField] private float ladderRotationOffset = 180f;
     [SerializeField] private float climbAnimationTime = 1.0f;
-    private bool _isLadderClimbing;
-    private bool _isExitingLadder;
     private Transform _currentLadder;
     private Vector3 _ladderFaceDir;
     private Transform _ladderCandidate;
     private bool _isAtTopOfLadder;
+    private const float LadderTopExitThreshold = 0.25f;
+
+    [Header("Traversal Settings")]
+    [Tooltip("Grabs ledges and ladders the traversal registry finds just ahead of the player, without waiting for their trigger")]
+    [SerializeField] private bool predictiveTraversal = true;
+    [Tooltip("Seconds of the current motion to look ahead for ledges and ladders")]
+    [SerializeField] private float traversalLookAhead = 0.2f;
+    [Tooltip("Distance to a ledge (or to a ladder's front, past ladderOffset) that grabs it")]
+    [SerializeField] private float traversalGrabDistance = 0.35f;
+    private TraversalRegistry _traversal;
+    private TraversalFeature _currentLadderFeature;
+    private TraversalFeature _currentLedgeFeature;
+    private Vector3 _lastTickPosition;
+    private Vector3 _tickMotion; // How far the last tick moved the player
+
+    [Header("Simulation Settings")]
+    [Tooltip("Runs movement at a fixed tick rate, so jump heights and slide distances don't depend on the frame rate. The mesh is interpolated between ticks.")]
+    [SerializeField] private bool useFixedStep = false;
+    [SerializeField] private int fixedTickRate = 60;
+    [SerializeField] private int maxStepsPerFrame = 8;
+    [Tooltip("When jump and flip impulses fire, on the simulation clock. Uses the default timings when empty.")]
+    [SerializeField] private MovementEventTimeline eventTimeline;
+    [Tooltip("Variable step only: while the mesh is visible, timeline events wait for their animation events")]
+    [SerializeField] private bool syncEventsToAnimation = true;
+    private FixedStepClock _clock;
+    private MovementInput _input;         // Input of the tick being simulated
+    private MovementInput _pendingInput;  // Fixed step: frames collected since the last tick
+    private float _dt;                    // Time step of the tick being simulated
+    private MovementEventPlayer _events;
+    private float _animationJumpForce; // Last force passed by the Jump(float) animation event, 0 when the clip uses the default
+    private Renderer _meshRenderer;
+    private Vector3 _previousPosition;
+    private Quaternion _previousRotation;
+    private Vector3 _meshLocalPosition;
+    private Quaternion _meshLocalRotation;
+    private MovementTrace _recording;
+    private MovementTrace _lastTrace;
+    private MovementTrace _replay;
+    private int _replayTick;
+    private bool _replayIsLive;
+
+    [Header("State Machine Settings")]
+    [Tooltip("Transitions kept for Log State History. Each transition is also logged with its reason at Movement Verbose")]
+    [SerializeField] private int stateHistoryLength = 32;
+    private StateMachine<MovementStateId> _states;
 
     #if UNITY_EDITOR
     [Header("Unity Editor Settings")]
@@ -113,59 +154,521 @@ public class PlayerMovement : MonoBehaviour
     private Animator _animator;
     private Transform _mainCamera;
 
+    // Read-only movement state, used by ThirdPersonCamera to pick its framing profile
+    public MovementStateId State => _states.Current;
+    public bool IsCrouching => Is(MovementStateId.Crouched); // Also true while prone
+    public bool IsProning => Is(MovementStateId.Proning);
+    public bool IsSliding => Is(MovementStateId.Sliding);
+    public bool IsRolling => Is(MovementStateId.Rolling);
+    public bool IsGliding => Is(MovementStateId.Gliding);
+    public bool IsOnLedge => Is(MovementStateId.OnLedge);
+    public bool IsLadderClimbing => Is(MovementStateId.LadderClimbing) || Is(MovementStateId.LadderExiting);
+    public Vector3 Velocity => _controller != null ? _controller.velocity : Vector3.zero;
+
+    // The camera follows the interpolated mesh in fixed-step mode, the transform only moves once per tick
+    private Transform CameraTarget => useFixedStep && playerMesh != null ? playerMesh : transform;
+
+    private void Awake()
+    {
+        _states = MovementStateTable.Build(this, stateHistoryLength);
+        _states.Changed += OnStateChanged;
+        _states.Start(MovementStateId.Standing);
+
+        _events = new MovementEventPlayer(eventTimeline != null ? eventTimeline : MovementEventTimeline.GetOrDefault());
+        _events.Fired += OnMovementEvent;
+    }
+
     private void Start()
     {
         _controller = GetComponent<CharacterController>();
         _animator = GetComponentInChildren<Animator>();
+        _meshRenderer = GetComponentInChildren<SkinnedMeshRenderer>();
         _mainCamera = Camera.main.transform;
         thirdPersonCamera = Camera.main.GetComponent<ThirdPersonCamera>();
+        _traversal = TraversalRegistry.GetOrCreate();
+
+        _clock = new FixedStepClock(fixedTickRate, maxStepsPerFrame);
+        _previousPosition = transform.position;
+        _previousRotation = transform.rotation;
+        _lastTickPosition = transform.position;
+        if (playerMesh != null)
+        {
+            _meshLocalPosition = playerMesh.localPosition;
+            _meshLocalRotation = playerMesh.localRotation;
+        }
+
+        if (thirdPersonCamera != null && thirdPersonCamera.target == transform)
+            thirdPersonCamera.ChangeTarget(CameraTarget);
     }
 
     private void Update()
     {
-        if (_isOnLedge)
+        if (!useFixedStep)
         {
-            HandleLedgeMovement();
+            _input = ReadInput();
+            _dt = Time.deltaTime;
+            Simulate();
             return;
         }
 
-        // If exiting ladder, freeze and wait for animation
-        if (_isExitingLadder)
+        _pendingInput.Accumulate(ReadInput());
+        AdvanceFixedStep(Time.deltaTime);
+    }
+
+    private MovementInput ReadInput()
+    {
+        InputManager input = InputManager.Instance;
+        return new MovementInput
         {
+            move = input.MoveInput,
+            cameraForward = _mainCamera.forward,
+            cameraRight = _mainCamera.right,
+            run = input.IsRunning,
+            crouchHeld = input.CrouchButtonPressed,
+            glideHeld = input.IsGliding,
+            jumpPressed = input.IsJumping,
+            crouchPressed = input.IsCrouching,
+            pronePressed = input.IsProning,
+            rollPressed = input.IsRolling,
+            dancePressed = input.IsDancing,
+            climbPressed = input.IsClimbing
+        };
+    }
+
+    // One movement tick: reads _input, advances by _dt. The current state picks what runs (see MovementStateTable).
+    private void Simulate()
+    {
+        _tickMotion = transform.position - _lastTickPosition;
+        _states.Tick(_dt);
+        _events.Advance(_dt, SyncingEventsToAnimation);
+        _lastTickPosition = transform.position;
+    }
+
+    private void TickLocomotion()
+    {
+        // Press to start climbing ladder
+        Transform ladder = _ladderCandidate != null ? _ladderCandidate : PredictTraversal(TraversalKind.Ladder, ladderOffset + traversalGrabDistance);
+        if (ladder != null && _input.climbPressed)
+        {
+            TryStartLadderClimb(ladder);
             return;
         }
 
-        if (_isLadderClimbing)
+        // Grab a ledge coming up ahead
+        if (!_ledgeExitCooldown && Is(MovementStateId.Standing))
         {
-            HandleLadderClimbing();
-            return;
+            Transform ledge = PredictTraversal(TraversalKind.Ledge, traversalGrabDistance);
+            if (ledge != null)
+            {
+                EnterLedge(ledge);
+                if (IsOnLedge) return;
+            }
         }
 
-        // Press to start climbing ladder
-        if (_ladderCandidate != null && InputManager.Instance.IsClimbing && !_isLadderClimbing)
+        QueueJumpInput();
+        HandleMovement();
+        UpdateFalling();
+        HandleGliding();
+
+        if (_input.rollPressed)
         {
-            TryStartLadderClimb(_ladderCandidate);
-            return;
+            StartRoll();
         }
+    }
 
+    private void TickRolling()
+    {
         QueueJumpInput();
+        UpdateRoll();
+    }
+
+    // Ledge or ladder within grabDistance of where the player is heading over the next traversalLookAhead seconds
+    private Transform PredictTraversal(TraversalKind kind, float grabDistance)
+    {
+        if (!predictiveTraversal || _traversal == null || _dt <= 0f)
+            return null;
+
+        Vector3 window = _tickMotion * (traversalLookAhead / _dt);
+        return _traversal.FindNearest(kind, transform.position, window, grabDistance, out TraversalFeature feature, out _) ? feature.root : null;
+    }
+
+    #region Fixed Step
+
+    private void AdvanceFixedStep(float deltaTime)
+    {
+        int steps = _clock.Advance(deltaTime);
+        for (int i = 0; i < steps; i++)
+            FixedTick();
+
+        InterpolateMesh(_clock.Alpha);
+    }
+
+    private void FixedTick()
+    {
+        // Live presses are consumed even while replaying, so they don't fire once the replay ends
+        MovementInput live = _pendingInput;
+        _pendingInput.ClearPresses();
+        _input = _replay != null ? _replay.inputs[_replayTick++] : live;
+
+        _recording?.inputs.Add(_input);
+
+        _previousPosition = transform.position;
+        _previousRotation = transform.rotation;
+        _dt = _clock.Step;
+
+        Simulate();
+
+        if (_replay != null && _replayTick >= _replay.inputs.Count)
+            EndReplay();
+    }
+
+    // One tick on input right now, outside the frame's clock. Tests drive the simulation through this.
+    public void SimulateTick(MovementInput input, float deltaTime)
+    {
+        _input = input;
+        _dt = deltaTime;
+        Simulate();
+    }
+
+    // Places the mesh between the last two ticks. The transform itself stays on the tick position.
+    private void InterpolateMesh(float alpha)
+    {
+        if (playerMesh == null) return;
+
+        Vector3 position = Vector3.Lerp(_previousPosition, transform.position, alpha);
+        Quaternion rotation = Quaternion.Slerp(_previousRotation, transform.rotation, alpha);
+        playerMesh.SetPositionAndRotation(position + rotation * _meshLocalPosition, rotation * _meshLocalRotation);
+    }
+
+    // After a teleport, so the mesh doesn't slide across it
+    private void SnapInterpolation()
+    {
+        _previousPosition = transform.position;
+        _previousRotation = transform.rotation;
+        _lastTickPosition = transform.position;
+        _tickMotion = Vector3.zero;
+    }
 
-        if (_isRolling)
+    public MovementState CaptureMovementState()
+    {
+        return new MovementState
         {
-            UpdateRoll();
+            position = transform.position,
+            rotation = transform.rotation,
+            controllerHeight = _controller.height,
+            controllerCenterY = _controller.center.y,
+            velocity = _velocity,
+            slideVelocity = _slideVelocity,
+            rollDirection = _rollDirection,
+            rollSpeed = rollSpeed,
+            rollTimer = _rollTimer,
+            fallTimer = _fallTimer,
+            slideFallTimer = _slideFallTimer,
+            jumpInputTimer = _jumpInputTimer,
+            jumpCount = _jumpCount,
+            state = _states.Current,
+            jumpInputQueued = _jumpInputQueued,
+            jumpPending = _jumpPending,
+            isFalling = _isFalling,
+            isJumping = _isJumping,
+            isFlipping = _isFlipping,
+            isDancing = _isDancing,
+            events = _events.Capture()
+        };
+    }
+
+    public void RestoreMovementState(MovementState state)
+    {
+        // Same teleport as the ladder exit: the controller would otherwise sweep to the new position
+        _controller.enabled = false;
+        transform.SetPositionAndRotation(state.position, state.rotation);
+        _controller.height = state.controllerHeight;
+        _controller.center = new Vector3(0f, state.controllerCenterY, 0f);
+        _controller.enabled = true;
+
+        _velocity = state.velocity;
+        _slideVelocity = state.slideVelocity;
+        _rollDirection = state.rollDirection;
+        rollSpeed = state.rollSpeed;
+        _rollTimer = state.rollTimer;
+        _fallTimer = state.fallTimer;
+        _slideFallTimer = state.slideFallTimer;
+        _jumpInputTimer = state.jumpInputTimer;
+        _jumpCount = state.jumpCount;
+        _jumpInputQueued = state.jumpInputQueued;
+        _jumpPending = state.jumpPending;
+        _isFalling = state.isFalling;
+        _isJumping = state.isJumping;
+        _isFlipping = state.isFlipping;
+        _isDancing = state.isDancing;
+        _events.Restore(state.events);
+
+        // The capsule comes from the snapshot, so the state is placed without running its hooks
+        _states.Reset(state.state, "restored");
+
+        if (glider != null) glider.SetActive(IsGliding);
+        _animator.SetBool("IsFalling", _isFalling);
+        _animator.SetBool("IsJumping", _isJumping);
+        _animator.SetBool("IsFlipping", _isFlipping);
+        _animator.SetBool("IsDancing", _isDancing);
+        _animator.SetBool("IsCrouching", IsCrouching);
+        _animator.SetBool("IsProning", IsProning);
+        _animator.SetBool("IsSliding", IsSliding);
+        _animator.SetBool("IsRolling", IsRolling);
+        _animator.SetBool("IsGliding", IsGliding);
+
+        _pendingInput = default;
+        SnapInterpolation();
+    }
+
+    /* ----- Input Traces ----- */
+
+    // Records one input per tick from here on. Fixed step only: a trace is only replayable at a fixed dt.
+    [ContextMenu("Start Input Recording")]
+    public void StartInputRecording()
+    {
+        if (!Application.isPlaying || !useFixedStep)
+        {
+            Diag.Warning(DiagCategory.Movement, this, "[PlayerMovement] Input recording needs Play Mode with Use Fixed Step enabled.");
             return;
         }
 
-        HandleMovement();
-        UpdateFalling();
-        HandleGliding();
+        _recording = new MovementTrace { tickRate = fixedTickRate, start = CaptureMovementState() };
+    }
 
-        if (InputManager.Instance.IsRolling && !_isRolling)
+    // Stops recording and writes the trace to persistentDataPath/MovementTraces
+    [ContextMenu("Stop Input Recording")]
+    public void StopInputRecording()
+    {
+        if (_recording == null) return;
+
+        _recording.endPosition = transform.position;
+        _lastTrace = _recording;
+        _recording = null;
+
+        string folder = Path.Combine(Application.persistentDataPath, "MovementTraces");
+        Directory.CreateDirectory(folder);
+        string path = Path.Combine(folder, $"MovementTrace_{System.DateTime.Now:yyyyMMdd_HHmmss}.json");
+        File.WriteAllText(path, JsonUtility.ToJson(_lastTrace));
+
+        Diag.Log(DiagCategory.Movement, this, "[PlayerMovement] Recorded {0} ticks to {1}", _lastTrace.inputs.Count, path);
+    }
+
+    // Replays the last recording in real time, from its start state
+    [ContextMenu("Replay Last Recording")]
+    public void ReplayLastRecording()
+    {
+        if (_lastTrace == null || !useFixedStep) return;
+        StartReplay(_lastTrace, true);
+    }
+
+    private void StartReplay(MovementTrace trace, bool live)
+    {
+        _clock = new FixedStepClock(trace.tickRate, maxStepsPerFrame);
+        RestoreMovementState(trace.start);
+        _replay = trace.inputs.Count > 0 ? trace : null;
+        _replayTick = 0;
+        _replayIsLive = live;
+    }
+
+    private void EndReplay()
+    {
+        if (_replayIsLive)
         {
-            StartRoll();
+            if (SameBits(transform.position, _replay.endPosition))
+                Diag.Log(DiagCategory.Movement, this, "[PlayerMovement] Replay ended at {0:F4}, recorded {1:F4}. Identical.", transform.position, _replay.endPosition);
+            else
+                Diag.Warning(DiagCategory.Movement, this, "[PlayerMovement] Replay ended at {0:F4}, recorded {1:F4}. Different.", transform.position, _replay.endPosition);
+        }
+
+        _replay = null;
+        _clock = new FixedStepClock(fixedTickRate, maxStepsPerFrame);
+    }
+
+    // Runs every tick of the trace right now, from its start state, and returns where it ended.
+    // Tests check replays through this.
+    public Vector3 ReplayTrace(MovementTrace trace)
+    {
+        StartReplay(trace, false);
+        while (_replay != null)
+            FixedTick();
+        return transform.position;
+    }
+
+    // Performs the trace as live input at frameRate within this frame, through the same latching and clock as Update,
+    // and returns what the ticks actually consumed. Tests check frame rate independence through this.
+    public MovementTrace PerformTrace(MovementTrace trace, int frameRate)
+    {
+        RestoreMovementState(trace.start);
+        _clock = new FixedStepClock(trace.tickRate, maxStepsPerFrame);
+        _recording = new MovementTrace { tickRate = trace.tickRate, start = trace.start };
+
+        double frameTime = 1.0 / frameRate;
+        double time = 0.0;
+        while (_recording.inputs.Count < trace.inputs.Count)
+        {
+            double previousTime = time;
+            time += frameTime;
+            _pendingInput.Accumulate(trace.SampleFrame(previousTime, time));
+
+            int steps = _clock.Advance((float)frameTime);
+            for (int step = 0; step < steps && _recording.inputs.Count < trace.inputs.Count; step++)
+                FixedTick();
         }
+
+        MovementTrace performed = _recording;
+        _recording = null;
+        performed.endPosition = transform.position;
+        _clock = new FixedStepClock(fixedTickRate, maxStepsPerFrame);
+        return performed;
+    }
+
+    private static bool SameBits(Vector3 a, Vector3 b)
+    {
+        // Vector3 == compares within 1e-5, replays have to match exactly
+        return a.x.Equals(b.x) && a.y.Equals(b.y) && a.z.Equals(b.z);
     }
 
+    #endregion
+
+    #region State Machine
+
+    private bool Is(MovementStateId state) => _states.IsIn(state);
+
+    /* --------------------------------------------------------------------------
+       Hooks of the movement state table (see MovementStateTable).
+
+       • Enter / exit hooks own the animator flags of their state. The capsule comes from
+         CapsuleFor whenever a transition lands in a new leaf.
+       • Tick hooks replace the old priority chain in Update.
+       • Falling, jumping and flipping stay separate flags: they overlap the states above
+         (an airborne slide, a crouch that lasts until the fall starts).
+       -------------------------------------------------------------------------- */
+    bool IMovementStateHooks.IsGrounded() => IsGrounded();
+    bool IMovementStateHooks.CanStartSlide() => IsGrounded() || _velocity.y < 0f;
+    bool IMovementStateHooks.CanStartGlide() => CanStartGlide();
+    bool IMovementStateHooks.CanGrabLedge() => !_isFlipping && !_isFalling && !_isJumping;
+    bool IMovementStateHooks.CanGrabLadder() => !_isFlipping;
+    bool IMovementStateHooks.CanStandUp() => CanStandUp();
+    bool IMovementStateHooks.CanCrouchUp() => CanCrouchUp();
+
+    void IMovementStateHooks.OnEnter(MovementStateId state, MovementStateId from)
+    {
+        switch (state)
+        {
+            case MovementStateId.Standing:
+                _animator.ResetTrigger("CrouchTrigger");
+                break;
+            case MovementStateId.Crouched:
+                _animator.SetBool("IsCrouching", true);
+                break;
+            case MovementStateId.Crouching:
+                // Getting up from prone plays the prone transition backwards, a roll ends in a crouch without one
+                if (from == MovementStateId.Proning) _animator.SetTrigger("ProneTrigger");
+                else if (from != MovementStateId.Rolling) _animator.SetTrigger("CrouchTrigger");
+                break;
+            case MovementStateId.Proning:
+                _animator.SetBool("IsProning", true);
+                _animator.SetTrigger("ProneTrigger");
+                break;
+            case MovementStateId.Sliding:
+                _animator.SetBool("IsSliding", true);
+                _animator.ResetTrigger("Slide_Trigger");
+                _animator.SetTrigger("Slide_Trigger");
+                _slideFallTimer = 0f;
+                break;
+            case MovementStateId.Rolling:
+                _animator.SetBool("IsRolling", true);
+                break;
+            case MovementStateId.Gliding:
+                if (glider != null) glider.SetActive(true);
+                _animator.SetBool("IsGliding", true);
+                _animator.SetBool("IsFalling", false);
+                break;
+        }
+    }
+
+    void IMovementStateHooks.OnExit(MovementStateId state, MovementStateId to)
+    {
+        switch (state)
+        {
+            case MovementStateId.Crouched:
+                _animator.SetBool("IsCrouching", false);
+                break;
+            case MovementStateId.Proning:
+                _animator.SetBool("IsProning", false);
+                break;
+            case MovementStateId.Sliding:
+                _animator.SetBool("IsSliding", false);
+                _animator.ResetTrigger("Slide_Trigger");
+                break;
+            case MovementStateId.Rolling:
+                _animator.SetBool("IsRolling", false);
+                if (!IsGrounded()) _animator.SetBool("IsFalling", true);
+                break;
+            case MovementStateId.Gliding:
+                if (glider != null) glider.SetActive(false);
+                _animator.SetBool("IsGliding", false);
+                if (!IsGrounded()) _animator.SetBool("IsFalling", true);
+                break;
+        }
+    }
+
+    void IMovementStateHooks.OnTick(MovementStateId state, float deltaTime)
+    {
+        switch (state)
+        {
+            case MovementStateId.Locomotion: TickLocomotion(); break;
+            case MovementStateId.Rolling: TickRolling(); break;
+            case MovementStateId.OnLedge: HandleLedgeMovement(); break;
+            case MovementStateId.LadderClimbing: HandleLadderClimbing(); break;
+            case MovementStateId.LadderExiting: break; // Frozen until the exit animation completes
+        }
+    }
+
+    // Capsule of each posture. Gliding and traversal keep the standing capsule they start from.
+    private (float height, float centerY)? CapsuleFor(MovementStateId state) => state switch
+    {
+        MovementStateId.Standing => (standHeight, standCenterY),
+        MovementStateId.Crouching => (crouchHeight, crouchCenterY),
+        MovementStateId.Rolling => (crouchHeight, crouchCenterY),
+        MovementStateId.Proning => (proneHeight, proneCenterY),
+        MovementStateId.Sliding => (slideHeight, slideCenterY),
+        _ => null
+    };
+
+    private void OnStateChanged(StateMachine<MovementStateId>.Transition transition)
+    {
+        if (CapsuleFor(transition.to) is (float height, float centerY))
+        {
+            _controller.height = height;
+            _controller.center = new Vector3(0f, centerY, 0f);
+        }
+
+        Diag.Verbose(DiagCategory.Movement, this, "[PlayerMovement] {0} -> {1} ({2})", transition.from, transition.to, transition.reason);
+    }
+
+    private bool CanStartGlide()
+    {
+        return !IsGrounded()
+               && _velocity.y < glideFallVelocityThreshold
+               && !_isFlipping
+               && !Physics.Raycast(transform.position, Vector3.down, minGlideActivationHeight);
+    }
+
+    [ContextMenu("Log State History")]
+    private void LogStateHistory()
+    {
+        if (_states == null || !Diag.IsEnabled(DiagCategory.Movement, DiagVerbosity.Log)) return;
+
+        var log = new System.Text.StringBuilder($"[PlayerMovement] In {_states.Current}, last transitions:\n");
+        foreach (StateMachine<MovementStateId>.Transition transition in _states.History)
+            log.AppendLine($"  tick {transition.tick}: {transition.from} -> {transition.to} ({transition.reason})");
+        Diag.Log(DiagCategory.Movement, this, log.ToString());
+    }
+
+    #endregion
+
     private bool IsGrounded()
     {
         return (_controller.collisionFlags & CollisionFlags.Below) != 0
@@ -174,7 +677,7 @@ public class PlayerMovement : MonoBehaviour
 
     private void QueueJumpInput()
     {
-        if (InputManager.Instance.IsJumping)
+        if (_input.jumpPressed)
         {
             _jumpInputQueued = true;
             _jumpInputTimer = jumpInputBufferTime;
@@ -182,7 +685,7 @@ public class PlayerMovement : MonoBehaviour
 
         if (_jumpInputQueued)
         {
-            _jumpInputTimer -= Time.deltaTime;
+            _jumpInputTimer -= _dt;
             if (_jumpInputTimer <= 0f)
             {
                 _jumpInputQueued = false;
@@ -194,16 +697,15 @@ public class PlayerMovement : MonoBehaviour
 
     private void TryStartLadderClimb(Transform ladderRoot)
     {
-        if (!InputManager.Instance.IsClimbing) return;
-        if (_isRolling || _isSliding || _isCrouching || _isProning || _isFlipping)
+        if (!_input.climbPressed) return;
+        if (!_states.TryTransition(MovementStateId.LadderClimbing, "climb pressed"))
             return;
 
-        _isLadderClimbing = true;
         _currentLadder = ladderRoot;
+        _currentLadderFeature = _traversal.Get(ladderRoot, TraversalKind.Ladder);
         _isAtTopOfLadder = false;
 
-        Collider ladderCollider = ladderRoot.GetComponent<Collider>();
-        Vector3 ladderCenter = ladderCollider != null ? ladderCollider.bounds.center : ladderRoot.position;
+        Vector3 ladderCenter = _currentLadderFeature.bounds.center;
 
         Vector3 toPlayer = (transform.position - ladderCenter).normalized;
         float dot = Vector3.Dot(toPlayer, ladderRoot.forward);
@@ -232,9 +734,7 @@ public class PlayerMovement : MonoBehaviour
 
     private void HandleLadderClimbing()
     {
-        if (!_isLadderClimbing) return;
-
-        Vector2 input = InputManager.Instance.MoveInput;
+        Vector2 input = _input.move;
         float verticalInput = input.y;
 
         // Exit at bottom while moving down
@@ -252,15 +752,19 @@ public class PlayerMovement : MonoBehaviour
 
         if (Mathf.Abs(verticalInput) > 0.1f)
         {
-            Vector3 climbVelocity = Vector3.up * verticalInput * ladderClimbSpeed * Time.deltaTime;
+            Vector3 climbVelocity = Vector3.up * verticalInput * ladderClimbSpeed * _dt;
             _controller.Move(climbVelocity);
         }
 
-        // Keep centered on ladder
-        Collider ladderCollider = _currentLadder.GetComponent<Collider>();
-        Vector3 ladderCenter = ladderCollider != null ? ladderCollider.bounds.center : _currentLadder.position;
+        // Top exit once the feet reach the baked top of the ladder (leaving its trigger upwards is the fallback)
+        if (verticalInput > 0.1f && transform.position.y >= _currentLadderFeature.TopY - LadderTopExitThreshold)
+        {
+            StartLadderTopExit();
+            return;
+        }
 
-        Vector3 attachPos = ladderCenter;
+        // Keep centered on ladder
+        Vector3 attachPos = _currentLadderFeature.bounds.center;
         attachPos.y = transform.position.y;
         attachPos += _ladderFaceDir * ladderOffset;
 
@@ -289,8 +793,9 @@ public class PlayerMovement : MonoBehaviour
 
     private void ExitLadderAtBottom()
     {
-        _isLadderClimbing = false;
+        _states.TryTransition(MovementStateId.Standing, "ladder bottom");
         _currentLadder = null;
+        _currentLadderFeature = null;
         _isAtTopOfLadder = false;
 
         _animator.SetBool("IsLadderClimbing", false);
@@ -300,9 +805,9 @@ public class PlayerMovement : MonoBehaviour
 
     private void StartLadderTopExit()
     {
-        Debug.Log("Starting ladder top exit");
-        _isExitingLadder = true;
-        _isLadderClimbing = false;
+        Diag.Verbose(DiagCategory.Movement, this, "[PlayerMovement] Starting ladder top exit");
+        if (!_states.TryTransition(MovementStateId.LadderExiting, "ladder top"))
+            return;
 
         _animator.SetBool("IsExitingLadder", true);
         _animator.SetBool("IsLadderClimbing", false);
@@ -324,15 +829,14 @@ public class PlayerMovement : MonoBehaviour
             return;
         }
 
-        Transform exitPoint = _currentLadder.Find("ExitPoint");
-
         _velocity = Vector3.zero;
         _animator.SetBool("IsFalling", false);
+        _isJumping = false;
         _animator.SetBool("IsJumping", false);
 
         if (_controller != null) _controller.enabled = false;
 
-        Vector3 targetPos = exitPoint != null ? exitPoint.position : _currentLadder.position;
+        Vector3 targetPos = _currentLadderFeature != null ? _currentLadderFeature.exitPoint : _currentLadder.position;
 
         transform.position = targetPos;
 
@@ -341,18 +845,20 @@ public class PlayerMovement : MonoBehaviour
             _controller.enabled = true;
         }
 
+        SnapInterpolation();
         FinishLadderExitCleanup();
     }
 
     private void FinishLadderExitCleanup()
     {
-        _isExitingLadder = false;
+        _states.TryTransition(MovementStateId.Standing, "ladder exit complete");
         _animator.SetBool("IsExitingLadder", false);
 
         _currentLadder = null;
+        _currentLadderFeature = null;
         _isAtTopOfLadder = false;
         _velocity = Vector3.zero;
-        thirdPersonCamera.ChangeTarget(transform);
+        thirdPersonCamera.ChangeTarget(CameraTarget);
     }
 
     #endregion
@@ -360,69 +866,55 @@ public class PlayerMovement : MonoBehaviour
     private void HandleGliding()
     {
         bool grounded = IsGrounded();
-        bool glideInput = InputManager.Instance.IsGliding;
-        
-        bool canActivateGlide = !grounded && 
-                                _velocity.y < glideFallVelocityThreshold && 
-                                !_isFlipping &&
-                                !Physics.Raycast(transform.position, Vector3.down, minGlideActivationHeight);
+        bool glideInput = _input.glideHeld;
 
-        if (glideInput && canActivateGlide && !_isGliding)
+        if (glideInput && !IsGliding)
         {
-            glider.SetActive(true);
-            _isGliding = true;
-            _animator.SetBool("IsGliding", true);
-            _animator.SetBool("IsFalling", false);
+            _states.TryTransition(MovementStateId.Gliding, "glide pressed");
         }
 
-        if (_isGliding && (grounded || !glideInput || _isFlipping))
+        if (IsGliding && (grounded || !glideInput || _isFlipping))
         {
-            glider.SetActive(false);
-            _isGliding = false;
-            _animator.SetBool("IsGliding", false);
-            if (!grounded)
-            {
-                _animator.SetBool("IsFalling", true);
-            }
+            _states.TryTransition(MovementStateId.Standing, grounded ? "landed" : "glide released");
         }
 
-        if (_isGliding)
+        if (IsGliding)
         {
-            Vector2 input = InputManager.Instance.MoveInput;
-            Vector3 camForward = _mainCamera.forward;
-            Vector3 camRight = _mainCamera.right;
+            Vector2 input = _input.move;
+            Vector3 camForward = _input.cameraForward;
+            Vector3 camRight = _input.cameraRight;
             camForward.y = 0f;
             camRight.y = 0f;
             Vector3 moveDir = (camForward * input.y + camRight * input.x).normalized;
 
-            _velocity.y = Mathf.Max(_velocity.y + glideGravity * Time.deltaTime, glideGravity * 2f);
+            _velocity.y = Mathf.Max(_velocity.y + glideGravity * _dt, glideGravity * 2f);
 
             Vector3 horizontalVelocity = moveDir * glideSpeed;
-            Vector3 glideVelocity = (horizontalVelocity + Vector3.up * _velocity.y) * Time.deltaTime;
+            Vector3 glideVelocity = (horizontalVelocity + Vector3.up * _velocity.y) * _dt;
             _controller.Move(glideVelocity);
 
             if (moveDir.magnitude > 0.1f)
             {
                 Quaternion targetRot = Quaternion.LookRotation(moveDir);
-                transform.rotation = Quaternion.Slerp(transform.rotation, targetRot, glideRotationSpeed * Time.deltaTime);
+                transform.rotation = Quaternion.Slerp(transform.rotation, targetRot, glideRotationSpeed * _dt);
             }
         }
     }
 
     private void HandleMovement()
     {
-        if (_isGliding) return;
-
-        Vector2 input = InputManager.Instance.MoveInput;
-        bool runPressed = InputManager.Instance.IsRunning;
-        bool dancePressed = InputManager.Instance.IsDancing;
-        bool crouchTogglePressed = InputManager.Instance.IsCrouching;
-        bool crouchButtonPressed = InputManager.Instance.CrouchButtonPressed;
-        bool proneTogglePressed = InputManager.Instance.IsProning;
+        if (IsGliding) return;
+
+        Vector2 input = _input.move;
+        bool runPressed = _input.run;
+        bool dancePressed = _input.dancePressed;
+        bool crouchTogglePressed = _input.crouchPressed;
+        bool crouchButtonPressed = _input.crouchHeld;
+        bool proneTogglePressed = _input.pronePressed;
         bool isIdle = input.magnitude < 0.1f;
 
-        Vector3 camForward = _mainCamera.forward;
-        Vector3 camRight = _mainCamera.right;
+        Vector3 camForward = _input.cameraForward;
+        Vector3 camRight = _input.cameraRight;
         camForward.y = 0f;
         camRight.y = 0f;
         Vector3 moveDir = camForward * input.y + camRight * input.x;
@@ -435,22 +927,24 @@ public class PlayerMovement : MonoBehaviour
             _velocity.y = Mathf.Max(_velocity.y, -2f);
             _jumpCount = 0;
             _isFlipping = false;
+            _isJumping = false;
             _animator.SetBool("IsJumping", false);
             _animator.SetBool("IsFalling", false);
 
-            if (_jumpInputQueued && !_jumpPending && !_isCrouching && !_isProning)
+            if (_jumpInputQueued && !_jumpPending && !IsCrouching)
             {
                 _animator.SetTrigger("JumpTrigger");
                 _jumpPending = true;
                 _jumpInputQueued = false;
                 _jumpCount++;
+                ScheduleJumpImpulse(false);
             }
         }
         else
         {
-            _velocity.y += gravity * Time.deltaTime;
+            _velocity.y += gravity * _dt;
 
-            bool jumpPressed = _jumpInputQueued || InputManager.Instance.IsJumping;
+            bool jumpPressed = _jumpInputQueued || _input.jumpPressed;
 
             if (allowDoubleJump
                 && jumpPressed
@@ -458,75 +952,36 @@ public class PlayerMovement : MonoBehaviour
                 && !_isFlipping
                 && !grounded
                 && _jumpCount == 0
-                && !_isCrouching
-                && !_isProning)
+                && !IsCrouching)
             {
                 _animator.SetTrigger("AirJumpTrigger");
                 _jumpPending = true;
                 _jumpInputQueued = false;
                 _jumpCount++;
+                ScheduleJumpImpulse(true);
             }
         }
 
         bool CancelSlideCondition() =>
             !crouchButtonPressed || _slideVelocity.magnitude < minSlideSpeed || (!grounded && _slideFallTimer > slideFallGraceTime);
 
+        // Stands up if there's room, otherwise crouches, otherwise stays down in prone (guards in MovementStateTable)
         void CancelSlide()
         {
-            _isSliding = false;
-            _animator.SetBool("IsSliding", false);
-            _animator.ResetTrigger("Slide_Trigger");
-
-            bool standAllowed = CanStandUp();
-            bool crouchAllowed = CanCrouchUp();
-
-            if (standAllowed && crouchAllowed)
-            {
-                _controller.height = standHeight;
-                _controller.center = new Vector3(0f, standCenterY, 0f);
-                _isCrouching = false;
-                _isProning = false;
-                _animator.SetBool("IsCrouching", false);
-                _animator.SetBool("IsProning", false);
-                _animator.ResetTrigger("CrouchTrigger");
-            }
-            else if (crouchAllowed)
+            if (!_states.TryTransition(MovementStateId.Standing, "slide ended")
+                && !_states.TryTransition(MovementStateId.Crouching, "slide ended"))
             {
-                _controller.height = crouchHeight;
-                _controller.center = new Vector3(0f, crouchCenterY, 0f);
-                _isCrouching = true;
-                _isProning = false;
-                _animator.SetBool("IsCrouching", true);
-                _animator.SetBool("IsProning", false);
-                _animator.SetTrigger("CrouchTrigger");
-            }
-            else
-            {
-                _controller.height = proneHeight;
-                _controller.center = new Vector3(0f, proneCenterY, 0f);
-                _isCrouching = true;
-                _isProning = true;
-                _animator.SetBool("IsCrouching", true);
-                _animator.SetBool("IsProning", true);
-                _animator.SetTrigger("ProneTrigger");
+                _states.TryTransition(MovementStateId.Proning, "slide ended");
             }
         }
 
-        bool airborneSlideAllowed = !grounded && _velocity.y < 0f;
-        bool canSlide = runPressed && input.magnitude > 0.1f && !_isSliding && !_isCrouching && !_isProning && (grounded || airborneSlideAllowed);
-        if (!_isSliding && crouchButtonPressed && canSlide)
+        bool canSlide = runPressed && input.magnitude > 0.1f;
+        if (crouchButtonPressed && canSlide && _states.TryTransition(MovementStateId.Sliding, "crouch while running"))
         {
-            _isSliding = true;
             _slideVelocity = moveDir * runSpeed;
-            _controller.height = slideHeight;
-            _controller.center = new Vector3(0f, slideCenterY, 0f);
-            _animator.SetBool("IsSliding", true);
-            _animator.ResetTrigger("Slide_Trigger");
-            _animator.SetTrigger("Slide_Trigger");
-            _slideFallTimer = 0f;
         }
 
-        if (_isSliding)
+        if (IsSliding)
         {
             Vector3 groundNormal = Vector3.up;
             if (Physics.Raycast(transform.position, Vector3.down, out RaycastHit hit, 1.5f))
@@ -535,13 +990,13 @@ public class PlayerMovement : MonoBehaviour
             }
 
             Vector3 slopeDir = Vector3.ProjectOnPlane(Vector3.down, groundNormal).normalized;
-            _slideVelocity += slopeDir * slideSlopeBoost * Time.deltaTime;
-            _slideVelocity += moveDir * flatSlideBoost * Time.deltaTime;
-            _slideVelocity = Vector3.Lerp(_slideVelocity, Vector3.zero, slideFriction * Time.deltaTime);
+            _slideVelocity += slopeDir * slideSlopeBoost * _dt;
+            _slideVelocity += moveDir * flatSlideBoost * _dt;
+            _slideVelocity = Vector3.Lerp(_slideVelocity, Vector3.zero, slideFriction * _dt);
 
             if (!grounded)
             {
-                _slideFallTimer += Time.deltaTime;
+                _slideFallTimer += _dt;
             }
             else
             {
@@ -554,67 +1009,39 @@ public class PlayerMovement : MonoBehaviour
             }
         }
 
-        if (proneTogglePressed && _isCrouching && !_isProning)
+        if (proneTogglePressed && IsCrouching)
         {
-            _controller.height = proneHeight;
-            _controller.center = new Vector3(0f, proneCenterY, 0f);
-            _isProning = true;
-            _animator.SetBool("IsProning", true);
-            _animator.SetTrigger("ProneTrigger");
-        }
-        else if (proneTogglePressed && _isProning)
-        {
-            if (CanCrouchUp())
-            {
-                _controller.height = crouchHeight;
-                _controller.center = new Vector3(0f, crouchCenterY, 0f);
-                _isProning = false;
-                _isCrouching = true;
-                _animator.SetBool("IsProning", false);
-                _animator.SetBool("IsCrouching", true);
-                _animator.SetTrigger("ProneTrigger");
-            }
+            _states.TryTransition(IsProning ? MovementStateId.Crouching : MovementStateId.Proning, "prone toggled");
         }
 
-        if (crouchTogglePressed && !runPressed && !_isProning && !_isSliding && IsGrounded())
+        if (crouchTogglePressed && !runPressed && !IsProning && !IsSliding && IsGrounded())
         {
-            if (_isCrouching)
+            if (Is(MovementStateId.Crouching))
             {
-                if (CanStandUp())
-                {
-                    _controller.height = standHeight;
-                    _controller.center = new Vector3(0f, standCenterY, 0f);
-                    _animator.ResetTrigger("CrouchTrigger");
-                    _isCrouching = false;
-                    _animator.SetBool("IsCrouching", false);
-                }
-                else
+                // Stays crouched under a low ceiling
+                if (!_states.TryTransition(MovementStateId.Standing, "crouch toggled"))
                 {
                     return;
                 }
             }
             else
             {
-                _isCrouching = true;
-                _controller.height = crouchHeight;
-                _controller.center = new Vector3(0f, crouchCenterY, 0f);
-                _animator.SetTrigger("CrouchTrigger");
-                _animator.SetBool("IsCrouching", true);
+                _states.TryTransition(MovementStateId.Crouching, "crouch toggled");
             }
         }
 
-        bool movingBackward = Vector3.Dot(new Vector3(moveDir.x, 0f, moveDir.z), _mainCamera.forward) < -0.1f;
+        bool movingBackward = Vector3.Dot(new Vector3(moveDir.x, 0f, moveDir.z), _input.cameraForward) < -0.1f;
 
         float targetSpeed;
-        if (_isSliding)
+        if (IsSliding)
         {
             targetSpeed = _slideVelocity.magnitude;
         }
-        else if (_isProning)
+        else if (IsProning)
         {
             targetSpeed = movingBackward ? proneBackwardsSpeed : proneSpeed;
         }
-        else if (_isCrouching)
+        else if (IsCrouching)
         {
             targetSpeed = movingBackward ? crouchBackwardsSpeed : crouchSpeed;
         }
@@ -628,32 +1055,34 @@ public class PlayerMovement : MonoBehaviour
         }
 
         Vector3 horizontalVelocity = moveDir * targetSpeed;
-        Vector3 finalVelocity = _isSliding
-            ? (_slideVelocity + Vector3.up * _velocity.y) * Time.deltaTime
-            : (horizontalVelocity + Vector3.up * _velocity.y) * Time.deltaTime;
+        Vector3 finalVelocity = IsSliding
+            ? (_slideVelocity + Vector3.up * _velocity.y) * _dt
+            : (horizontalVelocity + Vector3.up * _velocity.y) * _dt;
 
         _controller.Move(finalVelocity);
 
-        if (dancePressed && isIdle && !_animator.GetBool("IsFalling") && !_animator.GetBool("IsDancing"))
+        if (dancePressed && isIdle && !_isFalling && !_isDancing)
         {
+            _isDancing = true;
             _animator.SetBool("IsDancing", true);
             _animator.SetTrigger("IsDancingTrigger");
         }
-        else if (!isIdle || _animator.GetBool("IsFalling"))
+        else if (_isDancing && (!isIdle || _isFalling))
         {
+            _isDancing = false;
             _animator.SetBool("IsDancing", false);
         }
 
         if (moveDir.magnitude > 0.1f)
         {
             Quaternion targetRot = movingBackward ? Quaternion.LookRotation(-moveDir) : Quaternion.LookRotation(moveDir);
-            transform.rotation = Quaternion.Slerp(transform.rotation, targetRot, rotationSpeed * Time.deltaTime);
+            transform.rotation = Quaternion.Slerp(transform.rotation, targetRot, rotationSpeed * _dt);
         }
 
-        bool walkingAnim = input.magnitude > 0.1f && (!runPressed || _isCrouching || _isProning);
+        bool walkingAnim = input.magnitude > 0.1f && (!runPressed || IsCrouching);
 
         _animator.SetBool("IsWalking", walkingAnim);
-        _animator.SetBool("IsRunning", !_isCrouching && !_isProning && runPressed && input.magnitude > 0.1f && !movingBackward);
+        _animator.SetBool("IsRunning", !IsCrouching && runPressed && input.magnitude > 0.1f && !movingBackward);
         _animator.SetBool("IsWalkingBackwards", movingBackward);
     }
 
@@ -672,59 +1101,97 @@ public class PlayerMovement : MonoBehaviour
             return;
         }
 
-        _fallTimer += Time.deltaTime;
+        _fallTimer += _dt;
 
         bool currentlyFalling = _fallTimer > fallGraceTime && _velocity.y <= fallingVelocityThreshold;
 
-        if (currentlyFalling && !_isFalling && !_isFlipping && !_isGliding)
+        if (currentlyFalling && !_isFalling && !_isFlipping && !IsGliding)
         {
             _isFalling = true;
             _animator.SetBool("IsFalling", true);
-            _isCrouching = false;
-            _animator.SetBool("IsCrouching", false);
+            if (IsCrouching) _states.TryTransition(MovementStateId.Standing, "fell");
         }
     }
 
+    // Animation events. They only sync timeline events that are already due soon (see MovementEventPlayer):
+    // impulses fire from the simulation clock even when the animation is culled or never plays.
     public void Jump()
     {
-        if (_isCrouching) return;
-
-        _velocity.y = 0;
-        _velocity.y = jumpForce;
-        _animator.SetBool("IsJumping", true);
-        _jumpPending = false;
-        _jumpInputQueued = false;
+        _animationJumpForce = 0f;
+        NotifyAnimationEvent(MovementEvent.JumpImpulse);
     }
 
+    // The force is also kept for the next jumps, so their impulse uses it even when the clock fires before the event
     public void Jump(float customJumpForce)
     {
-        if (_isCrouching) return;
+        _animationJumpForce = customJumpForce;
+        NotifyAnimationEvent(MovementEvent.JumpImpulse, customJumpForce);
+    }
+
+    public void BeginFlip() => NotifyAnimationEvent(MovementEvent.FlipImpulse);
+
+    public void EndFlip() => NotifyAnimationEvent(MovementEvent.FlipEnd);
+
+    // Fixed step never syncs (animation events fire on render frames), and neither does a mesh nobody sees
+    private bool SyncingEventsToAnimation =>
+        syncEventsToAnimation && !useFixedStep && _animator != null && _animator.isActiveAndEnabled
+        && _meshRenderer != null && _meshRenderer.isVisible;
+
+    private void NotifyAnimationEvent(MovementEvent type, float force = 0f)
+    {
+        if (SyncingEventsToAnimation)
+            _events.Notify(type, force);
+    }
+
+    private void OnMovementEvent(MovementEvent type, float force)
+    {
+        switch (type)
+        {
+            case MovementEvent.JumpImpulse: ApplyJump(force > 0f ? force : jumpForce); break;
+            case MovementEvent.FlipImpulse: StartFlip(); break;
+            case MovementEvent.FlipEnd: StopFlip(); break;
+        }
+    }
+
+    private void ApplyJump(float force)
+    {
+        if (IsCrouching) return;
 
         _velocity.y = 0;
-        _velocity.y = customJumpForce;
+        _velocity.y = force;
+        _isJumping = true;
         _animator.SetBool("IsJumping", true);
         _jumpPending = false;
         _jumpInputQueued = false;
     }
 
-    public void BeginFlip()
+    private void StartFlip()
     {
-        if (_isCrouching) return;
+        if (IsCrouching) return;
 
         _isFlipping = true;
         _animator.SetBool("IsFlipping", true);
         _animator.SetBool("IsFalling", true);
         _jumpInputQueued = false;
-        Jump(flipForce);
+        ApplyJump(flipForce);
     }
 
-    public void EndFlip()
+    private void StopFlip()
     {
         _isFlipping = false;
+        _isJumping = false;
         _animator.SetBool("IsFlipping", false);
         _animator.SetBool("IsJumping", false);
     }
 
+    // The impulse (and the flip's end) come from the action's timeline, see OnMovementEvent. A jump takes the force
+    // its animation last gave, only learned while syncing, so fixed step and replays always use jumpForce.
+    private void ScheduleJumpImpulse(bool flip)
+    {
+        if (flip) _events.Play(MovementAction.AirJump);
+        else _events.Play(MovementAction.Jump, SyncingEventsToAnimation ? _animationJumpForce : 0f);
+    }
+
     private bool CanStandUp()
     {
         float checkDistance = (standHeight - crouchHeight) - ceilingCheckOffset;
@@ -745,22 +1212,20 @@ public class PlayerMovement : MonoBehaviour
 
     private void StartRoll()
     {
-        if (!IsGrounded() || _isSliding || _isCrouching || _isProning) return;
+        if (!_states.TryTransition(MovementStateId.Rolling, "roll pressed")) return;
 
-        Vector2 input = InputManager.Instance.MoveInput;
-        Vector3 camForward = _mainCamera.forward; camForward.y = 0f;
-        Vector3 camRight   = _mainCamera.right;   camRight.y = 0f;
+        Vector2 input = _input.move;
+        Vector3 camForward = _input.cameraForward; camForward.y = 0f;
+        Vector3 camRight   = _input.cameraRight;   camRight.y = 0f;
         Vector3 moveDir    = (camForward * input.y + camRight * input.x).normalized;
         
         if (moveDir.sqrMagnitude < 0.1f)
             moveDir = transform.forward;
 
         _rollDirection = moveDir;
-
-        _isRolling = true;
         _rollTimer = 0f;
 
-        if(InputManager.Instance.IsRunning)
+        if(_input.run)
         {
             rollSpeed = defaultRollSpeed * rollRunSpeedMultiplier;
         }
@@ -768,35 +1233,31 @@ public class PlayerMovement : MonoBehaviour
         {
             rollSpeed = defaultRollSpeed;
         }
-        _animator.SetBool("IsRolling", true);
-
-        _controller.height = crouchHeight;
-        _controller.center = new Vector3(0f, crouchCenterY, 0f);
 
         transform.rotation = Quaternion.LookRotation(_rollDirection);
     }
 
     private void UpdateRoll()
     {
-        if(_animator.GetBool("IsJumping"))
+        if(_isJumping)
         {
             FinishRoll();
             return;
         }
 
-        _rollTimer += Time.deltaTime;
+        _rollTimer += _dt;
 
         Vector3 rollVelocity = _rollDirection * rollSpeed;
 
         rollVelocity.y = _velocity.y;
         if(rollSpeed > defaultRollSpeed){
-            _velocity.y += gravity/ (rollGravityDivider * 1.35f) * Time.deltaTime;
+            _velocity.y += gravity/ (rollGravityDivider * 1.35f) * _dt;
         }
         else{
-        _velocity.y += gravity/rollGravityDivider * Time.deltaTime;
+        _velocity.y += gravity/rollGravityDivider * _dt;
         }
 
-        _controller.Move(rollVelocity * Time.deltaTime);
+        _controller.Move(rollVelocity * _dt);
 
         if (_rollTimer >= rollDuration)
         {
@@ -806,44 +1267,26 @@ public class PlayerMovement : MonoBehaviour
 
     private void FinishRoll()
     {
-        _isRolling = false;
-
-        if (CanStandUp())
-        {
-            _controller.height = standHeight;
-            _controller.center = new Vector3(0f, standCenterY, 0f);
-            _isCrouching = false;
-            _animator.SetBool("IsCrouching", false);
-        }
-        else
+        // Stands back up if there's room
+        if (!_states.TryTransition(MovementStateId.Standing, "roll finished"))
         {
-            _controller.height = crouchHeight;
-            _controller.center = new Vector3(0f, crouchCenterY, 0f);
-            _isCrouching = true;
-            _animator.SetBool("IsCrouching", true);
-        }
-
-        _animator.SetBool("IsRolling", false);
-        
-        if(!IsGrounded())
-        {
-            _animator.SetBool("IsFalling", true);
+            _states.TryTransition(MovementStateId.Crouching, "roll finished");
         }
     }
 
     private void EnterLedge(Transform ledgeRoot)
     {
-        if (_isRolling || _isSliding || _isCrouching || _isProning || _isFlipping || _isFalling || _animator.GetBool("IsJumping"))
+        if (!_states.TryTransition(MovementStateId.OnLedge, "ledge trigger"))
             return;
 
-        _isOnLedge = true;
         _currentLedge = ledgeRoot;
+        _currentLedgeFeature = _traversal.Get(ledgeRoot, TraversalKind.Ledge);
 
-        _ledgeForward = _currentLedge.forward;
-        _ledgeInward  = -_currentLedge.right;
+        _ledgeForward = _currentLedgeFeature.direction;
+        _ledgeInward  = _currentLedgeFeature.normal;
 
-        Vector3 localToLedge = transform.position - _currentLedge.position;
-        _ledgeT = Vector3.Dot(localToLedge, _ledgeForward);
+        // Clamped, a ledge grabbed ahead of time starts at its end instead of past it
+        _ledgeT = Mathf.Clamp(_currentLedgeFeature.ProjectT(transform.position), _currentLedgeFeature.minT, _currentLedgeFeature.maxT);
 
         float yRot = _currentLedge.rotation.eulerAngles.y + 90f;
         Quaternion targetRot = Quaternion.Euler(0f, yRot, 0f);
@@ -858,8 +1301,9 @@ public class PlayerMovement : MonoBehaviour
 
     private void ExitLedge()
     {
-        _isOnLedge = false;
+        _states.TryTransition(MovementStateId.Standing, "left ledge");
         _currentLedge = null;
+        _currentLedgeFeature = null;
 
         _animator.SetBool("IsLedgeIdleLeft", false);
         _animator.SetBool("IsLedgeIdleRight", false);
@@ -872,12 +1316,19 @@ public class PlayerMovement : MonoBehaviour
 
     private void HandleLedgeMovement()
     {
-        Vector2 input = InputManager.Instance.MoveInput;
+        Vector2 input = _input.move;
         float x = input.x;
 
-        _ledgeT += x * ledgeSpeed * Time.deltaTime;
+        _ledgeT += x * ledgeSpeed * _dt;
+
+        // Walking past either end of the baked ledge lets go, leaving its trigger is the fallback
+        if (_ledgeT < _currentLedgeFeature.minT || _ledgeT > _currentLedgeFeature.maxT)
+        {
+            ExitLedge();
+            return;
+        }
 
-        Vector3 desiredPos = _currentLedge.position + _ledgeForward * _ledgeT + _ledgeInward * ledgeWallOffset;
+        Vector3 desiredPos = _currentLedgeFeature.origin + _ledgeForward * _ledgeT + _ledgeInward * ledgeWallOffset;
 
         Vector3 delta = desiredPos - transform.position;
         _controller.Move(delta);
@@ -934,13 +1385,13 @@ public class PlayerMovement : MonoBehaviour
 
         if (other.CompareTag("Ladder"))
         {
-            if (!_isLadderClimbing && !_isExitingLadder)
+            if (!IsLadderClimbing)
                 _ladderCandidate = other.transform;
         }
 
         if (other.CompareTag("Ledge"))
         {
-            if (!_isOnLedge && !_ledgeExitCooldown)
+            if (!IsOnLedge && !_ledgeExitCooldown)
                 EnterLedge(other.transform);
         }
     }
@@ -952,11 +1403,11 @@ public class PlayerMovement : MonoBehaviour
         // Fallback: if OnTriggerEnter was missed, ensure candidate is set while inside trigger (Unreal doesn't have this workaround if needed)
         if (other.CompareTag("Ladder"))
         {
-            if (!_isLadderClimbing && !_isExitingLadder)
+            if (!IsLadderClimbing)
             {
                 if (_ladderCandidate == null)
                 {
-                    Debug.Log("[Player] OnTriggerStay set ladder candidate: " + other.name);
+                    Diag.Verbose(DiagCategory.Movement, this, "[PlayerMovement] OnTriggerStay set ladder candidate: {0}", other);
                     _ladderCandidate = other.transform;
                 }
             }
@@ -972,33 +1423,21 @@ public class PlayerMovement : MonoBehaviour
             if (_ladderCandidate != null && other.transform == _ladderCandidate)
                 _ladderCandidate = null;
 
-            if (_isLadderClimbing && _currentLadder != null && other.transform == _currentLadder)
+            if (Is(MovementStateId.LadderClimbing) && _currentLadderFeature != null && other.transform == _currentLadder)
             {
-                Collider ladderCol = _currentLadder.GetComponent<Collider>();
-                if (ladderCol != null)
-                {
-                    Vector3 playerCenterWorld = transform.position + (_controller != null ? _controller.center : Vector3.zero);
-                    float playerTopY = playerCenterWorld.y + ((_controller != null ? _controller.height : 1f) * 0.5f);
+                Vector3 playerCenterWorld = transform.position + (_controller != null ? _controller.center : Vector3.zero);
+                float playerTopY = playerCenterWorld.y + ((_controller != null ? _controller.height : 1f) * 0.5f);
 
-                    // Closest point on ladder collider to the player's center
-                    Vector3 closest = ladderCol.ClosestPoint(playerCenterWorld);
-                    float ladderTopY = ladderCol.bounds.max.y;
+                // Closest point on the baked ladder bounds to the player's center
+                Vector3 closest = _currentLadderFeature.bounds.ClosestPoint(playerCenterWorld);
+                float ladderTopY = _currentLadderFeature.TopY;
 
-                    const float topExitThreshold = 0.25f; // tune if needed
-                    bool leftFromTop = (playerTopY >= ladderTopY - topExitThreshold) || (closest.y >= ladderTopY - topExitThreshold);
+                bool leftFromTop = (playerTopY >= ladderTopY - LadderTopExitThreshold) || (closest.y >= ladderTopY - LadderTopExitThreshold);
 
-                    if (leftFromTop)
-                        StartLadderTopExit();
-                    else
-                        ExitLadderAtBottom();
-                }
+                if (leftFromTop)
+                    StartLadderTopExit();
                 else
-                {
-                    float ladderTopY = _currentLadder.position.y;
-                    float playerTopY = transform.position.y + 1.0f;
-                    if (playerTopY >= ladderTopY - 0.2f) StartLadderTopExit();
-                    else ExitLadderAtBottom();
-                }
+                    ExitLadderAtBottom();
             }
         }
 
@@ -1033,7 +1472,7 @@ public class PlayerMovement : MonoBehaviour
     //     Gizmos.DrawLine(crouchOrigin, crouchOrigin + Vector3.up * Mathf.Max(0.01f, crouchCheckDistance));
 
     //     // Ledge visualization — leaves your ledge math untouched, just helps debug
-    //     if (_isOnLedge && _currentLedge != null)
+    //     if (IsOnLedge && _currentLedge != null)
     //     {
     //         Gizmos.color = Color.cyan;
     //         Gizmos.DrawLine(transform.position, transform.position + _ledgeForward);
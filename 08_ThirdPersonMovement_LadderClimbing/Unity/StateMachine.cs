@@ -0,0 +1,261 @@
+using System;
+using System.Collections.Generic;
+
+/* --------------------------------------------------------------------------
+   Hierarchical state machine.
+
+   • States form a tree and the machine is always in exactly one leaf. IsIn is true for
+     that leaf and for every parent above it.
+   • Transitions are declared up front as guarded edges. An edge declared on a parent
+     applies to all of its children. TryTransition only follows a declared edge whose
+     guard passes, so a transition missing from the table can't happen.
+   • Going from A to B runs the exit hooks from A up to their common parent, then the
+     enter hooks from below it down to B.
+   • Tick runs the current leaf's tick hook, or the closest parent's when the leaf has none.
+   • The last transitions are kept in History for debugging.
+   • Plain C#, no scene or MonoBehaviour involved, so a table can be exercised on its own.
+   -------------------------------------------------------------------------- */
+public class StateMachine<TState> where TState : struct, Enum
+{
+    public struct Transition
+    {
+        public TState from;
+        public TState to;
+        public string reason;
+        public long tick; // Value of Ticks when it happened
+    }
+
+    private class Node
+    {
+        public TState id;
+        public Node parent;
+        public bool isLeaf = true;
+        public Action<TState> enter; // Receives the leaf being left
+        public Action<TState> exit;  // Receives the leaf being entered
+        public Action<float> tick;
+    }
+
+    private class Edge
+    {
+        public TState to;
+        public Func<bool> guard;
+    }
+
+    private static readonly EqualityComparer<TState> Comparer = EqualityComparer<TState>.Default;
+
+    private readonly Dictionary<TState, Node> _nodes = new();
+    private readonly Dictionary<TState, List<Edge>> _edges = new();
+    private readonly Transition[] _history;
+    private int _historyStart;
+    private int _historyCount;
+    private Node _current;
+    private bool _transitioning;
+
+    public TState Current => _current != null ? _current.id : throw new InvalidOperationException("The state machine hasn't been started.");
+    public bool IsStarted => _current != null;
+    public long Ticks { get; private set; }
+
+    // Raised after every transition (not for Start / Reset)
+    public event Action<Transition> Changed;
+
+    public StateMachine(int historyCapacity = 32)
+    {
+        _history = new Transition[Math.Max(1, historyCapacity)];
+    }
+
+    /* ----- Building the table ----- */
+
+    public StateMachine<TState> AddState(TState id, TState? parent = null, Action<TState> enter = null, Action<TState> exit = null, Action<float> tick = null)
+    {
+        if (_current != null) throw new InvalidOperationException("States can't be added once the machine has started.");
+        if (_nodes.ContainsKey(id)) throw new ArgumentException($"State {id} is already declared.");
+
+        Node parentNode = null;
+        if (parent.HasValue && !_nodes.TryGetValue(parent.Value, out parentNode))
+            throw new ArgumentException($"Parent {parent.Value} of {id} has to be declared first.");
+
+        if (parentNode != null) parentNode.isLeaf = false;
+        _nodes[id] = new Node { id = id, parent = parentNode, enter = enter, exit = exit, tick = tick };
+        return this;
+    }
+
+    // 'from' may be a parent, the edge then applies to all of its children. 'to' has to be a leaf.
+    public StateMachine<TState> AddTransition(TState from, TState to, Func<bool> guard = null)
+    {
+        if (!_nodes.ContainsKey(from)) throw new ArgumentException($"Unknown state {from}.");
+        if (!_nodes.ContainsKey(to)) throw new ArgumentException($"Unknown state {to}.");
+
+        if (!_edges.TryGetValue(from, out List<Edge> edges))
+            _edges[from] = edges = new List<Edge>();
+        edges.Add(new Edge { to = to, guard = guard });
+        return this;
+    }
+
+    /* ----- Running ----- */
+
+    public void Start(TState initial)
+    {
+        foreach (List<Edge> edges in _edges.Values)
+            foreach (Edge edge in edges)
+                if (!_nodes[edge.to].isLeaf)
+                    throw new InvalidOperationException($"Transitions have to target a leaf state, {edge.to} has children.");
+
+        Reset(initial, "start");
+    }
+
+    // Places the machine in a leaf without running any hooks or guards. For starting and for restoring
+    // snapshots, where the owner sets up the rest of the state itself.
+    public void Reset(TState state, string reason = "reset")
+    {
+        if (!_nodes.TryGetValue(state, out Node node)) throw new ArgumentException($"Unknown state {state}.");
+        if (!node.isLeaf) throw new ArgumentException($"{state} has children, the machine can only be in a leaf.");
+
+        TState from = _current != null ? _current.id : state;
+        _current = node;
+        Record(from, state, reason);
+    }
+
+    public bool IsIn(TState state)
+    {
+        for (Node node = _current; node != null; node = node.parent)
+            if (Comparer.Equals(node.id, state)) return true;
+        return false;
+    }
+
+    public bool CanTransition(TState to) => _current != null && FindEdge(_current, to, true) != null;
+
+    public bool TryTransition(TState to, string reason = null)
+    {
+        if (_current == null) throw new InvalidOperationException("The state machine hasn't been started.");
+        if (_transitioning) throw new InvalidOperationException($"Transition to {to} requested from inside an enter / exit hook.");
+        if (Comparer.Equals(_current.id, to)) return false;
+        if (FindEdge(_current, to, true) == null) return false;
+
+        Node from = _current;
+        Node target = _nodes[to];
+        Node common = CommonAncestor(from, target);
+
+        _transitioning = true;
+        try
+        {
+            for (Node node = from; node != common; node = node.parent)
+                node.exit?.Invoke(to);
+
+            _current = target;
+            EnterDown(target, common, from.id);
+        }
+        finally
+        {
+            _transitioning = false;
+        }
+
+        Transition transition = Record(from.id, to, reason);
+        Changed?.Invoke(transition);
+        return true;
+    }
+
+    public void Tick(float deltaTime)
+    {
+        if (_current == null) throw new InvalidOperationException("The state machine hasn't been started.");
+
+        Ticks++;
+        for (Node node = _current; node != null; node = node.parent)
+        {
+            if (node.tick == null) continue;
+            node.tick(deltaTime);
+            return;
+        }
+    }
+
+    /* ----- Debugging / table checks ----- */
+
+    // Oldest first
+    public IEnumerable<Transition> History
+    {
+        get
+        {
+            for (int i = 0; i < _historyCount; i++)
+                yield return _history[(_historyStart + i) % _history.Length];
+        }
+    }
+
+    public IEnumerable<TState> Leaves
+    {
+        get
+        {
+            foreach (Node node in _nodes.Values)
+                if (node.isLeaf) yield return node.id;
+        }
+    }
+
+    // Whether the table declares from -> to, ignoring guards
+    public bool HasEdge(TState from, TState to)
+    {
+        return _nodes.TryGetValue(from, out Node node) && FindEdge(node, to, false) != null;
+    }
+
+    // Whether 'to' can be reached from 'from' through declared edges, ignoring guards
+    public bool IsReachable(TState from, TState to)
+    {
+        var visited = new HashSet<TState> { from };
+        var open = new Queue<TState>();
+        open.Enqueue(from);
+
+        while (open.Count > 0)
+        {
+            TState state = open.Dequeue();
+            if (Comparer.Equals(state, to)) return true;
+
+            foreach (TState next in Leaves)
+                if (!visited.Contains(next) && HasEdge(state, next))
+                {
+                    visited.Add(next);
+                    open.Enqueue(next);
+                }
+        }
+        return false;
+    }
+
+    /* ----- Internals ----- */
+
+    private Edge FindEdge(Node from, TState to, bool checkGuard)
+    {
+        for (Node node = from; node != null; node = node.parent)
+        {
+            if (!_edges.TryGetValue(node.id, out List<Edge> edges)) continue;
+
+            foreach (Edge edge in edges)
+                if (Comparer.Equals(edge.to, to) && (!checkGuard || edge.guard == null || edge.guard()))
+                    return edge;
+        }
+        return null;
+    }
+
+    private static Node CommonAncestor(Node a, Node b)
+    {
+        for (Node x = a; x != null; x = x.parent)
+            for (Node y = b; y != null; y = y.parent)
+                if (x == y) return x;
+        return null;
+    }
+
+    // Runs enter hooks from just below 'stop' down to 'node'
+    private static void EnterDown(Node node, Node stop, TState previous)
+    {
+        if (node == null || node == stop) return;
+        EnterDown(node.parent, stop, previous);
+        node.enter?.Invoke(previous);
+    }
+
+    private Transition Record(TState from, TState to, string reason)
+    {
+        var transition = new Transition { from = from, to = to, reason = reason, tick = Ticks };
+
+        int index = (_historyStart + _historyCount) % _history.Length;
+        _history[index] = transition;
+        if (_historyCount < _history.Length) _historyCount++;
+        else _historyStart = (_historyStart + 1) % _history.Length;
+
+        return transition;
+    }
+}
@@ -0,0 +1,73 @@
+using System.Collections;
+using NUnit.Framework;
+using Unity.PerformanceTesting;
+using UnityEngine;
+using UnityEngine.TestTools;
+
+// Times single ThirdPersonCamera updates in Play mode behind the player on a flat floor: in the open, with a wall pulling
+// the camera in, with a prop hiding the player (faded, on its own layer so collision ignores it) and while the crouch
+// profile blends in. Every path must stay within the camera's 0.05 ms budget. Compared with PerfBaselines/Movement.json.
+public class CameraPerformanceTests
+{
+    private const double BudgetMs = 0.05;
+    private const int Updates = 1000;
+    private const float UpdateTime = 1f / 60f;
+    private const int OccluderLayer = 1; // TransparentFX, unused by the scene
+
+    [UnityTearDown]
+    public IEnumerator TearDown()
+    {
+        if (Application.isPlaying)
+            yield return new ExitPlayMode();
+    }
+
+    [UnityTest, Performance]
+    public IEnumerator Update_EveryPath()
+    {
+        yield return new EnterPlayMode();
+        PlayerMovement player = MovementTestScene.Spawn();
+        var rig = Camera.main.gameObject.AddComponent<ThirdPersonCamera>();
+        rig.target = player.transform;
+        rig.collisionMask = ~(1 << OccluderLayer);
+        rig.occlusionMask = 1 << OccluderLayer;
+        yield return null; // Start runs
+        player.enabled = false; // Only the test ticks them from here
+        rig.enabled = false;
+
+        Run(rig, "Camera_Open");
+
+        // Behind the camera's orbit, so every update casts into it
+        GameObject wall = GameObject.CreatePrimitive(PrimitiveType.Cube);
+        wall.transform.position = new Vector3(0f, 1.5f, -3f);
+        wall.transform.localScale = new Vector3(10f, 5f, 0.5f);
+        Run(rig, "Camera_Collision");
+        Object.Destroy(wall);
+        yield return null;
+
+        GameObject prop = GameObject.CreatePrimitive(PrimitiveType.Cube);
+        prop.layer = OccluderLayer;
+        prop.transform.position = new Vector3(0f, 1.6f, -2.5f);
+        Run(rig, "Camera_Occlusion");
+        Object.Destroy(prop);
+        yield return null;
+
+        // Crouched from the first measured update, so the profile weight blends in while it is timed
+        player.SimulateTick(new MovementInput { crouchPressed = true, crouchHeld = true, cameraForward = Vector3.forward, cameraRight = Vector3.right }, UpdateTime);
+        Assert.IsTrue(player.IsCrouching, "Player crouched");
+        Run(rig, "Camera_Framing");
+
+        foreach (string group in new[] { "Camera_Open", "Camera_Collision", "Camera_Occlusion", "Camera_Framing" })
+            PerfBaseline.AssertBudget(group, BudgetMs);
+        PerfBaseline.AssertWithin("Movement");
+    }
+
+    private static void Run(ThirdPersonCamera rig, string group)
+    {
+        Measure.Method(() => rig.UpdateRig(new Vector2(0.1f, 0f), UpdateTime))
+            .WarmupCount(10)
+            .MeasurementCount(Updates)
+            .SampleGroup(group)
+            .GC()
+            .Run();
+    }
+}
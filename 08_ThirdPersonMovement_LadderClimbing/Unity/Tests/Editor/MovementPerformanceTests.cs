@@ -0,0 +1,76 @@
+using System.Collections;
+using NUnit.Framework;
+using Unity.PerformanceTesting;
+using UnityEngine;
+using UnityEngine.TestTools;
+
+// Times the player in Play mode on a flat floor, compared with PerfBaselines/Movement.json: single ticks on synthetic input
+// (walking and running in circles, then the same with a jump every 1.5 s) at a 60 Hz step, then whole frames on idle input.
+public class MovementPerformanceTests
+{
+    private const int Ticks = 2000;
+    private const float TickTime = 1f / 60f;
+
+    [UnityTearDown]
+    public IEnumerator TearDown()
+    {
+        if (Application.isPlaying)
+            yield return new ExitPlayMode();
+    }
+
+    [UnityTest, Performance]
+    public IEnumerator Ticks_OnSyntheticInput()
+    {
+        yield return new EnterPlayMode();
+        PlayerMovement player = MovementTestScene.Spawn();
+        yield return null; // Start runs
+        player.enabled = false; // Only the test ticks it from here
+
+        MovementState start = player.CaptureMovementState();
+
+        int tick = 0;
+        Measure.Method(() => player.SimulateTick(SyntheticInput(tick++, false), TickTime))
+            .WarmupCount(10)
+            .MeasurementCount(Ticks)
+            .SampleGroup("Tick_Locomotion")
+            .GC()
+            .Run();
+        player.RestoreMovementState(start);
+
+        tick = 0;
+        Measure.Method(() => player.SimulateTick(SyntheticInput(tick++, true), TickTime))
+            .WarmupCount(10)
+            .MeasurementCount(Ticks)
+            .SampleGroup("Tick_Jumping")
+            .GC()
+            .Run();
+        player.RestoreMovementState(start);
+
+        PerfBaseline.AssertWithin("Movement");
+    }
+
+    [UnityTest, Performance]
+    public IEnumerator Frames_Idle()
+    {
+        yield return new EnterPlayMode();
+        MovementTestScene.Spawn();
+        yield return null;
+
+        yield return PerfBaseline.Frames("Frame_Player", 300);
+
+        PerfBaseline.AssertWithin("Movement");
+    }
+
+    private static MovementInput SyntheticInput(int tick, bool jumping)
+    {
+        float angle = tick * 0.02f;
+        return new MovementInput
+        {
+            move = new Vector2(Mathf.Sin(angle), Mathf.Cos(angle)),
+            cameraForward = Vector3.forward,
+            cameraRight = Vector3.right,
+            run = tick % 400 >= 200,
+            jumpPressed = jumping && tick % 90 == 0
+        };
+    }
+}
@@ -0,0 +1,108 @@
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using NUnit.Framework;
+using UnityEngine;
+using UnityEngine.TestTools;
+
+// Replay regression on the checked-in traces below (60 Hz input on a flat floor, locomotion, jumps, slides and rolls only:
+// ledge and ladder entry come from trigger callbacks, which don't run during an in-frame replay). Each trace is recorded
+// by replaying it, then must replay bit for bit. Performed as live input at 30, 60 and 144 fps (sampled once per frame and
+// latched until a tick spends it), every run must keep every press, replay bit for bit from what it consumed and end in
+// the same state as the others.
+//
+// The runs' end positions are compared within FrameRateTolerance rather than bit for bit: latched input reaches the
+// simulation up to one tick earlier at 30 and 144 fps than at 60, so each change of stick or button can move the end
+// by one tick of travel.
+public class MovementReplayTests
+{
+    private const int TickRate = 60;
+    private const float FrameRateTolerance = 0.25f;
+    private static readonly int[] FrameRates = { 30, 60, 144 };
+
+    private static readonly (string name, int ticks, Func<int, MovementInput> input)[] Traces =
+    {
+        // Walking in circles, running for the middle third
+        ("Locomotion", 600, tick => TickInput(Circle(tick), run: tick >= 200 && tick < 400)),
+
+        // Running forward with a jump every 1.5 s, a double jump in the middle
+        ("Jumps", 600, tick => TickInput(Vector2.up, run: true, jump: tick % 90 == 30 || tick == 285)),
+
+        // Running into a slide, standing back up, then a roll and a crouched walk
+        ("SlideAndRoll", 600, tick => TickInput(tick < 480 ? Vector2.up : Circle(tick), run: tick < 300,
+            crouchPressed: tick == 120 || tick == 420, crouchHeld: (tick >= 120 && tick < 180) || tick >= 420, roll: tick == 300)),
+    };
+
+    [UnityTearDown]
+    public IEnumerator TearDown()
+    {
+        if (Application.isPlaying)
+            yield return new ExitPlayMode();
+    }
+
+    [UnityTest]
+    public IEnumerator Traces_ReplayAndMatchAtEveryFrameRate()
+    {
+        yield return new EnterPlayMode();
+        PlayerMovement player = MovementTestScene.Spawn();
+        for (int i = 0; i < 10; i++)
+            yield return null; // Start runs and the player settles on the floor
+        player.enabled = false; // Only the test ticks it from here
+
+        MovementState start = player.CaptureMovementState();
+        var failures = new List<string>();
+
+        foreach (var (name, ticks, input) in Traces)
+        {
+            var trace = new MovementTrace { tickRate = TickRate, start = start };
+            for (int tick = 0; tick < ticks; tick++)
+                trace.inputs.Add(input(tick));
+            trace.endPosition = player.ReplayTrace(trace);
+
+            if (!SameBits(player.ReplayTrace(trace), trace.endPosition))
+                failures.Add($"{name}: replay differs from the recording");
+
+            var ends = new Vector3[FrameRates.Length];
+            var states = new MovementStateId[FrameRates.Length];
+            for (int i = 0; i < FrameRates.Length; i++)
+            {
+                MovementTrace performed = player.PerformTrace(trace, FrameRates[i]);
+                ends[i] = performed.endPosition;
+                states[i] = player.CaptureMovementState().state;
+
+                if (performed.CountPresses() != trace.CountPresses())
+                    failures.Add($"{name}: {FrameRates[i]} fps spent {performed.CountPresses()} of {trace.CountPresses()} presses");
+                if (!SameBits(player.ReplayTrace(performed), performed.endPosition))
+                    failures.Add($"{name}: {FrameRates[i]} fps run doesn't replay bit for bit");
+                if (states[i] != states[0])
+                    failures.Add($"{name}: {FrameRates[i]} fps ended {states[i]}, {FrameRates[0]} fps {states[0]}");
+                if (Vector3.Distance(ends[i], ends[0]) > FrameRateTolerance)
+                    failures.Add($"{name}: {FrameRates[i]} fps ended {Vector3.Distance(ends[i], ends[0]):F3} m from {FrameRates[0]} fps");
+            }
+
+            TestContext.WriteLine($"{name} ({ticks} ticks): 30 fps {ends[0]:F4}, 60 fps {ends[1]:F4}, 144 fps {ends[2]:F4}, recorded {trace.endPosition:F4}");
+        }
+
+        Assert.IsEmpty(failures, string.Join("\n", failures));
+    }
+
+    private static Vector2 Circle(int tick) => new Vector2(Mathf.Sin(tick * 0.02f), Mathf.Cos(tick * 0.02f));
+
+    private static MovementInput TickInput(Vector2 move, bool run = false, bool jump = false, bool crouchPressed = false, bool crouchHeld = false, bool roll = false)
+    {
+        return new MovementInput
+        {
+            move = move,
+            cameraForward = Vector3.forward,
+            cameraRight = Vector3.right,
+            run = run,
+            jumpPressed = jump,
+            crouchPressed = crouchPressed,
+            crouchHeld = crouchHeld,
+            rollPressed = roll
+        };
+    }
+
+    // Vector3 == compares within 1e-5, replays have to match exactly
+    private static bool SameBits(Vector3 a, Vector3 b) => a.x.Equals(b.x) && a.y.Equals(b.y) && a.z.Equals(b.z);
+}
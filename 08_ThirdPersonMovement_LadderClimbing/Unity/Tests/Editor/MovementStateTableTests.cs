@@ -0,0 +1,131 @@
+using System.Collections.Generic;
+using NUnit.Framework;
+
+// Drives the movement state table with fake guards: every state is reachable and leads back to Standing, transitions
+// that would break movement don't exist, guards gate their edges, and hooks run in order on the right states.
+public class MovementStateTableTests
+{
+    private class FakeHooks : IMovementStateHooks
+    {
+        public bool grounded = true, slide = true, glide = true, ledge = true, ladder = true, standUp = true, crouchUp = true;
+        public readonly List<string> calls = new List<string>();
+
+        public bool IsGrounded() => grounded;
+        public bool CanStartSlide() => slide;
+        public bool CanStartGlide() => glide;
+        public bool CanGrabLedge() => ledge;
+        public bool CanGrabLadder() => ladder;
+        public bool CanStandUp() => standUp;
+        public bool CanCrouchUp() => crouchUp;
+
+        public void OnEnter(MovementStateId state, MovementStateId from) => calls.Add($"enter {state} from {from}");
+        public void OnExit(MovementStateId state, MovementStateId to) => calls.Add($"exit {state} to {to}");
+        public void OnTick(MovementStateId state, float deltaTime) => calls.Add($"tick {state}");
+    }
+
+    private FakeHooks hooks;
+    private StateMachine<MovementStateId> table;
+
+    [SetUp]
+    public void SetUp()
+    {
+        hooks = new FakeHooks();
+        table = MovementStateTable.Build(hooks, 8);
+        table.Start(MovementStateId.Standing);
+        hooks.calls.Clear();
+    }
+
+    [Test]
+    public void EveryLeaf_IsReachableFromStandingAndLeadsBack()
+    {
+        foreach (MovementStateId state in table.Leaves)
+        {
+            Assert.IsTrue(table.IsReachable(MovementStateId.Standing, state), $"{state} can't be reached from Standing");
+            Assert.IsTrue(table.IsReachable(state, MovementStateId.Standing), $"{state} never leads back to Standing");
+        }
+    }
+
+    [TestCase(MovementStateId.Standing, MovementStateId.Proning)]
+    [TestCase(MovementStateId.Standing, MovementStateId.LadderExiting)]
+    [TestCase(MovementStateId.Crouching, MovementStateId.Rolling)]
+    [TestCase(MovementStateId.Proning, MovementStateId.Sliding)]
+    [TestCase(MovementStateId.Sliding, MovementStateId.Rolling)]
+    [TestCase(MovementStateId.Sliding, MovementStateId.Gliding)]
+    [TestCase(MovementStateId.Rolling, MovementStateId.Sliding)]
+    [TestCase(MovementStateId.Rolling, MovementStateId.Gliding)]
+    [TestCase(MovementStateId.Gliding, MovementStateId.Crouching)]
+    [TestCase(MovementStateId.Gliding, MovementStateId.Rolling)]
+    [TestCase(MovementStateId.OnLedge, MovementStateId.LadderClimbing)]
+    [TestCase(MovementStateId.LadderClimbing, MovementStateId.OnLedge)]
+    [TestCase(MovementStateId.LadderExiting, MovementStateId.LadderClimbing)]
+    public void ForbiddenTransition_IsNotDeclared(MovementStateId from, MovementStateId to)
+    {
+        Assert.IsFalse(table.HasEdge(from, to));
+    }
+
+    [Test]
+    public void Guards_GateTheirTransitions()
+    {
+        hooks.grounded = false;
+        Assert.IsFalse(table.TryTransition(MovementStateId.Crouching), "Crouched in the air");
+        Assert.IsFalse(table.TryTransition(MovementStateId.Rolling), "Rolled in the air");
+
+        hooks.grounded = true;
+        Assert.IsTrue(table.TryTransition(MovementStateId.Crouching));
+        Assert.IsTrue(table.TryTransition(MovementStateId.Proning));
+
+        // Getting up from prone needs room for the crouch and for standing
+        hooks.standUp = false;
+        Assert.IsFalse(table.TryTransition(MovementStateId.Standing));
+        Assert.IsTrue(table.TryTransition(MovementStateId.Crouching));
+
+        hooks.standUp = true;
+        Assert.IsTrue(table.TryTransition(MovementStateId.Standing));
+
+        hooks.ledge = false;
+        Assert.IsFalse(table.TryTransition(MovementStateId.OnLedge));
+        hooks.ladder = false;
+        Assert.IsFalse(table.TryTransition(MovementStateId.LadderClimbing));
+        Assert.AreEqual(MovementStateId.Standing, table.Current);
+    }
+
+    [Test]
+    public void Hooks_RunFromTheLeftLeafUpThenDownToTheNewOne()
+    {
+        table.TryTransition(MovementStateId.Crouching);
+        table.TryTransition(MovementStateId.Proning);
+        table.TryTransition(MovementStateId.Standing);
+
+        CollectionAssert.AreEqual(new[]
+        {
+            "exit Standing to Crouching",
+            "enter Crouched from Standing",
+            "enter Crouching from Standing",
+            "exit Crouching to Proning",
+            "enter Proning from Crouching",
+            "exit Proning to Standing",
+            "exit Crouched to Standing",
+            "enter Standing from Proning"
+        }, hooks.calls);
+    }
+
+    [Test]
+    public void Tick_RunsTheLeafOrItsClosestTickingParent()
+    {
+        table.Tick(0.1f);
+        table.TryTransition(MovementStateId.Rolling);
+        table.Tick(0.1f);
+        table.TryTransition(MovementStateId.Crouching);
+        table.Tick(0.1f);
+        table.TryTransition(MovementStateId.Standing);
+        table.TryTransition(MovementStateId.LadderClimbing);
+        table.TryTransition(MovementStateId.LadderExiting);
+        hooks.calls.RemoveAll(call => !call.StartsWith("tick"));
+        table.Tick(0.1f);
+
+        CollectionAssert.AreEqual(new[]
+        {
+            "tick Locomotion", "tick Rolling", "tick Locomotion", "tick LadderExiting"
+        }, hooks.calls);
+    }
+}
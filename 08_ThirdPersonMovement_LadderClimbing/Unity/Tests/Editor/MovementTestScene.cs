@@ -0,0 +1,61 @@
+using UnityEditor.Animations;
+using UnityEngine;
+using UnityEngine.InputSystem;
+
+// The scene the movement tests run the player in: a flat floor, a main camera, an input manager with unbound actions
+// and the player standing on the floor with an animator that has every parameter PlayerMovement sets.
+public static class MovementTestScene
+{
+    // Every parameter PlayerMovement sets, so the animator takes the calls without warnings
+    private static readonly string[] BoolParameters =
+    {
+        "IsFalling", "IsJumping", "IsFlipping", "IsDancing", "IsCrouching", "IsProning", "IsSliding", "IsRolling", "IsGliding",
+        "IsRunning", "IsWalking", "IsWalkingBackwards", "IsLadderClimbing", "IsLadderClimbingDown", "IsExitingLadder",
+        "IsLedgeIdleLeft", "IsLedgeIdleRight", "IsLedgeWalkingLeft", "IsLedgeWalkingRight"
+    };
+    private static readonly string[] TriggerParameters =
+    {
+        "JumpTrigger", "AirJumpTrigger", "CrouchTrigger", "ProneTrigger", "Slide_Trigger", "IsDancingTrigger"
+    };
+    private static readonly string[] InputActions = { "Move", "Look", "Run", "Dance", "Jump", "Crouch", "Prone", "Roll", "Glide", "Climb" };
+
+    public static PlayerMovement Spawn()
+    {
+        var floor = GameObject.CreatePrimitive(PrimitiveType.Cube);
+        floor.transform.localScale = new Vector3(500f, 1f, 500f);
+        floor.transform.position = Vector3.down * 0.5f;
+
+        new GameObject("Camera", typeof(Camera)) { tag = "MainCamera" }.transform.position = new Vector3(0f, 2f, -5f);
+
+        var actions = ScriptableObject.CreateInstance<InputActionAsset>();
+        InputActionMap map = actions.AddActionMap("Player");
+        foreach (string action in InputActions)
+            map.AddAction(action, action == "Move" || action == "Look" ? InputActionType.Value : InputActionType.Button);
+
+        // Inactive until PlayerInput has its actions, InputManager reads them in Awake
+        var input = new GameObject("InputManager");
+        input.SetActive(false);
+        input.AddComponent<PlayerInput>().actions = actions;
+        input.AddComponent<InputManager>();
+        input.SetActive(true);
+
+        var controller = new AnimatorController();
+        controller.AddLayer("Base Layer");
+        foreach (string parameter in BoolParameters)
+            controller.AddParameter(parameter, AnimatorControllerParameterType.Bool);
+        foreach (string parameter in TriggerParameters)
+            controller.AddParameter(parameter, AnimatorControllerParameterType.Trigger);
+
+        var player = new GameObject("Player") { tag = "Player" };
+        player.transform.position = Vector3.up * 0.1f;
+        var character = player.AddComponent<CharacterController>();
+        character.height = 1.8f;
+        character.center = Vector3.up * 0.9f;
+
+        var mesh = new GameObject("Mesh", typeof(Animator));
+        mesh.transform.SetParent(player.transform, false);
+        mesh.GetComponent<Animator>().runtimeAnimatorController = controller;
+
+        return player.AddComponent<PlayerMovement>();
+    }
+}
@@ -0,0 +1,120 @@
+using System.Collections.Generic;
+using NUnit.Framework;
+using UnityEngine;
+
+// Bakes box ladders into a TraversalRegistry (default 4 m cells) and queries it: features spanning cell boundaries are
+// found from every cell they touch, queries hit inside the look-ahead reach and miss just beyond it, the top height and
+// exit point come from the collider and its ExitPoint child, and moved ladders stay stale until Rebake.
+// Needs the Ladder and Ledge tags the module's setup adds.
+public class TraversalRegistryTests
+{
+    private const float Reach = 0.5f;
+
+    private readonly List<GameObject> created = new List<GameObject>();
+    private TraversalRegistry registry;
+
+    [SetUp]
+    public void SetUp()
+    {
+        // Awake doesn't run in Edit mode, every test bakes by hand
+        registry = Track(new GameObject("TraversalRegistry")).AddComponent<TraversalRegistry>();
+    }
+
+    [TearDown]
+    public void TearDown()
+    {
+        foreach (GameObject go in created)
+            Object.DestroyImmediate(go);
+        created.Clear();
+    }
+
+    [Test]
+    public void Feature_AcrossCellBoundaries_IsFoundFromEveryCell()
+    {
+        // From y = -2 to 10: cells -1 to 2. Each query below only reaches into one of them.
+        Ladder(new Vector3(4f, -2f, 0f), 12f);
+        registry.Rebake();
+
+        Assert.AreEqual(1, registry.Features.Count);
+        Assert.IsTrue(Find(new Vector3(4.3f, -1.5f, 0f)), "From cell y -1");
+        Assert.IsTrue(Find(new Vector3(4.3f, 1f, 0f)), "From cell y 0");
+        Assert.IsTrue(Find(new Vector3(4.3f, 5f, 0f)), "From cell y 1");
+        Assert.IsTrue(Find(new Vector3(4.3f, 9.3f, 0f)), "From cell y 2");
+        Assert.IsFalse(Find(new Vector3(4.3f, 10.8f, 0f)), "Above the ladder");
+    }
+
+    [Test]
+    public void Query_AtTheLookAheadEdge_HitsInsideAndMissesBeyond()
+    {
+        Ladder(Vector3.zero, 3f);
+        registry.Rebake();
+
+        // Sweeping towards the ladder: the swept path ends just inside or just outside the reach of its segment
+        Vector3 start = new Vector3(-3f, 1f, 0f);
+        Assert.IsTrue(Find(start, new Vector3(3f - Reach + 0.02f, 0f, 0f)), "Ends inside the reach");
+        Assert.IsFalse(Find(start, new Vector3(3f - Reach - 0.02f, 0f, 0f)), "Ends beyond the reach");
+
+        // Sweeping past it sideways: the closest approach is mid-path, not at the end
+        Assert.IsTrue(Find(new Vector3(-1f, 1f, Reach - 0.02f), new Vector3(2f, 0f, 0f)), "Passes inside the reach");
+        Assert.IsFalse(Find(new Vector3(-1f, 1f, Reach + 0.02f), new Vector3(2f, 0f, 0f)), "Passes beyond the reach");
+    }
+
+    [Test]
+    public void Ladder_TopAndExitPoint_ComeFromItsColliderAndChild()
+    {
+        GameObject withExit = Ladder(Vector3.zero, 4f);
+        var exit = new GameObject("ExitPoint");
+        exit.transform.SetParent(withExit.transform, false);
+        exit.transform.position = new Vector3(0f, 4.2f, 0.6f);
+
+        GameObject withoutExit = Ladder(new Vector3(20f, 1f, 0f), 3f);
+        registry.Rebake();
+
+        TraversalFeature feature = registry.Get(withExit.transform, TraversalKind.Ladder);
+        Assert.AreEqual(4f, feature.TopY, 1e-4f);
+        Assert.AreEqual(0f, feature.Start.y, 1e-4f);
+        Assert.AreEqual(new Vector3(0f, 4.2f, 0.6f), feature.exitPoint);
+
+        feature = registry.Get(withoutExit.transform, TraversalKind.Ladder);
+        Assert.AreEqual(4f, feature.TopY, 1e-4f);
+        Assert.AreEqual(withoutExit.transform.position, feature.exitPoint, "Falls back to the ladder itself");
+    }
+
+    [Test]
+    public void MovedLadder_IsStaleUntilRebake()
+    {
+        GameObject ladder = Ladder(Vector3.zero, 3f);
+        registry.Rebake();
+
+        ladder.transform.position = new Vector3(20f, 0f, 0f);
+        Physics.SyncTransforms();
+        Assert.IsTrue(Find(new Vector3(0.3f, 1f, 0f)), "Still baked at the old place");
+        Assert.IsFalse(Find(new Vector3(20.3f, 1f, 0f)), "Not yet at the new place");
+
+        registry.Rebake();
+        Assert.IsFalse(Find(new Vector3(0.3f, 1f, 0f)), "Gone from the old place");
+        Assert.IsTrue(Find(new Vector3(20.3f, 1f, 0f)), "At the new place");
+    }
+
+    // A 0.5 x height x 0.1 m box ladder standing on 'foot'
+    private GameObject Ladder(Vector3 foot, float height)
+    {
+        GameObject ladder = Track(GameObject.CreatePrimitive(PrimitiveType.Cube));
+        ladder.tag = "Ladder";
+        ladder.transform.position = foot + Vector3.up * height * 0.5f;
+        ladder.transform.localScale = new Vector3(0.5f, height, 0.1f);
+        Physics.SyncTransforms();
+        return ladder;
+    }
+
+    private bool Find(Vector3 position) => Find(position, Vector3.zero);
+
+    private bool Find(Vector3 position, Vector3 motion) =>
+        registry.FindNearest(TraversalKind.Ladder, position, motion, Reach, out _, out _);
+
+    private GameObject Track(GameObject go)
+    {
+        created.Add(go);
+        return go;
+    }
+}
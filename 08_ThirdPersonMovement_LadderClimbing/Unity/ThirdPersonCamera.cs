@@ -1,9 +1,12 @@
+using System.Collections.Generic;
 using UnityEngine;
 
 public class ThirdPersonCamera : MonoBehaviour
 {
     [Header("References")]
     public Transform target;
+    [Tooltip("Source of the movement states for the framing profiles. Found from the target if empty, and again on ChangeTarget.")]
+    public PlayerMovement movement;
 
     [Header("Orbit Settings")]
     public float distance = 5f;
@@ -21,6 +24,44 @@ public class ThirdPersonCamera : MonoBehaviour
     [Range(0.1f, 5f)]
     public float verticalSensitivityMultiplier = 0.75f;
 
+    [Header("Collision")]
+    public bool collisionEnabled = true;
+    [Tooltip("World geometry the camera can't pass through. Exclude the player's own layer.")]
+    public LayerMask collisionMask = ~0;
+    public float collisionRadius = 0.25f;
+    [Tooltip("Closest the camera is pulled to the pivot by a wall.")]
+    public float minDistance = 0.4f;
+    [Tooltip("Damping when a wall pulls the camera in. Keep it tiny so the camera never shows the inside of a wall.")]
+    public float pullInSmoothTime = 0.03f;
+    [Tooltip("Damping when the camera eases back out once the wall is gone.")]
+    public float easeOutSmoothTime = 0.35f;
+
+    [Header("Occlusion")]
+    public bool occlusionEnabled = true;
+    [Tooltip("Layers whose renderers fade when they hide the player. Usually props, not the floor.")]
+    public LayerMask occlusionMask = ~0;
+    [Range(1, 9)]
+    public int occlusionRays = 5;
+    public float occlusionProbeSpread = 0.35f;
+    [Range(0f, 1f)]
+    public float fadedAlpha = 0.25f;
+    public float fadeSpeed = 6f;
+    [Tooltip("Color property faded through a MaterialPropertyBlock (_BaseColor for URP Lit, _Color for Standard).")]
+    public string fadeColorProperty = "_BaseColor";
+
+    [Header("Movement State Profiles")]
+    public bool profilesEnabled = true;
+    public List<CameraRigProfile> profiles = new()
+    {
+        CameraRigProfile.Create("Crouch", CameraRigState.Crouch, 10, 4f, 58f, 1.1f),
+        CameraRigProfile.Create("Prone", CameraRigState.Prone, 20, 3.5f, 55f, 0.6f),
+        CameraRigProfile.Create("Roll", CameraRigState.Roll, 30, 5f, 64f, 0.9f),
+        CameraRigProfile.Create("Slide", CameraRigState.Slide, 30, 4.5f, 68f, 0.8f, 0.08f),
+        CameraRigProfile.Create("Ledge", CameraRigState.Ledge, 40, 3.5f, 55f, 1.6f),
+        CameraRigProfile.Create("Glide", CameraRigState.Glide, 50, 7f, 72f, 1.6f, 0.25f, 0.6f),
+        CameraRigProfile.Create("Ladder", CameraRigState.Ladder, 60, 4f, 55f, 1.8f)
+    };
+
     private float _yaw;
     private float _pitch;
 
@@ -30,45 +71,172 @@ public class ThirdPersonCamera : MonoBehaviour
     private Vector3 _smoothedTargetPosition;
     private Vector3 _smoothedTargetVelocity;
 
+    private Camera _camera;
+    private float _baseFieldOfView = 60f;
+    private Vector3 _orbitPosition;
+    private float _collisionDistance;
+    private float _collisionVelocity;
+    private Vector3 _lookAhead;
+    private Vector3 _lookAheadVelocity;
+    private CameraRigSettings _settings;
+    private CameraOcclusionFader _fader;
+
     private void Start()
     {
+        _camera = GetComponent<Camera>();
+        if (_camera) _baseFieldOfView = _camera.fieldOfView;
+        _fader = new CameraOcclusionFader(fadeColorProperty);
+
+        // Higher priority profiles are layered last
+        profiles.Sort((a, b) => a.priority.CompareTo(b.priority));
+
         if (!target) return;
 
+        if (!movement) movement = target.GetComponentInParent<PlayerMovement>();
+
         Vector3 angles = transform.eulerAngles;
         _yaw = angles.y;
         _pitch = angles.x;
 
         _smoothedTargetPosition = target.position;
         _targetHeight = target.position.y + targetHeightOffset;
+        _orbitPosition = transform.position;
+        _collisionDistance = distance;
 
         Cursor.lockState = CursorLockMode.Locked;
         Cursor.visible = false;
     }
 
+    private void OnDisable()
+    {
+        _fader?.RestoreAll();
+    }
+
     private void LateUpdate()
     {
         if (!target) return;
 
-        Vector2 look = InputManager.Instance.LookInput;
-        _yaw += look.x * rotationSpeed * sensitivityMultiplier * Time.deltaTime;
-        _pitch -= look.y * rotationSpeed * verticalSensitivityMultiplier * Time.deltaTime;
+        UpdateRig(InputManager.Instance.LookInput, Time.deltaTime);
+    }
+
+    // One camera update: framing profiles, orbit, collision and occlusion. CameraPerformanceTests times it directly.
+    public void UpdateRig(Vector2 look, float dt)
+    {
+        _settings = BlendProfiles(dt);
+
+        _yaw += look.x * rotationSpeed * sensitivityMultiplier * dt;
+        _pitch -= look.y * rotationSpeed * verticalSensitivityMultiplier * dt;
         _pitch = Mathf.Clamp(_pitch, minPitch, maxPitch);
 
-        _smoothedTargetPosition = Vector3.SmoothDamp(_smoothedTargetPosition, target.position, ref _smoothedTargetVelocity, smoothTime);
+        _smoothedTargetPosition = Vector3.SmoothDamp(_smoothedTargetPosition, target.position, ref _smoothedTargetVelocity, _settings.smoothTime);
+
+        _targetHeight = Mathf.SmoothDamp(_targetHeight, target.position.y + _settings.targetOffset.y, ref _currentTargetHeightVelocity, _settings.smoothTime);
 
-        _targetHeight = Mathf.SmoothDamp(_targetHeight, target.position.y + targetHeightOffset, ref _currentTargetHeightVelocity, smoothTime);
+        // Gliding leads the framing in the direction of travel
+        Vector3 velocity = movement ? movement.Velocity : Vector3.zero;
+        Vector3 lookAheadGoal = new Vector3(velocity.x, 0f, velocity.z) * _settings.lookAhead;
+        _lookAhead = Vector3.SmoothDamp(_lookAhead, lookAheadGoal, ref _lookAheadVelocity, 0.5f);
 
-        Vector3 targetPos = new Vector3(_smoothedTargetPosition.x, _targetHeight, _smoothedTargetPosition.z);
+        Quaternion yawRotation = Quaternion.Euler(0f, _yaw, 0f);
+        Vector3 planarOffset = yawRotation * new Vector3(_settings.targetOffset.x, 0f, _settings.targetOffset.z);
+        Vector3 targetPos = new Vector3(_smoothedTargetPosition.x, _targetHeight, _smoothedTargetPosition.z) + planarOffset + _lookAhead;
 
         Quaternion rotation = Quaternion.Euler(_pitch, _yaw, 0f);
-        Vector3 desiredPosition = targetPos - rotation * Vector3.forward * distance;
+        Vector3 desiredPosition = targetPos - rotation * Vector3.forward * _settings.distance;
 
-        transform.position = Vector3.SmoothDamp(transform.position, desiredPosition, ref _currentVelocity, smoothTime);
+        // The orbit keeps its damping; collision then clamps the damped position along the pivot -> camera line
+        _orbitPosition = Vector3.SmoothDamp(_orbitPosition, desiredPosition, ref _currentVelocity, _settings.smoothTime);
+        transform.position = ResolveCollision(targetPos, _orbitPosition, dt);
         transform.LookAt(targetPos);
+
+        if (_camera) _camera.fieldOfView = _settings.fieldOfView;
+
+        if (occlusionEnabled)
+        {
+            _fader.mask = occlusionMask;
+            _fader.ignoreRoot = movement ? movement.transform : target.root;
+            _fader.rayCount = occlusionRays;
+            _fader.probeSpread = occlusionProbeSpread;
+            _fader.fadedAlpha = fadedAlpha;
+            _fader.fadeSpeed = fadeSpeed;
+            _fader.Detect(targetPos, transform.position, transform.rotation);
+            _fader.Tick(dt);
+        }
+        else if (_fader.FadedCount > 0)
+        {
+            _fader.RestoreAll();
+        }
+    }
+
+    // SphereCast from the pivot towards the camera: pulls in almost instantly, eases back out slowly
+    private Vector3 ResolveCollision(Vector3 pivot, Vector3 cameraPosition, float dt)
+    {
+        Vector3 offset = cameraPosition - pivot;
+        float wanted = offset.magnitude;
+        if (wanted < 0.001f) return cameraPosition;
+
+        Vector3 direction = offset / wanted;
+        float allowed = wanted;
+
+        if (collisionEnabled && Physics.SphereCast(pivot, collisionRadius, direction, out RaycastHit hit, wanted, collisionMask, QueryTriggerInteraction.Ignore))
+            allowed = Mathf.Max(minDistance, hit.distance);
+
+        float smoothing = allowed < _collisionDistance ? pullInSmoothTime : easeOutSmoothTime;
+        _collisionDistance = Mathf.SmoothDamp(_collisionDistance, allowed, ref _collisionVelocity, smoothing, Mathf.Infinity, dt);
+
+        // Never further out than the wall this frame, whatever the smoothing says
+        float final = Mathf.Min(_collisionDistance, allowed);
+        return pivot + direction * final;
+    }
+
+    // Base orbit settings with every profile layered on top by its weight, lowest priority first
+    private CameraRigSettings BlendProfiles(float dt)
+    {
+        var settings = new CameraRigSettings
+        {
+            distance = distance,
+            fieldOfView = _baseFieldOfView,
+            targetOffset = new Vector3(0f, targetHeightOffset, 0f),
+            smoothTime = smoothTime,
+            lookAhead = 0f
+        };
+
+        for (int i = 0; i < profiles.Count; i++)
+        {
+            CameraRigProfile profile = profiles[i];
+            float goal = profilesEnabled && IsStateActive(profile.state) ? 1f : 0f;
+            profile.weight = Mathf.SmoothDamp(profile.weight, goal, ref profile.weightVelocity, profile.blendTime * 0.5f, Mathf.Infinity, dt);
+
+            if (profile.weight > 0.001f)
+                settings = CameraRigSettings.Lerp(settings, profile.Settings, profile.weight);
+        }
+
+        return settings;
+    }
+
+    private bool IsStateActive(CameraRigState state)
+    {
+        if (!movement) return false;
+
+        return state switch
+        {
+            CameraRigState.Crouch => movement.IsCrouching,
+            CameraRigState.Prone => movement.IsProning,
+            CameraRigState.Slide => movement.IsSliding,
+            CameraRigState.Roll => movement.IsRolling,
+            CameraRigState.Ledge => movement.IsOnLedge,
+            CameraRigState.Glide => movement.IsGliding,
+            CameraRigState.Ladder => movement.IsLadderClimbing,
+            _ => false
+        };
     }
 
     public void ChangeTarget(Transform newTarget)
     {
         target = newTarget;
-    }   
+
+        // The framing states and the occlusion ignore root follow the new target's character
+        movement = newTarget ? newTarget.GetComponentInParent<PlayerMovement>() : null;
+        _fader?.RestoreAll();
+    }
 }
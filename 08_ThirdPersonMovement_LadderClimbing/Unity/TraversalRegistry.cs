@@ -0,0 +1,312 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+public enum TraversalKind
+{
+    Ladder,
+    Ledge
+}
+
+// A ladder or ledge baked into plain data: the line the player moves along is origin + direction * t, t in [minT, maxT]
+public class TraversalFeature
+{
+    public TraversalKind kind;
+    public Transform root;
+    public Vector3 origin;     // Ladder: collider center at its base. Ledge: the ledge transform (what ledge movement measures from).
+    public Vector3 direction;  // Ladder: up. Ledge: the ledge's forward.
+    public float minT;
+    public float maxT;
+    public Vector3 normal;     // Ladder: its forward (climbable from both sides). Ledge: into the wall.
+    public float width;
+    public Vector3 exitPoint;  // Ladder: the "ExitPoint" child, or the root when there's none
+    public Bounds bounds;
+
+    public Vector3 Start => origin + direction * minT;
+    public Vector3 End => origin + direction * maxT;
+    public float TopY => Mathf.Max(Start.y, End.y);
+
+    public float ProjectT(Vector3 point) => Vector3.Dot(point - origin, direction);
+    public Vector3 PointAt(float t) => origin + direction * Mathf.Clamp(t, minT, maxT);
+}
+
+/* --------------------------------------------------------------------------
+   Ladders and ledges baked once per scene.
+
+   • Every object tagged ladderTag / ledgeTag becomes a TraversalFeature: a segment
+     with its normal, width and exit point, read from its collider and children once.
+     Movement uses the baked data instead of GetComponent / Find every frame.
+   • Features go in a spatial hash of cellSize cells, so a query only looks at the
+     features in the cells it touches.
+   • FindNearest sweeps a point along its motion for a look-ahead window and measures
+     the distance to each feature segment analytically (closest points between two
+     segments). That is how the player grabs a ledge or ladder a few frames early.
+   • Baked in Awake. Call Rebake after moving or spawning traversal objects.
+   • Created on demand by PlayerMovement when the scene has none.
+   -------------------------------------------------------------------------- */
+public class TraversalRegistry : MonoBehaviour
+{
+    public static TraversalRegistry Instance { get; private set; }
+
+    [SerializeField] private string ladderTag = "Ladder";
+    [SerializeField] private string ledgeTag = "Ledge";
+    [SerializeField] private float cellSize = 4f;
+    [SerializeField] private bool logBake = false;
+
+    private readonly List<TraversalFeature> features = new List<TraversalFeature>();
+    private readonly Dictionary<Transform, TraversalFeature> byRoot = new Dictionary<Transform, TraversalFeature>();
+    private readonly Dictionary<Vector3Int, List<int>> cells = new Dictionary<Vector3Int, List<int>>();
+    private int[] visitStamps = new int[0]; // Query number that last looked at each feature, so a feature in several cells is tested once
+    private int queryStamp;
+
+    public IReadOnlyList<TraversalFeature> Features => features;
+
+    [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.SubsystemRegistration)]
+    private static void ResetStatics() => Instance = null; // Play mode without domain reload
+
+    public static TraversalRegistry GetOrCreate()
+    {
+        if (Instance == null)
+            new GameObject("TraversalRegistry").AddComponent<TraversalRegistry>();
+        return Instance;
+    }
+
+    private void Awake()
+    {
+        if (Instance != null && Instance != this)
+        {
+            Destroy(this);
+            return;
+        }
+        Instance = this;
+        Rebake();
+    }
+
+    private void OnDestroy()
+    {
+        if (Instance == this)
+            Instance = null;
+    }
+
+    [ContextMenu("Rebake")]
+    public void Rebake()
+    {
+        features.Clear();
+        byRoot.Clear();
+        cells.Clear();
+
+        foreach (GameObject ladder in GameObject.FindGameObjectsWithTag(ladderTag))
+            Add(BakeLadder(ladder.transform));
+        foreach (GameObject ledge in GameObject.FindGameObjectsWithTag(ledgeTag))
+            Add(BakeLedge(ledge.transform));
+
+        visitStamps = new int[features.Count];
+        queryStamp = 0;
+
+        if (logBake)
+            Debug.Log($"[TraversalRegistry] Baked {features.Count} features into {cells.Count} cells");
+    }
+
+    // Baked data of a tagged object, baking it now if it appeared after the last Rebake
+    public TraversalFeature Get(Transform root, TraversalKind kind)
+    {
+        if (byRoot.TryGetValue(root, out TraversalFeature feature))
+            return feature;
+
+        feature = kind == TraversalKind.Ladder ? BakeLadder(root) : BakeLedge(root);
+        Add(feature);
+        System.Array.Resize(ref visitStamps, features.Count);
+        return feature;
+    }
+
+    // Nearest feature of 'kind' within maxDistance of the path from 'position' to 'position + motion'.
+    // 't' is where on the feature the closest approach happens.
+    public bool FindNearest(TraversalKind kind, Vector3 position, Vector3 motion, float maxDistance, out TraversalFeature nearest, out float t)
+    {
+        nearest = null;
+        t = 0f;
+        if (features.Count == 0)
+            return false;
+
+        Vector3 end = position + motion;
+        Vector3 margin = Vector3.one * maxDistance;
+        Vector3Int min = Cell(Vector3.Min(position, end) - margin);
+        Vector3Int max = Cell(Vector3.Max(position, end) + margin);
+
+        queryStamp++;
+        float best = maxDistance * maxDistance;
+
+        for (int x = min.x; x <= max.x; x++)
+        for (int y = min.y; y <= max.y; y++)
+        for (int z = min.z; z <= max.z; z++)
+        {
+            if (!cells.TryGetValue(new Vector3Int(x, y, z), out List<int> indices))
+                continue;
+
+            foreach (int index in indices)
+            {
+                if (visitStamps[index] == queryStamp)
+                    continue;
+                visitStamps[index] = queryStamp;
+
+                TraversalFeature feature = features[index];
+                if (feature.kind != kind)
+                    continue;
+
+                float distance = SegmentSegmentSqrDistance(position, end, feature.Start, feature.End, out _, out float featureS);
+                if (distance > best)
+                    continue;
+
+                best = distance;
+                nearest = feature;
+                t = Mathf.Lerp(feature.minT, feature.maxT, featureS);
+            }
+        }
+
+        return nearest != null;
+    }
+
+    private TraversalFeature BakeLadder(Transform root)
+    {
+        Collider collider = root.GetComponent<Collider>();
+        Bounds bounds = collider != null ? collider.bounds : new Bounds(root.position, Vector3.zero);
+        Transform exitPoint = root.Find("ExitPoint");
+
+        return new TraversalFeature
+        {
+            kind = TraversalKind.Ladder,
+            root = root,
+            origin = new Vector3(bounds.center.x, bounds.min.y, bounds.center.z),
+            direction = Vector3.up,
+            minT = 0f,
+            maxT = bounds.size.y,
+            normal = root.forward,
+            width = ExtentAlong(bounds, root.right) * 2f,
+            exitPoint = exitPoint != null ? exitPoint.position : root.position,
+            bounds = bounds
+        };
+    }
+
+    private TraversalFeature BakeLedge(Transform root)
+    {
+        Collider collider = root.GetComponent<Collider>();
+        Bounds bounds = collider != null ? collider.bounds : new Bounds(root.position, Vector3.zero);
+
+        // The walkable range is the collider's extent along the ledge, measured from the ledge transform like ledge movement does
+        Vector3 forward = root.forward;
+        float center = Vector3.Dot(bounds.center - root.position, forward);
+        float extent = ExtentAlong(bounds, forward);
+
+        return new TraversalFeature
+        {
+            kind = TraversalKind.Ledge,
+            root = root,
+            origin = root.position,
+            direction = forward,
+            minT = center - extent,
+            maxT = center + extent,
+            normal = -root.right,
+            width = ExtentAlong(bounds, root.right) * 2f,
+            exitPoint = root.position,
+            bounds = bounds
+        };
+    }
+
+    private void Add(TraversalFeature feature)
+    {
+        int index = features.Count;
+        features.Add(feature);
+        byRoot[feature.root] = feature;
+
+        Vector3Int min = Cell(feature.bounds.min);
+        Vector3Int max = Cell(feature.bounds.max);
+        for (int x = min.x; x <= max.x; x++)
+        for (int y = min.y; y <= max.y; y++)
+        for (int z = min.z; z <= max.z; z++)
+        {
+            var key = new Vector3Int(x, y, z);
+            if (!cells.TryGetValue(key, out List<int> indices))
+                cells[key] = indices = new List<int>();
+            indices.Add(index);
+        }
+    }
+
+    private Vector3Int Cell(Vector3 position)
+    {
+        return Vector3Int.FloorToInt(position / Mathf.Max(0.01f, cellSize));
+    }
+
+    private static float ExtentAlong(Bounds bounds, Vector3 axis)
+    {
+        Vector3 e = bounds.extents;
+        return Mathf.Abs(axis.x) * e.x + Mathf.Abs(axis.y) * e.y + Mathf.Abs(axis.z) * e.z;
+    }
+
+    // Squared distance between segments p1-q1 and p2-q2, with the closest points' parameters (0..1) on each
+    public static float SegmentSegmentSqrDistance(Vector3 p1, Vector3 q1, Vector3 p2, Vector3 q2, out float s, out float t)
+    {
+        Vector3 d1 = q1 - p1;
+        Vector3 d2 = q2 - p2;
+        Vector3 r = p1 - p2;
+        float a = Vector3.Dot(d1, d1);
+        float e = Vector3.Dot(d2, d2);
+        float f = Vector3.Dot(d2, r);
+        const float epsilon = 1e-6f;
+
+        if (a <= epsilon && e <= epsilon)
+        {
+            s = t = 0f;
+            return Vector3.Dot(r, r);
+        }
+
+        if (a <= epsilon)
+        {
+            s = 0f;
+            t = Mathf.Clamp01(f / e);
+        }
+        else
+        {
+            float c = Vector3.Dot(d1, r);
+            if (e <= epsilon)
+            {
+                t = 0f;
+                s = Mathf.Clamp01(-c / a);
+            }
+            else
+            {
+                float b = Vector3.Dot(d1, d2);
+                float denom = a * e - b * b;
+
+                s = denom > epsilon ? Mathf.Clamp01((b * f - c * e) / denom) : 0f;
+                t = (b * s + f) / e;
+
+                if (t < 0f)
+                {
+                    t = 0f;
+                    s = Mathf.Clamp01(-c / a);
+                }
+                else if (t > 1f)
+                {
+                    t = 1f;
+                    s = Mathf.Clamp01((b - c) / a);
+                }
+            }
+        }
+
+        Vector3 between = (p1 + d1 * s) - (p2 + d2 * t);
+        return Vector3.Dot(between, between);
+    }
+
+    #if UNITY_EDITOR
+    private void OnDrawGizmosSelected()
+    {
+        foreach (TraversalFeature feature in features)
+        {
+            Gizmos.color = feature.kind == TraversalKind.Ladder ? Color.yellow : Color.cyan;
+            Gizmos.DrawLine(feature.Start, feature.End);
+            Gizmos.DrawLine(feature.Start, feature.Start + feature.normal * 0.5f);
+            if (feature.kind == TraversalKind.Ladder)
+                Gizmos.DrawWireSphere(feature.exitPoint, 0.15f);
+        }
+    }
+    #endif
+}
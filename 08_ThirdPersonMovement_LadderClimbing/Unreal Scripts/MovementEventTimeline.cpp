@@ -0,0 +1,125 @@
+#include "MovementEventTimeline.h"
+
+UMovementEventTimeline::UMovementEventTimeline()
+{
+    auto MakeEvent = [](EMovementEvent Type, float Time, bool bSync)
+    {
+        FMovementTimedEvent Event;
+        Event.Type = Type;
+        Event.Time = Time;
+        Event.bSyncToAnimation = bSync;
+        return Event;
+    };
+
+    FMovementActionTimeline& Jump = Actions.AddDefaulted_GetRef();
+    Jump.Action = EMovementAction::Jump;
+    Jump.Events.Add(MakeEvent(EMovementEvent::JumpImpulse, 0.15f, true));
+
+    FMovementActionTimeline& AirJump = Actions.AddDefaulted_GetRef();
+    AirJump.Action = EMovementAction::AirJump;
+    AirJump.Events.Add(MakeEvent(EMovementEvent::FlipImpulse, 0.15f, true));
+    AirJump.Events.Add(MakeEvent(EMovementEvent::FlipEnd, 0.55f, true));
+
+    FMovementActionTimeline& Prone = Actions.AddDefaulted_GetRef();
+    Prone.Action = EMovementAction::ProneTransition;
+    Prone.Events.Add(MakeEvent(EMovementEvent::ProneTransitionStart, 0.f, false));
+    Prone.Events.Add(MakeEvent(EMovementEvent::ProneTransitionEnd, 1.f, true));
+}
+
+void FMovementEventPlayer::Init(const UMovementEventTimeline& Timeline)
+{
+    Events.Reset();
+    Playing.Reset();
+    MaxSyncDelay = Timeline.MaxSyncDelay;
+
+    // Sorted once, so a tick only looks at the next event of each action
+    for (const FMovementActionTimeline& ActionTimeline : Timeline.Actions)
+    {
+        TArray<FMovementTimedEvent>& Sorted = Events.Add(ActionTimeline.Action, ActionTimeline.Events);
+        Sorted.StableSort([](const FMovementTimedEvent& A, const FMovementTimedEvent& B) { return A.Time < B.Time; });
+    }
+}
+
+void FMovementEventPlayer::Play(EMovementAction Action)
+{
+    Stop(Action);
+    const TArray<FMovementTimedEvent>* ActionEvents = Events.Find(Action);
+    if (ActionEvents && ActionEvents->Num() > 0)
+    {
+        FMovementEventPlayback& Playback = Playing.AddDefaulted_GetRef();
+        Playback.Action = Action;
+    }
+}
+
+void FMovementEventPlayer::Stop(EMovementAction Action)
+{
+    Playing.RemoveAll([Action](const FMovementEventPlayback& Playback) { return Playback.Action == Action; });
+}
+
+bool FMovementEventPlayer::IsPlaying(EMovementAction Action) const
+{
+    return Playing.ContainsByPredicate([Action](const FMovementEventPlayback& Playback) { return Playback.Action == Action; });
+}
+
+void FMovementEventPlayer::Advance(float DeltaTime, bool bSyncToAnimation)
+{
+    Due.Reset();
+
+    for (int32 i = Playing.Num() - 1; i >= 0; --i)
+    {
+        FMovementEventPlayback& Playback = Playing[i];
+        const TArray<FMovementTimedEvent>& ActionEvents = Events[Playback.Action];
+        Playback.Time += DeltaTime;
+
+        while (ActionEvents.IsValidIndex(Playback.NextEvent))
+        {
+            const FMovementTimedEvent& Next = ActionEvents[Playback.NextEvent];
+            const bool bWaitingForNotify = bSyncToAnimation && Next.bSyncToAnimation && Playback.Time < Next.Time + MaxSyncDelay;
+            if (Playback.Time < Next.Time || bWaitingForNotify)
+                break;
+
+            Due.Add(Next.Type);
+            ++Playback.NextEvent;
+        }
+
+        if (!ActionEvents.IsValidIndex(Playback.NextEvent))
+            Playing.RemoveAt(i);
+    }
+
+    // Broadcast after the bookkeeping, so a handler can Play or Stop
+    for (EMovementEvent Type : Due)
+        OnEvent.Broadcast(Type);
+}
+
+bool FMovementEventPlayer::Notify(EMovementEvent Type)
+{
+    for (int32 i = 0; i < Playing.Num(); ++i)
+    {
+        FMovementEventPlayback& Playback = Playing[i];
+        const TArray<FMovementTimedEvent>& ActionEvents = Events[Playback.Action];
+        if (!ActionEvents.IsValidIndex(Playback.NextEvent))
+            continue;
+
+        const FMovementTimedEvent& Next = ActionEvents[Playback.NextEvent];
+        if (!Next.bSyncToAnimation || Next.Type != Type)
+            continue;
+
+        if (!ActionEvents.IsValidIndex(++Playback.NextEvent))
+            Playing.RemoveAt(i);
+
+        OnEvent.Broadcast(Type);
+        return true;
+    }
+    return false;
+}
+
+void FMovementEventPlayer::Restore(const TArray<FMovementEventPlayback>& InPlaying)
+{
+    Playing.Reset();
+    for (const FMovementEventPlayback& Playback : InPlaying)
+    {
+        const TArray<FMovementTimedEvent>* ActionEvents = Events.Find(Playback.Action);
+        if (ActionEvents && ActionEvents->IsValidIndex(Playback.NextEvent))
+            Playing.Add(Playback);
+    }
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "MovementEventTimeline.generated.h"
+
+// Actions that play a timeline of movement events when they start
+UENUM(BlueprintType)
+enum class EMovementAction : uint8
+{
+    Jump,
+    AirJump,
+    ProneTransition
+};
+
+// What APlayerCharacter does when an event fires. The notify of the same name can sync it (ApplyJumpForce, TriggerFlip...).
+UENUM(BlueprintType)
+enum class EMovementEvent : uint8
+{
+    JumpImpulse,
+    FlipImpulse,
+    FlipEnd,
+    ProneTransitionStart,
+    ProneTransitionEnd
+};
+
+USTRUCT(BlueprintType)
+struct FMovementTimedEvent
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+    EMovementEvent Type = EMovementEvent::JumpImpulse;
+
+    // Seconds after the action starts, on the simulation clock
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+    float Time = 0.f;
+
+    // While the mesh is rendered, wait for the event's notify instead (at most MaxSyncDelay past Time)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+    bool bSyncToAnimation = false;
+};
+
+USTRUCT(BlueprintType)
+struct FMovementActionTimeline
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+    EMovementAction Action = EMovementAction::Jump;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+    TArray<FMovementTimedEvent> Events;
+};
+
+// How far a playing action has got. Part of FMovementSimState, so snapshots and replays restore pending events.
+USTRUCT(BlueprintType)
+struct FMovementEventPlayback
+{
+    GENERATED_BODY()
+
+    UPROPERTY() EMovementAction Action = EMovementAction::Jump;
+    UPROPERTY() float Time = 0.f;
+    UPROPERTY() int32 NextEvent = 0;
+};
+
+/**
+ * When the movement events of each action fire. The defaults match the notifies' timing in the animations.
+ */
+UCLASS(BlueprintType)
+class MECHANICS_TEST_LVN_API UMovementEventTimeline : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    UMovementEventTimeline();
+
+    // How long past its time a synced event waits for its notify before firing anyway
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Timeline")
+    float MaxSyncDelay = 0.1f;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Timeline")
+    TArray<FMovementActionTimeline> Actions;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMovementEvent, EMovementEvent);
+
+/* --------------------------------------------------------------------------
+   Fires movement events from the simulation clock.
+
+   • Play starts an action's timeline. Advance, called once per movement tick, fires
+     every event whose time has come, so gameplay doesn't need the animation to run
+     (URO skipping frames, a low LOD, a dedicated server with no animation at all).
+   • With sync on, an event marked bSyncToAnimation waits for its notify (Notify)
+     instead, but never longer than MaxSyncDelay past its time. A notify that comes
+     early fires it early.
+   • APlayerCharacter only syncs in variable step while the mesh is rendered. Fixed
+     step never does, so replays stay deterministic.
+   • Capture / Restore hold the playing actions for FMovementSimState.
+   -------------------------------------------------------------------------- */
+class MECHANICS_TEST_LVN_API FMovementEventPlayer
+{
+public:
+    void Init(const UMovementEventTimeline& Timeline);
+
+    void Play(EMovementAction Action); // Restarts the action's timeline, actions without one (or with an empty one) do nothing
+    void Stop(EMovementAction Action);
+    bool IsPlaying(EMovementAction Action) const;
+
+    void Advance(float DeltaTime, bool bSyncToAnimation);
+    bool Notify(EMovementEvent Type); // False when no synced event is waiting for it
+
+    TArray<FMovementEventPlayback> Capture() const { return Playing; }
+    void Restore(const TArray<FMovementEventPlayback>& InPlaying);
+
+    // Broadcast for every event that fires
+    FOnMovementEvent OnEvent;
+
+private:
+    TMap<EMovementAction, TArray<FMovementTimedEvent>> Events; // Sorted by time
+    TArray<FMovementEventPlayback> Playing;
+    TArray<EMovementEvent> Due;
+    float MaxSyncDelay = 0.f;
+};
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MovementStateMachine.h"
+#include "MovementEventTimeline.h"
+#include "MovementSimulation.generated.h"
+
+// Buttons carried by FMovementTickInput, as bit indices of Pressed / Released
+enum class EMovementButton : uint8
+{
+    Run,
+    Dance,
+    Jump,
+    Crouch,
+    Prone,
+    Roll,
+    Glide,
+    Climb
+};
+
+inline int32 MovementButtonBit(EMovementButton Button) { return 1 << static_cast<int32>(Button); }
+
+// Everything one movement tick reads from the player. In fixed-step mode this is what gets recorded and replayed.
+USTRUCT(BlueprintType)
+struct FMovementTickInput
+{
+    GENERATED_BODY()
+
+    UPROPERTY() FVector2D Move = FVector2D::ZeroVector;
+    UPROPERTY() float CameraYaw = 0.f;
+    UPROPERTY() int32 Pressed = 0;  // EMovementButton bits pressed since the last tick
+    UPROPERTY() int32 Released = 0; // EMovementButton bits released since the last tick
+
+    bool WasPressed(EMovementButton Button) const { return (Pressed & MovementButtonBit(Button)) != 0; }
+    bool WasReleased(EMovementButton Button) const { return (Released & MovementButtonBit(Button)) != 0; }
+};
+
+// The part of APlayerCharacter (and its movement component) that changes from tick to tick.
+// Capturing and restoring it puts the character back exactly where a recorded trace started.
+USTRUCT(BlueprintType)
+struct FMovementSimState
+{
+    GENERATED_BODY()
+
+    UPROPERTY() FVector Location = FVector::ZeroVector;
+    UPROPERTY() FRotator Rotation = FRotator::ZeroRotator;
+    UPROPERTY() FVector Velocity = FVector::ZeroVector;
+    UPROPERTY() uint8 MovementMode = 0;
+    UPROPERTY() float GravityScale = 1.f;
+    UPROPERTY() float MaxWalkSpeed = 0.f;
+    UPROPERTY() float CapsuleHalfHeight = 0.f;
+
+    UPROPERTY() FVector2D MovementInput = FVector2D::ZeroVector;
+    UPROPERTY() int32 JumpCount = 0;
+    UPROPERTY() float JumpBufferTimer = 0.f;
+    UPROPERTY() FVector SlideVelocity = FVector::ZeroVector;
+    UPROPERTY() float SlideFallTimer = 0.f;
+    UPROPERTY() float SlideStartTimer = 0.f;
+    UPROPERTY() float RollTimer = 0.f;
+    UPROPERTY() FVector RollDirection = FVector::ZeroVector;
+    UPROPERTY() float CurrentRollSpeed = 0.f;
+    UPROPERTY() float OriginalGravityScale = 1.f;
+    UPROPERTY() float OriginalGravityScaleBeforeGlide = 1.f;
+
+    UPROPERTY() EMovementState State = EMovementState::Standing;
+    UPROPERTY() bool bIsRunning = false;
+    UPROPERTY() bool bIsDancing = false;
+    UPROPERTY() bool bIsJumping = false;
+    UPROPERTY() bool bIsFlipping = false;
+    UPROPERTY() bool bGlideInputHeld = false;
+    UPROPERTY() bool bJumpInputQueued = false;
+    UPROPERTY() bool bJumpPending = false;
+    UPROPERTY() bool bIsInProneTransition = false;
+
+    UPROPERTY() TArray<FMovementEventPlayback> Events; // Jump / flip / prone timelines still playing
+};
+
+// A recorded run: the state it started from, one input per tick, and where it ended
+USTRUCT(BlueprintType)
+struct FMovementTrace
+{
+    GENERATED_BODY()
+
+    UPROPERTY() int32 TickRate = 60;
+    UPROPERTY() FMovementSimState Start;
+    UPROPERTY() TArray<FMovementTickInput> Inputs;
+    UPROPERTY() FVector EndLocation = FVector::ZeroVector;
+
+    // The frame of live input a player following this trace would have given between PreviousTime and Time
+    // (seconds from the start): stick and camera of the latest tick, buttons of every tick in between.
+    // Feeding it through the fixed-step clock plays the trace back as if it was performed at another frame rate.
+    FMovementTickInput SampleFrame(double PreviousTime, double Time) const
+    {
+        if (Inputs.Num() == 0) return FMovementTickInput();
+
+        const int32 First = FMath::Max(0, FMath::CeilToInt32(PreviousTime * TickRate));
+        const int32 Last = FMath::Clamp(FMath::CeilToInt32(Time * TickRate) - 1, 0, Inputs.Num() - 1);
+
+        FMovementTickInput Frame;
+        Frame.Move = Inputs[Last].Move;
+        Frame.CameraYaw = Inputs[Last].CameraYaw;
+        for (int32 i = First; i <= Last; ++i)
+        {
+            Frame.Pressed |= Inputs[i].Pressed;
+            Frame.Released |= Inputs[i].Released;
+        }
+        return Frame;
+    }
+
+    int32 CountButtonChanges() const
+    {
+        int32 Count = 0;
+        for (const FMovementTickInput& Input : Inputs)
+            Count += FMath::CountBits(static_cast<uint32>(Input.Pressed)) + FMath::CountBits(static_cast<uint32>(Input.Released));
+        return Count;
+    }
+};
+
+/* --------------------------------------------------------------------------
+   Fixed-step accumulator.
+
+   • Frame time is added up and spent in whole steps, so the simulation always
+     advances by the same dt whatever the frame rate.
+   • The time left over is the fraction of a step the frame sits between the last two
+     ticks (GetAlpha), used to interpolate the mesh.
+   • A frame never runs more than MaxStepsPerFrame ticks. After a long hitch the rest
+     is dropped instead of trying to catch up.
+   -------------------------------------------------------------------------- */
+struct FFixedStepClock
+{
+    float Step = 1.f / 60.f;
+    int32 MaxStepsPerFrame = 8;
+
+    FFixedStepClock() = default;
+    FFixedStepClock(int32 TickRate, int32 InMaxStepsPerFrame)
+        : Step(1.f / FMath::Max(1, TickRate)), MaxStepsPerFrame(FMath::Max(1, InMaxStepsPerFrame)) {}
+
+    // Returns how many ticks to run this frame
+    int32 Advance(float DeltaTime)
+    {
+        Accumulator += DeltaTime;
+
+        int32 Steps = FMath::FloorToInt32(Accumulator / Step);
+        if (Steps > MaxStepsPerFrame)
+        {
+            Steps = MaxStepsPerFrame;
+            Accumulator = 0.0;
+        }
+        else
+        {
+            Accumulator -= Steps * static_cast<double>(Step);
+        }
+        return Steps;
+    }
+
+    float GetAlpha() const { return static_cast<float>(Accumulator / Step); }
+
+private:
+    double Accumulator = 0.0; // Double, so a long session doesn't lose precision
+};
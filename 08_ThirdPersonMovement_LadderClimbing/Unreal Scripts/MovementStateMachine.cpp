@@ -0,0 +1,260 @@
+#include "MovementStateMachine.h"
+
+FMovementStateMachine::FMovementStateMachine(int32 HistoryCapacity)
+{
+    History.SetNum(FMath::Max(1, HistoryCapacity));
+}
+
+// ========== BUILDING ==========
+
+FMovementStateMachine& FMovementStateMachine::AddState(EMovementState State, TOptional<EMovementState> Parent)
+{
+    checkf(!Current.IsSet(), TEXT("States can't be added once the machine has started"));
+    checkf(!Nodes.Contains(State), TEXT("State %s is already declared"), *LexToString(State));
+    checkf(!Parent.IsSet() || Nodes.Contains(Parent.GetValue()), TEXT("The parent of %s has to be declared first"), *LexToString(State));
+
+    if (Parent.IsSet())
+        Nodes[Parent.GetValue()].bIsLeaf = false;
+
+    Nodes.Add(State).Parent = Parent;
+    return *this;
+}
+
+FMovementStateMachine& FMovementStateMachine::OnEnter(EMovementState State, FStateHook Hook)
+{
+    Nodes.FindChecked(State).Enter = MoveTemp(Hook);
+    return *this;
+}
+
+FMovementStateMachine& FMovementStateMachine::OnExit(EMovementState State, FStateHook Hook)
+{
+    Nodes.FindChecked(State).Exit = MoveTemp(Hook);
+    return *this;
+}
+
+FMovementStateMachine& FMovementStateMachine::OnTick(EMovementState State, FTickHook Hook)
+{
+    Nodes.FindChecked(State).Tick = MoveTemp(Hook);
+    return *this;
+}
+
+FMovementStateMachine& FMovementStateMachine::AddTransition(EMovementState From, EMovementState To, FGuard Guard)
+{
+    checkf(Nodes.Contains(From), TEXT("Unknown state %s"), *LexToString(From));
+    checkf(Nodes.Contains(To), TEXT("Unknown state %s"), *LexToString(To));
+
+    Edges.FindOrAdd(From).Add({ To, MoveTemp(Guard) });
+    return *this;
+}
+
+bool FMovementStateMachine::Validate(TArray<FString>& OutErrors) const
+{
+    const int32 ErrorsBefore = OutErrors.Num();
+
+    for (const TPair<EMovementState, TArray<FEdge>>& Pair : Edges)
+    {
+        for (const FEdge& Edge : Pair.Value)
+        {
+            if (!Nodes[Edge.To].bIsLeaf)
+                OutErrors.Add(FString::Printf(TEXT("%s -> %s targets a state with children"), *LexToString(Pair.Key), *LexToString(Edge.To)));
+        }
+    }
+
+    return OutErrors.Num() == ErrorsBefore;
+}
+
+// ========== RUNNING ==========
+
+bool FMovementStateMachine::Start(EMovementState Initial)
+{
+    TArray<FString> Errors;
+    if (!ensureMsgf(Validate(Errors), TEXT("Invalid movement state table: %s"), *FString::Join(Errors, TEXT(", "))))
+        return false;
+
+    return Reset(Initial, TEXT("Start"));
+}
+
+bool FMovementStateMachine::Reset(EMovementState State, FName Reason)
+{
+    const FNode* Node = Nodes.Find(State);
+    if (!ensureMsgf(Node && Node->bIsLeaf, TEXT("The movement state machine can only be in a declared leaf, not %s"), *LexToString(State)))
+        return false;
+
+    const EMovementState From = Current.Get(State);
+    Current = State;
+    Record(From, State, Reason);
+    return true;
+}
+
+bool FMovementStateMachine::IsIn(EMovementState State) const
+{
+    for (TOptional<EMovementState> Node = Current; Node.IsSet(); Node = Nodes[Node.GetValue()].Parent)
+    {
+        if (Node.GetValue() == State)
+            return true;
+    }
+    return false;
+}
+
+bool FMovementStateMachine::CanTransition(EMovementState To) const
+{
+    return Current.IsSet() && FindEdge(Current.GetValue(), To, true) != nullptr;
+}
+
+bool FMovementStateMachine::TryTransition(EMovementState To, FName Reason)
+{
+    if (!ensureMsgf(Current.IsSet(), TEXT("The movement state machine hasn't been started")))
+        return false;
+    if (!ensureMsgf(!bTransitioning, TEXT("Transition to %s requested from inside an enter / exit hook"), *LexToString(To)))
+        return false;
+
+    const EMovementState From = Current.GetValue();
+    if (From == To || !FindEdge(From, To, true))
+        return false;
+
+    const TOptional<EMovementState> Common = CommonAncestor(From, To);
+
+    bTransitioning = true;
+    for (TOptional<EMovementState> Node = From; Node != Common; Node = Nodes[Node.GetValue()].Parent)
+    {
+        if (const FStateHook& Exit = Nodes[Node.GetValue()].Exit)
+            Exit(To);
+    }
+
+    Current = To;
+    EnterDown(To, Common, From);
+    bTransitioning = false;
+
+    OnChanged.Broadcast(Record(From, To, Reason));
+    return true;
+}
+
+void FMovementStateMachine::Tick(float DeltaTime)
+{
+    if (!ensureMsgf(Current.IsSet(), TEXT("The movement state machine hasn't been started")))
+        return;
+
+    ++Ticks;
+    for (TOptional<EMovementState> Node = Current; Node.IsSet(); Node = Nodes[Node.GetValue()].Parent)
+    {
+        if (const FTickHook& TickHook = Nodes[Node.GetValue()].Tick)
+        {
+            TickHook(DeltaTime);
+            return;
+        }
+    }
+}
+
+// ========== DEBUGGING / TABLE CHECKS ==========
+
+TArray<FMovementStateTransition> FMovementStateMachine::GetHistory() const
+{
+    TArray<FMovementStateTransition> Result;
+    Result.Reserve(HistoryCount);
+    for (int32 i = 0; i < HistoryCount; ++i)
+        Result.Add(History[(HistoryStart + i) % History.Num()]);
+    return Result;
+}
+
+TArray<EMovementState> FMovementStateMachine::GetLeaves() const
+{
+    TArray<EMovementState> Leaves;
+    for (const TPair<EMovementState, FNode>& Pair : Nodes)
+    {
+        if (Pair.Value.bIsLeaf)
+            Leaves.Add(Pair.Key);
+    }
+    return Leaves;
+}
+
+bool FMovementStateMachine::HasEdge(EMovementState From, EMovementState To) const
+{
+    return Nodes.Contains(From) && FindEdge(From, To, false) != nullptr;
+}
+
+bool FMovementStateMachine::IsReachable(EMovementState From, EMovementState To) const
+{
+    const TArray<EMovementState> Leaves = GetLeaves();
+    TSet<EMovementState> Visited = { From };
+    TArray<EMovementState> Open = { From };
+
+    for (int32 i = 0; i < Open.Num(); ++i)
+    {
+        const EMovementState State = Open[i];
+        if (State == To)
+            return true;
+
+        for (EMovementState Next : Leaves)
+        {
+            if (!Visited.Contains(Next) && HasEdge(State, Next))
+            {
+                Visited.Add(Next);
+                Open.Add(Next);
+            }
+        }
+    }
+    return false;
+}
+
+// ========== INTERNALS ==========
+
+const FMovementStateMachine::FEdge* FMovementStateMachine::FindEdge(EMovementState From, EMovementState To, bool bCheckGuard) const
+{
+    for (TOptional<EMovementState> Node = From; Node.IsSet(); Node = Nodes[Node.GetValue()].Parent)
+    {
+        const TArray<FEdge>* NodeEdges = Edges.Find(Node.GetValue());
+        if (!NodeEdges)
+            continue;
+
+        for (const FEdge& Edge : *NodeEdges)
+        {
+            if (Edge.To == To && (!bCheckGuard || !Edge.Guard || Edge.Guard()))
+                return &Edge;
+        }
+    }
+    return nullptr;
+}
+
+TOptional<EMovementState> FMovementStateMachine::CommonAncestor(EMovementState A, EMovementState B) const
+{
+    for (TOptional<EMovementState> X = A; X.IsSet(); X = Nodes[X.GetValue()].Parent)
+    {
+        for (TOptional<EMovementState> Y = B; Y.IsSet(); Y = Nodes[Y.GetValue()].Parent)
+        {
+            if (X == Y)
+                return X;
+        }
+    }
+    return {};
+}
+
+// Runs the enter hooks from just below Stop down to State
+void FMovementStateMachine::EnterDown(EMovementState State, const TOptional<EMovementState>& Stop, EMovementState Previous)
+{
+    if (Stop.IsSet() && Stop.GetValue() == State)
+        return;
+
+    const FNode& Node = Nodes[State];
+    if (Node.Parent.IsSet())
+        EnterDown(Node.Parent.GetValue(), Stop, Previous);
+
+    if (Node.Enter)
+        Node.Enter(Previous);
+}
+
+FMovementStateTransition FMovementStateMachine::Record(EMovementState From, EMovementState To, FName Reason)
+{
+    FMovementStateTransition Transition;
+    Transition.From = From;
+    Transition.To = To;
+    Transition.Reason = Reason;
+    Transition.Tick = Ticks;
+
+    History[(HistoryStart + HistoryCount) % History.Num()] = Transition;
+    if (HistoryCount < History.Num())
+        ++HistoryCount;
+    else
+        HistoryStart = (HistoryStart + 1) % History.Num();
+
+    return Transition;
+}
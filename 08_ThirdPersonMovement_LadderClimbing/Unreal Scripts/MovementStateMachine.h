@@ -0,0 +1,124 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MovementStateMachine.generated.h"
+
+// States of APlayerCharacter's movement state machine. Locomotion, Crouched and Traversal are parents,
+// the rest are the leaves the character is actually in.
+UENUM(BlueprintType)
+enum class EMovementState : uint8
+{
+    Locomotion,
+    Standing,
+    Crouched,
+    Crouching,
+    Proning,
+    Sliding,
+    Rolling,
+    Gliding,
+    Traversal,
+    OnLedge,
+    LadderClimbing,
+    LadderExiting
+};
+
+inline FString LexToString(EMovementState State)
+{
+    return StaticEnum<EMovementState>()->GetNameStringByValue(static_cast<int64>(State));
+}
+
+USTRUCT(BlueprintType)
+struct FMovementStateTransition
+{
+    GENERATED_BODY()
+
+    UPROPERTY() EMovementState From = EMovementState::Standing;
+    UPROPERTY() EMovementState To = EMovementState::Standing;
+    UPROPERTY() FName Reason;
+    UPROPERTY() int64 Tick = 0; // Value of GetTicks() when it happened
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMovementStateChanged, const FMovementStateTransition&);
+
+/* --------------------------------------------------------------------------
+   Hierarchical movement state machine.
+
+   • States form a tree and the machine is always in exactly one leaf. IsIn is true for
+     that leaf and for every parent above it.
+   • Transitions are declared up front as guarded edges. An edge declared on a parent
+     applies to all of its children. TryTransition only follows a declared edge whose
+     guard passes, so a transition missing from the table can't happen.
+   • Going from A to B runs the exit hooks from A up to their common parent, then the
+     enter hooks from below it down to B.
+   • Tick runs the current leaf's tick hook, or the closest parent's when the leaf has none.
+   • The last transitions are kept for GetHistory.
+   -------------------------------------------------------------------------- */
+class MECHANICS_TEST_LVN_API FMovementStateMachine
+{
+public:
+    using FStateHook = TFunction<void(EMovementState)>; // Enter receives the leaf being left, exit the leaf being entered
+    using FTickHook = TFunction<void(float)>;
+    using FGuard = TFunction<bool()>;
+
+    explicit FMovementStateMachine(int32 HistoryCapacity = 32);
+
+    // Building the table
+    FMovementStateMachine& AddState(EMovementState State, TOptional<EMovementState> Parent = {});
+    FMovementStateMachine& OnEnter(EMovementState State, FStateHook Hook);
+    FMovementStateMachine& OnExit(EMovementState State, FStateHook Hook);
+    FMovementStateMachine& OnTick(EMovementState State, FTickHook Hook);
+    FMovementStateMachine& AddTransition(EMovementState From, EMovementState To, FGuard Guard = nullptr); // 'To' has to be a leaf
+
+    // Checks what Start needs from the table, adding a line per problem
+    bool Validate(TArray<FString>& OutErrors) const;
+
+    // Running
+    bool Start(EMovementState Initial);
+    bool Reset(EMovementState State, FName Reason = TEXT("Reset")); // No hooks or guards, for restoring snapshots
+    bool IsStarted() const { return Current.IsSet(); }
+    EMovementState GetCurrent() const { return Current.Get(EMovementState::Standing); }
+    bool IsIn(EMovementState State) const;
+    bool CanTransition(EMovementState To) const;
+    bool TryTransition(EMovementState To, FName Reason);
+    void Tick(float DeltaTime);
+    int64 GetTicks() const { return Ticks; }
+
+    // Broadcast after every transition (not for Start / Reset)
+    FOnMovementStateChanged OnChanged;
+
+    // Debugging / table checks
+    TArray<FMovementStateTransition> GetHistory() const; // Oldest first
+    TArray<EMovementState> GetLeaves() const;
+    bool HasEdge(EMovementState From, EMovementState To) const; // Ignores guards
+    bool IsReachable(EMovementState From, EMovementState To) const; // Through declared edges, ignoring guards
+
+private:
+    struct FNode
+    {
+        TOptional<EMovementState> Parent;
+        bool bIsLeaf = true;
+        FStateHook Enter;
+        FStateHook Exit;
+        FTickHook Tick;
+    };
+
+    struct FEdge
+    {
+        EMovementState To;
+        FGuard Guard;
+    };
+
+    const FEdge* FindEdge(EMovementState From, EMovementState To, bool bCheckGuard) const;
+    TOptional<EMovementState> CommonAncestor(EMovementState A, EMovementState B) const;
+    void EnterDown(EMovementState State, const TOptional<EMovementState>& Stop, EMovementState Previous);
+    FMovementStateTransition Record(EMovementState From, EMovementState To, FName Reason);
+
+    TMap<EMovementState, FNode> Nodes;
+    TMap<EMovementState, TArray<FEdge>> Edges;
+    TArray<FMovementStateTransition> History;
+    int32 HistoryStart = 0;
+    int32 HistoryCount = 0;
+    TOptional<EMovementState> Current;
+    int64 Ticks = 0;
+    bool bTransitioning = false;
+};
@@ -0,0 +1,52 @@
+#include "MovementStateTable.h"
+
+void FMovementStateTable::Build(FMovementStateMachine& Machine, IMovementStateHooks& Hooks)
+{
+    using S = EMovementState;
+
+    auto Add = [&Machine, &Hooks](S State, TOptional<S> Parent, bool bTicks)
+    {
+        Machine
+            .AddState(State, Parent)
+            .OnEnter(State, [&Hooks, State](S From) { Hooks.OnEnterState(State, From); })
+            .OnExit(State, [&Hooks, State](S To) { Hooks.OnExitState(State, To); });
+
+        if (bTicks)
+            Machine.OnTick(State, [&Hooks, State](float DeltaTime) { Hooks.OnTickState(State, DeltaTime); });
+    };
+
+    Add(S::Locomotion, {}, true);
+    Add(S::Standing, S::Locomotion, false);
+    Add(S::Crouched, S::Locomotion, false);
+    Add(S::Crouching, S::Crouched, false);
+    Add(S::Proning, S::Crouched, false);
+    Add(S::Sliding, S::Locomotion, true);
+    Add(S::Rolling, S::Locomotion, true);
+    Add(S::Gliding, S::Locomotion, true);
+    Add(S::Traversal, {}, false);
+    Add(S::OnLedge, S::Traversal, true);
+    Add(S::LadderClimbing, S::Traversal, true);
+    Add(S::LadderExiting, S::Traversal, true);
+
+    // Every transition the character can make. Anything not listed here can't happen.
+    Machine
+        .AddTransition(S::Standing, S::Crouching, [&Hooks] { return Hooks.IsGrounded(); })
+        .AddTransition(S::Standing, S::Sliding, [&Hooks] { return Hooks.CanStartSlide(); })
+        .AddTransition(S::Standing, S::Rolling, [&Hooks] { return Hooks.IsGrounded(); })
+        .AddTransition(S::Standing, S::Gliding, [&Hooks] { return Hooks.CanStartGlide(); })
+        .AddTransition(S::Standing, S::OnLedge, [&Hooks] { return Hooks.CanGrabLedge(); })
+        .AddTransition(S::Standing, S::LadderClimbing, [&Hooks] { return Hooks.CanGrabLadder(); })
+        .AddTransition(S::Crouching, S::Standing, [&Hooks] { return Hooks.CanStandUp(); })
+        .AddTransition(S::Crouching, S::Proning)
+        .AddTransition(S::Proning, S::Crouching, [&Hooks] { return Hooks.CanCrouchUpFromProne(); })
+        .AddTransition(S::Sliding, S::Standing, [&Hooks] { return Hooks.CanStandUp() && Hooks.CanCrouchUpFromProne(); })
+        .AddTransition(S::Sliding, S::Crouching, [&Hooks] { return Hooks.CanCrouchUpFromProne(); })
+        .AddTransition(S::Sliding, S::Proning)
+        .AddTransition(S::Rolling, S::Standing, [&Hooks] { return Hooks.CanStandUp(); })
+        .AddTransition(S::Rolling, S::Crouching)
+        .AddTransition(S::Gliding, S::Standing)
+        .AddTransition(S::OnLedge, S::Standing)
+        .AddTransition(S::LadderClimbing, S::Standing)
+        .AddTransition(S::LadderClimbing, S::LadderExiting)
+        .AddTransition(S::LadderExiting, S::Standing);
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MovementStateMachine.h"
+
+// What the movement state table needs from its owner: the guards on its transitions and the hooks its states run
+class MECHANICS_TEST_LVN_API IMovementStateHooks
+{
+public:
+    virtual ~IMovementStateHooks() = default;
+
+    virtual bool IsGrounded() const = 0;
+    virtual bool CanStartSlide() const = 0;
+    virtual bool CanStartGlide() const = 0;
+    virtual bool CanGrabLedge() const = 0;
+    virtual bool CanGrabLadder() const = 0;
+    virtual bool CanStandUp() const = 0;
+    virtual bool CanCrouchUpFromProne() const = 0;
+
+    virtual void OnEnterState(EMovementState State, EMovementState From) = 0; // From: the leaf being left
+    virtual void OnExitState(EMovementState State, EMovementState To) = 0;    // To: the leaf being entered
+    virtual void OnTickState(EMovementState State, float DeltaTime) = 0;
+};
+
+/* --------------------------------------------------------------------------
+   Movement state table.
+
+   • Locomotion  : Standing, Crouched (Crouching, Proning), Sliding, Rolling, Gliding
+   • Traversal   : OnLedge, LadderClimbing, LadderExiting
+   • Every state forwards its enter and exit to the hooks. Standing and the crouched
+     leaves don't tick and run Locomotion's tick from their parent.
+   • Guards come from IMovementStateHooks, so the table can be built and driven without
+     a world (see Tests/MovementStateTableTests.cpp).
+   -------------------------------------------------------------------------- */
+struct MECHANICS_TEST_LVN_API FMovementStateTable
+{
+    static void Build(FMovementStateMachine& Machine, IMovementStateHooks& Hooks);
+};
@@ -1,10 +1,52 @@
 #include "PlayerCharacter.h"
+#include "Diagnostics.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+	static APlayerCharacter* FindPlayerCharacter(UWorld* World)
+	{
+		return World ? Cast<APlayerCharacter>(UGameplayStatics::GetPlayerCharacter(World, 0)) : nullptr;
+	}
+
+	static FAutoConsoleCommandWithWorld GMovementRecordCommand(
+		TEXT("Movement.Record"),
+		TEXT("Starts recording the player's movement input, or stops and saves the trace (fixed step only)"),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (APlayerCharacter* Player = FindPlayerCharacter(World))
+			{
+				if (Player->IsRecordingInput())
+					Player->StopInputRecording();
+				else
+					Player->StartInputRecording();
+			}
+		}));
+
+	static FAutoConsoleCommandWithWorld GMovementReplayCommand(
+		TEXT("Movement.Replay"),
+		TEXT("Replays the last recorded movement trace and reports whether it ends where the recording did"),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (APlayerCharacter* Player = FindPlayerCharacter(World))
+				Player->ReplayLastRecording();
+		}));
+
+	static FAutoConsoleCommandWithWorld GMovementStateHistoryCommand(
+		TEXT("Movement.StateHistory"),
+		TEXT("Logs the player's current movement state and its last transitions"),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (APlayerCharacter* Player = FindPlayerCharacter(World))
+				Player->LogStateHistory();
+		}));
 
 	APlayerCharacter::APlayerCharacter()
 	{
@@ -85,56 +127,86 @@
 				break;
 			}
 		}
+
+		// Movement states, see MovementStateTable.h
+		States = FMovementStateMachine(StateHistoryLength);
+		FMovementStateTable::Build(States, *this);
+		States.OnChanged.AddUObject(this, &APlayerCharacter::OnStateChanged);
+		States.Start(EMovementState::Standing);
+
+		// Jump, flip and prone transition timings, see UMovementEventTimeline
+		MovementEvents.Init(EventTimeline ? *EventTimeline : *GetDefault<UMovementEventTimeline>());
+		MovementEvents.OnEvent.AddUObject(this, &APlayerCharacter::OnMovementEvent);
+
+		// Ledges and ladders baked once per level, see UTraversalRegistrySubsystem
+		Traversal = GetWorld()->GetSubsystem<UTraversalRegistrySubsystem>();
+		Traversal->EnsureBaked(LadderTag, LedgeTag);
+		LastTickLocation = GetActorLocation();
+
+		// Fixed step: the movement component is ticked by FixedTick instead of by the world
+		Clock = FFixedStepClock(FixedTickRate, MaxStepsPerFrame);
+		PreviousLocation = GetActorLocation();
+		if (bUseFixedStep)
+			GetCharacterMovement()->SetComponentTickEnabled(false);
 	}
 
 	void APlayerCharacter::Tick(float DeltaTime)
 	{
 		Super::Tick(DeltaTime);
 
-		// Priority system
-		if (bIsOnLedge)
+		if (!bUseFixedStep)
 		{
-			HandleLedgeMovement(DeltaTime);
+			SimulateStep(DeltaTime);
 			return;
 		}
 
-		if (bIsExitingLadder)
-		{
-			UpdateExitLerp(DeltaTime);
-			return; 
-		}
+		// Fixed step: sample the live input, run whole ticks, then draw the mesh between the last two
+		RemoveMeshInterpolation();
 
-		if (bIsLadderClimbing)
-		{
-			HandleLadderClimbing(DeltaTime);
-			return;
-		}
+		PendingInput.Move = LiveMovementInput;
+		PendingInput.CameraYaw = FollowCamera->GetComponentRotation().Yaw;
 
-		if (bIsRolling)
-		{
-			HandleRolling(DeltaTime);
-			return;
-		}
+		const int32 Steps = Clock.Advance(DeltaTime);
+		for (int32 i = 0; i < Steps; ++i)
+			FixedTick();
 
-		if (bIsGliding)
-		{
-			HandleGliding(DeltaTime);
-			return;
-		}
+		ApplyMeshInterpolation(Clock.GetAlpha());
+	}
+
+	// The current state picks what runs (see MovementStateTable.h)
+	void APlayerCharacter::SimulateStep(float DeltaTime)
+	{
+		TickMotion = GetActorLocation() - LastTickLocation;
+		PredictedLadder = nullptr;
+
+		States.Tick(DeltaTime);
+		MovementEvents.Advance(DeltaTime, IsSyncingEventsToAnimation());
 
-		// Standard movement
-		HandleJumping(DeltaTime);
-		HandleSliding(DeltaTime);
+		LastTickLocation = GetActorLocation();
 	}
 
 	// ========== INPUT HANDLERS ==========
 
 	void APlayerCharacter::Move(const FInputActionValue& Value)
 	{
-		FVector2D Input = Value.Get<FVector2D>();
+		const FVector2D Input = Value.Get<FVector2D>();
+
+		// Fixed step: the next tick samples the value and moves (DispatchTickInput)
+		if (bUseFixedStep)
+		{
+			LiveMovementInput = Input;
+			return;
+		}
+
 		MovementInput = Input;
+		ApplyMoveInput(GetWorld()->GetDeltaSeconds());
+	}
+
+	void APlayerCharacter::ApplyMoveInput(float DeltaTime)
+	{
+		const FVector2D Input = MovementInput;
 
-		if (!Controller || bIsInProneTransition || bIsRolling || bIsOnLedge || bIsLadderClimbing || bIsExitingLadder)
+		if (!Controller || bIsInProneTransition || States.IsIn(EMovementState::Rolling) || States.IsIn(EMovementState::Traversal))
 			return;
 
 		if (bIsDancing)
@@ -145,9 +217,7 @@
 				return;
 		}
 
-		FRotator CameraRot = FollowCamera->GetComponentRotation();
-		CameraRot.Pitch = 0.f;
-		CameraRot.Roll = 0.f;
+		const FRotator CameraRot = GetMoveBasis();
 
 		const FVector Forward = FRotationMatrix(CameraRot).GetUnitAxis(EAxis::X);
 		const FVector Right = FRotationMatrix(CameraRot).GetUnitAxis(EAxis::Y);
@@ -166,16 +236,16 @@
 
 		FRotator Current = GetActorRotation();
 		FRotator TargetYawOnly(0.f, DesiredRot.Yaw, 0.f);
-		FRotator NewRot = FMath::RInterpTo(Current, TargetYawOnly, GetWorld()->GetDeltaSeconds(), RotationSpeed);
+		FRotator NewRot = FMath::RInterpTo(Current, TargetYawOnly, DeltaTime, RotationSpeed);
 		SetActorRotation(NewRot);
 
 		// Set speed based on state
-		if (bIsSliding)
+		if (States.IsIn(EMovementState::Sliding))
 			return;
 
-		if (bIsProning)
+		if (States.IsIn(EMovementState::Proning))
 			GetCharacterMovement()->MaxWalkSpeed = ProneSpeed;
-		else if (bIsCrouching)
+		else if (States.IsIn(EMovementState::Crouched))
 			GetCharacterMovement()->MaxWalkSpeed = CrouchSpeed;
 		else if (bIsRunning && Input.Y >= 0.f)
 			GetCharacterMovement()->MaxWalkSpeed = SprintSpeed;
@@ -185,7 +255,9 @@
 
 	void APlayerCharacter::StopMove(const FInputActionValue& Value)
 	{
-		MovementInput = FVector2D::ZeroVector;
+		LiveMovementInput = FVector2D::ZeroVector;
+		if (!bUseFixedStep)
+			MovementInput = FVector2D::ZeroVector;
 	}
 
 	void APlayerCharacter::Look(const FInputActionValue& Value)
@@ -204,27 +276,39 @@
 
 	void APlayerCharacter::RunPressed()
 	{
+		if (DeferToTick(EMovementButton::Run))
+			return;
+
 		bIsRunning = true;
-		if (MovementInput.Y >= 0.f && !bIsSliding && !bIsCrouching && !bIsProning)
+		if (MovementInput.Y >= 0.f && !States.IsIn(EMovementState::Sliding) && !States.IsIn(EMovementState::Crouched))
 			GetCharacterMovement()->MaxWalkSpeed = SprintSpeed;
 	}
 
 	void APlayerCharacter::RunReleased()
 	{
+		if (DeferToTick(EMovementButton::Run, false))
+			return;
+
 		bIsRunning = false;
-		if (!bIsSliding && !bIsCrouching && !bIsProning)
+		if (!States.IsIn(EMovementState::Sliding) && !States.IsIn(EMovementState::Crouched))
 			GetCharacterMovement()->MaxWalkSpeed = WalkSpeed;
 	}
 
 	void APlayerCharacter::Dance()
 	{
+		if (DeferToTick(EMovementButton::Dance))
+			return;
+
 		if (IsGrounded() && MovementInput.IsNearlyZero())
 			bIsDancing = true;
 	}
 
 	void APlayerCharacter::QueueJumpInput()
 	{
-		if (bIsDancing || bIsCrouching || bIsProning || bIsOnLedge || bIsLadderClimbing)
+		if (DeferToTick(EMovementButton::Jump))
+			return;
+
+		if (bIsDancing || States.IsIn(EMovementState::Crouched) || States.IsIn(EMovementState::Traversal))
 			return;
 
 		bJumpInputQueued = true;
@@ -233,12 +317,15 @@
 
 	void APlayerCharacter::HandleCrouchOrSlidePressed()
 	{
-		if (bIsProning || bIsDancing || bIsRolling || bIsJumping || bIsFlipping || bIsInProneTransition || bIsOnLedge || bIsLadderClimbing)
+		if (DeferToTick(EMovementButton::Crouch))
+			return;
+
+		if (bIsDancing || bIsJumping || bIsFlipping || bIsInProneTransition || States.IsIn(EMovementState::Proning) || States.IsIn(EMovementState::Rolling) || States.IsIn(EMovementState::Traversal))
 			return;
 
 		float GroundDistance = GetGroundDistance();
 		const bool bNearGround = GroundDistance <= SlideAirThreshold;
-		const bool bCanSlide = !bIsSliding && bIsRunning && MovementInput.Size() > 0.1f;
+		const bool bCanSlide = !States.IsIn(EMovementState::Sliding) && bIsRunning && MovementInput.Size() > 0.1f;
 
 		if (bCanSlide && (IsGrounded() || bNearGround))
 		{
@@ -246,44 +333,36 @@
 		}
 		else if (IsGrounded())
 		{
-			// Toggle crouch
-			if (bIsCrouching)
-			{
-				if (CanStandUp())
-				{
-					GetCapsuleComponent()->SetCapsuleHalfHeight(StandCapsuleHalfHeight, true);
-					GetMesh()->SetRelativeLocation(FVector(0.f, 0.f, -StandCapsuleHalfHeight));
-					bIsCrouching = false;
-					GetCharacterMovement()->MaxWalkSpeed = WalkSpeed;
-				}
-			}
-			else
-			{
-				GetCapsuleComponent()->SetCapsuleHalfHeight(CrouchCapsuleHalfHeight, true);
-				GetMesh()->SetRelativeLocation(FVector(0.f, 0.f, -CrouchCapsuleHalfHeight));
-				bIsCrouching = true;
-				GetCharacterMovement()->MaxWalkSpeed = CrouchSpeed;
-			}
+			// Toggle crouch [Capsule and speed come from OnStateChanged]
+			if (States.IsIn(EMovementState::Crouching))
+				States.TryTransition(EMovementState::Standing, TEXT("CrouchToggled"));
+			else if (States.IsIn(EMovementState::Standing))
+				States.TryTransition(EMovementState::Crouching, TEXT("CrouchToggled"));
 		}
 	}
 
 	void APlayerCharacter::HandleCrouchReleased()
 	{
-		if (bIsSliding)
+		if (DeferToTick(EMovementButton::Crouch, false))
+			return;
+
+		if (States.IsIn(EMovementState::Sliding))
 			ExitSlide();
 	}
 
 	void APlayerCharacter::ToggleProne()
 	{
-		if (bIsInProneTransition || bIsRolling || bIsDancing || bIsRunning || bIsJumping || bIsFlipping || !IsGrounded())
+		if (DeferToTick(EMovementButton::Prone))
+			return;
+
+		if (bIsInProneTransition || bIsDancing || bIsRunning || bIsJumping || bIsFlipping || !IsGrounded())
 			return;
 
 		UCapsuleComponent* Capsule = GetCapsuleComponent();
-		UMeshComponent* PlayerMesh = GetMesh();
 
-		if (bIsProning)
+		if (States.IsIn(EMovementState::Proning))
 		{
-			if (CanCrouchUpFromProne())
+			if (States.CanTransition(EMovementState::Crouching))
 			{
 				float OldHeight = Capsule->GetUnscaledCapsuleHalfHeight();
 				float NewHeight = CrouchCapsuleHalfHeight;
@@ -296,16 +375,12 @@
 				FVector DownOffset(0.f, 0.f, -Delta * 0.95f + CustomCapsuleCrouchOffset);
 				AddActorWorldOffset(DownOffset, true, &Hit);
 
-				Capsule->SetCapsuleHalfHeight(NewHeight, true);
-				PlayerMesh->SetRelativeLocation(FVector(0.f, 0.f, -NewHeight));
-
-				bIsProning = false;
-				bIsCrouching = true;
+				States.TryTransition(EMovementState::Crouching, TEXT("ProneToggled"));
 				bIsInProneTransition = true;
-				GetCharacterMovement()->MaxWalkSpeed = CrouchSpeed;
+				MovementEvents.Play(EMovementAction::ProneTransition);
 			}
 		}
-		else if (bIsCrouching)
+		else if (States.IsIn(EMovementState::Crouching))
 		{
 			float OldHeight = Capsule->GetUnscaledCapsuleHalfHeight();
 			float NewHeight = ProneCapsuleHalfHeight;
@@ -315,20 +390,39 @@
 			FHitResult Hit;
 			AddActorWorldOffset(DownOffset, true, &Hit);
 
-			Capsule->SetCapsuleHalfHeight(NewHeight, true);
-			PlayerMesh->SetRelativeLocation(FVector(0.f, 0.f, -NewHeight));
-
-			bIsProning = true;
+			States.TryTransition(EMovementState::Proning, TEXT("ProneToggled"));
 			bIsInProneTransition = true;
-			GetCharacterMovement()->MaxWalkSpeed = ProneSpeed;
+			MovementEvents.Play(EMovementAction::ProneTransition);
 		}
 	}
 
+	// Fixed step: buttons are latched and handled at the start of the next tick instead of mid-frame
+	bool APlayerCharacter::DeferToTick(EMovementButton Button, bool bPressed)
+	{
+		if (!bUseFixedStep || bInFixedTick)
+			return false;
+
+		(bPressed ? PendingInput.Pressed : PendingInput.Released) |= MovementButtonBit(Button);
+		return true;
+	}
+
+	// Yaw-only camera rotation that movement is relative to. Fixed step uses the yaw sampled into the tick input, so replays match.
+	FRotator APlayerCharacter::GetMoveBasis() const
+	{
+		const float Yaw = bUseFixedStep ? TickInput.CameraYaw : FollowCamera->GetComponentRotation().Yaw;
+		return FRotator(0.f, Yaw, 0.f);
+	}
+
 	void APlayerCharacter::ClimbPressed()
 	{
-		if (LadderCandidate != nullptr && !bIsLadderClimbing)
+		if (DeferToTick(EMovementButton::Climb))
+			return;
+
+		// The overlapped ladder, or the one the character is about to reach
+		AActor* Ladder = LadderCandidate ? LadderCandidate : PredictedLadder;
+		if (Ladder != nullptr)
 		{
-			TryStartLadderClimb(LadderCandidate);
+			TryStartLadderClimb(Ladder);
 		}
 	}
 
@@ -353,24 +447,26 @@
 			bIsFlipping = false;
 
 			// Buffered jump
-			if (bJumpInputQueued && !bJumpPending && !bIsCrouching && !bIsProning)
+			if (bJumpInputQueued && !bJumpPending && !States.IsIn(EMovementState::Crouched))
 			{
 				bJumpPending = true;
 				bJumpInputQueued = false;
 				JumpCount++;
 				bIsJumping = true;
+				ScheduleJumpImpulse(false);
 			}
 		}
 		else
 		{
 			// Double jump
-			if (bAllowDoubleJump && JumpCount < 2 && bJumpInputQueued && !bJumpPending && !bIsCrouching && !bIsProning)
+			if (bAllowDoubleJump && JumpCount < 2 && bJumpInputQueued && !bJumpPending && !States.IsIn(EMovementState::Crouched))
 			{
 				bIsFlipping = true;
 				bIsJumping = true;
 				bJumpPending = true;
 				bJumpInputQueued = false;
 				JumpCount++;
+				ScheduleJumpImpulse(true);
 			}
 
 			// Reset jumping flag when falling
@@ -379,18 +475,45 @@
 		}
 	}
 
+	// Animation notifies. They only sync timeline events that are already due soon (see FMovementEventPlayer):
+	// impulses and the prone lock follow the simulation clock even when the animation is skipped or never runs.
 	void APlayerCharacter::ApplyJumpForce()
 	{
-		if (bIsCrouching)
+		NotifyMovementEvent(EMovementEvent::JumpImpulse);
+	}
+
+	void APlayerCharacter::TriggerFlip()
+	{
+		NotifyMovementEvent(EMovementEvent::FlipImpulse);
+	}
+
+	void APlayerCharacter::EndFlip()
+	{
+		NotifyMovementEvent(EMovementEvent::FlipEnd);
+	}
+
+	void APlayerCharacter::StartProneTransition()
+	{
+		NotifyMovementEvent(EMovementEvent::ProneTransitionStart);
+	}
+
+	void APlayerCharacter::EndProneTransition()
+	{
+		NotifyMovementEvent(EMovementEvent::ProneTransitionEnd);
+	}
+
+	void APlayerCharacter::LaunchJump()
+	{
+		if (States.IsIn(EMovementState::Crouched))
 			return;
 
 		LaunchCharacter(FVector(0.f, 0.f, JumpForce), false, true);
 		bJumpPending = false;
 	}
 
-	void APlayerCharacter::TriggerFlip()
+	void APlayerCharacter::LaunchFlip()
 	{
-		if (bIsCrouching)
+		if (States.IsIn(EMovementState::Crouched))
 			return;
 
 		bIsFlipping = true;
@@ -400,19 +523,58 @@
 		LaunchCharacter(FVector(0.f, 0.f, FlipJumpForce), false, true);
 	}
 
-	void APlayerCharacter::EndFlip()
+	void APlayerCharacter::StopFlip()
 	{
 		bIsFlipping = false;
 		bIsJumping = false;
 	}
 
+	// The impulse (and the flip's end) come from the action's timeline, see OnMovementEvent
+	void APlayerCharacter::ScheduleJumpImpulse(bool bFlip)
+	{
+		MovementEvents.Play(bFlip ? EMovementAction::AirJump : EMovementAction::Jump);
+	}
+
+	// ========== MOVEMENT EVENTS ==========
+
+	void APlayerCharacter::OnMovementEvent(EMovementEvent Event)
+	{
+		switch (Event)
+		{
+		case EMovementEvent::JumpImpulse:
+			LaunchJump();
+			break;
+		case EMovementEvent::FlipImpulse:
+			LaunchFlip();
+			break;
+		case EMovementEvent::FlipEnd:
+			StopFlip();
+			break;
+		case EMovementEvent::ProneTransitionStart:
+			bIsInProneTransition = true;
+			break;
+		case EMovementEvent::ProneTransitionEnd:
+			bIsInProneTransition = false;
+			break;
+		}
+	}
+
+	void APlayerCharacter::NotifyMovementEvent(EMovementEvent Event)
+	{
+		if (IsSyncingEventsToAnimation())
+			MovementEvents.Notify(Event);
+	}
+
+	// Fixed step never syncs (notifies follow the frame rate), and neither does a mesh nobody sees, like on a dedicated server
+	bool APlayerCharacter::IsSyncingEventsToAnimation() const
+	{
+		return bSyncEventsToAnimation && !bUseFixedStep && GetMesh()->GetAnimInstance() != nullptr && GetMesh()->WasRecentlyRendered(0.2f);
+	}
+
 	// ========== SLIDING ==========
 
 	void APlayerCharacter::HandleSliding(float DeltaTime)
 	{
-		if (!bIsSliding)
-			return;
-
 		FVector GroundNormal = FVector::UpVector;
 		FHitResult Hit;
 		FVector Start = GetActorLocation();
@@ -480,64 +642,38 @@
 
 	void APlayerCharacter::TryStartSlide()
 	{
-		if (bIsSliding || bIsRolling || bIsCrouching || bIsProning || !bIsRunning || MovementInput.Size() < 0.1f)
+		if (!bIsRunning || MovementInput.Size() < 0.1f)
 			return;
 
-		float GroundDistance = GetGroundDistance();
-		if (!IsGrounded() && GroundDistance > SlideAirThreshold)
+		if (!States.TryTransition(EMovementState::Sliding, TEXT("CrouchWhileRunning")))
 			return;
 
-		bIsSliding = true;
 		SlideStartTimer = 0.2f;
 		SlideVelocity = GetActorForwardVector() * SlideSpeed;
-
-		GetCapsuleComponent()->SetCapsuleHalfHeight(ProneCapsuleHalfHeight, true);
-		GetMesh()->SetRelativeLocation(FVector(0.f, 0.f, -ProneCapsuleHalfHeight));
 	}
 
+	// Stands up if there's room, else crouches, else stays prone
 	void APlayerCharacter::ExitSlide()
 	{
-		bIsSliding = false;
-
-		const bool bCanStand = CanStandUp();
-		const bool bCanCrouch = CanCrouchUpFromProne();
+		if (States.TryTransition(EMovementState::Standing, TEXT("SlideEnded")))
+			return;
+		if (States.TryTransition(EMovementState::Crouching, TEXT("SlideEnded")))
+			return;
 
-		if (bCanStand && bCanCrouch)
-		{
-			GetCapsuleComponent()->SetCapsuleHalfHeight(StandCapsuleHalfHeight, true);
-			GetMesh()->SetRelativeLocation(FVector(0.f, 0.f, -StandCapsuleHalfHeight));
-			bIsCrouching = false;
-			bIsProning = false;
-			GetCharacterMovement()->MaxWalkSpeed = WalkSpeed;
-		}
-		else if (bCanCrouch)
-		{
-			GetCapsuleComponent()->SetCapsuleHalfHeight(CrouchCapsuleHalfHeight, true);
-			GetMesh()->SetRelativeLocation(FVector(0.f, 0.f, -CrouchCapsuleHalfHeight));
-			bIsCrouching = true;
-			bIsProning = false;
-			GetCharacterMovement()->MaxWalkSpeed = CrouchSpeed;
-		}
-		else
-		{
-			GetCapsuleComponent()->SetCapsuleHalfHeight(ProneCapsuleHalfHeight, true);
-			GetMesh()->SetRelativeLocation(FVector(0.f, 0.f, -ProneCapsuleHalfHeight));
-			bIsCrouching = true;
-			bIsProning = true;
-			GetCharacterMovement()->MaxWalkSpeed = ProneSpeed;
-		}
+		States.TryTransition(EMovementState::Proning, TEXT("SlideEnded"));
 	}
 
 	// ========== ROLLING ==========
 
 	void APlayerCharacter::TryStartRoll()
 	{
-		if (!IsGrounded() || bIsSliding || bIsCrouching || bIsProning || bIsOnLedge || bIsLadderClimbing)
+		if (DeferToTick(EMovementButton::Roll))
 			return;
 
-		FRotator CameraRot = FollowCamera->GetComponentRotation();
-		CameraRot.Pitch = 0.f;
-		CameraRot.Roll = 0.f;
+		if (!States.TryTransition(EMovementState::Rolling, TEXT("RollPressed")))
+			return;
+
+		const FRotator CameraRot = GetMoveBasis();
 
 		const FVector Forward = FRotationMatrix(CameraRot).GetUnitAxis(EAxis::X);
 		const FVector Right = FRotationMatrix(CameraRot).GetUnitAxis(EAxis::Y);
@@ -549,8 +685,6 @@
 		RollDirection = MoveInput.GetSafeNormal();
 		CurrentRollSpeed = bIsRunning ? SprintRollSpeed : WalkRollSpeed;
 		GetCharacterMovement()->MaxWalkSpeed = CurrentRollSpeed;
-
-		bIsRolling = true;
 		RollTimer = 0.f;
 
 		GetCharacterMovement()->bOrientRotationToMovement = false;
@@ -558,12 +692,6 @@
 
 		FRotator DesiredRot = RollDirection.Rotation();
 		SetActorRotation(FRotator(0.f, DesiredRot.Yaw, 0.f));
-
-		GetCapsuleComponent()->SetCapsuleHalfHeight(CrouchCapsuleHalfHeight, true);
-		GetMesh()->SetRelativeLocation(FVector(0.f, 0.f, -CrouchCapsuleHalfHeight));
-
-		OriginalGravityScale = GetCharacterMovement()->GravityScale;
-		GetCharacterMovement()->GravityScale /= GravityScaleDivider;
 	}
 
 	void APlayerCharacter::HandleRolling(float DeltaTime)
@@ -599,72 +727,31 @@
 
 	void APlayerCharacter::FinishRoll()
 	{
-		bIsRolling = false;
-
-		if (CanStandUp())
-		{
-			GetCapsuleComponent()->SetCapsuleHalfHeight(StandCapsuleHalfHeight, true);
-			GetMesh()->SetRelativeLocation(FVector(0.f, 0.f, -StandCapsuleHalfHeight));
-			bIsCrouching = false;
-		}
-		else
-		{
-			GetCapsuleComponent()->SetCapsuleHalfHeight(CrouchCapsuleHalfHeight, true);
-			GetMesh()->SetRelativeLocation(FVector(0.f, 0.f, -CrouchCapsuleHalfHeight));
-			bIsCrouching = true;
-		}
-
-		GetCharacterMovement()->GravityScale = OriginalGravityScale;
+		if (!States.TryTransition(EMovementState::Standing, TEXT("RollFinished")))
+			States.TryTransition(EMovementState::Crouching, TEXT("RollFinished"));
 	}
 
 	// ========== GLIDING ==========
 
 	void APlayerCharacter::GlidePressed()
 	{
-		if (bIsOnLedge || bIsRolling || bIsSliding || bIsCrouching || bIsProning || bIsDancing || bIsLadderClimbing)
-			return;
-
-		if (!GetCharacterMovement()->IsFalling())
+		if (DeferToTick(EMovementButton::Glide))
 			return;
 
-		float CurrentFallSpeed = GetCharacterMovement()->Velocity.Z;
-		if (CurrentFallSpeed > GlideFallVelocityThreshold)
-			return;
-
-		float GroundDistance = GetGroundDistance();
-		if (GroundDistance < MinGlideActivationHeight)
+		if (bIsDancing)
 			return;
 
-		bGlideInputHeld = true;
-
-		if (!bIsGliding)
-		{
-			bIsGliding = true;
-			OriginalMeshRotation = GetMesh()->GetRelativeRotation();
-			OriginalGravityScaleBeforeGlide = GetCharacterMovement()->GravityScale;
-			GetCharacterMovement()->GravityScale = GlideGravityScale;
-			GetCharacterMovement()->MaxWalkSpeed = GlideSpeed;
-			GetCharacterMovement()->bOrientRotationToMovement = false;
-			bUseControllerRotationYaw = false;
-
-			FRotator MeshRot = OriginalMeshRotation;
-			MeshRot.Yaw += GlideYawOffset;
-			GetMesh()->SetRelativeRotation(MeshRot);
-
-			if (GliderMesh)
-				GliderMesh->SetVisibility(true);
-		}
+		// Falling, fast enough and high enough: see CanStartGlide
+		if (States.IsIn(EMovementState::Gliding) || States.TryTransition(EMovementState::Gliding, TEXT("GlidePressed")))
+			bGlideInputHeld = true;
 	}
 
 	void APlayerCharacter::HandleGliding(float DeltaTime)
 	{
-		if (!bIsGliding)
-			return;
-
 		// Auto-exit when grounded
 		if (IsGrounded())
 		{
-			GlideReleased();
+			StopGliding(TEXT("Landed"));
 			return;
 		}
 
@@ -672,14 +759,12 @@
 		float GroundDistance = GetGroundDistance();
 		if (!bGlideInputHeld || GroundDistance < MinGlideActivationHeight * 0.3f)
 		{
-			GlideReleased();
+			StopGliding(TEXT("TooLowOrReleased"));
 			return;
 		}
 
 		// Camera-relative movement
-		FRotator CameraRot = FollowCamera->GetComponentRotation();
-		CameraRot.Pitch = 0.f;
-		CameraRot.Roll = 0.f;
+		const FRotator CameraRot = GetMoveBasis();
 
 		const FVector Forward = FRotationMatrix(CameraRot).GetUnitAxis(EAxis::X);
 		const FVector Right = FRotationMatrix(CameraRot).GetUnitAxis(EAxis::Y);
@@ -713,31 +798,25 @@
 
 	void APlayerCharacter::GlideReleased()
 	{
-		bGlideInputHeld = false;
+		if (DeferToTick(EMovementButton::Glide, false))
+			return;
 
-		if (bIsGliding)
-		{
-			bIsGliding = false;
-			GetMesh()->SetRelativeRotation(OriginalMeshRotation);
-			GetCharacterMovement()->GravityScale = OriginalGravityScaleBeforeGlide;
-			GetCharacterMovement()->MaxWalkSpeed = bIsRunning ? SprintSpeed : WalkSpeed;
-			GetCharacterMovement()->bOrientRotationToMovement = false;
-			bUseControllerRotationYaw = false;
+		StopGliding(TEXT("GlideReleased"));
+	}
 
-			if (GliderMesh)
-				GliderMesh->SetVisibility(false);
-		}
+	void APlayerCharacter::StopGliding(FName Reason)
+	{
+		bGlideInputHeld = false;
+
+		if (States.IsIn(EMovementState::Gliding))
+			States.TryTransition(EMovementState::Standing, Reason);
 	}
 
 	// ========== LEDGE MOVEMENT ==========
 
 	void APlayerCharacter::TryEnterLedge(AActor* LedgeActor)
 	{
-		if (bIsOnLedge || bLedgeExitCooldown)
-			return;
-		if (bIsRolling || bIsSliding || bIsCrouching || bIsProning || bIsFlipping || bIsDancing)
-			return;
-		if (!IsGrounded())
+		if (bLedgeExitCooldown || bIsDancing)
 			return;
 
 		EnterLedge(LedgeActor);
@@ -745,42 +824,22 @@
 
 	void APlayerCharacter::EnterLedge(AActor* LedgeActor)
 	{
-		bIsOnLedge = true;
+		if (!States.TryTransition(EMovementState::OnLedge, TEXT("LedgeOverlap")))
+			return;
+
 		CurrentLedge = LedgeActor;
 
 		GetCharacterMovement()->DisableMovement();
 
-		UStaticMeshComponent* FloorComp = LedgeActor->FindComponentByClass<UStaticMeshComponent>();
-		USceneComponent* StartComp = nullptr;
-		USceneComponent* EndComp = nullptr;
+		// Start / end points and the wall direction were baked from the LedgeStart / LedgeEnd components
+		CurrentLedgeFeature = Traversal->GetOrBake(LedgeActor, ETraversalKind::Ledge);
+		LedgeStartPos = CurrentLedgeFeature.GetStart();
+		LedgeEndPos = CurrentLedgeFeature.GetEnd();
+		LedgeForward = CurrentLedgeFeature.Direction;
+		LedgeInward = CurrentLedgeFeature.Normal;
 
-		for (UActorComponent* Comp : LedgeActor->GetComponents())
-		{
-			if (Comp->GetName().Contains("LedgeStart"))
-				StartComp = Cast<USceneComponent>(Comp);
-			else if (Comp->GetName().Contains("LedgeEnd"))
-				EndComp = Cast<USceneComponent>(Comp);
-		}
-
-		if (StartComp && EndComp)
-		{
-			LedgeStartPos = StartComp->GetComponentLocation();
-			LedgeEndPos = EndComp->GetComponentLocation();
-		}
-		else if (FloorComp)
-		{
-			FBoxSphereBounds Bounds = FloorComp->CalcBounds(FloorComp->GetComponentTransform());
-			FVector Extent = Bounds.BoxExtent;
-			LedgeForward = FloorComp->GetForwardVector().GetSafeNormal();
-			LedgeStartPos = Bounds.Origin - LedgeForward * Extent.Size();
-			LedgeEndPos = Bounds.Origin + LedgeForward * Extent.Size();
-		}
-
-		LedgeForward = (LedgeEndPos - LedgeStartPos).GetSafeNormal();
-		LedgeInward = -FloorComp->GetRightVector();
-
-		FVector ToChar = GetActorLocation() - LedgeStartPos;
-		LedgeT = FVector::DotProduct(ToChar, LedgeForward);
+		// Clamped, a predictive grab can start slightly past an end
+		LedgeT = FMath::Clamp(CurrentLedgeFeature.ProjectT(GetActorLocation()), 0.f, CurrentLedgeFeature.MaxT);
 
 		FRotator FaceWallRot(0.f, LedgeInward.Rotation().Yaw, 0.f);
 		SetActorRotation(FaceWallRot);
@@ -792,7 +851,7 @@
 
 	void APlayerCharacter::HandleLedgeMovement(float DeltaTime)
 	{
-		if (!bIsOnLedge || !CurrentLedge)
+		if (!CurrentLedge)
 			return;
 
 		const float X = -MovementInput.X;
@@ -833,8 +892,9 @@
 
 	void APlayerCharacter::ExitLedge()
 	{
-		bIsOnLedge = false;
+		States.TryTransition(EMovementState::Standing, TEXT("LeftLedge"));
 		CurrentLedge = nullptr;
+		CurrentLedgeFeature = FTraversalFeature();
 
 		GetCharacterMovement()->SetMovementMode(MOVE_Walking);
 
@@ -849,19 +909,53 @@
 		bLedgeExitCooldown = false;
 	}
 
+	// ========== TRAVERSAL PREDICTION ==========
+
+	// Sweeps the last tick's motion ahead by TraversalLookAhead and grabs what it would reach, before the overlaps fire.
+	// Only simulated positions go in, so fixed step replays predict the same grabs.
+	void APlayerCharacter::UpdateTraversalPrediction(float DeltaTime)
+	{
+		if (!bPredictiveTraversal || !Traversal || DeltaTime <= 0.f)
+			return;
+
+		const FVector Sweep = TickMotion * (TraversalLookAhead / DeltaTime);
+		FTraversalFeature Feature;
+		float T = 0.f;
+
+		// Ladders still wait for ClimbPressed, this only widens what it can grab
+		const float LadderReach = LadderOffset + LadderPositionOffset.Size() + TraversalGrabDistance;
+		if (Traversal->FindNearest(ETraversalKind::Ladder, GetActorLocation(), Sweep, LadderReach, Feature, T))
+			PredictedLadder = Feature.Actor.Get();
+
+		// Ledges are entered on contact, so the grab happens here [Probe from where the ledge line sits while on it]
+		if (!States.IsIn(EMovementState::Standing) || bLedgeExitCooldown)
+			return;
+
+		const FVector LedgeProbe = GetActorLocation() - FVector(0.f, 0.f, VerticalOffset);
+		if (Traversal->FindNearest(ETraversalKind::Ledge, LedgeProbe, Sweep, TraversalGrabDistance, Feature, T))
+		{
+			if (AActor* LedgeActor = Feature.Actor.Get())
+				TryEnterLedge(LedgeActor);
+		}
+	}
+
 	// ========== LADDER CLIMBING ==========
 
 	void APlayerCharacter::TryStartLadderClimb(AActor* LadderActor)
 	{
-		if (!LadderActor || bIsLadderClimbing || bIsExitingLadder || bIsJumping || bIsCrouching || bIsProning || bIsDancing || bIsGliding || bIsRolling || bIsOnLedge || bIsSliding) return;
+		if (!LadderActor || bIsDancing) return;
+		if (!States.TryTransition(EMovementState::LadderClimbing, TEXT("ClimbPressed"))) return;
 
-		bIsLadderClimbing = true;
 		bIsAtTopOfLadder = false;
 		CurrentLadder = LadderActor;
+		CurrentLadderFeature = Traversal->GetOrBake(LadderActor, ETraversalKind::Ladder);
+
+		// Grabbed before touching the trigger, so the overlap never recorded where the climb started
+		if (LadderActor != LadderCandidate)
+			startingLadderZ = GetActorLocation().Z;
 
 		// Ladder center
-		UPrimitiveComponent* LadderCollider = LadderActor->FindComponentByClass<UPrimitiveComponent>();
-		const FVector LadderCenter = LadderCollider ? LadderCollider->Bounds.Origin : LadderActor->GetActorLocation();
+		const FVector LadderCenter = CurrentLadderFeature.Bounds.GetCenter();
 
 		// Which side to face
 		const FVector ToPlayer = (GetActorLocation() - LadderCenter).GetSafeNormal();
@@ -893,8 +987,6 @@
 	// Per-frame climb updating Z while keeping XY centered
 	void APlayerCharacter::HandleLadderClimbing(float DeltaTime)
 	{
-		if (!bIsLadderClimbing) return;
-
 		// Bottom exit detection based on Input
 		const bool bGroundedOnLadder = GetGroundDistance() < 5.f;
 		if (bGroundedOnLadder && MovementInput.Y < -0.1f)
@@ -913,6 +1005,14 @@
 		{
 			GetCharacterMovement()->Velocity = FVector::ZeroVector;
 		}
+
+		// Top exit from the baked ladder height, the end overlap stays as a fallback
+		const float FeetZ = GetActorLocation().Z - GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+		if (VerticalInput > 0.1f && FeetZ >= CurrentLadderFeature.GetTopZ() - LadderTopExitThreshold)
+		{
+			StartLadderTopExit();
+			return;
+		}
 		
 		FVector Current = GetActorLocation();
 		Current.X = FMath::FInterpTo(Current.X, LadderAttachBase.X, DeltaTime, 10.f);
@@ -925,9 +1025,10 @@
 	// Bottom exit: snap to walk and restore mesh/collision
 	void APlayerCharacter::ExitLadderAtBottom()
 	{
-		bIsLadderClimbing = false;
+		States.TryTransition(EMovementState::Standing, TEXT("LadderBottom"));
 		bIsAtTopOfLadder = false;
 		CurrentLadder = nullptr;
+		CurrentLadderFeature = FTraversalFeature();
 
 		GetCharacterMovement()->SetMovementMode(MOVE_Walking);
 		GetCharacterMovement()->StopMovementImmediately();
@@ -939,24 +1040,10 @@
 	// Start top exit
 	void APlayerCharacter::StartLadderTopExit()
 	{
-		if (!bIsLadderClimbing || !CurrentLadder) return;
-
-		bIsExitingLadder = true;
-		bIsLadderClimbing = false;
+		if (!CurrentLadder || !States.TryTransition(EMovementState::LadderExiting, TEXT("LadderTop"))) return;
 
-		// Find exit point once [Must set empty Actor inside the ladder Blueprint]
-		USceneComponent* ExitPoint = nullptr;
-		for (UActorComponent* Comp : CurrentLadder->GetComponents())
-		{
-			if (Comp->GetName().Contains("ExitPoint"))
-			{
-				ExitPoint = Cast<USceneComponent>(Comp);
-				break;
-			}
-		}
-
-		// Get ladder forward vector
-		const FVector LadderForward = CurrentLadder->GetActorForwardVector();
+		// Exit point baked by the traversal registry [Must set empty Actor inside the ladder Blueprint]
+		const FVector LadderForward = CurrentLadderFeature.Normal;
 		
 		const FVector OffsetDir = -LadderForward;
 
@@ -966,7 +1053,7 @@
 		SetActorLocation(GetActorLocation() + Offset);
 		
 		ExitStartLocation = GetActorLocation();
-		ExitTargetLocation = ExitPoint ? ExitPoint->GetComponentLocation() : ExitStartLocation;
+		ExitTargetLocation = CurrentLadderFeature.bHasExitPoint ? CurrentLadderFeature.ExitPoint : ExitStartLocation;
 
 		// Freeze movement and collision during transition 
 		GetCharacterMovement()->StopMovementImmediately();
@@ -980,8 +1067,6 @@
 
 	void APlayerCharacter::UpdateExitLerp(float DeltaTime)
 	{
-		if (!bIsExitingLadder) return;
-		
 		static float Accumulated = 0.f;
 		Accumulated = FMath::Clamp(Accumulated + DeltaTime, 0.f, ClimbAnimationTime);
 		const float Alpha = ClimbAnimationTime > 0.f ? (Accumulated / ClimbAnimationTime) : 1.f;
@@ -1004,13 +1089,17 @@
 
 	void APlayerCharacter::FinishLadderExitCleanup()
 	{
-		bIsExitingLadder = false;
+		States.TryTransition(EMovementState::Standing, TEXT("LadderExitComplete"));
 		bIsAtTopOfLadder = false;
 		CurrentLadder = nullptr;
+		CurrentLadderFeature = FTraversalFeature();
 		
 		// Restore movement and collision
 		GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
 		GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+		PreviousLocation = GetActorLocation(); // Teleported, nothing to interpolate from
+		LastTickLocation = GetActorLocation();
+		TickMotion = FVector::ZeroVector;
 
 		//Timer based on animation transition [Yeah more hardcoded thing but it is for animation only, totally optional delay here]
 		//ReattachMeshAfterLadderClimb()
@@ -1025,6 +1114,470 @@
 		GetMesh()->SetRelativeRotation(MeshInitialRotation);
 	}
 
+	// ========== FIXED STEP ==========
+
+	void APlayerCharacter::FixedTick()
+	{
+		bInFixedTick = true;
+
+		// Live buttons are consumed even during a replay, so they don't all fire when it ends
+		const FMovementTickInput Live = PendingInput;
+		PendingInput.Pressed = PendingInput.Released = 0;
+
+		TickInput = Replay ? Replay->Inputs[ReplayTick++] : Live;
+		if (bRecording)
+			Recording.Inputs.Add(TickInput);
+
+		PreviousLocation = GetActorLocation();
+
+		DispatchTickInput(TickInput);
+		SimulateStep(Clock.Step);
+
+		UCharacterMovementComponent* Movement = GetCharacterMovement();
+		Movement->TickComponent(Clock.Step, LEVELTICK_All, &Movement->PrimaryComponentTick);
+
+		bInFixedTick = false;
+
+		if (Replay && ReplayTick >= Replay->Inputs.Num())
+			EndReplay();
+	}
+
+	void APlayerCharacter::SimulateTick(const FMovementTickInput& Input)
+	{
+		PendingInput = Input;
+		FixedTick();
+	}
+
+	// Runs the input handlers for one tick, in the order Enhanced Input would have called them
+	void APlayerCharacter::DispatchTickInput(const FMovementTickInput& Input)
+	{
+		MovementInput = Input.Move;
+
+		if (Input.WasPressed(EMovementButton::Run)) RunPressed();
+		if (Input.WasReleased(EMovementButton::Run)) RunReleased();
+		if (Input.WasPressed(EMovementButton::Dance)) Dance();
+		if (Input.WasPressed(EMovementButton::Jump)) QueueJumpInput();
+		if (Input.WasPressed(EMovementButton::Crouch)) HandleCrouchOrSlidePressed();
+		if (Input.WasReleased(EMovementButton::Crouch)) HandleCrouchReleased();
+		if (Input.WasPressed(EMovementButton::Prone)) ToggleProne();
+		if (Input.WasPressed(EMovementButton::Roll)) TryStartRoll();
+		if (Input.WasPressed(EMovementButton::Glide)) GlidePressed();
+		if (Input.WasReleased(EMovementButton::Glide)) GlideReleased();
+		if (Input.WasPressed(EMovementButton::Climb)) ClimbPressed();
+
+		if (!MovementInput.IsZero())
+			ApplyMoveInput(Clock.Step);
+	}
+
+	// The capsule moves in whole ticks. The mesh is offset to where it would be between the last two ticks.
+	void APlayerCharacter::RemoveMeshInterpolation()
+	{
+		if (AppliedMeshOffset.IsZero())
+			return;
+
+		GetMesh()->AddWorldOffset(-AppliedMeshOffset);
+		AppliedMeshOffset = FVector::ZeroVector;
+	}
+
+	void APlayerCharacter::ApplyMeshInterpolation(float Alpha)
+	{
+		// Detached during the ladder top exit
+		if (GetMesh()->GetAttachParent() != GetCapsuleComponent())
+			return;
+
+		AppliedMeshOffset = FMath::Lerp(PreviousLocation, GetActorLocation(), Alpha) - GetActorLocation();
+		GetMesh()->AddWorldOffset(AppliedMeshOffset);
+	}
+
+	FMovementSimState APlayerCharacter::CaptureMovementState() const
+	{
+		const UCharacterMovementComponent* Movement = GetCharacterMovement();
+
+		FMovementSimState State;
+		State.Location = GetActorLocation();
+		State.Rotation = GetActorRotation();
+		State.Velocity = Movement->Velocity;
+		State.MovementMode = static_cast<uint8>(Movement->MovementMode.GetValue());
+		State.GravityScale = Movement->GravityScale;
+		State.MaxWalkSpeed = Movement->MaxWalkSpeed;
+		State.CapsuleHalfHeight = GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
+
+		State.MovementInput = MovementInput;
+		State.JumpCount = JumpCount;
+		State.JumpBufferTimer = JumpBufferTimer;
+		State.SlideVelocity = SlideVelocity;
+		State.SlideFallTimer = SlideFallTimer;
+		State.SlideStartTimer = SlideStartTimer;
+		State.RollTimer = RollTimer;
+		State.RollDirection = RollDirection;
+		State.CurrentRollSpeed = CurrentRollSpeed;
+		State.OriginalGravityScale = OriginalGravityScale;
+		State.OriginalGravityScaleBeforeGlide = OriginalGravityScaleBeforeGlide;
+
+		State.State = States.GetCurrent();
+		State.bIsRunning = bIsRunning;
+		State.bIsDancing = bIsDancing;
+		State.bIsJumping = bIsJumping;
+		State.bIsFlipping = bIsFlipping;
+		State.bGlideInputHeld = bGlideInputHeld;
+		State.bJumpInputQueued = bJumpInputQueued;
+		State.bJumpPending = bJumpPending;
+		State.bIsInProneTransition = bIsInProneTransition;
+		State.Events = MovementEvents.Capture();
+		return State;
+	}
+
+	void APlayerCharacter::RestoreMovementState(const FMovementSimState& State)
+	{
+		UCharacterMovementComponent* Movement = GetCharacterMovement();
+
+		RemoveMeshInterpolation();
+		GetCapsuleComponent()->SetCapsuleHalfHeight(State.CapsuleHalfHeight, true);
+		GetMesh()->SetRelativeLocation(FVector(0.f, 0.f, -State.CapsuleHalfHeight));
+		SetActorLocationAndRotation(State.Location, State.Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+		LastTickLocation = State.Location;
+		TickMotion = FVector::ZeroVector;
+
+		// Mode first, changing it can touch the velocity
+		Movement->SetMovementMode(static_cast<EMovementMode>(State.MovementMode));
+		Movement->Velocity = State.Velocity;
+		Movement->GravityScale = State.GravityScale;
+		Movement->MaxWalkSpeed = State.MaxWalkSpeed;
+		Movement->PendingLaunchVelocity = FVector::ZeroVector;
+		Movement->FindFloor(GetCapsuleComponent()->GetComponentLocation(), Movement->CurrentFloor, false);
+		ConsumeMovementInputVector();
+
+		MovementInput = State.MovementInput;
+		JumpCount = State.JumpCount;
+		JumpBufferTimer = State.JumpBufferTimer;
+		SlideVelocity = State.SlideVelocity;
+		SlideFallTimer = State.SlideFallTimer;
+		SlideStartTimer = State.SlideStartTimer;
+		RollTimer = State.RollTimer;
+		RollDirection = State.RollDirection;
+		CurrentRollSpeed = State.CurrentRollSpeed;
+		OriginalGravityScale = State.OriginalGravityScale;
+		OriginalGravityScaleBeforeGlide = State.OriginalGravityScaleBeforeGlide;
+
+		bIsRunning = State.bIsRunning;
+		bIsDancing = State.bIsDancing;
+		bIsJumping = State.bIsJumping;
+		bIsFlipping = State.bIsFlipping;
+		bGlideInputHeld = State.bGlideInputHeld;
+		bJumpInputQueued = State.bJumpInputQueued;
+		bJumpPending = State.bJumpPending;
+		bIsInProneTransition = State.bIsInProneTransition;
+		MovementEvents.Restore(State.Events);
+
+		// The capsule, speed and gravity come from the snapshot, so the state is placed without running its hooks
+		States.Reset(State.State, TEXT("Restored"));
+
+		// Glider visuals follow the state
+		OriginalMeshRotation = MeshInitialRotation;
+		FRotator MeshRot = MeshInitialRotation;
+		if (IsGliding())
+			MeshRot.Yaw += GlideYawOffset;
+		GetMesh()->SetRelativeRotation(MeshRot);
+		if (GliderMesh)
+			GliderMesh->SetVisibility(IsGliding());
+
+		// Nothing pressed before the restore carries over
+		PendingInput = FMovementTickInput();
+		Clock = FFixedStepClock(FixedTickRate, MaxStepsPerFrame);
+		PreviousLocation = State.Location;
+	}
+
+	void APlayerCharacter::StartInputRecording()
+	{
+		if (!bUseFixedStep)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Input recording needs bUseFixedStep"));
+			return;
+		}
+		if (bRecording || Replay)
+			return;
+		if (States.IsIn(EMovementState::Traversal))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Input recording can't start on a ledge or ladder"));
+			return;
+		}
+
+		Recording = FMovementTrace();
+		Recording.TickRate = FixedTickRate;
+		Recording.Start = CaptureMovementState();
+		bRecording = true;
+		UE_LOG(LogTemp, Log, TEXT("Recording movement input at %d Hz"), FixedTickRate);
+	}
+
+	void APlayerCharacter::StopInputRecording()
+	{
+		if (!bRecording)
+			return;
+
+		bRecording = false;
+		Recording.EndLocation = GetActorLocation();
+		LastTrace = Recording;
+
+		const FString Path = FPaths::ProjectSavedDir() / TEXT("MovementTraces") / FString::Printf(TEXT("MovementTrace_%s.json"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+
+		FString Json;
+		if (FJsonObjectConverter::UStructToJsonObjectString(LastTrace, Json) && FFileHelper::SaveStringToFile(Json, *Path))
+			UE_LOG(LogTemp, Log, TEXT("Recorded %d ticks to %s"), LastTrace.Inputs.Num(), *Path);
+	}
+
+	void APlayerCharacter::ReplayLastRecording()
+	{
+		if (bRecording || Replay)
+			return;
+		if (LastTrace.Inputs.Num() == 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("No movement recording to replay"));
+			return;
+		}
+
+		StartReplay(LastTrace, true);
+	}
+
+	void APlayerCharacter::StartReplay(const FMovementTrace& Trace, bool bLive)
+	{
+		RestoreMovementState(Trace.Start);
+		Clock = FFixedStepClock(Trace.TickRate, MaxStepsPerFrame);
+		Replay = Trace.Inputs.Num() > 0 ? &Trace : nullptr;
+		ReplayTick = 0;
+		bReplayIsLive = bLive;
+	}
+
+	void APlayerCharacter::EndReplay()
+	{
+		if (bReplayIsLive)
+		{
+			const bool bIdentical = GetActorLocation() == Replay->EndLocation;
+			UE_LOG(LogTemp, Log, TEXT("Replay finished %s: ended at %s, recording ended at %s"),
+				bIdentical ? TEXT("identical") : TEXT("DIFFERENT"), *GetActorLocation().ToString(), *Replay->EndLocation.ToString());
+		}
+
+		Replay = nullptr;
+		bReplayIsLive = false;
+		Clock = FFixedStepClock(FixedTickRate, MaxStepsPerFrame);
+	}
+
+	// Runs every tick of the trace right now, from its start state
+	FVector APlayerCharacter::ReplayTrace(const FMovementTrace& Trace)
+	{
+		StartReplay(Trace, false);
+		while (Replay)
+			FixedTick();
+		return GetActorLocation();
+	}
+
+	// Performs the trace as live input at FrameRate, through the same latching and clock as Tick,
+	// and returns what the ticks actually consumed
+	FMovementTrace APlayerCharacter::PerformTrace(const FMovementTrace& Trace, int32 FrameRate)
+	{
+		RestoreMovementState(Trace.Start);
+		Clock = FFixedStepClock(Trace.TickRate, MaxStepsPerFrame);
+		Recording = FMovementTrace();
+		Recording.TickRate = Trace.TickRate;
+		Recording.Start = Trace.Start;
+		bRecording = true;
+
+		const double FrameTime = 1.0 / FrameRate;
+		double Time = 0.0;
+		while (Recording.Inputs.Num() < Trace.Inputs.Num())
+		{
+			const double PreviousTime = Time;
+			Time += FrameTime;
+
+			const FMovementTickInput Frame = Trace.SampleFrame(PreviousTime, Time);
+			PendingInput.Move = Frame.Move;
+			PendingInput.CameraYaw = Frame.CameraYaw;
+			PendingInput.Pressed |= Frame.Pressed;
+			PendingInput.Released |= Frame.Released;
+
+			const int32 Steps = Clock.Advance(static_cast<float>(FrameTime));
+			for (int32 Step = 0; Step < Steps && Recording.Inputs.Num() < Trace.Inputs.Num(); ++Step)
+				FixedTick();
+		}
+
+		bRecording = false;
+		FMovementTrace Performed = MoveTemp(Recording);
+		Recording = FMovementTrace();
+		Performed.EndLocation = GetActorLocation();
+		Clock = FFixedStepClock(FixedTickRate, MaxStepsPerFrame);
+		return Performed;
+	}
+
+	// ========== STATE MACHINE ==========
+
+	/* --------------------------------------------------------------------------
+	   Hooks of the movement state table (see MovementStateTable.h).
+
+	   • Enter / exit hooks own what a state changes on the movement component (gravity,
+	     glider visuals). Capsule and walk speed come from OnStateChanged.
+	   • Tick hooks replace the old priority chain in SimulateStep.
+	   • Running, jumping, flipping and dancing stay separate flags: they overlap the
+	     states above (a running slide, a jump buffered while crouched).
+	   -------------------------------------------------------------------------- */
+	bool APlayerCharacter::CanStartSlide() const
+	{
+		return IsGrounded() || GetGroundDistance() <= SlideAirThreshold;
+	}
+
+	bool APlayerCharacter::CanGrabLedge() const
+	{
+		return IsGrounded() && !bIsFlipping;
+	}
+
+	bool APlayerCharacter::CanGrabLadder() const
+	{
+		return !bIsJumping;
+	}
+
+	void APlayerCharacter::OnEnterState(EMovementState State, EMovementState From)
+	{
+		switch (State)
+		{
+		case EMovementState::Rolling:
+			OriginalGravityScale = GetCharacterMovement()->GravityScale;
+			GetCharacterMovement()->GravityScale /= GravityScaleDivider;
+			break;
+		case EMovementState::Gliding:
+		{
+			OriginalMeshRotation = GetMesh()->GetRelativeRotation();
+			OriginalGravityScaleBeforeGlide = GetCharacterMovement()->GravityScale;
+			GetCharacterMovement()->GravityScale = GlideGravityScale;
+			GetCharacterMovement()->bOrientRotationToMovement = false;
+			bUseControllerRotationYaw = false;
+
+			FRotator MeshRot = OriginalMeshRotation;
+			MeshRot.Yaw += GlideYawOffset;
+			GetMesh()->SetRelativeRotation(MeshRot);
+
+			if (GliderMesh)
+				GliderMesh->SetVisibility(true);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	void APlayerCharacter::OnExitState(EMovementState State, EMovementState To)
+	{
+		switch (State)
+		{
+		case EMovementState::Rolling:
+			GetCharacterMovement()->GravityScale = OriginalGravityScale;
+			break;
+		case EMovementState::Gliding:
+			GetMesh()->SetRelativeRotation(OriginalMeshRotation);
+			GetCharacterMovement()->GravityScale = OriginalGravityScaleBeforeGlide;
+			GetCharacterMovement()->bOrientRotationToMovement = false;
+			bUseControllerRotationYaw = false;
+
+			if (GliderMesh)
+				GliderMesh->SetVisibility(false);
+			break;
+		default:
+			break;
+		}
+	}
+
+	void APlayerCharacter::OnTickState(EMovementState State, float DeltaTime)
+	{
+		switch (State)
+		{
+		case EMovementState::Locomotion:
+			UpdateTraversalPrediction(DeltaTime);
+			if (States.IsIn(EMovementState::Locomotion)) // Unless it just grabbed a ledge
+				HandleJumping(DeltaTime);
+			break;
+		case EMovementState::Sliding:
+			HandleJumping(DeltaTime);
+			HandleSliding(DeltaTime);
+			break;
+		case EMovementState::Rolling:
+			HandleRolling(DeltaTime);
+			break;
+		case EMovementState::Gliding:
+			HandleGliding(DeltaTime);
+			break;
+		case EMovementState::OnLedge:
+			HandleLedgeMovement(DeltaTime);
+			break;
+		case EMovementState::LadderClimbing:
+			HandleLadderClimbing(DeltaTime);
+			break;
+		case EMovementState::LadderExiting:
+			UpdateExitLerp(DeltaTime);
+			break;
+		default:
+			break;
+		}
+	}
+
+	// Capsule and walk speed of each posture. Rolling sets its own speed, traversal doesn't walk.
+	void APlayerCharacter::OnStateChanged(const FMovementStateTransition& Transition)
+	{
+		UCharacterMovementComponent* Movement = GetCharacterMovement();
+
+		switch (Transition.To)
+		{
+		case EMovementState::Standing:
+			ApplyCapsuleHalfHeight(StandCapsuleHalfHeight);
+			Movement->MaxWalkSpeed = bIsRunning ? SprintSpeed : WalkSpeed;
+			break;
+		case EMovementState::Crouching:
+			ApplyCapsuleHalfHeight(CrouchCapsuleHalfHeight);
+			Movement->MaxWalkSpeed = CrouchSpeed;
+			break;
+		case EMovementState::Proning:
+			ApplyCapsuleHalfHeight(ProneCapsuleHalfHeight);
+			Movement->MaxWalkSpeed = ProneSpeed;
+			break;
+		case EMovementState::Sliding:
+			ApplyCapsuleHalfHeight(ProneCapsuleHalfHeight);
+			break;
+		case EMovementState::Rolling:
+			ApplyCapsuleHalfHeight(CrouchCapsuleHalfHeight);
+			break;
+		case EMovementState::Gliding:
+			Movement->MaxWalkSpeed = GlideSpeed;
+			break;
+		default:
+			break;
+		}
+
+		DIAG_LOG(Movement, Verbose, TEXT("Movement state %s -> %s (%s)"), *LexToString(Transition.From), *LexToString(Transition.To), *Transition.Reason.ToString());
+	}
+
+	void APlayerCharacter::ApplyCapsuleHalfHeight(float HalfHeight)
+	{
+		// Skipped when unchanged: the mesh is detached while leaving a ladder at the top
+		if (GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight() == HalfHeight)
+			return;
+
+		GetCapsuleComponent()->SetCapsuleHalfHeight(HalfHeight, true);
+		GetMesh()->SetRelativeLocation(FVector(0.f, 0.f, -HalfHeight));
+	}
+
+	bool APlayerCharacter::CanStartGlide() const
+	{
+		return GetCharacterMovement()->IsFalling()
+			&& GetCharacterMovement()->Velocity.Z <= GlideFallVelocityThreshold
+			&& GetGroundDistance() >= MinGlideActivationHeight;
+	}
+
+	void APlayerCharacter::LogStateHistory() const
+	{
+		if (!States.IsStarted())
+			return;
+
+		DIAG_LOG(Movement, Log, TEXT("Movement state %s, last transitions:"), *LexToString(States.GetCurrent()));
+		for (const FMovementStateTransition& Transition : States.GetHistory())
+			DIAG_LOG(Movement, Log, TEXT("  tick %lld: %s -> %s (%s)"), Transition.Tick, *LexToString(Transition.From), *LexToString(Transition.To), *Transition.Reason.ToString());
+	}
+
 	// ========== UTILITY METHODS ==========
 
 	bool APlayerCharacter::IsGrounded() const
@@ -1040,7 +1593,7 @@
 		// Start at capsule bottom
 		FVector Start = GetActorLocation() - FVector(0.f, 0.f, HalfHeight);
 		FVector End   = Start - FVector(0.f, 0.f, GroundCheckDistance);
-		DrawDebugLine(GetWorld(), Start, End, FColor::Green, false, 1.f, 0, 2.f);
+		DIAG_LINE(GetWorld(), Movement, Start, End, FColor::Green, 1.f);
 
 		FHitResult Hit;
 		FCollisionQueryParams Params;
@@ -1090,15 +1643,15 @@
 
 		if (OtherActor->ActorHasTag(LadderTag))
 		{
-			if (!bIsLadderClimbing && !bIsExitingLadder)
+			if (!IsLadderClimbing() && !IsExitingLadder())
 				LadderCandidate = OtherActor;
 				startingLadderZ = GetActorLocation().Z;
-				UE_LOG(LogTemp, Warning, TEXT("ENTERING ladder at Z=%f"), GetActorLocation().Z);
+				DIAG_LOG(Movement, Verbose, TEXT("ENTERING ladder at Z=%f"), GetActorLocation().Z);
 		}
 
 		if (OtherActor->ActorHasTag(LedgeTag))
 		{
-			if (!bIsOnLedge && !bLedgeExitCooldown)
+			if (!IsOnLedge() && !bLedgeExitCooldown)
 				TryEnterLedge(OtherActor);
 		}
 	}
@@ -1114,14 +1667,14 @@
 				LadderCandidate = nullptr;
 
 			// Handle exit from ladder while climbing
-			if (bIsLadderClimbing && CurrentLadder != nullptr && OtherActor == CurrentLadder)
+			if (IsLadderClimbing() && CurrentLadder != nullptr && OtherActor == CurrentLadder)
 			{
 				// In this case I check only as if the ladder is always a grounded ladder (no flying ladders)
 				bool bExitingFromTop = startingLadderZ < GetActorLocation().Z;
 
 				if (bExitingFromTop)
 				{
-					UE_LOG(LogTemp, Warning, TEXT("Exiting ladder from TOP at Z=%f"), GetActorLocation().Z);
+					DIAG_LOG(Movement, Verbose, TEXT("Exiting ladder from TOP at Z=%f"), GetActorLocation().Z);
 					StartLadderTopExit();
 				}
 			}
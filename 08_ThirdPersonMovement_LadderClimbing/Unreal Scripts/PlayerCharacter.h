@@ -7,10 +7,13 @@
 #include "InputActionValue.h"
 #include "Camera/CameraComponent.h"
 #include "GameFramework/SpringArmComponent.h"
+#include "MovementSimulation.h"
+#include "MovementStateTable.h"
+#include "TraversalRegistrySubsystem.h"
 #include "PlayerCharacter.generated.h"
 
 UCLASS()
-class MECHANICS_TEST_LVN_API APlayerCharacter : public ACharacter
+class MECHANICS_TEST_LVN_API APlayerCharacter : public ACharacter, public IMovementStateHooks
 {
 	GENERATED_BODY()
 
@@ -238,22 +241,54 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Ladder")
 	float LadderRotationOffset = 180.f;
 
+	// Climbing up within this distance of the ladder's baked top starts the top exit, even without the top trigger
+	UPROPERTY(EditAnywhere, Category = "Ladder")
+	float LadderTopExitThreshold = 25.f;
+
+	// Traversal public properties [Ledges and ladders come from UTraversalRegistrySubsystem, baked at BeginPlay]
+	UPROPERTY(EditAnywhere, Category = "Traversal")
+	bool bPredictiveTraversal = true;
+
+	// Seconds of the current motion swept ahead when looking for a ledge or ladder to grab
+	UPROPERTY(EditAnywhere, Category = "Traversal")
+	float TraversalLookAhead = 0.2f;
+
+	// Extra reach over the ledge / ladder offsets when grabbing early
+	UPROPERTY(EditAnywhere, Category = "Traversal")
+	float TraversalGrabDistance = 35.f;
+
+	// Simulation public properties [Fixed step runs movement at FixedTickRate whatever the frame rate, so recorded input replays identically]
+	UPROPERTY(EditAnywhere, Category = "Simulation")
+	bool bUseFixedStep = false;
+
+	UPROPERTY(EditAnywhere, Category = "Simulation")
+	int32 FixedTickRate = 60;
+
+	UPROPERTY(EditAnywhere, Category = "Simulation")
+	int32 MaxStepsPerFrame = 8;
+
+	// When jump, flip and prone transition events fire, on the simulation clock. Uses the class defaults when empty.
+	UPROPERTY(EditAnywhere, Category = "Simulation")
+	UMovementEventTimeline* EventTimeline = nullptr;
+
+	// Variable step only: while the mesh is rendered, timeline events wait for their notifies
+	UPROPERTY(EditAnywhere, Category = "Simulation")
+	bool bSyncEventsToAnimation = true;
+
+	// State machine public properties [Posture and traversal live in States, see MovementStateTable.h]
+	UPROPERTY(EditAnywhere, Category = "State Machine")
+	int32 StateHistoryLength = 32;
+
+	// Orthogonal to the movement state: the character can be running while sliding, jumping while crouched...
 	bool bIsRunning = false;
 	bool bIsDancing = false;
 	bool bIsJumping = false;
 	bool bIsFlipping = false;
-	bool bIsCrouching = false;
-	bool bIsProning = false;
-	bool bIsSliding = false;
-	bool bIsRolling = false;
-	bool bIsGliding = false;
-	bool bIsOnLedge = false;
-	bool bIsLadderClimbing = false;
-	bool bIsExitingLadder = false;
 	bool bIsAtTopOfLadder = false;
 
 private:
 	FVector2D MovementInput;
+	FVector2D LiveMovementInput = FVector2D::ZeroVector; // Fixed step: latest Move value, sampled into the next tick
 	
 	// Jump
 	bool bJumpInputQueued = false;
@@ -300,6 +335,15 @@ private:
 	float startingLadderZ = 0.f;
 	FVector LadderAttachBase = FVector::ZeroVector;
 
+	// Traversal
+	UPROPERTY()
+	UTraversalRegistrySubsystem* Traversal = nullptr;
+	FTraversalFeature CurrentLadderFeature;
+	FTraversalFeature CurrentLedgeFeature;
+	AActor* PredictedLadder = nullptr;
+	FVector LastTickLocation = FVector::ZeroVector;
+	FVector TickMotion = FVector::ZeroVector; // Displacement over the last simulation tick, what the predictive grab sweeps ahead
+
 	// Exit lerp data
 	FVector ExitStartLocation = FVector::ZeroVector;
 	FVector ExitTargetLocation = FVector::ZeroVector;
@@ -310,6 +354,28 @@ private:
 	// Prone transition
 	bool bIsInProneTransition = false;
 
+	// State machine
+	FMovementStateMachine States;
+
+	// Timed movement events, see UMovementEventTimeline
+	FMovementEventPlayer MovementEvents;
+
+	// Fixed step
+	FFixedStepClock Clock;
+	FMovementTickInput PendingInput;  // Buttons since the last tick
+	FMovementTickInput TickInput;     // What the current tick runs on
+	bool bInFixedTick = false;
+	FVector PreviousLocation = FVector::ZeroVector;
+	FVector AppliedMeshOffset = FVector::ZeroVector;
+
+	// Record / replay
+	bool bRecording = false;
+	FMovementTrace Recording;
+	FMovementTrace LastTrace;
+	const FMovementTrace* Replay = nullptr;
+	int32 ReplayTick = 0;
+	bool bReplayIsLive = false;
+
 	// Input Handlers
 	void Move(const FInputActionValue& Value);
 	void StopMove(const FInputActionValue& Value);
@@ -323,9 +389,14 @@ private:
 	void ToggleProne();
 	void GlidePressed();
 	void GlideReleased();
+	void StopGliding(FName Reason);
 	void ClimbPressed();
+	bool DeferToTick(EMovementButton Button, bool bPressed = true);
+	void ApplyMoveInput(float DeltaTime);
+	FRotator GetMoveBasis() const;
 
 	// Movement Systems
+	void SimulateStep(float DeltaTime);
 	void HandleMovement(float DeltaTime);
 	void HandleJumping(float DeltaTime);
 	void HandleSliding(float DeltaTime);
@@ -359,10 +430,41 @@ private:
 	void FinishLadderExitCleanup();
 	void ReattachMeshAfterLadderClimb();
 
-	// Utility methods
-	bool CanStandUp() const;
-	bool CanCrouchUpFromProne() const;
-	bool IsGrounded() const;
+	// Traversal methods
+	void UpdateTraversalPrediction(float DeltaTime);
+
+	// Movement event methods
+	void OnMovementEvent(EMovementEvent Event);
+	void NotifyMovementEvent(EMovementEvent Event);
+	bool IsSyncingEventsToAnimation() const;
+
+	// State machine methods
+	void OnStateChanged(const FMovementStateTransition& Transition);
+	void ApplyCapsuleHalfHeight(float HalfHeight);
+
+	// IMovementStateHooks
+	virtual bool IsGrounded() const override;
+	virtual bool CanStartSlide() const override;
+	virtual bool CanStartGlide() const override;
+	virtual bool CanGrabLedge() const override;
+	virtual bool CanGrabLadder() const override;
+	virtual bool CanStandUp() const override;
+	virtual bool CanCrouchUpFromProne() const override;
+	virtual void OnEnterState(EMovementState State, EMovementState From) override;
+	virtual void OnExitState(EMovementState State, EMovementState To) override;
+	virtual void OnTickState(EMovementState State, float DeltaTime) override;
+
+	// Fixed step methods
+	void FixedTick();
+	void DispatchTickInput(const FMovementTickInput& Input);
+	void ScheduleJumpImpulse(bool bFlip);
+	void LaunchJump();
+	void LaunchFlip();
+	void StopFlip();
+	void RemoveMeshInterpolation();
+	void ApplyMeshInterpolation(float Alpha);
+	void StartReplay(const FMovementTrace& Trace, bool bLive);
+	void EndReplay();
 
 	// Overlap handlers
 	UFUNCTION()
@@ -383,12 +485,48 @@ public:
 	void EndFlip();
 
 	UFUNCTION(BlueprintCallable, Category = "Animation")
-	void StartProneTransition() { bIsInProneTransition = true; }
+	void StartProneTransition();
 
 	UFUNCTION(BlueprintCallable, Category = "Animation")
-	void EndProneTransition() { bIsInProneTransition = false; }
+	void EndProneTransition();
+
+	// Simulation
+	UFUNCTION(BlueprintCallable, Category = "Simulation")
+	FMovementSimState CaptureMovementState() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Simulation")
+	void RestoreMovementState(const FMovementSimState& State);
+
+	UFUNCTION(BlueprintCallable, Category = "Simulation")
+	void StartInputRecording();
+
+	UFUNCTION(BlueprintCallable, Category = "Simulation")
+	void StopInputRecording();
+
+	UFUNCTION(BlueprintCallable, Category = "Simulation")
+	bool IsRecordingInput() const { return bRecording; }
+
+	UFUNCTION(BlueprintCallable, Category = "Simulation")
+	void ReplayLastRecording();
+
+	// One fixed-step tick on Input right now, outside the frame's clock. Tests drive the simulation through this.
+	void SimulateTick(const FMovementTickInput& Input);
+
+	// Every tick of Trace right now, from its start state. Returns where it ended. Tests check replays through this.
+	FVector ReplayTrace(const FMovementTrace& Trace);
+
+	// Trace performed as live input at FrameRate within this frame, through the same latching and clock as Tick.
+	// Returns what the ticks actually consumed. Tests check frame rate independence through this.
+	FMovementTrace PerformTrace(const FMovementTrace& Trace, int32 FrameRate);
+
+	// State machine
+	UFUNCTION(BlueprintCallable, Category = "State Machine")
+	void LogStateHistory() const;
 
 	// Getters
+	UFUNCTION(BlueprintCallable, Category = "State")
+	EMovementState GetMovementState() const { return States.GetCurrent(); }
+
 	UFUNCTION(BlueprintCallable, Category = "State")
 	bool IsRunning() const { return bIsRunning; }
 
@@ -402,28 +540,28 @@ public:
 	bool IsFlipping() const { return bIsFlipping; }
 
 	UFUNCTION(BlueprintCallable, Category = "State")
-	bool IsPlayerCrouching() const { return bIsCrouching; }
+	bool IsPlayerCrouching() const { return States.IsIn(EMovementState::Crouched); } // Also true while prone
 
 	UFUNCTION(BlueprintCallable, Category = "State")
-	bool IsPlayerProning() const { return bIsProning; }
+	bool IsPlayerProning() const { return States.IsIn(EMovementState::Proning); }
 
 	UFUNCTION(BlueprintCallable, Category = "State")
-	bool IsSliding() const { return bIsSliding; }
+	bool IsSliding() const { return States.IsIn(EMovementState::Sliding); }
 
 	UFUNCTION(BlueprintCallable, Category = "State")
-	bool IsPlayerRolling() const { return bIsRolling; }
+	bool IsPlayerRolling() const { return States.IsIn(EMovementState::Rolling); }
 
 	UFUNCTION(BlueprintCallable, Category = "State")
-	bool IsGliding() const { return bIsGliding; }
+	bool IsGliding() const { return States.IsIn(EMovementState::Gliding); }
 
 	UFUNCTION(BlueprintCallable, Category = "State")
-	bool IsOnLedge() const { return bIsOnLedge; }
+	bool IsOnLedge() const { return States.IsIn(EMovementState::OnLedge); }
 
 	UFUNCTION(BlueprintCallable, Category = "State")
-	bool IsLadderClimbing() const { return bIsLadderClimbing; }
+	bool IsLadderClimbing() const { return States.IsIn(EMovementState::LadderClimbing); }
 
 	UFUNCTION(BlueprintCallable, Category = "State")
-	bool IsExitingLadder() const { return bIsExitingLadder; }
+	bool IsExitingLadder() const { return States.IsIn(EMovementState::LadderExiting); }
 
 	UFUNCTION(BlueprintCallable, Category = "State")
 	bool IsLedgeIdleLeft() const { return bIsLedgeIdleLeft; }
@@ -0,0 +1,97 @@
+#include "Misc/AutomationTest.h"
+#include "PerfTesting.h"
+#include "MovementTestScene.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Times the player in a temporary world on a flat floor, compared with PerfBaselines/Movement.json: single fixed-step ticks
+// on synthetic input (walking and running in circles, then the same with a jump every 1.5 s), then whole world ticks on idle input.
+// The camera boom's update is also held to the camera's 0.05 ms budget, in the open and with a wall pulling it in.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Movement.Performance; Quit" -nullrhi -unattended
+
+namespace MovementPerformanceTests
+{
+	constexpr int32 Ticks = 2000;
+	constexpr double CameraBudgetMs = 0.05;
+
+	// Walking in circles with run toggled every 200 ticks, plus a jump every 90 ticks when bJumping
+	FMovementTickInput SyntheticInput(int32 Tick, bool bJumping)
+	{
+		const float Angle = Tick * 0.02f;
+		FMovementTickInput Input;
+		Input.Move = FVector2D(FMath::Sin(Angle), FMath::Cos(Angle));
+		if (Tick % 400 == 200) Input.Pressed |= MovementButtonBit(EMovementButton::Run);
+		if (Tick % 400 == 0) Input.Released |= MovementButtonBit(EMovementButton::Run);
+		if (bJumping && Tick % 90 == 0) Input.Pressed |= MovementButtonBit(EMovementButton::Jump);
+		return Input;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMovementPerformanceTicksTest, "LVN.Movement.Performance.Ticks", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMovementPerformanceTicksTest::RunTest(const FString& Parameters)
+{
+	using namespace MovementPerformanceTests;
+
+	FPerfTestWorld World;
+	APlayerCharacter* Player = MovementTestScene::Spawn(World.Get());
+	if (!TestNotNull(TEXT("Player"), Player))
+		return false;
+
+	// Each tick goes through FixedTick, so the times include the movement component
+	const FMovementSimState Start = Player->CaptureMovementState();
+	FPerfRecorder Recorder;
+	Recorder.Measure(TEXT("Tick_Locomotion"), Ticks, [Player](int32 Tick) { Player->SimulateTick(SyntheticInput(Tick, false)); });
+	Player->RestoreMovementState(Start);
+
+	Recorder.Measure(TEXT("Tick_Jumping"), Ticks, [Player](int32 Tick) { Player->SimulateTick(SyntheticInput(Tick, true)); });
+	Player->RestoreMovementState(Start);
+
+	return Recorder.CheckBaseline(*this, TEXT("Movement"), __FILE__);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMovementPerformanceFramesTest, "LVN.Movement.Performance.Frames", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMovementPerformanceFramesTest::RunTest(const FString& Parameters)
+{
+	using namespace MovementPerformanceTests;
+
+	FPerfTestWorld World;
+	if (!TestNotNull(TEXT("Player"), MovementTestScene::Spawn(World.Get())))
+		return false;
+
+	FPerfRecorder Recorder;
+	Recorder.MeasureTicks(TEXT("Frame_Player"), World, 300, [](int32) {});
+	return Recorder.CheckBaseline(*this, TEXT("Movement"), __FILE__);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMovementPerformanceCameraTest, "LVN.Movement.Performance.Camera", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMovementPerformanceCameraTest::RunTest(const FString& Parameters)
+{
+	using namespace MovementPerformanceTests;
+
+	FPerfTestWorld World;
+	APlayerCharacter* Player = MovementTestScene::Spawn(World.Get());
+	if (!TestNotNull(TEXT("Player"), Player))
+		return false;
+
+	// Each sample is one spring arm update: its collision probe, lag and the camera transform
+	USpringArmComponent* Boom = Player->CameraBoom;
+	auto TickBoom = [Boom](int32) { Boom->TickComponent(1.f / 60.f, LEVELTICK_All, nullptr); };
+
+	FPerfRecorder Recorder;
+	Recorder.Measure(TEXT("Camera_Open"), Ticks, TickBoom);
+
+	// Behind the player, across the arm, so every probe hits it
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AStaticMeshActor* Wall = World.Get()->SpawnActor<AStaticMeshActor>(FVector(-200.f, 0.f, 150.f), FRotator::ZeroRotator, Params);
+	Wall->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
+	Wall->GetStaticMeshComponent()->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")));
+	Wall->SetActorScale3D(FVector(0.5f, 10.f, 5.f));
+	Recorder.Measure(TEXT("Camera_Collision"), Ticks, TickBoom);
+
+	const bool bOpenWithinBudget = Recorder.CheckBudget(*this, TEXT("Camera_Open"), CameraBudgetMs);
+	const bool bCollisionWithinBudget = Recorder.CheckBudget(*this, TEXT("Camera_Collision"), CameraBudgetMs);
+	return Recorder.CheckBaseline(*this, TEXT("Movement"), __FILE__) && bOpenWithinBudget && bCollisionWithinBudget;
+}
+
+#endif
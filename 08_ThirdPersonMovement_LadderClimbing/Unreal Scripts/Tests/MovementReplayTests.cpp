@@ -0,0 +1,129 @@
+#include "Misc/AutomationTest.h"
+#include "PerfTesting.h"
+#include "MovementTestScene.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Replay regression on the traces below (60 Hz input on a flat floor, locomotion, jumps, slides and rolls only: ledge and
+// ladder entry come from overlap events, which don't run during an in-frame replay). Each trace is recorded by replaying
+// it, then must replay bit for bit. Performed as live input at 30, 60 and 144 fps (sampled once per frame and latched until
+// a tick spends it), every run must keep every button change, replay bit for bit from what it consumed and end in the same
+// state as the others.
+//
+// The runs' end locations are compared within FrameRateTolerance rather than bit for bit: latched input reaches the
+// simulation up to one tick earlier at 30 and 144 fps than at 60, so each change of stick or button can move the end
+// by one tick of travel.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Movement.Replay; Quit" -nullrhi -unattended
+
+namespace MovementReplayTests
+{
+	constexpr int32 TickRate = 60;
+	constexpr int32 Ticks = 600;
+	constexpr float FrameRateTolerance = 25.f;
+	const int32 FrameRates[] = { 30, 60, 144 };
+
+	FVector2D Circle(int32 Tick)
+	{
+		return FVector2D(FMath::Sin(Tick * 0.02f), FMath::Cos(Tick * 0.02f));
+	}
+
+	// Bit of Button when Tick is one of OnTicks
+	int32 ButtonOn(EMovementButton Button, int32 Tick, std::initializer_list<int32> OnTicks)
+	{
+		for (int32 On : OnTicks)
+		{
+			if (On == Tick) return MovementButtonBit(Button);
+		}
+		return 0;
+	}
+
+	// Walking in circles, running for the middle third
+	FMovementTickInput Locomotion(int32 Tick)
+	{
+		FMovementTickInput Input;
+		Input.Move = Circle(Tick);
+		Input.Pressed = ButtonOn(EMovementButton::Run, Tick, { 200 });
+		Input.Released = ButtonOn(EMovementButton::Run, Tick, { 400 });
+		return Input;
+	}
+
+	// Running forward with a jump every 1.5 s, a double jump in the middle
+	FMovementTickInput Jumps(int32 Tick)
+	{
+		FMovementTickInput Input;
+		Input.Move = FVector2D(1.f, 0.f);
+		Input.Pressed = ButtonOn(EMovementButton::Run, Tick, { 0 });
+		if (Tick % 90 == 30 || Tick == 285) Input.Pressed |= MovementButtonBit(EMovementButton::Jump);
+		return Input;
+	}
+
+	// Running into a slide, standing back up, then a roll and a crouched walk
+	FMovementTickInput SlideAndRoll(int32 Tick)
+	{
+		FMovementTickInput Input;
+		Input.Move = Tick < 480 ? FVector2D(1.f, 0.f) : Circle(Tick);
+		Input.Pressed = ButtonOn(EMovementButton::Run, Tick, { 0 }) | ButtonOn(EMovementButton::Crouch, Tick, { 120, 420 })
+			| ButtonOn(EMovementButton::Roll, Tick, { 300 });
+		Input.Released = ButtonOn(EMovementButton::Run, Tick, { 300 }) | ButtonOn(EMovementButton::Crouch, Tick, { 180 });
+		return Input;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMovementReplayTracesTest, "LVN.Movement.Replay.Traces", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMovementReplayTracesTest::RunTest(const FString& Parameters)
+{
+	using namespace MovementReplayTests;
+
+	FPerfTestWorld World;
+	APlayerCharacter* Player = MovementTestScene::Spawn(World.Get());
+	if (!TestNotNull(TEXT("Player"), Player))
+		return false;
+
+	for (int32 i = 0; i < 10; i++)
+		World.Tick(); // BeginPlay runs and the player settles on the floor
+	Player->SetActorTickEnabled(false); // Only the test ticks it from here
+
+	const FMovementSimState Start = Player->CaptureMovementState();
+	const TPair<const TCHAR*, FMovementTickInput(*)(int32)> Traces[] =
+	{
+		{ TEXT("Locomotion"), &Locomotion },
+		{ TEXT("Jumps"), &Jumps },
+		{ TEXT("SlideAndRoll"), &SlideAndRoll },
+	};
+
+	for (const TPair<const TCHAR*, FMovementTickInput(*)(int32)>& Entry : Traces)
+	{
+		const FString Name = Entry.Key;
+		FMovementTrace Trace;
+		Trace.TickRate = TickRate;
+		Trace.Start = Start;
+		for (int32 Tick = 0; Tick < Ticks; Tick++)
+			Trace.Inputs.Add(Entry.Value(Tick));
+		Trace.EndLocation = Player->ReplayTrace(Trace);
+
+		// FVector == is exact, replays have to match bit for bit
+		TestTrue(Name + TEXT(": replay matches the recording"), Player->ReplayTrace(Trace) == Trace.EndLocation);
+
+		FVector Ends[UE_ARRAY_COUNT(FrameRates)];
+		EMovementState States[UE_ARRAY_COUNT(FrameRates)];
+		for (int32 i = 0; i < UE_ARRAY_COUNT(FrameRates); i++)
+		{
+			const FString Run = FString::Printf(TEXT("%s at %d fps"), *Name, FrameRates[i]);
+			const FMovementTrace Performed = Player->PerformTrace(Trace, FrameRates[i]);
+			Ends[i] = Performed.EndLocation;
+			States[i] = Player->GetMovementState();
+
+			TestEqual(Run + TEXT(": button changes spent"), Performed.CountButtonChanges(), Trace.CountButtonChanges());
+			TestTrue(Run + TEXT(": replays bit for bit"), Player->ReplayTrace(Performed) == Performed.EndLocation);
+			TestEqual(Run + TEXT(": end state"), static_cast<int32>(States[i]), static_cast<int32>(States[0]));
+			TestTrue(FString::Printf(TEXT("%s: ended %.3f cm from %d fps"), *Run, FVector::Dist(Ends[i], Ends[0]), FrameRates[0]),
+				FVector::Dist(Ends[i], Ends[0]) <= FrameRateTolerance);
+		}
+
+		AddInfo(FString::Printf(TEXT("%s (%d ticks): 30 fps %s, 60 fps %s, 144 fps %s, recorded %s"), *Name, Ticks,
+			*Ends[0].ToString(), *Ends[1].ToString(), *Ends[2].ToString(), *Trace.EndLocation.ToString()));
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,170 @@
+#include "Misc/AutomationTest.h"
+#include "MovementStateTable.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Drives the movement state table with fake guards: every state is reachable and leads back to Standing, transitions
+// that would break movement don't exist, guards gate their edges, and hooks run in order on the right states.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Movement.StateTable; Quit" -nullrhi -unattended
+
+namespace MovementStateTableTests
+{
+    using S = EMovementState;
+
+    struct FFakeHooks : IMovementStateHooks
+    {
+        bool bGrounded = true, bSlide = true, bGlide = true, bLedge = true, bLadder = true, bStandUp = true, bCrouchUp = true;
+        TArray<FString> Calls;
+
+        virtual bool IsGrounded() const override { return bGrounded; }
+        virtual bool CanStartSlide() const override { return bSlide; }
+        virtual bool CanStartGlide() const override { return bGlide; }
+        virtual bool CanGrabLedge() const override { return bLedge; }
+        virtual bool CanGrabLadder() const override { return bLadder; }
+        virtual bool CanStandUp() const override { return bStandUp; }
+        virtual bool CanCrouchUpFromProne() const override { return bCrouchUp; }
+
+        virtual void OnEnterState(S State, S From) override { Calls.Add(FString::Printf(TEXT("enter %s from %s"), *LexToString(State), *LexToString(From))); }
+        virtual void OnExitState(S State, S To) override { Calls.Add(FString::Printf(TEXT("exit %s to %s"), *LexToString(State), *LexToString(To))); }
+        virtual void OnTickState(S State, float DeltaTime) override { Calls.Add(FString::Printf(TEXT("tick %s"), *LexToString(State))); }
+    };
+
+    // Started in Standing, with the start left out of the recorded calls
+    void StartTable(FMovementStateMachine& Table, FFakeHooks& Hooks)
+    {
+        FMovementStateTable::Build(Table, Hooks);
+        Table.Start(S::Standing);
+        Hooks.Calls.Reset();
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMovementStateTableShapeTest, "LVN.Movement.StateTable.Shape", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMovementStateTableShapeTest::RunTest(const FString& Parameters)
+{
+    using namespace MovementStateTableTests;
+
+    FFakeHooks Hooks;
+    FMovementStateMachine Table(8);
+    FMovementStateTable::Build(Table, Hooks);
+
+    TArray<FString> Errors;
+    TestTrue(TEXT("Table is valid"), Table.Validate(Errors));
+    for (const FString& Error : Errors)
+        AddError(Error);
+
+    for (S State : Table.GetLeaves())
+    {
+        TestTrue(FString::Printf(TEXT("%s can be reached from Standing"), *LexToString(State)), Table.IsReachable(S::Standing, State));
+        TestTrue(FString::Printf(TEXT("%s leads back to Standing"), *LexToString(State)), Table.IsReachable(State, S::Standing));
+    }
+
+    const TPair<S, S> Forbidden[] =
+    {
+        { S::Standing, S::Proning },
+        { S::Standing, S::LadderExiting },
+        { S::Crouching, S::Rolling },
+        { S::Proning, S::Sliding },
+        { S::Sliding, S::Rolling },
+        { S::Sliding, S::Gliding },
+        { S::Rolling, S::Sliding },
+        { S::Rolling, S::Gliding },
+        { S::Gliding, S::Crouching },
+        { S::Gliding, S::Rolling },
+        { S::OnLedge, S::LadderClimbing },
+        { S::LadderClimbing, S::OnLedge },
+        { S::LadderExiting, S::LadderClimbing }
+    };
+    for (const TPair<S, S>& Pair : Forbidden)
+    {
+        TestFalse(FString::Printf(TEXT("%s -> %s is not declared"), *LexToString(Pair.Key), *LexToString(Pair.Value)), Table.HasEdge(Pair.Key, Pair.Value));
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMovementStateTableGuardsTest, "LVN.Movement.StateTable.Guards", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMovementStateTableGuardsTest::RunTest(const FString& Parameters)
+{
+    using namespace MovementStateTableTests;
+
+    FFakeHooks Hooks;
+    FMovementStateMachine Table(8);
+    StartTable(Table, Hooks);
+
+    Hooks.bGrounded = false;
+    TestFalse(TEXT("No crouch in the air"), Table.TryTransition(S::Crouching, TEXT("Test")));
+    TestFalse(TEXT("No roll in the air"), Table.TryTransition(S::Rolling, TEXT("Test")));
+
+    Hooks.bGrounded = true;
+    TestTrue(TEXT("Slide"), Table.TryTransition(S::Sliding, TEXT("Test")));
+
+    // Leaving a slide needs room for the crouch, and for standing on top of it
+    Hooks.bCrouchUp = false;
+    TestFalse(TEXT("Slide can't end in a crouch without room"), Table.TryTransition(S::Crouching, TEXT("Test")));
+    TestFalse(TEXT("Slide can't end standing without room"), Table.TryTransition(S::Standing, TEXT("Test")));
+    TestTrue(TEXT("Slide can always end prone"), Table.TryTransition(S::Proning, TEXT("Test")));
+
+    Hooks.bCrouchUp = true;
+    Hooks.bStandUp = false;
+    TestTrue(TEXT("Prone to crouch"), Table.TryTransition(S::Crouching, TEXT("Test")));
+    TestFalse(TEXT("Crouch can't stand without room"), Table.TryTransition(S::Standing, TEXT("Test")));
+
+    Hooks.bStandUp = true;
+    TestTrue(TEXT("Crouch to stand"), Table.TryTransition(S::Standing, TEXT("Test")));
+
+    Hooks.bLedge = false;
+    Hooks.bLadder = false;
+    TestFalse(TEXT("Ledge guard"), Table.TryTransition(S::OnLedge, TEXT("Test")));
+    TestFalse(TEXT("Ladder guard"), Table.TryTransition(S::LadderClimbing, TEXT("Test")));
+    TestTrue(TEXT("Still standing"), Table.GetCurrent() == S::Standing);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMovementStateTableHooksTest, "LVN.Movement.StateTable.Hooks", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMovementStateTableHooksTest::RunTest(const FString& Parameters)
+{
+    using namespace MovementStateTableTests;
+
+    FFakeHooks Hooks;
+    FMovementStateMachine Table(8);
+    StartTable(Table, Hooks);
+
+    // Exits run from the leaf up to the common parent, enters from below it down to the new leaf
+    Table.TryTransition(S::Crouching, TEXT("Test"));
+    Table.TryTransition(S::Proning, TEXT("Test"));
+    Table.TryTransition(S::Crouching, TEXT("Test"));
+    Table.TryTransition(S::Standing, TEXT("Test"));
+
+    const TArray<FString> Expected =
+    {
+        TEXT("exit Standing to Crouching"),
+        TEXT("enter Crouched from Standing"),
+        TEXT("enter Crouching from Standing"),
+        TEXT("exit Crouching to Proning"),
+        TEXT("enter Proning from Crouching"),
+        TEXT("exit Proning to Crouching"),
+        TEXT("enter Crouching from Proning"),
+        TEXT("exit Crouching to Standing"),
+        TEXT("exit Crouched to Standing"),
+        TEXT("enter Standing from Crouching")
+    };
+    TestEqual(TEXT("Hook calls"), FString::Join(Hooks.Calls, TEXT(", ")), FString::Join(Expected, TEXT(", ")));
+
+    // Leaves without a tick run their parent's
+    Hooks.Calls.Reset();
+    Table.Tick(0.1f);
+    Table.TryTransition(S::Rolling, TEXT("Test"));
+    Table.Tick(0.1f);
+    Table.TryTransition(S::Crouching, TEXT("Test"));
+    Table.Tick(0.1f);
+    Table.TryTransition(S::Standing, TEXT("Test"));
+    Table.TryTransition(S::LadderClimbing, TEXT("Test"));
+    Table.TryTransition(S::LadderExiting, TEXT("Test"));
+    Table.Tick(0.1f);
+
+    const TArray<FString> Ticks = Hooks.Calls.FilterByPredicate([](const FString& Call) { return Call.StartsWith(TEXT("tick")); });
+    const TArray<FString> ExpectedTicks = { TEXT("tick Locomotion"), TEXT("tick Rolling"), TEXT("tick Locomotion"), TEXT("tick LadderExiting") };
+    TestEqual(TEXT("Tick calls"), FString::Join(Ticks, TEXT(", ")), FString::Join(ExpectedTicks, TEXT(", ")));
+    return true;
+}
+
+#endif
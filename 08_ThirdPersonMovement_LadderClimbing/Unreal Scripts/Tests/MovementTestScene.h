@@ -0,0 +1,28 @@
+#pragma once
+
+#include "PlayerCharacter.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "Components/StaticMeshComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// The scene the movement tests run the player in: a flat floor and the player standing on it
+namespace MovementTestScene
+{
+	inline APlayerCharacter* Spawn(UWorld* World)
+	{
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		AStaticMeshActor* Floor = World->SpawnActor<AStaticMeshActor>(FVector(0.f, 0.f, -50.f), FRotator::ZeroRotator, Params);
+		Floor->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable); // Static meshes can't change once play began
+		Floor->GetStaticMeshComponent()->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")));
+		Floor->SetActorScale3D(FVector(500.f, 500.f, 1.f));
+
+		return World->SpawnActor<APlayerCharacter>(FVector(0.f, 0.f, 100.f), FRotator::ZeroRotator, Params);
+	}
+}
+
+#endif
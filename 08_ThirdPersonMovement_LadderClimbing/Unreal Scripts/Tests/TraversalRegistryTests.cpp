@@ -0,0 +1,146 @@
+#include "Misc/AutomationTest.h"
+#include "PerfTesting.h"
+#include "TraversalRegistrySubsystem.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Bakes box ladders into a temporary world's UTraversalRegistrySubsystem (default 4 m cells) and queries it: features
+// spanning cell boundaries are found from every cell they touch, queries hit inside the look-ahead reach and miss just
+// beyond it, the top height and exit point come from the bounds and the ExitPoint component, and moved ladders stay
+// stale until Rebake.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Movement.Traversal; Quit" -nullrhi -unattended
+
+namespace TraversalRegistryTests
+{
+	constexpr float Reach = 50.f;
+	const FName LadderTag(TEXT("Ladder"));
+	const FName LedgeTag(TEXT("Ledge"));
+
+	// A 50 x 10 x Height cm box ladder standing on Foot
+	AStaticMeshActor* SpawnLadder(UWorld* World, const FVector& Foot, float Height)
+	{
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		AStaticMeshActor* Ladder = World->SpawnActor<AStaticMeshActor>(Foot + FVector(0.f, 0.f, Height * 0.5f), FRotator::ZeroRotator, Params);
+		Ladder->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
+		Ladder->GetStaticMeshComponent()->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")));
+		Ladder->SetActorScale3D(FVector(0.5f, 0.1f, Height / 100.f));
+		Ladder->Tags.Add(LadderTag);
+		return Ladder;
+	}
+
+	bool Find(const UTraversalRegistrySubsystem* Registry, const FVector& Location, const FVector& Motion = FVector::ZeroVector)
+	{
+		FTraversalFeature Feature;
+		float T = 0.f;
+		return Registry->FindNearest(ETraversalKind::Ladder, Location, Motion, Reach, Feature, T);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTraversalRegistryCellsTest, "LVN.Movement.Traversal.CellBoundaries", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FTraversalRegistryCellsTest::RunTest(const FString& Parameters)
+{
+	using namespace TraversalRegistryTests;
+
+	FPerfTestWorld World;
+	UTraversalRegistrySubsystem* Registry = World.Get()->GetSubsystem<UTraversalRegistrySubsystem>();
+	if (!TestNotNull(TEXT("TraversalRegistrySubsystem"), Registry))
+		return false;
+
+	// From z -200 to 1000: cells -1 to 2. Each query below only reaches into one of them.
+	SpawnLadder(World.Get(), FVector(400.f, 0.f, -200.f), 1200.f);
+	Registry->Rebake(LadderTag, LedgeTag);
+
+	TestEqual(TEXT("Features"), Registry->GetFeatureCount(), 1);
+	TestTrue(TEXT("From cell z -1"), Find(Registry, FVector(430.f, 0.f, -150.f)));
+	TestTrue(TEXT("From cell z 0"), Find(Registry, FVector(430.f, 0.f, 100.f)));
+	TestTrue(TEXT("From cell z 1"), Find(Registry, FVector(430.f, 0.f, 500.f)));
+	TestTrue(TEXT("From cell z 2"), Find(Registry, FVector(430.f, 0.f, 930.f)));
+	TestFalse(TEXT("Above the ladder"), Find(Registry, FVector(430.f, 0.f, 1080.f)));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTraversalRegistryLookAheadTest, "LVN.Movement.Traversal.LookAheadEdge", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FTraversalRegistryLookAheadTest::RunTest(const FString& Parameters)
+{
+	using namespace TraversalRegistryTests;
+
+	FPerfTestWorld World;
+	UTraversalRegistrySubsystem* Registry = World.Get()->GetSubsystem<UTraversalRegistrySubsystem>();
+	if (!TestNotNull(TEXT("TraversalRegistrySubsystem"), Registry))
+		return false;
+
+	SpawnLadder(World.Get(), FVector::ZeroVector, 300.f);
+	Registry->Rebake(LadderTag, LedgeTag);
+
+	// Sweeping towards the ladder: the swept path ends just inside or just outside the reach of its segment
+	const FVector Start(-300.f, 0.f, 100.f);
+	TestTrue(TEXT("Ends inside the reach"), Find(Registry, Start, FVector(300.f - Reach + 2.f, 0.f, 0.f)));
+	TestFalse(TEXT("Ends beyond the reach"), Find(Registry, Start, FVector(300.f - Reach - 2.f, 0.f, 0.f)));
+
+	// Sweeping past it sideways: the closest approach is mid-path, not at the end
+	TestTrue(TEXT("Passes inside the reach"), Find(Registry, FVector(-100.f, Reach - 2.f, 100.f), FVector(200.f, 0.f, 0.f)));
+	TestFalse(TEXT("Passes beyond the reach"), Find(Registry, FVector(-100.f, Reach + 2.f, 100.f), FVector(200.f, 0.f, 0.f)));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTraversalRegistryLadderTopTest, "LVN.Movement.Traversal.LadderTop", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FTraversalRegistryLadderTopTest::RunTest(const FString& Parameters)
+{
+	using namespace TraversalRegistryTests;
+
+	FPerfTestWorld World;
+	UTraversalRegistrySubsystem* Registry = World.Get()->GetSubsystem<UTraversalRegistrySubsystem>();
+	if (!TestNotNull(TEXT("TraversalRegistrySubsystem"), Registry))
+		return false;
+
+	AStaticMeshActor* WithExit = SpawnLadder(World.Get(), FVector::ZeroVector, 400.f);
+	USceneComponent* ExitPoint = NewObject<USceneComponent>(WithExit, TEXT("ExitPoint"));
+	ExitPoint->SetupAttachment(WithExit->GetRootComponent());
+	ExitPoint->RegisterComponent();
+	ExitPoint->SetWorldLocation(FVector(0.f, 60.f, 420.f));
+
+	AStaticMeshActor* WithoutExit = SpawnLadder(World.Get(), FVector(2000.f, 0.f, 100.f), 300.f);
+	Registry->Rebake(LadderTag, LedgeTag);
+
+	FTraversalFeature Feature = Registry->GetOrBake(WithExit, ETraversalKind::Ladder);
+	TestEqual(TEXT("Top"), Feature.GetTopZ(), 400.f, 0.01f);
+	TestEqual(TEXT("Foot"), Feature.GetStart().Z, 0.f, 0.01f);
+	TestTrue(TEXT("Has an exit point"), Feature.bHasExitPoint);
+	TestEqual(TEXT("Exit point"), Feature.ExitPoint, FVector(0.f, 60.f, 420.f), 0.01f);
+
+	Feature = Registry->GetOrBake(WithoutExit, ETraversalKind::Ladder);
+	TestEqual(TEXT("Top without exit point"), Feature.GetTopZ(), 400.f, 0.01f);
+	TestFalse(TEXT("Has no exit point"), Feature.bHasExitPoint);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTraversalRegistryRebakeTest, "LVN.Movement.Traversal.Rebake", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FTraversalRegistryRebakeTest::RunTest(const FString& Parameters)
+{
+	using namespace TraversalRegistryTests;
+
+	FPerfTestWorld World;
+	UTraversalRegistrySubsystem* Registry = World.Get()->GetSubsystem<UTraversalRegistrySubsystem>();
+	if (!TestNotNull(TEXT("TraversalRegistrySubsystem"), Registry))
+		return false;
+
+	AStaticMeshActor* Ladder = SpawnLadder(World.Get(), FVector::ZeroVector, 300.f);
+	Registry->Rebake(LadderTag, LedgeTag);
+
+	Ladder->SetActorLocation(FVector(2000.f, 0.f, 150.f));
+	TestTrue(TEXT("Still baked at the old place"), Find(Registry, FVector(30.f, 0.f, 200.f)));
+	TestFalse(TEXT("Not yet at the new place"), Find(Registry, FVector(2030.f, 0.f, 200.f)));
+
+	Registry->Rebake(LadderTag, LedgeTag);
+	TestFalse(TEXT("Gone from the old place"), Find(Registry, FVector(30.f, 0.f, 200.f)));
+	TestTrue(TEXT("At the new place"), Find(Registry, FVector(2030.f, 0.f, 200.f)));
+	return true;
+}
+
+#endif
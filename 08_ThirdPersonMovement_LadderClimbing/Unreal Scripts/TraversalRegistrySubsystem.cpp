@@ -0,0 +1,196 @@
+#include "TraversalRegistrySubsystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "EngineUtils.h"
+#include "UObject/ObjectKey.h"
+
+void UTraversalRegistrySubsystem::EnsureBaked(FName LadderTag, FName LedgeTag)
+{
+    if (!bBaked || LadderTag != BakedLadderTag || LedgeTag != BakedLedgeTag)
+        Rebake(LadderTag, LedgeTag);
+}
+
+void UTraversalRegistrySubsystem::Rebake(FName LadderTag, FName LedgeTag)
+{
+    Features.Reset();
+    ByActor.Reset();
+    Cells.Reset();
+
+    for (TActorIterator<AActor> It(GetWorld()); It; ++It)
+    {
+        if (It->ActorHasTag(LadderTag))
+            Add(BakeLadder(*It));
+        else if (It->ActorHasTag(LedgeTag))
+            Add(BakeLedge(*It));
+    }
+
+    VisitStamps.Init(0, Features.Num());
+    QueryStamp = 0;
+
+    bBaked = true;
+    BakedLadderTag = LadderTag;
+    BakedLedgeTag = LedgeTag;
+
+    if (bLogBake)
+        UE_LOG(LogTemp, Log, TEXT("Traversal registry baked %d features into %d cells"), Features.Num(), Cells.Num());
+}
+
+FTraversalFeature UTraversalRegistrySubsystem::GetOrBake(AActor* Actor, ETraversalKind Kind)
+{
+    if (const int32* Index = ByActor.Find(Actor))
+        return Features[*Index];
+
+    const int32 Index = Add(Kind == ETraversalKind::Ladder ? BakeLadder(Actor) : BakeLedge(Actor));
+    VisitStamps.SetNumZeroed(Features.Num());
+    return Features[Index];
+}
+
+bool UTraversalRegistrySubsystem::FindNearest(ETraversalKind Kind, const FVector& Location, const FVector& Motion, float MaxDistance, FTraversalFeature& OutFeature, float& OutT) const
+{
+    const FVector End = Location + Motion;
+    const FVector Margin(MaxDistance);
+    const FIntVector Min = GetCell(Location.ComponentMin(End) - Margin);
+    const FIntVector Max = GetCell(Location.ComponentMax(End) + Margin);
+
+    ++QueryStamp;
+    float BestDistSq = MaxDistance * MaxDistance;
+    int32 Best = INDEX_NONE;
+
+    for (int32 X = Min.X; X <= Max.X; ++X)
+    for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+    for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+    {
+        const TArray<int32>* Indices = Cells.Find(FIntVector(X, Y, Z));
+        if (!Indices)
+            continue;
+
+        for (int32 Index : *Indices)
+        {
+            if (VisitStamps[Index] == QueryStamp)
+                continue;
+            VisitStamps[Index] = QueryStamp;
+
+            const FTraversalFeature& Feature = Features[Index];
+            if (Feature.Kind != Kind)
+                continue;
+
+            FVector OnPath, OnFeature;
+            FMath::SegmentDistToSegmentSafe(Location, End, Feature.GetStart(), Feature.GetEnd(), OnPath, OnFeature);
+
+            const float DistSq = FVector::DistSquared(OnPath, OnFeature);
+            if (DistSq > BestDistSq)
+                continue;
+
+            BestDistSq = DistSq;
+            Best = Index;
+            OutT = Feature.ProjectT(OnFeature);
+        }
+    }
+
+    if (Best == INDEX_NONE)
+        return false;
+
+    OutFeature = Features[Best];
+    return true;
+}
+
+FTraversalFeature UTraversalRegistrySubsystem::BakeLadder(AActor* Actor)
+{
+    const UPrimitiveComponent* Collider = Actor->FindComponentByClass<UPrimitiveComponent>();
+    const FBox Bounds = Collider ? Collider->Bounds.GetBox() : FBox(Actor->GetActorLocation(), Actor->GetActorLocation());
+    const FVector Center = Bounds.GetCenter();
+
+    FTraversalFeature Feature;
+    Feature.Kind = ETraversalKind::Ladder;
+    Feature.Actor = Actor;
+    Feature.Origin = FVector(Center.X, Center.Y, Bounds.Min.Z);
+    Feature.Direction = FVector::UpVector;
+    Feature.MaxT = Bounds.GetSize().Z;
+    Feature.Normal = Actor->GetActorForwardVector();
+    Feature.Width = Bounds.GetExtent().ProjectOnTo(Actor->GetActorRightVector()).Size() * 2.f;
+    Feature.Bounds = Bounds;
+
+    // Must set an empty scene component named ExitPoint inside the ladder Blueprint
+    for (UActorComponent* Comp : Actor->GetComponents())
+    {
+        if (Comp->GetName().Contains("ExitPoint"))
+        {
+            if (const USceneComponent* ExitPoint = Cast<USceneComponent>(Comp))
+            {
+                Feature.ExitPoint = ExitPoint->GetComponentLocation();
+                Feature.bHasExitPoint = true;
+            }
+            break;
+        }
+    }
+    return Feature;
+}
+
+FTraversalFeature UTraversalRegistrySubsystem::BakeLedge(AActor* Actor)
+{
+    const UStaticMeshComponent* FloorComp = Actor->FindComponentByClass<UStaticMeshComponent>();
+    const USceneComponent* StartComp = nullptr;
+    const USceneComponent* EndComp = nullptr;
+
+    for (UActorComponent* Comp : Actor->GetComponents())
+    {
+        if (Comp->GetName().Contains("LedgeStart"))
+            StartComp = Cast<USceneComponent>(Comp);
+        else if (Comp->GetName().Contains("LedgeEnd"))
+            EndComp = Cast<USceneComponent>(Comp);
+    }
+
+    FVector Start = Actor->GetActorLocation();
+    FVector End = Start;
+    FBox Bounds(Start, Start);
+
+    if (FloorComp)
+        Bounds = FloorComp->Bounds.GetBox();
+
+    if (StartComp && EndComp)
+    {
+        Start = StartComp->GetComponentLocation();
+        End = EndComp->GetComponentLocation();
+    }
+    else if (FloorComp)
+    {
+        const FVector Forward = FloorComp->GetForwardVector().GetSafeNormal();
+        const float HalfLength = Bounds.GetExtent().Size();
+        Start = Bounds.GetCenter() - Forward * HalfLength;
+        End = Bounds.GetCenter() + Forward * HalfLength;
+    }
+
+    const FVector Right = FloorComp ? FloorComp->GetRightVector() : Actor->GetActorRightVector();
+
+    FTraversalFeature Feature;
+    Feature.Kind = ETraversalKind::Ledge;
+    Feature.Actor = Actor;
+    Feature.Origin = Start;
+    Feature.Direction = (End - Start).GetSafeNormal();
+    Feature.MaxT = FVector::Distance(Start, End);
+    Feature.Normal = -Right;
+    Feature.Width = Bounds.GetExtent().ProjectOnTo(Right).Size() * 2.f;
+    Feature.Bounds = Bounds + Start + End;
+    return Feature;
+}
+
+int32 UTraversalRegistrySubsystem::Add(const FTraversalFeature& Feature)
+{
+    const int32 Index = Features.Add(Feature);
+    ByActor.Add(Feature.Actor.Get(), Index);
+
+    const FIntVector Min = GetCell(Feature.Bounds.Min);
+    const FIntVector Max = GetCell(Feature.Bounds.Max);
+    for (int32 X = Min.X; X <= Max.X; ++X)
+    for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+    for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+        Cells.FindOrAdd(FIntVector(X, Y, Z)).Add(Index);
+
+    return Index;
+}
+
+FIntVector UTraversalRegistrySubsystem::GetCell(const FVector& Location) const
+{
+    const double Size = FMath::Max(1.f, CellSize);
+    return FIntVector(FMath::FloorToInt32(Location.X / Size), FMath::FloorToInt32(Location.Y / Size), FMath::FloorToInt32(Location.Z / Size));
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TraversalRegistrySubsystem.generated.h"
+
+UENUM(BlueprintType)
+enum class ETraversalKind : uint8
+{
+    Ladder,
+    Ledge
+};
+
+// A ladder or ledge baked into plain data: the line the character moves along is Origin + Direction * T, T in [MinT, MaxT]
+USTRUCT(BlueprintType)
+struct FTraversalFeature
+{
+    GENERATED_BODY()
+
+    UPROPERTY() ETraversalKind Kind = ETraversalKind::Ladder;
+    UPROPERTY() TWeakObjectPtr<AActor> Actor;
+    UPROPERTY() FVector Origin = FVector::ZeroVector;    // Ladder: collider center at its base. Ledge: LedgeStart.
+    UPROPERTY() FVector Direction = FVector::UpVector;   // Ladder: up. Ledge: LedgeStart -> LedgeEnd.
+    UPROPERTY() float MinT = 0.f;
+    UPROPERTY() float MaxT = 0.f;
+    UPROPERTY() FVector Normal = FVector::ZeroVector;    // Ladder: its forward (climbable from both sides). Ledge: into the wall.
+    UPROPERTY() float Width = 0.f;
+    UPROPERTY() FVector ExitPoint = FVector::ZeroVector; // Ladder: the "ExitPoint" component
+    UPROPERTY() bool bHasExitPoint = false;
+    UPROPERTY() FBox Bounds = FBox(ForceInit);
+
+    FVector GetStart() const { return Origin + Direction * MinT; }
+    FVector GetEnd() const { return Origin + Direction * MaxT; }
+    float GetTopZ() const { return FMath::Max(GetStart().Z, GetEnd().Z); }
+    float ProjectT(const FVector& Point) const { return FVector::DotProduct(Point - Origin, Direction); }
+};
+
+/* --------------------------------------------------------------------------
+   Ladders and ledges baked once per level.
+
+   • Every actor tagged LadderTag / LedgeTag becomes an FTraversalFeature: a segment
+     with its normal, width and exit point, read from its components once. Movement
+     uses the baked data instead of searching components by name on every use.
+   • Features go in a spatial hash of CellSize cells, so a query only looks at the
+     features in the cells it touches.
+   • FindNearest sweeps a point along its motion for a look-ahead window and measures
+     the distance to each feature segment analytically (closest points between two
+     segments). That is how the character grabs a ledge or ladder a few frames early.
+   • Baked by the first character's BeginPlay. Rebake after moving or spawning
+     traversal actors.
+   -------------------------------------------------------------------------- */
+UCLASS()
+class MECHANICS_TEST_LVN_API UTraversalRegistrySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(BlueprintReadWrite, Category="Traversal")
+    float CellSize = 400.f;
+
+    UPROPERTY(BlueprintReadWrite, Category="Traversal")
+    bool bLogBake = false;
+
+    // Bakes unless the level was already baked with the same tags
+    void EnsureBaked(FName LadderTag, FName LedgeTag);
+
+    UFUNCTION(BlueprintCallable, Category="Traversal")
+    void Rebake(FName LadderTag, FName LedgeTag);
+
+    UFUNCTION(BlueprintPure, Category="Traversal")
+    int32 GetFeatureCount() const { return Features.Num(); }
+
+    // Baked data of a tagged actor, baking it now if it appeared after the last Rebake
+    FTraversalFeature GetOrBake(AActor* Actor, ETraversalKind Kind);
+
+    // Nearest feature of Kind within MaxDistance of the path from Location to Location + Motion.
+    // OutT is where on the feature the closest approach happens.
+    bool FindNearest(ETraversalKind Kind, const FVector& Location, const FVector& Motion, float MaxDistance, FTraversalFeature& OutFeature, float& OutT) const;
+
+private:
+    static FTraversalFeature BakeLadder(AActor* Actor);
+    static FTraversalFeature BakeLedge(AActor* Actor);
+    int32 Add(const FTraversalFeature& Feature);
+    FIntVector GetCell(const FVector& Location) const;
+
+    TArray<FTraversalFeature> Features;
+    TMap<TObjectKey<AActor>, int32> ByActor;
+    TMap<FIntVector, TArray<int32>> Cells;
+    mutable TArray<int32> VisitStamps; // Query number that last looked at each feature, so a feature in several cells is tested once
+    mutable int32 QueryStamp = 0;
+
+    bool bBaked = false;
+    FName BakedLadderTag;
+    FName BakedLedgeTag;
+};
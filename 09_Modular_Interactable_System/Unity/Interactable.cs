@@ -129,7 +129,7 @@ public class Interactable : MonoBehaviour
             _interactCooldownCoroutine = StartCoroutine(InteractCooldown());
             _canInteract = false;
         }
-        Debug.Log("Interacted with " + gameObject.name);
+        Diag.Log(DiagCategory.Interaction, this, "Interacted with {0}", gameObject);
     }
 
     private void OnHoverEnter()
@@ -137,7 +137,7 @@ public class Interactable : MonoBehaviour
         if(hasHoverEnterCooldown && _isOnHoverEnterCooldown) return;
         if (hasHoverEvents && !_isHovered)
         {
-            Debug.Log("Hovering (Enter) over " + gameObject.name);
+            Diag.Verbose(DiagCategory.Interaction, this, "Hovering (Enter) over {0}", gameObject);
             onHoverEnter?.Invoke();
             _isHovered = true;
             if (hasHoverEnterCooldown)
@@ -153,7 +153,7 @@ public class Interactable : MonoBehaviour
         if(hasHoverStayCooldown && _isOnHoverStayCooldown) return;
         if (hasHoverEvents && _isHovered)
         {
-            //Debug.Log("Hovering over " + gameObject.name); // Uncomment for continuous hover logging
+            Diag.Verbose(DiagCategory.Interaction, this, "Hovering over {0}", gameObject); // Every hover tick, free unless Interaction is set to Verbose
             onHoverStay?.Invoke();
             _isHovered = true;
             if (hasHoverStayCooldown)
@@ -169,7 +169,7 @@ public class Interactable : MonoBehaviour
         if(hasHoverExitCooldown && _isOnHoverExitCooldown) return;
         if (hasHoverEvents && _isHovered)
         {
-            Debug.Log("Stopped hovering over " + gameObject.name);
+            Diag.Verbose(DiagCategory.Interaction, this, "Stopped hovering over {0}", gameObject);
             onHoverExit?.Invoke();
             _isHovered = false;
             if (hasHoverExitCooldown)
@@ -0,0 +1,70 @@
+using System.Collections;
+using NUnit.Framework;
+using Unity.PerformanceTesting;
+using UnityEngine;
+using UnityEngine.InputSystem;
+using UnityEngine.TestTools;
+
+// Times frames in Play mode with 1000 trigger-based interactables with hover events on a grid, swept by a Player-tagged
+// trigger so every frame has interactables entering, staying in and leaving hover. Compared with PerfBaselines/Interactables.json.
+public class InteractablePerformanceTests
+{
+    private const int InteractableCount = 1000;
+    private const float Spacing = 2f;
+    private const string Settings = "{\"isTriggerBased\":true,\"isClickBased\":false,\"hasHoverEvents\":true,\"interactorTag\":\"Player\"}";
+    private static readonly string[] InputActions = { "Move", "Look", "Run", "Dance", "Jump", "Crouch", "Prone", "Roll", "Glide", "Climb", "Interact" };
+
+    [UnityTearDown]
+    public IEnumerator TearDown()
+    {
+        if (Application.isPlaying)
+            yield return new ExitPlayMode();
+    }
+
+    [UnityTest, Performance]
+    public IEnumerator Frames_WithHoverSweep()
+    {
+        yield return new EnterPlayMode();
+        SpawnInputManager();
+
+        int side = Mathf.CeilToInt(Mathf.Sqrt(InteractableCount));
+        float extent = (side - 1) * Spacing;
+        for (int i = 0; i < InteractableCount; i++)
+        {
+            var go = new GameObject($"Interactable_{i}");
+            go.transform.position = new Vector3(i % side, 0f, i / side) * Spacing;
+            go.AddComponent<BoxCollider>().isTrigger = true;
+
+            // Configured before Start runs, like a prefab set up in the inspector
+            JsonUtility.FromJsonOverwrite(Settings, go.AddComponent<Interactable>());
+        }
+
+        var sweeper = new GameObject("Sweeper") { tag = "Player" };
+        sweeper.AddComponent<SphereCollider>().radius = 3f;
+        var body = sweeper.AddComponent<Rigidbody>();
+        body.isKinematic = true;
+        yield return null; // Every Start runs
+
+        // Back and forth along the rows, one row further each pass
+        yield return PerfBaseline.Frames("Frame_1000Interactables", 300, frame =>
+            body.MovePosition(new Vector3(Mathf.PingPong(frame * Spacing * 0.5f, extent), 0f, Mathf.Repeat(frame * Spacing / side, extent))));
+
+        PerfBaseline.AssertWithin("Interactables");
+    }
+
+    // Unbound actions, enough for the interactables to read InputManager.Instance
+    private static void SpawnInputManager()
+    {
+        var actions = ScriptableObject.CreateInstance<InputActionAsset>();
+        InputActionMap map = actions.AddActionMap("Player");
+        foreach (string action in InputActions)
+            map.AddAction(action, action == "Move" || action == "Look" ? InputActionType.Value : InputActionType.Button);
+
+        // Inactive until PlayerInput has its actions, InputManager reads them in Awake
+        var input = new GameObject("InputManager");
+        input.SetActive(false);
+        input.AddComponent<PlayerInput>().actions = actions;
+        input.AddComponent<InputManager>();
+        input.SetActive(true);
+    }
+}
@@ -1,4 +1,5 @@
 #include "Interactable.h"
+#include "Diagnostics.h"
 
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
@@ -113,12 +114,10 @@ void AInteractable::Tick(float DeltaTime)
             if (GetWorld()->LineTraceSingleByChannel(Hit, WorldPos, End, ECC_Visibility, Params))
             {
                 // Debug hit point
-                // DrawDebugSphere(GetWorld(), Hit.ImpactPoint, 12.f, 12, FColor::Blue, false, 0.05f);
-
-                /*
-                UE_LOG(LogTemp, Warning, TEXT("Ray Hit Actor: %s"), 
+                DIAG_SPHERE(GetWorld(), Interaction, Hit.ImpactPoint, 12.f, FColor::Blue, 0.05f);
+                DIAG_LOG(Interaction, Verbose, TEXT("Ray Hit Actor: %s"),
                     Hit.GetActor() ? *Hit.GetActor()->GetName() : TEXT("None"));
-                */
+
                 if (Hit.GetActor() == this)
                     bHovering = true;
             }
@@ -203,7 +202,7 @@ void AInteractable::Interact()
     if (bIsClickBased && !bIsHovered)
         return;
 
-    UE_LOG(LogTemp, Warning, TEXT("Interacted with %s"), *GetName());
+    DIAG_LOG(Interaction, Log, TEXT("Interacted with %s"), *GetName());
     OnInteract();
 
     if (bHasInteractCooldown)
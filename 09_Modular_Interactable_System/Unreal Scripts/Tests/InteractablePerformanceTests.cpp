@@ -0,0 +1,56 @@
+#include "Misc/AutomationTest.h"
+#include "PerfTesting.h"
+#include "Interactable.h"
+#include "Components/SphereComponent.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Times world ticks with 1000 trigger-based interactables with hover events on a grid, swept by a tagged overlap sphere the
+// way the player capsule does, so every tick has interactables entering, staying in and leaving hover.
+// Compared with PerfBaselines/Interactables.json.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Interaction.Performance; Quit" -nullrhi -unattended
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractablePerformanceHoverSweepTest, "LVN.Interaction.Performance.HoverSweep", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FInteractablePerformanceHoverSweepTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 InteractableCount = 1000;
+    constexpr float Spacing = 200.f;
+
+    FPerfTestWorld World;
+    FActorSpawnParameters Params;
+    Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    const int32 Side = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(InteractableCount)));
+    const float Extent = (Side - 1) * Spacing;
+    for (int32 i = 0; i < InteractableCount; ++i)
+    {
+        const FTransform Transform(FVector(i % Side * Spacing, i / Side * Spacing, 0.f));
+        AInteractable* Interactable = World.Get()->SpawnActorDeferred<AInteractable>(AInteractable::StaticClass(), Transform, nullptr, nullptr, Params.SpawnCollisionHandlingOverride);
+        Interactable->bIsTriggerBased = true;
+        Interactable->bIsClickBased = false;
+        Interactable->bHasHoverEvents = true;
+        Interactable->FinishSpawning(Transform);
+    }
+
+    AActor* Sweeper = World.Get()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+    USphereComponent* Sphere = NewObject<USphereComponent>(Sweeper);
+    Sphere->InitSphereRadius(100.f);
+    Sphere->SetCollisionObjectType(ECC_Pawn);
+    Sphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+    Sphere->SetCollisionResponseToAllChannels(ECR_Overlap);
+    Sphere->SetGenerateOverlapEvents(true);
+    Sweeper->SetRootComponent(Sphere);
+    Sphere->RegisterComponent();
+    Sweeper->Tags.Add(GetDefault<AInteractable>()->TriggerTag);
+
+    // Back and forth along the rows, one row further each pass
+    FPerfRecorder Recorder;
+    Recorder.MeasureTicks(TEXT("Frame_1000Interactables"), World, 300, [Sweeper, Side, Extent](int32 Tick)
+    {
+        Sweeper->SetActorLocation(FVector(Extent - FMath::Abs(FMath::Fmod(Tick * Spacing * 0.5f, 2.f * Extent) - Extent), FMath::Fmod(Tick * Spacing / Side, Extent), 0.f));
+    });
+    return Recorder.CheckBaseline(*this, TEXT("Interactables"), __FILE__);
+}
+
+#endif
@@ -1,29 +1,91 @@
 using System.Collections;
 using System.Collections.Generic;
-using Unity.VisualScripting;
 using UnityEngine;
 using UnityEngine.Events;
 
 public class PuzzleController : MonoBehaviour
 {
-    private List<PuzzleTrigger> puzzleTriggers = new List<PuzzleTrigger>();
+    private Dictionary<PuzzleTrigger, int> triggerInputs = new Dictionary<PuzzleTrigger, int>(); // Input index given to each trigger
+
+    [Header("Puzzle Rules")]
+    [Space(5)]
+    [SerializeField] private PuzzleCompletionMode completionMode = PuzzleCompletionMode.All;
+    [SerializeField, Min(1)] private int threshold = 1; // Used by Threshold mode
+    [SerializeField] private bool resetSequenceOnError = true; // Used by Sequence mode
+
+    [Header("Optional Parent Puzzle (this puzzle becomes one of its inputs)")]
+    [Space(5)]
+    [SerializeField] private PuzzleController parentController;
+    [SerializeField] private int sequenceOrder = 0; // Order of this sub-puzzle inside a Sequence parent
 
     [Header("Puzzle State Events")]
     [Space(5)]
     public UnityEvent onPuzzleComplete;
     public UnityEvent onPuzzleCancelComplete;
+    public UnityEvent onSequenceError;
 
     [Header("Optional Delay Before Checking Puzzle State")]
     [SerializeField] private float delayBeforeCheck = 0f;
 
+    private PuzzleLogic logic;
     private bool puzzleComplete = false;
+    private int parentInputIndex = -1;
+
+    public PuzzleLogic Logic => logic;
+    public bool IsComplete => puzzleComplete;
 
-    public void AddPuzzleTrigger(PuzzleTrigger trigger)
+    void Awake()
     {
-        if (!puzzleTriggers.Contains(trigger))
-        {
-            puzzleTriggers.Add(trigger);
-        }
+        EnsureLogic();
+    }
+
+    void Start()
+    {
+        if (parentController != null && parentController != this)
+            parentInputIndex = parentController.AddInput(sequenceOrder);
+    }
+
+    private void EnsureLogic()
+    {
+        if (logic != null)
+            return;
+
+        logic = new PuzzleLogic(completionMode, threshold) { ResetSequenceOnError = resetSequenceOnError };
+        logic.OnSequenceError += () => onSequenceError.Invoke();
+    }
+
+    // Returns the input index the trigger must use when reporting its state.
+    public int AddPuzzleTrigger(PuzzleTrigger trigger, int order = 0)
+    {
+        // Sub-puzzles share the input list, so a trigger's index is the one AddInput gave it, not its registration position
+        if (triggerInputs.TryGetValue(trigger, out int existing))
+            return existing;
+
+        int index = AddInput(order);
+        triggerInputs.Add(trigger, index);
+        return index;
+    }
+
+    // Generic input registration, used by triggers and nested sub-puzzles.
+    public int AddInput(int order = 0)
+    {
+        EnsureLogic();
+        return logic.AddInput(order);
+    }
+
+    // O(1): updates the activation counter and checks the puzzle state.
+    public void SetInputState(int inputIndex, bool active)
+    {
+        EnsureLogic();
+        logic.SetInput(inputIndex, active);
+        CheckPuzzleState();
+    }
+
+    public void ResetPuzzle()
+    {
+        EnsureLogic();
+        logic.ResetSequence();
+        CheckPuzzleState();
     }
 
     public void CheckPuzzleState()
@@ -47,28 +109,27 @@ public class PuzzleController : MonoBehaviour
 
     public void CheckPuzzleStateMethod()
     {
-        bool allActivated = true;
-
-        foreach (var t in puzzleTriggers)
-        {
-            if (!t.isActivated)
-            {
-                allActivated = false;
-                break;
-            }
-        }
+        EnsureLogic();
+        bool allActivated = logic.IsComplete;
 
         if (allActivated && !puzzleComplete)
         {
             puzzleComplete = true;
             onPuzzleComplete.Invoke();
+            NotifyParent();
         }
         else if (!allActivated && puzzleComplete)
         {
             puzzleComplete = false;
             onPuzzleCancelComplete.Invoke();
+            NotifyParent();
         }
     }
+
+    private void NotifyParent()
+    {
+        if (parentController != null && parentInputIndex >= 0)
+            parentController.SetInputState(parentInputIndex, puzzleComplete);
+    }
     
 }
-
@@ -0,0 +1,8 @@
+using UnityEngine;
+
+// Typed key used to filter which objects can activate a PuzzleTrigger (replaces string tags).
+// Create one asset per kind of puzzle object (e.g. "Crate", "Statue", "Key_Red").
+[CreateAssetMenu(fileName = "PuzzleKey", menuName = "Puzzle/Puzzle Key")]
+public class PuzzleKey : ScriptableObject
+{
+}
@@ -0,0 +1,117 @@
+using System.Collections.Generic;
+
+public enum PuzzleCompletionMode
+{
+    All,        // AND: every input active
+    Any,        // OR: at least one input active
+    Threshold,  // At least "threshold" inputs active
+    Sequence    // Every input activated once, in sequence order
+}
+
+// Engine-free puzzle state used by PuzzleController.
+// Inputs (triggers or nested sub-puzzles) report their state by index and completion is evaluated in O(1)
+// from an activation counter, so it can be driven deterministically without physics or scenes.
+public class PuzzleLogic
+{
+    public PuzzleCompletionMode Mode;
+    public int Threshold = 1;
+    public bool ResetSequenceOnError = true;
+
+    private readonly List<bool> inputStates = new List<bool>();
+    private readonly List<int> inputOrders = new List<int>();
+    private int[] sequence; // Input indices sorted by (order, registration), built on first sequence step
+    private int activeCount;
+    private int sequenceProgress;
+
+    public int InputCount => inputStates.Count;
+    public int ActiveCount => activeCount;
+    public int SequenceProgress => sequenceProgress;
+    public bool IsComplete { get; private set; }
+
+    // Raised when an input is activated out of order in Sequence mode
+    public event System.Action OnSequenceError;
+
+    public PuzzleLogic(PuzzleCompletionMode mode = PuzzleCompletionMode.All, int threshold = 1)
+    {
+        Mode = mode;
+        Threshold = threshold;
+    }
+
+    // Registers a new input and returns its index. "order" is only used in Sequence mode.
+    public int AddInput(int order = 0)
+    {
+        inputStates.Add(false);
+        inputOrders.Add(order);
+        sequence = null;
+        Evaluate();
+        return inputStates.Count - 1;
+    }
+
+    public bool IsInputActive(int index) => index >= 0 && index < inputStates.Count && inputStates[index];
+
+    // Returns true when the completion state changed.
+    public bool SetInput(int index, bool active)
+    {
+        if (index < 0 || index >= inputStates.Count || inputStates[index] == active)
+            return false;
+
+        inputStates[index] = active;
+        activeCount += active ? 1 : -1;
+
+        if (Mode == PuzzleCompletionMode.Sequence && active)
+            StepSequence(index);
+
+        bool wasComplete = IsComplete;
+        Evaluate();
+        return wasComplete != IsComplete;
+    }
+
+    public void ResetSequence()
+    {
+        sequenceProgress = 0;
+        Evaluate();
+    }
+
+    private void StepSequence(int index)
+    {
+        if (sequence == null)
+            BuildSequence();
+
+        if (sequenceProgress >= sequence.Length)
+            return; // Already solved, extra activations are ignored
+
+        if (sequence[sequenceProgress] == index)
+        {
+            sequenceProgress++;
+            return;
+        }
+
+        // The wrong press still counts as the first step when it starts the sequence
+        if (ResetSequenceOnError)
+            sequenceProgress = sequence[0] == index ? 1 : 0;
+
+        OnSequenceError?.Invoke();
+    }
+
+    private void BuildSequence()
+    {
+        sequence = new int[inputStates.Count];
+        for (int i = 0; i < sequence.Length; i++) sequence[i] = i;
+
+        // Stable sort by order, registration index breaks ties
+        System.Array.Sort(sequence, (a, b) => inputOrders[a] != inputOrders[b] ? inputOrders[a].CompareTo(inputOrders[b]) : a.CompareTo(b));
+    }
+
+    private void Evaluate()
+    {
+        int count = inputStates.Count;
+
+        switch (Mode)
+        {
+            case PuzzleCompletionMode.Any: IsComplete = activeCount > 0; break;
+            case PuzzleCompletionMode.Threshold: IsComplete = count > 0 && activeCount >= System.Math.Max(1, System.Math.Min(Threshold, count)); break;
+            case PuzzleCompletionMode.Sequence: IsComplete = count > 0 && sequenceProgress >= count; break;
+            default: IsComplete = count > 0 && activeCount == count; break;
+        }
+    }
+}
@@ -0,0 +1,45 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+// Optional component for objects that interact with puzzle triggers.
+// Provides the keys / mass used by TriggerOccupancy filters and removes the object from every
+// trigger it is inside when it is disabled or destroyed (Unity does not send OnTriggerExit then).
+public class PuzzleOccupant : MonoBehaviour
+{
+    public PuzzleKey[] keys;
+
+    [Tooltip("Mass used by Mass occupancy mode. Negative uses the attached Rigidbody mass.")]
+    public float massOverride = -1f;
+
+    internal readonly List<TriggerOccupancy> insideOf = new List<TriggerOccupancy>();
+
+    private Rigidbody body;
+
+    void Awake()
+    {
+        body = GetComponent<Rigidbody>();
+    }
+
+    public float Mass => massOverride >= 0f ? massOverride : (body != null ? body.mass : 0f);
+
+    public bool HasAnyKey(PuzzleKey[] accepted)
+    {
+        if (keys == null || accepted == null) return false;
+
+        for (int i = 0; i < keys.Length; i++)
+            for (int j = 0; j < accepted.Length; j++)
+                if (keys[i] != null && keys[i] == accepted[j]) return true;
+
+        return false;
+    }
+
+    void OnDisable()
+    {
+        // Copy: RemoveOccupant edits insideOf
+        var occupancies = insideOf.ToArray();
+        insideOf.Clear();
+
+        foreach (var occupancy in occupancies)
+            if (occupancy != null) occupancy.RemoveOccupant(gameObject);
+    }
+}
@@ -4,26 +4,29 @@ using System.Collections.Generic;
 using System.Collections;
 
 [RequireComponent(typeof(Collider))]
+[RequireComponent(typeof(TriggerOccupancy))]
 public class PuzzleTrigger : MonoBehaviour
 {
-    [Header("Tag Settings")]
-    public string requiredTag = "PuzzleObject";
-
     [Header("Trigger Settings")]
     public bool triggerOnlyWhenEmpty = false; // Flag to only trigger when no other objects are inside
-    private int objectsInside = 0;
+    // Filters (PuzzleKeys / legacy tag) and Count/Mass activation are configured on the TriggerOccupancy component
+    private TriggerOccupancy occupancy;
+
+    // Tag filter saved by triggers from before TriggerOccupancy owned it. Only read to move it there, see MigrateRequiredTag.
+    [SerializeField, HideInInspector] private string requiredTag = "";
 
     [Header("Events")]
     [Space(5)]
     [SerializeField] private UnityEvent onAnyEnter;    // Fires for ANY object
     [SerializeField] private UnityEvent onAnyExit;    // Fires for ANY object
-    [SerializeField] private UnityEvent onTagEnter;  // Fires ONLY if tag matches
-    [SerializeField] private UnityEvent onTagExit;  // Fires ONLY if tag matches
+    [SerializeField] private UnityEvent onTagEnter;  // Fires when the occupancy filter activates the trigger
+    [SerializeField] private UnityEvent onTagExit;  // Fires when the occupancy filter deactivates the trigger
 
     [Header("Optional Puzzle Controller")]
     [Space(5)]
     [SerializeField] private bool linkToPuzzleController = false;
     public PuzzleController puzzleController;
+    [SerializeField] private int sequenceOrder = 0; // Only used when the controller is in Sequence mode
 
     [Header("Optional MeshRenderer reference for Material Handling")]
     [Space(5)]
@@ -31,6 +34,49 @@ public class PuzzleTrigger : MonoBehaviour
     [SerializeField] private float delayBeforeMaterialChange = 0f;
 
     [HideInInspector] public bool isActivated = false;
+    private int controllerInputIndex = -1;
+
+    private MaterialPropertyBlock propertyBlock;
+    private static readonly int BaseColorId = Shader.PropertyToID("_BaseColor"); // URP/HDRP Lit
+    private static readonly int ColorId = Shader.PropertyToID("_Color");         // Built-in Standard
+
+    void Awake()
+    {
+        occupancy = GetComponent<TriggerOccupancy>();
+        if (occupancy == null)
+            occupancy = gameObject.AddComponent<TriggerOccupancy>();
+
+        MigrateRequiredTag();
+        occupancy.OnOccupantEntered += HandleOccupantEntered;
+        occupancy.OnOccupantExited += HandleOccupantExited;
+        occupancy.OnActivationChanged += HandleActivationChanged;
+    }
+
+    void OnValidate()
+    {
+        MigrateRequiredTag();
+    }
+
+    // Moves a legacy tag onto the TriggerOccupancy, so the occupancy component is the only place it is set
+    private void MigrateRequiredTag()
+    {
+        if (string.IsNullOrEmpty(requiredTag)) return;
+
+        TriggerOccupancy target = occupancy != null ? occupancy : GetComponent<TriggerOccupancy>();
+        if (target == null) return;
+
+        target.requiredTag = requiredTag;
+        requiredTag = "";
+    }
+
+    void OnDestroy()
+    {
+        if (occupancy == null) return;
+
+        occupancy.OnOccupantEntered -= HandleOccupantEntered;
+        occupancy.OnOccupantExited -= HandleOccupantExited;
+        occupancy.OnActivationChanged -= HandleActivationChanged;
+    }
 
     void Start()
     {
@@ -40,73 +86,57 @@ public class PuzzleTrigger : MonoBehaviour
         }
         else if(linkToPuzzleController && puzzleController != null)
         {
-            puzzleController.AddPuzzleTrigger(this);
+            controllerInputIndex = puzzleController.AddPuzzleTrigger(this, sequenceOrder);
         }
     }
 
-    private void OnTriggerEnter(Collider other)
+    private void HandleOccupantEntered(GameObject other, bool matchesFilter)
     {
-        if(triggerOnlyWhenEmpty)
+        // Occupant count is already updated: 1 means the trigger was empty
+        if(triggerOnlyWhenEmpty && occupancy.OccupantCount > 1)
         {
-            objectsInside++;
-            if(objectsInside > 1)
-            {
-                return; // Do not trigger if more than one object is inside
-            }
+            return; // Do not trigger if more than one object is inside
         }
 
         onAnyEnter.Invoke();
-        Debug.Log("Object entered PuzzleTrigger: " + other.name);
-
-        // If tag matches, fire tag-specific exit
-        if (!isActivated && other.CompareTag(requiredTag))
-        {
-            isActivated = true;
-            onTagEnter.Invoke();
-            
-            if (linkToPuzzleController && puzzleController != null)
-            {
-                puzzleController.CheckPuzzleState();    
-            }
-
-            Debug.Log("PuzzleTrigger activated by " + other.name);
-        }
+        Debug.Log("Object entered PuzzleTrigger: " + (other != null ? other.name : "<destroyed>"));
     }
 
-    private void OnTriggerExit(Collider other)
+    private void HandleOccupantExited(GameObject other, bool matchesFilter)
     {
-        if(triggerOnlyWhenEmpty)
+        if(triggerOnlyWhenEmpty && occupancy.OccupantCount > 0)
         {
-            objectsInside--;
-            if(objectsInside <= 0)
-            {
-                objectsInside = 0;
-            }
-            else
-            {
-                return; // No objects inside, do not trigger
-            }
+            return; // Objects still inside, do not trigger
         }
 
         onAnyExit.Invoke();
-        Debug.Log("Object exited PuzzleTrigger: " + other.name);
+        Debug.Log("Object exited PuzzleTrigger: " + (other != null ? other.name : "<destroyed>"));
+    }
 
-        // If tag matches, fire tag-specific exit
-        if (isActivated && other.CompareTag(requiredTag))
-        {
-            isActivated = false;
+    private void HandleActivationChanged(bool activated)
+    {
+        isActivated = activated;
+
+        if (isActivated)
+            onTagEnter.Invoke();
+        else
             onTagExit.Invoke();
 
-            if (linkToPuzzleController && puzzleController != null)
-            {
-                puzzleController.CheckPuzzleState();    
-            }
+        ReportStateToController();
 
-            Debug.Log("PuzzleTrigger deactivated by " + other.name);
+        Debug.Log("PuzzleTrigger " + name + (isActivated ? " activated" : " deactivated"));
+    }
+
+    private void ReportStateToController()
+    {
+        if (linkToPuzzleController && puzzleController != null && controllerInputIndex >= 0)
+        {
+            puzzleController.SetInputState(controllerInputIndex, isActivated);
         }
     }
 
     // Optional* Method to set material to the MeshRenderer
+    // Uses sharedMaterial so each trigger doesn't create its own material copy.
     public void SetMaterialToRenderer(Material mat)
     {
         if(meshRenderer != null && mat != null)
@@ -117,7 +147,7 @@ public class PuzzleTrigger : MonoBehaviour
             }
             else
             {
-                meshRenderer.material = mat;
+                meshRenderer.sharedMaterial = mat;
             }
         }
     }
@@ -125,6 +155,33 @@ public class PuzzleTrigger : MonoBehaviour
     private IEnumerator DelayedMaterialChange(Material mat, float delay)
     {
         yield return new WaitForSeconds(delay);
-        meshRenderer.material = mat;
+        meshRenderer.sharedMaterial = mat;
+    }
+
+    // Optional* Tints the MeshRenderer through a MaterialPropertyBlock (no material instances, keeps batching)
+    public void SetColorToRenderer(Color color)
+    {
+        if (meshRenderer == null) return;
+
+        if (delayBeforeMaterialChange > 0f)
+            StartCoroutine(DelayedColorChange(color, delayBeforeMaterialChange));
+        else
+            ApplyColor(color);
+    }
+
+    private IEnumerator DelayedColorChange(Color color, float delay)
+    {
+        yield return new WaitForSeconds(delay);
+        ApplyColor(color);
+    }
+
+    private void ApplyColor(Color color)
+    {
+        if (propertyBlock == null) propertyBlock = new MaterialPropertyBlock();
+
+        meshRenderer.GetPropertyBlock(propertyBlock);
+        propertyBlock.SetColor(BaseColorId, color);
+        propertyBlock.SetColor(ColorId, color);
+        meshRenderer.SetPropertyBlock(propertyBlock);
     }
 }
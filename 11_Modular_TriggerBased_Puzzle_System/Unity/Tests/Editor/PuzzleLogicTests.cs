@@ -0,0 +1,208 @@
+using NUnit.Framework;
+using UnityEngine;
+
+// Deterministic checks of the puzzle rules: PuzzleLogic is driven by input index only, no scene or physics involved.
+public class PuzzleLogicTests
+{
+    [Test]
+    public void All_CompletesWhenEveryInputIsActive()
+    {
+        var logic = new PuzzleLogic(PuzzleCompletionMode.All);
+        int a = logic.AddInput();
+        int b = logic.AddInput();
+
+        Assert.IsFalse(logic.SetInput(a, true));
+        Assert.IsFalse(logic.IsComplete);
+        Assert.IsTrue(logic.SetInput(b, true));
+        Assert.IsTrue(logic.IsComplete);
+
+        Assert.IsTrue(logic.SetInput(a, false));
+        Assert.IsFalse(logic.IsComplete);
+        Assert.AreEqual(1, logic.ActiveCount);
+    }
+
+    [Test]
+    public void All_WithoutInputsIsNeverComplete()
+    {
+        Assert.IsFalse(new PuzzleLogic(PuzzleCompletionMode.All).IsComplete);
+    }
+
+    [Test]
+    public void Any_CompletesWithOneActiveInput()
+    {
+        var logic = new PuzzleLogic(PuzzleCompletionMode.Any);
+        int a = logic.AddInput();
+        int b = logic.AddInput();
+
+        Assert.IsTrue(logic.SetInput(b, true));
+        Assert.IsFalse(logic.SetInput(a, true));
+        Assert.IsFalse(logic.SetInput(b, false));
+        Assert.IsTrue(logic.IsComplete);
+        Assert.IsTrue(logic.SetInput(a, false));
+    }
+
+    [Test]
+    public void Threshold_CompletesAtThreshold()
+    {
+        var logic = new PuzzleLogic(PuzzleCompletionMode.Threshold, 2);
+        int a = logic.AddInput();
+        int b = logic.AddInput();
+        logic.AddInput();
+
+        logic.SetInput(a, true);
+        Assert.IsFalse(logic.IsComplete);
+        logic.SetInput(b, true);
+        Assert.IsTrue(logic.IsComplete);
+    }
+
+    [TestCase(0, 1)]
+    [TestCase(5, 3)]
+    public void Threshold_IsClampedToTheInputCount(int threshold, int activeNeeded)
+    {
+        var logic = new PuzzleLogic(PuzzleCompletionMode.Threshold, threshold);
+        for (int i = 0; i < 3; i++) logic.AddInput();
+
+        for (int i = 0; i < activeNeeded - 1; i++) logic.SetInput(i, true);
+        Assert.IsFalse(logic.IsComplete);
+        logic.SetInput(activeNeeded - 1, true);
+        Assert.IsTrue(logic.IsComplete);
+    }
+
+    [Test]
+    public void SetInput_IgnoresInvalidIndicesAndRepeatedStates()
+    {
+        var logic = new PuzzleLogic(PuzzleCompletionMode.Any);
+        int a = logic.AddInput();
+
+        Assert.IsFalse(logic.SetInput(-1, true));
+        Assert.IsFalse(logic.SetInput(1, true));
+        Assert.IsTrue(logic.SetInput(a, true));
+        Assert.IsFalse(logic.SetInput(a, true));
+        Assert.AreEqual(1, logic.ActiveCount);
+    }
+
+    [Test]
+    public void Sequence_FollowsOrderThenRegistration()
+    {
+        var logic = new PuzzleLogic(PuzzleCompletionMode.Sequence);
+        int last = logic.AddInput(2);
+        int first = logic.AddInput(1);
+        int second = logic.AddInput(1); // Same order as "first", registered later
+
+        logic.SetInput(first, true);
+        logic.SetInput(second, true);
+        Assert.AreEqual(2, logic.SequenceProgress);
+        Assert.IsFalse(logic.IsComplete);
+
+        Assert.IsTrue(logic.SetInput(last, true));
+        Assert.IsTrue(logic.IsComplete);
+    }
+
+    [Test]
+    public void Sequence_ErrorResetsProgressAndRaisesEvent()
+    {
+        var logic = new PuzzleLogic(PuzzleCompletionMode.Sequence);
+        int a = logic.AddInput(0);
+        int b = logic.AddInput(1);
+        int c = logic.AddInput(2);
+        int errors = 0;
+        logic.OnSequenceError += () => errors++;
+
+        logic.SetInput(a, true);
+        logic.SetInput(c, true);
+        Assert.AreEqual(1, errors);
+        Assert.AreEqual(0, logic.SequenceProgress);
+
+        // Inputs have to be released before they can be stepped on again
+        logic.SetInput(a, false);
+        logic.SetInput(c, false);
+        logic.SetInput(a, true);
+        logic.SetInput(b, true);
+        logic.SetInput(c, true);
+        Assert.IsTrue(logic.IsComplete);
+        Assert.AreEqual(1, errors);
+    }
+
+    [Test]
+    public void Sequence_ErrorOnTheFirstInputRestartsFromIt()
+    {
+        var logic = new PuzzleLogic(PuzzleCompletionMode.Sequence);
+        int a = logic.AddInput(0);
+        int b = logic.AddInput(1);
+        int c = logic.AddInput(2);
+        int errors = 0;
+        logic.OnSequenceError += () => errors++;
+
+        logic.SetInput(a, true);
+        logic.SetInput(b, true);
+        logic.SetInput(a, false);
+        logic.SetInput(a, true);
+        Assert.AreEqual(1, errors);
+        Assert.AreEqual(1, logic.SequenceProgress, "The wrong press on the first input starts a new run");
+
+        logic.SetInput(b, false);
+        logic.SetInput(b, true);
+        logic.SetInput(c, true);
+        Assert.IsTrue(logic.IsComplete);
+        Assert.AreEqual(1, errors);
+    }
+
+    [Test]
+    public void Sequence_ErrorKeepsProgressWhenResetIsOff()
+    {
+        var logic = new PuzzleLogic(PuzzleCompletionMode.Sequence) { ResetSequenceOnError = false };
+        int a = logic.AddInput(0);
+        int b = logic.AddInput(1);
+        int c = logic.AddInput(2);
+
+        logic.SetInput(a, true);
+        logic.SetInput(c, true);
+        Assert.AreEqual(1, logic.SequenceProgress);
+
+        logic.SetInput(c, false);
+        logic.SetInput(b, true);
+        logic.SetInput(c, true);
+        Assert.IsTrue(logic.IsComplete);
+    }
+
+    [Test]
+    public void Sequence_ActivationsAfterSolvingAreIgnored()
+    {
+        var logic = new PuzzleLogic(PuzzleCompletionMode.Sequence);
+        int a = logic.AddInput();
+        int errors = 0;
+        logic.OnSequenceError += () => errors++;
+
+        logic.SetInput(a, true);
+        logic.SetInput(a, false);
+        logic.SetInput(a, true);
+        Assert.IsTrue(logic.IsComplete);
+        Assert.AreEqual(0, errors);
+
+        logic.ResetSequence();
+        Assert.IsFalse(logic.IsComplete);
+    }
+
+    [Test]
+    public void AddPuzzleTrigger_ReturnsTheSameInputForADuplicate()
+    {
+        var go = new GameObject("PuzzleLogicTests");
+        try
+        {
+            var controller = go.AddComponent<PuzzleController>();
+            go.AddComponent<BoxCollider>(); // PuzzleTrigger requires a collider
+            var trigger = go.AddComponent<PuzzleTrigger>();
+
+            int subPuzzle = controller.AddInput(); // A nested sub-puzzle registered first
+            int index = controller.AddPuzzleTrigger(trigger);
+
+            Assert.AreNotEqual(subPuzzle, index);
+            Assert.AreEqual(index, controller.AddPuzzleTrigger(trigger));
+            Assert.AreEqual(2, controller.Logic.InputCount);
+        }
+        finally
+        {
+            Object.DestroyImmediate(go);
+        }
+    }
+}
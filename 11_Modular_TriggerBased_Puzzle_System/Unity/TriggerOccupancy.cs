@@ -0,0 +1,243 @@
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+
+public enum OccupancyMode
+{
+    Count,  // Activated while at least requiredCount matching occupants are inside
+    Mass    // Activated while the matching occupants weigh at least requiredMass
+}
+
+/* --------------------------------------------------------------------------
+   Tracks which objects are inside a trigger collider.
+
+   • Occupants are stored per object (Rigidbody owner or collider GameObject) with a collider
+     counter, so compound colliders enter/exit once.
+   • Destroyed or disabled objects are removed without leaking counts
+     (PuzzleOccupant notifies on disable, stale entries are purged otherwise).
+   • Filters by PuzzleKey assets, falling back to the legacy string tag when no keys are set.
+   • Optional Mass mode activates by accumulated weight instead of count.
+   -------------------------------------------------------------------------- */
+[RequireComponent(typeof(Collider))]
+public class TriggerOccupancy : MonoBehaviour
+{
+    [Header("Filter")]
+    [SerializeField] private PuzzleKey[] acceptedKeys;
+    [Tooltip("Legacy filter, used only when no accepted keys are assigned.")]
+    public string requiredTag = "PuzzleObject";
+
+    [Header("Activation")]
+    [SerializeField] private OccupancyMode activationMode = OccupancyMode.Count;
+    [SerializeField, Min(1)] private int requiredCount = 1;
+    [SerializeField, Min(0f)] private float requiredMass = 50f;
+
+    // (occupant, matchesFilter)
+    public event Action<GameObject, bool> OnOccupantEntered;
+    public event Action<GameObject, bool> OnOccupantExited;
+    public event Action<bool> OnActivationChanged;
+
+    private class Occupant
+    {
+        public int colliderCount;
+        public bool matches;
+        public float mass;
+        public Collider anyCollider; // Used to detect disabled colliders
+    }
+
+    private readonly Dictionary<GameObject, Occupant> occupants = new Dictionary<GameObject, Occupant>();
+    private readonly List<GameObject> staleBuffer = new List<GameObject>();
+    private readonly List<Collider> colliderBuffer = new List<Collider>();
+    private Collider triggerCollider;
+
+    public int OccupantCount => occupants.Count;
+    public int MatchingCount { get; private set; }
+    public float MatchingMass { get; private set; }
+    public bool IsActivated { get; private set; }
+
+    public bool MatchesFilter(GameObject obj, PuzzleOccupant occupant)
+    {
+        if (acceptedKeys == null || acceptedKeys.Length == 0)
+            return obj.CompareTag(requiredTag);
+
+        return occupant != null && occupant.HasAnyKey(acceptedKeys);
+    }
+
+    private static GameObject GetOccupantRoot(Collider other)
+    {
+        return other.attachedRigidbody != null ? other.attachedRigidbody.gameObject : other.gameObject;
+    }
+
+    void Awake()
+    {
+        triggerCollider = GetComponent<Collider>();
+    }
+
+    void OnTriggerEnter(Collider other)
+    {
+        PurgeStaleOccupants();
+
+        GameObject root = GetOccupantRoot(other);
+
+        if (occupants.TryGetValue(root, out Occupant entry))
+        {
+            entry.colliderCount++; // Another collider of an object already inside
+            return;
+        }
+
+        var occupantInfo = root.GetComponent<PuzzleOccupant>();
+        entry = new Occupant
+        {
+            colliderCount = 1,
+            matches = MatchesFilter(root, occupantInfo) || (root != other.gameObject && MatchesFilter(other.gameObject, occupantInfo)),
+            mass = occupantInfo != null ? occupantInfo.Mass : (other.attachedRigidbody != null ? other.attachedRigidbody.mass : 0f),
+            anyCollider = other
+        };
+        occupants.Add(root, entry);
+
+        if (entry.matches)
+        {
+            MatchingCount++;
+            MatchingMass += entry.mass;
+        }
+
+        if (occupantInfo != null && !occupantInfo.insideOf.Contains(this))
+            occupantInfo.insideOf.Add(this);
+
+        OnOccupantEntered?.Invoke(root, entry.matches);
+        EvaluateActivation();
+    }
+
+    void OnTriggerExit(Collider other)
+    {
+        GameObject root = GetOccupantRoot(other);
+
+        if (!occupants.TryGetValue(root, out Occupant entry))
+            return; // Already removed (disabled / destroyed occupant)
+
+        if (--entry.colliderCount > 0)
+        {
+            if (entry.anyCollider == other) entry.anyCollider = FindColliderInside(root, other);
+            return;
+        }
+
+        occupants.Remove(root);
+        RemoveEntry(root, entry);
+    }
+
+    void FixedUpdate()
+    {
+        if (occupants.Count > 0)
+            PurgeStaleOccupants();
+    }
+
+    void OnDisable()
+    {
+        foreach (var pair in occupants)
+        {
+            if (pair.Key == null) continue;
+            var occupantInfo = pair.Key.GetComponent<PuzzleOccupant>();
+            if (occupantInfo != null) occupantInfo.insideOf.Remove(this);
+        }
+
+        occupants.Clear();
+        MatchingCount = 0;
+        MatchingMass = 0f;
+        if (IsActivated)
+        {
+            IsActivated = false;
+            OnActivationChanged?.Invoke(false);
+        }
+    }
+
+    // Removes an object regardless of its collider counter (destroyed, disabled, teleported...)
+    public void RemoveOccupant(GameObject obj)
+    {
+        if (obj == null || !occupants.TryGetValue(obj, out Occupant entry))
+            return;
+
+        occupants.Remove(obj);
+        RemoveEntry(obj, entry);
+    }
+
+    private void RemoveEntry(GameObject obj, Occupant entry)
+    {
+        if (entry.matches)
+        {
+            MatchingCount = Mathf.Max(0, MatchingCount - 1);
+            MatchingMass = Mathf.Max(0f, MatchingMass - entry.mass);
+        }
+
+        if (obj != null)
+        {
+            var occupantInfo = obj.GetComponent<PuzzleOccupant>();
+            if (occupantInfo != null) occupantInfo.insideOf.Remove(this);
+        }
+
+        OnOccupantExited?.Invoke(obj, entry.matches);
+        EvaluateActivation();
+    }
+
+    // Objects destroyed or deactivated without a PuzzleOccupant never send OnTriggerExit
+    private void PurgeStaleOccupants()
+    {
+        staleBuffer.Clear();
+        foreach (var pair in occupants)
+        {
+            if (pair.Key == null || !pair.Key.activeInHierarchy)
+            {
+                staleBuffer.Add(pair.Key);
+                continue;
+            }
+
+            // The tracked collider left, was disabled or destroyed: track another one still inside, if any
+            Collider col = pair.Value.anyCollider;
+            if (col == null || !col.enabled || !col.gameObject.activeInHierarchy)
+                col = pair.Value.anyCollider = FindColliderInside(pair.Key, null);
+
+            if (col == null)
+                staleBuffer.Add(pair.Key);
+        }
+
+        foreach (var key in staleBuffer)
+        {
+            if (!occupants.TryGetValue(key, out Occupant entry)) continue; // Removed by a listener
+            occupants.Remove(key);
+            RemoveEntry(key, entry);
+        }
+        staleBuffer.Clear();
+    }
+
+    // An enabled collider of the occupant (other than exclude) overlapping this trigger's bounds, or null
+    private Collider FindColliderInside(GameObject obj, Collider exclude)
+    {
+        if (triggerCollider == null)
+            triggerCollider = GetComponent<Collider>();
+
+        obj.GetComponentsInChildren(false, colliderBuffer);
+        Collider found = null;
+        foreach (Collider col in colliderBuffer)
+        {
+            if (col != exclude && col.enabled && GetOccupantRoot(col) == obj && col.bounds.Intersects(triggerCollider.bounds))
+            {
+                found = col;
+                break;
+            }
+        }
+
+        colliderBuffer.Clear();
+        return found;
+    }
+
+    private void EvaluateActivation()
+    {
+        bool nowActivated = activationMode == OccupancyMode.Mass
+            ? MatchingCount > 0 && MatchingMass >= requiredMass
+            : MatchingCount >= Mathf.Max(1, requiredCount);
+
+        if (nowActivated == IsActivated)
+            return;
+
+        IsActivated = nowActivated;
+        OnActivationChanged?.Invoke(IsActivated);
+    }
+}
@@ -13,30 +13,64 @@ APuzzleController::APuzzleController()
 void APuzzleController::BeginPlay()
 {
     Super::BeginPlay();
-}
 
-void APuzzleController::AddPuzzleTrigger(APuzzleTrigger* Trigger)
-{
-    if (!Trigger) return;
-    if (!PuzzleTriggers.Contains(Trigger))
+    EnsureLogic();
+
+    if (ParentController && ParentController != this)
     {
-        PuzzleTriggers.Add(Trigger);
+        ParentInputIndex = ParentController->AddInput(SequenceOrder);
     }
 }
 
+void APuzzleController::EnsureLogic()
+{
+    // Triggers may register before our BeginPlay, so the rules are copied on first use
+    if (bLogicInitialized) return;
+
+    bLogicInitialized = true;
+    Logic.Mode = CompletionMode;
+    Logic.Threshold = Threshold;
+    Logic.bResetSequenceOnError = bResetSequenceOnError;
+    Logic.OnSequenceError = [this]() { OnSequenceError.Broadcast(); };
+}
+
+int32 APuzzleController::AddPuzzleTrigger(APuzzleTrigger* Trigger, int32 Order)
+{
+    if (!Trigger) return INDEX_NONE;
+
+    // Sub-puzzles share the input list, so a trigger's index is the one AddInput gave it, not its registration position
+    if (const int32* Existing = TriggerInputs.Find(Trigger)) return *Existing;
+
+    const int32 Index = AddInput(Order);
+    TriggerInputs.Add(Trigger, Index);
+    return Index;
+}
+
+int32 APuzzleController::AddInput(int32 Order)
+{
+    EnsureLogic();
+    return Logic.AddInput(Order);
+}
+
+void APuzzleController::SetInputState(int32 InputIndex, bool bActive)
+{
+    EnsureLogic();
+    Logic.SetInput(InputIndex, bActive);
+    CheckPuzzleState();
+}
+
+void APuzzleController::ResetPuzzle()
+{
+    EnsureLogic();
+    Logic.ResetSequence();
+    CheckPuzzleState();
+}
+
 void APuzzleController::CheckPuzzleState()
 {
     if (!GetWorld()) return;
 
-    bool bAllActivated = true;
-    for (APuzzleTrigger* T : PuzzleTriggers)
-    {
-        if (!T || !T->IsActivated())
-        {
-            bAllActivated = false;
-            break;
-        }
-    }
+    const bool bAllActivated = Logic.IsComplete();
 
     if (bAllActivated && !bPuzzleComplete)
     {
@@ -64,25 +98,26 @@ void APuzzleController::DelayedCheck()
 
 void APuzzleController::CheckPuzzleStateMethod()
 {
-    bool bAllActivated = true;
-
-    for (APuzzleTrigger* T : PuzzleTriggers)
-    {
-        if (!T || !T->IsActivated())
-        {
-            bAllActivated = false;
-            break;
-        }
-    }
+    const bool bAllActivated = Logic.IsComplete();
 
     if (bAllActivated && !bPuzzleComplete)
     {
         bPuzzleComplete = true;
         OnPuzzleComplete.Broadcast();
+        NotifyParent();
     }
     else if (!bAllActivated && bPuzzleComplete)
     {
         bPuzzleComplete = false;
         OnPuzzleCancelComplete.Broadcast();
+        NotifyParent();
+    }
+}
+
+void APuzzleController::NotifyParent()
+{
+    if (ParentController && ParentInputIndex != INDEX_NONE)
+    {
+        ParentController->SetInputState(ParentInputIndex, bPuzzleComplete);
     }
 }
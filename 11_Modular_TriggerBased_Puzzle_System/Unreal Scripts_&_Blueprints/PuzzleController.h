@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "PuzzleLogic.h"
 #include "PuzzleController.generated.h"
 
 class APuzzleTrigger;
@@ -22,9 +23,21 @@ protected:
 	void DelayedCheck();
 
 public:
-	// Add a trigger to the controller (called by triggers)
+	// Add a trigger to the controller (called by triggers). Returns the input index the trigger reports with.
 	UFUNCTION(BlueprintCallable, Category = "Puzzle")
-	void AddPuzzleTrigger(APuzzleTrigger* Trigger);
+	int32 AddPuzzleTrigger(APuzzleTrigger* Trigger, int32 Order = 0);
+
+	// Generic input registration, used by triggers and nested sub-puzzles
+	UFUNCTION(BlueprintCallable, Category = "Puzzle")
+	int32 AddInput(int32 Order = 0);
+
+	// O(1): updates the activation counter and checks the puzzle state
+	UFUNCTION(BlueprintCallable, Category = "Puzzle")
+	void SetInputState(int32 InputIndex, bool bActive);
+
+	// Restarts Sequence progress
+	UFUNCTION(BlueprintCallable, Category = "Puzzle")
+	void ResetPuzzle();
 
 	// Check puzzle state (can be delayed)
 	UFUNCTION(BlueprintCallable, Category = "Puzzle")
@@ -34,6 +47,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Puzzle")
 	void CheckPuzzleStateMethod();
 
+	UFUNCTION(BlueprintCallable, Category = "Puzzle")
+	bool IsPuzzleComplete() const { return bPuzzleComplete; }
+
+	const FPuzzleLogic& GetLogic() const { return Logic; }
+
 	// Blueprint Events
 	UPROPERTY(BlueprintAssignable, Category = "Puzzle")
 	FPuzzleControllerEvent OnPuzzleComplete;
@@ -41,11 +59,37 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Puzzle")
 	FPuzzleControllerEvent OnPuzzleCancelComplete;
 
+	UPROPERTY(BlueprintAssignable, Category = "Puzzle")
+	FPuzzleControllerEvent OnSequenceError;
+
 	// Optional delay before checking puzzle state
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle")
 	float DelayBeforeCheck = 0.0f;
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Puzzle|Rules")
+	EPuzzleCompletionMode CompletionMode = EPuzzleCompletionMode::All;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Puzzle|Rules", meta = (ClampMin = "1", EditCondition = "CompletionMode == EPuzzleCompletionMode::Threshold"))
+	int32 Threshold = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Puzzle|Rules", meta = (EditCondition = "CompletionMode == EPuzzleCompletionMode::Sequence"))
+	bool bResetSequenceOnError = true;
+
+	// Optional parent puzzle: this puzzle becomes one of its inputs
+	UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category = "Puzzle|Composite")
+	APuzzleController* ParentController = nullptr;
+
+	// Order of this sub-puzzle inside a Sequence parent
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Puzzle|Composite")
+	int32 SequenceOrder = 0;
+
 private:
-	TArray<APuzzleTrigger*> PuzzleTriggers;
+	TMap<APuzzleTrigger*, int32> TriggerInputs; // Input index given to each trigger
+	FPuzzleLogic Logic;
+	bool bLogicInitialized = false;
 	bool bPuzzleComplete;
+	int32 ParentInputIndex = INDEX_NONE;
+
+	void EnsureLogic();
+	void NotifyParent();
 };
@@ -0,0 +1,88 @@
+#include "PuzzleLogic.h"
+
+int32 FPuzzleLogic::AddInput(int32 Order)
+{
+	InputStates.Add(false);
+	InputOrders.Add(Order);
+	Sequence.Reset();
+	Evaluate();
+	return InputStates.Num() - 1;
+}
+
+bool FPuzzleLogic::SetInput(int32 Index, bool bActive)
+{
+	if (!InputStates.IsValidIndex(Index) || InputStates[Index] == bActive) return false;
+
+	InputStates[Index] = bActive;
+	ActiveCount += bActive ? 1 : -1;
+
+	if (Mode == EPuzzleCompletionMode::Sequence && bActive)
+	{
+		StepSequence(Index);
+	}
+
+	const bool bWasComplete = bComplete;
+	Evaluate();
+	return bWasComplete != bComplete;
+}
+
+void FPuzzleLogic::ResetSequence()
+{
+	SequenceProgress = 0;
+	Evaluate();
+}
+
+void FPuzzleLogic::StepSequence(int32 Index)
+{
+	if (Sequence.Num() != InputStates.Num())
+	{
+		Sequence.Reset(InputStates.Num());
+		for (int32 i = 0; i < InputStates.Num(); ++i) Sequence.Add(i);
+
+		// Registration index breaks ties so the order is deterministic
+		Sequence.Sort([this](int32 A, int32 B)
+		{
+			return InputOrders[A] != InputOrders[B] ? InputOrders[A] < InputOrders[B] : A < B;
+		});
+	}
+
+	if (SequenceProgress >= Sequence.Num()) return; // Already solved, extra activations are ignored
+
+	if (Sequence[SequenceProgress] == Index)
+	{
+		++SequenceProgress;
+		return;
+	}
+
+	// The wrong press still counts as the first step when it starts the sequence
+	if (bResetSequenceOnError)
+	{
+		SequenceProgress = Sequence[0] == Index ? 1 : 0;
+	}
+
+	if (OnSequenceError)
+	{
+		OnSequenceError();
+	}
+}
+
+void FPuzzleLogic::Evaluate()
+{
+	const int32 Count = InputStates.Num();
+
+	switch (Mode)
+	{
+	case EPuzzleCompletionMode::Any:
+		bComplete = ActiveCount > 0;
+		break;
+	case EPuzzleCompletionMode::Threshold:
+		bComplete = Count > 0 && ActiveCount >= FMath::Clamp(Threshold, 1, Count);
+		break;
+	case EPuzzleCompletionMode::Sequence:
+		bComplete = Count > 0 && SequenceProgress >= Count;
+		break;
+	default:
+		bComplete = Count > 0 && ActiveCount == Count;
+		break;
+	}
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuzzleLogic.generated.h"
+
+UENUM(BlueprintType)
+enum class EPuzzleCompletionMode : uint8
+{
+	All,		// AND: every input active
+	Any,		// OR: at least one input active
+	Threshold,	// At least Threshold inputs active
+	Sequence	// Every input activated once, in sequence order
+};
+
+/* --------------------------------------------------------------------------
+   Engine-free puzzle state used by APuzzleController.
+   Inputs (triggers or nested sub-puzzles) report their state by index and
+   completion is evaluated in O(1) from an activation counter, so it can be
+   driven deterministically without physics or a world.
+   -------------------------------------------------------------------------- */
+class MECHANICS_TEST_LVN_API FPuzzleLogic
+{
+public:
+
+	EPuzzleCompletionMode Mode = EPuzzleCompletionMode::All;
+	int32 Threshold = 1;
+	bool bResetSequenceOnError = true;
+
+	// Called when an input is activated out of order in Sequence mode
+	TFunction<void()> OnSequenceError;
+
+	// Registers a new input and returns its index. Order is only used in Sequence mode.
+	int32 AddInput(int32 Order = 0);
+
+	// Returns true when the completion state changed
+	bool SetInput(int32 Index, bool bActive);
+
+	void ResetSequence();
+
+	bool IsInputActive(int32 Index) const { return InputStates.IsValidIndex(Index) && InputStates[Index]; }
+	bool IsComplete() const { return bComplete; }
+	int32 GetInputCount() const { return InputStates.Num(); }
+	int32 GetActiveCount() const { return ActiveCount; }
+	int32 GetSequenceProgress() const { return SequenceProgress; }
+
+private:
+
+	TBitArray<> InputStates;
+	TArray<int32> InputOrders;
+	TArray<int32> Sequence; // Input indices sorted by (order, registration), built on first sequence step
+	int32 ActiveCount = 0;
+	int32 SequenceProgress = 0;
+	bool bComplete = false;
+
+	void StepSequence(int32 Index);
+	void Evaluate();
+};
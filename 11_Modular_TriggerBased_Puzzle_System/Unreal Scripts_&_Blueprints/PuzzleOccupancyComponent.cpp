@@ -0,0 +1,183 @@
+#include "PuzzleOccupancyComponent.h"
+#include "PuzzleOccupantComponent.h"
+#include "GameplayTagAssetInterface.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+
+UPuzzleOccupancyComponent::UPuzzleOccupancyComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UPuzzleOccupancyComponent::BindToVolume(UPrimitiveComponent* Volume)
+{
+    if (!Volume || BoundVolume == Volume) return;
+
+    if (UPrimitiveComponent* Previous = BoundVolume.Get())
+    {
+        Previous->OnComponentBeginOverlap.RemoveDynamic(this, &UPuzzleOccupancyComponent::OnVolumeBeginOverlap);
+        Previous->OnComponentEndOverlap.RemoveDynamic(this, &UPuzzleOccupancyComponent::OnVolumeEndOverlap);
+    }
+
+    BoundVolume = Volume;
+    Volume->OnComponentBeginOverlap.AddDynamic(this, &UPuzzleOccupancyComponent::OnVolumeBeginOverlap);
+    Volume->OnComponentEndOverlap.AddDynamic(this, &UPuzzleOccupancyComponent::OnVolumeEndOverlap);
+}
+
+void UPuzzleOccupancyComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    for (const auto& Pair : Occupants)
+    {
+        if (AActor* Actor = Pair.Key.Get())
+        {
+            Actor->OnDestroyed.RemoveDynamic(this, &UPuzzleOccupancyComponent::OnOccupantDestroyed);
+
+            if (UPuzzleOccupantComponent* Occupant = Actor->FindComponentByClass<UPuzzleOccupantComponent>())
+            {
+                Occupant->InsideOf.RemoveSingleSwap(this);
+            }
+        }
+    }
+    Occupants.Reset();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+bool UPuzzleOccupancyComponent::MatchesFilter(const AActor* Actor) const
+{
+    if (!Actor) return false;
+
+    if (AcceptedTags.IsEmpty())
+        return Actor->ActorHasTag(RequiredActorTag);
+
+    if (const UPuzzleOccupantComponent* Occupant = Actor->FindComponentByClass<UPuzzleOccupantComponent>())
+        return Occupant->OccupantTags.HasAny(AcceptedTags);
+
+    if (const IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Actor))
+        return TagInterface->HasAnyMatchingGameplayTags(AcceptedTags);
+
+    return false;
+}
+
+float UPuzzleOccupancyComponent::GetOccupantMass(const AActor* Actor, const UPrimitiveComponent* Comp) const
+{
+    if (const UPuzzleOccupantComponent* Occupant = Actor->FindComponentByClass<UPuzzleOccupantComponent>())
+    {
+        if (Occupant->MassOverride >= 0.0f) return Occupant->MassOverride;
+    }
+
+    const UPrimitiveComponent* Body = Cast<UPrimitiveComponent>(Actor->GetRootComponent());
+    if (!Body || !Body->IsSimulatingPhysics()) Body = Comp;
+
+    return (Body && Body->IsSimulatingPhysics()) ? Body->GetMass() : 0.0f;
+}
+
+void UPuzzleOccupancyComponent::OnVolumeBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
+                                                     UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
+                                                     bool bFromSweep, const FHitResult& SweepResult)
+{
+    if (!OtherActor || OtherActor == GetOwner()) return;
+
+    PurgeStaleOccupants();
+
+    FOccupant& Entry = Occupants.FindOrAdd(OtherActor);
+    if (++Entry.OverlapCount > 1) return; // Another component of an actor already inside
+
+    Entry.bMatches = MatchesFilter(OtherActor);
+    Entry.Mass = GetOccupantMass(OtherActor, OtherComp);
+
+    if (Entry.bMatches)
+    {
+        ++MatchingCount;
+        MatchingMass += Entry.Mass;
+    }
+
+    OtherActor->OnDestroyed.AddUniqueDynamic(this, &UPuzzleOccupancyComponent::OnOccupantDestroyed);
+    if (UPuzzleOccupantComponent* Occupant = OtherActor->FindComponentByClass<UPuzzleOccupantComponent>())
+    {
+        Occupant->InsideOf.AddUnique(this);
+    }
+
+    OnOccupantEntered.Broadcast(OtherActor, Entry.bMatches);
+    EvaluateActivation();
+}
+
+void UPuzzleOccupancyComponent::OnVolumeEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
+                                                   UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+    if (!OtherActor) return;
+
+    FOccupant* Entry = Occupants.Find(OtherActor);
+    if (!Entry) return; // Already removed (destroyed / deactivated occupant)
+
+    if (--Entry->OverlapCount > 0) return;
+
+    const FOccupant Removed = *Entry;
+    Occupants.Remove(OtherActor);
+    RemoveEntry(OtherActor, Removed);
+}
+
+void UPuzzleOccupancyComponent::OnOccupantDestroyed(AActor* DestroyedActor)
+{
+    RemoveOccupant(DestroyedActor);
+}
+
+void UPuzzleOccupancyComponent::RemoveOccupant(AActor* Actor)
+{
+    FOccupant Removed;
+    if (!Actor || !Occupants.RemoveAndCopyValue(Actor, Removed)) return;
+
+    RemoveEntry(Actor, Removed);
+}
+
+void UPuzzleOccupancyComponent::RemoveEntry(AActor* Actor, const FOccupant& Entry)
+{
+    if (Entry.bMatches)
+    {
+        MatchingCount = FMath::Max(0, MatchingCount - 1);
+        MatchingMass = FMath::Max(0.0f, MatchingMass - Entry.Mass);
+    }
+
+    if (Actor)
+    {
+        Actor->OnDestroyed.RemoveDynamic(this, &UPuzzleOccupancyComponent::OnOccupantDestroyed);
+        if (UPuzzleOccupantComponent* Occupant = Actor->FindComponentByClass<UPuzzleOccupantComponent>())
+        {
+            Occupant->InsideOf.RemoveSingleSwap(this);
+        }
+    }
+
+    OnOccupantExited.Broadcast(Actor, Entry.bMatches);
+    EvaluateActivation();
+}
+
+void UPuzzleOccupancyComponent::PurgeStaleOccupants()
+{
+    // Actors garbage collected without an end overlap or OnDestroyed (e.g. streamed out levels)
+    TArray<FOccupant, TInlineAllocator<4>> Stale;
+    for (auto It = Occupants.CreateIterator(); It; ++It)
+    {
+        if (It.Key().IsValid()) continue;
+
+        Stale.Add(It.Value());
+        It.RemoveCurrent();
+    }
+
+    // Broadcast after iterating, listeners may add or remove occupants
+    for (const FOccupant& Removed : Stale)
+    {
+        RemoveEntry(nullptr, Removed);
+    }
+}
+
+void UPuzzleOccupancyComponent::EvaluateActivation()
+{
+    const bool bNowActivated = ActivationMode == EPuzzleOccupancyMode::Mass
+        ? MatchingCount > 0 && MatchingMass >= RequiredMass
+        : MatchingCount >= FMath::Max(1, RequiredCount);
+
+    if (bNowActivated == bActivated) return;
+
+    bActivated = bNowActivated;
+    OnActivationChanged.Broadcast(bActivated);
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplayTagContainer.h"
+#include "PuzzleOccupancyComponent.generated.h"
+
+class UPrimitiveComponent;
+
+UENUM(BlueprintType)
+enum class EPuzzleOccupancyMode : uint8
+{
+	Count,	// Activated while at least RequiredCount matching occupants are inside
+	Mass	// Activated while the matching occupants weigh at least RequiredMass
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FPuzzleOccupantEvent, AActor*, Occupant, bool, bMatchesFilter);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FPuzzleOccupancyActivationEvent, bool, bActivated);
+
+/* --------------------------------------------------------------------------
+   Tracks which actors are inside a trigger volume.
+
+   • Occupants are stored per actor (weak pointers) with an overlap counter, so actors
+	 with several colliding components enter/exit once and a destroyed actor never leaks.
+   • Filters by gameplay tags (UPuzzleOccupantComponent or IGameplayTagAssetInterface),
+	 falling back to the legacy actor tag when no tags are configured.
+   • Optional Mass mode activates by accumulated weight instead of count.
+   -------------------------------------------------------------------------- */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class MECHANICS_TEST_LVN_API UPuzzleOccupancyComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UPuzzleOccupancyComponent();
+
+	// Matching occupants need any of these tags. Empty uses RequiredActorTag instead.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Occupancy")
+	FGameplayTagContainer AcceptedTags;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Occupancy")
+	FName RequiredActorTag = FName("PuzzleObject");
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Occupancy")
+	EPuzzleOccupancyMode ActivationMode = EPuzzleOccupancyMode::Count;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Occupancy", meta = (ClampMin = "1", EditCondition = "ActivationMode == EPuzzleOccupancyMode::Count"))
+	int32 RequiredCount = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Occupancy", meta = (ClampMin = "0", EditCondition = "ActivationMode == EPuzzleOccupancyMode::Mass"))
+	float RequiredMass = 50.0f;
+
+	UPROPERTY(BlueprintAssignable, Category = "Occupancy")
+	FPuzzleOccupantEvent OnOccupantEntered;
+
+	UPROPERTY(BlueprintAssignable, Category = "Occupancy")
+	FPuzzleOccupantEvent OnOccupantExited;
+
+	UPROPERTY(BlueprintAssignable, Category = "Occupancy")
+	FPuzzleOccupancyActivationEvent OnActivationChanged;
+
+	// Starts tracking the overlaps of Volume
+	UFUNCTION(BlueprintCallable, Category = "Occupancy")
+	void BindToVolume(UPrimitiveComponent* Volume);
+
+	// Removes an actor regardless of its overlap counter (destroyed, disabled, teleported...)
+	UFUNCTION(BlueprintCallable, Category = "Occupancy")
+	void RemoveOccupant(AActor* Actor);
+
+	UFUNCTION(BlueprintCallable, Category = "Occupancy")
+	bool MatchesFilter(const AActor* Actor) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Occupancy")
+	int32 GetOccupantCount() const { return Occupants.Num(); }
+
+	UFUNCTION(BlueprintCallable, Category = "Occupancy")
+	int32 GetMatchingCount() const { return MatchingCount; }
+
+	UFUNCTION(BlueprintCallable, Category = "Occupancy")
+	float GetMatchingMass() const { return MatchingMass; }
+
+	UFUNCTION(BlueprintCallable, Category = "Occupancy")
+	bool IsActivated() const { return bActivated; }
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	UFUNCTION()
+	void OnVolumeBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
+							  UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
+							  bool bFromSweep, const FHitResult& SweepResult);
+
+	UFUNCTION()
+	void OnVolumeEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
+							UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+
+	UFUNCTION()
+	void OnOccupantDestroyed(AActor* DestroyedActor);
+
+private:
+	struct FOccupant
+	{
+		int32 OverlapCount = 0;
+		bool bMatches = false;
+		float Mass = 0.0f;
+	};
+
+	TMap<TWeakObjectPtr<AActor>, FOccupant> Occupants;
+	TWeakObjectPtr<UPrimitiveComponent> BoundVolume;
+	int32 MatchingCount = 0;
+	float MatchingMass = 0.0f;
+	bool bActivated = false;
+
+	float GetOccupantMass(const AActor* Actor, const UPrimitiveComponent* Comp) const;
+	void RemoveEntry(AActor* Actor, const FOccupant& Entry);
+	void PurgeStaleOccupants();
+	void EvaluateActivation();
+};
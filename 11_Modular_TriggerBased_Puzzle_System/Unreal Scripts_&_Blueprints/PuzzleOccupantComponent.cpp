@@ -0,0 +1,34 @@
+#include "PuzzleOccupantComponent.h"
+#include "PuzzleOccupancyComponent.h"
+
+UPuzzleOccupantComponent::UPuzzleOccupantComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UPuzzleOccupantComponent::Deactivate()
+{
+    LeaveAllOccupancies();
+    Super::Deactivate();
+}
+
+void UPuzzleOccupantComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    LeaveAllOccupancies();
+    Super::EndPlay(EndPlayReason);
+}
+
+void UPuzzleOccupantComponent::LeaveAllOccupancies()
+{
+    // Copy: RemoveOccupant edits InsideOf
+    const TArray<TWeakObjectPtr<UPuzzleOccupancyComponent>> Occupancies = InsideOf;
+    InsideOf.Reset();
+
+    for (const TWeakObjectPtr<UPuzzleOccupancyComponent>& Occupancy : Occupancies)
+    {
+        if (Occupancy.IsValid())
+        {
+            Occupancy->RemoveOccupant(GetOwner());
+        }
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplayTagContainer.h"
+#include "PuzzleOccupantComponent.generated.h"
+
+class UPuzzleOccupancyComponent;
+
+// Optional component for objects that interact with puzzle triggers.
+// Provides the gameplay tags / mass used by UPuzzleOccupancyComponent filters and
+// removes the owner from every trigger it is inside when it is deactivated or destroyed.
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class MECHANICS_TEST_LVN_API UPuzzleOccupantComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UPuzzleOccupantComponent();
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle")
+	FGameplayTagContainer OccupantTags;
+
+	// Mass used by Mass occupancy mode. Negative uses the simulated physics mass of the overlapping body.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle")
+	float MassOverride = -1.0f;
+
+	// Occupancy components currently containing the owner (maintained by UPuzzleOccupancyComponent)
+	TArray<TWeakObjectPtr<UPuzzleOccupancyComponent>> InsideOf;
+
+protected:
+	virtual void Deactivate() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	void LeaveAllOccupancies();
+};
@@ -1,7 +1,10 @@
 #include "PuzzleTrigger.h"
 #include "Components/BoxComponent.h"
+#include "Components/StaticMeshComponent.h"
 #include "Engine/World.h"
+#include "Materials/MaterialInstanceDynamic.h"
 #include "PuzzleController.h" // forward declared in header
+#include "PuzzleOccupancyComponent.h"
 #include "Components/SceneComponent.h"
 
 APuzzleTrigger::APuzzleTrigger()
@@ -16,87 +19,97 @@ APuzzleTrigger::APuzzleTrigger()
     BoxComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
     BoxComponent->SetGenerateOverlapEvents(true);
 
-    ObjectsInside = 0;
+    OccupancyComponent = CreateDefaultSubobject<UPuzzleOccupancyComponent>(TEXT("OccupancyComponent"));
+
     bIsActivated = false;
 }
 
 
+void APuzzleTrigger::PostLoad()
+{
+    Super::PostLoad();
+
+    // The occupancy component is the only place the tag is set now
+    if (!RequiredTag_DEPRECATED.IsNone() && OccupancyComponent != nullptr)
+    {
+        OccupancyComponent->RequiredActorTag = RequiredTag_DEPRECATED;
+        RequiredTag_DEPRECATED = NAME_None;
+    }
+}
+
 void APuzzleTrigger::BeginPlay()
 {
     Super::BeginPlay();
 
-    BoxComponent->OnComponentBeginOverlap.AddDynamic(this, &APuzzleTrigger::OnOverlapBegin);
-    BoxComponent->OnComponentEndOverlap.AddDynamic(this, &APuzzleTrigger::OnOverlapEnd);
+    OccupancyComponent->OnOccupantEntered.AddDynamic(this, &APuzzleTrigger::OnOccupantEntered);
+    OccupancyComponent->OnOccupantExited.AddDynamic(this, &APuzzleTrigger::OnOccupantExited);
+    OccupancyComponent->OnActivationChanged.AddDynamic(this, &APuzzleTrigger::OnOccupancyActivationChanged);
+    OccupancyComponent->BindToVolume(BoxComponent);
 
     if (PuzzleController != nullptr)
     {
-        PuzzleController->AddPuzzleTrigger(this);
+        ControllerInputIndex = PuzzleController->AddPuzzleTrigger(this, SequenceOrder);
     }
 }
 
-void APuzzleTrigger::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-                                    UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
-                                    bool bFromSweep, const FHitResult& SweepResult)
+void APuzzleTrigger::OnOccupantEntered(AActor* Occupant, bool bMatchesFilter)
 {
-    if (!OtherActor || OtherActor == this) return;
-
-    if (bTriggerOnlyWhenEmpty)
+    // Occupant count is already updated: 1 means the trigger was empty
+    if (bTriggerOnlyWhenEmpty && OccupancyComponent->GetOccupantCount() > 1)
     {
-        ObjectsInside++;
-        if (ObjectsInside > 1)
-        {
-            return; // do not trigger if more than one object is inside
-        }
+        return; // do not trigger if more than one object is inside
     }
 
     OnAnyEnter.Broadcast();
-    UE_LOG(LogTemp, Log, TEXT("Object entered PuzzleTrigger: %s"), *OtherActor->GetName());
+    UE_LOG(LogTemp, Log, TEXT("Object entered PuzzleTrigger: %s"), *GetNameSafe(Occupant));
+}
 
-    if (!bIsActivated && OtherActor->ActorHasTag(RequiredTag))
+void APuzzleTrigger::OnOccupantExited(AActor* Occupant, bool bMatchesFilter)
+{
+    if (bTriggerOnlyWhenEmpty && OccupancyComponent->GetOccupantCount() > 0)
     {
-        bIsActivated = true;
-        OnTagEnter.Broadcast();
-
-        if (PuzzleController)
-        {
-            PuzzleController->CheckPuzzleState();
-        }
-
-        UE_LOG(LogTemp, Log, TEXT("PuzzleTrigger activated by %s"), *OtherActor->GetName());
+        return; // still objects inside, do not trigger exit logic
     }
+
+    OnAnyExit.Broadcast();
+    UE_LOG(LogTemp, Log, TEXT("Object exited PuzzleTrigger: %s"), *GetNameSafe(Occupant));
 }
 
-void APuzzleTrigger::OnOverlapEnd(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-                                  UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+void APuzzleTrigger::OnOccupancyActivationChanged(bool bActivated)
 {
-    if (!OtherActor || OtherActor == this) return;
+    bIsActivated = bActivated;
 
-    if (bTriggerOnlyWhenEmpty)
+    if (bIsActivated)
     {
-        ObjectsInside--;
-        if (ObjectsInside <= 0)
-        {
-            ObjectsInside = 0;
-        }
-        else
-        {
-            return; // still objects inside, do not trigger exit logic
-        }
+        OnTagEnter.Broadcast();
+    }
+    else
+    {
+        OnTagExit.Broadcast();
     }
 
-    OnAnyExit.Broadcast();
-    UE_LOG(LogTemp, Log, TEXT("Object exited PuzzleTrigger: %s"), *OtherActor->GetName());
+    ReportStateToController();
+
+    UE_LOG(LogTemp, Log, TEXT("PuzzleTrigger %s %s"), *GetName(), bIsActivated ? TEXT("activated") : TEXT("deactivated"));
+}
 
-    if (bIsActivated && OtherActor->ActorHasTag(RequiredTag))
+void APuzzleTrigger::ReportStateToController()
+{
+    if (PuzzleController && ControllerInputIndex != INDEX_NONE)
     {
-        bIsActivated = false;
-        OnTagExit.Broadcast();
+        PuzzleController->SetInputState(ControllerInputIndex, bIsActivated);
+    }
+}
 
-        if (PuzzleController)
-        {
-            PuzzleController->CheckPuzzleState();
-        }
+void APuzzleTrigger::SetFeedbackColor(FLinearColor Color)
+{
+    if (!FeedbackMesh) return;
 
-        UE_LOG(LogTemp, Log, TEXT("PuzzleTrigger deactivated by %s"), *OtherActor->GetName());
+    if (!FeedbackMaterial)
+    {
+        FeedbackMaterial = FeedbackMesh->CreateAndSetMaterialInstanceDynamic(0);
+        if (!FeedbackMaterial) return;
     }
+
+    FeedbackMaterial->SetVectorParameterValue(FeedbackColorParameter, Color);
 }
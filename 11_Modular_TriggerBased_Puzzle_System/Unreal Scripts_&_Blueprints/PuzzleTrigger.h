@@ -6,7 +6,9 @@
 
 class UBoxComponent;
 class UStaticMeshComponent;
+class UMaterialInstanceDynamic;
 class APuzzleController;
+class UPuzzleOccupancyComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FPuzzleTriggerEvent);
 
@@ -18,25 +20,35 @@ class MECHANICS_TEST_LVN_API APuzzleTrigger : public AActor
 public:
     APuzzleTrigger();
 
+    virtual void PostLoad() override;
+
 protected:
     virtual void BeginPlay() override;
 
     UFUNCTION()
-    void OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-                        UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
-                        bool bFromSweep, const FHitResult& SweepResult);
+    void OnOccupantEntered(AActor* Occupant, bool bMatchesFilter);
+
+    UFUNCTION()
+    void OnOccupantExited(AActor* Occupant, bool bMatchesFilter);
 
     UFUNCTION()
-    void OnOverlapEnd(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-                      UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+    void OnOccupancyActivationChanged(bool bActivated);
 
 private:
-    int32 ObjectsInside = 0;
     bool bIsActivated = false;
+    int32 ControllerInputIndex = INDEX_NONE;
+
+    // Created on first SetFeedbackColor so triggers without feedback don't duplicate their material
+    UPROPERTY(Transient)
+    UMaterialInstanceDynamic* FeedbackMaterial = nullptr;
+
+    void ReportStateToController();
+
+    // Tag filter saved by triggers from before the occupancy component owned it (RequiredActorTag). Only read in PostLoad to move it there.
+    UPROPERTY()
+    FName RequiredTag_DEPRECATED = NAME_None;
 
 public:
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle", meta = (ExposeOnSpawn = "true"))
-    FName RequiredTag = FName("PuzzleObject");
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle")
     bool bTriggerOnlyWhenEmpty = false;
@@ -44,6 +56,10 @@ public:
     UPROPERTY(EditInstanceOnly, BlueprintReadWrite, Category = "Puzzle")
     APuzzleController* PuzzleController = nullptr;
 
+    // Only used when the controller is in Sequence mode
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle")
+    int32 SequenceOrder = 0;
+
     UPROPERTY(BlueprintAssignable, Category = "Puzzle")
     FPuzzleTriggerEvent OnAnyEnter;
 
@@ -59,6 +75,21 @@ public:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Puzzle")
     UBoxComponent* BoxComponent = nullptr;
 
+    // Tracks who is inside BoxComponent (filters, mass mode, destroyed occupants)
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Puzzle")
+    UPuzzleOccupancyComponent* OccupancyComponent = nullptr;
+
+    // Optional mesh used for visual feedback
+    UPROPERTY(EditInstanceOnly, BlueprintReadWrite, Category = "Puzzle|Feedback")
+    UStaticMeshComponent* FeedbackMesh = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle|Feedback")
+    FName FeedbackColorParameter = FName("Color");
+
     UFUNCTION(BlueprintCallable, Category = "Puzzle")
     bool IsActivated() const { return bIsActivated; }
+
+    // Sets a vector parameter on a single dynamic material instance instead of swapping materials
+    UFUNCTION(BlueprintCallable, Category = "Puzzle|Feedback")
+    void SetFeedbackColor(FLinearColor Color);
 };
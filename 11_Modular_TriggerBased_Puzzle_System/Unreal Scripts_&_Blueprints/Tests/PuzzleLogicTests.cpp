@@ -0,0 +1,192 @@
+#include "Misc/AutomationTest.h"
+#include "PuzzleLogic.h"
+#include "PuzzleController.h"
+#include "PuzzleTrigger.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Deterministic checks of the puzzle rules: FPuzzleLogic is driven by input index only, no world or physics involved.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Puzzle; Quit" -nullrhi -unattended
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPuzzleLogicAllTest, "LVN.Puzzle.Logic.All", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPuzzleLogicAllTest::RunTest(const FString& Parameters)
+{
+	FPuzzleLogic Logic;
+	TestFalse(TEXT("No inputs is never complete"), Logic.IsComplete());
+
+	const int32 A = Logic.AddInput();
+	const int32 B = Logic.AddInput();
+
+	TestFalse(TEXT("First input does not change completion"), Logic.SetInput(A, true));
+	TestTrue(TEXT("Last input completes"), Logic.SetInput(B, true));
+	TestTrue(TEXT("Deactivating cancels"), Logic.SetInput(A, false));
+	TestFalse(TEXT("Incomplete after cancel"), Logic.IsComplete());
+	TestEqual(TEXT("Active count"), Logic.GetActiveCount(), 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPuzzleLogicAnyTest, "LVN.Puzzle.Logic.Any", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPuzzleLogicAnyTest::RunTest(const FString& Parameters)
+{
+	FPuzzleLogic Logic;
+	Logic.Mode = EPuzzleCompletionMode::Any;
+	const int32 A = Logic.AddInput();
+	const int32 B = Logic.AddInput();
+
+	TestTrue(TEXT("One input completes"), Logic.SetInput(B, true));
+	TestFalse(TEXT("Second input does not change completion"), Logic.SetInput(A, true));
+	TestFalse(TEXT("Still complete with one input left"), Logic.SetInput(B, false));
+	TestTrue(TEXT("Last input off cancels"), Logic.SetInput(A, false));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPuzzleLogicThresholdTest, "LVN.Puzzle.Logic.Threshold", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPuzzleLogicThresholdTest::RunTest(const FString& Parameters)
+{
+	// Threshold -> active inputs needed out of 3 (clamped to 1..Count)
+	const TPair<int32, int32> Cases[] = { { 2, 2 }, { 0, 1 }, { 5, 3 } };
+
+	for (const TPair<int32, int32>& Case : Cases)
+	{
+		FPuzzleLogic Logic;
+		Logic.Mode = EPuzzleCompletionMode::Threshold;
+		Logic.Threshold = Case.Key;
+		for (int32 i = 0; i < 3; ++i) Logic.AddInput();
+
+		for (int32 i = 0; i < Case.Value - 1; ++i) Logic.SetInput(i, true);
+		TestFalse(FString::Printf(TEXT("Threshold %d: incomplete below %d"), Case.Key, Case.Value), Logic.IsComplete());
+		Logic.SetInput(Case.Value - 1, true);
+		TestTrue(FString::Printf(TEXT("Threshold %d: complete at %d"), Case.Key, Case.Value), Logic.IsComplete());
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPuzzleLogicInvalidInputTest, "LVN.Puzzle.Logic.InvalidInput", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPuzzleLogicInvalidInputTest::RunTest(const FString& Parameters)
+{
+	FPuzzleLogic Logic;
+	Logic.Mode = EPuzzleCompletionMode::Any;
+	const int32 A = Logic.AddInput();
+
+	TestFalse(TEXT("Negative index"), Logic.SetInput(-1, true));
+	TestFalse(TEXT("Index past the end"), Logic.SetInput(1, true));
+	TestTrue(TEXT("Valid index"), Logic.SetInput(A, true));
+	TestFalse(TEXT("Repeated state"), Logic.SetInput(A, true));
+	TestEqual(TEXT("Active count"), Logic.GetActiveCount(), 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPuzzleLogicSequenceTest, "LVN.Puzzle.Logic.Sequence", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPuzzleLogicSequenceTest::RunTest(const FString& Parameters)
+{
+	// Order first, registration breaks ties
+	{
+		FPuzzleLogic Logic;
+		Logic.Mode = EPuzzleCompletionMode::Sequence;
+		const int32 Last = Logic.AddInput(2);
+		const int32 First = Logic.AddInput(1);
+		const int32 Second = Logic.AddInput(1);
+
+		Logic.SetInput(First, true);
+		Logic.SetInput(Second, true);
+		TestEqual(TEXT("Progress after two steps"), Logic.GetSequenceProgress(), 2);
+		TestTrue(TEXT("Last step completes"), Logic.SetInput(Last, true));
+	}
+
+	// An error resets the progress and raises OnSequenceError
+	{
+		FPuzzleLogic Logic;
+		Logic.Mode = EPuzzleCompletionMode::Sequence;
+		const int32 A = Logic.AddInput(0);
+		const int32 B = Logic.AddInput(1);
+		const int32 C = Logic.AddInput(2);
+		int32 Errors = 0;
+		Logic.OnSequenceError = [&Errors]() { ++Errors; };
+
+		Logic.SetInput(A, true);
+		Logic.SetInput(C, true);
+		TestEqual(TEXT("One error"), Errors, 1);
+		TestEqual(TEXT("Progress reset"), Logic.GetSequenceProgress(), 0);
+
+		Logic.SetInput(A, false);
+		Logic.SetInput(C, false);
+		Logic.SetInput(A, true);
+		Logic.SetInput(B, true);
+		Logic.SetInput(C, true);
+		TestTrue(TEXT("Complete after a clean run"), Logic.IsComplete());
+		TestEqual(TEXT("No further errors"), Errors, 1);
+
+		Logic.ResetSequence();
+		TestFalse(TEXT("ResetSequence cancels"), Logic.IsComplete());
+	}
+
+	// An error on the first input of the sequence counts as its first step
+	{
+		FPuzzleLogic Logic;
+		Logic.Mode = EPuzzleCompletionMode::Sequence;
+		const int32 A = Logic.AddInput(0);
+		const int32 B = Logic.AddInput(1);
+		const int32 C = Logic.AddInput(2);
+		int32 Errors = 0;
+		Logic.OnSequenceError = [&Errors]() { ++Errors; };
+
+		Logic.SetInput(A, true);
+		Logic.SetInput(B, true);
+		Logic.SetInput(A, false);
+		Logic.SetInput(A, true);
+		TestEqual(TEXT("One error"), Errors, 1);
+		TestEqual(TEXT("Restarted from the first input"), Logic.GetSequenceProgress(), 1);
+
+		Logic.SetInput(B, false);
+		Logic.SetInput(B, true);
+		Logic.SetInput(C, true);
+		TestTrue(TEXT("Complete without pressing it again"), Logic.IsComplete());
+		TestEqual(TEXT("No further errors"), Errors, 1);
+	}
+
+	// Without bResetSequenceOnError the progress survives the error
+	{
+		FPuzzleLogic Logic;
+		Logic.Mode = EPuzzleCompletionMode::Sequence;
+		Logic.bResetSequenceOnError = false;
+		const int32 A = Logic.AddInput(0);
+		const int32 B = Logic.AddInput(1);
+		const int32 C = Logic.AddInput(2);
+
+		Logic.SetInput(A, true);
+		Logic.SetInput(C, true);
+		TestEqual(TEXT("Progress kept"), Logic.GetSequenceProgress(), 1);
+
+		Logic.SetInput(C, false);
+		Logic.SetInput(B, true);
+		Logic.SetInput(C, true);
+		TestTrue(TEXT("Complete"), Logic.IsComplete());
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPuzzleControllerDuplicateTriggerTest, "LVN.Puzzle.Controller.DuplicateTrigger", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPuzzleControllerDuplicateTriggerTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+	Context.SetCurrentWorld(World);
+
+	APuzzleController* Controller = World->SpawnActor<APuzzleController>();
+	APuzzleTrigger* Trigger = World->SpawnActor<APuzzleTrigger>();
+
+	const int32 SubPuzzle = Controller->AddInput(); // A nested sub-puzzle registered first
+	const int32 Index = Controller->AddPuzzleTrigger(Trigger);
+
+	TestNotEqual(TEXT("Trigger gets its own input"), Index, SubPuzzle);
+	TestEqual(TEXT("Duplicate registration returns the same input"), Controller->AddPuzzleTrigger(Trigger), Index);
+	TestEqual(TEXT("No extra input"), Controller->GetLogic().GetInputCount(), 2);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif
@@ -0,0 +1,81 @@
+#if UNITY_EDITOR
+using System.Collections.Generic;
+using UnityEditor;
+using UnityEditor.Build;
+using UnityEditor.Build.Reporting;
+using UnityEditor.SceneManagement;
+using UnityEngine;
+using UnityEngine.SceneManagement;
+
+// Fails the build when build scenes share GUIDs or prefab assets carry one. All build scenes are checked
+// together, since any of them can be loaded additively next to another.
+public class GUIDValidationBuildStep : IPreprocessBuildWithReport
+{
+    public int callbackOrder => 0;
+
+    public void OnPreprocessBuild(BuildReport report)
+    {
+        List<string> problems = Validate();
+        if (problems.Count == 0) return;
+
+        foreach (string problem in problems)
+            Debug.LogError($"[GUIDAuthority] {problem}");
+
+        throw new BuildFailedException($"[GUIDAuthority] {problems.Count} GUID problem(s) found. Open the scenes and run Tools/Save System/Repair GUIDs In Open Scenes.");
+    }
+
+    [MenuItem("Tools/Save System/Validate GUIDs")]
+    private static void ValidateMenu()
+    {
+        List<string> problems = Validate();
+        foreach (string problem in problems)
+            Debug.LogWarning($"[GUIDAuthority] {problem}");
+
+        Debug.Log($"[GUIDAuthority] Validation finished: {problems.Count} problem(s).");
+    }
+
+    [MenuItem("Tools/Save System/Repair GUIDs In Open Scenes")]
+    private static void RepairMenu()
+    {
+        Debug.Log($"[GUIDAuthority] Repaired {GUIDAuthority.RepairOpenScenes()} ID(s).");
+    }
+
+    public static List<string> Validate()
+    {
+        var scenes = new List<Scene>();
+        var opened = new List<Scene>();
+
+        foreach (EditorBuildSettingsScene buildScene in EditorBuildSettings.scenes)
+        {
+            if (!buildScene.enabled) continue;
+
+            // Scenes already open are checked as they are in memory, the rest are opened for the check
+            Scene scene = SceneManager.GetSceneByPath(buildScene.path);
+            if (!scene.isLoaded)
+            {
+                scene = EditorSceneManager.OpenScene(buildScene.path, OpenSceneMode.Additive);
+                opened.Add(scene);
+            }
+            scenes.Add(scene);
+        }
+
+        List<string> problems = GUIDAuthority.FindCollisions(scenes);
+
+        foreach (Scene scene in opened)
+            EditorSceneManager.CloseScene(scene, true);
+
+        foreach (string guid in AssetDatabase.FindAssets("t:Prefab"))
+        {
+            string path = AssetDatabase.GUIDToAssetPath(guid);
+            GameObject prefab = AssetDatabase.LoadAssetAtPath<GameObject>(path);
+            if (!prefab) continue;
+
+            foreach (GUIDComponent component in prefab.GetComponentsInChildren<GUIDComponent>(true))
+                if (!string.IsNullOrEmpty(component.ID))
+                    problems.Add($"Prefab '{path}' ({component.name}) carries ID {component.ID}. Every instance would share it.");
+        }
+
+        return problems;
+    }
+}
+#endif
@@ -0,0 +1,249 @@
+using System;
+using System.Collections.Generic;
+using System.Security.Cryptography;
+using System.Text;
+using UnityEngine;
+using UnityEngine.SceneManagement;
+#if UNITY_EDITOR
+using UnityEditor;
+using UnityEditor.SceneManagement;
+#endif
+
+/* --------------------------------------------------------------------------
+   Keeps every GUIDComponent ID unique across all loaded scenes.
+
+   • GUIDComponents register on Awake and are resolved in batches: when their scene finishes
+     loading, before every save / load, or when the ID is read through TryGet. A batch is
+     sorted by context (scene path + hierarchy path with sibling indices), so which object
+     keeps a duplicated ID never depends on Awake order.
+   • The first owner of an ID keeps it. Duplicates get an ID derived from the duplicated ID and
+     their own context (MD5), so a repaired object gets the same ID every session and its
+     save data still matches. With additive scenes this holds as long as they load in the
+     same order.
+   • Spawned objects should take SpawnedID(spawner, sequence) instead of whatever the prefab
+     carried, which stays the same as long as the spawner spawns in the same order.
+   • In the editor the open scenes are re-validated after every GUIDComponent change, which
+     repairs duplicated GameObjects and clears IDs baked into prefab assets. The build step
+     (GUIDValidationBuildStep) reports what is left.
+   -------------------------------------------------------------------------- */
+public static class GUIDAuthority
+{
+    private static readonly Dictionary<string, GUIDComponent> Owners = new();
+    private static readonly List<GUIDComponent> Pending = new();
+
+    public static int RegisteredCount => Owners.Count;
+    public static int RepairedCount { get; private set; }
+
+    [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.BeforeSceneLoad)]
+    private static void Initialize()
+    {
+        // Statics survive play mode when domain reload is disabled
+        Owners.Clear();
+        Pending.Clear();
+        RepairedCount = 0;
+
+        SceneManager.sceneLoaded -= OnSceneLoaded;
+        SceneManager.sceneLoaded += OnSceneLoaded;
+    }
+
+    private static void OnSceneLoaded(Scene scene, LoadSceneMode mode) => Flush();
+
+    public static void Register(GUIDComponent component)
+    {
+        if (!Pending.Contains(component)) Pending.Add(component);
+    }
+
+    public static void Unregister(GUIDComponent component)
+    {
+        Pending.Remove(component);
+        if (!string.IsNullOrEmpty(component.ID) && Owners.TryGetValue(component.ID, out GUIDComponent owner) && owner == component)
+            Owners.Remove(component.ID);
+    }
+
+    public static bool TryGet(string id, out GUIDComponent component)
+    {
+        Flush();
+        return Owners.TryGetValue(id, out component) && component != null;
+    }
+
+    // Gives a spawned object the ID its spawner's sequence number maps to
+    public static void AssignSpawnedID(GUIDComponent spawned, string spawnerID, int sequence)
+    {
+        Unregister(spawned);
+        spawned.SetID(SpawnedID(spawnerID, sequence));
+        Register(spawned);
+        Flush();
+    }
+
+    // Resolves every registered component that doesn't own its ID yet
+    public static void Flush()
+    {
+        Pending.RemoveAll(c => c == null);
+        if (Pending.Count == 0) return;
+
+        var contexts = new string[Pending.Count];
+        for (int i = 0; i < Pending.Count; i++) contexts[i] = GetContext(Pending[i]);
+
+        var order = new int[Pending.Count];
+        for (int i = 0; i < order.Length; i++) order[i] = i;
+        Array.Sort(order, (a, b) => string.CompareOrdinal(contexts[a], contexts[b]));
+
+        var ids = new string[order.Length];
+        var sortedContexts = new string[order.Length];
+        for (int i = 0; i < order.Length; i++)
+        {
+            ids[i] = Pending[order[i]].ID;
+            sortedContexts[i] = contexts[order[i]];
+        }
+
+        var taken = new HashSet<string>(Owners.Keys);
+        string[] resolved = Resolve(ids, sortedContexts, taken);
+
+        for (int i = 0; i < order.Length; i++)
+        {
+            GUIDComponent component = Pending[order[i]];
+            if (resolved[i] != ids[i])
+            {
+                Debug.LogWarning($"[GUIDAuthority] '{sortedContexts[i]}' duplicated ID {ids[i]}. Using {resolved[i]}.", component);
+                component.SetID(resolved[i]);
+                RepairedCount++;
+            }
+            Owners[resolved[i]] = component;
+        }
+
+        Pending.Clear();
+    }
+
+    // Core rule, shared by runtime, editor and build validation: the first record keeps its ID, later
+    // duplicates (and empty IDs) get one derived from their context. Repaired IDs are added to taken.
+    public static string[] Resolve(IReadOnlyList<string> ids, IReadOnlyList<string> contexts, HashSet<string> taken)
+    {
+        var result = new string[ids.Count];
+
+        for (int i = 0; i < ids.Count; i++)
+        {
+            string id = ids[i];
+            int salt = 0;
+            while (string.IsNullOrEmpty(id) || taken.Contains(id))
+                id = Derive(ids[i], contexts[i], salt++);
+
+            result[i] = id;
+            taken.Add(id);
+        }
+
+        return result;
+    }
+
+    public static string SpawnedID(string spawnerID, int sequence) => Derive(spawnerID, "spawn", sequence);
+
+    public static string Derive(string id, string context, int salt)
+    {
+        using MD5 md5 = MD5.Create();
+        byte[] hash = md5.ComputeHash(Encoding.UTF8.GetBytes($"{id}|{context}|{salt}"));
+        return new Guid(hash).ToString();
+    }
+
+    // Scene path + hierarchy path. Sibling indices go first so an editor duplicate (placed right after
+    // its original) sorts after it, and same-named siblings stay apart.
+    public static string GetContext(Component component)
+    {
+        var builder = new StringBuilder();
+        for (Transform t = component.transform; t != null; t = t.parent)
+            builder.Insert(0, $"/{t.GetSiblingIndex():D4}.{t.name}");
+
+        Scene scene = component.gameObject.scene;
+        builder.Insert(0, string.IsNullOrEmpty(scene.path) ? scene.name : scene.path);
+        return builder.ToString();
+    }
+
+    // Every GUIDComponent in a scene, inactive ones included, sorted by context
+    public static List<(GUIDComponent component, string context)> Collect(Scene scene)
+    {
+        var list = new List<(GUIDComponent, string)>();
+        foreach (GameObject root in scene.GetRootGameObjects())
+            foreach (GUIDComponent component in root.GetComponentsInChildren<GUIDComponent>(true))
+                list.Add((component, GetContext(component)));
+
+        list.Sort((a, b) => string.CompareOrdinal(a.Item2, b.Item2));
+        return list;
+    }
+
+    // Duplicated or empty IDs across the given scenes, in load order, one line per offender
+    public static List<string> FindCollisions(IEnumerable<Scene> scenes)
+    {
+        var problems = new List<string>();
+        var firstOwner = new Dictionary<string, string>();
+
+        foreach (Scene scene in scenes)
+        {
+            foreach ((GUIDComponent component, string context) in Collect(scene))
+            {
+                if (string.IsNullOrEmpty(component.ID))
+                    problems.Add($"'{context}' has no ID.");
+                else if (firstOwner.TryGetValue(component.ID, out string owner))
+                    problems.Add($"'{context}' duplicates ID {component.ID} of '{owner}'.");
+                else
+                    firstOwner.Add(component.ID, context);
+            }
+        }
+
+        return problems;
+    }
+
+#if UNITY_EDITOR
+    private static bool _validationScheduled;
+
+    // Called from GUIDComponent.OnValidate: one validation pass per editor update however many changed
+    public static void ScheduleEditorValidation()
+    {
+        if (_validationScheduled) return;
+        _validationScheduled = true;
+
+        EditorApplication.delayCall += () =>
+        {
+            _validationScheduled = false;
+            if (!EditorApplication.isPlayingOrWillChangePlaymode) RepairOpenScenes();
+        };
+    }
+
+    // Repairs the open scenes in place, as if they were loaded in hierarchy order. Returns how many IDs changed.
+    public static int RepairOpenScenes()
+    {
+        var taken = new HashSet<string>();
+        int repaired = 0;
+
+        for (int s = 0; s < SceneManager.sceneCount; s++)
+        {
+            Scene scene = SceneManager.GetSceneAt(s);
+            if (!scene.isLoaded) continue;
+
+            var records = Collect(scene);
+            var ids = new string[records.Count];
+            var contexts = new string[records.Count];
+            for (int i = 0; i < records.Count; i++)
+            {
+                ids[i] = records[i].component.ID;
+                contexts[i] = records[i].context;
+            }
+
+            string[] resolved = Resolve(ids, contexts, taken);
+            for (int i = 0; i < records.Count; i++)
+            {
+                if (resolved[i] == ids[i]) continue;
+
+                GUIDComponent component = records[i].component;
+                Undo.RecordObject(component, "Repair GUID");
+                component.SetID(resolved[i]);
+                EditorUtility.SetDirty(component);
+                EditorSceneManager.MarkSceneDirty(scene);
+                repaired++;
+
+                if (!string.IsNullOrEmpty(ids[i]))
+                    Debug.LogWarning($"[GUIDAuthority] '{contexts[i]}' duplicated ID {ids[i]}. Repaired to {resolved[i]}.", component);
+            }
+        }
+
+        return repaired;
+    }
+#endif
+}
@@ -1,17 +1,48 @@
 using UnityEngine;
+#if UNITY_EDITOR
+using UnityEditor;
+using UnityEditor.SceneManagement;
+#endif
 
 public class GUIDComponent : MonoBehaviour
 {
     [SerializeField] private string id;
+
     public string ID => id;
 
+    // Only GUIDAuthority changes IDs, so it can keep track of who owns what
+    internal void SetID(string newId) => id = newId;
+
+    private void Awake()
+    {
+        GUIDAuthority.Register(this);
+    }
+
+    private void OnDestroy()
+    {
+        GUIDAuthority.Unregister(this);
+    }
+
 #if UNITY_EDITOR
     private void OnValidate()
     {
-        if (string.IsNullOrEmpty(id))
+        if (Application.isPlaying) return;
+
+        // Prefab assets stay empty, otherwise every instance would inherit the same ID
+        if (PrefabUtility.IsPartOfPrefabAsset(this) || PrefabStageUtility.GetPrefabStage(gameObject) != null)
         {
-            id = System.Guid.NewGuid().ToString();
+            if (!string.IsNullOrEmpty(id))
+            {
+                id = string.Empty;
+                EditorUtility.SetDirty(this);
+            }
+            return;
         }
+
+        if (string.IsNullOrEmpty(id)) id = System.Guid.NewGuid().ToString();
+
+        // Duplicating a GameObject copies the ID, so re-check the open scenes
+        GUIDAuthority.ScheduleEditorValidation();
     }
 #endif
 }
@@ -1,5 +1,6 @@
 public interface ISaveable
 {
+    System.Type SaveDataType { get; } // Type returned by CaptureState, used to match save entries without capturing
     object CaptureState();
     void RestoreState(object state);
 }
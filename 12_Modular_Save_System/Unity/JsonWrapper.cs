@@ -8,6 +8,7 @@ public class SaveEntry
     public string id;
     public string jsonData;   // serialized object
     public string type; // the object's data type
+    public int version; // schema version of that type, 0 in saves written before versioning
 }
 
 [Serializable]
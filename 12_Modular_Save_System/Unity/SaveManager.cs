@@ -1,19 +1,160 @@
 using System.Collections;
 using System.Collections.Generic;
 using System.IO;
-using Unity.VisualScripting;
 using UnityEngine;
 using UnityEngine.SceneManagement;
 
 
 public class SaveManager : MonoBehaviour
 {
-    private const string SaveFile = "Game_Save.json";
+    private const string LegacySaveFile = "Game_Save.json"; // Single save written before slots existed
+    private const string QuickSaveSlot = "Quicksave";
+    private const string AutoSavePrefix = "Autosave_";
     // public GameObject loadingScreen; Optional Loading Screen
 
-    public void SaveGame()
+    [Header("Slots")]
+    [Tooltip("Slot used by SaveGame / LoadGameSave")]
+    [SerializeField] private string currentSlot = "Slot_1";
+    [Tooltip("Autosaves rotate through this many slots, overwriting the oldest")]
+    [SerializeField, Min(1)] private int autosaveCount = 3;
+    [SerializeField] private bool captureThumbnails = true;
+    [SerializeField] private int thumbnailWidth = 256;
+
+    private SaveSlotIndex _index;
+    private double _loadedPlaytime;   // Playtime stored in the last loaded slot
+    private float _sessionStart;      // Time.unscaledTime when that playtime was loaded
+
+    public string CurrentSlot => currentSlot;
+    public double Playtime => _loadedPlaytime + Time.unscaledTime - _sessionStart;
+
+    private SaveSlotIndex Index => _index ??= new SaveSlotIndex(GetSavesFolder());
+
+    /* ----- Slot API ----- */
+
+    public void SaveGame() => SaveToSlot(currentSlot);
+    public void LoadGameSave() => LoadFromSlot(currentSlot);
+    public void DeleteSave() => DeleteSlot(currentSlot);
+
+    public void QuickSave() => SaveToSlot(QuickSaveSlot);
+    public void QuickLoad() => LoadFromSlot(QuickSaveSlot);
+
+    // Fills the first missing autosave slot, then overwrites the oldest one
+    public void AutoSave()
+    {
+        Index.Refresh();
+
+        string target = null;
+        long oldest = long.MaxValue;
+        for (int i = 1; i <= autosaveCount; i++)
+        {
+            string slot = AutoSavePrefix + i;
+            if (!Index.TryGet(slot, out SaveSlotInfo info) || !info.valid)
+            {
+                target = slot;
+                break;
+            }
+            if (info.header.timestampTicks < oldest)
+            {
+                oldest = info.header.timestampTicks;
+                target = slot;
+            }
+        }
+
+        SaveToSlot(target);
+    }
+
+    public void SaveToSlot(string slot)
+    {
+        slot = SanitizeSlot(slot);
+        byte[] body = System.Text.Encoding.UTF8.GetBytes(JsonUtility.ToJson(CaptureWrapper()));
+
+        var header = new SaveSlotHeader
+        {
+            timestampTicks = System.DateTime.UtcNow.Ticks,
+            playtimeSeconds = Playtime,
+            level = SceneManager.GetActiveScene().name,
+            gameVersion = Application.version,
+            displayName = slot
+        };
+
+        SaveSlotFile.Write(GetSlotPath(slot), ref header, body, captureThumbnails ? CaptureThumbnail() : null);
+        Index.Update(slot);
+    }
+
+    public bool LoadFromSlot(string slot)
+    {
+        slot = SanitizeSlot(slot);
+        string path = GetSlotPath(slot);
+        string json;
+
+        if (SaveSlotFile.TryReadBody(path, out SaveSlotHeader header, out byte[] body))
+        {
+            json = System.Text.Encoding.UTF8.GetString(body);
+            _loadedPlaytime = header.playtimeSeconds;
+        }
+        else if (File.Exists(path))
+        {
+            Diag.Error(DiagCategory.Save, this, "[SaveManager] Slot '{0}' is damaged (bad header or checksum). Not loaded.", slot);
+            return false;
+        }
+        else
+        {
+            // Saves from before slots were a single JSON file; it loads into the default slot
+            string legacy = Path.Combine(GetSavesFolder(), LegacySaveFile);
+            if (slot != SanitizeSlot(currentSlot) || !File.Exists(legacy))
+                return false;
+
+            json = File.ReadAllText(legacy);
+            _loadedPlaytime = 0;
+        }
+
+        _sessionStart = Time.unscaledTime;
+        RestoreWrapper(JsonUtility.FromJson<JsonWrapper>(json));
+        return true;
+    }
+
+    public void DeleteSlot(string slot)
+    {
+        slot = SanitizeSlot(slot);
+        string path = GetSlotPath(slot);
+        if (File.Exists(path))
+            File.Delete(path);
+
+        if (slot == SanitizeSlot(currentSlot))
+        {
+            string legacy = Path.Combine(GetSavesFolder(), LegacySaveFile);
+            if (File.Exists(legacy)) File.Delete(legacy);
+        }
+
+        Index.Update(slot);
+    }
+
+    // Every readable slot, newest first. Only headers are read, and only for files changed since the last call.
+    public List<SaveSlotInfo> ListSlots()
+    {
+        Index.Refresh();
+        return Index.List();
+    }
+
+    // Null when the slot has no thumbnail
+    public Texture2D LoadThumbnail(string slot)
+    {
+        byte[] bytes = SaveSlotFile.ReadThumbnail(GetSlotPath(SanitizeSlot(slot)));
+        if (bytes == null) return null;
+
+        var texture = new Texture2D(2, 2);
+        return texture.LoadImage(bytes) ? texture : null;
+    }
+
+    /* ----- Capture / Restore ----- */
+
+    private JsonWrapper CaptureWrapper()
     {
         JsonWrapper wrapper = new JsonWrapper();
+        var written = new HashSet<string>();
+
+        // Late registrations (objects spawned this frame) are resolved before any ID is read
+        GUIDAuthority.Flush();
 
         foreach (var saveable in FindObjectsByType<MonoBehaviour>(FindObjectsSortMode.None))
         {
@@ -25,28 +166,35 @@ public class SaveManager : MonoBehaviour
                     object state = saveableComponent.CaptureState();
                     string json = JsonUtility.ToJson(state);
 
+                    if (!written.Add(guidComponent.ID + state.GetType().FullName))
+                        Diag.Warning(DiagCategory.Save, saveable, "[SaveManager] {0} writes a second {1} under ID {2}. Only the first is restored.", saveable, state.GetType().Name, guidComponent.ID);
+
                     wrapper.entries.Add(new SaveEntry
                     {
                         id = guidComponent.ID,
                         jsonData = json,
-                        type = state.GetType().AssemblyQualifiedName
+                        type = SaveSchemas.GetTypeName(state.GetType()),
+                        version = SaveSchemas.GetVersion(state.GetType())
                     });
                 }
             }
         }
 
-        string wrapperJson = JsonUtility.ToJson(wrapper, true);
-        File.WriteAllText(GetSavesPath(), wrapperJson);
+        return wrapper;
     }
 
-    public void LoadGameSave()
+    private void RestoreWrapper(JsonWrapper wrapper)
     {
-        string path = GetSavesPath();
-        if (!File.Exists(path))
-            return;
+        // Older entries are upgraded to their type's current schema (and current type name) first
+        int upgraded = SaveSchemas.MigrateAll(wrapper);
+        if (upgraded > 0) Diag.Log(DiagCategory.Save, this, "[SaveManager] Migrated {0} entries from an older save format.", upgraded);
 
-        string json = File.ReadAllText(path);
-        JsonWrapper wrapper = JsonUtility.FromJson<JsonWrapper>(json);
+        GUIDAuthority.Flush();
+
+        // Several saveables can share one GUID, so entries are keyed by ID and data type. The first entry wins, as it did with a linear search.
+        var entries = new Dictionary<(string id, string type), SaveEntry>(wrapper.entries.Count);
+        foreach (SaveEntry candidate in wrapper.entries)
+            entries.TryAdd((candidate.id, candidate.type), candidate);
 
         foreach (var saveable in FindObjectsByType<MonoBehaviour>(FindObjectsSortMode.None))
         {
@@ -55,12 +203,11 @@ public class SaveManager : MonoBehaviour
                 var guidComponent = saveable.GetComponent<GUIDComponent>();
                 if (guidComponent != null)
                 {
-                    string id = guidComponent.ID;
-                    SaveEntry entry = wrapper.entries.Find(e => e.id == id);
+                    string dataType = SaveSchemas.GetTypeName(saveableComponent.SaveDataType);
 
-                    if (entry != null)
+                    if (entries.TryGetValue((guidComponent.ID, dataType), out SaveEntry entry))
                     {
-                        System.Type type = System.Type.GetType(entry.type);
+                        System.Type type = SaveSchemas.ResolveType(entry.type);
                         object state = JsonUtility.FromJson(entry.jsonData, type);
                         saveableComponent.RestoreState(state);
                     }
@@ -69,22 +216,60 @@ public class SaveManager : MonoBehaviour
         }
     }
 
+    // Renders the main camera once into a small JPG. Null when there is no camera.
+    private byte[] CaptureThumbnail()
+    {
+        Camera camera = Camera.main;
+        if (camera == null) return null;
+
+        int width = Mathf.Max(16, thumbnailWidth);
+        int height = Mathf.Max(9, Mathf.RoundToInt(width / Mathf.Max(camera.aspect, 0.01f)));
+
+        RenderTexture target = RenderTexture.GetTemporary(width, height, 24);
+        RenderTexture previousTarget = camera.targetTexture;
+        RenderTexture previousActive = RenderTexture.active;
+
+        camera.targetTexture = target;
+        camera.Render();
+        RenderTexture.active = target;
+
+        var texture = new Texture2D(width, height, TextureFormat.RGB24, false);
+        texture.ReadPixels(new Rect(0, 0, width, height), 0, 0);
+        texture.Apply();
 
-    private string GetSavesPath()
+        camera.targetTexture = previousTarget;
+        RenderTexture.active = previousActive;
+        RenderTexture.ReleaseTemporary(target);
+
+        byte[] bytes = texture.EncodeToJPG(75);
+        Destroy(texture);
+        return bytes;
+    }
+
+    /* ----- Paths ----- */
+
+    private string GetSavesFolder()
     {
         string folder = Path.Combine(Application.persistentDataPath, "Saves");
 
         if (!Directory.Exists(folder))
             Directory.CreateDirectory(folder);
 
-        return Path.Combine(folder, SaveFile);
+        return folder;
     }
 
-    public void DeleteSave()
+    private string GetSlotPath(string slot) => Path.Combine(GetSavesFolder(), slot + SaveSlotFile.Extension);
+
+    // Slot names become file names, so anything a file system could reject is replaced
+    private static string SanitizeSlot(string slot)
     {
-        string path = GetSavesPath();
-        if (File.Exists(path))
-            File.Delete(path);
+        if (string.IsNullOrWhiteSpace(slot)) return "Slot_1";
+
+        var chars = slot.Trim().ToCharArray();
+        char[] invalid = Path.GetInvalidFileNameChars();
+        for (int i = 0; i < chars.Length; i++)
+            if (System.Array.IndexOf(invalid, chars[i]) >= 0 || chars[i] == '.') chars[i] = '_';
+        return new string(chars);
     }
 
     public void ReloadScene()
@@ -0,0 +1,189 @@
+using System;
+using System.Collections.Generic;
+using System.Reflection;
+using UnityEngine;
+
+// Current schema version of a save data type, plus the names older saves may know it by
+[AttributeUsage(AttributeTargets.Class | AttributeTargets.Struct, Inherited = false)]
+public class SaveSchemaAttribute : Attribute
+{
+    public int Version { get; }
+    public string[] Aliases { get; }
+
+    public SaveSchemaAttribute(int version, params string[] aliases)
+    {
+        Version = version;
+        Aliases = aliases;
+    }
+}
+
+// Marks a static void Method(SaveNode data) on the data type that upgrades data from FromVersion to FromVersion + 1
+[AttributeUsage(AttributeTargets.Method)]
+public class SaveMigrationAttribute : Attribute
+{
+    public int FromVersion { get; }
+    public SaveMigrationAttribute(int fromVersion) => FromVersion = fromVersion;
+}
+
+/* --------------------------------------------------------------------------
+   Schema versions and migrations for save data types.
+
+   • Every SaveEntry is stamped with its type's [SaveSchema] version (1 when the type has none).
+     Saves written before versioning read as 0 and are treated as version 1.
+   • On load, Migrate parses the entry into a SaveNode tree and runs the type's
+     [SaveMigration] methods in order (v1 -> v2 -> ...), then writes it back with the current
+     version and type name, so the saveable only ever sees its current format.
+   • Types are looked up by full name, whatever assembly wrote them, then by their aliases:
+     renaming a class only needs [SaveSchema(n, "OldName")].
+   • The corpus (SaveCorpus_*.json) holds real saves from every version with the state they
+     must migrate to, checked by SaveCorpusTests.
+   -------------------------------------------------------------------------- */
+public static class SaveSchemas
+{
+    private class Schema
+    {
+        public Type type;
+        public int version = 1;
+        public readonly Dictionary<int, Action<SaveNode>> migrations = new();
+    }
+
+    private static Dictionary<Type, Schema> _byType;
+    private static Dictionary<string, Type> _byName;
+
+    public static int GetVersion(Type type)
+    {
+        EnsureLoaded();
+        return _byType.TryGetValue(type, out Schema schema) ? schema.version : 1;
+    }
+
+    public static string GetTypeName(Type type) => type.AssemblyQualifiedName;
+
+    // Full name first (survives moving the type to another assembly), then aliases, then the runtime lookup
+    public static Type ResolveType(string typeName)
+    {
+        if (string.IsNullOrEmpty(typeName)) return null;
+        EnsureLoaded();
+
+        int comma = typeName.IndexOf(',');
+        string fullName = comma >= 0 ? typeName.Substring(0, comma).Trim() : typeName;
+
+        if (_byName.TryGetValue(fullName, out Type type)) return type;
+        return Type.GetType(typeName);
+    }
+
+    // For renames that can't carry an attribute (types from another package)
+    public static void RegisterAlias(string oldName, Type type)
+    {
+        EnsureLoaded();
+        _byName[oldName] = type;
+    }
+
+    // Brings an entry up to its type's current version. False when the type is unknown, the entry
+    // comes from a newer build, or a migration is missing or throws; the entry is then left untouched.
+    public static bool Migrate(SaveEntry entry)
+    {
+        Type type = ResolveType(entry.type);
+        if (type == null)
+        {
+            Debug.LogWarning($"[SaveSchemas] Unknown save data type '{entry.type}' (id {entry.id}). Entry skipped.");
+            return false;
+        }
+
+        int current = GetVersion(type);
+        int version = Mathf.Max(entry.version, 1);
+
+        if (version > current)
+        {
+            Debug.LogWarning($"[SaveSchemas] {type.Name} v{version} (id {entry.id}) was written by a newer build (v{current}). Entry skipped.");
+            return false;
+        }
+
+        if (version < current)
+        {
+            Schema schema = _byType[type];
+            try
+            {
+                SaveNode data = SaveNode.Parse(entry.jsonData);
+                for (int v = version; v < current; v++)
+                {
+                    if (!schema.migrations.TryGetValue(v, out Action<SaveNode> migration))
+                    {
+                        Debug.LogError($"[SaveSchemas] {type.Name} has no migration from v{v}. Entry {entry.id} skipped.");
+                        return false;
+                    }
+                    migration(data);
+                }
+                entry.jsonData = data.ToString();
+            }
+            catch (Exception e)
+            {
+                Debug.LogError($"[SaveSchemas] Migrating {type.Name} v{version} (id {entry.id}) failed: {e.Message}");
+                return false;
+            }
+        }
+
+        entry.type = GetTypeName(type);
+        entry.version = current;
+        return true;
+    }
+
+    // Migrates every entry, dropping the ones that can't be read. Returns how many were upgraded.
+    public static int MigrateAll(JsonWrapper wrapper)
+    {
+        int upgraded = 0;
+        wrapper.entries.RemoveAll(entry =>
+        {
+            int before = entry.version;
+            string typeBefore = entry.type;
+            if (!Migrate(entry)) return true;
+            if (Mathf.Max(before, 1) != entry.version || typeBefore != entry.type) upgraded++;
+            return false;
+        });
+        return upgraded;
+    }
+
+    private static void EnsureLoaded()
+    {
+        if (_byType != null) return;
+
+        _byType = new Dictionary<Type, Schema>();
+        _byName = new Dictionary<string, Type>();
+
+        foreach (Assembly assembly in AppDomain.CurrentDomain.GetAssemblies())
+        {
+            Type[] types;
+            try { types = assembly.GetTypes(); }
+            catch (ReflectionTypeLoadException e) { types = Array.FindAll(e.Types, t => t != null); }
+
+            foreach (Type type in types)
+            {
+                var attribute = type.GetCustomAttribute<SaveSchemaAttribute>();
+                if (attribute != null) Add(type, attribute);
+            }
+        }
+    }
+
+    private static void Add(Type type, SaveSchemaAttribute attribute)
+    {
+        var schema = new Schema { type = type, version = Mathf.Max(attribute.Version, 1) };
+
+        const BindingFlags flags = BindingFlags.Static | BindingFlags.Public | BindingFlags.NonPublic;
+        foreach (MethodInfo method in type.GetMethods(flags))
+        {
+            var migration = method.GetCustomAttribute<SaveMigrationAttribute>();
+            if (migration == null) continue;
+
+            var parameters = method.GetParameters();
+            if (method.ReturnType != typeof(void) || parameters.Length != 1 || parameters[0].ParameterType != typeof(SaveNode))
+            {
+                Debug.LogError($"[SaveSchemas] {type.Name}.{method.Name} must be 'static void {method.Name}(SaveNode data)'.");
+                continue;
+            }
+            schema.migrations[migration.FromVersion] = (Action<SaveNode>)Delegate.CreateDelegate(typeof(Action<SaveNode>), method);
+        }
+
+        _byType[type] = schema;
+        _byName[type.FullName] = type;
+        foreach (string alias in attribute.Aliases) _byName[alias] = type;
+    }
+}
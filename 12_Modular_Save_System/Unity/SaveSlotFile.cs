@@ -0,0 +1,214 @@
+using System;
+using System.IO;
+using System.Text;
+
+// Everything a load menu shows about a slot, readable from the first SaveSlotHeader.Size bytes of the file
+public struct SaveSlotHeader
+{
+    public const int Size = 256;
+    public const uint Magic = 0x534E564C; // "LVNS"
+    public const ushort CurrentHeaderVersion = 1;
+
+    private const int LevelBytes = 64;
+    private const int GameVersionBytes = 32;
+    private const int DisplayNameBytes = 64;
+
+    public ushort headerVersion;
+    public long timestampTicks;   // UTC
+    public double playtimeSeconds;
+    public int formatVersion;     // Version of the body layout (JsonWrapper), entries carry their own schema versions
+    public uint bodyOffset;
+    public uint bodyLength;
+    public uint thumbnailOffset;  // 0 when the slot has no thumbnail
+    public uint thumbnailLength;
+    public uint checksum;         // CRC32 of body + thumbnail
+    public string level;
+    public string gameVersion;
+    public string displayName;
+
+    public DateTime Timestamp => new DateTime(timestampTicks, DateTimeKind.Utc);
+    public bool HasThumbnail => thumbnailLength > 0;
+
+    public void Write(byte[] buffer)
+    {
+        Array.Clear(buffer, 0, Size);
+        using var writer = new BinaryWriter(new MemoryStream(buffer, 0, Size)); // Always little endian
+
+        writer.Write(Magic);
+        writer.Write(CurrentHeaderVersion);
+        writer.Write((ushort)0);
+        writer.Write(timestampTicks);
+        writer.Write(playtimeSeconds);
+        writer.Write(formatVersion);
+        writer.Write(bodyOffset);
+        writer.Write(bodyLength);
+        writer.Write(thumbnailOffset);
+        writer.Write(thumbnailLength);
+        writer.Write(checksum);
+        WriteFixed(writer, level, LevelBytes);
+        WriteFixed(writer, gameVersion, GameVersionBytes);
+        WriteFixed(writer, displayName, DisplayNameBytes);
+    }
+
+    public static bool TryRead(byte[] buffer, out SaveSlotHeader header)
+    {
+        header = default;
+        using var reader = new BinaryReader(new MemoryStream(buffer, 0, Size));
+
+        if (reader.ReadUInt32() != Magic) return false;
+        header.headerVersion = reader.ReadUInt16();
+        if (header.headerVersion > CurrentHeaderVersion) return false;
+        reader.ReadUInt16();
+
+        header.timestampTicks = reader.ReadInt64();
+        header.playtimeSeconds = reader.ReadDouble();
+        header.formatVersion = reader.ReadInt32();
+        header.bodyOffset = reader.ReadUInt32();
+        header.bodyLength = reader.ReadUInt32();
+        header.thumbnailOffset = reader.ReadUInt32();
+        header.thumbnailLength = reader.ReadUInt32();
+        header.checksum = reader.ReadUInt32();
+        header.level = ReadFixed(reader, LevelBytes);
+        header.gameVersion = ReadFixed(reader, GameVersionBytes);
+        header.displayName = ReadFixed(reader, DisplayNameBytes);
+        return true;
+    }
+
+    // UTF8, zero padded, cut on a character boundary when too long
+    private static void WriteFixed(BinaryWriter writer, string value, int size)
+    {
+        byte[] bytes = new byte[size];
+        if (!string.IsNullOrEmpty(value))
+        {
+            int chars = value.Length;
+            while (Encoding.UTF8.GetByteCount(value.ToCharArray(), 0, chars) > size) chars--;
+            Encoding.UTF8.GetBytes(value, 0, chars, bytes, 0);
+        }
+        writer.Write(bytes);
+    }
+
+    private static string ReadFixed(BinaryReader reader, int size)
+    {
+        byte[] bytes = reader.ReadBytes(size);
+        int length = Array.IndexOf(bytes, (byte)0);
+        return Encoding.UTF8.GetString(bytes, 0, length < 0 ? size : length);
+    }
+}
+
+/* --------------------------------------------------------------------------
+   Slot file I/O: [SaveSlotHeader][body (JsonWrapper JSON, UTF8)][thumbnail (JPG, optional)].
+
+   • TryReadHeader only reads the fixed header, so listing slots never touches a body.
+   • The body and thumbnail are covered by a CRC32 in the header, checked on load.
+   • Writes go to a temporary file that then replaces the slot, so a crash mid-write leaves
+     the previous save intact.
+   -------------------------------------------------------------------------- */
+public static class SaveSlotFile
+{
+    public const string Extension = ".sav";
+    public const int FormatVersion = 1;
+
+    private static readonly uint[] CrcTable = BuildCrcTable();
+
+    public static void Write(string path, ref SaveSlotHeader header, byte[] body, byte[] thumbnail)
+    {
+        int thumbnailLength = thumbnail?.Length ?? 0;
+
+        header.formatVersion = FormatVersion;
+        header.bodyOffset = SaveSlotHeader.Size;
+        header.bodyLength = (uint)body.Length;
+        header.thumbnailOffset = thumbnailLength > 0 ? (uint)(SaveSlotHeader.Size + body.Length) : 0;
+        header.thumbnailLength = (uint)thumbnailLength;
+        header.checksum = Crc32(thumbnail, 0, thumbnailLength, Crc32(body, 0, body.Length));
+
+        byte[] headerBytes = new byte[SaveSlotHeader.Size];
+        header.Write(headerBytes);
+
+        string temp = path + ".tmp";
+        using (var stream = new FileStream(temp, FileMode.Create, FileAccess.Write))
+        {
+            stream.Write(headerBytes, 0, headerBytes.Length);
+            stream.Write(body, 0, body.Length);
+            if (thumbnailLength > 0) stream.Write(thumbnail, 0, thumbnailLength);
+        }
+
+        if (File.Exists(path)) File.Replace(temp, path, null);
+        else File.Move(temp, path);
+    }
+
+    public static bool TryReadHeader(string path, out SaveSlotHeader header)
+    {
+        header = default;
+        byte[] buffer = new byte[SaveSlotHeader.Size];
+
+        try
+        {
+            // Buffer size matches the header, so nothing past it is read ahead
+            using var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read, SaveSlotHeader.Size);
+            if (stream.Read(buffer, 0, buffer.Length) != buffer.Length) return false;
+        }
+        catch (IOException)
+        {
+            return false;
+        }
+
+        return SaveSlotHeader.TryRead(buffer, out header);
+    }
+
+    // Reads and verifies the whole file. False when it is missing, truncated or fails its checksum.
+    public static bool TryReadBody(string path, out SaveSlotHeader header, out byte[] body)
+    {
+        header = default;
+        body = null;
+        if (!File.Exists(path)) return false;
+
+        byte[] file = File.ReadAllBytes(path);
+        if (file.Length < SaveSlotHeader.Size || !SaveSlotHeader.TryRead(file, out header)) return false;
+
+        long end = (long)header.bodyOffset + header.bodyLength;
+        long thumbnailEnd = (long)header.thumbnailOffset + header.thumbnailLength;
+        if (end > file.Length || thumbnailEnd > file.Length) return false;
+
+        uint checksum = Crc32(file, (int)header.bodyOffset, (int)header.bodyLength);
+        checksum = Crc32(file, (int)header.thumbnailOffset, (int)header.thumbnailLength, checksum);
+        if (checksum != header.checksum) return false;
+
+        body = new byte[header.bodyLength];
+        Buffer.BlockCopy(file, (int)header.bodyOffset, body, 0, body.Length);
+        return true;
+    }
+
+    public static byte[] ReadThumbnail(string path)
+    {
+        if (!TryReadHeader(path, out SaveSlotHeader header) || !header.HasThumbnail) return null;
+
+        using var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read);
+        if (stream.Length < header.thumbnailOffset + header.thumbnailLength) return null;
+
+        byte[] bytes = new byte[header.thumbnailLength];
+        stream.Seek(header.thumbnailOffset, SeekOrigin.Begin);
+        return stream.Read(bytes, 0, bytes.Length) == bytes.Length ? bytes : null;
+    }
+
+    // Standard CRC32 (IEEE). Pass the previous result as crc to continue over several buffers.
+    public static uint Crc32(byte[] data, int offset, int count, uint crc = 0)
+    {
+        crc = ~crc;
+        for (int i = 0; i < count; i++)
+            crc = CrcTable[(crc ^ data[offset + i]) & 0xFF] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    private static uint[] BuildCrcTable()
+    {
+        var table = new uint[256];
+        for (uint i = 0; i < 256; i++)
+        {
+            uint c = i;
+            for (int k = 0; k < 8; k++)
+                c = (c & 1) != 0 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[i] = c;
+        }
+        return table;
+    }
+}
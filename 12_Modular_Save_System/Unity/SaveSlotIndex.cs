@@ -0,0 +1,99 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+
+public class SaveSlotInfo
+{
+    public string slot;         // File name without extension
+    public string path;
+    public SaveSlotHeader header;
+    public bool valid;          // False when the header couldn't be read (foreign or truncated file)
+    public DateTime lastWriteUtc;
+    public long length;
+}
+
+/* --------------------------------------------------------------------------
+   In-memory index of the slot files in one folder, for load / save menus.
+
+   • Refresh stats the folder and only re-reads the header of files whose modification
+     time or size changed since the last refresh. Unchanged slots cost one directory entry.
+   • Bodies are never read here: a slot's header holds everything a menu shows.
+   • Update is called after the SaveManager writes a slot itself, so the next refresh
+     doesn't read it again.
+   -------------------------------------------------------------------------- */
+public class SaveSlotIndex
+{
+    public string Folder { get; }
+    public int HeaderReads { get; private set; } // Total headers read, for benchmarks
+
+    private readonly Dictionary<string, SaveSlotInfo> _slots = new(StringComparer.OrdinalIgnoreCase);
+    private readonly HashSet<string> _seen = new(StringComparer.OrdinalIgnoreCase);
+    private readonly List<string> _removed = new();
+
+    public SaveSlotIndex(string folder)
+    {
+        Folder = folder;
+    }
+
+    public void Refresh()
+    {
+        _seen.Clear();
+
+        if (Directory.Exists(Folder))
+        {
+            foreach (FileInfo file in new DirectoryInfo(Folder).EnumerateFiles("*" + SaveSlotFile.Extension))
+            {
+                string slot = Path.GetFileNameWithoutExtension(file.Name);
+                _seen.Add(slot);
+
+                if (_slots.TryGetValue(slot, out SaveSlotInfo info) && info.lastWriteUtc == file.LastWriteTimeUtc && info.length == file.Length)
+                    continue;
+
+                Read(slot, file);
+            }
+        }
+
+        _removed.Clear();
+        foreach (string slot in _slots.Keys)
+            if (!_seen.Contains(slot)) _removed.Add(slot);
+        foreach (string slot in _removed)
+            _slots.Remove(slot);
+    }
+
+    // Re-reads one slot right away (after writing or deleting it)
+    public void Update(string slot)
+    {
+        var file = new FileInfo(Path.Combine(Folder, slot + SaveSlotFile.Extension));
+        if (file.Exists) Read(slot, file);
+        else _slots.Remove(slot);
+    }
+
+    public bool TryGet(string slot, out SaveSlotInfo info) => _slots.TryGetValue(slot, out info);
+
+    // Readable slots, newest first
+    public List<SaveSlotInfo> List()
+    {
+        var list = new List<SaveSlotInfo>(_slots.Count);
+        foreach (SaveSlotInfo info in _slots.Values)
+            if (info.valid) list.Add(info);
+
+        list.Sort((a, b) => b.header.timestampTicks.CompareTo(a.header.timestampTicks));
+        return list;
+    }
+
+    private void Read(string slot, FileInfo file)
+    {
+        HeaderReads++;
+        bool valid = SaveSlotFile.TryReadHeader(file.FullName, out SaveSlotHeader header);
+
+        _slots[slot] = new SaveSlotInfo
+        {
+            slot = slot,
+            path = file.FullName,
+            header = header,
+            valid = valid,
+            lastWriteUtc = file.LastWriteTimeUtc,
+            length = file.Length
+        };
+    }
+}
@@ -7,6 +7,8 @@ public class SaveableTransform : MonoBehaviour, ISaveable
     [SerializeField] private bool saveRotation = true;
     [SerializeField] private bool saveScale = true;
     
+    public System.Type SaveDataType => typeof(TransformSaveData);
+
     public object CaptureState()
     {
         TransformSaveData data = new TransformSaveData();
@@ -15,6 +17,10 @@ public class SaveableTransform : MonoBehaviour, ISaveable
         if (saveRotation) data.rotation = transform.rotation;
         if (saveScale) data.scale = transform.localScale;
 
+        data.hasPosition = savePosition;
+        data.hasRotation = saveRotation;
+        data.hasScale = saveScale;
+
         return data;
     }
 
@@ -35,9 +41,7 @@ public class SaveableTransform : MonoBehaviour, ISaveable
         {
             rb.isKinematic = true;
 
-            if (savePosition) transform.position = data.position;
-            if (saveRotation) transform.rotation = data.rotation;
-            if (saveScale) transform.localScale = data.scale;
+            Apply(data);
 
             yield return null;
 
@@ -45,10 +49,16 @@ public class SaveableTransform : MonoBehaviour, ISaveable
         }
         else
         {
-            if (savePosition) transform.position = data.position;
-            if (saveRotation) transform.rotation = data.rotation;
-            if (saveScale) transform.localScale = data.scale;
+            Apply(data);
         }
     }
 
+    // Only what is both enabled here and present in the save
+    private void Apply(TransformSaveData data)
+    {
+        if (savePosition && data.hasPosition) transform.position = data.position;
+        if (saveRotation && data.hasRotation) transform.rotation = data.rotation;
+        if (saveScale && data.hasScale) transform.localScale = data.scale;
+    }
+
 }
@@ -1,9 +1,33 @@
 using UnityEngine;
 
 [System.Serializable]
+[SaveSchema(2)]
 public struct TransformSaveData
 {
     public Vector3 position;
     public Quaternion rotation;
     public Vector3 scale;
+
+    // v2: which parts were captured, so a part the saver skipped is never restored as zero
+    public bool hasPosition;
+    public bool hasRotation;
+    public bool hasScale;
+
+    // v1 had no flags and wrote zeros for skipped parts. A zero scale or a zero quaternion can
+    // only mean "not captured"; a zero position is a real position, so it counts as captured.
+    [SaveMigration(1)]
+    private static void AddCaptureFlags(SaveNode data)
+    {
+        data["hasPosition"] = SaveNode.From(true);
+        data["hasRotation"] = SaveNode.From(!IsZero(data["rotation"], "x", "y", "z", "w"));
+        data["hasScale"] = SaveNode.From(!IsZero(data["scale"], "x", "y", "z"));
+    }
+
+    private static bool IsZero(SaveNode vector, params string[] components)
+    {
+        if (vector == null || !vector.IsObject) return true;
+        foreach (string component in components)
+            if (vector[component] != null && vector[component].AsDouble != 0) return false;
+        return true;
+    }
 }
@@ -0,0 +1,174 @@
+using System.Collections.Generic;
+using NUnit.Framework;
+using UnityEditor;
+using UnityEditor.SceneManagement;
+using UnityEngine;
+using UnityEngine.SceneManagement;
+
+// Real GameObjects in fresh scenes: a duplicated object, a prefab instantiated many times and an additive scene reusing
+// the first scene's IDs. Originals must keep their IDs and copies must be repaired to the same ID on every pass.
+public class GUIDAuthorityTests
+{
+    private const string Folder = "Assets/GUIDAuthorityTests";
+
+    private Scene scene;
+    private readonly List<GUIDComponent> spawned = new List<GUIDComponent>();
+
+    [SetUp]
+    public void SetUp()
+    {
+        scene = EditorSceneManager.NewScene(NewSceneSetup.EmptyScene, NewSceneMode.Single);
+        AssetDatabase.CreateFolder("Assets", "GUIDAuthorityTests");
+    }
+
+    [TearDown]
+    public void TearDown()
+    {
+        // Edit mode objects never get OnDestroy, so spawned IDs are released by hand
+        foreach (GUIDComponent component in spawned)
+            if (component != null) GUIDAuthority.Unregister(component);
+        spawned.Clear();
+
+        AssetDatabase.DeleteAsset(Folder);
+    }
+
+    private static GUIDComponent Create(string name)
+    {
+        return new GameObject(name).AddComponent<GUIDComponent>();
+    }
+
+    [Test]
+    public void DuplicatedObject_CopyIsRepairedTheSameWayEveryTime()
+    {
+        GUIDComponent crate = Create("Crate");
+        GUIDComponent door = Create("Door");
+        GUIDAuthority.RepairOpenScenes(); // Gives both their first ID
+        string crateId = crate.ID;
+        string doorId = door.ID;
+
+        GUIDComponent copy = Object.Instantiate(crate);
+        Assert.AreEqual(crateId, copy.ID, "Instantiate copies the serialized ID");
+
+        Assert.AreEqual(1, GUIDAuthority.RepairOpenScenes());
+        Assert.AreEqual(crateId, crate.ID);
+        Assert.AreEqual(doorId, door.ID);
+        Assert.AreEqual(GUIDAuthority.Derive(crateId, GUIDAuthority.GetContext(copy), 0), copy.ID);
+        string repaired = copy.ID;
+
+        Assert.AreEqual(0, GUIDAuthority.RepairOpenScenes(), "A repaired scene stays as it is");
+
+        // The same duplicate made again lands on the same hierarchy path, so it gets the same ID
+        Object.DestroyImmediate(copy.gameObject);
+        copy = Object.Instantiate(crate);
+        GUIDAuthority.RepairOpenScenes();
+        Assert.AreEqual(repaired, copy.ID);
+    }
+
+    [Test]
+    public void PrefabInstances_GetUniqueStableIDs()
+    {
+        GameObject source = Create("Barrel").gameObject;
+        GameObject prefab = PrefabUtility.SaveAsPrefabAsset(source, $"{Folder}/Barrel.prefab");
+        Object.DestroyImmediate(source);
+
+        var instances = new GUIDComponent[20];
+        for (int i = 0; i < instances.Length; i++)
+            instances[i] = ((GameObject)PrefabUtility.InstantiatePrefab(prefab, scene)).GetComponent<GUIDComponent>();
+
+        GUIDAuthority.RepairOpenScenes();
+        var ids = new HashSet<string>();
+        foreach (GUIDComponent instance in instances)
+        {
+            Assert.IsFalse(string.IsNullOrEmpty(instance.ID));
+            ids.Add(instance.ID);
+        }
+        Assert.AreEqual(instances.Length, ids.Count, "Prefab instances still collide");
+
+        // Instantiating the prefab again in the same order gives the same IDs
+        var first = new string[instances.Length];
+        for (int i = 0; i < instances.Length; i++)
+        {
+            first[i] = instances[i].ID;
+            Object.DestroyImmediate(instances[i].gameObject);
+        }
+        for (int i = 0; i < instances.Length; i++)
+            instances[i] = ((GameObject)PrefabUtility.InstantiatePrefab(prefab, scene)).GetComponent<GUIDComponent>();
+        GUIDAuthority.RepairOpenScenes();
+        for (int i = 0; i < instances.Length; i++)
+            Assert.AreEqual(first[i], instances[i].ID);
+    }
+
+    [Test]
+    public void SpawnedPrefabInstances_TakeTheirSpawnerSequenceID()
+    {
+        GameObject source = Create("Barrel").gameObject;
+        GameObject prefab = PrefabUtility.SaveAsPrefabAsset(source, $"{Folder}/Barrel.prefab");
+        Object.DestroyImmediate(source);
+
+        var ids = new HashSet<string>();
+        for (int i = 0; i < 20; i++)
+        {
+            foreach (string spawner in new[] { "spawner-a", "spawner-b" })
+            {
+                var instance = ((GameObject)PrefabUtility.InstantiatePrefab(prefab, scene)).GetComponent<GUIDComponent>();
+                GUIDAuthority.AssignSpawnedID(instance, spawner, i);
+                spawned.Add(instance);
+
+                Assert.AreEqual(GUIDAuthority.SpawnedID(spawner, i), instance.ID);
+                Assert.IsTrue(GUIDAuthority.TryGet(instance.ID, out GUIDComponent owner) && owner == instance);
+                ids.Add(instance.ID);
+            }
+        }
+
+        Assert.AreEqual(40, ids.Count, "Spawned IDs collide across sequences or spawners");
+    }
+
+    [Test]
+    public void AdditiveScene_ReusingIDs_IsRepairedAndLeavesTheFirstSceneAlone()
+    {
+        GUIDComponent lever = Create("Lever");
+        GUIDComponent gate = Create("Gate");
+        GUIDAuthority.RepairOpenScenes();
+        string leverId = lever.ID;
+        string gateId = gate.ID;
+
+        Scene additive = EditorSceneManager.NewScene(NewSceneSetup.EmptyScene, NewSceneMode.Additive);
+
+        // The additive scene was built from a copy of the first one, so its lever carries the same ID
+        string repaired = null;
+        for (int run = 0; run < 2; run++)
+        {
+            GUIDComponent copy = Object.Instantiate(lever);
+            copy.name = "Lever";
+            SceneManager.MoveGameObjectToScene(copy.gameObject, additive);
+            GUIDComponent chest = Create("Chest");
+            SceneManager.MoveGameObjectToScene(chest.gameObject, additive);
+
+            GUIDAuthority.RepairOpenScenes();
+            Assert.AreEqual(leverId, lever.ID, "The first scene changed");
+            Assert.AreEqual(gateId, gate.ID, "The first scene changed");
+            Assert.AreNotEqual(leverId, copy.ID);
+            Assert.IsFalse(string.IsNullOrEmpty(chest.ID));
+            Assert.IsEmpty(GUIDAuthority.FindCollisions(new[] { scene, additive }));
+
+            if (run == 0) repaired = copy.ID;
+            else Assert.AreEqual(repaired, copy.ID, "Additive repair is not deterministic");
+
+            Object.DestroyImmediate(copy.gameObject);
+            Object.DestroyImmediate(chest.gameObject);
+        }
+
+        EditorSceneManager.CloseScene(additive, true);
+    }
+
+    [Test]
+    public void Resolve_SkipsADerivedIDThatIsAlreadyTaken()
+    {
+        string id = System.Guid.NewGuid().ToString();
+        const string context = "Level.unity/0000.Crate";
+        var taken = new HashSet<string> { id, GUIDAuthority.Derive(id, context, 0) };
+
+        string[] resolved = GUIDAuthority.Resolve(new[] { id }, new[] { context }, taken);
+        Assert.AreEqual(GUIDAuthority.Derive(id, context, 1), resolved[0]);
+    }
+}
@@ -0,0 +1,103 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Runtime.CompilerServices;
+using NUnit.Framework;
+using UnityEngine;
+
+// Migration regression corpus: every checked-in SaveCorpus/SaveCorpus_*.json is a save exactly as the SaveManager wrote it
+// at some historical version, plus an "expected" list of { id, type, version, data } describing each entry after migration
+// ("type" is a full name, "data" only lists the fields worth checking). Each file is its own test case.
+public class SaveCorpusTests
+{
+    private const double Tolerance = 1e-4;
+
+    [OneTimeSetUp]
+    public void RegisterAliases()
+    {
+        // Stands in for a renamed class: the v1 corpus has an entry saved under this old name
+        SaveSchemas.RegisterAlias("SaveCorpus.RenamedTransformData", typeof(TransformSaveData));
+    }
+
+    private static string CorpusFolder([CallerFilePath] string testFile = "") =>
+        Path.GetFullPath(Path.Combine(Path.GetDirectoryName(testFile), "..", "..", "SaveCorpus"));
+
+    private static IEnumerable<string> CorpusFiles()
+    {
+        foreach (string path in Directory.GetFiles(CorpusFolder(), "SaveCorpus_*.json"))
+            yield return Path.GetFileName(path);
+    }
+
+    [Test]
+    public void Corpus_IsNotEmpty()
+    {
+        CollectionAssert.IsNotEmpty(CorpusFiles(), $"No SaveCorpus_*.json files in {CorpusFolder()}");
+    }
+
+    [TestCaseSource(nameof(CorpusFiles))]
+    public void Corpus_MigratesToExpectedState(string file)
+    {
+        string json = File.ReadAllText(Path.Combine(CorpusFolder(), file));
+        JsonWrapper wrapper = JsonUtility.FromJson<JsonWrapper>(json);
+        SaveNode expected = SaveNode.Parse(json)["expected"];
+        Assert.IsNotNull(wrapper?.entries, $"{file} has no 'entries'");
+        Assert.IsTrue(expected != null && expected.IsArray, $"{file} has no 'expected' list");
+
+        SaveSchemas.MigrateAll(wrapper);
+
+        for (int i = 0; i < expected.Count; i++)
+        {
+            SaveNode want = expected[i];
+            string id = want["id"]?.AsString;
+            string typeName = want["type"]?.AsString;
+            SaveEntry entry = wrapper.entries.Find(e => e.id == id && SaveSchemas.ResolveType(e.type)?.FullName == typeName);
+            Assert.IsNotNull(entry, $"{file}: no migrated {typeName} for id {id}");
+
+            if (want.Has("version"))
+                Assert.AreEqual(want["version"].AsInt, entry.version, $"{file}: {typeName} {id} version");
+
+            // The migrated JSON must also still load into the current type
+            Type type = SaveSchemas.ResolveType(entry.type);
+            SaveNode roundTrip = SaveNode.Parse(JsonUtility.ToJson(JsonUtility.FromJson(entry.jsonData, type)));
+            if (want.Has("data"))
+                Assert.IsTrue(Contains(roundTrip, want["data"], "", out string mismatch), $"{file}: {typeName} {id} {mismatch}");
+        }
+    }
+
+    // True when every field in expected exists in actual with the same value (objects recursively,
+    // arrays element by element, numbers within tolerance)
+    private static bool Contains(SaveNode actual, SaveNode expected, string path, out string mismatch)
+    {
+        mismatch = null;
+
+        if (expected.IsObject)
+        {
+            if (!actual.IsObject) { mismatch = $"{path}: expected an object"; return false; }
+            foreach (string key in expected.Keys)
+            {
+                SaveNode field = actual[key];
+                if (field == null) { mismatch = $"{path}.{key}: missing"; return false; }
+                if (!Contains(field, expected[key], $"{path}.{key}", out mismatch)) return false;
+            }
+            return true;
+        }
+
+        if (expected.IsArray)
+        {
+            if (!actual.IsArray || actual.Count != expected.Count) { mismatch = $"{path}: expected {expected.Count} items"; return false; }
+            for (int i = 0; i < expected.Count; i++)
+                if (!Contains(actual[i], expected[i], $"{path}[{i}]", out mismatch)) return false;
+            return true;
+        }
+
+        bool equal = actual.Kind == expected.Kind && expected.Kind switch
+        {
+            SaveNodeKind.Number => Math.Abs(actual.AsDouble - expected.AsDouble) <= Tolerance,
+            SaveNodeKind.Bool => actual.AsBool == expected.AsBool,
+            SaveNodeKind.String => actual.AsString == expected.AsString,
+            _ => true
+        };
+        if (!equal) mismatch = $"{path}: expected {expected}, got {actual}";
+        return equal;
+    }
+}
@@ -0,0 +1,59 @@
+using System.Collections;
+using NUnit.Framework;
+using Unity.PerformanceTesting;
+using UnityEditor;
+using UnityEngine;
+using UnityEngine.TestTools;
+
+// Times a full save and load of 10k saveable transforms with spawned IDs in Play mode, through a scratch slot that is
+// deleted afterwards. Thumbnails are off so the times are the save system's own. Compared with PerfBaselines/Save.json.
+public class SavePerformanceTests
+{
+    private const string Slot = "PerfTest";
+    private const int EntityCount = 10000;
+
+    private SaveManager manager;
+
+    [UnityTearDown]
+    public IEnumerator TearDown()
+    {
+        if (manager != null)
+            manager.DeleteSlot(Slot);
+        if (Application.isPlaying)
+            yield return new ExitPlayMode();
+    }
+
+    [UnityTest, Performance]
+    public IEnumerator SaveAndLoad_10kEntities()
+    {
+        yield return new EnterPlayMode();
+
+        manager = new GameObject("SaveManager").AddComponent<SaveManager>();
+        var settings = new SerializedObject(manager);
+        settings.FindProperty("captureThumbnails").boolValue = false;
+        settings.ApplyModifiedPropertiesWithoutUndo();
+
+        for (int i = 0; i < EntityCount; i++)
+        {
+            var entity = new GameObject($"Entity_{i}");
+            entity.transform.position = new Vector3(i % 100, 0f, i / 100);
+            GUIDAuthority.AssignSpawnedID(entity.AddComponent<GUIDComponent>(), Slot, i);
+            entity.AddComponent<SaveableTransform>();
+        }
+        yield return null;
+
+        Measure.Method(() => manager.SaveToSlot(Slot))
+            .WarmupCount(1)
+            .MeasurementCount(5)
+            .SampleGroup($"SaveToSlot_{EntityCount}")
+            .Run();
+
+        Measure.Method(() => manager.LoadFromSlot(Slot))
+            .WarmupCount(1)
+            .MeasurementCount(5)
+            .SampleGroup($"LoadFromSlot_{EntityCount}")
+            .Run();
+
+        PerfBaseline.AssertWithin("Save");
+    }
+}
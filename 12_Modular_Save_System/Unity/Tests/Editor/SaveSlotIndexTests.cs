@@ -0,0 +1,107 @@
+using System;
+using System.Diagnostics;
+using System.IO;
+using NUnit.Framework;
+using UnityEngine;
+
+// Writes 200 slots with 64 KB bodies into a scratch folder: a cold listing reads every header within the budget,
+// a warm one reads none, and only changed or removed files are picked up again.
+public class SaveSlotIndexTests
+{
+    private const int SlotCount = 200;
+    private const double BudgetMs = 10.0;
+
+    private string folder;
+
+    [SetUp]
+    public void SetUp()
+    {
+        folder = Path.Combine(Application.temporaryCachePath, "SaveSlotIndexTests");
+        if (Directory.Exists(folder)) Directory.Delete(folder, true);
+        Directory.CreateDirectory(folder);
+
+        for (int i = 0; i < SlotCount; i++)
+            WriteSlot(i);
+    }
+
+    [TearDown]
+    public void TearDown()
+    {
+        Directory.Delete(folder, true);
+    }
+
+    private string SlotPath(int index) => Path.Combine(folder, $"Slot_{index:D3}{SaveSlotFile.Extension}");
+
+    private void WriteSlot(int index, int bodySize = 64 * 1024)
+    {
+        // Realistic body size, so a listing that touched bodies would show up in the timings
+        var header = new SaveSlotHeader
+        {
+            timestampTicks = DateTime.UtcNow.Ticks - index * TimeSpan.TicksPerMinute,
+            playtimeSeconds = index * 60,
+            level = "TestLevel",
+            gameVersion = Application.version,
+            displayName = "Slot " + index
+        };
+        SaveSlotFile.Write(SlotPath(index), ref header, new byte[bodySize], null);
+    }
+
+    [Test]
+    public void ColdListing_ReadsEveryHeaderWithinBudget()
+    {
+        var index = new SaveSlotIndex(folder);
+
+        var stopwatch = Stopwatch.StartNew();
+        index.Refresh();
+        var listed = index.List();
+        double coldMs = stopwatch.Elapsed.TotalMilliseconds;
+        TestContext.WriteLine($"Cold listing of {SlotCount} slots: {coldMs:F2} ms");
+
+        Assert.AreEqual(SlotCount, listed.Count);
+        Assert.AreEqual(SlotCount, index.HeaderReads);
+        Assert.LessOrEqual(coldMs, BudgetMs, "Cold listing is over budget");
+        Assert.AreEqual("Slot_000", listed[0].slot, "Newest first");
+        Assert.AreEqual($"Slot_{SlotCount - 1:D3}", listed[listed.Count - 1].slot);
+    }
+
+    [Test]
+    public void WarmListing_ReadsNoHeaders()
+    {
+        var index = new SaveSlotIndex(folder);
+        index.Refresh();
+        int coldReads = index.HeaderReads;
+
+        index.Refresh();
+        index.List();
+        Assert.AreEqual(0, index.HeaderReads - coldReads);
+    }
+
+    [Test]
+    public void ChangedAndDeletedSlots_AreTheOnlyOnesReadAgain()
+    {
+        var index = new SaveSlotIndex(folder);
+        index.Refresh();
+
+        // A different body size changes the file even within the file system's time resolution
+        WriteSlot(10, 1024);
+        File.Delete(SlotPath(20));
+        index.Refresh();
+
+        Assert.AreEqual(SlotCount + 1, index.HeaderReads);
+        Assert.AreEqual(SlotCount - 1, index.List().Count);
+        Assert.IsFalse(index.TryGet("Slot_020", out _));
+    }
+
+    [Test]
+    public void ForeignFile_IsIndexedButNotListed()
+    {
+        File.WriteAllText(SlotPath(SlotCount), "not a save");
+
+        var index = new SaveSlotIndex(folder);
+        index.Refresh();
+
+        Assert.IsTrue(index.TryGet($"Slot_{SlotCount:D3}", out SaveSlotInfo info));
+        Assert.IsFalse(info.valid);
+        Assert.AreEqual(SlotCount, index.List().Count);
+    }
+}
@@ -0,0 +1,170 @@
+#include "GUIDAuthoritySubsystem.h"
+#include "GUIDComponent.h"
+#include "Engine/World.h"
+#include "Misc/SecureHash.h"
+
+void UGUIDAuthoritySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UGUIDAuthoritySubsystem::OnLevelAddedToWorld);
+}
+
+void UGUIDAuthoritySubsystem::Deinitialize()
+{
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    Owners.Empty();
+    Pending.Empty();
+    Super::Deinitialize();
+}
+
+void UGUIDAuthoritySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+    Flush();
+}
+
+void UGUIDAuthoritySubsystem::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+    if (World == GetWorld()) Flush();
+}
+
+void UGUIDAuthoritySubsystem::Register(UGUIDComponent* Component)
+{
+    if (!Component) return;
+
+    // Registering again (re-registration after an edit) must not collide with itself
+    Unregister(Component);
+    Pending.AddUnique(Component);
+
+    // Editor worlds get actors one user action at a time, so repair right away
+    if (!GetWorld()->IsGameWorld()) Flush();
+}
+
+void UGUIDAuthoritySubsystem::Unregister(UGUIDComponent* Component)
+{
+    if (!Component) return;
+
+    Pending.Remove(Component);
+
+    const TWeakObjectPtr<UGUIDComponent>* Owner = Owners.Find(Component->GUID);
+    if (Owner && Owner->Get() == Component)
+    {
+        Owners.Remove(Component->GUID);
+    }
+}
+
+void UGUIDAuthoritySubsystem::Flush()
+{
+    Pending.RemoveAll([](const TWeakObjectPtr<UGUIDComponent>& Component) { return !Component.IsValid(); });
+    if (Pending.Num() == 0) return;
+
+    struct FEntry
+    {
+        UGUIDComponent* Component;
+        FString Context;
+    };
+
+    TArray<FEntry> Entries;
+    Entries.Reserve(Pending.Num());
+    for (const TWeakObjectPtr<UGUIDComponent>& Component : Pending)
+    {
+        Entries.Add({ Component.Get(), GetContext(Component.Get()) });
+    }
+
+    Entries.Sort([](const FEntry& A, const FEntry& B) { return A.Context.Compare(B.Context, ESearchCase::CaseSensitive) < 0; });
+
+    TArray<FGuid> GUIDs;
+    TArray<FString> Contexts;
+    for (const FEntry& Entry : Entries)
+    {
+        GUIDs.Add(Entry.Component->GUID);
+        Contexts.Add(Entry.Context);
+    }
+
+    TSet<FGuid> Taken;
+    for (auto It = Owners.CreateIterator(); It; ++It)
+    {
+        if (It->Value.IsValid()) Taken.Add(It->Key);
+        else It.RemoveCurrent();
+    }
+
+    const TArray<FGuid> Resolved = Resolve(GUIDs, Contexts, Taken);
+    const bool bEditorWorld = !GetWorld()->IsGameWorld();
+
+    for (int32 i = 0; i < Entries.Num(); i++)
+    {
+        UGUIDComponent* Component = Entries[i].Component;
+
+        if (Resolved[i] != GUIDs[i])
+        {
+            if (GUIDs[i].IsValid())
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[GUIDAuthority] '%s' duplicated GUID %s. Using %s."),
+                    *Entries[i].Context, *GUIDs[i].ToString(), *Resolved[i].ToString());
+            }
+
+            // In the editor the repair is an undoable change that is saved with the level
+            if (bEditorWorld) Component->Modify();
+            Component->GUID = Resolved[i];
+            RepairedCount++;
+        }
+
+        Owners.Add(Resolved[i], Component);
+    }
+
+    Pending.Reset();
+}
+
+UGUIDComponent* UGUIDAuthoritySubsystem::FindByGUID(const FGuid& GUID)
+{
+    Flush();
+    const TWeakObjectPtr<UGUIDComponent>* Owner = Owners.Find(GUID);
+    return Owner ? Owner->Get() : nullptr;
+}
+
+FGuid UGUIDAuthoritySubsystem::SpawnedGUID(const FGuid& SpawnerGUID, int32 Sequence)
+{
+    return Derive(SpawnerGUID, TEXT("spawn"), Sequence);
+}
+
+FGuid UGUIDAuthoritySubsystem::Derive(const FGuid& GUID, const FString& Context, int32 Salt)
+{
+    const FString Key = FString::Printf(TEXT("%s|%s|%d"), *GUID.ToString(EGuidFormats::DigitsWithHyphens), *Context, Salt);
+    const FTCHARToUTF8 Utf8(*Key);
+
+    uint8 Digest[16];
+    FMD5 Md5;
+    Md5.Update(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    Md5.Final(Digest);
+
+    FGuid Result;
+    FMemory::Memcpy(&Result, Digest, sizeof(Result));
+    return Result;
+}
+
+TArray<FGuid> UGUIDAuthoritySubsystem::Resolve(const TArray<FGuid>& GUIDs, const TArray<FString>& Contexts, TSet<FGuid>& Taken)
+{
+    TArray<FGuid> Result;
+    Result.Reserve(GUIDs.Num());
+
+    for (int32 i = 0; i < GUIDs.Num(); i++)
+    {
+        FGuid GUID = GUIDs[i];
+        int32 Salt = 0;
+        while (!GUID.IsValid() || Taken.Contains(GUID))
+        {
+            GUID = Derive(GUIDs[i], Contexts[i], Salt++);
+        }
+
+        Result.Add(GUID);
+        Taken.Add(GUID);
+    }
+
+    return Result;
+}
+
+FString UGUIDAuthoritySubsystem::GetContext(const UActorComponent* Component)
+{
+    // Actor names are unique within a level, so the path is unique and the same in PIE and packaged games
+    return UWorld::RemovePIEPrefix(Component->GetPathName());
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GUIDAuthoritySubsystem.generated.h"
+
+class UGUIDComponent;
+
+/* --------------------------------------------------------------------------
+   Keeps every UGUIDComponent GUID unique across the levels loaded in a world.
+
+   • Components register in OnRegister and are resolved in batches: when a level is added to
+     the world, on BeginPlay, before every save / load, or right away in editor worlds. A batch
+     is sorted by context (the component path without the PIE prefix), so which actor keeps a
+     duplicated GUID never depends on registration order.
+   • The first owner of a GUID keeps it. Duplicates (Alt-drag copies, Blueprint templates
+     carrying a GUID, a streamed level reusing another's) get a GUID derived from the
+     duplicated one and their context (MD5), so the repair is the same every session and
+     their save data still matches. In the editor the repair is saved with the level.
+   • Spawned actors should call UGUIDComponent::AssignSpawnedGUID(Spawner, Sequence).
+   • Build-time check: UValidateSaveGUIDsCommandlet (-run=ValidateSaveGUIDs).
+   Access via: GetWorld()->GetSubsystem<UGUIDAuthoritySubsystem>()
+   -------------------------------------------------------------------------- */
+UCLASS()
+class MECHANICS_TEST_LVN_API UGUIDAuthoritySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+    void Register(UGUIDComponent* Component);
+    void Unregister(UGUIDComponent* Component);
+
+    // Resolves every registered component that doesn't own its GUID yet
+    UFUNCTION(BlueprintCallable, Category = "Save")
+    void Flush();
+
+    UFUNCTION(BlueprintCallable, Category = "Save")
+    UGUIDComponent* FindByGUID(const FGuid& GUID);
+
+    UFUNCTION(BlueprintPure, Category = "Save")
+    int32 GetRepairedCount() const { return RepairedCount; }
+
+    UFUNCTION(BlueprintPure, Category = "Save")
+    static FGuid SpawnedGUID(const FGuid& SpawnerGUID, int32 Sequence);
+
+    static FGuid Derive(const FGuid& GUID, const FString& Context, int32 Salt);
+
+    // Core rule, shared with the commandlet: the first entry keeps its GUID, later duplicates (and
+    // invalid GUIDs) get one derived from their context. Every resolved GUID is added to Taken.
+    static TArray<FGuid> Resolve(const TArray<FGuid>& GUIDs, const TArray<FString>& Contexts, TSet<FGuid>& Taken);
+
+    static FString GetContext(const UActorComponent* Component);
+
+private:
+    void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+
+    TMap<FGuid, TWeakObjectPtr<UGUIDComponent>> Owners;
+    TArray<TWeakObjectPtr<UGUIDComponent>> Pending;
+    FDelegateHandle LevelAddedHandle;
+    int32 RepairedCount = 0;
+};
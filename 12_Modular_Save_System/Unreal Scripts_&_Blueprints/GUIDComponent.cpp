@@ -0,0 +1,55 @@
+#include "GUIDComponent.h"
+#include "GUIDAuthoritySubsystem.h"
+#include "Engine/World.h"
+
+UGUIDComponent::UGUIDComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UGUIDComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	UWorld* World = GetWorld();
+	if (!World || IsTemplate()) return;
+
+	// Actors placed in the editor get a random GUID. In game worlds an invalid GUID is derived
+	// by the authority instead, so spawned actors without one still get the same GUID every session.
+	if (!GUID.IsValid() && !World->IsGameWorld())
+	{
+		GUID = FGuid::NewGuid();
+	}
+
+	if (UGUIDAuthoritySubsystem* Authority = World->GetSubsystem<UGUIDAuthoritySubsystem>())
+	{
+		Authority->Register(this);
+	}
+}
+
+void UGUIDComponent::OnUnregister()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UGUIDAuthoritySubsystem* Authority = World->GetSubsystem<UGUIDAuthoritySubsystem>())
+		{
+			Authority->Unregister(this);
+		}
+	}
+
+	Super::OnUnregister();
+}
+
+void UGUIDComponent::AssignSpawnedGUID(const FGuid& SpawnerGUID, int32 Sequence)
+{
+	UGUIDAuthoritySubsystem* Authority = GetWorld() ? GetWorld()->GetSubsystem<UGUIDAuthoritySubsystem>() : nullptr;
+	if (Authority) Authority->Unregister(this);
+
+	GUID = UGUIDAuthoritySubsystem::SpawnedGUID(SpawnerGUID, Sequence);
+
+	if (Authority)
+	{
+		Authority->Register(this);
+		Authority->Flush();
+	}
+}
@@ -0,0 +1,28 @@
+// GUIDComponent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Misc/Guid.h"
+#include "GUIDComponent.generated.h"
+
+UCLASS(ClassGroup=(Save), meta=(BlueprintSpawnableComponent))
+class MECHANICS_TEST_LVN_API UGUIDComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	// Written by UGUIDAuthoritySubsystem when it collides with another component's GUID
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FGuid GUID;
+
+	UGUIDComponent();
+
+	// Gives a spawned actor the GUID its spawner's sequence number maps to, the same every session
+	UFUNCTION(BlueprintCallable, Category="Save")
+	void AssignSpawnedGUID(const FGuid& SpawnerGUID, int32 Sequence);
+
+protected:
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+};
@@ -12,5 +12,6 @@ struct FSaveDataEntry
 	UPROPERTY() FGuid GUID;
 	UPROPERTY() FString Type;
 	UPROPERTY() FString JsonData;
+	UPROPERTY() int32 Version = 0; // Schema version of Type, 0 in saves written before versioning
 };
 
@@ -1,20 +1,201 @@
 #include "SaveManagerSubsystem.h"
+#include "Diagnostics.h"
 #include "SaveGameData.h"
 #include "SaveableComponent.h"
 #include "GUIDComponent.h"
+#include "GUIDAuthoritySubsystem.h"
+#include "SaveSchemaRegistry.h"
 #include "SaveableTransformComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "EngineUtils.h"
+#include "HAL/FileManager.h"
+#include "ImageUtils.h"
+#include "Misc/App.h"
+#include "Misc/Paths.h"
+
+const FString USaveManagerSubsystem::QuickSaveSlot = TEXT("Quicksave");
+const FString USaveManagerSubsystem::AutoSavePrefix = TEXT("Autosave_");
+const FString USaveManagerSubsystem::LegacySlot = TEXT("MainSave");
+
+void USaveManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    IFileManager::Get().MakeDirectory(*GetSlotFolder(), true);
+    Index = MakeUnique<FSaveSlotIndex>(GetSlotFolder());
+    SessionStart = FPlatformTime::Seconds();
+}
 
 void USaveManagerSubsystem::SaveGame()
 {
+    SaveToSlot(CurrentSlot);
+}
+
+void USaveManagerSubsystem::LoadGame()
+{
+    LoadFromSlot(CurrentSlot);
+}
+
+void USaveManagerSubsystem::DeleteSaveGame()
+{
+    DeleteSlot(CurrentSlot);
+}
+
+/* ----- Slots ----- */
+
+void USaveManagerSubsystem::SaveToSlot(const FString& Slot)
+{
+    UWorld* World = GetWorld();
+    if (!World) return;
+
     USaveGameData* SaveData = Cast<USaveGameData>(
         UGameplayStatics::CreateSaveGameObject(USaveGameData::StaticClass())
     );
+    CaptureEntries(SaveData->Entries);
+
+    TArray<uint8> Body;
+    if (!UGameplayStatics::SaveGameToMemory(SaveData, Body)) return;
+
+    const FString SlotName = SanitizeSlot(Slot);
+
+    FSaveSlotHeader Header;
+    Header.Timestamp = FDateTime::UtcNow();
+    Header.PlaytimeSeconds = GetPlaytime();
+    Header.Level = UGameplayStatics::GetCurrentLevelName(World, true);
+    Header.GameVersion = FApp::GetBuildVersion();
+    Header.DisplayName = SlotName;
+
+    if (!FSaveSlotFile::Write(GetSlotPath(SlotName), Header, Body, PendingThumbnail))
+    {
+        DIAG_LOG(Save, Error, TEXT("[SaveManager] Could not write slot %s."), *SlotName);
+        return;
+    }
+
+    PendingThumbnail.Reset();
+    Index->Update(SlotName);
+    DIAG_LOG(Save, Log, TEXT("[SaveManager] Saving %d entries to %s"), SaveData->Entries.Num(), *SlotName);
+}
+
+bool USaveManagerSubsystem::LoadFromSlot(const FString& Slot)
+{
+    const FString SlotName = SanitizeSlot(Slot);
+    const FString Path = GetSlotPath(SlotName);
+    USaveGameData* SaveData = nullptr;
+
+    FSaveSlotHeader Header;
+    TArray<uint8> Body;
+    if (FSaveSlotFile::TryReadBody(Path, Header, Body))
+    {
+        SaveData = Cast<USaveGameData>(UGameplayStatics::LoadGameFromMemory(Body));
+        LoadedPlaytime = Header.PlaytimeSeconds;
+    }
+    else if (IFileManager::Get().FileExists(*Path))
+    {
+        DIAG_LOG(Save, Error, TEXT("[SaveManager] Slot %s is damaged (bad header or checksum). Not loaded."), *SlotName);
+        return false;
+    }
+    else if (SlotName == SanitizeSlot(CurrentSlot))
+    {
+        // Saves from before slots used the engine's own slot; it loads into the default slot
+        SaveData = Cast<USaveGameData>(UGameplayStatics::LoadGameFromSlot(LegacySlot, 0));
+        LoadedPlaytime = 0.0;
+    }
+
+    if (!SaveData) return false;
+
+    SessionStart = FPlatformTime::Seconds();
+    RestoreEntries(SaveData->Entries);
+
+    DIAG_LOG(Save, Log, TEXT("[SaveManager] Loaded %d entries from %s"), SaveData->Entries.Num(), *SlotName);
+    return true;
+}
+
+void USaveManagerSubsystem::DeleteSlot(const FString& Slot)
+{
+    const FString SlotName = SanitizeSlot(Slot);
+    IFileManager::Get().Delete(*GetSlotPath(SlotName), false, false, true);
+
+    if (SlotName == SanitizeSlot(CurrentSlot))
+    {
+        UGameplayStatics::DeleteGameInSlot(LegacySlot, 0);
+    }
+
+    Index->Update(SlotName);
+}
+
+void USaveManagerSubsystem::AutoSave()
+{
+    Index->Refresh();
+
+    FString Target;
+    FDateTime Oldest = FDateTime::MaxValue();
+
+    for (int32 i = 1; i <= FMath::Max(AutosaveCount, 1); i++)
+    {
+        const FString Slot = AutoSavePrefix + FString::FromInt(i);
+        const FSaveSlotInfo* Info = Index->Find(Slot);
+        if (!Info || !Info->bValid)
+        {
+            Target = Slot;
+            break;
+        }
+        if (Info->Header.Timestamp < Oldest)
+        {
+            Oldest = Info->Header.Timestamp;
+            Target = Slot;
+        }
+    }
+
+    SaveToSlot(Target);
+}
+
+TArray<FSaveSlotInfo> USaveManagerSubsystem::ListSlots()
+{
+    Index->Refresh();
+    return Index->List();
+}
+
+UTexture2D* USaveManagerSubsystem::LoadSlotThumbnail(const FString& Slot)
+{
+    TArray<uint8> Bytes;
+    if (!FSaveSlotFile::ReadThumbnail(GetSlotPath(Slot), Bytes)) return nullptr;
 
+    return FImageUtils::ImportBufferAsTexture2D(Bytes);
+}
+
+FString USaveManagerSubsystem::GetSlotFolder()
+{
+    return FPaths::ProjectSavedDir() / TEXT("SaveGames") / TEXT("Slots");
+}
+
+// Slot names become file names, so anything a file system could reject is replaced
+FString USaveManagerSubsystem::SanitizeSlot(const FString& Slot)
+{
+    FString Name = Slot.TrimStartAndEnd();
+    if (Name.IsEmpty()) return TEXT("Slot_1");
+
+    for (TCHAR& Char : Name.GetCharArray())
+    {
+        if (Char != 0 && !FChar::IsAlnum(Char) && Char != TEXT('_') && Char != TEXT('-') && Char != TEXT(' ')) Char = TEXT('_');
+    }
+    return Name;
+}
+
+/* ----- Capture / Restore ----- */
+
+void USaveManagerSubsystem::CaptureEntries(TArray<FSaveDataEntry>& OutEntries) const
+{
     UWorld* World = GetWorld();
     if (!World) return;
 
+    // Late registrations (actors spawned this frame) are resolved before any GUID is read
+    if (UGUIDAuthoritySubsystem* Authority = World->GetSubsystem<UGUIDAuthoritySubsystem>())
+    {
+        Authority->Flush();
+    }
+
+    TSet<FString> Written;
+
     for (TObjectIterator<USaveableComponent> It; It; ++It)
     {
         USaveableComponent* Saveable = *It;
@@ -32,28 +213,49 @@ void USaveManagerSubsystem::SaveGame()
         UGUIDComponent* GUIDComp = Owner->FindComponentByClass<UGUIDComponent>();
         if (!GUIDComp) continue;
 
+        bool bAlreadyWritten = false;
+        Written.Add(GUIDComp->GUID.ToString() + Saveable->GetSaveDataType(), &bAlreadyWritten);
+        if (bAlreadyWritten)
+        {
+            DIAG_LOG(Save, Warning, TEXT("[SaveManager] %s writes a second %s under GUID %s. Only the first is restored."),
+                *Owner->GetName(), *Saveable->GetSaveDataType(), *GUIDComp->GUID.ToString());
+        }
+
         FSaveDataEntry Entry;
         Entry.GUID = GUIDComp->GUID;
         Entry.Type = Saveable->GetSaveDataType();
         Entry.JsonData = Saveable->CaptureState();
+        Entry.Version = FSaveSchemaRegistry::Get().GetVersion(Entry.Type);
 
-        SaveData->Entries.Add(Entry);
+        OutEntries.Add(Entry);
     }
-
-    UGameplayStatics::SaveGameToSlot(SaveData, TEXT("MainSave"), 0);
-    UE_LOG(LogTemp, Warning, TEXT("Saving %d entries"), SaveData->Entries.Num());
 }
 
-void USaveManagerSubsystem::LoadGame()
+void USaveManagerSubsystem::RestoreEntries(TArray<FSaveDataEntry> Entries) const
 {
-    USaveGameData* SaveData = Cast<USaveGameData>(
-        UGameplayStatics::LoadGameFromSlot(TEXT("MainSave"), 0)
-    );
-    if (!SaveData) return;
-
     UWorld* World = GetWorld();
     if (!World) return;
 
+    if (UGUIDAuthoritySubsystem* Authority = World->GetSubsystem<UGUIDAuthoritySubsystem>())
+    {
+        Authority->Flush();
+    }
+
+    // Older entries are upgraded to their type's current schema (and current type name) first
+    const int32 Upgraded = FSaveSchemaRegistry::Get().MigrateAll(Entries);
+    if (Upgraded > 0)
+    {
+        DIAG_LOG(Save, Log, TEXT("[SaveManager] Migrated %d entries from an older save format."), Upgraded);
+    }
+
+    // Several saveables can share one GUID, so entries are keyed by GUID and type. The first entry wins, as it did with a linear search.
+    TMap<TPair<FGuid, FString>, const FSaveDataEntry*> ByKey;
+    ByKey.Reserve(Entries.Num());
+    for (const FSaveDataEntry& Entry : Entries)
+    {
+        ByKey.FindOrAdd(TPair<FGuid, FString>(Entry.GUID, Entry.Type), &Entry);
+    }
+
     for (TObjectIterator<USaveableComponent> It; It; ++It)
     {
         USaveableComponent* Saveable = *It;
@@ -71,22 +273,11 @@ void USaveManagerSubsystem::LoadGame()
         UGUIDComponent* GUIDComp = Owner->FindComponentByClass<UGUIDComponent>();
         if (!GUIDComp) continue;
 
-        for (const FSaveDataEntry& Entry : SaveData->Entries)
+        if (const FSaveDataEntry* const* Entry = ByKey.Find(TPair<FGuid, FString>(GUIDComp->GUID, Saveable->GetSaveDataType())))
         {
-            if (Entry.GUID == GUIDComp->GUID)
-            {
-                Saveable->RestoreState(Entry.JsonData);
-                break;
-            }
+            Saveable->RestoreState((*Entry)->JsonData);
         }
     }
-
-    UE_LOG(LogTemp, Warning, TEXT("Loaded %d entries"), SaveData->Entries.Num());
-}
-
-void USaveManagerSubsystem::DeleteSaveGame()
-{
-    UGameplayStatics::DeleteGameInSlot(TEXT("MainSave"), 0);
 }
 
 void USaveManagerSubsystem::ResetAllToDefault()
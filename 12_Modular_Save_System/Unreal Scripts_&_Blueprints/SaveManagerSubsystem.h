@@ -2,14 +2,21 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "SaveDataEntry.h"
+#include "SaveSlotFile.h"
 #include "SaveManagerSubsystem.generated.h"
 
+class UTexture2D;
+
 UCLASS()
 class MECHANICS_TEST_LVN_API USaveManagerSubsystem : public UGameInstanceSubsystem
 {
 	GENERATED_BODY()
 
 public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	// Save / load / delete the current slot
 	UFUNCTION(BlueprintCallable)
 	void SaveGame();
 
@@ -22,4 +29,64 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void ResetAllToDefault();
 
+	/* ----- Slots ----- */
+
+	UFUNCTION(BlueprintCallable, Category = "Save Slots")
+	void SaveToSlot(const FString& Slot);
+
+	UFUNCTION(BlueprintCallable, Category = "Save Slots")
+	bool LoadFromSlot(const FString& Slot);
+
+	UFUNCTION(BlueprintCallable, Category = "Save Slots")
+	void DeleteSlot(const FString& Slot);
+
+	UFUNCTION(BlueprintCallable, Category = "Save Slots")
+	void QuickSave() { SaveToSlot(QuickSaveSlot); }
+
+	UFUNCTION(BlueprintCallable, Category = "Save Slots")
+	bool QuickLoad() { return LoadFromSlot(QuickSaveSlot); }
+
+	// Fills the first missing autosave slot, then overwrites the oldest one
+	UFUNCTION(BlueprintCallable, Category = "Save Slots")
+	void AutoSave();
+
+	// Every readable slot, newest first. Only headers are read, and only for files changed since the last call.
+	UFUNCTION(BlueprintCallable, Category = "Save Slots")
+	TArray<FSaveSlotInfo> ListSlots();
+
+	// Image bytes (PNG / JPG) stored with the next save, e.g. from a scene capture
+	UFUNCTION(BlueprintCallable, Category = "Save Slots")
+	void SetNextThumbnail(const TArray<uint8>& ImageBytes) { PendingThumbnail = ImageBytes; }
+
+	// Null when the slot has no thumbnail
+	UFUNCTION(BlueprintCallable, Category = "Save Slots")
+	UTexture2D* LoadSlotThumbnail(const FString& Slot);
+
+	UFUNCTION(BlueprintPure, Category = "Save Slots")
+	double GetPlaytime() const { return LoadedPlaytime + FPlatformTime::Seconds() - SessionStart; }
+
+	// Slot used by SaveGame / LoadGame / DeleteSaveGame
+	UPROPERTY(BlueprintReadWrite, Category = "Save Slots")
+	FString CurrentSlot = TEXT("Slot_1");
+
+	// Autosaves rotate through this many slots, overwriting the oldest
+	UPROPERTY(BlueprintReadWrite, Category = "Save Slots", meta = (ClampMin = "1"))
+	int32 AutosaveCount = 3;
+
+private:
+	static const FString QuickSaveSlot;
+	static const FString AutoSavePrefix;
+	static const FString LegacySlot; // Single save written before slots existed
+
+	void CaptureEntries(TArray<FSaveDataEntry>& OutEntries) const;
+	void RestoreEntries(TArray<FSaveDataEntry> Entries) const;
+
+	static FString GetSlotFolder();
+	static FString SanitizeSlot(const FString& Slot);
+	FString GetSlotPath(const FString& Slot) const { return GetSlotFolder() / (SanitizeSlot(Slot) + FSaveSlotFile::Extension); }
+
+	TUniquePtr<FSaveSlotIndex> Index;
+	TArray<uint8> PendingThumbnail;
+	double LoadedPlaytime = 0.0; // Playtime stored in the last loaded slot
+	double SessionStart = 0.0;   // FPlatformTime::Seconds() when that playtime was loaded
 };
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "SaveDataEntry.h"
+
+// Upgrades a parsed JsonData object from one schema version to the next
+using FSaveMigration = TFunction<void(FJsonObject& Data)>;
+
+/* --------------------------------------------------------------------------
+   Schema versions and migrations for save data types.
+
+   • Every FSaveDataEntry is stamped with its type's registered version (1 when the type isn't
+     registered). Saves written before versioning read as 0 and are treated as version 1.
+   • On load, Migrate parses JsonData into an FJsonObject and runs the type's migrations in
+     order (v1 -> v2 -> ...), then writes it back with the current version and type name, so
+     RestoreState only ever sees the current format.
+   • Aliases map old type names to the current one: renaming a save struct only needs an alias.
+   • Saveables register next to their data, during static initialization:
+
+       static const bool GRegistered = [] {
+           FSaveSchemaRegistry::Get().Register(TEXT("FMySaveData"), 2)
+               .AddMigration(TEXT("FMySaveData"), 1, [](FJsonObject& Data) { ... });
+           return true; }();
+
+   • The corpus (SaveCorpus/*.json) holds entries from every historical version with the state
+     they must migrate to, checked by the LVN.Save.Corpus automation test.
+   -------------------------------------------------------------------------- */
+class MECHANICS_TEST_LVN_API FSaveSchemaRegistry
+{
+public:
+    static FSaveSchemaRegistry& Get();
+
+    FSaveSchemaRegistry& Register(const FString& Type, int32 Version, const TArray<FString>& OldNames = {});
+    FSaveSchemaRegistry& AddAlias(const FString& OldName, const FString& Type);
+    FSaveSchemaRegistry& AddMigration(const FString& Type, int32 FromVersion, FSaveMigration Migration);
+
+    int32   GetVersion(const FString& Type) const;
+    FString ResolveType(const FString& Type) const;
+
+    // Brings an entry up to its type's current version. False when the entry comes from a newer
+    // build, or a migration is missing or the JSON can't be parsed; the entry is then left untouched.
+    bool Migrate(FSaveDataEntry& Entry) const;
+
+    // Migrates every entry, dropping the ones that can't be read. Returns how many were upgraded.
+    int32 MigrateAll(TArray<FSaveDataEntry>& Entries) const;
+
+private:
+    struct FSchema
+    {
+        int32 Version = 1;
+        TMap<int32, FSaveMigration> Migrations;
+    };
+
+    TMap<FString, FSchema> Schemas;
+    TMap<FString, FString> Aliases;
+};
@@ -0,0 +1,221 @@
+#include "SaveSlotFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+const TCHAR* FSaveSlotFile::Extension = TEXT(".sav");
+
+namespace
+{
+    constexpr int32 LevelBytes = 64;
+    constexpr int32 GameVersionBytes = 32;
+    constexpr int32 DisplayNameBytes = 64;
+
+    // UTF8, zero padded, cut on a character boundary when too long
+    void WriteFixed(FArchive& Ar, const FString& Value, int32 Size)
+    {
+        TArray<uint8> Bytes;
+        Bytes.SetNumZeroed(Size);
+
+        int32 Chars = Value.Len();
+        while (Chars > 0 && FTCHARToUTF8(*Value, Chars).Length() > Size) Chars--;
+
+        FTCHARToUTF8 Utf8(*Value, Chars);
+        FMemory::Memcpy(Bytes.GetData(), Utf8.Get(), Utf8.Length());
+        Ar.Serialize(Bytes.GetData(), Size);
+    }
+
+    FString ReadFixed(FArchive& Ar, int32 Size)
+    {
+        TArray<uint8> Bytes;
+        Bytes.SetNumZeroed(Size);
+        Ar.Serialize(Bytes.GetData(), Size);
+
+        int32 Length = Bytes.Find(0);
+        if (Length == INDEX_NONE) Length = Size;
+
+        FUTF8ToTCHAR Text(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Length);
+        return FString(Text.Length(), Text.Get());
+    }
+}
+
+/* ----- Header ----- */
+
+void FSaveSlotHeader::Write(TArray<uint8>& Out) const
+{
+    Out.Reset();
+    FMemoryWriter Ar(Out);
+
+    uint32 MagicValue = Magic;
+    uint16 Version = CurrentHeaderVersion;
+    uint16 Reserved = 0;
+    int64  Ticks = Timestamp.GetTicks();
+    double Playtime = PlaytimeSeconds;
+    int32  Format = FormatVersion;
+    uint32 Offset = BodyOffset, Length = BodyLength, ThumbOffset = ThumbnailOffset, ThumbLength = ThumbnailLength, Crc = Checksum;
+
+    Ar << MagicValue << Version << Reserved << Ticks << Playtime << Format;
+    Ar << Offset << Length << ThumbOffset << ThumbLength << Crc;
+    WriteFixed(Ar, Level, LevelBytes);
+    WriteFixed(Ar, GameVersion, GameVersionBytes);
+    WriteFixed(Ar, DisplayName, DisplayNameBytes);
+
+    Out.SetNumZeroed(Size);
+}
+
+bool FSaveSlotHeader::TryRead(const uint8* Data, int32 Num, FSaveSlotHeader& Out)
+{
+    if (!Data || Num < Size) return false;
+
+    TArray<uint8> Bytes(Data, Size);
+    FMemoryReader Ar(Bytes);
+
+    uint32 MagicValue = 0;
+    uint16 Reserved = 0;
+    int64  Ticks = 0;
+
+    Ar << MagicValue;
+    if (MagicValue != Magic) return false;
+
+    Ar << Out.HeaderVersion;
+    if (Out.HeaderVersion > CurrentHeaderVersion) return false;
+
+    Ar << Reserved << Ticks << Out.PlaytimeSeconds << Out.FormatVersion;
+    Ar << Out.BodyOffset << Out.BodyLength << Out.ThumbnailOffset << Out.ThumbnailLength << Out.Checksum;
+    Out.Timestamp = FDateTime(Ticks);
+    Out.Level = ReadFixed(Ar, LevelBytes);
+    Out.GameVersion = ReadFixed(Ar, GameVersionBytes);
+    Out.DisplayName = ReadFixed(Ar, DisplayNameBytes);
+    return !Ar.IsError();
+}
+
+/* ----- File ----- */
+
+bool FSaveSlotFile::Write(const FString& Path, FSaveSlotHeader& Header, const TArray<uint8>& Body, const TArray<uint8>& Thumbnail)
+{
+    Header.FormatVersion = FormatVersion;
+    Header.BodyOffset = FSaveSlotHeader::Size;
+    Header.BodyLength = Body.Num();
+    Header.ThumbnailOffset = Thumbnail.Num() > 0 ? FSaveSlotHeader::Size + Body.Num() : 0;
+    Header.ThumbnailLength = Thumbnail.Num();
+    Header.Checksum = FCrc::MemCrc32(Thumbnail.GetData(), Thumbnail.Num(), FCrc::MemCrc32(Body.GetData(), Body.Num()));
+
+    TArray<uint8> File;
+    Header.Write(File);
+    File.Append(Body);
+    File.Append(Thumbnail);
+
+    const FString Temp = Path + TEXT(".tmp");
+    if (!FFileHelper::SaveArrayToFile(File, *Temp)) return false;
+    return IFileManager::Get().Move(*Path, *Temp, true);
+}
+
+bool FSaveSlotFile::TryReadHeader(const FString& Path, FSaveSlotHeader& OutHeader)
+{
+    // Unbuffered handle, so nothing past the header is read
+    TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Path));
+    if (!Handle) return false;
+
+    uint8 Buffer[FSaveSlotHeader::Size];
+    if (!Handle->Read(Buffer, FSaveSlotHeader::Size)) return false;
+
+    return FSaveSlotHeader::TryRead(Buffer, FSaveSlotHeader::Size, OutHeader);
+}
+
+bool FSaveSlotFile::TryReadBody(const FString& Path, FSaveSlotHeader& OutHeader, TArray<uint8>& OutBody)
+{
+    TArray<uint8> File;
+    if (!FFileHelper::LoadFileToArray(File, *Path, FILEREAD_Silent)) return false;
+    if (!FSaveSlotHeader::TryRead(File.GetData(), File.Num(), OutHeader)) return false;
+
+    const int64 BodyEnd = int64(OutHeader.BodyOffset) + OutHeader.BodyLength;
+    const int64 ThumbnailEnd = int64(OutHeader.ThumbnailOffset) + OutHeader.ThumbnailLength;
+    if (BodyEnd > File.Num() || ThumbnailEnd > File.Num()) return false;
+
+    uint32 Crc = FCrc::MemCrc32(File.GetData() + OutHeader.BodyOffset, OutHeader.BodyLength);
+    Crc = FCrc::MemCrc32(File.GetData() + OutHeader.ThumbnailOffset, OutHeader.ThumbnailLength, Crc);
+    if (Crc != OutHeader.Checksum) return false;
+
+    OutBody = TArray<uint8>(File.GetData() + OutHeader.BodyOffset, OutHeader.BodyLength);
+    return true;
+}
+
+bool FSaveSlotFile::ReadThumbnail(const FString& Path, TArray<uint8>& OutThumbnail)
+{
+    FSaveSlotHeader Header;
+    if (!TryReadHeader(Path, Header) || !Header.HasThumbnail()) return false;
+
+    TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Path));
+    if (!Handle || Handle->Size() < int64(Header.ThumbnailOffset) + Header.ThumbnailLength) return false;
+
+    OutThumbnail.SetNumUninitialized(Header.ThumbnailLength);
+    return Handle->Seek(Header.ThumbnailOffset) && Handle->Read(OutThumbnail.GetData(), Header.ThumbnailLength);
+}
+
+/* ----- Index ----- */
+
+void FSaveSlotIndex::Refresh()
+{
+    TSet<FString> Seen;
+
+    IFileManager::Get().IterateDirectoryStat(*Folder, [this, &Seen](const TCHAR* FilenameOrDirectory, const FFileStatData& Stat)
+    {
+        const FString Path(FilenameOrDirectory);
+        if (Stat.bIsDirectory || !Path.EndsWith(FSaveSlotFile::Extension)) return true;
+
+        const FString Slot = FPaths::GetBaseFilename(Path);
+        Seen.Add(Slot);
+
+        const FSaveSlotInfo* Known = Slots.Find(Slot);
+        if (!Known || Known->LastWriteUtc != Stat.ModificationTime || Known->Length != Stat.FileSize)
+        {
+            Read(Slot, Path, Stat.ModificationTime, Stat.FileSize);
+        }
+        return true;
+    });
+
+    for (auto It = Slots.CreateIterator(); It; ++It)
+    {
+        if (!Seen.Contains(It.Key())) It.RemoveCurrent();
+    }
+}
+
+void FSaveSlotIndex::Update(const FString& Slot)
+{
+    const FString Path = Folder / (Slot + FSaveSlotFile::Extension);
+    const FFileStatData Stat = IFileManager::Get().GetStatData(*Path);
+
+    if (Stat.bIsValid) Read(Slot, Path, Stat.ModificationTime, Stat.FileSize);
+    else Slots.Remove(Slot);
+}
+
+TArray<FSaveSlotInfo> FSaveSlotIndex::List() const
+{
+    TArray<FSaveSlotInfo> Result;
+    Result.Reserve(Slots.Num());
+
+    for (const TPair<FString, FSaveSlotInfo>& Pair : Slots)
+    {
+        if (Pair.Value.bValid) Result.Add(Pair.Value);
+    }
+
+    Result.Sort([](const FSaveSlotInfo& A, const FSaveSlotInfo& B) { return A.Header.Timestamp > B.Header.Timestamp; });
+    return Result;
+}
+
+void FSaveSlotIndex::Read(const FString& Slot, const FString& Path, const FDateTime& ModificationTime, int64 FileSize)
+{
+    HeaderReads++;
+
+    FSaveSlotInfo& Info = Slots.FindOrAdd(Slot);
+    Info.Slot = Slot;
+    Info.Path = Path;
+    Info.Header = FSaveSlotHeader();
+    Info.bValid = FSaveSlotFile::TryReadHeader(Path, Info.Header);
+    Info.LastWriteUtc = ModificationTime;
+    Info.Length = FileSize;
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveSlotFile.generated.h"
+
+// Everything a load menu shows about a slot, readable from the first FSaveSlotHeader::Size bytes of the file
+USTRUCT(BlueprintType)
+struct MECHANICS_TEST_LVN_API FSaveSlotHeader
+{
+    GENERATED_BODY()
+
+    static constexpr int32  Size = 256;
+    static constexpr uint32 Magic = 0x534E564C; // "LVNS"
+    static constexpr uint16 CurrentHeaderVersion = 1;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Slots") FDateTime Timestamp; // UTC
+    UPROPERTY(BlueprintReadOnly, Category = "Save Slots") double PlaytimeSeconds = 0.0;
+    UPROPERTY(BlueprintReadOnly, Category = "Save Slots") int32 FormatVersion = 0; // Body layout, entries carry their own schema versions
+    UPROPERTY(BlueprintReadOnly, Category = "Save Slots") FString Level;
+    UPROPERTY(BlueprintReadOnly, Category = "Save Slots") FString GameVersion;
+    UPROPERTY(BlueprintReadOnly, Category = "Save Slots") FString DisplayName;
+
+    uint16 HeaderVersion = 0;
+    uint32 BodyOffset = 0;
+    uint32 BodyLength = 0;
+    uint32 ThumbnailOffset = 0; // 0 when the slot has no thumbnail
+    uint32 ThumbnailLength = 0;
+    uint32 Checksum = 0;        // CRC32 of body + thumbnail
+
+    bool HasThumbnail() const { return ThumbnailLength > 0; }
+
+    // Always exactly Size bytes, little endian
+    void Write(TArray<uint8>& Out) const;
+    static bool TryRead(const uint8* Data, int32 Num, FSaveSlotHeader& Out);
+};
+
+USTRUCT(BlueprintType)
+struct MECHANICS_TEST_LVN_API FSaveSlotInfo
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Slots") FString Slot; // File name without extension
+    UPROPERTY(BlueprintReadOnly, Category = "Save Slots") FSaveSlotHeader Header;
+
+    FString   Path;
+    bool      bValid = false; // False when the header couldn't be read (foreign or truncated file)
+    FDateTime LastWriteUtc;
+    int64     Length = 0;
+};
+
+/* --------------------------------------------------------------------------
+   Slot file I/O: [FSaveSlotHeader][body (SaveGameToMemory bytes)][thumbnail (image, optional)].
+
+   • TryReadHeader only reads the fixed header, so listing slots never touches a body.
+   • The body and thumbnail are covered by a CRC32 in the header, checked on load.
+   • Writes go to a temporary file that then replaces the slot, so a crash mid-write leaves
+     the previous save intact.
+   -------------------------------------------------------------------------- */
+struct MECHANICS_TEST_LVN_API FSaveSlotFile
+{
+    static const TCHAR* Extension;
+    static constexpr int32 FormatVersion = 1;
+
+    static bool Write(const FString& Path, FSaveSlotHeader& Header, const TArray<uint8>& Body, const TArray<uint8>& Thumbnail);
+    static bool TryReadHeader(const FString& Path, FSaveSlotHeader& OutHeader);
+
+    // Reads and verifies the whole file. False when it is missing, truncated or fails its checksum.
+    static bool TryReadBody(const FString& Path, FSaveSlotHeader& OutHeader, TArray<uint8>& OutBody);
+    static bool ReadThumbnail(const FString& Path, TArray<uint8>& OutThumbnail);
+};
+
+/* --------------------------------------------------------------------------
+   In-memory index of the slot files in one folder, for load / save menus.
+
+   • Refresh stats the folder and only re-reads the header of files whose modification
+     time or size changed since the last refresh. Unchanged slots cost one directory entry.
+   • Update is called after the SaveManager writes a slot itself, so the next refresh
+     doesn't read it again.
+   -------------------------------------------------------------------------- */
+class MECHANICS_TEST_LVN_API FSaveSlotIndex
+{
+public:
+    explicit FSaveSlotIndex(const FString& InFolder) : Folder(InFolder) {}
+
+    void Refresh();
+    void Update(const FString& Slot); // Re-reads one slot right away (after writing or deleting it)
+
+    const FSaveSlotInfo* Find(const FString& Slot) const { return Slots.Find(Slot); }
+    TArray<FSaveSlotInfo> List() const; // Readable slots, newest first
+
+    const FString& GetFolder() const { return Folder; }
+    int32 GetHeaderReads() const { return HeaderReads; }
+
+private:
+    void Read(const FString& Slot, const FString& Path, const FDateTime& ModificationTime, int64 FileSize);
+
+    FString Folder;
+    TMap<FString, FSaveSlotInfo> Slots;
+    int32 HeaderReads = 0; // Total headers read, for tests
+};
@@ -1,5 +1,25 @@
 #include "SaveableTransformComponent.h"
 #include "JsonObjectConverter.h"
+#include "Diagnostics.h"
+#include "SaveSchemaRegistry.h"
+
+// v1 had no bHas* flags and wrote a zero vector for a skipped scale, which is never a real scale.
+// A zero position or rotation is a real one, so those count as captured.
+static const bool GTransformSaveSchemaRegistered = []
+{
+	FSaveSchemaRegistry::Get().Register(TEXT("FTransformSaveData"), 2)
+		.AddMigration(TEXT("FTransformSaveData"), 1, [](FJsonObject& Data)
+		{
+			const TSharedPtr<FJsonObject>* Scale = nullptr;
+			const bool bZeroScale = !Data.TryGetObjectField(TEXT("scale"), Scale)
+				|| ((*Scale)->GetNumberField(TEXT("x")) == 0.0 && (*Scale)->GetNumberField(TEXT("y")) == 0.0 && (*Scale)->GetNumberField(TEXT("z")) == 0.0);
+
+			Data.SetBoolField(TEXT("bHasPosition"), true);
+			Data.SetBoolField(TEXT("bHasRotation"), true);
+			Data.SetBoolField(TEXT("bHasScale"), !bZeroScale);
+		});
+	return true;
+}();
 
 void USaveableTransformComponent::BeginPlay()
 {
@@ -22,10 +42,14 @@ FString USaveableTransformComponent::CaptureState()
 	if (bSaveRotation){ Data.Rotation = Owner->GetActorRotation(); }
 	if (bSaveScale){ Data.Scale = Owner->GetActorScale3D(); }
 
+	Data.bHasPosition = bSavePosition;
+	Data.bHasRotation = bSaveRotation;
+	Data.bHasScale = bSaveScale;
+
 	FString Json;
 	FJsonObjectConverter::UStructToJsonObjectString(Data, Json);
 
-	UE_LOG(LogTemp, Warning, TEXT("Saved Transform: %s"), *Json);
+	DIAG_LOG(Save, Verbose, TEXT("Saved Transform: %s"), *Json);
 	
 	return Json;
 }
@@ -37,9 +61,10 @@ void USaveableTransformComponent::RestoreState(const FString& JsonData)
 
 	AActor* Owner = GetOwner();
 
-	if (bSavePosition){ Owner->SetActorLocation(Data.Position); }
-	if (bSaveRotation){ Owner->SetActorRotation(Data.Rotation); }
-	if (bSaveScale){ Owner->SetActorScale3D(Data.Scale); }
+	// Only what is both enabled here and present in the save
+	if (bSavePosition && Data.bHasPosition){ Owner->SetActorLocation(Data.Position); }
+	if (bSaveRotation && Data.bHasRotation){ Owner->SetActorRotation(Data.Rotation); }
+	if (bSaveScale && Data.bHasScale){ Owner->SetActorScale3D(Data.Scale); }
 
 	UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Owner->GetRootComponent());
 	if (Root && Root->IsSimulatingPhysics())
@@ -52,5 +77,5 @@ void USaveableTransformComponent::RestoreState(const FString& JsonData)
 		Root->SetSimulatePhysics(true);
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("Restoring Transform: %s"), *JsonData);
+	DIAG_LOG(Save, Verbose, TEXT("Restoring Transform: %s"), *JsonData);
 }
@@ -12,6 +12,11 @@ struct FTransformSaveData
 	UPROPERTY() FVector Position;
 	UPROPERTY() FRotator Rotation;
 	UPROPERTY() FVector Scale;
+
+	// v2: which parts were captured, so a part the saver skipped is never restored as zero
+	UPROPERTY() bool bHasPosition = false;
+	UPROPERTY() bool bHasRotation = false;
+	UPROPERTY() bool bHasScale = false;
 };
 
 UCLASS(ClassGroup=(Save), meta=(BlueprintSpawnableComponent))
@@ -0,0 +1,171 @@
+#include "Misc/AutomationTest.h"
+#include "GUIDAuthoritySubsystem.h"
+#include "GUIDComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Real actors in a temporary game world: a duplicated actor, Blueprint instances carrying their template's GUID and a
+// level streamed in after another one. Originals must keep their GUIDs and copies must be repaired the same way every time.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Save.GUID; Quit" -nullrhi -unattended
+
+namespace GUIDAuthorityTests
+{
+	UWorld* CreateWorld()
+	{
+		UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+		FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+		Context.SetCurrentWorld(World);
+		return World;
+	}
+
+	void DestroyWorld(UWorld* World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	// Game worlds only queue registrations, so nothing is resolved until the test flushes
+	UGUIDComponent* SpawnWithGUID(UWorld* World, const TCHAR* Name, const FGuid& GUID)
+	{
+		FActorSpawnParameters Params;
+		Params.Name = FName(Name);
+		AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+
+		UGUIDComponent* Component = NewObject<UGUIDComponent>(Actor, TEXT("GUID"));
+		Component->GUID = GUID;
+		Component->RegisterComponent();
+		return Component;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGUIDAuthorityDuplicateTest, "LVN.Save.GUID.DuplicatedActor", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FGUIDAuthorityDuplicateTest::RunTest(const FString& Parameters)
+{
+	using namespace GUIDAuthorityTests;
+
+	UWorld* World = CreateWorld();
+	UGUIDAuthoritySubsystem* Authority = World->GetSubsystem<UGUIDAuthoritySubsystem>();
+
+	// The copy registers first: which actor keeps the GUID depends on the path, not on registration order
+	const FGuid A = FGuid::NewGuid(), B = FGuid::NewGuid();
+	UGUIDComponent* Copy = SpawnWithGUID(World, TEXT("Crate2"), A);
+	UGUIDComponent* Crate = SpawnWithGUID(World, TEXT("Crate"), A);
+	UGUIDComponent* Door = SpawnWithGUID(World, TEXT("Door"), B);
+	Authority->Flush();
+
+	TestEqual(TEXT("Original keeps its GUID"), Crate->GUID, A);
+	TestEqual(TEXT("Unrelated actor keeps its GUID"), Door->GUID, B);
+	TestEqual(TEXT("Copy gets the GUID derived from its path"), Copy->GUID, UGUIDAuthoritySubsystem::Derive(A, UGUIDAuthoritySubsystem::GetContext(Copy), 0));
+	TestEqual(TEXT("One repair"), Authority->GetRepairedCount(), 1);
+	TestTrue(TEXT("Copy owns its new GUID"), Authority->FindByGUID(Copy->GUID) == Copy);
+	TestTrue(TEXT("Original owns the old GUID"), Authority->FindByGUID(A) == Crate);
+
+	DestroyWorld(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGUIDAuthorityTemplateTest, "LVN.Save.GUID.TemplateInstances", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FGUIDAuthorityTemplateTest::RunTest(const FString& Parameters)
+{
+	using namespace GUIDAuthorityTests;
+
+	UWorld* World = CreateWorld();
+	UGUIDAuthoritySubsystem* Authority = World->GetSubsystem<UGUIDAuthoritySubsystem>();
+
+	// Every instance carries the GUID its Blueprint default was saved with
+	const FGuid TemplateGUID = FGuid::NewGuid();
+	TArray<UGUIDComponent*> Barrels;
+	for (int32 i = 0; i < 20; i++)
+	{
+		Barrels.Add(SpawnWithGUID(World, *FString::Printf(TEXT("BP_Barrel_C_%d"), i), TemplateGUID));
+	}
+	Authority->Flush();
+
+	TSet<FGuid> Unique;
+	for (const UGUIDComponent* Barrel : Barrels) Unique.Add(Barrel->GUID);
+	TestEqual(TEXT("Instances no longer collide"), Unique.Num(), Barrels.Num());
+
+	// Spawner based GUIDs replace the template's, stay unique across spawners and are the same for the same sequence
+	const FGuid SpawnerA = FGuid::NewGuid(), SpawnerB = FGuid::NewGuid();
+	TSet<FGuid> Spawned;
+	for (int32 i = 0; i < Barrels.Num(); i++)
+	{
+		const FGuid Spawner = (i % 2 == 0) ? SpawnerA : SpawnerB;
+		Barrels[i]->AssignSpawnedGUID(Spawner, i / 2);
+
+		TestEqual(TEXT("Spawned GUID follows the sequence"), Barrels[i]->GUID, UGUIDAuthoritySubsystem::SpawnedGUID(Spawner, i / 2));
+		TestTrue(TEXT("Spawned actor owns its GUID"), Authority->FindByGUID(Barrels[i]->GUID) == Barrels[i]);
+		Spawned.Add(Barrels[i]->GUID);
+	}
+	TestEqual(TEXT("Spawned GUIDs collide across sequences or spawners"), Spawned.Num(), Barrels.Num());
+
+	DestroyWorld(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGUIDAuthorityStreamedLevelTest, "LVN.Save.GUID.StreamedLevel", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FGUIDAuthorityStreamedLevelTest::RunTest(const FString& Parameters)
+{
+	using namespace GUIDAuthorityTests;
+
+	// A streamed level is resolved as its own batch when it's added, after the levels already loaded.
+	// The second run registers the streamed actors in reverse order and must repair the same ones the same way.
+	const FGuid X = FGuid::NewGuid(), Y = FGuid::NewGuid(), Z = FGuid::NewGuid();
+
+	for (int32 Run = 0; Run < 2; Run++)
+	{
+		UWorld* World = CreateWorld();
+		UGUIDAuthoritySubsystem* Authority = World->GetSubsystem<UGUIDAuthoritySubsystem>();
+
+		UGUIDComponent* Lever = SpawnWithGUID(World, TEXT("A_Lever"), X);
+		UGUIDComponent* Gate = SpawnWithGUID(World, TEXT("A_Gate"), Y);
+		Authority->Flush();
+
+		UGUIDComponent* StreamedLever = nullptr;
+		UGUIDComponent* Chest = nullptr;
+		UGUIDComponent* ChestCopy = nullptr;
+		if (Run == 0)
+		{
+			StreamedLever = SpawnWithGUID(World, TEXT("B_Lever"), X);
+			Chest = SpawnWithGUID(World, TEXT("B_Chest"), Z);
+			ChestCopy = SpawnWithGUID(World, TEXT("B_Chest2"), Z);
+		}
+		else
+		{
+			ChestCopy = SpawnWithGUID(World, TEXT("B_Chest2"), Z);
+			Chest = SpawnWithGUID(World, TEXT("B_Chest"), Z);
+			StreamedLever = SpawnWithGUID(World, TEXT("B_Lever"), X);
+		}
+		Authority->Flush();
+
+		TestEqual(TEXT("Streaming left the first level's lever alone"), Lever->GUID, X);
+		TestEqual(TEXT("Streaming left the first level's gate alone"), Gate->GUID, Y);
+		TestEqual(TEXT("Streamed chest keeps its GUID"), Chest->GUID, Z);
+
+		// World packages get a new name each run, so the repair is checked against the actor's own path
+		TestEqual(TEXT("Streamed lever is repaired from its path"), StreamedLever->GUID,
+			UGUIDAuthoritySubsystem::Derive(X, UGUIDAuthoritySubsystem::GetContext(StreamedLever), 0));
+		TestEqual(TEXT("Streamed chest copy is repaired from its path"), ChestCopy->GUID,
+			UGUIDAuthoritySubsystem::Derive(Z, UGUIDAuthoritySubsystem::GetContext(ChestCopy), 0));
+
+		DestroyWorld(World);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGUIDAuthoritySaltTest, "LVN.Save.GUID.Salt", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FGUIDAuthoritySaltTest::RunTest(const FString& Parameters)
+{
+	// A repaired GUID that is itself taken moves on to the next salt
+	const FGuid A = FGuid::NewGuid();
+	const FString Context = TEXT("/Game/Maps/Level.Level:PersistentLevel.Crate.GUID");
+	TSet<FGuid> Taken = { A, UGUIDAuthoritySubsystem::Derive(A, Context, 0) };
+
+	const TArray<FGuid> Resolved = UGUIDAuthoritySubsystem::Resolve({ A }, { Context }, Taken);
+	TestEqual(TEXT("Skips the taken derived GUID"), Resolved[0], UGUIDAuthoritySubsystem::Derive(A, Context, 1));
+	return true;
+}
+
+#endif
@@ -0,0 +1,52 @@
+#include "Misc/AutomationTest.h"
+#include "PerfTesting.h"
+#include "SaveManagerSubsystem.h"
+#include "GUIDComponent.h"
+#include "SaveableTransformComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Times a full save and load of 10k actors with a saveable transform and a spawned GUID in a temporary world, through a
+// scratch slot that is deleted afterwards. Compared with PerfBaselines/Save.json.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Save.Performance; Quit" -nullrhi -unattended
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSavePerformanceSaveAndLoadTest, "LVN.Save.Performance.SaveAndLoad", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSavePerformanceSaveAndLoadTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 EntityCount = 10000;
+	const FString Slot = TEXT("PerfTest");
+	const FGuid SpawnerGUID(0x50657266, 0x42656E63, 0x686D6172, 0x6B000000); // Fixed, so entity GUIDs match across runs
+
+	FPerfTestWorld World;
+	USaveManagerSubsystem* SaveManager = World.GetGameInstance()->GetSubsystem<USaveManagerSubsystem>();
+	if (!TestNotNull(TEXT("SaveManager"), SaveManager))
+		return false;
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	for (int32 i = 0; i < EntityCount; ++i)
+	{
+		AActor* Entity = World.Get()->SpawnActor<AActor>(AActor::StaticClass(), FTransform(FVector((i % 100) * 100.f, (i / 100) * 100.f, 0.f)), Params);
+
+		USceneComponent* Root = NewObject<USceneComponent>(Entity);
+		Entity->SetRootComponent(Root);
+		Root->RegisterComponent();
+
+		UGUIDComponent* GUIDComp = NewObject<UGUIDComponent>(Entity);
+		GUIDComp->RegisterComponent();
+		GUIDComp->AssignSpawnedGUID(SpawnerGUID, i);
+
+		NewObject<USaveableTransformComponent>(Entity)->RegisterComponent();
+	}
+
+	FPerfRecorder Recorder;
+	Recorder.Measure(FString::Printf(TEXT("SaveToSlot_%d"), EntityCount), 5, [SaveManager, &Slot](int32) { SaveManager->SaveToSlot(Slot); }, 1);
+	Recorder.Measure(FString::Printf(TEXT("LoadFromSlot_%d"), EntityCount), 5, [SaveManager, &Slot](int32) { SaveManager->LoadFromSlot(Slot); }, 1);
+	SaveManager->DeleteSlot(Slot);
+
+	return Recorder.CheckBaseline(*this, TEXT("Save"), __FILE__);
+}
+
+#endif
@@ -0,0 +1,110 @@
+#include "Misc/AutomationTest.h"
+#include "SaveSlotFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Writes 200 slots with 64 KB bodies into a scratch folder: a cold listing reads every header within the budget,
+// a warm one reads none, and only changed or removed files are picked up again.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Save.SlotIndex; Quit" -nullrhi -unattended
+
+namespace SaveSlotIndexTests
+{
+	constexpr int32 SlotCount = 200;
+	constexpr double BudgetMs = 10.0;
+
+	FString SlotPath(const FString& Folder, int32 Index)
+	{
+		return Folder / FString::Printf(TEXT("Slot_%03d%s"), Index, FSaveSlotFile::Extension);
+	}
+
+	void WriteSlot(const FString& Folder, int32 Index, int32 BodySize = 64 * 1024)
+	{
+		// Realistic body size, so a listing that touched bodies would show up in the timings
+		TArray<uint8> Body;
+		Body.Init('x', BodySize);
+
+		FSaveSlotHeader Header;
+		Header.Timestamp = FDateTime::UtcNow() - FTimespan::FromMinutes(Index);
+		Header.PlaytimeSeconds = Index * 60.0;
+		Header.Level = TEXT("TestLevel");
+		Header.DisplayName = FString::Printf(TEXT("Slot %d"), Index);
+		FSaveSlotFile::Write(SlotPath(Folder, Index), Header, Body, TArray<uint8>());
+	}
+
+	FString CreateFolder()
+	{
+		const FString Folder = FPaths::ProjectIntermediateDir() / TEXT("SaveSlotIndexTests");
+		IFileManager::Get().DeleteDirectory(*Folder, false, true);
+		IFileManager::Get().MakeDirectory(*Folder, true);
+
+		for (int32 i = 0; i < SlotCount; i++) WriteSlot(Folder, i);
+		return Folder;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveSlotIndexListingTest, "LVN.Save.SlotIndex.Listing", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveSlotIndexListingTest::RunTest(const FString& Parameters)
+{
+	using namespace SaveSlotIndexTests;
+
+	const FString Folder = CreateFolder();
+	FSaveSlotIndex Index(Folder);
+
+	const double Start = FPlatformTime::Seconds();
+	Index.Refresh();
+	const TArray<FSaveSlotInfo> Listed = Index.List();
+	const double ColdMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+	AddInfo(FString::Printf(TEXT("Cold listing of %d slots: %.2f ms"), SlotCount, ColdMs));
+
+	TestEqual(TEXT("Every slot listed"), Listed.Num(), SlotCount);
+	TestEqual(TEXT("Every header read once"), Index.GetHeaderReads(), SlotCount);
+	TestTrue(FString::Printf(TEXT("Cold listing %.2f ms within %.1f ms"), ColdMs, BudgetMs), ColdMs <= BudgetMs);
+	if (Listed.Num() == SlotCount)
+	{
+		TestEqual(TEXT("Newest first"), Listed[0].Slot, FString(TEXT("Slot_000")));
+		TestEqual(TEXT("Oldest last"), Listed.Last().Slot, FString::Printf(TEXT("Slot_%03d"), SlotCount - 1));
+	}
+
+	// Nothing changed on disk, so the folder is stat'ed and no header is read
+	Index.Refresh();
+	Index.List();
+	TestEqual(TEXT("Warm listing reads no headers"), Index.GetHeaderReads(), SlotCount);
+
+	IFileManager::Get().DeleteDirectory(*Folder, false, true);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveSlotIndexChangesTest, "LVN.Save.SlotIndex.Changes", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveSlotIndexChangesTest::RunTest(const FString& Parameters)
+{
+	using namespace SaveSlotIndexTests;
+
+	const FString Folder = CreateFolder();
+	FSaveSlotIndex Index(Folder);
+	Index.Refresh();
+
+	// A different body size changes the file even within the file system's time resolution
+	WriteSlot(Folder, 10, 1024);
+	IFileManager::Get().Delete(*SlotPath(Folder, 20));
+	Index.Refresh();
+
+	TestEqual(TEXT("Only the rewritten header is read again"), Index.GetHeaderReads(), SlotCount + 1);
+	TestEqual(TEXT("Deleted slot is dropped"), Index.List().Num(), SlotCount - 1);
+	TestNull(TEXT("Deleted slot can't be found"), Index.Find(TEXT("Slot_020")));
+
+	// A file that isn't a slot is indexed but never listed
+	FFileHelper::SaveStringToFile(TEXT("not a save"), *SlotPath(Folder, SlotCount));
+	Index.Refresh();
+	const FSaveSlotInfo* Foreign = Index.Find(FString::Printf(TEXT("Slot_%03d"), SlotCount));
+	TestTrue(TEXT("Foreign file is indexed as invalid"), Foreign && !Foreign->bValid);
+	TestEqual(TEXT("Foreign file is not listed"), Index.List().Num(), SlotCount - 1);
+
+	IFileManager::Get().DeleteDirectory(*Folder, false, true);
+	return true;
+}
+
+#endif
@@ -0,0 +1,118 @@
+#include "ValidateSaveGUIDsCommandlet.h"
+#include "GUIDComponent.h"
+#include "GUIDAuthoritySubsystem.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/World.h"
+#include "UObject/UObjectHash.h"
+
+UValidateSaveGUIDsCommandlet::UValidateSaveGUIDsCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    LogToConsole = true;
+}
+
+int32 UValidateSaveGUIDsCommandlet::Main(const FString& Params)
+{
+    TArray<FString> MapNames;
+    FString MapsParam;
+
+    if (FParse::Value(*Params, TEXT("Maps="), MapsParam))
+    {
+        MapsParam.ParseIntoArray(MapNames, TEXT("+"));
+    }
+    else
+    {
+        IAssetRegistry& Registry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        Registry.SearchAllAssets(true);
+
+        TArray<FAssetData> Maps;
+        Registry.GetAssetsByClass(UWorld::StaticClass()->GetClassPathName(), Maps);
+        for (const FAssetData& Map : Maps)
+        {
+            if (Map.PackageName.ToString().StartsWith(TEXT("/Game/"))) MapNames.Add(Map.PackageName.ToString());
+        }
+    }
+
+    int32 Problems = 0;
+
+    for (const FString& MapName : MapNames)
+    {
+        UPackage* Package = LoadPackage(nullptr, *MapName, LOAD_None);
+        UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+        if (!World)
+        {
+            UE_LOG(LogTemp, Error, TEXT("[GUIDAuthority] Could not load map %s"), *MapName);
+            Problems++;
+            continue;
+        }
+
+        // A map and its streaming levels can all be loaded at once, so they share one GUID space
+        TArray<UGUIDComponent*> Components;
+        CollectLevel(World->PersistentLevel, Components);
+
+        for (ULevelStreaming* Streaming : World->GetStreamingLevels())
+        {
+            if (!Streaming) continue;
+
+            UPackage* LevelPackage = LoadPackage(nullptr, *Streaming->GetWorldAssetPackageName(), LOAD_None);
+            UWorld* LevelWorld = LevelPackage ? UWorld::FindWorldInPackage(LevelPackage) : nullptr;
+            if (LevelWorld) CollectLevel(LevelWorld->PersistentLevel, Components);
+        }
+
+        TMap<FGuid, FString> FirstOwner;
+        for (UGUIDComponent* Component : Components)
+        {
+            const FString Context = UGUIDAuthoritySubsystem::GetContext(Component);
+
+            if (!Component->GUID.IsValid())
+            {
+                UE_LOG(LogTemp, Error, TEXT("[GUIDAuthority] '%s' has no GUID."), *Context);
+                Problems++;
+            }
+            else if (const FString* Owner = FirstOwner.Find(Component->GUID))
+            {
+                UE_LOG(LogTemp, Error, TEXT("[GUIDAuthority] '%s' duplicates GUID %s of '%s'."), *Context, *Component->GUID.ToString(), **Owner);
+                Problems++;
+            }
+            else
+            {
+                FirstOwner.Add(Component->GUID, Context);
+            }
+        }
+    }
+
+    // Blueprints referenced by the maps are loaded by now
+    for (TObjectIterator<UGUIDComponent> It; It; ++It)
+    {
+        if (It->IsTemplate() && !It->HasAnyFlags(RF_ClassDefaultObject) && It->GUID.IsValid())
+        {
+            UE_LOG(LogTemp, Error, TEXT("[GUIDAuthority] Template '%s' carries GUID %s. Every instance would share it."), *It->GetPathName(), *It->GUID.ToString());
+            Problems++;
+        }
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("[GUIDAuthority] Checked %d map(s): %d problem(s)."), MapNames.Num(), Problems);
+    return Problems;
+}
+
+void UValidateSaveGUIDsCommandlet::CollectLevel(ULevel* Level, TArray<UGUIDComponent*>& OutComponents) const
+{
+    if (!Level) return;
+
+    TArray<UGUIDComponent*> Found;
+    ForEachObjectWithOuter(Level, [&Found](UObject* Object)
+    {
+        UGUIDComponent* Component = Cast<UGUIDComponent>(Object);
+        if (Component && !Component->IsTemplate()) Found.Add(Component);
+    }, true);
+
+    // Same order as the runtime authority, so "first owner" means the same actor in both
+    Found.Sort([](const UGUIDComponent& A, const UGUIDComponent& B)
+    {
+        return UGUIDAuthoritySubsystem::GetContext(&A).Compare(UGUIDAuthoritySubsystem::GetContext(&B), ESearchCase::CaseSensitive) < 0;
+    });
+    OutComponents.Append(Found);
+}
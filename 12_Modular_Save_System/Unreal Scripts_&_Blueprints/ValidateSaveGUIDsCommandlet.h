@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ValidateSaveGUIDsCommandlet.generated.h"
+
+/**
+ * Build-time GUID check. Loads each map with its streaming levels and reports invalid or shared
+ * GUIDs, plus Blueprint templates that carry a GUID (every spawned instance would inherit it).
+ * Returns the number of problems, so a non-zero exit code can fail the build pipeline.
+ *
+ * UnrealEditor-Cmd.exe Project.uproject -run=ValidateSaveGUIDs [-Maps=/Game/Maps/A+/Game/Maps/B]
+ */
+UCLASS()
+class MECHANICS_TEST_LVN_API UValidateSaveGUIDsCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UValidateSaveGUIDsCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+private:
+    void CollectLevel(ULevel* Level, TArray<class UGUIDComponent*>& OutComponents) const;
+};
@@ -0,0 +1,50 @@
+using System.Collections;
+using UnityEngine;
+
+// Stress scene helper: spawns many translatable labels and measures the frame spike of a language switch.
+// Run it once with "applyInOneFrame" enabled (old behaviour, every text updated in SetLanguage) and once disabled
+// (budgeted switch) to compare the worst frame.
+public class LanguageSwitchBenchmark : MonoBehaviour
+{
+    [SerializeField] TranslatableStaticText labelPrefab; // A TextMeshProUGUI with TranslatableStaticText
+    [SerializeField] RectTransform container;
+    [SerializeField] int labelCount = 5000;
+    [SerializeField] bool applyInOneFrame = false;
+    [SerializeField] LanguageEnum[] languagesToCycle = { LanguageEnum.Spanish, LanguageEnum.Chinese, LanguageEnum.English };
+
+    IEnumerator Start()
+    {
+        for (int i = 0; i < labelCount; i++)
+            Instantiate(labelPrefab, container);
+
+        // Let every label run Start() and register
+        yield return null;
+        yield return null;
+
+        TranslationManager manager = TranslationManager.Instance;
+        float defaultBudget = manager.LanguageSwitchBudgetMs;
+        manager.LanguageSwitchBudgetMs = applyInOneFrame ? 10000f : defaultBudget;
+
+        foreach (var lang in languagesToCycle)
+        {
+            float switchStart = Time.realtimeSinceStartup;
+            manager.SetLanguage(lang);
+            float worstFrameMs = (Time.realtimeSinceStartup - switchStart) * 1000f;
+            int frames = 1;
+
+            while (manager.IsSwitchingLanguage)
+            {
+                yield return null;
+                worstFrameMs = Mathf.Max(worstFrameMs, Time.unscaledDeltaTime * 1000f);
+                frames++;
+            }
+
+            Debug.Log($"[LanguageSwitchBenchmark] {labelCount} labels -> {lang}: worst frame {worstFrameMs:F2} ms over {frames} frame(s) " +
+                      $"({(applyInOneFrame ? "single frame" : $"budget {defaultBudget} ms")})");
+
+            yield return new WaitForSeconds(0.5f);
+        }
+
+        manager.LanguageSwitchBudgetMs = defaultBudget;
+    }
+}
@@ -7,6 +7,6 @@ public enum LanguageEnum
     German,
     Chinese
 
-    //Feel free to expand with more languages but have in mind you have to update "LocalizedTextStruct" as well.
+    //Feel free to expand with more languages but have in mind you have to update "LocalizedTextStruct" as well (keyed StringTables need no code changes).
 }
 
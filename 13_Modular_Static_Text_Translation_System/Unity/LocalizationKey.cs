@@ -0,0 +1,40 @@
+using UnityEngine;
+
+// Serializable reference to an entry of a StringTable.
+// The key string is only kept for authoring, lookups use the 32-bit hash computed from it.
+[System.Serializable]
+public struct LocalizationKey : ISerializationCallbackReceiver
+{
+    [SerializeField] private string key;
+    [SerializeField, HideInInspector] private uint hash;
+
+    public string Key => key;
+    public uint Hash => hash;
+    public bool IsValid => !string.IsNullOrEmpty(key);
+
+    public LocalizationKey(string key)
+    {
+        this.key = key;
+        hash = ComputeHash(key);
+    }
+
+    // FNV-1a, stable between sessions and platforms (unlike string.GetHashCode).
+    public static uint ComputeHash(string value)
+    {
+        if (string.IsNullOrEmpty(value))
+            return 0;
+
+        uint h = 2166136261;
+        for (int i = 0; i < value.Length; i++)
+        {
+            h ^= value[i];
+            h *= 16777619;
+        }
+        return h;
+    }
+
+    public void OnBeforeSerialize() { hash = ComputeHash(key); }
+    public void OnAfterDeserialize() { hash = ComputeHash(key); }
+
+    public override string ToString() => key;
+}
@@ -0,0 +1,52 @@
+using System.Text;
+
+// Language dependent helpers used when resolving StringTable entries.
+public static class LocalizationRules
+{
+    // Returns true when "count" should use the singular (one) form in the given language.
+    public static bool IsSingular(LanguageEnum lang, int count)
+    {
+        switch (lang)
+        {
+            case LanguageEnum.French: return count == 0 || count == 1;
+            case LanguageEnum.Chinese: return false; // No grammatical plural
+            //Feel free to expand with more languages and plural categories.
+            default: return count == 1;
+        }
+    }
+
+    // Replaces {0}, {1}... with the given arguments. "{{" and "}}" are escapes.
+    // Unlike string.Format, missing or malformed placeholders are left untouched instead of throwing,
+    // so a bad translation never breaks the UI.
+    public static string Format(string pattern, params object[] args)
+    {
+        if (string.IsNullOrEmpty(pattern) || args == null || args.Length == 0 || pattern.IndexOf('{') < 0)
+            return pattern;
+
+        StringBuilder sb = new StringBuilder(pattern.Length + 16);
+
+        for (int i = 0; i < pattern.Length; i++)
+        {
+            char c = pattern[i];
+
+            if (c == '{' && i + 1 < pattern.Length && pattern[i + 1] == '{') { sb.Append('{'); i++; continue; }
+            if (c == '}' && i + 1 < pattern.Length && pattern[i + 1] == '}') { sb.Append('}'); i++; continue; }
+
+            if (c == '{')
+            {
+                int close = pattern.IndexOf('}', i + 1);
+                if (close > i + 1 && int.TryParse(pattern.Substring(i + 1, close - i - 1), out int index)
+                    && index >= 0 && index < args.Length)
+                {
+                    sb.Append(args[index]);
+                    i = close;
+                    continue;
+                }
+            }
+
+            sb.Append(c);
+        }
+
+        return sb.ToString();
+    }
+}
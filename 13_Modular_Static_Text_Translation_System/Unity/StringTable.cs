@@ -0,0 +1,83 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+[System.Serializable]
+public struct StringTableEntry
+{
+    public string key;
+    [Multiline]
+    public string text;    // Default / plural ("other") form
+    [Multiline]
+    public string textOne; // Optional singular form, used when LocalizationRules.IsSingular is true
+}
+
+// One language worth of translated strings, keyed by LocalizationKey hash.
+// Entries can be authored in the inspector or imported from a CSV/JSON TextAsset (see StringTableIO).
+[CreateAssetMenu(fileName = "StringTable", menuName = "Localization/String Table")]
+public class StringTable : ScriptableObject
+{
+    public LanguageEnum language;
+
+    [Tooltip("Optional CSV or JSON source. When assigned, its entries replace the ones below at runtime (the asset itself is never modified).")]
+    public TextAsset source;
+
+    public List<StringTableEntry> entries = new List<StringTableEntry>();
+
+    private Dictionary<uint, int> lookup;
+    [System.NonSerialized] private List<StringTableEntry> sourceEntries; // Runtime copy parsed from source, dropped on Unload
+
+    public bool IsLoaded => lookup != null;
+
+    // The entries lookups read: the parsed source once loaded, the serialized entries otherwise
+    public List<StringTableEntry> Entries => sourceEntries ?? entries;
+
+    // Builds the hash lookup. Only the active language and its fallbacks are loaded by the TranslationManager.
+    // The source is parsed into a runtime copy, so the asset's serialized entries are never overwritten.
+    public void Load()
+    {
+        if (source != null && sourceEntries == null)
+            sourceEntries = StringTableIO.Parse(source.text, source.name, name);
+
+        List<StringTableEntry> current = Entries;
+        lookup = new Dictionary<uint, int>(current.Count);
+        for (int i = 0; i < current.Count; i++)
+        {
+            uint hash = LocalizationKey.ComputeHash(current[i].key);
+            if (hash == 0) continue;
+
+            if (lookup.ContainsKey(hash))
+                Debug.LogWarning($"StringTable '{name}': duplicated (or colliding) key '{current[i].key}'.");
+
+            lookup[hash] = i;
+        }
+    }
+
+    public void Unload()
+    {
+        lookup = null;
+        sourceEntries = null;
+    }
+
+    public bool TryGet(uint keyHash, out StringTableEntry entry)
+    {
+        if (lookup == null) Load();
+
+        if (lookup.TryGetValue(keyHash, out int index))
+        {
+            entry = Entries[index];
+            return true;
+        }
+
+        entry = default;
+        return false;
+    }
+
+    public bool Contains(string key) => TryGet(LocalizationKey.ComputeHash(key), out _);
+
+    void OnValidate()
+    {
+        // Rebuild (and re-parse) on next lookup after inspector edits.
+        lookup = null;
+        sourceEntries = null;
+    }
+}
@@ -0,0 +1,225 @@
+using System.Collections.Generic;
+using System.Text;
+using UnityEngine;
+
+/* --------------------------------------------------------------------------
+   StringTable import / export / validation
+
+   CSV layout (header row required, quoted fields follow RFC 4180):
+       key,text,textOne
+       menu.play,Play,
+       items.count,"{0} items","{0} item"
+
+   JSON layout:
+       { "entries": [ { "key": "menu.play", "text": "Play", "textOne": "" } ] }
+   -------------------------------------------------------------------------- */
+public static class StringTableIO
+{
+    [System.Serializable]
+    private class JsonTable
+    {
+        public List<StringTableEntry> entries = new List<StringTableEntry>();
+    }
+
+    // Replaces the serialized entries of "table" with the parsed content (authoring: in the editor this changes the asset).
+    // At runtime StringTable.Load parses its source with Parse into a copy instead.
+    public static bool Import(StringTable table, string content, string sourceName = "")
+    {
+        if (table == null)
+            return false;
+
+        List<StringTableEntry> parsed = Parse(content, sourceName, table.name);
+        if (parsed == null)
+            return false;
+
+        table.entries = parsed;
+        return true;
+    }
+
+    // Parses CSV or JSON content into new entries, null if it can't be parsed. Format is picked from the first character.
+    public static List<StringTableEntry> Parse(string content, string sourceName = "", string tableName = "")
+    {
+        if (string.IsNullOrEmpty(content))
+            return null;
+
+        string trimmed = content.TrimStart();
+        List<StringTableEntry> parsed = trimmed.StartsWith("{") ? ParseJson(trimmed) : ParseCsvEntries(content);
+
+        if (parsed == null)
+            Debug.LogWarning($"StringTableIO: could not parse '{sourceName}' for table '{tableName}'.");
+
+        return parsed;
+    }
+
+    public static bool ImportJson(StringTable table, string json)
+    {
+        List<StringTableEntry> parsed = ParseJson(json);
+        if (parsed == null)
+            return false;
+
+        table.entries = parsed;
+        return true;
+    }
+
+    public static bool ImportCsv(StringTable table, string csv)
+    {
+        List<StringTableEntry> parsed = ParseCsvEntries(csv);
+        if (parsed == null)
+            return false;
+
+        table.entries = parsed;
+        return true;
+    }
+
+    private static List<StringTableEntry> ParseJson(string json)
+    {
+        JsonTable parsed = JsonUtility.FromJson<JsonTable>(json);
+        return parsed?.entries;
+    }
+
+    private static List<StringTableEntry> ParseCsvEntries(string csv)
+    {
+        List<List<string>> rows = ParseCsv(csv);
+        if (rows.Count == 0)
+            return null;
+
+        int keyCol = rows[0].IndexOf("key");
+        int textCol = rows[0].IndexOf("text");
+        int oneCol = rows[0].IndexOf("textOne");
+        if (keyCol < 0 || textCol < 0)
+            return null;
+
+        var entries = new List<StringTableEntry>(rows.Count - 1);
+        for (int r = 1; r < rows.Count; r++)
+        {
+            List<string> row = rows[r];
+            if (keyCol >= row.Count || string.IsNullOrEmpty(row[keyCol]))
+                continue;
+
+            entries.Add(new StringTableEntry
+            {
+                key = row[keyCol],
+                text = textCol < row.Count ? row[textCol] : string.Empty,
+                textOne = oneCol >= 0 && oneCol < row.Count ? row[oneCol] : string.Empty
+            });
+        }
+        return entries;
+    }
+
+    public static string ExportJson(StringTable table)
+    {
+        return JsonUtility.ToJson(new JsonTable { entries = table.entries }, true);
+    }
+
+    public static string ExportCsv(StringTable table)
+    {
+        StringBuilder sb = new StringBuilder();
+        sb.Append("key,text,textOne\n");
+
+        foreach (var e in table.entries)
+        {
+            sb.Append(EscapeCsv(e.key)).Append(',');
+            sb.Append(EscapeCsv(e.text)).Append(',');
+            sb.Append(EscapeCsv(e.textOne)).Append('\n');
+        }
+        return sb.ToString();
+    }
+
+    // Reports, per language, every key found in any table that is missing from that language's table.
+    // Tables backed by a source are loaded first, so their parsed entries count; the ones loaded here are unloaded again.
+    public static Dictionary<LanguageEnum, List<string>> FindMissingKeys(IList<StringTable> tables)
+    {
+        var loadedHere = new List<StringTable>();
+        var allKeys = new HashSet<string>();
+        foreach (var table in tables)
+        {
+            if (table == null) continue;
+            if (!table.IsLoaded)
+            {
+                table.Load();
+                loadedHere.Add(table);
+            }
+            foreach (var e in table.Entries)
+                if (!string.IsNullOrEmpty(e.key)) allKeys.Add(e.key);
+        }
+
+        var missing = new Dictionary<LanguageEnum, List<string>>();
+        foreach (var table in tables)
+        {
+            if (table == null) continue;
+
+            var present = new HashSet<string>();
+            foreach (var e in table.Entries)
+                if (!string.IsNullOrEmpty(e.text)) present.Add(e.key);
+
+            var list = new List<string>();
+            foreach (var key in allKeys)
+                if (!present.Contains(key)) list.Add(key);
+
+            if (list.Count > 0)
+            {
+                list.Sort(System.StringComparer.Ordinal);
+                missing[table.language] = list;
+            }
+        }
+
+        foreach (var table in loadedHere)
+            table.Unload();
+
+        return missing;
+    }
+
+    private static string EscapeCsv(string value)
+    {
+        if (string.IsNullOrEmpty(value))
+            return string.Empty;
+
+        if (value.IndexOfAny(new[] { ',', '"', '\n', '\r' }) < 0)
+            return value;
+
+        return "\"" + value.Replace("\"", "\"\"") + "\"";
+    }
+
+    private static List<List<string>> ParseCsv(string csv)
+    {
+        var rows = new List<List<string>>();
+        var row = new List<string>();
+        var field = new StringBuilder();
+        bool quoted = false;
+
+        for (int i = 0; i < csv.Length; i++)
+        {
+            char c = csv[i];
+
+            if (quoted)
+            {
+                if (c == '"')
+                {
+                    if (i + 1 < csv.Length && csv[i + 1] == '"') { field.Append('"'); i++; }
+                    else quoted = false;
+                }
+                else field.Append(c);
+                continue;
+            }
+
+            switch (c)
+            {
+                case '"': quoted = true; break;
+                case ',': row.Add(field.ToString()); field.Clear(); break;
+                case '\r': break;
+                case '\n':
+                    row.Add(field.ToString()); field.Clear();
+                    rows.Add(row); row = new List<string>();
+                    break;
+                default: field.Append(c); break;
+            }
+        }
+
+        if (field.Length > 0 || row.Count > 0)
+        {
+            row.Add(field.ToString());
+            rows.Add(row);
+        }
+        return rows;
+    }
+}
@@ -5,60 +5,96 @@ public class TranslatableStaticText : MonoBehaviour
 {
     [SerializeField] LocalizedText localizedText;
 
+    [Tooltip("When set, the text is resolved from the TranslationManager string tables and the inline LocalizedText is ignored.")]
+    [SerializeField] LocalizationKey textKey;
+    [Tooltip("Selects the singular/plural form of the key. Negative values ignore pluralization.")]
+    [SerializeField] int pluralCount = -1;
+    [SerializeField] string[] formatArguments; // Replaces {0}, {1}... in the resolved text
+
     public bool customFont = false; // Set this to true if you want to use a custom font for the text, otherwise it will use the default font for the language.
     public TMP_FontAsset customFontAsset; // Assign your custom font asset in the inspector if customFont is true.
-    TextMeshProUGUI tmpUGUI;
-    TextMeshPro tmp;
+
+    // Resolved once at registration, TMP_Text covers both TextMeshProUGUI and TextMeshPro.
+    TMP_Text tmpText;
     UnityEngine.UI.Text uiText;
+    Renderer worldRenderer; // Only for in-world TextMeshPro, used to prioritize visible texts
+    bool registered;
+
+    internal int RegistryIndex = -1; // Managed by TranslationManager
+    internal LanguageEnum AppliedLanguage { get; private set; }
 
     void Awake()
     {
-        tmpUGUI = GetComponent<TextMeshProUGUI>();
-        tmp = GetComponent<TextMeshPro>();
-        uiText = GetComponent<UnityEngine.UI.Text>();
+        tmpText = GetComponent<TMP_Text>();
+        if (tmpText == null)
+            uiText = GetComponent<UnityEngine.UI.Text>();
+
+        if (tmpText is TextMeshPro)
+            worldRenderer = tmpText.GetComponent<Renderer>();
     }
 
     void Start()
     {
         if (TranslationManager.Instance != null)
         {
-            TranslationManager.Instance.OnLanguageChanged += UpdateText;
+            TranslationManager.Instance.Register(this);
+            registered = true;
             UpdateText(TranslationManager.Instance.CurrentLanguage);
         }
     }
 
-    void UpdateText(LanguageEnum lang)
+    void OnDestroy()
     {
-        string value = localizedText.Get(lang);
+        if (registered && TranslationManager.Instance != null)
+            TranslationManager.Instance.Unregister(this);
+    }
 
-        if (tmpUGUI != null)
-            tmpUGUI.text = value;
+    // Cheap visibility estimate used to update on-screen texts first when the language changes.
+    internal bool IsLikelyVisible()
+    {
+        if (!isActiveAndEnabled)
+            return false;
 
-        if (tmp != null)
-            tmp.text = value;
+        if (worldRenderer != null)
+            return worldRenderer.isVisible;
+
+        if (tmpText != null)
+            return !tmpText.canvasRenderer.cull;
+
+        return uiText != null && !uiText.canvasRenderer.cull;
+    }
+
+    internal void UpdateText(LanguageEnum lang)
+    {
+        AppliedLanguage = lang;
 
-        if (uiText != null)
+        string value = textKey.IsValid
+            ? TranslationManager.Instance.TranslateIn(lang, textKey, pluralCount, formatArguments)
+            : localizedText.Get(lang);
+
+        if (tmpText != null)
+            tmpText.text = value;
+        else if (uiText != null)
             uiText.text = value;
 
+        if (tmpText == null)
+            return;
+
         var font = TranslationManager.Instance.GetFontFor(lang);
 
         if (font != null && !customFont)
-        {
-            if (tmpUGUI != null)
-                tmpUGUI.font = font;
-
-            if (tmp != null)
-                tmp.font = font;
-        }
+            tmpText.font = font;
         else if (font != null && customFont)
-        {
-            if (tmpUGUI != null){
-                tmpUGUI.font = customFontAsset;
-            }
-            if (tmp != null){
-                tmp.font = customFontAsset;
-            }
-        }
+            tmpText.font = customFontAsset;
+    }
+
+    // Runtime setters for keyed texts (e.g. counters). Re-applies the current language.
+    public void SetKey(LocalizationKey key, int count = -1, params string[] args)
+    {
+        textKey = key;
+        pluralCount = count;
+        formatArguments = args;
+        RestoreCurrentLanguage();
     }
 
     public void PreviewLanguage(LanguageEnum lang)
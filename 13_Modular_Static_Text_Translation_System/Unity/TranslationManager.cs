@@ -1,5 +1,7 @@
 using UnityEngine;
 using System;
+using System.Collections.Generic;
+using Stopwatch = System.Diagnostics.Stopwatch;
 using TMPro;
 
 /* --------------------------------------------------------------------------
@@ -15,14 +17,27 @@ using TMPro;
        - Allows different fonts per language
        - Provides GetFontFor(language)
        - Notifies listeners via OnLanguageChanged
+       - Keeps a registry of TranslatableStaticText and re-applies them across frames
+         within languageSwitchBudgetMs (visible texts first) when the language changes
+       - Saves the language preference once the switch has finished, not on every SetLanguage
+         (deferred, still on the main thread)
 
    • LocalizedText (struct)
        - Holds per‑language strings
        - Get(lang) returns the correct one
 
+   • StringTable (ScriptableObject)
+       - One table per language, entries keyed by LocalizationKey (hashed string ID)
+       - Can be imported/exported from CSV or JSON (StringTableIO)
+       - A source TextAsset is parsed into a runtime copy on Load, the asset is never modified
+       - Supports singular/plural forms and {0}-style arguments
+       - Missing keys resolve through the language fallback chain
+       - Only the current chain stays loaded, plus the last other language TranslateIn used
+
    • TranslatableStaticText (component)
-       - Subscribes to OnLanguageChanged
+       - Registers itself in the TranslationManager (text target is resolved once)
        - Updates text + font when language changes
+       - Uses a LocalizationKey when set, inline LocalizedText otherwise
        - Allows optional custom font override
 
    Usage
@@ -32,6 +47,8 @@ using TMPro;
    3. For each translatable text, add TranslatableStaticText component and fill in the LocalizedText fields.
    4. To change language at runtime, call TranslationManager.Instance.SetLanguage(newLanguage).
    5. (Optional) Use the customFont flag and customFont
+   6. (Optional) Assign StringTables and reference keys instead of filling inline texts.
+      Use the "Validate String Tables" context menu to list missing keys per language.
 
    Hope this helps you easily manage static text translations in your Unity projects! Feel free to expand with more languages and features as needed ^^
 
@@ -44,6 +61,13 @@ public struct LanguageFont
     public TMP_FontAsset font;
 }
 
+[Serializable]
+public struct LanguageFallback
+{
+    public LanguageEnum language;
+    public LanguageEnum[] fallbacks; // Tried in order when a key is missing. English is always tried last.
+}
+
 public class TranslationManager : MonoBehaviour
 {
     public static TranslationManager Instance { get; private set; }
@@ -53,6 +77,30 @@ public class TranslationManager : MonoBehaviour
     public event Action<LanguageEnum> OnLanguageChanged;
 
     [SerializeField] private LanguageFont[] languageFonts;
+    [SerializeField] private StringTable[] stringTables;
+    [SerializeField] private LanguageFallback[] languageFallbacks;
+
+    [Tooltip("Max milliseconds per frame spent re-applying texts after a language change. Texts left over continue next frame.")]
+    [SerializeField, Min(0.05f)] private float languageSwitchBudgetMs = 1f;
+
+    private readonly List<StringTable> resolveChain = new List<StringTable>();
+
+    // Chain of the last other language TranslateIn was asked for, kept loaded until another one is asked for or the language switches
+    private readonly List<StringTable> otherChain = new List<StringTable>();
+    private LanguageEnum otherChainLanguage;
+
+    // Registry of translatable texts + the queue of texts still showing the previous language
+    private readonly List<TranslatableStaticText> registeredTexts = new List<TranslatableStaticText>();
+    private readonly List<TranslatableStaticText> pendingTexts = new List<TranslatableStaticText>();
+    private readonly List<TranslatableStaticText> hiddenTexts = new List<TranslatableStaticText>();
+    private int pendingIndex;
+    private readonly Stopwatch switchStopwatch = new Stopwatch();
+
+    private TMP_FontAsset[] fontByLanguage; // Indexed by (int)LanguageEnum
+    private bool languageSaveDirty;
+
+    public float LanguageSwitchBudgetMs { get => languageSwitchBudgetMs; set => languageSwitchBudgetMs = Mathf.Clamp(value, 0.05f, 10000f); }
+    public bool IsSwitchingLanguage => pendingIndex < pendingTexts.Count;
 
     const string PlayerPrefsKey = "SelectedLanguage";
 
@@ -68,6 +116,34 @@ public class TranslationManager : MonoBehaviour
         DontDestroyOnLoad(gameObject);
 
         LoadLanguage();
+        BuildFontLookup();
+        BuildResolveChain();
+    }
+
+    void Update()
+    {
+        if (IsSwitchingLanguage)
+            ProcessPendingTexts();
+
+        // PlayerPrefs.Save writes to disk, so it is done once the switch is applied (and coalesced if the player
+        // clicks through several languages) instead of inside SetLanguage. The write is deferred, not asynchronous:
+        // PlayerPrefs only works on the main thread, so it still costs one synchronous write on that frame.
+        if (languageSaveDirty && !IsSwitchingLanguage)
+        {
+            languageSaveDirty = false;
+            PlayerPrefs.Save();
+        }
+    }
+
+    void OnApplicationQuit()
+    {
+        if (languageSaveDirty)
+            PlayerPrefs.Save();
+    }
+
+    void OnValidate()
+    {
+        fontByLanguage = null;
     }
 
     void LoadLanguage()
@@ -89,19 +165,202 @@ public class TranslationManager : MonoBehaviour
 
         CurrentLanguage = newLanguage;
         PlayerPrefs.SetInt(PlayerPrefsKey, (int)newLanguage);
-        PlayerPrefs.Save();
+        languageSaveDirty = true;
+
+        BuildResolveChain();
+        QueueRegisteredTexts();
+        ProcessPendingTexts(); // Start right away so visible texts change on the same frame
 
         OnLanguageChanged?.Invoke(CurrentLanguage);
     }
 
+    public void Register(TranslatableStaticText text)
+    {
+        if (text == null || text.RegistryIndex >= 0)
+            return;
+
+        text.RegistryIndex = registeredTexts.Count;
+        registeredTexts.Add(text);
+    }
+
+    public void Unregister(TranslatableStaticText text)
+    {
+        int index = text.RegistryIndex;
+        if (index < 0 || index >= registeredTexts.Count || registeredTexts[index] != text)
+            return;
+
+        // Swap-remove keeps unregistering O(1)
+        int last = registeredTexts.Count - 1;
+        registeredTexts[index] = registeredTexts[last];
+        registeredTexts[index].RegistryIndex = index;
+        registeredTexts.RemoveAt(last);
+        text.RegistryIndex = -1;
+    }
+
+    void QueueRegisteredTexts()
+    {
+        pendingTexts.Clear();
+        pendingIndex = 0;
+
+        // Visible texts go first so the player never sees a mixed-language screen for long
+        hiddenTexts.Clear();
+        for (int i = 0; i < registeredTexts.Count; i++)
+        {
+            if (registeredTexts[i].IsLikelyVisible()) pendingTexts.Add(registeredTexts[i]);
+            else hiddenTexts.Add(registeredTexts[i]);
+        }
+
+        pendingTexts.AddRange(hiddenTexts);
+        hiddenTexts.Clear();
+    }
+
+    void ProcessPendingTexts()
+    {
+        switchStopwatch.Restart();
+        long budgetTicks = (long)(languageSwitchBudgetMs * Stopwatch.Frequency / 1000.0);
+
+        while (pendingIndex < pendingTexts.Count)
+        {
+            TranslatableStaticText text = pendingTexts[pendingIndex++];
+
+            // Destroyed texts are still in the queue, and previews may already show the new language
+            if (text != null && text.RegistryIndex >= 0 && text.AppliedLanguage != CurrentLanguage)
+                text.UpdateText(CurrentLanguage);
+
+            if (switchStopwatch.ElapsedTicks >= budgetTicks)
+                break;
+        }
+
+        if (pendingIndex >= pendingTexts.Count)
+        {
+            pendingTexts.Clear();
+            pendingIndex = 0;
+        }
+    }
+
     public TMP_FontAsset GetFontFor(LanguageEnum lang)
     {
-        for (int i = 0; i < languageFonts.Length; i++)
+        if (fontByLanguage == null)
+            BuildFontLookup();
+
+        int index = (int)lang;
+        return index >= 0 && index < fontByLanguage.Length ? fontByLanguage[index] : null;
+    }
+
+    void BuildFontLookup()
+    {
+        fontByLanguage = new TMP_FontAsset[Enum.GetValues(typeof(LanguageEnum)).Length];
+
+        if (languageFonts == null)
+            return;
+
+        // Same result as the previous linear scan: the first entry for a language wins
+        for (int i = languageFonts.Length - 1; i >= 0; i--)
+        {
+            int index = (int)languageFonts[i].language;
+            if (index >= 0 && index < fontByLanguage.Length)
+                fontByLanguage[index] = languageFonts[i].font;
+        }
+    }
+
+    // Resolves a key for the current language. "count" selects the singular/plural form (negative to ignore).
+    public string Translate(LocalizationKey key, int count = -1, params object[] args)
+    {
+        return TranslateIn(CurrentLanguage, key, count, args);
+    }
+
+    public string TranslateIn(LanguageEnum lang, LocalizationKey key, int count = -1, params object[] args)
+    {
+        if (!key.IsValid)
+            return string.Empty;
+
+        List<StringTable> chain = lang == CurrentLanguage ? resolveChain : GetOtherChain(lang);
+
+        for (int i = 0; i < chain.Count; i++)
+        {
+            if (!chain[i].TryGet(key.Hash, out StringTableEntry entry) || string.IsNullOrEmpty(entry.text))
+                continue;
+
+            string text = count >= 0 && !string.IsNullOrEmpty(entry.textOne) && LocalizationRules.IsSingular(chain[i].language, count)
+                ? entry.textOne
+                : entry.text;
+
+            return LocalizationRules.Format(text, args);
+        }
+
+        return key.Key; // Make missing keys visible instead of showing an empty label
+    }
+
+    [ContextMenu("Validate String Tables")]
+    public void ValidateStringTables()
+    {
+        var missing = StringTableIO.FindMissingKeys(stringTables);
+
+        foreach (var pair in missing)
+            Debug.LogWarning($"[Localization] {pair.Key} is missing {pair.Value.Count} key(s): {string.Join(", ", pair.Value)}");
+
+        if (missing.Count == 0)
+            Debug.Log("[Localization] All string tables contain every key.");
+    }
+
+    void BuildResolveChain()
+    {
+        var previous = new List<StringTable>(resolveChain);
+        previous.AddRange(otherChain);
+        otherChain.Clear();
+        GetResolveChain(CurrentLanguage, resolveChain);
+
+        // Only the tables of the active chain are parsed and kept in memory.
+        foreach (var table in previous)
+            if (!resolveChain.Contains(table)) table.Unload();
+
+        foreach (var table in resolveChain)
+            if (!table.IsLoaded) table.Load();
+    }
+
+    // Loads the chain of a language other than the current one, releasing the previous other chain's tables
+    // that the current chain doesn't use, the same way a language switch releases them.
+    List<StringTable> GetOtherChain(LanguageEnum lang)
+    {
+        if (otherChain.Count > 0 && otherChainLanguage == lang)
+            return otherChain;
+
+        var previous = new List<StringTable>(otherChain);
+        GetResolveChain(lang, otherChain);
+        otherChainLanguage = lang;
+
+        foreach (var table in previous)
+            if (!otherChain.Contains(table) && !resolveChain.Contains(table)) table.Unload();
+
+        return otherChain;
+    }
+
+    List<StringTable> GetResolveChain(LanguageEnum lang, List<StringTable> result)
+    {
+        result.Clear();
+        AddTableFor(lang, result);
+
+        if (languageFallbacks != null)
         {
-            if (languageFonts[i].language == lang)
-                return languageFonts[i].font;
+            foreach (var fallback in languageFallbacks)
+            {
+                if (fallback.language != lang || fallback.fallbacks == null) continue;
+                foreach (var l in fallback.fallbacks) AddTableFor(l, result);
+            }
         }
 
-        return null;
+        AddTableFor(LanguageEnum.English, result);
+        return result;
+    }
+
+    void AddTableFor(LanguageEnum lang, List<StringTable> result)
+    {
+        if (stringTables == null) return;
+
+        foreach (var table in stringTables)
+        {
+            if (table != null && table.language == lang && !result.Contains(table))
+                result.Add(table);
+        }
     }
 }
@@ -0,0 +1,192 @@
+#include "LocalizationStringTable.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/Csv/CsvParser.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+#include "Dom/JsonObject.h"
+
+FString ULocalizationStringTable::Resolve(const FLocalizedStringEntry& Entry, int32 Count) const
+{
+	if (Count >= 0 && !Entry.TextOne.IsEmpty() && IsSingular(Language, Count))
+		return Entry.TextOne;
+
+	return Entry.Text;
+}
+
+bool ULocalizationStringTable::ImportFromCSV(const FString& Content)
+{
+	const FCsvParser Parser(Content);
+	const FCsvParser::FRows& Rows = Parser.GetRows();
+	if (Rows.Num() == 0) return false;
+
+	int32 KeyCol = INDEX_NONE, TextCol = INDEX_NONE, OneCol = INDEX_NONE;
+	for (int32 Col = 0; Col < Rows[0].Num(); ++Col)
+	{
+		const FString Header(Rows[0][Col]);
+		if (Header.Equals(TEXT("Key"), ESearchCase::IgnoreCase)) KeyCol = Col;
+		else if (Header.Equals(TEXT("Text"), ESearchCase::IgnoreCase)) TextCol = Col;
+		else if (Header.Equals(TEXT("TextOne"), ESearchCase::IgnoreCase)) OneCol = Col;
+	}
+	if (KeyCol == INDEX_NONE || TextCol == INDEX_NONE) return false;
+
+	Entries.Reset();
+	Entries.Reserve(Rows.Num() - 1);
+
+	for (int32 Row = 1; Row < Rows.Num(); ++Row)
+	{
+		const TArray<const TCHAR*>& Cells = Rows[Row];
+		if (!Cells.IsValidIndex(KeyCol) || FCString::Strlen(Cells[KeyCol]) == 0) continue;
+
+		FLocalizedStringEntry& Entry = Entries.Add(FName(Cells[KeyCol]));
+		Entry.Text = Cells.IsValidIndex(TextCol) ? FString(Cells[TextCol]) : FString();
+		Entry.TextOne = Cells.IsValidIndex(OneCol) ? FString(Cells[OneCol]) : FString();
+	}
+	return true;
+}
+
+bool ULocalizationStringTable::ImportFromJson(const FString& Content)
+{
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Content);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid()) return false;
+
+	const TSharedPtr<FJsonObject>* EntriesObject = nullptr;
+	if (!Root->TryGetObjectField(TEXT("Entries"), EntriesObject)) return false;
+
+	Entries.Reset();
+	for (const auto& Pair : (*EntriesObject)->Values)
+	{
+		const TSharedPtr<FJsonObject>* EntryObject = nullptr;
+		if (!Pair.Value.IsValid() || !Pair.Value->TryGetObject(EntryObject)) continue;
+
+		FLocalizedStringEntry& Entry = Entries.Add(FName(*Pair.Key));
+		(*EntryObject)->TryGetStringField(TEXT("Text"), Entry.Text);
+		(*EntryObject)->TryGetStringField(TEXT("TextOne"), Entry.TextOne);
+	}
+	return true;
+}
+
+bool ULocalizationStringTable::ImportFromFile(const FString& FilePath)
+{
+	FString Content;
+	if (!FFileHelper::LoadFileToString(Content, *FilePath)) return false;
+
+	const bool bOk = FPaths::GetExtension(FilePath).Equals(TEXT("json"), ESearchCase::IgnoreCase)
+		? ImportFromJson(Content)
+		: ImportFromCSV(Content);
+
+	if (!bOk)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("LocalizationStringTable: could not parse %s"), *FilePath);
+	}
+	return bOk;
+}
+
+static FString EscapeCSVField(const FString& Value)
+{
+	if (!Value.Contains(TEXT(",")) && !Value.Contains(TEXT("\"")) && !Value.Contains(TEXT("\n")))
+		return Value;
+
+	return TEXT("\"") + Value.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+}
+
+FString ULocalizationStringTable::ExportToCSV() const
+{
+	TArray<FName> Keys;
+	Entries.GetKeys(Keys);
+	Keys.Sort(FNameLexicalLess());
+
+	FString Out = TEXT("Key,Text,TextOne\n");
+	for (const FName& Key : Keys)
+	{
+		const FLocalizedStringEntry& Entry = Entries[Key];
+		Out += EscapeCSVField(Key.ToString()) + TEXT(",") + EscapeCSVField(Entry.Text) + TEXT(",") + EscapeCSVField(Entry.TextOne) + TEXT("\n");
+	}
+	return Out;
+}
+
+FString ULocalizationStringTable::ExportToJson() const
+{
+	TArray<FName> Keys;
+	Entries.GetKeys(Keys);
+	Keys.Sort(FNameLexicalLess());
+
+	const TSharedRef<FJsonObject> EntriesObject = MakeShared<FJsonObject>();
+	for (const FName& Key : Keys)
+	{
+		const FLocalizedStringEntry& Entry = Entries[Key];
+		const TSharedRef<FJsonObject> EntryObject = MakeShared<FJsonObject>();
+		EntryObject->SetStringField(TEXT("Text"), Entry.Text);
+		EntryObject->SetStringField(TEXT("TextOne"), Entry.TextOne);
+		EntriesObject->SetObjectField(Key.ToString(), EntryObject);
+	}
+
+	const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetObjectField(TEXT("Entries"), EntriesObject);
+
+	FString Out;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Out);
+	FJsonSerializer::Serialize(Root, Writer);
+	return Out;
+}
+
+bool ULocalizationStringTable::IsSingular(ELanguage Lang, int32 Count)
+{
+	switch (Lang)
+	{
+	case ELanguage::French: return Count == 0 || Count == 1;
+	case ELanguage::Chinese: return false; // No grammatical plural
+	default: return Count == 1;
+	}
+}
+
+FString ULocalizationStringTable::FormatArguments(const FString& Pattern, const TArray<FString>& Args)
+{
+	if (Args.Num() == 0 || !Pattern.Contains(TEXT("{")))
+		return Pattern;
+
+	FString Out;
+	Out.Reserve(Pattern.Len() + 16);
+
+	for (int32 i = 0; i < Pattern.Len(); ++i)
+	{
+		const TCHAR C = Pattern[i];
+		const bool bHasNext = i + 1 < Pattern.Len();
+
+		if ((C == TEXT('{') || C == TEXT('}')) && bHasNext && Pattern[i + 1] == C)
+		{
+			Out.AppendChar(C);
+			++i;
+			continue;
+		}
+
+		if (C == TEXT('{'))
+		{
+			int32 Close = INDEX_NONE;
+			for (int32 j = i + 1; j < Pattern.Len(); ++j)
+			{
+				if (Pattern[j] == TEXT('}')) { Close = j; break; }
+			}
+
+			if (Close > i + 1)
+			{
+				const FString IndexString = Pattern.Mid(i + 1, Close - i - 1);
+				if (IndexString.IsNumeric())
+				{
+					const int32 Index = FCString::Atoi(*IndexString);
+					if (Args.IsValidIndex(Index))
+					{
+						Out += Args[Index];
+						i = Close;
+						continue;
+					}
+				}
+			}
+		}
+
+		Out.AppendChar(C);
+	}
+	return Out;
+}
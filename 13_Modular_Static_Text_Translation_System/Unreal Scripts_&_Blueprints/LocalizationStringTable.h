@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "LanguageEnum.h"
+#include "LocalizationStringTable.generated.h"
+
+USTRUCT(BlueprintType)
+struct FLocalizedStringEntry
+{
+	GENERATED_BODY()
+
+	// Default / plural ("other") form
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(MultiLine=true))
+	FString Text;
+
+	// Optional singular form, used when IsSingular(Language, Count) is true
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(MultiLine=true))
+	FString TextOne;
+};
+
+/* --------------------------------------------------------------------------
+   One language worth of translated strings.
+   Keys are FNames, so lookups compare the engine's hashed name index instead of strings.
+
+   CSV layout (header row required):
+	   Key,Text,TextOne
+	   Menu.Play,Play,
+	   Items.Count,"{0} items","{0} item"
+
+   JSON layout:
+	   { "Entries": { "Menu.Play": { "Text": "Play", "TextOne": "" } } }
+   -------------------------------------------------------------------------- */
+UCLASS(BlueprintType)
+class MECHANICS_TEST_LVN_API ULocalizationStringTable : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Localization")
+	ELanguage Language = ELanguage::English;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Localization")
+	TMap<FName, FLocalizedStringEntry> Entries;
+
+	const FLocalizedStringEntry* Find(FName Key) const { return Entries.Find(Key); }
+
+	// Picks the singular or plural form of Entry for Count (negative Count always returns the plural form)
+	FString Resolve(const FLocalizedStringEntry& Entry, int32 Count) const;
+
+	// Import replaces the current entries. Returns false if the content could not be parsed.
+	UFUNCTION(BlueprintCallable, Category="Localization")
+	bool ImportFromCSV(const FString& Content);
+
+	UFUNCTION(BlueprintCallable, Category="Localization")
+	bool ImportFromJson(const FString& Content);
+
+	// Loads a .csv or .json file from disk (format picked by extension)
+	UFUNCTION(BlueprintCallable, Category="Localization")
+	bool ImportFromFile(const FString& FilePath);
+
+	UFUNCTION(BlueprintCallable, Category="Localization")
+	FString ExportToCSV() const;
+
+	UFUNCTION(BlueprintCallable, Category="Localization")
+	FString ExportToJson() const;
+
+	// True when Count should use the singular form in Lang
+	static bool IsSingular(ELanguage Lang, int32 Count);
+
+	// Replaces {0}, {1}... with Args. "{{" and "}}" are escapes, unknown placeholders are left untouched.
+	static FString FormatArguments(const FString& Pattern, const TArray<FString>& Args);
+};
@@ -6,28 +6,48 @@ void UTranslatableStaticTextComponent::BeginPlay()
 {
     Super::BeginPlay();
 
+    CachedTextRender = GetOwner()->FindComponentByClass<UTextRenderComponent>();
+
     if (UWorld* World = GetWorld())
     {
         if (UGameInstance* GI = World->GetGameInstance())
         {
             if (UTranslationManager* Manager = GI->GetSubsystem<UTranslationManager>())
             {
-                Manager->OnLanguageChanged.AddDynamic(this, &UTranslatableStaticTextComponent::UpdateText);
+                CachedManager = Manager;
+                Manager->RegisterText(this);
                 UpdateText(Manager->CurrentLanguage);
             }
         }
     }
 }
 
+void UTranslatableStaticTextComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (CachedManager)
+    {
+        CachedManager->UnregisterText(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+bool UTranslatableStaticTextComponent::IsLikelyVisible() const
+{
+    return CachedTextRender && CachedTextRender->IsVisible() && CachedTextRender->WasRecentlyRendered(0.25f);
+}
+
 void UTranslatableStaticTextComponent::UpdateText(ELanguage Lang)
 {
-    FString Value = LocalizedText.Get(Lang);
+    AppliedLanguage = Lang;
 
-    UTranslationManager* Manager = GetWorld()->GetGameInstance()->GetSubsystem<UTranslationManager>();
+    FString Value = (!TextKey.IsNone() && CachedManager)
+        ? CachedManager->TranslateIn(Lang, TextKey, FormatArguments, PluralCount)
+        : LocalizedText.Get(Lang);
 
-    if (UTextRenderComponent* TR = GetOwner()->FindComponentByClass<UTextRenderComponent>())
+    if (CachedTextRender)
     {
-        TR->SetText(FText::FromString(Value));
+        CachedTextRender->SetText(FText::FromString(Value));
     }
 
 }
@@ -6,6 +6,9 @@
 #include "LocalizedText.h"
 #include "TranslatableStaticTextComponent.generated.h"
 
+class UTextRenderComponent;
+class UTranslationManager;
+
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class MECHANICS_TEST_LVN_API UTranslatableStaticTextComponent : public UActorComponent
 {
@@ -16,8 +19,41 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	FLocalizedText LocalizedText;
 
+	// When set, the text is resolved from the TranslationManager string tables and LocalizedText is ignored
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FName TextKey;
+
+	// Selects the singular/plural form of TextKey. Negative values ignore pluralization.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 PluralCount = -1;
+
+	// Replaces {0}, {1}... in the resolved text
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TArray<FString> FormatArguments;
+
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UFUNCTION()
 	void UpdateText(ELanguage Lang);
+
+	// Used by UTranslationManager to apply on-screen texts first
+	bool IsLikelyVisible() const;
+
+	ELanguage GetAppliedLanguage() const { return AppliedLanguage; }
+
+private:
+
+	// Resolved once in BeginPlay instead of searching the owner on every language change
+	UPROPERTY(Transient)
+	TObjectPtr<UTextRenderComponent> CachedTextRender;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UTranslationManager> CachedManager;
+
+	ELanguage AppliedLanguage = ELanguage::English;
+
+	// Position in UTranslationManager::RegisteredTexts, so unregistering is a swap-remove
+	friend class UTranslationManager;
+	int32 RegistryIndex = INDEX_NONE;
 };
@@ -1,5 +1,7 @@
 #include "TranslationManager.h"
+#include "TranslatableStaticTextComponent.h"
 #include "Misc/ConfigCacheIni.h"
+#include "Misc/Paths.h"
 
 static const TCHAR* GLanguageSection = TEXT("Language");
 static const TCHAR* GLanguageKey     = TEXT("CurrentLanguage");
@@ -15,6 +17,41 @@ void UTranslationManager::Initialize(FSubsystemCollectionBase& Collection)
     OnLanguageChanged.Broadcast(CurrentLanguage);
 }
 
+void UTranslationManager::Deinitialize()
+{
+    FlushLanguageSave();
+    for (const TWeakObjectPtr<UTranslatableStaticTextComponent>& Text : RegisteredTexts)
+        if (Text.IsValid()) Text->RegistryIndex = INDEX_NONE;
+    RegisteredTexts.Reset();
+    PendingTexts.Reset();
+
+    Super::Deinitialize();
+}
+
+void UTranslationManager::Tick(float DeltaTime)
+{
+    if (IsSwitchingLanguage())
+        ProcessPendingTexts();
+
+    if (!IsSwitchingLanguage())
+        FlushLanguageSave();
+}
+
+bool UTranslationManager::IsTickable() const
+{
+    return IsSwitchingLanguage() || bLanguageSaveDirty;
+}
+
+ETickableTickType UTranslationManager::GetTickableTickType() const
+{
+    return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+TStatId UTranslationManager::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UTranslationManager, STATGROUP_Tickables);
+}
+
 void UTranslationManager::SetLanguage(ELanguage NewLanguage)
 {
     if (CurrentLanguage == NewLanguage)
@@ -23,9 +60,82 @@ void UTranslationManager::SetLanguage(ELanguage NewLanguage)
     CurrentLanguage = NewLanguage;
     SaveLanguage();
 
+    QueueRegisteredTexts();
+    ProcessPendingTexts(); // Start right away so visible texts change on the same frame
+
     OnLanguageChanged.Broadcast(NewLanguage);
 }
 
+void UTranslationManager::RegisterText(UTranslatableStaticTextComponent* Text)
+{
+    if (!Text || Text->RegistryIndex != INDEX_NONE) return;
+
+    Text->RegistryIndex = RegisteredTexts.Add(Text);
+}
+
+void UTranslationManager::UnregisterText(UTranslatableStaticTextComponent* Text)
+{
+    if (!Text || !RegisteredTexts.IsValidIndex(Text->RegistryIndex) || RegisteredTexts[Text->RegistryIndex].Get() != Text)
+        return;
+
+    // Swap-remove keeps unregistering O(1)
+    RemoveRegisteredAt(Text->RegistryIndex);
+    Text->RegistryIndex = INDEX_NONE;
+}
+
+void UTranslationManager::RemoveRegisteredAt(int32 Index)
+{
+    RegisteredTexts.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    if (RegisteredTexts.IsValidIndex(Index))
+        if (UTranslatableStaticTextComponent* Moved = RegisteredTexts[Index].Get())
+            Moved->RegistryIndex = Index;
+}
+
+void UTranslationManager::QueueRegisteredTexts()
+{
+    PendingTexts.Reset(RegisteredTexts.Num());
+    PendingIndex = 0;
+
+    // Recently rendered texts go first so the player never sees a mixed-language screen for long
+    TArray<TWeakObjectPtr<UTranslatableStaticTextComponent>> HiddenTexts;
+    for (int32 i = RegisteredTexts.Num() - 1; i >= 0; --i)
+    {
+        UTranslatableStaticTextComponent* Text = RegisteredTexts[i].Get();
+        if (!Text)
+        {
+            RemoveRegisteredAt(i);
+            continue;
+        }
+
+        if (Text->IsLikelyVisible()) PendingTexts.Add(Text);
+        else HiddenTexts.Add(Text);
+    }
+
+    PendingTexts.Append(MoveTemp(HiddenTexts));
+}
+
+void UTranslationManager::ProcessPendingTexts()
+{
+    const double Deadline = FPlatformTime::Seconds() + LanguageSwitchBudgetMs * 0.001;
+
+    while (PendingIndex < PendingTexts.Num())
+    {
+        // Previews may already show the new language
+        UTranslatableStaticTextComponent* Text = PendingTexts[PendingIndex++].Get();
+        if (Text && Text->GetAppliedLanguage() != CurrentLanguage)
+            Text->UpdateText(CurrentLanguage);
+
+        if (FPlatformTime::Seconds() >= Deadline)
+            break;
+    }
+
+    if (PendingIndex >= PendingTexts.Num())
+    {
+        PendingTexts.Reset();
+        PendingIndex = 0;
+    }
+}
+
 void UTranslationManager::LoadLanguage()
 {
     int32 SavedValue = static_cast<int32>(ELanguage::English);
@@ -41,11 +151,135 @@ void UTranslationManager::LoadLanguage()
         CurrentLanguage = ELanguage::English;
 }
 
-void UTranslationManager::SaveLanguage() const
+void UTranslationManager::SaveLanguage()
 {
     if (GConfig)
     {
+        // Only updates the in-memory config, the file is written by FlushLanguageSave once the switch is applied
+        // (several quick SetLanguage calls end up in a single disk write)
         GConfig->SetInt(GLanguageSection, GLanguageKey, static_cast<int32>(CurrentLanguage), GGameUserSettingsIni);
-        GConfig->Flush(false, GGameUserSettingsIni);
+        bLanguageSaveDirty = true;
     }
-}
\ No newline at end of file
+}
+
+// Deferred, not asynchronous: GConfig isn't thread safe, so the file is still written on the game thread
+void UTranslationManager::FlushLanguageSave()
+{
+    if (!bLanguageSaveDirty || !GConfig) return;
+
+    bLanguageSaveDirty = false;
+    GConfig->Flush(false, GGameUserSettingsIni);
+}
+
+void UTranslationManager::RegisterStringTable(ULocalizationStringTable* Table)
+{
+    if (!Table) return;
+
+    StringTables.Add(Table->Language, Table);
+}
+
+FString UTranslationManager::Translate(FName Key, const TArray<FString>& Args, int32 PluralCount)
+{
+    return TranslateIn(CurrentLanguage, Key, Args, PluralCount);
+}
+
+FString UTranslationManager::TranslateIn(ELanguage Lang, FName Key, const TArray<FString>& Args, int32 PluralCount)
+{
+    if (Key.IsNone()) return FString();
+
+    TArray<ELanguage> Chain;
+    GetResolveChain(Lang, Chain);
+
+    for (ELanguage ChainLang : Chain)
+    {
+        const ULocalizationStringTable* Table = GetOrLoadStringTable(ChainLang);
+        if (!Table) continue;
+
+        const FLocalizedStringEntry* Entry = Table->Find(Key);
+        if (!Entry || Entry->Text.IsEmpty()) continue;
+
+        return ULocalizationStringTable::FormatArguments(Table->Resolve(*Entry, PluralCount), Args);
+    }
+
+    // Make missing keys visible instead of showing an empty label
+    return Key.ToString();
+}
+
+int32 UTranslationManager::ValidateStringTables()
+{
+    const UEnum* LanguageEnum = StaticEnum<ELanguage>();
+    TSet<FName> AllKeys;
+
+    for (int32 i = 0; i < LanguageEnum->NumEnums() - 1; ++i)
+    {
+        if (const ULocalizationStringTable* Table = GetOrLoadStringTable(static_cast<ELanguage>(LanguageEnum->GetValueByIndex(i))))
+        {
+            for (const auto& Pair : Table->Entries) AllKeys.Add(Pair.Key);
+        }
+    }
+
+    int32 TotalMissing = 0;
+    for (int32 i = 0; i < LanguageEnum->NumEnums() - 1; ++i)
+    {
+        const ELanguage Lang = static_cast<ELanguage>(LanguageEnum->GetValueByIndex(i));
+        const ULocalizationStringTable* Table = GetOrLoadStringTable(Lang);
+
+        TArray<FString> Missing;
+        for (const FName& Key : AllKeys)
+        {
+            const FLocalizedStringEntry* Entry = Table ? Table->Find(Key) : nullptr;
+            if (!Entry || Entry->Text.IsEmpty()) Missing.Add(Key.ToString());
+        }
+
+        if (Missing.Num() > 0)
+        {
+            Missing.Sort();
+            UE_LOG(LogTemp, Warning, TEXT("[Localization] %s is missing %d key(s): %s"),
+                *LanguageEnum->GetNameStringByIndex(i), Missing.Num(), *FString::Join(Missing, TEXT(", ")));
+        }
+        TotalMissing += Missing.Num();
+    }
+
+    return TotalMissing;
+}
+
+ULocalizationStringTable* UTranslationManager::GetOrLoadStringTable(ELanguage Lang)
+{
+    if (TObjectPtr<ULocalizationStringTable>* Found = StringTables.Find(Lang))
+        return *Found;
+
+    // Cache misses too, so a language without a file is only looked up once
+    StringTables.Add(Lang, nullptr);
+
+    const FString LanguageName = StaticEnum<ELanguage>()->GetNameStringByValue(static_cast<int64>(Lang));
+    const FString BasePath = FPaths::Combine(FPaths::ProjectContentDir(), StringTableDirectory, LanguageName);
+
+    for (const TCHAR* Extension : { TEXT(".csv"), TEXT(".json") })
+    {
+        const FString FilePath = BasePath + Extension;
+        if (!FPaths::FileExists(FilePath)) continue;
+
+        ULocalizationStringTable* Loaded = NewObject<ULocalizationStringTable>(this);
+        Loaded->Language = Lang;
+        if (Loaded->ImportFromFile(FilePath))
+        {
+            StringTables[Lang] = Loaded;
+            return Loaded;
+        }
+    }
+
+    return nullptr;
+}
+
+void UTranslationManager::GetResolveChain(ELanguage Lang, TArray<ELanguage>& OutChain) const
+{
+    OutChain.Reset();
+    OutChain.Add(Lang);
+
+    if (const FLanguageFallbackChain* Chain = FallbackChains.Find(Lang))
+    {
+        for (ELanguage Fallback : Chain->Fallbacks) OutChain.AddUnique(Fallback);
+    }
+
+    OutChain.AddUnique(ELanguage::English);
+}
@@ -2,7 +2,9 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
 #include "LanguageEnum.h"
+#include "LocalizationStringTable.h"
 #include "TranslationManager.generated.h"
 
 
@@ -17,17 +19,29 @@
 	   - Stores per‑language strings
 	   - Get(Language) returns the correct one
 
+   • ULocalizationStringTable (DataAsset)
+	   - One table per language, entries keyed by FName (hashed string ID)
+	   - Import/export from CSV or JSON
+	   - Singular/plural forms and {0}-style arguments
+
    • UTranslationManager (GameInstanceSubsystem)
 	   - Loads/saves CurrentLanguage from GGameUserSettingsIni
 	   - Broadcasts OnLanguageChanged when language changes
+	   - Keeps a registry of UTranslatableStaticTextComponents and re-applies them across frames
+	     within LanguageSwitchBudgetMs (recently rendered texts first)
+	   - Flushes the config file once the switch is done instead of on every SetLanguage
+	     (deferred, still on the game thread)
+	   - Loads string tables per language (registered assets or Content/Localization/StringTables/<Language>.csv|json)
+	   - Resolves keys through a per-language fallback chain (English is always last)
+	   - ValidateStringTables() reports missing keys per language
 
    • UTranslationBlueprintLibrary [Used in UMG Widgets Blueprints to preview/restore/update text]
 	   - Applies localized text to UWidgets
 	   - Supports preview + restore for UMG design time
 
    • UTranslatableStaticTextComponent
-	   - Holds FLocalizedText
-	   - Subscribes to OnLanguageChanged
+	   - Holds FLocalizedText or a TextKey (TextKey wins when set)
+	   - Registers in UTranslationManager, caching its UTextRenderComponent
 	   - Updates in‑world text when language changes
 
    Usage
@@ -42,10 +56,22 @@
 
    -------------------------------------------------------------------------- */
 
+class UTranslatableStaticTextComponent;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLanguageChanged, ELanguage, NewLanguage);
 
+USTRUCT(BlueprintType)
+struct FLanguageFallbackChain
+{
+	GENERATED_BODY()
+
+	// Tried in order when a key is missing in the requested language
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TArray<ELanguage> Fallbacks;
+};
+
 UCLASS(Blueprintable, BlueprintType)
-class MECHANICS_TEST_LVN_API UTranslationManager : public UGameInstanceSubsystem
+class MECHANICS_TEST_LVN_API UTranslationManager : public UGameInstanceSubsystem, public FTickableGameObject
 {
 	GENERATED_BODY()
 
@@ -58,12 +84,66 @@ public:
 	ELanguage CurrentLanguage = ELanguage::English; // Default to English
 
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject (only ticks while a language switch or a config flush is pending)
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual TStatId GetStatId() const override;
 
 	UFUNCTION(BlueprintCallable)
 	void SetLanguage(ELanguage NewLanguage);
 
+	// Folder (relative to the project Content dir) where <Language>.csv / <Language>.json tables are looked up
+	UPROPERTY(BlueprintReadWrite, Category="Localization")
+	FString StringTableDirectory = TEXT("Localization/StringTables");
+
+	UPROPERTY(BlueprintReadWrite, Category="Localization")
+	TMap<ELanguage, FLanguageFallbackChain> FallbackChains;
+
+	// Registers (or replaces) the table used for Table->Language
+	UFUNCTION(BlueprintCallable, Category="Localization")
+	void RegisterStringTable(ULocalizationStringTable* Table);
+
+	UFUNCTION(BlueprintCallable, Category="Localization", meta=(AutoCreateRefTerm="Args"))
+	FString Translate(FName Key, const TArray<FString>& Args, int32 PluralCount = -1);
+
+	UFUNCTION(BlueprintCallable, Category="Localization", meta=(AutoCreateRefTerm="Args"))
+	FString TranslateIn(ELanguage Lang, FName Key, const TArray<FString>& Args, int32 PluralCount = -1);
+
+	// Loads every language table and logs the keys each one is missing. Returns the total of missing keys.
+	UFUNCTION(BlueprintCallable, Category="Localization")
+	int32 ValidateStringTables();
+
+	// Max milliseconds per frame spent re-applying texts after a language change
+	UPROPERTY(BlueprintReadWrite, Category="Localization")
+	float LanguageSwitchBudgetMs = 1.0f;
+
+	UFUNCTION(BlueprintPure, Category="Localization")
+	bool IsSwitchingLanguage() const { return PendingIndex < PendingTexts.Num(); }
+
+	void RegisterText(UTranslatableStaticTextComponent* Text);
+	void UnregisterText(UTranslatableStaticTextComponent* Text);
+
 private:
 
+	TArray<TWeakObjectPtr<UTranslatableStaticTextComponent>> RegisteredTexts;
+	TArray<TWeakObjectPtr<UTranslatableStaticTextComponent>> PendingTexts;
+	int32 PendingIndex = 0;
+	bool bLanguageSaveDirty = false;
+
+	void RemoveRegisteredAt(int32 Index);
+	void QueueRegisteredTexts();
+	void ProcessPendingTexts();
+	void FlushLanguageSave();
+
+	UPROPERTY(Transient)
+	TMap<ELanguage, TObjectPtr<ULocalizationStringTable>> StringTables;
+
+	ULocalizationStringTable* GetOrLoadStringTable(ELanguage Lang);
+	void GetResolveChain(ELanguage Lang, TArray<ELanguage>& OutChain) const;
+
 	void LoadLanguage();
-	void SaveLanguage() const;
+	void SaveLanguage();
 };
@@ -81,7 +81,7 @@ public class FP_Controller : MonoBehaviour
     {
         if (playerCamera == null)
         {
-            Debug.LogError("Player Camera reference is missing!");
+            Diag.Error(DiagCategory.Interaction, this, "Player Camera reference is missing!");
             enabled = false;
             return;
         }
@@ -207,6 +207,7 @@ public class FP_Controller : MonoBehaviour
         if (!allowInteraction) return;
 
         Ray ray = new Ray(playerCamera.transform.position, playerCamera.transform.forward);
+        Diag.Line(DiagCategory.Interaction, ray.origin, ray.GetPoint(interactDistance), Color.yellow);
 
         if (Physics.Raycast(ray, out RaycastHit hit, interactDistance, interactMask))
         {
@@ -216,13 +217,13 @@ public class FP_Controller : MonoBehaviour
                 if (InputManager.Instance.isInteracting)
                 {
                     interactable.OnInteract(playerCamera.transform.forward);
-                    Debug.Log("Interacted with interactable: " + hit.collider.name);
+                    Diag.Log(DiagCategory.Interaction, this, "Interacted with interactable: {0}", hit.collider);
 
                 }
                 else
                 {
                     interactable.OnFocusEnter();
-                    Debug.Log("Looking at interactable: " + hit.collider.name);
+                    Diag.Verbose(DiagCategory.Interaction, this, "Looking at interactable: {0}", hit.collider);
                 }
             }
             else
@@ -230,7 +231,7 @@ public class FP_Controller : MonoBehaviour
                 if (currentInteractable != null){
                     currentInteractable.OnFocusExit();
                     currentInteractable = null;
-                    Debug.Log("Not looking at any interactable");
+                    Diag.Verbose(DiagCategory.Interaction, this, "Not looking at any interactable");
                 }
             }
         }
@@ -239,7 +240,7 @@ public class FP_Controller : MonoBehaviour
             if (currentInteractable != null){
                 currentInteractable.OnFocusExit();
                 currentInteractable = null;
-                Debug.Log("Not looking at any interactable");
+                Diag.Verbose(DiagCategory.Interaction, this, "Not looking at any interactable");
             }
         }
     }
@@ -0,0 +1,111 @@
+using UnityEngine;
+
+// Hands a Light over to the LightBudgetManager. Owners (e.g. FP_FlashlightSystem) drive it through
+// SetOn / SetLevel / SetFlicker instead of writing light.enabled or light.intensity themselves.
+[RequireComponent(typeof(Light))]
+public class BudgetedLight : MonoBehaviour
+{
+    [SerializeField] private float priority = 0f; // Higher wins. Keep the player's flashlight well above AI lights
+    [SerializeField] private bool wantsShadows = true;
+    [SerializeField] private bool startOn = true;
+
+    [Header("Flicker")]
+    [SerializeField] private int seed = 0; // 0 = assigned from registration order
+    [Range(0f, 1f)][SerializeField] private float flickerStrength = 0f; // 0 = steady, 1 = can dip to black
+    [SerializeField] private float flickerFrequency = 12f; // Noise keys per second
+
+    private Light target;
+    private LightShadows authoredShadows;
+    private float baseIntensity;
+    private float level = 1f;
+    private bool isOn;
+
+    // Manager state
+    internal bool registered;
+    internal float score;
+    internal int id; // Tie-break, so equal scores keep the same order every frame
+    internal float fade;
+    internal bool snapFade = true; // Switching on/off is instant, only budget changes fade
+    private bool writtenEnabled;
+    private float writtenIntensity = -1f;
+    private LightShadows writtenShadows;
+
+    public Light Light => target;
+    public float Priority { get => priority; set => priority = value; }
+    public bool WantsShadows { get => wantsShadows; set => wantsShadows = value; }
+    public bool CanCastShadows => wantsShadows && authoredShadows != LightShadows.None;
+    public int Seed { get => seed; set => seed = value; }
+    public float BaseIntensity { get => baseIntensity; set => baseIntensity = Mathf.Max(0f, value); }
+    public float Level => level;
+    public bool IsOn => isOn;
+    public float FlickerStrength => flickerStrength;
+    public float FlickerFrequency => flickerFrequency;
+    public float Fade => fade; // 0..1, how much of the light the budget currently lets through
+
+    private void Awake()
+    {
+        id = GetInstanceID();
+        target = GetComponent<Light>();
+        baseIntensity = target.intensity;
+        authoredShadows = target.shadows;
+        isOn = startOn;
+
+        writtenEnabled = target.enabled;
+        writtenShadows = target.shadows;
+    }
+
+    private void OnEnable() => LightBudgetManager.GetOrCreate().Register(this);
+
+    private void OnDisable()
+    {
+        if (LightBudgetManager.Instance != null)
+            LightBudgetManager.Instance.Unregister(this);
+    }
+
+    public void SetOn(bool on)
+    {
+        if (isOn != on)
+            snapFade = true;
+        isOn = on;
+    }
+
+    // Output multiplier (0..1) on top of BaseIntensity, e.g. a dimming battery
+    public void SetLevel(float value) => level = Mathf.Clamp01(value);
+
+    public void SetFlicker(float strength, float frequency = -1f)
+    {
+        flickerStrength = Mathf.Clamp01(strength);
+        if (frequency > 0f)
+            flickerFrequency = frequency;
+    }
+
+    // Called by the manager once per frame; returns how many Light properties were written
+    internal int Apply(bool lit, float intensity, bool castShadows)
+    {
+        int writes = 0;
+
+        if (lit != writtenEnabled)
+        {
+            target.enabled = writtenEnabled = lit;
+            writes++;
+        }
+
+        if (!lit)
+            return writes;
+
+        if (Mathf.Abs(intensity - writtenIntensity) > 0.001f)
+        {
+            target.intensity = writtenIntensity = intensity;
+            writes++;
+        }
+
+        LightShadows shadows = castShadows ? authoredShadows : LightShadows.None;
+        if (shadows != writtenShadows)
+        {
+            target.shadows = writtenShadows = shadows;
+            writes++;
+        }
+
+        return writes;
+    }
+}
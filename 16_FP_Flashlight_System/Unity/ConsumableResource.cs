@@ -0,0 +1,344 @@
+using System;
+using UnityEngine;
+using UnityEngine.Events;
+
+/* --------------------------------------------------------------------------
+   Generic consumable resource (flashlight batteries, fuel, lamp oil...).
+
+   • One or more cells drained one at a time. When the active cell runs dry the next
+     charged cell is hot-swapped in without interrupting the output (autoSwapCells),
+     or the owner swaps manually with SwapCell().
+   • Drain rate = drainPerSecond * drainCurve(outputLevel). Owners set the output level
+     (0 = off) instead of draining every frame.
+   • Drain is analytical: the rate is constant between output changes, so queries read the
+     charge without writing anything, and the state only catches up when the next event
+     (low / cell empty) is due through a single Invoke, or on a change (fill, drain...).
+     Nothing ticks, so inactive or offscreen owners cost nothing.
+   • IsLow / IsDepleted are the cached states flipped by those events: poll them freely, or
+     listen to onLow / onLowCleared / onDepleted.
+   • Pickups (ResourcePickup) fill cells; onLow / onDepleted / onCellSwapped report changes.
+   • Saves cell charges and the active cell through ISaveable (needs a GUIDComponent).
+   -------------------------------------------------------------------------- */
+public class ConsumableResource : MonoBehaviour, ISaveable
+{
+    [Serializable]
+    public class Cell
+    {
+        public float capacity = 100f;
+        public float charge = 100f;
+    }
+
+    [Header("Cells")]
+    [SerializeField] private Cell[] cells = { new Cell() };
+    [SerializeField] private bool autoSwapCells = true;
+
+    [Header("Drain")]
+    [SerializeField] private float drainPerSecond = 100f / 30f; // Units per second at full output
+    [SerializeField] private AnimationCurve drainCurve = AnimationCurve.Linear(0f, 0f, 1f, 1f); // Output level -> drain multiplier
+
+    [Header("Thresholds")]
+    [Range(0f, 1f)][SerializeField] private float lowThreshold = 0.25f; // Fraction of the total capacity
+
+    [Header("Events")]
+    public UnityEvent onLow = new UnityEvent();
+    public UnityEvent onLowCleared = new UnityEvent();
+    public UnityEvent onDepleted = new UnityEvent(); // The active cell is empty and nothing was swapped in
+    public UnityEvent onRefilled = new UnityEvent();
+    public UnityEvent<int> onCellSwapped = new UnityEvent<int>();
+
+    private int activeCell;
+    private float outputLevel;
+    private float drainRate; // Units per second at the current output level
+    private float lastSyncTime;
+    private bool isLow;
+    private bool isDepleted;
+
+    public int CellCount => cells.Length;
+    public int ActiveCell => activeCell;
+    public float OutputLevel => outputLevel;
+    public float DrainRate => drainRate;
+    public float LowThreshold => lowThreshold;
+
+    public float TotalCapacity
+    {
+        get
+        {
+            float total = 0f;
+            foreach (Cell cell in cells) total += cell.capacity;
+            return total;
+        }
+    }
+
+    public float TotalCharge => SumCharge() - PendingDrain;
+    public float Fraction { get { float capacity = TotalCapacity; return capacity > 0f ? TotalCharge / capacity : 0f; } }
+    public float ActiveCellCharge => cells[activeCell].charge - PendingDrain;
+    public bool IsLow => isLow;
+    public bool IsDepleted => isDepleted;
+
+    // Drained from the active cell since the last sync. It can't cross a cell or the low threshold,
+    // the scheduled event syncs first.
+    private float PendingDrain => drainRate > 0f ? Mathf.Clamp((Time.time - lastSyncTime) * drainRate, 0f, cells[activeCell].charge) : 0f;
+
+    // Seconds until the whole resource is empty at the current output (infinite when not draining)
+    public float TimeRemaining => drainRate > 0f ? TotalCharge / drainRate : float.PositiveInfinity;
+
+    private void Awake()
+    {
+        if (cells == null || cells.Length == 0)
+            cells = new[] { new Cell() };
+
+        foreach (Cell cell in cells)
+        {
+            cell.capacity = Mathf.Max(0f, cell.capacity);
+            cell.charge = Mathf.Clamp(cell.charge, 0f, cell.capacity);
+        }
+
+        activeCell = Mathf.Max(0, FindChargedCell(0));
+        lastSyncTime = Time.time;
+
+        // Initial state, no events
+        isLow = SumCharge() <= lowThreshold * TotalCapacity;
+        isDepleted = cells[activeCell].charge <= 0f;
+    }
+
+    private void OnDisable() => CancelInvoke(nameof(OnEventDue));
+
+    private void OnEnable()
+    {
+        lastSyncTime = Time.time; // Time spent disabled doesn't drain
+        Schedule();
+    }
+
+    public void SetOutputLevel(float level)
+    {
+        Sync();
+        outputLevel = Mathf.Clamp01(level);
+        drainRate = outputLevel > 0f ? drainPerSecond * Mathf.Max(0f, drainCurve.Evaluate(outputLevel)) : 0f;
+        Schedule();
+    }
+
+    // Catches the charge up to now. Called before every change and when the next event is due;
+    // queries don't need it. Only reschedules when an event actually happened.
+    public void Sync()
+    {
+        float now = Time.time;
+        float elapsed = now - lastSyncTime;
+        lastSyncTime = now;
+
+        if (elapsed > 0f && drainRate > 0f)
+        {
+            int cell = activeCell;
+            bool low = isLow, depleted = isDepleted;
+            Consume(elapsed * drainRate);
+
+            if (cell != activeCell || low != isLow || depleted != isDepleted)
+                Schedule();
+        }
+    }
+
+    private void OnEventDue()
+    {
+        Sync();
+        Schedule(); // Also covers a wake-up a hair early, before the event
+    }
+
+    // Immediately removes an amount (e.g. a burst of use), swapping cells as needed
+    public void Drain(float amount)
+    {
+        Sync();
+        if (amount > 0f)
+            Consume(amount);
+        Schedule();
+    }
+
+    // Tops up the active cell first, then the others in order. Returns the amount accepted.
+    public float Fill(float amount)
+    {
+        Sync();
+
+        float accepted = 0f;
+        for (int i = 0; i < cells.Length && amount > 0f; i++)
+        {
+            float added = AddTo(cells[(activeCell + i) % cells.Length], amount);
+            accepted += added;
+            amount -= added;
+        }
+
+        OnFilled(accepted);
+        return accepted;
+    }
+
+    public float FillCell(int index, float amount)
+    {
+        if (index < 0 || index >= cells.Length)
+            return 0f;
+
+        Sync();
+        float accepted = AddTo(cells[index], amount);
+        OnFilled(accepted);
+        return accepted;
+    }
+
+    public int GetEmptiestCell()
+    {
+        int emptiest = 0;
+        for (int i = 1; i < cells.Length; i++)
+            if (CellFraction(i) < CellFraction(emptiest))
+                emptiest = i;
+        return emptiest;
+    }
+
+    public float GetCellCharge(int index)
+    {
+        if (index < 0 || index >= cells.Length)
+            return 0f;
+        return index == activeCell ? ActiveCellCharge : cells[index].charge;
+    }
+
+    // A cell without capacity can't take any charge, so it counts as full
+    private float CellFraction(int index) => cells[index].capacity > 0f ? GetCellCharge(index) / cells[index].capacity : 1f;
+
+    // Hot-swaps to the next charged cell without touching the output level
+    public bool SwapCell()
+    {
+        Sync();
+        bool swapped = TrySwapToChargedCell();
+        RefreshThresholds();
+        Schedule();
+        return swapped;
+    }
+
+    private void Consume(float amount)
+    {
+        while (amount > 0f)
+        {
+            Cell cell = cells[activeCell];
+            float used = Mathf.Min(cell.charge, amount);
+            cell.charge -= used;
+            amount -= used;
+
+            if (cell.charge > 0f || !autoSwapCells || !TrySwapToChargedCell())
+                break;
+        }
+
+        RefreshThresholds();
+    }
+
+    private static float AddTo(Cell cell, float amount)
+    {
+        float added = Mathf.Clamp(amount, 0f, cell.capacity - cell.charge);
+        cell.charge += added;
+        return added;
+    }
+
+    private void OnFilled(float accepted)
+    {
+        if (accepted <= 0f)
+            return;
+
+        // A refilled resource resumes from the active cell if it got charge, otherwise the next charged one
+        if (cells[activeCell].charge <= 0f)
+            TrySwapToChargedCell();
+
+        onRefilled?.Invoke();
+        RefreshThresholds();
+        Schedule();
+    }
+
+    private bool TrySwapToChargedCell()
+    {
+        int next = FindChargedCell(activeCell + 1);
+        if (next < 0 || next == activeCell)
+            return false;
+
+        activeCell = next;
+        onCellSwapped?.Invoke(activeCell);
+        return true;
+    }
+
+    private int FindChargedCell(int start)
+    {
+        for (int i = 0; i < cells.Length; i++)
+        {
+            int index = (start + i) % cells.Length;
+            if (cells[index].charge > 0f)
+                return index;
+        }
+        return -1;
+    }
+
+    private float SumCharge()
+    {
+        float total = 0f;
+        foreach (Cell cell in cells) total += cell.charge;
+        return total;
+    }
+
+    private void RefreshThresholds()
+    {
+        bool low = SumCharge() <= lowThreshold * TotalCapacity;
+        if (low != isLow)
+        {
+            isLow = low;
+            if (low) onLow?.Invoke();
+            else onLowCleared?.Invoke();
+        }
+
+        bool depleted = cells[activeCell].charge <= 0f;
+        if (depleted != isDepleted)
+        {
+            isDepleted = depleted;
+            if (depleted) onDepleted?.Invoke();
+        }
+    }
+
+    // Wakes up once, exactly when the next event (low threshold or empty cell) is due
+    private void Schedule()
+    {
+        CancelInvoke(nameof(OnEventDue));
+        if (drainRate <= 0f || !isActiveAndEnabled)
+            return;
+
+        float cellCharge = cells[activeCell].charge;
+        if (cellCharge <= 0f)
+            return;
+
+        float untilEvent = cellCharge / drainRate;
+        if (!isLow)
+            untilEvent = Mathf.Min(untilEvent, (SumCharge() - lowThreshold * TotalCapacity) / drainRate);
+
+        Invoke(nameof(OnEventDue), Mathf.Max(0f, untilEvent) + 0.001f);
+    }
+
+    // ---------------------------------------------------------------------
+    // ISaveable
+    // ---------------------------------------------------------------------
+
+    public Type SaveDataType => typeof(ConsumableResourceSaveData);
+
+    public object CaptureState()
+    {
+        Sync();
+
+        var data = new ConsumableResourceSaveData { charges = new float[cells.Length], activeCell = activeCell };
+        for (int i = 0; i < cells.Length; i++)
+            data.charges[i] = cells[i].charge;
+        return data;
+    }
+
+    // The output level is not saved: it belongs to the owner (e.g. whether the flashlight is on)
+    public void RestoreState(object state)
+    {
+        var data = (ConsumableResourceSaveData)state;
+
+        int count = data.charges != null ? Mathf.Min(data.charges.Length, cells.Length) : 0;
+        for (int i = 0; i < count; i++)
+            cells[i].charge = Mathf.Clamp(data.charges[i], 0f, cells[i].capacity);
+
+        activeCell = Mathf.Clamp(data.activeCell, 0, cells.Length - 1);
+        lastSyncTime = Time.time;
+
+        RefreshThresholds();
+        Schedule();
+    }
+}
@@ -0,0 +1,9 @@
+using UnityEngine;
+
+[System.Serializable]
+[SaveSchema(1)]
+public struct ConsumableResourceSaveData
+{
+    public float[] charges;
+    public int activeCell;
+}
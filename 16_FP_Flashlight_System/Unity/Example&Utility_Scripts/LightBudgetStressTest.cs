@@ -0,0 +1,93 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+// Stress scene helper: spawns AI-held flashlights (spot lights on wandering capsules) that all register
+// with the LightBudgetManager, then logs how many are lit / shadowed and what the budget pass costs.
+// Place it on an empty GameObject in a dark scene with a camera and press Play.
+public class LightBudgetStressTest : MonoBehaviour
+{
+    [SerializeField] int flashlightCount = 100;
+    [SerializeField] float areaRadius = 40f;
+    [SerializeField] float walkSpeed = 2f;
+    [Range(0f, 1f)][SerializeField] float flickeringShare = 0.3f; // Holders with a "low battery"
+    [SerializeField] float intensity = 3f;
+    [SerializeField] float range = 15f;
+    [SerializeField] int seed = 42; // Spawn layout and walk targets; the flicker seed lives on the manager
+    [SerializeField] float reportInterval = 2f;
+
+    class Holder
+    {
+        public Transform transform;
+        public Vector3 target;
+    }
+
+    readonly List<Holder> holders = new List<Holder>();
+    System.Random random;
+    float reportTimer;
+
+    void Start()
+    {
+        random = new System.Random(seed);
+
+        for (int i = 0; i < flashlightCount; i++)
+        {
+            GameObject body = GameObject.CreatePrimitive(PrimitiveType.Capsule);
+            body.name = $"FlashlightHolder_{i}";
+            body.transform.position = RandomPoint() + Vector3.up;
+            Destroy(body.GetComponent<Collider>());
+
+            GameObject lightObject = new GameObject("Flashlight");
+            lightObject.transform.SetParent(body.transform, false);
+            lightObject.transform.localPosition = new Vector3(0.3f, 0.4f, 0.3f);
+            lightObject.transform.localRotation = Quaternion.Euler(15f, 0f, 0f);
+
+            Light spot = lightObject.AddComponent<Light>();
+            spot.type = LightType.Spot;
+            spot.intensity = intensity;
+            spot.range = range;
+            spot.spotAngle = 45f;
+            spot.shadows = LightShadows.Soft;
+
+            BudgetedLight budgeted = lightObject.AddComponent<BudgetedLight>();
+            budgeted.Seed = i + 1; // Stable per holder, independent of registration order
+            if (random.NextDouble() < flickeringShare)
+                budgeted.SetFlicker(0.8f);
+
+            holders.Add(new Holder { transform = body.transform, target = RandomPoint() + Vector3.up });
+        }
+    }
+
+    void Update()
+    {
+        float step = walkSpeed * Time.deltaTime;
+        foreach (Holder holder in holders)
+        {
+            Vector3 toTarget = holder.target - holder.transform.position;
+            if (toTarget.sqrMagnitude < 0.25f)
+            {
+                holder.target = RandomPoint() + Vector3.up;
+                continue;
+            }
+
+            holder.transform.rotation = Quaternion.LookRotation(toTarget);
+            holder.transform.position = Vector3.MoveTowards(holder.transform.position, holder.target, step);
+        }
+
+        reportTimer += Time.deltaTime;
+        if (reportTimer < reportInterval || LightBudgetManager.Instance == null)
+            return;
+
+        reportTimer = 0f;
+        LightBudgetManager budget = LightBudgetManager.Instance;
+        Debug.Log($"[LightBudgetStressTest] {budget.RegisteredCount} flashlights: {budget.ActiveCount} active (max {budget.MaxActiveLights}), " +
+                  $"{budget.VisibleCount} visible, {budget.ShadowCount} shadowed (max {budget.MaxShadowLights}), " +
+                  $"{budget.WritesLastFrame} light writes, {budget.LastUpdateMs:F3} ms");
+    }
+
+    Vector3 RandomPoint()
+    {
+        double angle = random.NextDouble() * Mathf.PI * 2.0;
+        float radius = areaRadius * Mathf.Sqrt((float)random.NextDouble());
+        return transform.position + new Vector3(Mathf.Cos((float)angle) * radius, 0f, Mathf.Sin((float)angle) * radius);
+    }
+}
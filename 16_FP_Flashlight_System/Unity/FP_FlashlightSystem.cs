@@ -13,14 +13,18 @@ public class FP_FlashlightSystem : MonoBehaviour
     [SerializeField] private float maxBattery = 100f;
     [SerializeField] private float batteryLifeTimeSeconds = 30f;
     [SerializeField] private float chargeTime = 1f;
-    private float currentFlashlightBattery;
+    [SerializeField] private ConsumableResource battery; // Optional: replaces the built-in drain (cells, pickups, saving)
+    private float currentFlashlightBattery; // Built-in drain only, a battery is read on demand (BatteryLevel)
 
     [Header("Flicker Settings")]
     [SerializeField] private float lowBatteryThreshold = 25f;
     [SerializeField] private float flickerIntervalMin = 0.5f;
     [SerializeField] private float flickerIntervalMax = 1f;
     [SerializeField] private float flickerOffDuration = 0.5f;
+    [Range(0f, 1f)][SerializeField] private float budgetedFlickerStrength = 0.8f; // Used when the light has a BudgetedLight
     private Coroutine flickerCoroutine;
+    private BudgetedLight budgetedLight; // Optional: lets the LightBudgetManager own flicker and intensity writes
+    private bool budgetedFlickering;
 
     [Header("Inertia Settings")]
     [SerializeField] private float inertiaStrength = 25f;
@@ -31,6 +35,7 @@ public class FP_FlashlightSystem : MonoBehaviour
     [Header("Debug")]
     [SerializeField] private TextMeshProUGUI debugBatteryText;
     private Coroutine batteryChargeCoroutine;
+    private int shownBatteryPercent = -1;
 
     private bool flashlightState = false;
 
@@ -39,8 +44,30 @@ public class FP_FlashlightSystem : MonoBehaviour
         inertiaRotation = flashlightPivot.rotation;
         currentFlashlightBattery = maxBattery;
 
+        // Low / depleted come from the battery's scheduled events instead of polling it every frame
+        if (battery != null)
+        {
+            battery.SetOutputLevel(0f);
+            battery.onLow.AddListener(OnBatteryLow);
+            battery.onLowCleared.AddListener(OnBatteryLowCleared);
+            battery.onDepleted.AddListener(OnBatteryDepleted);
+        }
+
         if (flashlightLight != null)
-            flashlightLight.enabled = flashlightState;
+        {
+            budgetedLight = flashlightLight.GetComponent<BudgetedLight>();
+            SetLightOn(flashlightState);
+        }
+    }
+
+    private void OnDestroy()
+    {
+        if (battery != null)
+        {
+            battery.onLow.RemoveListener(OnBatteryLow);
+            battery.onLowCleared.RemoveListener(OnBatteryLowCleared);
+            battery.onDepleted.RemoveListener(OnBatteryDepleted);
+        }
     }
 
     private void LateUpdate()
@@ -60,17 +87,23 @@ public class FP_FlashlightSystem : MonoBehaviour
             return;
         }
 
-        if (currentFlashlightBattery <= 0f)
+        if (!HasCharge())
         {
             currentFlashlightBattery = 0f;
             flashlightState = false;
-            flashlightLight.enabled = false;
+            SetLightOn(false);
+            if (battery != null)
+                battery.SetOutputLevel(0f);
             Debug.Log("Flashlight battery depleted!");
             return;
         }
 
         flashlightState = !flashlightState;
-        flashlightLight.enabled = flashlightState;
+        SetLightOn(flashlightState);
+
+        // The resource drains on its own from here on; nothing is subtracted per frame
+        if (battery != null)
+            battery.SetOutputLevel(flashlightState ? 1f : 0f);
 
         // Snap instantly when turning ON
         if (flashlightState)
@@ -78,15 +111,14 @@ public class FP_FlashlightSystem : MonoBehaviour
             inertiaRotation = cameraTransform.rotation;
             flashlightPivot.rotation = inertiaRotation;
             angularVelocity = Vector3.zero;
+
+            if (battery != null)
+                SetFlickering(battery.IsLow); // Already low: onLow won't fire again
         }
         else
         {
             // Stop flicker when turning OFF
-            if (flickerCoroutine != null)
-            {
-                StopCoroutine(flickerCoroutine);
-                flickerCoroutine = null;
-            }
+            SetFlickering(false);
         }
 
         Debug.Log("Flashlight toggled: " + flashlightState);
@@ -115,6 +147,10 @@ public class FP_FlashlightSystem : MonoBehaviour
 
     private void HandleBatteryDrain()
     {
+        // The battery drains on its own and reports through its events
+        if (battery != null)
+            return;
+
         if (currentFlashlightBattery <= 0f)
         {
             currentFlashlightBattery = 0f;
@@ -125,23 +161,69 @@ public class FP_FlashlightSystem : MonoBehaviour
         currentFlashlightBattery -= (maxBattery / batteryLifeTimeSeconds) * Time.deltaTime;
         currentFlashlightBattery = Mathf.Clamp(currentFlashlightBattery, 0f, maxBattery);
 
-        // Start flicker when low
-        if (currentFlashlightBattery <= lowBatteryThreshold && flickerCoroutine == null)
+        // Flicker while low, stop when the battery rises above the threshold
+        SetFlickering(currentFlashlightBattery <= lowBatteryThreshold);
+    }
+
+    private bool HasCharge()
+    {
+        return battery != null ? !battery.IsDepleted : currentFlashlightBattery > 0f;
+    }
+
+    // In maxBattery units. Reading the battery is analytical and writes nothing.
+    private float BatteryLevel => battery != null ? battery.Fraction * maxBattery : currentFlashlightBattery;
+
+    private void OnBatteryLow()
+    {
+        if (flashlightState)
+            SetFlickering(true);
+    }
+
+    private void OnBatteryLowCleared() => SetFlickering(false);
+
+    private void OnBatteryDepleted()
+    {
+        if (flashlightState)
+            ToggleFlashlight(); // Out of charge: switches off
+    }
+
+    private void SetLightOn(bool on)
+    {
+        if (budgetedLight != null)
+            budgetedLight.SetOn(on);
+        else
+            flashlightLight.enabled = on;
+    }
+
+    private void SetFlickering(bool flicker)
+    {
+        // Budgeted lights use the manager's seeded noise, no coroutine
+        if (budgetedLight != null)
+        {
+            if (flicker == budgetedFlickering)
+                return;
+
+            budgetedFlickering = flicker;
+            budgetedLight.SetFlicker(flicker ? budgetedFlickerStrength : 0f);
+            return;
+        }
+
+        if (flicker && flickerCoroutine == null)
         {
             flickerCoroutine = StartCoroutine(FlickerRoutine());
         }
-        // Stop flicker when battery rises above threshold
-        else if (currentFlashlightBattery > lowBatteryThreshold && flickerCoroutine != null)
+        else if (!flicker && flickerCoroutine != null)
         {
             StopCoroutine(flickerCoroutine);
             flickerCoroutine = null;
-            flashlightLight.enabled = true;
+            if (flashlightState)
+                flashlightLight.enabled = true;
         }
     }
 
     private IEnumerator FlickerRoutine()
     {
-        while (flashlightState && currentFlashlightBattery > 0f)
+        while (flashlightState && HasCharge())
         {
             float wait = Random.Range(flickerIntervalMin, flickerIntervalMax);
             yield return new WaitForSeconds(wait);
@@ -158,18 +240,34 @@ public class FP_FlashlightSystem : MonoBehaviour
 
     private void HandleDebugText() // Optional Debug Update
     {
-        if (debugBatteryText != null)
-            debugBatteryText.text = $"Flashlight battery: {currentFlashlightBattery:F0}%";
+        if (debugBatteryText == null)
+            return;
+
+        // Only rebuild the string when the shown percentage changes
+        int percent = Mathf.RoundToInt(BatteryLevel);
+        if (percent == shownBatteryPercent)
+            return;
+
+        shownBatteryPercent = percent;
+        debugBatteryText.text = $"Flashlight battery: {percent}%";
     }
 
     public void RechargeBattery(float amount)
     {
-        currentFlashlightBattery += amount;
-        currentFlashlightBattery = Mathf.Clamp(currentFlashlightBattery, 0f, maxBattery);
+        if (battery != null)
+        {
+            // amount is in maxBattery units, spread over the resource's cells
+            battery.Fill(amount / maxBattery * battery.TotalCapacity);
+        }
+        else
+        {
+            currentFlashlightBattery += amount;
+            currentFlashlightBattery = Mathf.Clamp(currentFlashlightBattery, 0f, maxBattery);
+        }
 
         HandleDebugText(); // Optional Debug Update
 
-        Debug.Log($"Flashlight recharged: {currentFlashlightBattery:F0}%");
+        Debug.Log($"Flashlight recharged: {BatteryLevel:F0}%");
     }
 
     public void StartBatteryGradualRecharge(float amount)
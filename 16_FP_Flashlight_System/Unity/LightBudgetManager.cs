@@ -0,0 +1,223 @@
+using System.Collections.Generic;
+using UnityEngine;
+using Stopwatch = System.Diagnostics.Stopwatch;
+
+/* --------------------------------------------------------------------------
+   Shared light budget for flashlights and other dynamic lights.
+
+   • BudgetedLight components register here with a priority; the manager owns every
+     intensity / enabled / shadow write to their Light from then on.
+   • One LateUpdate pass ranks the lights (priority minus distance to the viewer),
+     keeps the best maxActiveLights on and gives shadows to the best maxShadowLights.
+   • Lights that drop out of the budget fade out over fadeTime instead of popping
+     (switching a light on/off with SetOn stays instant). A light fading out still holds
+     its slot, so lights entering the budget wait for it and never exceed maxActiveLights.
+   • Flicker is seeded value noise (LightNoise), so the same seed and time always give
+     the same intensity, and the Light is only written when a value actually changed.
+   • Created on demand by the first BudgetedLight when the scene has none.
+   -------------------------------------------------------------------------- */
+[DefaultExecutionOrder(100)]
+public class LightBudgetManager : MonoBehaviour
+{
+    public static LightBudgetManager Instance { get; private set; }
+
+    [Header("Budget")]
+    [SerializeField] private int maxActiveLights = 16;
+    [SerializeField] private int maxShadowLights = 4;
+    [SerializeField] private float distanceWeight = 1f; // Priority points lost per meter from the viewer
+    [SerializeField] private float fadeTime = 0.35f; // Seconds to fade a light fully in or out
+    [SerializeField] private Transform viewer; // Defaults to Camera.main
+
+    [Header("Flicker")]
+    [SerializeField] private int globalSeed = 1337;
+
+    [Header("Debug")]
+    [SerializeField] private bool logStats = false;
+    [SerializeField] private float logInterval = 2f;
+
+    private readonly List<BudgetedLight> lights = new List<BudgetedLight>();
+    private readonly List<BudgetedLight> ranked = new List<BudgetedLight>();
+    private static readonly System.Comparison<BudgetedLight> ByScore = (a, b) =>
+    {
+        int order = b.score.CompareTo(a.score);
+        return order != 0 ? order : a.id.CompareTo(b.id); // List.Sort is unstable
+    };
+
+    private float flickerTime;
+    private float logTimer;
+    private int nextSeed = 1;
+
+    public int RegisteredCount => lights.Count;
+    public int ActiveCount { get; private set; }   // Lights inside the budget this frame
+    public int VisibleCount { get; private set; }  // Includes lights still fading out
+    public int ShadowCount { get; private set; }
+    public int WritesLastFrame { get; private set; }
+    public double LastUpdateMs { get; private set; }
+
+    public int MaxActiveLights { get => maxActiveLights; set => maxActiveLights = Mathf.Max(0, value); }
+    public int MaxShadowLights { get => maxShadowLights; set => maxShadowLights = Mathf.Max(0, value); }
+    public int GlobalSeed { get => globalSeed; set => globalSeed = value; }
+
+    [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.SubsystemRegistration)]
+    private static void ResetStatics() => Instance = null; // Play mode without domain reload
+
+    public static LightBudgetManager GetOrCreate()
+    {
+        if (Instance == null)
+            new GameObject("LightBudgetManager").AddComponent<LightBudgetManager>();
+        return Instance;
+    }
+
+    private void Awake()
+    {
+        if (Instance != null && Instance != this)
+        {
+            Destroy(this);
+            return;
+        }
+        Instance = this;
+    }
+
+    private void OnDestroy()
+    {
+        if (Instance == this)
+            Instance = null;
+    }
+
+    public void Register(BudgetedLight light)
+    {
+        if (light == null || light.registered)
+            return;
+
+        if (light.Seed == 0)
+            light.Seed = nextSeed++; // Registration order, so a scene spawned the same way flickers the same way
+
+        light.registered = true;
+        lights.Add(light);
+    }
+
+    public void Unregister(BudgetedLight light)
+    {
+        if (light == null || !light.registered)
+            return;
+
+        light.registered = false;
+        lights.Remove(light);
+    }
+
+    // Restarts the flicker clock (e.g. before a replay) so noise reproduces from the beginning
+    public void ResetFlickerTime(float time = 0f) => flickerTime = time;
+
+    private void LateUpdate()
+    {
+        Stopwatch stopwatch = Stopwatch.StartNew();
+
+        flickerTime += Time.deltaTime;
+        Vector3 viewPosition = ResolveViewer();
+
+        ranked.Clear();
+        for (int i = 0; i < lights.Count; i++)
+        {
+            BudgetedLight light = lights[i];
+            light.score = light.IsOn ? light.Priority - Vector3.Distance(viewPosition, light.transform.position) * distanceWeight : float.NegativeInfinity;
+            ranked.Add(light);
+        }
+        ranked.Sort(ByScore);
+
+        // On lights rank first, so the best maxActiveLights of them are ranks 0..maxActiveLights-1.
+        // Slots are held by lights already showing: kept ones and ones still fading out.
+        int occupied = 0;
+        for (int rank = 0; rank < ranked.Count; rank++)
+        {
+            BudgetedLight light = ranked[rank];
+            bool wanted = light.IsOn && rank < maxActiveLights;
+            if (light.fade > 0f && (wanted || !light.snapFade))
+                occupied++;
+        }
+
+        float fadeStep = fadeTime > 0f ? Time.deltaTime / fadeTime : 1f;
+        int active = 0, visible = 0, shadows = 0, writes = 0;
+
+        for (int rank = 0; rank < ranked.Count; rank++)
+        {
+            BudgetedLight light = ranked[rank];
+            bool inBudget = light.IsOn && rank < maxActiveLights;
+            if (inBudget && light.fade <= 0f)
+            {
+                // Entering: waits for a slot freed by a light that finished fading out
+                inBudget = occupied < maxActiveLights;
+                if (inBudget) occupied++;
+            }
+            bool castShadows = inBudget && light.CanCastShadows && shadows < maxShadowLights;
+
+            if (inBudget) active++;
+            if (castShadows) shadows++;
+
+            light.fade = light.snapFade ? (inBudget ? 1f : 0f) : Mathf.MoveTowards(light.fade, inBudget ? 1f : 0f, fadeStep);
+            light.snapFade = false;
+
+            float flicker = 1f;
+            if (light.FlickerStrength > 0f)
+                flicker = 1f - light.FlickerStrength * LightNoise.Sample(globalSeed ^ light.Seed, flickerTime * light.FlickerFrequency);
+
+            float intensity = light.BaseIntensity * light.Level * light.fade * flicker;
+            bool lit = light.fade > 0f && intensity > 0f;
+            if (lit) visible++;
+
+            writes += light.Apply(lit, intensity, castShadows);
+        }
+
+        ActiveCount = active;
+        VisibleCount = visible;
+        ShadowCount = shadows;
+        WritesLastFrame = writes;
+        LastUpdateMs = stopwatch.Elapsed.TotalMilliseconds;
+
+        if (logStats)
+        {
+            logTimer += Time.deltaTime;
+            if (logTimer >= logInterval)
+            {
+                logTimer = 0f;
+                Debug.Log($"[LightBudget] {lights.Count} lights: {ActiveCount} active, {VisibleCount} visible, {ShadowCount} shadowed, " +
+                          $"{WritesLastFrame} writes, {LastUpdateMs:F3} ms");
+            }
+        }
+    }
+
+    private Vector3 ResolveViewer()
+    {
+        if (viewer != null)
+            return viewer.position;
+
+        Camera main = Camera.main;
+        return main != null ? main.transform.position : Vector3.zero;
+    }
+}
+
+// Seeded 1D value noise in [0, 1]. Pure function of (seed, t), so flicker can be replayed exactly.
+public static class LightNoise
+{
+    public static float Sample(int seed, float t)
+    {
+        int i = Mathf.FloorToInt(t);
+        float f = t - i;
+        f = f * f * (3f - 2f * f);
+        return Mathf.Lerp(Value(seed, i), Value(seed, i + 1), f);
+    }
+
+    public static float Value(int seed, int index)
+    {
+        return Hash((uint)seed * 0x9E3779B9u ^ (uint)index) / (float)uint.MaxValue;
+    }
+
+    private static uint Hash(uint x)
+    {
+        x ^= x >> 16;
+        x *= 0x7feb352du;
+        x ^= x >> 15;
+        x *= 0x846ca68bu;
+        x ^= x >> 16;
+        return x;
+    }
+}
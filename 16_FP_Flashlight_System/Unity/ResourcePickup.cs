@@ -0,0 +1,42 @@
+using UnityEngine;
+using UnityEngine.Events;
+
+// Fills a ConsumableResource (e.g. a battery pack for the flashlight). Collected on trigger enter,
+// or by calling Collect() from an interactable's UnityEvent.
+public class ResourcePickup : MonoBehaviour
+{
+    [SerializeField] private float amount = 50f;
+    [SerializeField] private bool fillEmptiestCell = false; // Otherwise tops up the active cell first, then the others
+    [SerializeField] private bool collectOnTrigger = true;
+    [SerializeField] private bool destroyOnCollect = true;
+    [SerializeField] private bool collectWhenFull = false; // Leave the pickup in the world if nothing was accepted
+
+    public UnityEvent onCollected = new UnityEvent();
+
+    public void Collect(ConsumableResource target) => TryCollect(target);
+
+    public bool TryCollect(ConsumableResource target)
+    {
+        if (target == null || !enabled)
+            return false;
+
+        float accepted = fillEmptiestCell ? target.FillCell(target.GetEmptiestCell(), amount) : target.Fill(amount);
+        if (accepted <= 0f && !collectWhenFull)
+            return false;
+
+        onCollected?.Invoke();
+
+        if (destroyOnCollect)
+            Destroy(gameObject);
+        else
+            enabled = false;
+
+        return true;
+    }
+
+    private void OnTriggerEnter(Collider other)
+    {
+        if (collectOnTrigger)
+            TryCollect(other.GetComponentInParent<ConsumableResource>());
+    }
+}
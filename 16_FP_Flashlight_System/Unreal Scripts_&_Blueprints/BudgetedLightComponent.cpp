@@ -0,0 +1,105 @@
+#include "BudgetedLightComponent.h"
+#include "LightBudgetSubsystem.h"
+#include "Components/LightComponent.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+UBudgetedLightComponent::UBudgetedLightComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UBudgetedLightComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    bIsOn = bStartOn;
+
+    if (!Light && GetOwner())
+        SetLight(GetOwner()->FindComponentByClass<ULightComponent>());
+    else
+        RegisterWithBudget();
+
+    if (!Light)
+        UE_LOG(LogTemp, Warning, TEXT("BudgetedLightComponent on %s has no light to drive yet."), *GetNameSafe(GetOwner()));
+}
+
+void UBudgetedLightComponent::RegisterWithBudget()
+{
+    if (!Light || bRegistered || !HasBegunPlay())
+        return;
+
+    if (ULightBudgetSubsystem* Budget = GetWorld()->GetSubsystem<ULightBudgetSubsystem>())
+        Budget->Register(this);
+}
+
+void UBudgetedLightComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (ULightBudgetSubsystem* Budget = World->GetSubsystem<ULightBudgetSubsystem>())
+            Budget->Unregister(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UBudgetedLightComponent::SetLight(ULightComponent* InLight)
+{
+    Light = InLight;
+    if (!Light)
+        return;
+
+    BaseIntensity = Light->Intensity;
+    bAuthoredShadows = Light->CastShadows;
+    bWrittenVisible = Light->IsVisible();
+    bWrittenShadows = Light->CastShadows;
+    WrittenIntensity = -1.f;
+
+    RegisterWithBudget(); // Owners may hand the light over after BeginPlay
+}
+
+void UBudgetedLightComponent::SetOn(bool bOn)
+{
+    if (bIsOn != bOn)
+        bSnapFade = true;
+    bIsOn = bOn;
+}
+
+void UBudgetedLightComponent::SetFlicker(float Strength, float Frequency)
+{
+    FlickerStrength = FMath::Clamp(Strength, 0.f, 1.f);
+    if (Frequency > 0.f)
+        FlickerFrequency = Frequency;
+}
+
+int32 UBudgetedLightComponent::ApplyBudget(bool bLit, float Intensity, bool bCastShadows)
+{
+    int32 Writes = 0;
+
+    if (bLit != bWrittenVisible)
+    {
+        Light->SetVisibility(bLit);
+        bWrittenVisible = bLit;
+        Writes++;
+    }
+
+    if (!bLit)
+        return Writes;
+
+    if (!FMath::IsNearlyEqual(Intensity, WrittenIntensity, 0.001f * FMath::Max(1.f, BaseIntensity)))
+    {
+        Light->SetIntensity(Intensity);
+        WrittenIntensity = Intensity;
+        Writes++;
+    }
+
+    if (bCastShadows != bWrittenShadows)
+    {
+        Light->SetCastShadows(bCastShadows);
+        bWrittenShadows = bCastShadows;
+        Writes++;
+    }
+
+    return Writes;
+}
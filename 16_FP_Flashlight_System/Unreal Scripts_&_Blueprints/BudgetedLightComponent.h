@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "BudgetedLightComponent.generated.h"
+
+class ULightComponent;
+
+/* --------------------------------------------------------------------------
+   Hands a light over to the ULightBudgetSubsystem. Owners (e.g. UFlashlightComponent)
+   drive it through SetOn / SetLevel / SetFlicker instead of writing visibility or
+   intensity themselves. Does not tick; the subsystem updates every light in one pass.
+   -------------------------------------------------------------------------- */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class MECHANICS_TEST_LVN_API UBudgetedLightComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UBudgetedLightComponent();
+
+    // Higher wins. Keep the player's flashlight well above AI lights
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Light Budget")
+    float Priority = 0.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Light Budget")
+    bool bWantsShadows = true;
+
+    UPROPERTY(EditAnywhere, Category="Light Budget")
+    bool bStartOn = true;
+
+    // 0 = assigned from registration order
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Light Budget|Flicker")
+    int32 Seed = 0;
+
+    // 0 = steady, 1 = can dip to black
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Light Budget|Flicker", meta=(ClampMin="0", ClampMax="1"))
+    float FlickerStrength = 0.f;
+
+    // Noise keys per second
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Light Budget|Flicker")
+    float FlickerFrequency = 12.f;
+
+    // Uses the first light component on the owner when not set
+    UFUNCTION(BlueprintCallable, Category="Light Budget")
+    void SetLight(ULightComponent* InLight);
+
+    UFUNCTION(BlueprintPure, Category="Light Budget")
+    ULightComponent* GetLight() const { return Light; }
+
+    UFUNCTION(BlueprintCallable, Category="Light Budget")
+    void SetOn(bool bOn);
+
+    // Output multiplier (0..1) on top of the base intensity, e.g. a dimming battery
+    UFUNCTION(BlueprintCallable, Category="Light Budget")
+    void SetLevel(float Value) { Level = FMath::Clamp(Value, 0.f, 1.f); }
+
+    UFUNCTION(BlueprintCallable, Category="Light Budget")
+    void SetFlicker(float Strength, float Frequency = -1.f);
+
+    UFUNCTION(BlueprintCallable, Category="Light Budget")
+    void SetBaseIntensity(float Intensity) { BaseIntensity = FMath::Max(0.f, Intensity); }
+
+    UFUNCTION(BlueprintPure, Category="Light Budget")
+    bool IsOn() const { return bIsOn; }
+
+    UFUNCTION(BlueprintPure, Category="Light Budget")
+    float GetLevel() const { return Level; }
+
+    UFUNCTION(BlueprintPure, Category="Light Budget")
+    float GetBaseIntensity() const { return BaseIntensity; }
+
+    // 0..1, how much of the light the budget currently lets through
+    UFUNCTION(BlueprintPure, Category="Light Budget")
+    float GetFade() const { return Fade; }
+
+    bool CanCastShadows() const { return bWantsShadows && bAuthoredShadows; }
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+    friend class ULightBudgetSubsystem;
+
+    UPROPERTY()
+    ULightComponent* Light;
+
+    float BaseIntensity = 0.f;
+    float Level = 1.f;
+    bool bIsOn = true;
+    bool bAuthoredShadows = true;
+
+    // Subsystem state
+    bool bRegistered = false;
+    bool bSnapFade = true; // Switching on/off is instant, only budget changes fade
+    float Fade = 0.f;
+    bool bWrittenVisible = false;
+    bool bWrittenShadows = false;
+    float WrittenIntensity = -1.f;
+
+    void RegisterWithBudget();
+
+    // Returns how many light properties were written
+    int32 ApplyBudget(bool bLit, float Intensity, bool bCastShadows);
+};
@@ -0,0 +1,325 @@
+#include "ConsumableResourceComponent.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "JsonObjectConverter.h"
+#include "SaveSchemaRegistry.h"
+
+// Version stamp for FConsumableResourceSaveData. Migrations from v1 go here when the struct changes.
+static const bool GConsumableResourceSaveSchemaRegistered = []
+{
+    FSaveSchemaRegistry::Get().Register(TEXT("FConsumableResourceSaveData"), 1);
+    return true;
+}();
+
+UConsumableResourceComponent::UConsumableResourceComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UConsumableResourceComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (Cells.Num() == 0)
+        Cells.Add(FResourceCell());
+
+    for (FResourceCell& Cell : Cells)
+    {
+        Cell.Capacity = FMath::Max(0.f, Cell.Capacity);
+        Cell.Charge = FMath::Clamp(Cell.Charge, 0.f, Cell.Capacity);
+    }
+
+    ActiveCell = FMath::Max(0, FindChargedCell(0));
+    LastSyncTime = GetNow();
+
+    // Initial state, no events
+    bIsLow = SumCharge() <= LowThreshold * GetTotalCapacity();
+    bIsDepleted = Cells[ActiveCell].Charge <= 0.f;
+}
+
+void UConsumableResourceComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+        World->GetTimerManager().ClearTimer(EventTimer);
+
+    Super::EndPlay(EndPlayReason);
+}
+
+double UConsumableResourceComponent::GetNow() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0;
+}
+
+float UConsumableResourceComponent::GetPendingDrain() const
+{
+    // Drained from the active cell since the last sync. It can't cross a cell or the low threshold, the timer syncs first.
+    if (DrainRate <= 0.f || !Cells.IsValidIndex(ActiveCell))
+        return 0.f;
+
+    return FMath::Clamp(static_cast<float>(GetNow() - LastSyncTime) * DrainRate, 0.f, Cells[ActiveCell].Charge);
+}
+
+void UConsumableResourceComponent::SetOutputLevel(float Level)
+{
+    Sync();
+
+    OutputLevel = FMath::Clamp(Level, 0.f, 1.f);
+    const float Multiplier = DrainCurve ? DrainCurve->GetFloatValue(OutputLevel) : OutputLevel;
+    DrainRate = OutputLevel > 0.f ? DrainPerSecond * FMath::Max(0.f, Multiplier) : 0.f;
+
+    Schedule();
+}
+
+void UConsumableResourceComponent::Sync()
+{
+    const double Now = GetNow();
+    const float Elapsed = static_cast<float>(Now - LastSyncTime);
+    LastSyncTime = Now;
+
+    if (Elapsed > 0.f && DrainRate > 0.f)
+    {
+        const int32 Cell = ActiveCell;
+        const bool bLow = bIsLow;
+        const bool bDepleted = bIsDepleted;
+        Consume(Elapsed * DrainRate);
+
+        // Only an event moves the next wake-up
+        if (Cell != ActiveCell || bLow != bIsLow || bDepleted != bIsDepleted)
+            Schedule();
+    }
+}
+
+void UConsumableResourceComponent::OnEventDue()
+{
+    Sync();
+    Schedule(); // Also covers a wake-up a hair early, before the event
+}
+
+void UConsumableResourceComponent::Drain(float Amount)
+{
+    Sync();
+    if (Amount > 0.f)
+        Consume(Amount);
+    Schedule();
+}
+
+float UConsumableResourceComponent::Fill(float Amount)
+{
+    Sync();
+
+    float Accepted = 0.f;
+    for (int32 i = 0; i < Cells.Num() && Amount > 0.f; ++i)
+    {
+        FResourceCell& Cell = Cells[(ActiveCell + i) % Cells.Num()];
+        const float Added = FMath::Clamp(Amount, 0.f, Cell.Capacity - Cell.Charge);
+        Cell.Charge += Added;
+        Accepted += Added;
+        Amount -= Added;
+    }
+
+    OnFilled(Accepted);
+    return Accepted;
+}
+
+float UConsumableResourceComponent::FillCell(int32 Index, float Amount)
+{
+    if (!Cells.IsValidIndex(Index))
+        return 0.f;
+
+    Sync();
+
+    FResourceCell& Cell = Cells[Index];
+    const float Added = FMath::Clamp(Amount, 0.f, Cell.Capacity - Cell.Charge);
+    Cell.Charge += Added;
+
+    OnFilled(Added);
+    return Added;
+}
+
+bool UConsumableResourceComponent::SwapCell()
+{
+    Sync();
+    const bool bSwapped = TrySwapToChargedCell();
+    RefreshThresholds();
+    Schedule();
+    return bSwapped;
+}
+
+int32 UConsumableResourceComponent::GetEmptiestCell() const
+{
+    int32 Emptiest = 0;
+    for (int32 i = 1; i < Cells.Num(); ++i)
+    {
+        if (GetCellFraction(i) < GetCellFraction(Emptiest))
+            Emptiest = i;
+    }
+    return Emptiest;
+}
+
+float UConsumableResourceComponent::GetTotalCapacity() const
+{
+    float Total = 0.f;
+    for (const FResourceCell& Cell : Cells) Total += Cell.Capacity;
+    return Total;
+}
+
+// A cell without capacity can't take any charge, so it counts as full
+float UConsumableResourceComponent::GetCellFraction(int32 Index) const
+{
+    return Cells[Index].Capacity > 0.f ? GetCellCharge(Index) / Cells[Index].Capacity : 1.f;
+}
+
+float UConsumableResourceComponent::GetTotalCharge() const
+{
+    return SumCharge() - GetPendingDrain();
+}
+
+float UConsumableResourceComponent::GetFraction() const
+{
+    const float Capacity = GetTotalCapacity();
+    return Capacity > 0.f ? GetTotalCharge() / Capacity : 0.f;
+}
+
+float UConsumableResourceComponent::GetCellCharge(int32 Index) const
+{
+    if (!Cells.IsValidIndex(Index))
+        return 0.f;
+
+    return Index == ActiveCell ? Cells[Index].Charge - GetPendingDrain() : Cells[Index].Charge;
+}
+
+float UConsumableResourceComponent::GetTimeRemaining() const
+{
+    return DrainRate > 0.f ? GetTotalCharge() / DrainRate : -1.f;
+}
+
+void UConsumableResourceComponent::Consume(float Amount)
+{
+    while (Amount > 0.f)
+    {
+        FResourceCell& Cell = Cells[ActiveCell];
+        const float Used = FMath::Min(Cell.Charge, Amount);
+        Cell.Charge -= Used;
+        Amount -= Used;
+
+        if (Cell.Charge > 0.f || !bAutoSwapCells || !TrySwapToChargedCell())
+            break;
+    }
+
+    RefreshThresholds();
+}
+
+void UConsumableResourceComponent::OnFilled(float Accepted)
+{
+    if (Accepted <= 0.f)
+        return;
+
+    // A refilled resource resumes from the active cell if it got charge, otherwise the next charged one
+    if (Cells[ActiveCell].Charge <= 0.f)
+        TrySwapToChargedCell();
+
+    OnRefilled.Broadcast();
+    RefreshThresholds();
+    Schedule();
+}
+
+bool UConsumableResourceComponent::TrySwapToChargedCell()
+{
+    const int32 Next = FindChargedCell(ActiveCell + 1);
+    if (Next == INDEX_NONE || Next == ActiveCell)
+        return false;
+
+    ActiveCell = Next;
+    OnCellSwapped.Broadcast(ActiveCell);
+    return true;
+}
+
+int32 UConsumableResourceComponent::FindChargedCell(int32 Start) const
+{
+    for (int32 i = 0; i < Cells.Num(); ++i)
+    {
+        const int32 Index = (Start + i) % Cells.Num();
+        if (Cells[Index].Charge > 0.f)
+            return Index;
+    }
+    return INDEX_NONE;
+}
+
+float UConsumableResourceComponent::SumCharge() const
+{
+    float Total = 0.f;
+    for (const FResourceCell& Cell : Cells) Total += Cell.Charge;
+    return Total;
+}
+
+void UConsumableResourceComponent::RefreshThresholds()
+{
+    const bool bLow = SumCharge() <= LowThreshold * GetTotalCapacity();
+    if (bLow != bIsLow)
+    {
+        bIsLow = bLow;
+        if (bLow) OnLow.Broadcast();
+        else OnLowCleared.Broadcast();
+    }
+
+    const bool bDepleted = Cells[ActiveCell].Charge <= 0.f;
+    if (bDepleted != bIsDepleted)
+    {
+        bIsDepleted = bDepleted;
+        if (bDepleted) OnDepleted.Broadcast();
+    }
+}
+
+void UConsumableResourceComponent::Schedule()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+        return;
+
+    FTimerManager& Timers = World->GetTimerManager();
+    Timers.ClearTimer(EventTimer);
+
+    const float CellCharge = Cells[ActiveCell].Charge;
+    if (DrainRate <= 0.f || CellCharge <= 0.f || !HasBegunPlay())
+        return;
+
+    // Wake up once, exactly when the next event (low threshold or empty cell) is due
+    float UntilEvent = CellCharge / DrainRate;
+    if (!bIsLow)
+        UntilEvent = FMath::Min(UntilEvent, (SumCharge() - LowThreshold * GetTotalCapacity()) / DrainRate);
+
+    Timers.SetTimer(EventTimer, this, &UConsumableResourceComponent::OnEventDue, FMath::Max(0.f, UntilEvent) + 0.001f, false);
+}
+
+FString UConsumableResourceComponent::CaptureState()
+{
+    Sync();
+
+    FConsumableResourceSaveData Data;
+    Data.ActiveCell = ActiveCell;
+    for (const FResourceCell& Cell : Cells)
+        Data.Charges.Add(Cell.Charge);
+
+    FString Json;
+    FJsonObjectConverter::UStructToJsonObjectString(Data, Json);
+    return Json;
+}
+
+void UConsumableResourceComponent::RestoreState(const FString& JsonData)
+{
+    FConsumableResourceSaveData Data;
+    if (!FJsonObjectConverter::JsonObjectStringToUStruct(JsonData, &Data, 0, 0))
+        return;
+
+    const int32 Count = FMath::Min(Data.Charges.Num(), Cells.Num());
+    for (int32 i = 0; i < Count; ++i)
+        Cells[i].Charge = FMath::Clamp(Data.Charges[i], 0.f, Cells[i].Capacity);
+
+    ActiveCell = FMath::Clamp(Data.ActiveCell, 0, Cells.Num() - 1);
+    LastSyncTime = GetNow();
+
+    RefreshThresholds();
+    Schedule();
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveableComponent.h"
+#include "ConsumableResourceComponent.generated.h"
+
+class UCurveFloat;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnResourceEvent);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnResourceCellSwapped, int32, CellIndex);
+
+USTRUCT(BlueprintType)
+struct FResourceCell
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Resource", meta=(ClampMin="0"))
+    float Capacity = 100.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Resource", meta=(ClampMin="0"))
+    float Charge = 100.f;
+};
+
+USTRUCT()
+struct FConsumableResourceSaveData
+{
+    GENERATED_BODY()
+
+    UPROPERTY() TArray<float> Charges;
+    UPROPERTY() int32 ActiveCell = 0;
+};
+
+/* --------------------------------------------------------------------------
+   Generic consumable resource (flashlight batteries, fuel, lamp oil...).
+
+   • One or more cells drained one at a time. When the active cell runs dry the next
+     charged cell is hot-swapped in without interrupting the output (bAutoSwapCells),
+     or the owner swaps manually with SwapCell().
+   • Drain rate = DrainPerSecond * DrainCurve(OutputLevel). Owners set the output
+     level (0 = off) instead of draining every frame.
+   • Drain is analytical: the rate is constant between output changes, so queries read
+     the charge without writing anything, and the state only catches up when the next
+     event (low / cell empty) is due through a single timer, or on a change (fill,
+     drain...). The component never ticks.
+   • IsLow / IsDepleted are the cached states flipped by those events: poll them freely,
+     or bind OnLow / OnLowCleared / OnDepleted.
+   • Pickups (AResourcePickup) fill cells; OnLow / OnDepleted / OnCellSwapped report changes.
+   • Saves cell charges and the active cell through the save system (needs a UGUIDComponent).
+   -------------------------------------------------------------------------- */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class MECHANICS_TEST_LVN_API UConsumableResourceComponent : public USaveableComponent
+{
+    GENERATED_BODY()
+
+public:
+    UConsumableResourceComponent();
+
+    UPROPERTY(EditAnywhere, Category="Resource|Cells")
+    TArray<FResourceCell> Cells = { FResourceCell() };
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Resource|Cells")
+    bool bAutoSwapCells = true;
+
+    // Units per second at full output
+    UPROPERTY(EditAnywhere, Category="Resource|Drain")
+    float DrainPerSecond = 100.f / 30.f;
+
+    // Output level (0..1) -> drain multiplier. Linear when not set
+    UPROPERTY(EditAnywhere, Category="Resource|Drain")
+    UCurveFloat* DrainCurve = nullptr;
+
+    // Fraction of the total capacity
+    UPROPERTY(EditAnywhere, Category="Resource|Thresholds", meta=(ClampMin="0", ClampMax="1"))
+    float LowThreshold = 0.25f;
+
+    UPROPERTY(BlueprintAssignable, Category="Resource")
+    FOnResourceEvent OnLow;
+
+    UPROPERTY(BlueprintAssignable, Category="Resource")
+    FOnResourceEvent OnLowCleared;
+
+    // The active cell is empty and nothing was swapped in
+    UPROPERTY(BlueprintAssignable, Category="Resource")
+    FOnResourceEvent OnDepleted;
+
+    UPROPERTY(BlueprintAssignable, Category="Resource")
+    FOnResourceEvent OnRefilled;
+
+    UPROPERTY(BlueprintAssignable, Category="Resource")
+    FOnResourceCellSwapped OnCellSwapped;
+
+    UFUNCTION(BlueprintCallable, Category="Resource")
+    void SetOutputLevel(float Level);
+
+    // Catches the charge up to now. Called before every change and when the next event is due; queries don't need it
+    UFUNCTION(BlueprintCallable, Category="Resource")
+    void Sync();
+
+    // Immediately removes an amount (e.g. a burst of use), swapping cells as needed
+    UFUNCTION(BlueprintCallable, Category="Resource")
+    void Drain(float Amount);
+
+    // Tops up the active cell first, then the others in order. Returns the amount accepted
+    UFUNCTION(BlueprintCallable, Category="Resource")
+    float Fill(float Amount);
+
+    UFUNCTION(BlueprintCallable, Category="Resource")
+    float FillCell(int32 Index, float Amount);
+
+    // Hot-swaps to the next charged cell without touching the output level
+    UFUNCTION(BlueprintCallable, Category="Resource")
+    bool SwapCell();
+
+    UFUNCTION(BlueprintPure, Category="Resource")
+    int32 GetEmptiestCell() const;
+
+    UFUNCTION(BlueprintPure, Category="Resource")
+    int32 GetActiveCell() const { return ActiveCell; }
+
+    UFUNCTION(BlueprintPure, Category="Resource")
+    float GetOutputLevel() const { return OutputLevel; }
+
+    UFUNCTION(BlueprintPure, Category="Resource")
+    float GetTotalCapacity() const;
+
+    UFUNCTION(BlueprintPure, Category="Resource")
+    float GetTotalCharge() const;
+
+    UFUNCTION(BlueprintPure, Category="Resource")
+    float GetFraction() const;
+
+    UFUNCTION(BlueprintPure, Category="Resource")
+    float GetCellCharge(int32 Index) const;
+
+    UFUNCTION(BlueprintPure, Category="Resource")
+    bool IsLow() const { return bIsLow; }
+
+    UFUNCTION(BlueprintPure, Category="Resource")
+    bool IsDepleted() const { return bIsDepleted; }
+
+    // Seconds until the whole resource is empty at the current output (-1 when not draining)
+    UFUNCTION(BlueprintPure, Category="Resource")
+    float GetTimeRemaining() const;
+
+    // USaveableComponent (the output level belongs to the owner and is not saved)
+    virtual FString CaptureState() override;
+    virtual void RestoreState(const FString& JsonData) override;
+    virtual FString GetSaveDataType() const override { return "FConsumableResourceSaveData"; }
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+    int32 ActiveCell = 0;
+    float OutputLevel = 0.f;
+    float DrainRate = 0.f; // Units per second at the current output level
+    double LastSyncTime = 0.0;
+    bool bIsLow = false;
+    bool bIsDepleted = false;
+
+    FTimerHandle EventTimer;
+
+    double GetNow() const;
+    float GetPendingDrain() const;
+    float GetCellFraction(int32 Index) const;
+    void OnEventDue();
+    void Consume(float Amount);
+    void OnFilled(float Accepted);
+    bool TrySwapToChargedCell();
+    int32 FindChargedCell(int32 Start) const;
+    float SumCharge() const;
+    void RefreshThresholds();
+    void Schedule();
+};
@@ -2,6 +2,8 @@
 #include "Components/SpotLightComponent.h"
 #include "GameFramework/Actor.h"
 #include "Camera/CameraComponent.h"
+#include "BudgetedLightComponent.h"
+#include "ConsumableResourceComponent.h"
 
 UFlashlightComponent::UFlashlightComponent()
 {
@@ -13,32 +15,108 @@ void UFlashlightComponent::ToggleFlashlight()
     if (!Light)
         return;
 
-    if (!bIsOn && CurrentLifetime <= 0.f)
+    if (!bIsOn && !HasCharge())
         return;
 
     bIsOn = !bIsOn;
+    SetLightOn(bIsOn);
 
-    Light->SetVisibility(bIsOn);
-    Light->SetIntensity(bIsOn ? LightIntensity : 0.f);
+    // The resource drains on its own from here on; nothing is subtracted per tick
+    if (Battery)
+        Battery->SetOutputLevel(bIsOn ? 1.f : 0.f);
+
+    // Ticking sleeps while off, so snap the pivot instead of swinging in from a stale rotation
+    if (bIsOn && Pivot && Camera)
+        Pivot->SetWorldRotation(Camera->GetComponentRotation() + FRotator(10.f, 0.f, 0.f));
+
+    RefreshTickEnabled();
+}
+
+bool UFlashlightComponent::HasCharge() const
+{
+    return Battery ? !Battery->IsDepleted() : CurrentLifetime > 0.f;
+}
+
+float UFlashlightComponent::GetBatteryPercent() const
+{
+    // Reading the battery is analytical and writes nothing, so the tick and the UI can poll it
+    if (Battery)
+        return Battery->GetFraction();
+
+    return MaxLifetime > 0.f ? CurrentLifetime / MaxLifetime : 0.f;
+}
+
+bool UFlashlightComponent::IsBatteryLow() const
+{
+    // The battery's cached threshold state, flipped by its own scheduled timer
+    return Battery ? Battery->IsLow() : CurrentLifetime <= LowBatteryThresholdSeconds;
+}
+
+void UFlashlightComponent::AddLifetime(float Seconds)
+{
+    if (Battery)
+    {
+        Battery->Fill(Seconds / MaxLifetime * Battery->GetTotalCapacity());
+        return;
+    }
+
+    CurrentLifetime += Seconds;
+    CurrentLifetime = FMath::Clamp(CurrentLifetime, 0.f, MaxLifetime);
+}
+
+void UFlashlightComponent::OnBatteryDepleted()
+{
+    if (!bIsOn)
+        return;
+
+    bIsOn = false;
+    SetLightOn(false);
+    Battery->SetOutputLevel(0.f);
+    RefreshTickEnabled();
+}
+
+void UFlashlightComponent::SetLightOn(bool bOn)
+{
+    if (Budget)
+    {
+        Budget->SetOn(bOn);
+        return;
+    }
+
+    Light->SetVisibility(bOn);
+    ApplyIntensity(bOn ? LightIntensity : 0.f);
+}
+
+void UFlashlightComponent::ApplyIntensity(float Intensity)
+{
+    // Only touch the render state when the value actually changes
+    if (Intensity == AppliedIntensity)
+        return;
+
+    AppliedIntensity = Intensity;
+    Light->SetIntensity(Intensity);
+}
+
+void UFlashlightComponent::RefreshTickEnabled()
+{
+    // Nothing to drain, recharge, flicker or lag while off
+    SetComponentTickEnabled(bIsOn || bIsRecharging);
 }
 
 void UFlashlightComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-    bRechargeUsedThisFrame = false;
-
-    // Battery drain only when ON
-    if (bIsOn)
+    // Built-in drain only when ON (a battery drains on its own and calls OnBatteryDepleted)
+    if (bIsOn && !Battery)
     {
         CurrentLifetime -= DeltaTime;
         CurrentLifetime = FMath::Clamp(CurrentLifetime, 0.f, MaxLifetime);
 
-        if (CurrentLifetime <= 0.f)
+        if (!HasCharge())
         {
             bIsOn = false;
-            Light->SetVisibility(false);
-            Light->SetIntensity(0.f);
+            SetLightOn(false);
         }
     }
 
@@ -55,36 +133,76 @@ void UFlashlightComponent::TickComponent(float DeltaTime, ELevelTick TickType, F
     LagTick(DeltaTime);
 
     // Debug UI
-    if (GEngine)
-    {
-        float Percent = GetBatteryPercent() * 100.f;
-        FString BatteryText = FString::Printf(TEXT("FLASHLIGHT BATTERY: %.0f%%"), Percent);
-
-        FColor DebugColor;
-
-        if (CurrentLifetime <= LowBatteryThresholdSeconds)
-            DebugColor = FColor::Red;
-        else if (bIsOn)
-            DebugColor = FColor::Yellow;
-        else
-            DebugColor = FColor::White;
-
-        GEngine->AddOnScreenDebugMessage(
-            1,
-            0.f,
-            DebugColor,
-            BatteryText
-        );
-    }
+    UpdateDebugBattery();
+
+    RefreshTickEnabled();
+}
+
+void UFlashlightComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (Battery)
+        Battery->OnDepleted.RemoveDynamic(this, &UFlashlightComponent::OnBatteryDepleted);
+
+    if (GEngine && ShownBatteryPercent != INDEX_NONE)
+        GEngine->RemoveOnScreenDebugMessage(1);
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UFlashlightComponent::UpdateDebugBattery()
+{
+    if (!bShowDebugBattery || !GEngine || MaxLifetime <= 0.f)
+        return;
+
+    const int32 Percent = FMath::RoundToInt(GetBatteryPercent() * 100.f);
+
+    FColor DebugColor;
+
+    if (IsBatteryLow())
+        DebugColor = FColor::Red;
+    else if (bIsOn)
+        DebugColor = FColor::Yellow;
+    else
+        DebugColor = FColor::White;
+
+    if (Percent == ShownBatteryPercent && DebugColor == ShownBatteryColor)
+        return;
+
+    ShownBatteryPercent = Percent;
+    ShownBatteryColor = DebugColor;
+
+    // Keyed messages stay up until replaced, so the text is only rebuilt when it changes
+    GEngine->AddOnScreenDebugMessage(
+        1,
+        1.0e6f,
+        DebugColor,
+        FString::Printf(TEXT("FLASHLIGHT BATTERY: %d%%"), Percent)
+    );
 }
 
 void UFlashlightComponent::InitializeFlashlight(float Intensity, float Radius, float Inner, float Outer)
 {
     Light->SetIntensity(Intensity);
     LightIntensity = Intensity;
+    AppliedIntensity = Intensity;
     Light->SetAttenuationRadius(Radius);
     Light->SetInnerConeAngle(Inner);
     Light->SetOuterConeAngle(Outer);
+
+    if (AActor* Owner = GetOwner())
+    {
+        Camera = Owner->FindComponentByClass<UCameraComponent>();
+        Budget = Owner->FindComponentByClass<UBudgetedLightComponent>();
+    }
+
+    if (Budget)
+    {
+        Budget->SetLight(Light);
+        Budget->SetBaseIntensity(Intensity);
+        Budget->SetOn(bIsOn);
+    }
+
+    RefreshTickEnabled();
 }
 
 void UFlashlightComponent::InitializeBattery(float InMaxLifetime, float InLowBatteryPercent)
@@ -93,20 +211,31 @@ void UFlashlightComponent::InitializeBattery(float InMaxLifetime, float InLowBat
     CurrentLifetime = MaxLifetime;
 
     LowBatteryThresholdSeconds = MaxLifetime * (InLowBatteryPercent / 100.f);
+
+    if (AActor* Owner = GetOwner())
+        Battery = Owner->FindComponentByClass<UConsumableResourceComponent>();
+
+    if (Battery)
+    {
+        Battery->SetOutputLevel(0.f);
+        Battery->OnDepleted.AddUniqueDynamic(this, &UFlashlightComponent::OnBatteryDepleted);
+    }
+
+    UpdateDebugBattery();
 }
 
 void UFlashlightComponent::RechargeInstant(float AmountPercent)
 {
-    if (bRechargeUsedThisFrame || AmountPercent <= 0.f)
+    if (LastInstantRechargeFrame == GFrameCounter || AmountPercent <= 0.f)
         return;
 
     // Convert percent to seconds
     float AmountSeconds = MaxLifetime * (AmountPercent / 100.f);
 
-    CurrentLifetime += AmountSeconds;
-    CurrentLifetime = FMath::Clamp(CurrentLifetime, 0.f, MaxLifetime);
+    AddLifetime(AmountSeconds);
 
-    bRechargeUsedThisFrame = true;
+    LastInstantRechargeFrame = GFrameCounter; // Frame counter rather than a per-tick flag: the component sleeps while off
+    UpdateDebugBattery(); // The component may be asleep while the light is off
 }
 
 void UFlashlightComponent::StartRechargeGradual(float AmountPercent)
@@ -122,6 +251,7 @@ void UFlashlightComponent::StartRechargeGradual(float AmountPercent)
     RechargeAccumulated = 0.f;
 
     bIsRecharging = true;
+    RefreshTickEnabled();
 }
 
 void UFlashlightComponent::RechargeGradualTick(float DeltaTime)
@@ -131,12 +261,11 @@ void UFlashlightComponent::RechargeGradualTick(float DeltaTime)
 
     float DeltaRecharge = RechargeRatePerSecond * DeltaTime;
 
-    CurrentLifetime += DeltaRecharge;
-    CurrentLifetime = FMath::Clamp(CurrentLifetime, 0.f, MaxLifetime);
+    AddLifetime(DeltaRecharge);
 
     RechargeAccumulated += DeltaRecharge;
 
-    if (RechargeAccumulated >= RechargeTargetAmount || CurrentLifetime >= MaxLifetime)
+    if (RechargeAccumulated >= RechargeTargetAmount || GetBatteryPercent() >= 1.f)
     {
         bIsRecharging = false;
     }
@@ -147,9 +276,22 @@ void UFlashlightComponent::FlickerTick(float DeltaTime)
     if (!bIsOn)
         return;
 
-    if (CurrentLifetime > LowBatteryThresholdSeconds)
+    const bool bLowBattery = IsBatteryLow();
+
+    if (Budget)
+    {
+        // The light budget flickers with seeded noise in its batched pass
+        if (bLowBattery != bBudgetFlickering)
+        {
+            bBudgetFlickering = bLowBattery;
+            Budget->SetFlicker(bLowBattery ? BudgetedFlickerStrength : 0.f);
+        }
+        return;
+    }
+
+    if (!bLowBattery)
     {
-        Light->SetIntensity(LightIntensity);
+        ApplyIntensity(LightIntensity);
         return;
     }
 
@@ -161,7 +303,7 @@ void UFlashlightComponent::FlickerTick(float DeltaTime)
 
         float RandomFactor = FMath::FRandRange(FlickerMinIntensity, FlickerMaxIntensity);
 
-        Light->SetIntensity(LightIntensity * RandomFactor);
+        ApplyIntensity(LightIntensity * RandomFactor);
     }
 }
 
@@ -174,7 +316,8 @@ void UFlashlightComponent::LagTick(float DeltaTime)
     if (!Owner)
         return;
 
-    UCameraComponent* Camera = Owner->FindComponentByClass<UCameraComponent>();
+    if (!Camera)
+        Camera = Owner->FindComponentByClass<UCameraComponent>();
     if (!Camera)
         return;
 
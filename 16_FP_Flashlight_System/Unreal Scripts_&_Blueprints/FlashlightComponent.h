@@ -6,6 +6,9 @@
 
 class USpotLightComponent;
 class USceneComponent;
+class UCameraComponent;
+class UBudgetedLightComponent;
+class UConsumableResourceComponent;
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class MECHANICS_TEST_LVN_API UFlashlightComponent : public UActorComponent
@@ -21,11 +24,20 @@ public:
 	UPROPERTY()
 	USpotLightComponent* Light;
 
+	// Optional: when the owner has one, the light budget owns flicker and intensity writes
+	UPROPERTY()
+	UBudgetedLightComponent* Budget;
+
 	float LightIntensity;
 
 	float MaxLifetime; // Total battery life in seconds
 	float CurrentLifetime;
 
+	// Optional: when the owner has one, it replaces the built-in drain (cells, pickups, saving).
+	// It is read on demand and reports depletion through OnDepleted; CurrentLifetime is unused then.
+	UPROPERTY()
+	UConsumableResourceComponent* Battery;
+
 	float LowBatteryThresholdSeconds;
 
 	// Initialization
@@ -52,6 +64,7 @@ public:
 	float FlickerInterval = 0.05f; // how often flicker updates
 	float FlickerMinIntensity = 0.2f; // 20% of normal
 	float FlickerMaxIntensity = 1.0f; // 100% of normal
+	float BudgetedFlickerStrength = 0.8f; // Noise depth used when a Budget is present
 
 	void FlickerTick(float DeltaTime);
 
@@ -63,17 +76,39 @@ public:
 	
 	// Accessor for UI
 	UFUNCTION(BlueprintPure, Category="Flashlight")
-	float GetBatteryPercent() const { return CurrentLifetime / MaxLifetime; }
+	float GetBatteryPercent() const;
 
+	UPROPERTY(EditAnywhere, Category="Flashlight|Debug")
+	bool bShowDebugBattery = true;
 
 private:
 	bool bIsOn = false;
 	bool bIsRecharging = false;
-	bool bRechargeUsedThisFrame = false;
+	uint64 LastInstantRechargeFrame = MAX_uint64;
 	float RechargeTargetAmount = 0.f;
 	float RechargeRatePerSecond = 0.f;
 	float RechargeAccumulated = 0.f;
 
+	float AppliedIntensity = -1.f;
+	bool bBudgetFlickering = false;
+	int32 ShownBatteryPercent = INDEX_NONE;
+	FColor ShownBatteryColor;
+
+	UPROPERTY()
+	UCameraComponent* Camera;
+
+	void SetLightOn(bool bOn);
+	bool HasCharge() const;
+	void AddLifetime(float Seconds);
+	bool IsBatteryLow() const;
+
+	UFUNCTION()
+	void OnBatteryDepleted();
+	void ApplyIntensity(float Intensity);
+	void RefreshTickEnabled();
+	void UpdateDebugBattery();
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 };
 
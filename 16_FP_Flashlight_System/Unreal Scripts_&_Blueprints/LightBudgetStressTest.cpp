@@ -0,0 +1,101 @@
+#include "LightBudgetStressTest.h"
+#include "LightBudgetSubsystem.h"
+#include "BudgetedLightComponent.h"
+#include "Components/SpotLightComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+ALightBudgetStressTest::ALightBudgetStressTest()
+{
+    PrimaryActorTick.bCanEverTick = true;
+    RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+FVector ALightBudgetStressTest::RandomPoint()
+{
+    const float Angle = Random.FRandRange(0.f, 2.f * PI);
+    const float Radius = AreaRadius * FMath::Sqrt(Random.FRand());
+    return GetActorLocation() + FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 0.f);
+}
+
+void ALightBudgetStressTest::BeginPlay()
+{
+    Super::BeginPlay();
+
+    Random.Initialize(Seed);
+
+    FActorSpawnParameters Params;
+    Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    for (int32 i = 0; i < FlashlightCount; ++i)
+    {
+        const FVector Location = RandomPoint() + FVector(0.f, 0.f, 100.f);
+        UClass* Class = HolderClass ? HolderClass.Get() : AActor::StaticClass();
+
+        AActor* Holder = GetWorld()->SpawnActor<AActor>(Class, Location, FRotator::ZeroRotator, Params);
+        if (!Holder)
+            continue;
+
+        if (!Holder->GetRootComponent())
+        {
+            USceneComponent* Root = NewObject<USceneComponent>(Holder, TEXT("Root"));
+            Holder->SetRootComponent(Root);
+            Root->RegisterComponent();
+            Holder->SetActorLocation(Location);
+        }
+
+        if (APawn* Pawn = Cast<APawn>(Holder)) Pawn->SpawnDefaultController();
+
+        USpotLightComponent* Spot = NewObject<USpotLightComponent>(Holder, TEXT("Flashlight"));
+        Spot->SetMobility(EComponentMobility::Movable);
+        Spot->SetupAttachment(Holder->GetRootComponent());
+        Spot->SetRelativeLocationAndRotation(FVector(30.f, 30.f, 40.f), FRotator(-15.f, 0.f, 0.f));
+        Spot->SetIntensity(Intensity);
+        Spot->SetAttenuationRadius(AttenuationRadius);
+        Spot->SetOuterConeAngle(25.f);
+        Spot->SetCastShadows(true);
+        Spot->RegisterComponent();
+
+        UBudgetedLightComponent* Budgeted = NewObject<UBudgetedLightComponent>(Holder, TEXT("BudgetedLight"));
+        Budgeted->Seed = i + 1; // Stable per holder, independent of registration order
+        if (Random.FRand() < FlickeringShare)
+            Budgeted->SetFlicker(0.8f);
+        Budgeted->RegisterComponent();
+        Budgeted->SetLight(Spot);
+
+        Holders.Add({ Holder, RandomPoint() + FVector(0.f, 0.f, 100.f) });
+    }
+}
+
+void ALightBudgetStressTest::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    const float Step = WalkSpeed * DeltaTime;
+    for (FHolder& Holder : Holders)
+    {
+        AActor* Actor = Holder.Actor.Get();
+        if (!Actor) continue;
+
+        const FVector ToTarget = Holder.Target - Actor->GetActorLocation();
+        if (ToTarget.SizeSquared() < FMath::Square(50.f))
+        {
+            Holder.Target = RandomPoint() + FVector(0.f, 0.f, 100.f);
+            continue;
+        }
+
+        Actor->SetActorLocationAndRotation(Actor->GetActorLocation() + ToTarget.GetClampedToMaxSize(Step), ToTarget.Rotation());
+    }
+
+    ReportTimer += DeltaTime;
+    if (ReportTimer < ReportInterval)
+        return;
+
+    ReportTimer = 0.f;
+    if (const ULightBudgetSubsystem* Budget = GetWorld()->GetSubsystem<ULightBudgetSubsystem>())
+    {
+        UE_LOG(LogTemp, Log, TEXT("LightBudgetStressTest: %d flashlights: %d active (max %d), %d visible, %d shadowed (max %d), %d light writes, %.3f ms"),
+            Budget->GetRegisteredCount(), Budget->GetActiveCount(), Budget->MaxActiveLights, Budget->GetVisibleCount(),
+            Budget->GetShadowCount(), Budget->MaxShadowLights, Budget->GetWritesLastFrame(), Budget->GetLastUpdateMs());
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "LightBudgetStressTest.generated.h"
+
+/* --------------------------------------------------------------------------
+   Stress scene helper: spawns AI-held flashlights (spot lights with a
+   UBudgetedLightComponent on wandering holders) and logs how many the
+   ULightBudgetSubsystem keeps lit / shadowed and what its pass costs.
+   Drop it in a dark level and press Play.
+   -------------------------------------------------------------------------- */
+UCLASS()
+class MECHANICS_TEST_LVN_API ALightBudgetStressTest : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    ALightBudgetStressTest();
+
+    UPROPERTY(EditAnywhere, Category="Stress Test", meta=(ClampMin="1"))
+    int32 FlashlightCount = 100;
+
+    // Visual for each holder (e.g. an AI pawn Blueprint). Plain actors are spawned when empty
+    UPROPERTY(EditAnywhere, Category="Stress Test")
+    TSubclassOf<AActor> HolderClass;
+
+    UPROPERTY(EditAnywhere, Category="Stress Test")
+    float AreaRadius = 4000.f;
+
+    UPROPERTY(EditAnywhere, Category="Stress Test")
+    float WalkSpeed = 200.f;
+
+    // Holders with a "low battery"
+    UPROPERTY(EditAnywhere, Category="Stress Test", meta=(ClampMin="0", ClampMax="1"))
+    float FlickeringShare = 0.3f;
+
+    UPROPERTY(EditAnywhere, Category="Stress Test")
+    float Intensity = 5000.f;
+
+    UPROPERTY(EditAnywhere, Category="Stress Test")
+    float AttenuationRadius = 1500.f;
+
+    // Spawn layout and walk targets; the flicker seed lives on the subsystem
+    UPROPERTY(EditAnywhere, Category="Stress Test")
+    int32 Seed = 42;
+
+    UPROPERTY(EditAnywhere, Category="Stress Test")
+    float ReportInterval = 2.f;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void Tick(float DeltaTime) override;
+
+private:
+    struct FHolder
+    {
+        TWeakObjectPtr<AActor> Actor;
+        FVector Target;
+    };
+
+    TArray<FHolder> Holders;
+    FRandomStream Random;
+    float ReportTimer = 0.f;
+
+    FVector RandomPoint();
+};
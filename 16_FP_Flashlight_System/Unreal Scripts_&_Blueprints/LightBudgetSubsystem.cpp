@@ -0,0 +1,166 @@
+#include "LightBudgetSubsystem.h"
+#include "BudgetedLightComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+    uint32 HashNoise(uint32 X)
+    {
+        X ^= X >> 16;
+        X *= 0x7feb352du;
+        X ^= X >> 15;
+        X *= 0x846ca68bu;
+        X ^= X >> 16;
+        return X;
+    }
+
+    float NoiseValue(int32 Seed, int32 Index)
+    {
+        return HashNoise(static_cast<uint32>(Seed) * 0x9E3779B9u ^ static_cast<uint32>(Index)) / static_cast<float>(MAX_uint32);
+    }
+}
+
+float ULightBudgetSubsystem::SampleNoise(int32 Seed, float T)
+{
+    const int32 I = FMath::FloorToInt(T);
+    float F = T - I;
+    F = F * F * (3.f - 2.f * F);
+    return FMath::Lerp(NoiseValue(Seed, I), NoiseValue(Seed, I + 1), F);
+}
+
+void ULightBudgetSubsystem::Deinitialize()
+{
+    Lights.Reset();
+    Ranked.Reset();
+    Super::Deinitialize();
+}
+
+bool ULightBudgetSubsystem::IsTickable() const
+{
+    return !IsTemplate() && Lights.Num() > 0;
+}
+
+TStatId ULightBudgetSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(ULightBudgetSubsystem, STATGROUP_Tickables);
+}
+
+void ULightBudgetSubsystem::Register(UBudgetedLightComponent* Light)
+{
+    if (!Light || Light->bRegistered)
+        return;
+
+    if (Light->Seed == 0)
+        Light->Seed = NextSeed++; // Registration order, so a level spawned the same way flickers the same way
+
+    Light->bRegistered = true;
+    Lights.Add(Light);
+}
+
+void ULightBudgetSubsystem::Unregister(UBudgetedLightComponent* Light)
+{
+    if (!Light || !Light->bRegistered)
+        return;
+
+    Light->bRegistered = false;
+    Lights.RemoveSingleSwap(TWeakObjectPtr<UBudgetedLightComponent>(Light));
+}
+
+FVector ULightBudgetSubsystem::GetViewLocation() const
+{
+    const APlayerController* PC = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
+    return PC && PC->PlayerCameraManager ? PC->PlayerCameraManager->GetCameraLocation() : FVector::ZeroVector;
+}
+
+void ULightBudgetSubsystem::Tick(float DeltaTime)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    FlickerTime += DeltaTime;
+    const FVector ViewLocation = GetViewLocation();
+
+    // Score every light once, then sort (cm -> m for the distance weight)
+    Ranked.Reset();
+    for (int32 i = Lights.Num() - 1; i >= 0; --i)
+    {
+        UBudgetedLightComponent* Light = Lights[i].Get();
+        if (!Light || !Light->GetLight())
+        {
+            Lights.RemoveAtSwap(i);
+            continue;
+        }
+
+        const float Score = Light->IsOn()
+            ? Light->Priority - FVector::Dist(ViewLocation, Light->GetLight()->GetComponentLocation()) * 0.01f * DistanceWeight
+            : -MAX_flt;
+        Ranked.Emplace(Score, Light);
+    }
+    // Lights is reordered by RemoveAtSwap, so equal scores fall back to the unique id
+    Ranked.Sort([](const TPair<float, UBudgetedLightComponent*>& A, const TPair<float, UBudgetedLightComponent*>& B)
+    {
+        return A.Key != B.Key ? A.Key > B.Key : A.Value->GetUniqueID() < B.Value->GetUniqueID();
+    });
+
+    // On lights rank first, so the best MaxActiveLights of them are ranks 0..MaxActiveLights-1.
+    // Slots are held by lights already showing: kept ones and ones still fading out.
+    int32 Occupied = 0;
+    for (int32 Rank = 0; Rank < Ranked.Num(); ++Rank)
+    {
+        const UBudgetedLightComponent* Light = Ranked[Rank].Value;
+        const bool bWanted = Light->IsOn() && Rank < MaxActiveLights;
+        if (Light->Fade > 0.f && (bWanted || !Light->bSnapFade)) Occupied++;
+    }
+
+    const float FadeStep = FadeTime > 0.f ? DeltaTime / FadeTime : 1.f;
+    int32 Active = 0, Visible = 0, Shadows = 0, Writes = 0;
+
+    for (int32 Rank = 0; Rank < Ranked.Num(); ++Rank)
+    {
+        UBudgetedLightComponent* Light = Ranked[Rank].Value;
+        bool bInBudget = Light->IsOn() && Rank < MaxActiveLights;
+        if (bInBudget && Light->Fade <= 0.f)
+        {
+            // Entering: waits for a slot freed by a light that finished fading out
+            bInBudget = Occupied < MaxActiveLights;
+            if (bInBudget) Occupied++;
+        }
+        const bool bCastShadows = bInBudget && Light->CanCastShadows() && Shadows < MaxShadowLights;
+
+        if (bInBudget) Active++;
+        if (bCastShadows) Shadows++;
+
+        const float Target = bInBudget ? 1.f : 0.f;
+        Light->Fade = Light->bSnapFade ? Target : FMath::FInterpConstantTo(Light->Fade, Target, 1.f, FadeStep);
+        Light->bSnapFade = false;
+
+        float Flicker = 1.f;
+        if (Light->FlickerStrength > 0.f)
+            Flicker = 1.f - Light->FlickerStrength * SampleNoise(GlobalSeed ^ Light->Seed, FlickerTime * Light->FlickerFrequency);
+
+        const float Intensity = Light->GetBaseIntensity() * Light->GetLevel() * Light->Fade * Flicker;
+        const bool bLit = Light->Fade > 0.f && Intensity > 0.f;
+        if (bLit) Visible++;
+
+        Writes += Light->ApplyBudget(bLit, Intensity, bCastShadows);
+    }
+
+    ActiveCount = Active;
+    VisibleCount = Visible;
+    ShadowCount = Shadows;
+    WritesLastFrame = Writes;
+    LastUpdateMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+    if (bLogStats)
+    {
+        LogTimer += DeltaTime;
+        if (LogTimer >= 2.f)
+        {
+            LogTimer = 0.f;
+            UE_LOG(LogTemp, Log, TEXT("LightBudget: %d lights: %d active, %d visible, %d shadowed, %d writes, %.3f ms"),
+                Lights.Num(), ActiveCount, VisibleCount, ShadowCount, WritesLastFrame, LastUpdateMs);
+        }
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "LightBudgetSubsystem.generated.h"
+
+class UBudgetedLightComponent;
+
+/* --------------------------------------------------------------------------
+   Shared light budget for flashlights and other dynamic lights.
+
+   • UBudgetedLightComponents register here with a priority; the subsystem owns every
+     visibility / intensity / shadow write to their light from then on.
+   • One batched pass per frame ranks the lights (priority minus distance to the view),
+     keeps the best MaxActiveLights on and lets the best MaxShadowLights cast shadows.
+   • Lights that drop out of the budget fade out over FadeTime instead of popping
+     (switching a light on/off with SetOn stays instant). A light fading out still holds
+     its slot, so lights entering the budget wait for it and never exceed MaxActiveLights.
+   • Flicker is seeded value noise (SampleNoise), so the same seed and time always give
+     the same intensity, and lights are only written when a value actually changed.
+   • Only ticks while something is registered.
+   -------------------------------------------------------------------------- */
+UCLASS()
+class MECHANICS_TEST_LVN_API ULightBudgetSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+    virtual TStatId GetStatId() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+    UPROPERTY(BlueprintReadWrite, Category="Light Budget", meta=(ClampMin="0"))
+    int32 MaxActiveLights = 16;
+
+    UPROPERTY(BlueprintReadWrite, Category="Light Budget", meta=(ClampMin="0"))
+    int32 MaxShadowLights = 4;
+
+    // Priority points lost per meter from the view
+    UPROPERTY(BlueprintReadWrite, Category="Light Budget")
+    float DistanceWeight = 1.f;
+
+    // Seconds to fade a light fully in or out
+    UPROPERTY(BlueprintReadWrite, Category="Light Budget")
+    float FadeTime = 0.35f;
+
+    UPROPERTY(BlueprintReadWrite, Category="Light Budget")
+    int32 GlobalSeed = 1337;
+
+    UPROPERTY(BlueprintReadWrite, Category="Light Budget")
+    bool bLogStats = false;
+
+    void Register(UBudgetedLightComponent* Light);
+    void Unregister(UBudgetedLightComponent* Light);
+
+    // Restarts the flicker clock (e.g. before a replay) so noise reproduces from the beginning
+    UFUNCTION(BlueprintCallable, Category="Light Budget")
+    void ResetFlickerTime(float Time = 0.f) { FlickerTime = Time; }
+
+    UFUNCTION(BlueprintPure, Category="Light Budget")
+    int32 GetRegisteredCount() const { return Lights.Num(); }
+
+    UFUNCTION(BlueprintPure, Category="Light Budget")
+    int32 GetActiveCount() const { return ActiveCount; }
+
+    UFUNCTION(BlueprintPure, Category="Light Budget")
+    int32 GetVisibleCount() const { return VisibleCount; }
+
+    UFUNCTION(BlueprintPure, Category="Light Budget")
+    int32 GetShadowCount() const { return ShadowCount; }
+
+    UFUNCTION(BlueprintPure, Category="Light Budget")
+    int32 GetWritesLastFrame() const { return WritesLastFrame; }
+
+    UFUNCTION(BlueprintPure, Category="Light Budget")
+    float GetLastUpdateMs() const { return LastUpdateMs; }
+
+    // Seeded 1D value noise in [0, 1]. Pure function of (Seed, T).
+    static float SampleNoise(int32 Seed, float T);
+
+private:
+    TArray<TWeakObjectPtr<UBudgetedLightComponent>> Lights;
+    TArray<TPair<float, UBudgetedLightComponent*>> Ranked;
+
+    float FlickerTime = 0.f;
+    float LogTimer = 0.f;
+    int32 NextSeed = 1;
+
+    int32 ActiveCount = 0;
+    int32 VisibleCount = 0;
+    int32 ShadowCount = 0;
+    int32 WritesLastFrame = 0;
+    float LastUpdateMs = 0.f;
+
+    FVector GetViewLocation() const;
+};
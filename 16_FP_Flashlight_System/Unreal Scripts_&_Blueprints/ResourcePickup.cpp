@@ -0,0 +1,47 @@
+#include "ResourcePickup.h"
+#include "ConsumableResourceComponent.h"
+#include "Components/SphereComponent.h"
+
+AResourcePickup::AResourcePickup()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    Trigger = CreateDefaultSubobject<USphereComponent>(TEXT("Trigger"));
+    Trigger->InitSphereRadius(50.f);
+    Trigger->SetCollisionProfileName(TEXT("OverlapAllDynamic"));
+    RootComponent = Trigger;
+}
+
+void AResourcePickup::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (bCollectOnOverlap)
+        Trigger->OnComponentBeginOverlap.AddDynamic(this, &AResourcePickup::OnTriggerBeginOverlap);
+}
+
+bool AResourcePickup::Collect(UConsumableResourceComponent* Target)
+{
+    if (!Target || bCollected)
+        return false;
+
+    const float Accepted = bFillEmptiestCell ? Target->FillCell(Target->GetEmptiestCell(), Amount) : Target->Fill(Amount);
+    if (Accepted <= 0.f && !bCollectWhenFull)
+        return false;
+
+    bCollected = true;
+    OnCollected.Broadcast();
+
+    if (bDestroyOnCollect)
+        Destroy();
+    else
+        SetActorEnableCollision(false);
+
+    return true;
+}
+
+void AResourcePickup::OnTriggerBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+    if (OtherActor && OtherActor != this)
+        Collect(OtherActor->FindComponentByClass<UConsumableResourceComponent>());
+}
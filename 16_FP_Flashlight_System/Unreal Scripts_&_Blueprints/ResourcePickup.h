@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "ResourcePickup.generated.h"
+
+class USphereComponent;
+class UConsumableResourceComponent;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnResourcePickupCollected);
+
+// Fills a UConsumableResourceComponent (e.g. a battery pack for the flashlight). Collected on
+// overlap, or by calling Collect() from an interactable.
+UCLASS()
+class MECHANICS_TEST_LVN_API AResourcePickup : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AResourcePickup();
+
+    UPROPERTY(VisibleAnywhere, Category="Pickup")
+    USphereComponent* Trigger;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Pickup")
+    float Amount = 50.f;
+
+    // Otherwise tops up the active cell first, then the others
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Pickup")
+    bool bFillEmptiestCell = false;
+
+    UPROPERTY(EditAnywhere, Category="Pickup")
+    bool bCollectOnOverlap = true;
+
+    UPROPERTY(EditAnywhere, Category="Pickup")
+    bool bDestroyOnCollect = true;
+
+    // Leave the pickup in the world if nothing was accepted
+    UPROPERTY(EditAnywhere, Category="Pickup")
+    bool bCollectWhenFull = false;
+
+    UPROPERTY(BlueprintAssignable, Category="Pickup")
+    FOnResourcePickupCollected OnCollected;
+
+    UFUNCTION(BlueprintCallable, Category="Pickup")
+    bool Collect(UConsumableResourceComponent* Target);
+
+protected:
+    virtual void BeginPlay() override;
+
+private:
+    bool bCollected = false;
+
+    UFUNCTION()
+    void OnTriggerBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+};
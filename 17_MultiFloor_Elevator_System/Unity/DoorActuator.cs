@@ -0,0 +1,252 @@
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+using UnityEngine.Events;
+
+/* --------------------------------------------------------------------------
+   Curve-driven door / actuator for one or more leaves (sliding or hinged).
+
+   • Progress runs 0 (closed) -> 1 (open) and the curve maps it to the leaf pose, so
+     Open() / Close() can reverse the motion at any point without a jump.
+   • While closing, an optional obstruction box reopens the doors, holds them and retries.
+   • Raises onOpened / onClosed at the fully open / closed keyframes.
+   • Sleeps when idle: the component disables itself, or, with tickedByOwner, the owner
+     only calls Tick() while IsAwake is true (e.g. from its own Update).
+   -------------------------------------------------------------------------- */
+public class DoorActuator : MonoBehaviour
+{
+    public enum LeafMode { Sliding, Hinged }
+
+    [Serializable]
+    public class Leaf
+    {
+        public Transform transform;
+        public LeafMode mode = LeafMode.Sliding;
+        public Vector3 openOffset = Vector3.right; // Sliding: local offset when fully open
+        public Vector3 hingeAxis = Vector3.up;      // Hinged: local axis
+        public float openAngle = 90f;               // Hinged: degrees when fully open
+
+        [NonSerialized] public Vector3 closedPosition;
+        [NonSerialized] public Quaternion closedRotation;
+        [NonSerialized] public bool captured;
+    }
+
+    [Header("Leaves")]
+    [SerializeField] private List<Leaf> leaves = new List<Leaf>();
+
+    [Header("Motion")]
+    [SerializeField] private float openDuration = 0.5f;
+    [SerializeField] private float closeDuration = 0.5f;
+    [SerializeField] private AnimationCurve curve = AnimationCurve.EaseInOut(0f, 0f, 1f, 1f);
+    [SerializeField] private bool startOpen = false;
+    [SerializeField] private bool tickedByOwner = false; // When true, Update does nothing and the owner calls Tick()
+
+    [Header("Obstruction")]
+    [Tooltip("Anything overlapping it while closing reopens the doors. Only its size and pose are read, so it can stay disabled.")]
+    [SerializeField] private BoxCollider obstructionVolume;
+    [SerializeField] private LayerMask obstructionMask = ~0;
+    [SerializeField] private float reopenHoldTime = 1f; // Time held open after an obstruction before closing again
+
+    [Header("Events")]
+    public UnityEvent onOpened = new UnityEvent();
+    public UnityEvent onClosed = new UnityEvent();
+    public UnityEvent onObstructed = new UnityEvent();
+
+    private float progress;
+    private int direction; // +1 opening, -1 closing, 0 idle
+    private float holdTimer;
+    private bool reopenedByObstruction;
+    private readonly Collider[] overlapBuffer = new Collider[8];
+
+    public float Progress => progress;
+    public bool IsMoving => direction != 0;
+    public bool IsOpening => direction > 0;
+    public bool IsClosing => direction < 0;
+    public bool IsOpen => direction == 0 && progress >= 1f;
+    public bool IsClosed => direction == 0 && progress <= 0f && holdTimer <= 0f;
+    public bool IsHoldingOpen => holdTimer > 0f; // Reopened by an obstruction, will close again on its own
+    public bool IsAwake => direction != 0 || holdTimer > 0f;
+    public bool HasLeaves => leaves.Count > 0;
+
+    public BoxCollider ObstructionVolume
+    {
+        get => obstructionVolume;
+        set => obstructionVolume = value;
+    }
+
+    public bool TickedByOwner
+    {
+        get => tickedByOwner;
+        set { tickedByOwner = value; RefreshSleep(); }
+    }
+
+    private void Awake()
+    {
+        CaptureLeaves();
+        progress = startOpen ? 1f : 0f;
+        Apply();
+        RefreshSleep();
+    }
+
+    private void Update()
+    {
+        if (!tickedByOwner)
+            Tick(Time.deltaTime);
+    }
+
+    public void AddLeaf(Transform leafTransform, LeafMode mode, Vector3 openOffset, float openAngle = 90f)
+    {
+        var leaf = new Leaf { transform = leafTransform, mode = mode, openOffset = openOffset, openAngle = openAngle };
+        leaves.Add(leaf);
+        Capture(leaf);
+    }
+
+    public void Configure(float duration, AnimationCurve motionCurve)
+    {
+        openDuration = closeDuration = duration;
+        if (motionCurve != null)
+            curve = motionCurve;
+    }
+
+    public void Open()
+    {
+        holdTimer = 0f;
+        reopenedByObstruction = false;
+        SetDirection(progress >= 1f ? 0 : 1);
+    }
+
+    public void Close()
+    {
+        holdTimer = 0f;
+        reopenedByObstruction = false;
+        SetDirection(progress <= 0f ? 0 : -1);
+    }
+
+    public void Toggle()
+    {
+        if (direction > 0 || (direction == 0 && progress >= 1f)) Close();
+        else Open();
+    }
+
+    public void SetOpenInstant(bool open)
+    {
+        holdTimer = 0f;
+        progress = open ? 1f : 0f;
+        direction = 0;
+        Apply();
+        RefreshSleep();
+    }
+
+    public void Tick(float deltaTime)
+    {
+        if (holdTimer > 0f)
+        {
+            holdTimer -= deltaTime;
+            if (holdTimer <= 0f)
+            {
+                holdTimer = 0f;
+                SetDirection(-1);
+            }
+            return;
+        }
+
+        if (direction == 0)
+        {
+            RefreshSleep();
+            return;
+        }
+
+        if (direction < 0 && IsObstructed())
+        {
+            direction = 1;
+            reopenedByObstruction = true;
+            onObstructed?.Invoke();
+        }
+
+        float duration = direction > 0 ? openDuration : closeDuration;
+        progress = duration > 0f ? Mathf.Clamp01(progress + direction * deltaTime / duration) : (direction > 0 ? 1f : 0f);
+        Apply();
+
+        if (direction > 0 && progress >= 1f)
+        {
+            direction = 0;
+            if (reopenedByObstruction)
+            {
+                reopenedByObstruction = false;
+                holdTimer = Mathf.Max(0.0001f, reopenHoldTime);
+            }
+            onOpened?.Invoke();
+        }
+        else if (direction < 0 && progress <= 0f)
+        {
+            direction = 0;
+            onClosed?.Invoke();
+        }
+
+        RefreshSleep();
+    }
+
+    private bool IsObstructed()
+    {
+        if (obstructionVolume == null)
+            return false;
+
+        Transform box = obstructionVolume.transform;
+        Vector3 center = box.TransformPoint(obstructionVolume.center);
+        Vector3 halfExtents = Vector3.Scale(obstructionVolume.size * 0.5f, box.lossyScale);
+
+        int count = Physics.OverlapBoxNonAlloc(center, halfExtents, overlapBuffer, box.rotation, obstructionMask, QueryTriggerInteraction.Ignore);
+        for (int i = 0; i < count; i++)
+        {
+            Collider other = overlapBuffer[i];
+            if (other != obstructionVolume && !other.transform.IsChildOf(transform))
+                return true;
+        }
+        return false;
+    }
+
+    private void SetDirection(int newDirection)
+    {
+        direction = newDirection;
+        RefreshSleep();
+    }
+
+    private void RefreshSleep()
+    {
+        // Own-tick mode sleeps by disabling the component; owner-ticked mode is gated by IsAwake
+        enabled = tickedByOwner || IsAwake;
+    }
+
+    private void Apply()
+    {
+        float alpha = curve != null ? curve.Evaluate(progress) : progress;
+
+        for (int i = 0; i < leaves.Count; i++)
+        {
+            Leaf leaf = leaves[i];
+            if (leaf.transform == null)
+                continue;
+
+            if (leaf.mode == LeafMode.Sliding)
+                leaf.transform.localPosition = leaf.closedPosition + leaf.openOffset * alpha;
+            else
+                leaf.transform.localRotation = leaf.closedRotation * Quaternion.AngleAxis(leaf.openAngle * alpha, leaf.hingeAxis);
+        }
+    }
+
+    private void CaptureLeaves()
+    {
+        foreach (Leaf leaf in leaves)
+            Capture(leaf);
+    }
+
+    private static void Capture(Leaf leaf)
+    {
+        if (leaf.captured || leaf.transform == null)
+            return;
+
+        leaf.closedPosition = leaf.transform.localPosition;
+        leaf.closedRotation = leaf.transform.localRotation;
+        leaf.captured = true;
+    }
+}
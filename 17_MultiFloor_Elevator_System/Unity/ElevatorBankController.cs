@@ -0,0 +1,144 @@
+using UnityEngine;
+using UnityEngine.Events;
+
+/* --------------------------------------------------------------------------
+   Coordinates several ElevatorScript cars sharing the same floors.
+   Hall calls (CallUp / CallDown) are assigned by ElevatorBankLogic's cost function and every
+   car runs LOOK scheduling. Cars registered here forward their own CallElevator / MoveToFloor
+   button events to the bank, so existing panel buttons keep working.
+   -------------------------------------------------------------------------- */
+public class ElevatorBankController : MonoBehaviour
+{
+    [Header("Cars")]
+    [SerializeField] private ElevatorScript[] cars; // All cars must share the same floor list
+    [SerializeField] private int carCapacity = 8; // Occupants (any collider in the cabin trigger) before a car stops taking hall calls
+    [SerializeField] private float doorDwellTime = 3f; // Time the doors stay open at a stop before the car leaves
+
+    [Header("Dispatch Cost")]
+    [SerializeField] private float estimatedSecondsPerFloor = 3f; // Should roughly match the cars' travelTime
+    [SerializeField] private float fullCarPenalty = 600f;
+    [SerializeField] private float loadPenalty = 4f;
+
+    [Header("Events")]
+    public UnityEvent<int> onHallCallAssigned = new UnityEvent<int>(); // Car index
+
+    private ElevatorBankLogic logic;
+    private float[] dwellTimers;
+    private bool[] travelling;
+
+    public ElevatorBankLogic Logic => logic;
+
+    private void Awake()
+    {
+        int floorCount = 0;
+        foreach (ElevatorScript car in cars)
+        {
+            if (car != null)
+                floorCount = Mathf.Max(floorCount, car.FloorCount);
+        }
+
+        logic = new ElevatorBankLogic(floorCount, cars.Length, carCapacity)
+        {
+            FloorsPerSecond = 1f / Mathf.Max(0.01f, estimatedSecondsPerFloor),
+            DoorCycleSeconds = doorDwellTime,
+            FullCarPenalty = fullCarPenalty,
+            LoadPenalty = loadPenalty
+        };
+
+        dwellTimers = new float[cars.Length];
+        travelling = new bool[cars.Length];
+
+        for (int i = 0; i < cars.Length; i++)
+        {
+            if (cars[i] == null)
+                continue;
+
+            int index = i;
+            cars[i].Bank = this;
+            cars[i].onArrivedAtFloor.AddListener(floor => HandleArrival(index, floor));
+        }
+    }
+
+    private void Update()
+    {
+        for (int i = 0; i < cars.Length; i++)
+        {
+            ElevatorScript car = cars[i];
+            if (car == null)
+                continue;
+
+            ElevatorBankLogic.Car state = logic.Cars[i];
+            state.Position = car.FloorPosition;
+            state.Load = car.OccupantCount;
+            state.DoorsOpen = car.DoorsOpen;
+
+            if (travelling[i])
+            {
+                // LOOK: stop on the way if a closer call appeared ahead of the car
+                int ahead = logic.GetNextStop(i);
+                if (ahead >= 0 && ahead != car.TripDestination && IsAhead(car, ahead))
+                    car.RetargetTrip(ahead);
+                continue;
+            }
+
+            if (dwellTimers[i] > 0f)
+            {
+                dwellTimers[i] -= Time.deltaTime;
+                continue;
+            }
+
+            if (!car.IsIdle)
+                continue;
+
+            int next = logic.GetNextStop(i);
+            if (next < 0)
+                continue;
+
+            if (next == car.CurrentFloor)
+            {
+                HandleArrival(i, next);
+                car.OpenDoors();
+                continue;
+            }
+
+            travelling[i] = true;
+            state.Moving = true;
+            car.StartTrip(next);
+        }
+    }
+
+    // Hall call buttons
+    public void CallUp(int floorIndex) => CallElevator(floorIndex, true);
+    public void CallDown(int floorIndex) => CallElevator(floorIndex, false);
+
+    // Single-button callers: everything goes up except from the top floor
+    public void CallElevator(int floorIndex) => CallElevator(floorIndex, floorIndex < logic.FloorCount - 1);
+
+    public int CallElevator(int floorIndex, bool goingUp)
+    {
+        int car = logic.RequestHallCall(floorIndex, goingUp ? HallCallDirection.Up : HallCallDirection.Down);
+        if (car >= 0)
+            onHallCallAssigned?.Invoke(car);
+
+        return car;
+    }
+
+    // Car (panel) calls
+    public void RequestFloor(int carIndex, int floorIndex) => logic.RequestCarCall(carIndex, floorIndex);
+    public void RequestFloor(ElevatorScript car, int floorIndex) => logic.RequestCarCall(System.Array.IndexOf(cars, car), floorIndex);
+
+    private void HandleArrival(int carIndex, int floor)
+    {
+        travelling[carIndex] = false;
+        logic.NotifyArrived(carIndex, floor);
+        dwellTimers[carIndex] = doorDwellTime;
+    }
+
+    private static bool IsAhead(ElevatorScript car, int floor)
+    {
+        float position = car.FloorPosition;
+        return car.TripDestination > position
+            ? floor > position + 0.5f && floor < car.TripDestination
+            : floor < position - 0.5f && floor > car.TripDestination;
+    }
+}
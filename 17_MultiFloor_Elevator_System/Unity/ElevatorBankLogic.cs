@@ -0,0 +1,330 @@
+using System;
+
+public enum HallCallDirection { Up, Down }
+public enum CarDirection { Idle, Up, Down }
+
+/* --------------------------------------------------------------------------
+   Engine-free dispatcher for a bank of elevator cars.
+
+   • Hall calls (floor + direction) are assigned to the car with the lowest estimated cost
+     (distance, travel direction, pending stops, load and door state).
+   • Each car runs LOOK scheduling: it keeps going in its direction while there are car calls or
+     same-direction hall calls ahead, then picks up the farthest opposite-direction call and turns.
+   • Up and down hall calls are stored separately, so a car going up never serves a "down" call
+     on its way past that floor.
+   • A hall call pressed again while its car is full or out of service goes back through the cost
+     function, so passengers left behind get another car.
+
+   Used by ElevatorBankController (driving ElevatorScript cars) and ElevatorBankSimulator (headless).
+   -------------------------------------------------------------------------- */
+public class ElevatorBankLogic
+{
+    public class Car
+    {
+        public float Position;        // In floors (fractional while moving)
+        public bool Moving;
+        public bool DoorsOpen;
+        public CarDirection Direction = CarDirection.Idle;
+        public int Load;
+        public int Capacity;
+        public bool OutOfService;     // Gets no hall calls, see SetOutOfService
+
+        public readonly bool[] CarCalls;
+        public readonly bool[] UpCalls;   // Hall calls assigned to this car
+        public readonly bool[] DownCalls;
+
+        public Car(int floorCount, int capacity)
+        {
+            Capacity = capacity;
+            CarCalls = new bool[floorCount];
+            UpCalls = new bool[floorCount];
+            DownCalls = new bool[floorCount];
+        }
+
+        public bool IsFull => Load >= Capacity;
+    }
+
+    // Cost tuning (all costs are expressed in estimated seconds)
+    public float FloorsPerSecond = 0.5f;
+    public float DoorCycleSeconds = 4f;     // Door open + dwell + close per stop
+    public float FullCarPenalty = 600f;
+    public float LoadPenalty = 4f;          // Scaled by Load / Capacity
+
+    public readonly Car[] Cars;
+    public readonly int FloorCount;
+
+    private readonly int[] upAssignment;    // Car serving each up hall call (-1 when none)
+    private readonly int[] downAssignment;
+
+    public ElevatorBankLogic(int floorCount, int carCount, int capacity)
+    {
+        FloorCount = floorCount;
+        Cars = new Car[carCount];
+        for (int i = 0; i < carCount; i++)
+            Cars[i] = new Car(floorCount, capacity);
+
+        upAssignment = new int[floorCount];
+        downAssignment = new int[floorCount];
+        for (int f = 0; f < floorCount; f++) { upAssignment[f] = -1; downAssignment[f] = -1; }
+    }
+
+    // Assigns a hall call and returns the chosen car index. A call that already has a car keeps it,
+    // unless that car is full or out of service: then the call is assigned again.
+    public int RequestHallCall(int floor, HallCallDirection dir)
+    {
+        if (floor < 0 || floor >= FloorCount || Cars.Length == 0)
+            return -1;
+
+        int[] assignment = dir == HallCallDirection.Up ? upAssignment : downAssignment;
+        int current = assignment[floor];
+        if (current >= 0 && !Cars[current].IsFull && !Cars[current].OutOfService)
+            return current;
+
+        int best = -1;
+        float bestCost = float.MaxValue;
+        for (int i = 0; i < Cars.Length; i++)
+        {
+            if (Cars[i].OutOfService)
+                continue;
+
+            float cost = EstimateCost(Cars[i], floor, dir);
+            if (cost < bestCost) { bestCost = cost; best = i; }
+        }
+
+        if (best < 0 || best == current)
+            return current; // No car in service, or the full one is still the cheapest
+
+        if (current >= 0)
+            ClearHallCall(current, floor, dir);
+
+        assignment[floor] = best;
+        if (dir == HallCallDirection.Up) Cars[best].UpCalls[floor] = true;
+        else Cars[best].DownCalls[floor] = true;
+        return best;
+    }
+
+    // Takes a car out of dispatch (or puts it back). Its hall calls go to the other cars, its car calls stay.
+    public void SetOutOfService(int carIndex, bool outOfService)
+    {
+        if (carIndex < 0 || carIndex >= Cars.Length)
+            return;
+
+        Car car = Cars[carIndex];
+        car.OutOfService = outOfService;
+        if (!outOfService)
+            return;
+
+        for (int f = 0; f < FloorCount; f++)
+        {
+            if (car.UpCalls[f]) RequestHallCall(f, HallCallDirection.Up);
+            if (car.DownCalls[f]) RequestHallCall(f, HallCallDirection.Down);
+        }
+    }
+
+    public void RequestCarCall(int car, int floor)
+    {
+        if (car < 0 || car >= Cars.Length || floor < 0 || floor >= FloorCount)
+            return;
+
+        Cars[car].CarCalls[floor] = true;
+    }
+
+    public float EstimateCost(Car car, int floor, HallCallDirection dir)
+    {
+        float distance = Math.Abs(car.Position - floor);
+        bool callUp = dir == HallCallDirection.Up;
+        float minAhead = car.Moving ? 0.5f : 0f; // A moving car can't stop at the floor it is passing
+
+        float travelFloors;
+        if (car.Direction == CarDirection.Idle)
+        {
+            travelFloors = distance;
+        }
+        else if (car.Direction == CarDirection.Up && callUp && floor - car.Position >= minAhead)
+        {
+            travelFloors = distance; // On the way
+        }
+        else if (car.Direction == CarDirection.Down && !callUp && car.Position - floor >= minAhead)
+        {
+            travelFloors = distance; // On the way
+        }
+        else
+        {
+            // Finish the current sweep, then come back
+            int extreme = car.Direction == CarDirection.Up ? HighestStop(car) : LowestStop(car);
+            if (extreme < 0) extreme = (int)Math.Round(car.Position);
+            travelFloors = Math.Abs(car.Position - extreme) + Math.Abs(extreme - floor);
+        }
+
+        float cost = travelFloors / Math.Max(0.01f, FloorsPerSecond);
+        cost += CountStops(car) * DoorCycleSeconds;
+        cost += LoadPenalty * car.Load / Math.Max(1, car.Capacity);
+
+        if (car.DoorsOpen)
+            cost += DoorCycleSeconds * 0.5f; // Has to finish its dwell first
+
+        if (car.IsFull)
+            cost += FullCarPenalty;
+
+        return cost;
+    }
+
+    // LOOK: next floor the car should travel to, -1 when it has nothing to do.
+    // Also updates the car direction when it starts a new sweep.
+    public int GetNextStop(int carIndex)
+    {
+        Car car = Cars[carIndex];
+        int p = (int)Math.Round(car.Position);
+
+        // Requests at the floor the car is standing on are served first (a full car skips hall calls)
+        bool hall = !car.IsFull;
+        if (!car.Moving && (car.CarCalls[p]
+            || (hall && car.Direction != CarDirection.Down && car.UpCalls[p])
+            || (hall && car.Direction != CarDirection.Up && car.DownCalls[p])))
+            return p;
+
+        int up = NextStopUp(car, p);
+        int down = NextStopDown(car, p);
+
+        switch (car.Direction)
+        {
+            case CarDirection.Up:
+                if (up >= 0) return up;
+                break;
+            case CarDirection.Down:
+                if (down >= 0) return down;
+                break;
+            default:
+                // Idle: nearest stop
+                if (up >= 0 && (down < 0 || up - p <= p - down)) { car.Direction = CarDirection.Up; return up; }
+                if (down >= 0) { car.Direction = CarDirection.Down; return down; }
+                break;
+        }
+
+        // Nothing left in the current direction: turn around
+        if (car.Direction == CarDirection.Up && down >= 0) { car.Direction = CarDirection.Down; return down; }
+        if (car.Direction == CarDirection.Down && up >= 0) { car.Direction = CarDirection.Up; return up; }
+
+        if (hall && (car.UpCalls[p] || car.DownCalls[p]))
+            return p;
+
+        car.Direction = CarDirection.Idle;
+        return -1;
+    }
+
+    // Call when the car stops at a floor. Decides the leaving direction and clears the calls served here.
+    // Returns the direction passengers waiting at this floor can board for (Idle = any).
+    public CarDirection NotifyArrived(int carIndex, int floor)
+    {
+        Car car = Cars[carIndex];
+        car.Position = floor;
+        car.Moving = false;
+
+        bool above = HasStopsAbove(car, floor);
+        bool below = HasStopsBelow(car, floor);
+
+        switch (car.Direction)
+        {
+            case CarDirection.Up:
+                if (!above && !car.UpCalls[floor])
+                    car.Direction = car.DownCalls[floor] || below ? CarDirection.Down : CarDirection.Idle;
+                break;
+            case CarDirection.Down:
+                if (!below && !car.DownCalls[floor])
+                    car.Direction = car.UpCalls[floor] || above ? CarDirection.Up : CarDirection.Idle;
+                break;
+            default:
+                if (car.UpCalls[floor]) car.Direction = CarDirection.Up;
+                else if (car.DownCalls[floor]) car.Direction = CarDirection.Down;
+                else if (above) car.Direction = CarDirection.Up;
+                else if (below) car.Direction = CarDirection.Down;
+                break;
+        }
+
+        car.CarCalls[floor] = false;
+
+        if (car.Direction != CarDirection.Down) ClearHallCall(carIndex, floor, HallCallDirection.Up);
+        if (car.Direction != CarDirection.Up) ClearHallCall(carIndex, floor, HallCallDirection.Down);
+
+        return car.Direction;
+    }
+
+    public bool HasPendingStops(int carIndex) => CountStops(Cars[carIndex]) > 0;
+
+    private void ClearHallCall(int carIndex, int floor, HallCallDirection dir)
+    {
+        Car car = Cars[carIndex];
+        if (dir == HallCallDirection.Up)
+        {
+            car.UpCalls[floor] = false;
+            if (upAssignment[floor] == carIndex) upAssignment[floor] = -1;
+        }
+        else
+        {
+            car.DownCalls[floor] = false;
+            if (downAssignment[floor] == carIndex) downAssignment[floor] = -1;
+        }
+    }
+
+    private int NextStopUp(Car car, int p)
+    {
+        bool hall = !car.IsFull;
+        for (int f = p + 1; f < FloorCount; f++)
+            if (car.CarCalls[f] || (hall && car.UpCalls[f])) return f;
+
+        // Highest down call above: go up to it and turn there
+        for (int f = FloorCount - 1; f > p && hall; f--)
+            if (car.DownCalls[f]) return f;
+
+        return -1;
+    }
+
+    private int NextStopDown(Car car, int p)
+    {
+        bool hall = !car.IsFull;
+        for (int f = p - 1; f >= 0; f--)
+            if (car.CarCalls[f] || (hall && car.DownCalls[f])) return f;
+
+        // Lowest up call below: go down to it and turn there
+        for (int f = 0; f < p && hall; f++)
+            if (car.UpCalls[f]) return f;
+
+        return -1;
+    }
+
+    private bool HasStopsAbove(Car car, int floor)
+    {
+        for (int f = floor + 1; f < FloorCount; f++)
+            if (car.CarCalls[f] || car.UpCalls[f] || car.DownCalls[f]) return true;
+        return false;
+    }
+
+    private bool HasStopsBelow(Car car, int floor)
+    {
+        for (int f = floor - 1; f >= 0; f--)
+            if (car.CarCalls[f] || car.UpCalls[f] || car.DownCalls[f]) return true;
+        return false;
+    }
+
+    private int HighestStop(Car car)
+    {
+        for (int f = FloorCount - 1; f >= 0; f--)
+            if (car.CarCalls[f] || car.UpCalls[f] || car.DownCalls[f]) return f;
+        return -1;
+    }
+
+    private int LowestStop(Car car)
+    {
+        for (int f = 0; f < FloorCount; f++)
+            if (car.CarCalls[f] || car.UpCalls[f] || car.DownCalls[f]) return f;
+        return -1;
+    }
+
+    private int CountStops(Car car)
+    {
+        int count = 0;
+        for (int f = 0; f < FloorCount; f++)
+            if (car.CarCalls[f] || car.UpCalls[f] || car.DownCalls[f]) count++;
+        return count;
+    }
+}
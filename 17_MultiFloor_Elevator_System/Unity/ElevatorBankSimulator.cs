@@ -0,0 +1,241 @@
+using System;
+using System.Collections.Generic;
+
+/* --------------------------------------------------------------------------
+   Headless, fixed-step simulation of an ElevatorBankLogic.
+   No scene, no MonoBehaviour: passengers are generated from a seed, so two runs with the same
+   settings give the same numbers. Used to compare dispatch tuning without loading a level
+   (see ElevatorDispatchTests).
+   -------------------------------------------------------------------------- */
+public class ElevatorBankSimulator
+{
+    [Serializable]
+    public struct Settings
+    {
+        public int floorCount;
+        public int carCount;
+        public int carCapacity;
+        public int passengerCount;
+        public float spawnWindowSeconds;   // Passengers appear uniformly over this window
+        [UnityEngine.Range(0f, 1f)]
+        public float lobbyShare;           // Fraction of passengers starting at floor 0 (morning rush)
+        public float secondsPerFloor;
+        public float doorDwellSeconds;
+        public float timeStep;
+        public float maxSimulatedSeconds;
+        public int seed;
+
+        public static Settings Default => new Settings
+        {
+            floorCount = 12,
+            carCount = 4,
+            carCapacity = 8,
+            passengerCount = 100,
+            spawnWindowSeconds = 120f,
+            lobbyShare = 0.5f,
+            secondsPerFloor = 2f,
+            doorDwellSeconds = 4f,
+            timeStep = 0.1f,
+            maxSimulatedSeconds = 3600f,
+            seed = 1234
+        };
+    }
+
+    public struct Result
+    {
+        public int delivered;
+        public float averageWait;          // Spawn -> boarding
+        public float maxWait;
+        public float averageTravel;        // Boarding -> arrival
+        public float throughputPerMinute;  // Delivered passengers per simulated minute
+        public float simulatedSeconds;
+        public double wallClockMs;
+
+        public override string ToString()
+        {
+            return $"delivered {delivered}, avg wait {averageWait:0.0}s, max wait {maxWait:0.0}s, " +
+                   $"avg travel {averageTravel:0.0}s, throughput {throughputPerMinute:0.0}/min, " +
+                   $"simulated {simulatedSeconds:0}s in {wallClockMs:0.00}ms";
+        }
+    }
+
+    private class Passenger
+    {
+        public int origin;
+        public int destination;
+        public float spawnTime;
+        public float boardTime = -1f;
+        public float arriveTime = -1f;
+        public bool spawned;
+
+        public HallCallDirection Direction => destination > origin ? HallCallDirection.Up : HallCallDirection.Down;
+    }
+
+    private class CarRuntime
+    {
+        public int target = -1;
+        public float dwellRemaining;
+        public readonly List<Passenger> riders = new List<Passenger>();
+    }
+
+    public static Result Run(Settings settings)
+    {
+        var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+        var random = new Random(settings.seed);
+
+        int floorCount = Math.Max(2, settings.floorCount);
+        var logic = new ElevatorBankLogic(floorCount, Math.Max(1, settings.carCount), Math.Max(1, settings.carCapacity));
+        logic.FloorsPerSecond = 1f / Math.Max(0.01f, settings.secondsPerFloor);
+        logic.DoorCycleSeconds = settings.doorDwellSeconds;
+
+        // Generate passengers up front, ordered by spawn time
+        var passengers = new List<Passenger>(settings.passengerCount);
+        for (int i = 0; i < settings.passengerCount; i++)
+        {
+            var p = new Passenger();
+            p.origin = random.NextDouble() < settings.lobbyShare ? 0 : random.Next(floorCount);
+            do { p.destination = random.Next(floorCount); } while (p.destination == p.origin);
+            p.spawnTime = (float)(random.NextDouble() * settings.spawnWindowSeconds);
+            passengers.Add(p);
+        }
+        passengers.Sort((a, b) => a.spawnTime.CompareTo(b.spawnTime));
+
+        var waiting = new List<Passenger>[floorCount];
+        for (int f = 0; f < floorCount; f++)
+            waiting[f] = new List<Passenger>();
+
+        var cars = new CarRuntime[logic.Cars.Length];
+        for (int i = 0; i < cars.Length; i++)
+            cars[i] = new CarRuntime();
+
+        float dt = Math.Max(0.001f, settings.timeStep);
+        float speed = 1f / Math.Max(0.01f, settings.secondsPerFloor);
+        float time = 0f;
+        int nextSpawn = 0;
+        int delivered = 0;
+
+        while (delivered < passengers.Count && time < settings.maxSimulatedSeconds)
+        {
+            // Spawn
+            while (nextSpawn < passengers.Count && passengers[nextSpawn].spawnTime <= time)
+            {
+                Passenger p = passengers[nextSpawn++];
+                p.spawned = true;
+                waiting[p.origin].Add(p);
+                logic.RequestHallCall(p.origin, p.Direction);
+            }
+
+            // Cars
+            for (int c = 0; c < cars.Length; c++)
+            {
+                CarRuntime runtime = cars[c];
+                ElevatorBankLogic.Car car = logic.Cars[c];
+
+                if (runtime.dwellRemaining > 0f)
+                {
+                    runtime.dwellRemaining -= dt;
+                    if (runtime.dwellRemaining <= 0f)
+                        car.DoorsOpen = false;
+                    continue;
+                }
+
+                if (runtime.target < 0)
+                {
+                    runtime.target = logic.GetNextStop(c);
+                    if (runtime.target < 0)
+                        continue;
+                }
+
+                float delta = runtime.target - car.Position;
+                float step = speed * dt;
+                if (Math.Abs(delta) > step)
+                {
+                    car.Moving = true;
+                    car.Position += Math.Sign(delta) * step;
+
+                    // LOOK may pick a closer stop while the car is travelling
+                    int retarget = logic.GetNextStop(c);
+                    if (retarget >= 0 && retarget != runtime.target && IsAhead(car.Position, runtime.target, retarget))
+                        runtime.target = retarget;
+                    continue;
+                }
+
+                int floor = runtime.target;
+                runtime.target = -1;
+                CarDirection leaving = logic.NotifyArrived(c, floor);
+
+                // Unload
+                for (int r = runtime.riders.Count - 1; r >= 0; r--)
+                {
+                    Passenger rider = runtime.riders[r];
+                    if (rider.destination != floor)
+                        continue;
+
+                    rider.arriveTime = time;
+                    runtime.riders.RemoveAt(r);
+                    delivered++;
+                }
+
+                // Board passengers heading the same way (an idle car takes the first in line's direction)
+                List<Passenger> queue = waiting[floor];
+                for (int w = 0; w < queue.Count && runtime.riders.Count < car.Capacity;)
+                {
+                    Passenger p = queue[w];
+                    if (leaving == CarDirection.Idle)
+                        leaving = p.Direction == HallCallDirection.Up ? CarDirection.Up : CarDirection.Down;
+
+                    bool matches = (leaving == CarDirection.Up) == (p.Direction == HallCallDirection.Up);
+                    if (!matches) { w++; continue; }
+
+                    p.boardTime = time;
+                    runtime.riders.Add(p);
+                    queue.RemoveAt(w);
+                    logic.RequestCarCall(c, p.destination);
+                }
+
+                car.Direction = leaving;
+                car.Load = runtime.riders.Count;
+                car.DoorsOpen = true;
+                runtime.dwellRemaining = settings.doorDwellSeconds;
+
+                // Whoever is still waiting presses the button again
+                for (int w = 0; w < queue.Count; w++)
+                    logic.RequestHallCall(floor, queue[w].Direction);
+            }
+
+            time += dt;
+        }
+
+        stopwatch.Stop();
+
+        var result = new Result { delivered = delivered, simulatedSeconds = time, wallClockMs = stopwatch.Elapsed.TotalMilliseconds };
+        float waitSum = 0f, travelSum = 0f;
+        int boarded = 0;
+        foreach (Passenger p in passengers)
+        {
+            if (p.boardTime < 0f)
+                continue;
+
+            float wait = p.boardTime - p.spawnTime;
+            waitSum += wait;
+            result.maxWait = Math.Max(result.maxWait, wait);
+            boarded++;
+
+            if (p.arriveTime >= 0f)
+                travelSum += p.arriveTime - p.boardTime;
+        }
+
+        result.averageWait = boarded > 0 ? waitSum / boarded : 0f;
+        result.averageTravel = delivered > 0 ? travelSum / delivered : 0f;
+        result.throughputPerMinute = time > 0f ? delivered / (time / 60f) : 0f;
+        return result;
+    }
+
+    // True when 'candidate' lies between the car and its current target
+    private static bool IsAhead(float position, int target, int candidate)
+    {
+        return target > position
+            ? candidate > position + 0.5f && candidate < target
+            : candidate < position - 0.5f && candidate > target;
+    }
+}
@@ -1,7 +1,9 @@
 using System.Collections;
 using System.Collections.Generic;
 using UnityEngine;
+using UnityEngine.Events;
 
+[DefaultExecutionOrder(-60)] // Publishes the next pose before MovingPlatform applies it
 public class ElevatorScript : MonoBehaviour
 {
     private enum ElevatorState
@@ -21,6 +23,10 @@ public class ElevatorScript : MonoBehaviour
     private Coroutine delayedFloorCoroutine;
 
 
+    [Header("Platform")]
+    [SerializeField] private MovingPlatform platform; // Optional. When set, the car moves in FixedUpdate and the platform carries occupants
+    private readonly WaitForFixedUpdate waitForFixedUpdate = new WaitForFixedUpdate();
+
     [Header("Rotation")]
     [SerializeField] private float arrivalRotationTime = 0.6f;
     [SerializeField] private AnimationCurve rotationCurve; // Easing curve for rotation (0-1 input, 0-1 output). If null, will use movementCurve.
@@ -32,13 +38,14 @@ public class ElevatorScript : MonoBehaviour
     [SerializeField] private float closeDoorCooldown = 1f; // Time after last main occupant leaves before doors will auto-close
     [SerializeField] private Transform leftDoor;
     [SerializeField] private Transform rightDoor;
+    [SerializeField] private DoorActuator doors; // Optional. If empty, one is created from the left/right door settings above
+    [SerializeField] private BoxCollider doorObstruction; // Box over the doorway, passed to the doors when they have none. Can stay disabled.
     private Coroutine closeDoorsCoroutine;
 
     [Header("Occupant Filtering")]
     [SerializeField] private List<string> mainOccupantTags = new List<string>() { "Player" }; // Tags that count as "main" occupants for auto-close logic
 
     private bool doorsOpen = false;
-    private bool doorAnimating = false;
 
     [Header("Initial ARRAY floor index")]
     [SerializeField] private int initialFloor = 0;
@@ -51,19 +58,44 @@ public class ElevatorScript : MonoBehaviour
 
     private Quaternion endRot;
 
-    private Vector3 leftClosedPos;
-    private Vector3 rightClosedPos;
-    private Vector3 leftOpenPos;
-    private Vector3 rightOpenPos;
-
     private readonly List<Transform> occupants = new List<Transform>();
     private int mainOccupantCount = 0;
 
     private Vector3 lastElevatorPos;
 
     private Queue<int> floorQueue = new Queue<int>(); // For multi-floor travel, holds the sequence of floors to visit
+    private int tripDestination = 0;
+
+    [Header("Events")]
+    public UnityEvent<int> onArrivedAtFloor = new UnityEvent<int>(); // Raised with the floor index when the car stops, before the doors open
+
+    // Set by ElevatorBankController. Bank cars forward calls to the bank instead of moving on their own.
+    internal ElevatorBankController Bank { get; set; }
+
+    public bool IsIdle => state == ElevatorState.Idle;
+    public bool IsMoving => state == ElevatorState.Moving;
+    public bool DoorsOpen => doorsOpen;
+    public int CurrentFloor => currentFloor;
+    public int TripDestination => tripDestination;
+    public int FloorCount => floors != null ? floors.Length : 0;
+    public int OccupantCount => platform != null ? platform.RiderCount : occupants.Count;
+
+    // Position in floors, fractional while travelling between two floors
+    public float FloorPosition
+    {
+        get
+        {
+            if (state != ElevatorState.Moving || travelTime <= 0f)
+                return currentFloor;
+
+            return Mathf.Lerp(currentFloor, targetFloor, Mathf.Clamp01(moveTimer / travelTime));
+        }
+    }
 
     private void Awake() {
+        if (platform == null)
+            platform = GetComponent<MovingPlatform>();
+
         if (movementCurve == null)
             movementCurve = AnimationCurve.EaseInOut(0f, 0f, 1f, 1f);
 
@@ -76,29 +108,69 @@ public class ElevatorScript : MonoBehaviour
         currentFloor = initialFloor;
         lastElevatorPos = transform.position;
 
-        if (useDoors && leftDoor && rightDoor)
+        if (useDoors && doors == null && leftDoor && rightDoor)
         {
-            leftClosedPos = leftDoor.localPosition;
-            rightClosedPos = rightDoor.localPosition;
+            doors = gameObject.AddComponent<DoorActuator>();
+            doors.AddLeaf(leftDoor, DoorActuator.LeafMode.Sliding, Vector3.forward * doorOpenDistance);
+            doors.AddLeaf(rightDoor, DoorActuator.LeafMode.Sliding, Vector3.back * doorOpenDistance);
+            doors.Configure(1f / Mathf.Max(0.01f, doorSpeed), movementCurve);
+        }
 
-            leftOpenPos = leftClosedPos + Vector3.forward * doorOpenDistance;
-            rightOpenPos = rightClosedPos + Vector3.back * doorOpenDistance;
+        if (doors != null)
+        {
+            if (doors.ObstructionVolume == null)
+                doors.ObstructionVolume = doorObstruction;
+            doors.TickedByOwner = true;
+            doors.onOpened.AddListener(OnDoorsOpened);
+            doors.onClosed.AddListener(OnDoorsClosed);
+        }
+        else if (useDoors)
+        {
+            Debug.Log("Door transforms not assigned. Skipping door animation.");
         }
     }
 
     void Update()
     {
-        if (state == ElevatorState.Moving)
-            MovementTick();
+        if (state == ElevatorState.Moving && platform == null)
+            MovementTick(Time.deltaTime);
+
+        // The doors sleep between movements
+        if (doors != null && doors.IsAwake)
+            doors.Tick(Time.deltaTime);
+    }
+
+    void FixedUpdate()
+    {
+        if (state == ElevatorState.Moving && platform != null)
+            MovementTick(Time.fixedDeltaTime);
     }
 
     void LateUpdate()
     {
-        ApplyDeltaToOccupants();
+        if (platform == null)
+            ApplyDeltaToOccupants();
+    }
+
+    private Vector3 CarPosition => platform != null ? platform.Position : transform.position;
+    private Quaternion CarRotation => platform != null ? platform.Rotation : transform.rotation;
+
+    private void SetCarPose(Vector3 position, Quaternion rotation)
+    {
+        if (platform != null)
+            platform.MoveTo(position, rotation);
+        else
+            transform.SetPositionAndRotation(position, rotation);
     }
 
     public void CallElevator(int floorIndex)
     {
+        if (Bank != null)
+        {
+            Bank.CallElevator(floorIndex);
+            return;
+        }
+
         if (state != ElevatorState.Idle)
             return;
 
@@ -115,6 +187,18 @@ public class ElevatorScript : MonoBehaviour
     }
 
     public void MoveToFloor(int floorIndex)
+    {
+        if (Bank != null)
+        {
+            Bank.RequestFloor(this, floorIndex);
+            return;
+        }
+
+        StartTrip(floorIndex);
+    }
+
+    // Direct move used by the bank controller (and by MoveToFloor for standalone cars)
+    internal void StartTrip(int floorIndex)
     {
         if (state != ElevatorState.Idle)
             return;
@@ -127,9 +211,29 @@ public class ElevatorScript : MonoBehaviour
         for (int f = currentFloor + step; f != floorIndex + step; f += step)
             floorQueue.Enqueue(f);
 
+        tripDestination = floorIndex;
         StartCoroutine(BeginMovementAfterDoorsClosed());
     }
 
+    // Changes the destination of the trip in progress without stopping (e.g. a new call on the way).
+    // Only floors that are still ahead of the car in its travel direction are accepted.
+    internal bool RetargetTrip(int floorIndex)
+    {
+        if (state != ElevatorState.Moving || floorIndex < 0 || floorIndex >= floors.Length)
+            return false;
+
+        int step = tripDestination > currentFloor ? 1 : -1;
+        if ((floorIndex - targetFloor) * step < 0)
+            return false;
+
+        floorQueue.Clear();
+        for (int f = targetFloor + step; f != floorIndex + step; f += step)
+            floorQueue.Enqueue(f);
+
+        tripDestination = floorIndex;
+        return true;
+    }
+
     public IEnumerator MoveToFloorDelayed(int floorIndex)
     {
         yield return new WaitForSeconds(closeDoorCooldown);
@@ -141,7 +245,7 @@ public class ElevatorScript : MonoBehaviour
         state = ElevatorState.ClosingDoors;
 
         CloseDoors();
-        while (doorAnimating)
+        while (useDoors && doors != null && !doors.IsClosed) // Waits through obstruction reopens as well
             yield return null;
 
         StartNextSegment();
@@ -157,7 +261,7 @@ public class ElevatorScript : MonoBehaviour
 
         targetFloor = floorQueue.Dequeue();
 
-        startPos = transform.position;
+        startPos = CarPosition;
         endPos = floors[targetFloor].position;
 
         endRot = floors[targetFloor].rotation;
@@ -166,18 +270,18 @@ public class ElevatorScript : MonoBehaviour
         state = ElevatorState.Moving;
     }
 
-    private void MovementTick()
+    private void MovementTick(float deltaTime)
     {
-        moveTimer += Time.deltaTime;
+        moveTimer += deltaTime;
         float t = Mathf.Clamp01(moveTimer / travelTime);
         float curved = movementCurve.Evaluate(t);
 
-        transform.position = Vector3.Lerp(startPos, endPos, curved);
+        SetCarPose(Vector3.Lerp(startPos, endPos, curved), CarRotation);
 
         if (t >= 1f)
         {
             currentFloor = targetFloor;
-            transform.position = endPos;
+            SetCarPose(endPos, CarRotation);
 
             if (floorQueue.Count > 0)
                 StartNextSegment();
@@ -188,7 +292,9 @@ public class ElevatorScript : MonoBehaviour
 
     private void FinishMovement()
     {
-        float angle = Quaternion.Angle(transform.rotation, endRot);
+        onArrivedAtFloor?.Invoke(currentFloor);
+
+        float angle = Quaternion.Angle(CarRotation, endRot);
         bool needsRotation = angle > 0.01f && arrivalRotationTime > 0f;
 
         if (needsRotation)
@@ -199,7 +305,7 @@ public class ElevatorScript : MonoBehaviour
         }
         else
         {
-            transform.rotation = endRot;
+            SetCarPose(CarPosition, endRot);
             OpenDoors();
         }
     }
@@ -208,16 +314,25 @@ public class ElevatorScript : MonoBehaviour
     {
         state = ElevatorState.Rotating;
 
-        Quaternion initial = transform.rotation;
+        Quaternion initial = CarRotation;
         float timer = 0f;
 
         while (timer < arrivalRotationTime)
         {
-            timer += Time.deltaTime;
+            timer += Time.deltaTime; // fixedDeltaTime after WaitForFixedUpdate
             float t = Mathf.Clamp01(timer / arrivalRotationTime);
             float curved = rotationCurve.Evaluate(t);
 
             Quaternion newRot = Quaternion.Lerp(initial, targetRot, curved);
+
+            if (platform != null)
+            {
+                // The platform rotates its riders
+                platform.MoveTo(platform.Position, newRot);
+                yield return waitForFixedUpdate;
+                continue;
+            }
+
             Quaternion deltaRot = newRot * Quaternion.Inverse(transform.rotation);
 
             transform.rotation = newRot;
@@ -241,7 +356,7 @@ public class ElevatorScript : MonoBehaviour
             yield return null;
         }
 
-        transform.rotation = targetRot;
+        SetCarPose(CarPosition, targetRot);
         state = ElevatorState.OpeningDoors;
         onComplete?.Invoke();
     }
@@ -250,7 +365,7 @@ public class ElevatorScript : MonoBehaviour
     {
         if(floors.Length <= 0) return;
 
-        if (!occupants.Contains(other.transform))
+        if (platform == null && !occupants.Contains(other.transform)) // The platform tracks its own riders
             occupants.Add(other.transform);
 
         if (mainOccupantTags.Contains(other.tag))
@@ -270,7 +385,7 @@ public class ElevatorScript : MonoBehaviour
             controller.HandleJumpState(false);
         }
 
-        if (floors.Length == 2 && mainOccupantCount > 0) // If it's a 2-floor elevator and a main occupant steps in, automatically call the other floor
+        if (floors.Length == 2 && mainOccupantCount > 0 && Bank == null) // If it's a 2-floor elevator and a main occupant steps in, automatically call the other floor
         {
             if (delayedFloorCoroutine != null)
             {
@@ -285,7 +400,7 @@ public class ElevatorScript : MonoBehaviour
     {
         if(floors.Length <= 0) return;
 
-        if (occupants.Contains(other.transform))
+        if (platform == null)
             occupants.Remove(other.transform);
 
         bool wasMain = mainOccupantTags.Contains(other.tag);
@@ -338,76 +453,37 @@ public class ElevatorScript : MonoBehaviour
 
     public void OpenDoors()
     {
-        if (!useDoors){
+        if (!useDoors || doors == null){
             state = ElevatorState.Idle;
             return;
         }
 
-        if (!doorsOpen && !doorAnimating)
+        if (!doorsOpen || doors.IsClosing) // Closing doors reverse from where they are
         {
             state = ElevatorState.OpeningDoors;
-            StartCoroutine(AnimateDoors(true));
+            doors.Open();
             doorsOpen = true;
         }
     }
 
     public void CloseDoors()
     {
-        if (!useDoors)
+        if (!useDoors || doors == null)
             return;
 
-        if (doorsOpen && !doorAnimating)
-        {
-            StartCoroutine(CloseDoorsRoutine());
-        }
+        if (doorsOpen && !doors.IsClosing)
+            doors.Close();
     }
 
-    private IEnumerator CloseDoorsRoutine()
+    private void OnDoorsOpened()
     {
-        yield return StartCoroutine(AnimateDoors(false));
-        doorsOpen = false;
+        // Reopened by an obstruction while leaving: stay in ClosingDoors, the doors close again on their own
+        if (state == ElevatorState.OpeningDoors)
+            state = ElevatorState.Idle;
     }
 
-    private IEnumerator AnimateDoors(bool opening)
+    private void OnDoorsClosed()
     {
-        if (!leftDoor || !rightDoor)
-        {
-            doorAnimating = false;
-            Debug.Log("Door transforms not assigned. Skipping door animation.");
-            yield break;
-        }
-
-        doorAnimating = true;
-
-        Vector3 lStart = leftDoor.localPosition;
-        Vector3 rStart = rightDoor.localPosition;
-
-        Vector3 lTarget = opening ? leftOpenPos : leftClosedPos;
-        Vector3 rTarget = opening ? rightOpenPos : rightClosedPos;
-
-        float t = 0f;
-
-        while (t < 1f)
-        {
-            t += Time.deltaTime * doorSpeed;
-            float curved = movementCurve.Evaluate(t);
-
-            leftDoor.localPosition = Vector3.Lerp(lStart, lTarget, curved);
-            rightDoor.localPosition = Vector3.Lerp(rStart, rTarget, curved);
-
-            yield return null;
-        }
-
-        doorAnimating = false;
-
-        if (opening)
-        {
-            state = ElevatorState.Idle;
-        }
-        else
-        {
-            if (state == ElevatorState.ClosingDoors)
-                state = ElevatorState.Moving;
-        }
+        doorsOpen = false;
     }
 }
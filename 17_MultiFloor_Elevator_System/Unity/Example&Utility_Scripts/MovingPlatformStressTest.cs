@@ -0,0 +1,98 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+// Stress scene helper: drops many riders on a fast MovingPlatform and reports how many fall through
+// or sink into the floor. Place it on an empty GameObject, assign a platform that has a top trigger
+// volume, and press Play. Half the riders are CharacterControllers, half dynamic Rigidbodies.
+public class MovingPlatformStressTest : MonoBehaviour
+{
+    [SerializeField] MovingPlatform platform;
+    [SerializeField] int riderCount = 50;
+    [Range(0f, 1f)][SerializeField] float characterShare = 0.5f;
+    [SerializeField] Vector2 spawnArea = new Vector2(3f, 3f); // Platform-local XZ extents
+    [SerializeField] float floorHeight = 0.5f; // Platform-local Y of the walkable surface
+    [SerializeField] float travelHeight = 40f;
+    [SerializeField] float peakSpeed = 20f; // m/s at the middle of the trip
+    [SerializeField] float spinDegreesPerSecond = 0f; // Non-zero to also test rotation
+    [SerializeField] float reportInterval = 2f;
+
+    readonly List<Transform> riders = new List<Transform>();
+    Vector3 basePosition;
+    Quaternion baseRotation;
+    float time;
+    float reportTimer;
+    float worstSink;
+    int lostRiders;
+
+    void Start()
+    {
+        basePosition = platform.transform.position;
+        baseRotation = platform.transform.rotation;
+
+        int characters = Mathf.RoundToInt(riderCount * characterShare);
+        for (int i = 0; i < riderCount; i++)
+        {
+            Vector3 local = new Vector3(Random.Range(-spawnArea.x, spawnArea.x), floorHeight, Random.Range(-spawnArea.y, spawnArea.y));
+            Vector3 position = platform.transform.TransformPoint(local);
+
+            GameObject rider;
+            if (i < characters)
+            {
+                rider = new GameObject($"CharacterRider_{i}");
+                var controller = rider.AddComponent<CharacterController>();
+                controller.height = 1.8f;
+                controller.radius = 0.3f;
+                controller.center = Vector3.up * 0.9f;
+            }
+            else
+            {
+                rider = GameObject.CreatePrimitive(PrimitiveType.Cube);
+                rider.name = $"BodyRider_{i}";
+                rider.transform.localScale = Vector3.one * 0.4f;
+                position += Vector3.up * 0.2f;
+                rider.AddComponent<Rigidbody>().interpolation = RigidbodyInterpolation.Interpolate;
+            }
+
+            rider.transform.position = position;
+            riders.Add(rider.transform);
+        }
+    }
+
+    void FixedUpdate()
+    {
+        // Sine travel: peak velocity = amplitude * angular frequency
+        time += Time.fixedDeltaTime;
+        float amplitude = travelHeight * 0.5f;
+        float frequency = peakSpeed / Mathf.Max(0.01f, amplitude);
+        Vector3 position = basePosition + Vector3.up * (amplitude - amplitude * Mathf.Cos(time * frequency));
+        Quaternion rotation = baseRotation * Quaternion.Euler(0f, spinDegreesPerSecond * time, 0f);
+
+        platform.MoveTo(position, rotation);
+    }
+
+    void LateUpdate()
+    {
+        Transform car = platform.transform;
+        lostRiders = 0;
+
+        foreach (Transform rider in riders)
+        {
+            float localY = car.InverseTransformPoint(rider.position).y;
+            if (!platform.IsRiding(rider) || localY < floorHeight - 1f)
+            {
+                lostRiders++;
+                continue;
+            }
+
+            worstSink = Mathf.Max(worstSink, floorHeight - localY);
+        }
+
+        reportTimer += Time.deltaTime;
+        if (reportTimer < reportInterval)
+            return;
+
+        reportTimer = 0f;
+        Debug.Log($"[MovingPlatformStressTest] {riders.Count} riders at {platform.Velocity.magnitude:F1} m/s: " +
+                  $"{lostRiders} lost, worst sink {worstSink * 100f:F1} cm");
+    }
+}
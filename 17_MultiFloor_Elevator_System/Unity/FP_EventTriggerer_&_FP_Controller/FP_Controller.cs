@@ -74,7 +74,7 @@ public class FP_Controller : MonoBehaviour
     private int jumpCount;
 
     [Header("Flashlight")]
-    [SerializeField] private FP_FlashlightSystem flashlight;
+    [SerializeField] private Component flashlight; // Section 16's FP_FlashlightSystem, messaged so this copy builds without it
     [HideInInspector] public bool canUseFlashlight = true;
 
     private void Awake()
@@ -357,8 +357,8 @@ public class FP_Controller : MonoBehaviour
     {
         if (!canUseFlashlight) return;
 
-        if (InputManager.Instance.IsFlashlightOn)
-            flashlight.ToggleFlashlight();
+        if (InputManager.Instance.IsFlashlightOn && flashlight != null)
+            flashlight.SendMessage("ToggleFlashlight", SendMessageOptions.DontRequireReceiver);
     }
 
 
@@ -0,0 +1,314 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+/* --------------------------------------------------------------------------
+   Reusable moving platform (elevator cars, lifts, trains...).
+
+   • The owner moves the platform with MoveTo(); the pose is applied to a kinematic, interpolated
+     Rigidbody in FixedUpdate, and Velocity / AngularVelocity are published every physics step.
+   • Riders are attached MovementBase-style: each rider has at most one base platform.
+       - Rigidbodies are carried in FixedUpdate (kinematic MovePosition, dynamic bodies are swept first).
+       - CharacterControllers and plain transforms are carried in Update, before their own movement
+         (DefaultExecutionOrder), using the rendered pose delta so they don't jitter against the floor.
+   • With attachOnTrigger, any trigger collider on this GameObject attaches / detaches riders.
+   -------------------------------------------------------------------------- */
+[DefaultExecutionOrder(-50)]
+[RequireComponent(typeof(Rigidbody))]
+public class MovingPlatform : MonoBehaviour
+{
+    private class Rider
+    {
+        public Transform transform;
+        public CharacterController controller;
+        public Rigidbody body;
+        public int colliderCount;
+        public int index;
+    }
+
+    [Header("Riders")]
+    [SerializeField] private bool attachOnTrigger = true;
+    [SerializeField] private bool rotateRiders = true; // Characters only receive the yaw part of the rotation
+    [SerializeField] private bool impartVelocityOnDetach = true; // Dynamic rigidbodies keep the platform's momentum when they leave
+    [SerializeField] private LayerMask sweepMask = ~0;
+
+    public Vector3 Velocity { get; private set; }
+    public Vector3 AngularVelocity { get; private set; } // World space, rad/s
+    public int RiderCount => riders.Count;
+
+    // Pose that will be (or was last) applied in FixedUpdate. Use this instead of transform while moving.
+    public Vector3 Position => targetPosition;
+    public Quaternion Rotation => targetRotation;
+
+    // A rider belongs to a single platform at a time (the last one it entered)
+    private static readonly Dictionary<Transform, MovingPlatform> riderBases = new Dictionary<Transform, MovingPlatform>();
+
+    private readonly List<Rider> riders = new List<Rider>();
+    private readonly Dictionary<Transform, Rider> riderLookup = new Dictionary<Transform, Rider>();
+
+    private Rigidbody rb;
+    private Vector3 targetPosition;
+    private Quaternion targetRotation;
+    private Vector3 physicsPosition;
+    private Quaternion physicsRotation;
+    private Vector3 renderPosition;
+    private Quaternion renderRotation;
+
+    [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.SubsystemRegistration)]
+    private static void ResetStatics() => riderBases.Clear(); // Play mode without domain reload
+
+    private void Awake()
+    {
+        rb = GetComponent<Rigidbody>();
+        rb.isKinematic = true;
+        rb.interpolation = RigidbodyInterpolation.Interpolate;
+
+        targetPosition = physicsPosition = renderPosition = transform.position;
+        targetRotation = physicsRotation = renderRotation = transform.rotation;
+    }
+
+    private void OnDisable()
+    {
+        for (int i = riders.Count - 1; i >= 0; i--)
+            Detach(riders[i].transform);
+
+        Velocity = Vector3.zero;
+        AngularVelocity = Vector3.zero;
+    }
+
+    public void MoveTo(Vector3 position, Quaternion rotation)
+    {
+        targetPosition = position;
+        targetRotation = rotation;
+    }
+
+    public void MoveTo(Vector3 position) => MoveTo(position, targetRotation);
+
+    // Instantly places the platform (and its riders' bases) without imparting any velocity
+    public void Teleport(Vector3 position, Quaternion rotation)
+    {
+        targetPosition = physicsPosition = renderPosition = position;
+        targetRotation = physicsRotation = renderRotation = rotation;
+        rb.position = position;
+        rb.rotation = rotation;
+        transform.SetPositionAndRotation(position, rotation);
+    }
+
+    public Vector3 GetPointVelocity(Vector3 worldPoint)
+    {
+        return Velocity + Vector3.Cross(AngularVelocity, worldPoint - physicsPosition);
+    }
+
+    private void FixedUpdate()
+    {
+        float dt = Time.fixedDeltaTime;
+        Vector3 deltaPosition = targetPosition - physicsPosition;
+        Quaternion deltaRotation = targetRotation * Quaternion.Inverse(physicsRotation);
+
+        rb.MovePosition(targetPosition);
+        rb.MoveRotation(targetRotation);
+
+        Velocity = deltaPosition / dt;
+        deltaRotation.ToAngleAxis(out float angle, out Vector3 axis);
+        if (angle > 180f) angle -= 360f;
+        AngularVelocity = float.IsInfinity(axis.x) || Mathf.Approximately(angle, 0f) ? Vector3.zero : axis * (angle * Mathf.Deg2Rad / dt);
+
+        if (deltaPosition.sqrMagnitude > 0f || angle != 0f)
+        {
+            for (int i = riders.Count - 1; i >= 0; i--)
+            {
+                Rider rider = riders[i];
+                if (rider.body == null)
+                    continue;
+
+                CarryBody(rider.body, physicsPosition, deltaPosition, deltaRotation);
+            }
+        }
+
+        physicsPosition = targetPosition;
+        physicsRotation = targetRotation;
+    }
+
+    private void Update()
+    {
+        // Interpolated pose, which is what the camera sees this frame
+        Vector3 position = transform.position;
+        Quaternion rotation = transform.rotation;
+
+        Vector3 deltaPosition = position - renderPosition;
+        Quaternion deltaRotation = rotation * Quaternion.Inverse(renderRotation);
+        bool rotated = Quaternion.Angle(rotation, renderRotation) > 0.0001f;
+
+        if (deltaPosition.sqrMagnitude > 0.00000001f || rotated)
+        {
+            for (int i = riders.Count - 1; i >= 0; i--)
+            {
+                Rider rider = riders[i];
+                if (rider.transform == null)
+                {
+                    RemoveAt(i);
+                    continue;
+                }
+
+                if (rider.body != null)
+                    continue;
+
+                Vector3 displacement = position + deltaRotation * (rider.transform.position - renderPosition) - rider.transform.position;
+
+                if (rider.controller != null && rider.controller.enabled)
+                    rider.controller.Move(displacement);
+                else
+                    rider.transform.position += displacement;
+
+                if (rotateRiders && rotated)
+                    rider.transform.rotation = YawOnly(deltaRotation) * rider.transform.rotation;
+            }
+        }
+
+        renderPosition = position;
+        renderRotation = rotation;
+    }
+
+    private void CarryBody(Rigidbody body, Vector3 pivot, Vector3 deltaPosition, Quaternion deltaRotation)
+    {
+        Vector3 from = body.position;
+        Vector3 displacement = pivot + deltaPosition + deltaRotation * (from - pivot) - from;
+
+        if (!body.isKinematic)
+        {
+            // Sweep so a fast car can't push a prop through a wall; the platform itself moves with the body
+            float distance = displacement.magnitude;
+            if (distance > 0.0001f)
+            {
+                float allowed = distance;
+                RaycastHit[] hits = body.SweepTestAll(displacement / distance, distance, QueryTriggerInteraction.Ignore);
+                for (int h = 0; h < hits.Length; h++)
+                {
+                    Collider other = hits[h].collider;
+                    if (other.attachedRigidbody == rb || other.transform.IsChildOf(transform))
+                        continue;
+                    if ((sweepMask.value & (1 << other.gameObject.layer)) == 0)
+                        continue;
+
+                    allowed = Mathf.Min(allowed, hits[h].distance);
+                }
+
+                displacement *= allowed / distance;
+            }
+        }
+
+        body.MovePosition(from + displacement);
+        if (rotateRiders)
+            body.MoveRotation(deltaRotation * body.rotation);
+    }
+
+    private static Quaternion YawOnly(Quaternion rotation)
+    {
+        Vector3 forward = rotation * Vector3.forward;
+        forward.y = 0f;
+        return forward.sqrMagnitude > 0.0001f ? Quaternion.FromToRotation(Vector3.forward, forward.normalized) : Quaternion.identity;
+    }
+
+    // ---------------------------------------------------------------------
+    // Attachment
+    // ---------------------------------------------------------------------
+
+    public bool IsRiding(Transform target) => target != null && riderLookup.ContainsKey(target);
+
+    public static MovingPlatform GetBase(Transform target)
+    {
+        return target != null && riderBases.TryGetValue(target, out MovingPlatform platform) ? platform : null;
+    }
+
+    public void Attach(Transform target)
+    {
+        if (target == null)
+            return;
+
+        if (riderLookup.TryGetValue(target, out Rider existing))
+        {
+            existing.colliderCount++;
+            return;
+        }
+
+        // Riders have a single base: leave the previous platform first
+        MovingPlatform previous = GetBase(target);
+        if (previous != null && previous != this)
+            previous.Detach(target, true);
+
+        var rider = new Rider
+        {
+            transform = target,
+            controller = target.GetComponent<CharacterController>(),
+            colliderCount = 1,
+            index = riders.Count
+        };
+        if (rider.controller == null)
+            rider.body = target.GetComponent<Rigidbody>();
+
+        riders.Add(rider);
+        riderLookup.Add(target, rider);
+        riderBases[target] = this;
+    }
+
+    public void Detach(Transform target) => Detach(target, true);
+
+    private void Detach(Transform target, bool force)
+    {
+        if (target == null || !riderLookup.TryGetValue(target, out Rider rider))
+            return;
+
+        if (!force && --rider.colliderCount > 0)
+            return;
+
+        if (impartVelocityOnDetach && rider.body != null && !rider.body.isKinematic)
+            rider.body.velocity += GetPointVelocity(rider.body.position);
+
+        RemoveAt(rider.index);
+    }
+
+    private void RemoveAt(int index)
+    {
+        Rider rider = riders[index];
+        int last = riders.Count - 1;
+
+        riders[index] = riders[last];
+        riders[index].index = index;
+        riders.RemoveAt(last);
+
+        if (rider.transform != null)
+        {
+            riderLookup.Remove(rider.transform);
+            if (GetBase(rider.transform) == this)
+                riderBases.Remove(rider.transform);
+        }
+        else
+        {
+            // Destroyed rider: drop the dead keys
+            var stale = new List<Transform>();
+            foreach (KeyValuePair<Transform, Rider> pair in riderLookup)
+                if (pair.Key == null) stale.Add(pair.Key);
+            foreach (Transform key in stale)
+            {
+                riderLookup.Remove(key);
+                riderBases.Remove(key);
+            }
+        }
+    }
+
+    private static Transform RiderRoot(Collider other)
+    {
+        return other.attachedRigidbody != null ? other.attachedRigidbody.transform : other.transform;
+    }
+
+    private void OnTriggerEnter(Collider other)
+    {
+        if (attachOnTrigger && !other.transform.IsChildOf(transform))
+            Attach(RiderRoot(other));
+    }
+
+    private void OnTriggerExit(Collider other)
+    {
+        if (attachOnTrigger)
+            Detach(RiderRoot(other), false);
+    }
+}
@@ -0,0 +1,78 @@
+using NUnit.Framework;
+
+// Dispatch quality of ElevatorBankLogic, run headless through ElevatorBankSimulator: 100 passengers over 12 floors with the
+// default seed, for one to four cars. Every passenger must arrive, and average wait, max wait and throughput must stay
+// within the committed thresholds below (the numbers the simulator gave when they were set, plus about 10%).
+// Also checks that hall calls move off a car that is full or out of service.
+public class ElevatorDispatchTests
+{
+    private const int PassengerCount = 100;
+
+    // Car count, max average wait (s), max single wait (s), min throughput (passengers / min)
+    private static readonly object[] Thresholds =
+    {
+        new object[] { 1, 235f, 590f, 8.3f },
+        new object[] { 2, 97f, 265f, 15.1f },
+        new object[] { 3, 68f, 162f, 18.9f },
+        new object[] { 4, 32f, 114f, 24.4f },
+    };
+
+    [TestCaseSource(nameof(Thresholds))]
+    public void Simulator_100Passengers_StaysWithinThresholds(int carCount, float maxAverageWait, float maxWait, float minThroughput)
+    {
+        ElevatorBankSimulator.Settings settings = ElevatorBankSimulator.Settings.Default;
+        settings.passengerCount = PassengerCount;
+        settings.carCount = carCount;
+
+        ElevatorBankSimulator.Result result = ElevatorBankSimulator.Run(settings);
+        TestContext.WriteLine($"{carCount} car(s): {result}");
+
+        Assert.AreEqual(PassengerCount, result.delivered, "Delivered");
+        Assert.LessOrEqual(result.averageWait, maxAverageWait, "Average wait");
+        Assert.LessOrEqual(result.maxWait, maxWait, "Max wait");
+        Assert.GreaterOrEqual(result.throughputPerMinute, minThroughput, "Throughput");
+    }
+
+    [Test]
+    public void RequestHallCall_KeepsTheAssignedCar()
+    {
+        ElevatorBankLogic logic = TwoCarBank();
+
+        Assert.AreEqual(0, logic.RequestHallCall(2, HallCallDirection.Up));
+        Assert.AreEqual(0, logic.RequestHallCall(2, HallCallDirection.Up));
+    }
+
+    [Test]
+    public void RequestHallCall_WhenTheCarIsFull_AssignsAnotherCar()
+    {
+        ElevatorBankLogic logic = TwoCarBank();
+        Assert.AreEqual(0, logic.RequestHallCall(2, HallCallDirection.Up));
+
+        logic.Cars[0].Load = logic.Cars[0].Capacity; // Left with a full car, the passenger presses again
+        Assert.AreEqual(1, logic.RequestHallCall(2, HallCallDirection.Up));
+        Assert.IsFalse(logic.Cars[0].UpCalls[2]);
+        Assert.IsTrue(logic.Cars[1].UpCalls[2]);
+    }
+
+    [Test]
+    public void SetOutOfService_MovesItsHallCallsToAnotherCar()
+    {
+        ElevatorBankLogic logic = TwoCarBank();
+        Assert.AreEqual(0, logic.RequestHallCall(3, HallCallDirection.Down));
+        logic.RequestCarCall(0, 5);
+
+        logic.SetOutOfService(0, true);
+        Assert.IsFalse(logic.Cars[0].DownCalls[3]);
+        Assert.IsTrue(logic.Cars[1].DownCalls[3]);
+        Assert.IsTrue(logic.Cars[0].CarCalls[5], "Car calls stay with the car");
+        Assert.AreEqual(1, logic.RequestHallCall(1, HallCallDirection.Up), "New calls skip the car");
+    }
+
+    // Ten floors, car 0 idle at the bottom and car 1 idle at the top
+    private static ElevatorBankLogic TwoCarBank()
+    {
+        var logic = new ElevatorBankLogic(10, 2, 4);
+        logic.Cars[1].Position = 9f;
+        return logic;
+    }
+}
@@ -0,0 +1,56 @@
+using System.Collections;
+using NUnit.Framework;
+using Unity.PerformanceTesting;
+using UnityEditor;
+using UnityEngine;
+using UnityEngine.TestTools;
+
+// Times frames in Play mode while the moving platform stress test carries its 50 riders, half CharacterControllers and
+// half dynamic Rigidbodies, up and down a fast car. Compared with PerfBaselines/Elevator.json.
+public class ElevatorPerformanceTests
+{
+    private const int RiderCount = 50;
+
+    [UnityTearDown]
+    public IEnumerator TearDown()
+    {
+        if (Application.isPlaying)
+            yield return new ExitPlayMode();
+    }
+
+    [UnityTest, Performance]
+    public IEnumerator Frames_WithRidersAboard()
+    {
+        yield return new EnterPlayMode();
+        Random.InitState(0); // Same rider layout every run
+
+        // Car: a floor whose top is at the stress test's default floor height, and a trigger volume above it
+        var platform = new GameObject("Platform");
+        var volume = platform.AddComponent<BoxCollider>();
+        volume.isTrigger = true;
+        volume.center = new Vector3(0f, 1.5f, 0f);
+        volume.size = new Vector3(8f, 2f, 8f);
+        platform.AddComponent<MovingPlatform>();
+
+        var floor = GameObject.CreatePrimitive(PrimitiveType.Cube);
+        floor.transform.SetParent(platform.transform, false);
+        floor.transform.localScale = new Vector3(8f, 1f, 8f);
+
+        // Inactive until the platform is assigned, the stress test reads it in Start
+        var stressTest = new GameObject("MovingPlatformStressTest");
+        stressTest.SetActive(false);
+        var settings = new SerializedObject(stressTest.AddComponent<MovingPlatformStressTest>());
+        settings.FindProperty("platform").objectReferenceValue = platform.GetComponent<MovingPlatform>();
+        settings.FindProperty("riderCount").intValue = RiderCount;
+        settings.ApplyModifiedPropertiesWithoutUndo();
+        stressTest.SetActive(true);
+
+        yield return null; // Riders spawn
+        yield return new WaitForFixedUpdate(); // and settle onto the floor before sampling
+
+        // Lost riders still count towards the frame, the stress test's report says how many there are
+        yield return PerfBaseline.Frames($"Frame_{RiderCount}Riders", 300);
+
+        PerfBaseline.AssertWithin("Elevator");
+    }
+}
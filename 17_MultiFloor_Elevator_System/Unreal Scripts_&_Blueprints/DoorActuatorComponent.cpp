@@ -0,0 +1,163 @@
+#include "DoorActuatorComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Curves/CurveFloat.h"
+
+UDoorActuatorComponent::UDoorActuatorComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+void UDoorActuatorComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    for (FDoorLeaf& Leaf : Leaves) Capture(Leaf);
+    Apply();
+    RefreshSleep();
+}
+
+void UDoorActuatorComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    TickActuator(DeltaTime);
+}
+
+void UDoorActuatorComponent::AddLeaf(USceneComponent* Leaf, EDoorLeafMode Mode, FVector OpenOffset, float OpenAngle)
+{
+    if (!Leaf) return;
+
+    FDoorLeaf& Entry = Leaves.AddDefaulted_GetRef();
+    Entry.Leaf = Leaf;
+    Entry.Mode = Mode;
+    Entry.OpenOffset = OpenOffset;
+    Entry.OpenAngle = OpenAngle;
+    Capture(Entry);
+}
+
+void UDoorActuatorComponent::Open()
+{
+    HoldTimer = 0.f;
+    bReopenedByObstruction = false;
+    SetDirection(Progress >= 1.f ? 0 : 1);
+}
+
+void UDoorActuatorComponent::Close()
+{
+    HoldTimer = 0.f;
+    bReopenedByObstruction = false;
+    SetDirection(Progress <= 0.f ? 0 : -1);
+}
+
+void UDoorActuatorComponent::Toggle()
+{
+    if (Direction > 0 || (Direction == 0 && Progress >= 1.f)) Close();
+    else Open();
+}
+
+void UDoorActuatorComponent::SetOpenInstant(bool bOpen)
+{
+    HoldTimer = 0.f;
+    Progress = bOpen ? 1.f : 0.f;
+    Direction = 0;
+    Apply();
+    RefreshSleep();
+}
+
+void UDoorActuatorComponent::TickActuator(float DeltaTime)
+{
+    if (HoldTimer > 0.f)
+    {
+        HoldTimer -= DeltaTime;
+        if (HoldTimer <= 0.f)
+        {
+            HoldTimer = 0.f;
+            SetDirection(-1);
+        }
+        return;
+    }
+
+    if (Direction == 0) { RefreshSleep(); return; }
+
+    if (Direction < 0 && IsObstructed())
+    {
+        Direction = 1;
+        bReopenedByObstruction = true;
+        OnObstructed.Broadcast();
+    }
+
+    const float Duration = Direction > 0 ? OpenDuration : CloseDuration;
+    Progress = Duration > 0.f ? FMath::Clamp(Progress + Direction * DeltaTime / Duration, 0.f, 1.f) : (Direction > 0 ? 1.f : 0.f);
+    Apply();
+
+    if (Direction > 0 && Progress >= 1.f)
+    {
+        Direction = 0;
+        if (bReopenedByObstruction)
+        {
+            bReopenedByObstruction = false;
+            HoldTimer = FMath::Max(KINDA_SMALL_NUMBER, ReopenHoldTime);
+        }
+        OnOpened.Broadcast();
+    }
+    else if (Direction < 0 && Progress <= 0.f)
+    {
+        Direction = 0;
+        OnClosed.Broadcast();
+    }
+
+    RefreshSleep();
+}
+
+void UDoorActuatorComponent::SetDirection(int32 NewDirection)
+{
+    Direction = NewDirection;
+    RefreshSleep();
+}
+
+void UDoorActuatorComponent::RefreshSleep()
+{
+    SetComponentTickEnabled(!bTickedByOwner && IsAwake());
+}
+
+bool UDoorActuatorComponent::IsObstructed() const
+{
+    if (!ObstructionVolume) return false;
+
+    TArray<AActor*> Overlapping;
+    ObstructionVolume->GetOverlappingActors(Overlapping);
+    for (const AActor* Actor : Overlapping)
+    {
+        if (Actor && Actor != GetOwner()) return true;
+    }
+    return false;
+}
+
+void UDoorActuatorComponent::Apply()
+{
+    const float Alpha = Curve ? Curve->GetFloatValue(Progress) : FMath::SmoothStep(0.f, 1.f, Progress);
+
+    for (const FDoorLeaf& Leaf : Leaves)
+    {
+        if (!Leaf.Leaf || !Leaf.bCaptured) continue;
+
+        if (Leaf.Mode == EDoorLeafMode::Sliding)
+        {
+            Leaf.Leaf->SetRelativeLocation(Leaf.ClosedLocation + Leaf.OpenOffset * Alpha);
+        }
+        else
+        {
+            const FQuat Swing(Leaf.HingeAxis.GetSafeNormal(), FMath::DegreesToRadians(Leaf.OpenAngle * Alpha));
+            Leaf.Leaf->SetRelativeRotation(Leaf.ClosedRotation * Swing);
+        }
+    }
+}
+
+void UDoorActuatorComponent::Capture(FDoorLeaf& Leaf)
+{
+    if (Leaf.bCaptured || !Leaf.Leaf) return;
+
+    Leaf.ClosedLocation = Leaf.Leaf->GetRelativeLocation();
+    Leaf.ClosedRotation = Leaf.Leaf->GetRelativeRotation().Quaternion();
+    Leaf.bCaptured = true;
+}
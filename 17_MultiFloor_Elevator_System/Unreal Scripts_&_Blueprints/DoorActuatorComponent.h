@@ -0,0 +1,155 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "DoorActuatorComponent.generated.h"
+
+class UCurveFloat;
+class UPrimitiveComponent;
+
+UENUM(BlueprintType)
+enum class EDoorLeafMode : uint8
+{
+    Sliding,
+    Hinged
+};
+
+USTRUCT(BlueprintType)
+struct FDoorLeaf
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Door")
+    USceneComponent* Leaf = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Door")
+    EDoorLeafMode Mode = EDoorLeafMode::Sliding;
+
+    // Sliding: relative offset when fully open
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Door")
+    FVector OpenOffset = FVector(100.f, 0.f, 0.f);
+
+    // Hinged: relative axis and angle (degrees) when fully open
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Door")
+    FVector HingeAxis = FVector::UpVector;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Door")
+    float OpenAngle = 90.f;
+
+    FVector ClosedLocation = FVector::ZeroVector;
+    FQuat ClosedRotation = FQuat::Identity;
+    bool bCaptured = false;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FDoorActuatorEvent);
+
+/* --------------------------------------------------------------------------
+   Curve-driven door / actuator for one or more leaves (sliding or hinged).
+
+   • Progress runs 0 (closed) -> 1 (open) and the curve maps it to the leaf pose,
+     so Open() / Close() can reverse the motion at any point without a jump.
+   • While closing, an optional obstruction volume reopens the doors, holds them
+     and retries.
+   • OnOpened / OnClosed fire at the fully open / closed keyframes.
+   • Sleeps when idle: its own tick is disabled, or with bTickedByOwner the owner
+     calls TickActuator() from its Tick only while IsAwake() is true.
+   -------------------------------------------------------------------------- */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class MECHANICS_TEST_LVN_API UDoorActuatorComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UDoorActuatorComponent();
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Door")
+    TArray<FDoorLeaf> Leaves;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Door")
+    float OpenDuration = 0.5f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Door")
+    float CloseDuration = 0.5f;
+
+    // Maps progress (0-1) to leaf pose (0-1). Smooth step when empty.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Door")
+    UCurveFloat* Curve = nullptr;
+
+    // When true, the component never ticks itself and the owner calls TickActuator
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Door")
+    bool bTickedByOwner = false;
+
+    // Anything overlapping it while closing reopens the doors
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Obstruction")
+    UPrimitiveComponent* ObstructionVolume = nullptr;
+
+    // Time held open after an obstruction before closing again
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Obstruction")
+    float ReopenHoldTime = 1.f;
+
+    UPROPERTY(BlueprintAssignable, Category="Door")
+    FDoorActuatorEvent OnOpened;
+
+    UPROPERTY(BlueprintAssignable, Category="Door")
+    FDoorActuatorEvent OnClosed;
+
+    UPROPERTY(BlueprintAssignable, Category="Door")
+    FDoorActuatorEvent OnObstructed;
+
+    UFUNCTION(BlueprintCallable, Category="Door")
+    void AddLeaf(USceneComponent* Leaf, EDoorLeafMode Mode, FVector OpenOffset, float OpenAngle = 90.f);
+
+    UFUNCTION(BlueprintCallable, Category="Door")
+    void Open();
+
+    UFUNCTION(BlueprintCallable, Category="Door")
+    void Close();
+
+    UFUNCTION(BlueprintCallable, Category="Door")
+    void Toggle();
+
+    UFUNCTION(BlueprintCallable, Category="Door")
+    void SetOpenInstant(bool bOpen);
+
+    void TickActuator(float DeltaTime);
+
+    UFUNCTION(BlueprintPure, Category="Door")
+    float GetProgress() const { return Progress; }
+
+    UFUNCTION(BlueprintPure, Category="Door")
+    bool IsMoving() const { return Direction != 0; }
+
+    UFUNCTION(BlueprintPure, Category="Door")
+    bool IsClosing() const { return Direction < 0; }
+
+    UFUNCTION(BlueprintPure, Category="Door")
+    bool IsOpen() const { return Direction == 0 && Progress >= 1.f; }
+
+    UFUNCTION(BlueprintPure, Category="Door")
+    bool IsClosed() const { return Direction == 0 && Progress <= 0.f && HoldTimer <= 0.f; }
+
+    // Reopened by an obstruction, will close again on its own
+    UFUNCTION(BlueprintPure, Category="Door")
+    bool IsHoldingOpen() const { return HoldTimer > 0.f; }
+
+    UFUNCTION(BlueprintPure, Category="Door")
+    bool IsAwake() const { return Direction != 0 || HoldTimer > 0.f; }
+
+    bool HasLeaves() const { return Leaves.Num() > 0; }
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+    float Progress = 0.f;
+    int32 Direction = 0; // +1 opening, -1 closing, 0 idle
+    float HoldTimer = 0.f;
+    bool bReopenedByObstruction = false;
+
+    void SetDirection(int32 NewDirection);
+    void RefreshSleep();
+    bool IsObstructed() const;
+    void Apply();
+    static void Capture(FDoorLeaf& Leaf);
+};
@@ -1,5 +1,8 @@
 #include "Elevator.h"
 
+#include "ElevatorBank.h"
+#include "DoorActuatorComponent.h"
+#include "MovingPlatformComponent.h"
 #include "FP_Character.h"
 #include "GameFramework/Character.h"
 #include "Components/BoxComponent.h"
@@ -9,7 +12,8 @@
 AElevator::AElevator()
 {
     PrimaryActorTick.bCanEverTick = true;
-    PrimaryActorTick.TickGroup = TG_PostUpdateWork;
+    // Riders' movement components tick after the car (see UMovingPlatformComponent), so the car moves first
+    PrimaryActorTick.TickGroup = TG_PrePhysics;
 
     RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
 
@@ -18,6 +22,15 @@ AElevator::AElevator()
     
     ElevatorTrigger->OnComponentBeginOverlap.AddDynamic(this, &AElevator::OnOverlapBegin);
     ElevatorTrigger->OnComponentEndOverlap.AddDynamic(this, &AElevator::OnOverlapEnd);
+
+    DoorObstruction = CreateDefaultSubobject<UBoxComponent>(TEXT("DoorObstruction"));
+    DoorObstruction->SetupAttachment(RootComponent);
+    DoorObstruction->InitBoxExtent(FVector::ZeroVector);
+
+    Platform = CreateDefaultSubobject<UMovingPlatformComponent>(TEXT("Platform"));
+
+    Doors = CreateDefaultSubobject<UDoorActuatorComponent>(TEXT("Doors"));
+    Doors->bTickedByOwner = true;
 }
 
 void AElevator::BeginPlay()
@@ -25,14 +38,17 @@ void AElevator::BeginPlay()
     Super::BeginPlay();
     CurrentFloor = InitialFloor;
     bWasCalledExternally = false;
+    Platform->BindToVolume(ElevatorTrigger);
 
-    if (bUseDoors && DoorLeft && DoorRight)
+    if (bUseDoors && DoorLeft && DoorRight && !Doors->HasLeaves())
     {
-        LeftClosedPos = DoorLeft->GetRelativeLocation();
-        RightClosedPos = DoorRight->GetRelativeLocation();
-        LeftOpenPos = LeftClosedPos + FVector(-DoorOpenDistance, 0, 0);
-        RightOpenPos = RightClosedPos + FVector(DoorOpenDistance, 0, 0);
+        Doors->AddLeaf(DoorLeft, EDoorLeafMode::Sliding, FVector(-DoorOpenDistance, 0, 0));
+        Doors->AddLeaf(DoorRight, EDoorLeafMode::Sliding, FVector(DoorOpenDistance, 0, 0));
+        Doors->OpenDuration = Doors->CloseDuration = 1.f / FMath::Max(0.01f, DoorSpeed);
     }
+    if (!Doors->ObstructionVolume) Doors->ObstructionVolume = DoorObstruction;
+    Doors->OnOpened.AddDynamic(this, &AElevator::OnDoorsOpened);
+    Doors->OnClosed.AddDynamic(this, &AElevator::OnDoorsClosed);
 
     if(Floors.IsValidIndex(CurrentFloor)) 
     {
@@ -46,10 +62,15 @@ void AElevator::Tick(float DeltaTime)
     Super::Tick(DeltaTime);
     if (State == EElevatorState::Moving) MovementTick(DeltaTime);
     else if (State == EElevatorState::Rotating) RotationTick(DeltaTime);
+
+    // The doors sleep between movements
+    if (Doors->IsAwake()) Doors->TickActuator(DeltaTime);
 }
 
 void AElevator::CallElevator(int32 FloorIndex)
 {
+    if (Bank) { Bank->CallElevator(FloorIndex); return; }
+
     if (State != EElevatorState::Idle) return;
 
     bWasCalledExternally = true; 
@@ -59,6 +80,13 @@ void AElevator::CallElevator(int32 FloorIndex)
 }
 
 void AElevator::MoveToFloor(int32 FloorIndex)
+{
+    if (Bank) { Bank->RequestFloor(this, FloorIndex); return; }
+
+    StartTrip(FloorIndex);
+}
+
+void AElevator::StartTrip(int32 FloorIndex)
 {
     if (!Floors.IsValidIndex(FloorIndex) || FloorIndex == CurrentFloor) return;
 
@@ -67,6 +95,7 @@ void AElevator::MoveToFloor(int32 FloorIndex)
         FloorQueue.Empty();
         int32 Step = (FloorIndex > CurrentFloor) ? 1 : -1;
         for (int32 F = CurrentFloor + Step; F != FloorIndex + Step; F += Step) FloorQueue.Add(F);
+        TripDestination = FloorIndex;
         return;
     }
 
@@ -75,6 +104,7 @@ void AElevator::MoveToFloor(int32 FloorIndex)
     FloorQueue.Empty();
     int32 Step = (FloorIndex > CurrentFloor) ? 1 : -1;
     for (int32 F = CurrentFloor + Step; F != FloorIndex + Step; F += Step) FloorQueue.Add(F);
+    TripDestination = FloorIndex;
     
     if (bUseDoors) 
     {
@@ -83,6 +113,25 @@ void AElevator::MoveToFloor(int32 FloorIndex)
     else StartNextSegment();
 }
 
+bool AElevator::RetargetTrip(int32 FloorIndex)
+{
+    if (State != EElevatorState::Moving || !Floors.IsValidIndex(FloorIndex)) return false;
+
+    const int32 Step = (TripDestination > CurrentFloor) ? 1 : -1;
+    if ((FloorIndex - TargetFloor) * Step < 0) return false;
+
+    FloorQueue.Empty();
+    for (int32 F = TargetFloor + Step; F != FloorIndex + Step; F += Step) FloorQueue.Add(F);
+    TripDestination = FloorIndex;
+    return true;
+}
+
+float AElevator::GetFloorPosition() const
+{
+    if (State != EElevatorState::Moving || TravelTime <= 0.f) return CurrentFloor;
+    return FMath::Lerp(static_cast<float>(CurrentFloor), static_cast<float>(TargetFloor), FMath::Clamp(MoveTimer / TravelTime, 0.f, 1.f));
+}
+
 void AElevator::OpenDoors() 
 { 
     if (bUseDoors) 
@@ -97,6 +146,7 @@ void AElevator::CloseDoors()
 { 
     if (bUseDoors) 
     {
+        bDoorsOpen = false;
         State = EElevatorState::ClosingDoors;
         AnimateDoors(false); 
     }
@@ -105,52 +155,49 @@ void AElevator::CloseDoors()
 
 void AElevator::AnimateDoors(bool bOpening)
 {
-    if (!DoorLeft || !DoorRight) 
+    if (!Doors->HasLeaves()) 
     { 
         if (bOpening) State = EElevatorState::Idle; 
         else StartNextSegment(); 
         return; 
     }
 
-    DoorLTarget = bOpening ? LeftOpenPos : LeftClosedPos;
-    DoorRTarget = bOpening ? RightOpenPos : RightClosedPos;
-    bAnimatingDoorsForward = bOpening;
-    GetWorldTimerManager().SetTimer(DoorAnimationTimer, this, &AElevator::DoorAnimationTick, 0.016f, true);
+    // Reverses from the current pose if the doors are still moving
+    if (bOpening) Doors->Open();
+    else Doors->Close();
+
+    // Already there: no keyframe event will fire
+    if (bOpening && Doors->IsOpen()) OnDoorsOpened();
+    else if (!bOpening && Doors->IsClosed()) OnDoorsClosed();
 }
 
-void AElevator::DoorAnimationTick()
+void AElevator::OnDoorsOpened()
 {
-    DoorLeft->SetRelativeLocation(FMath::VInterpTo(DoorLeft->GetRelativeLocation(), DoorLTarget, 0.016f, DoorSpeed));
-    DoorRight->SetRelativeLocation(FMath::VInterpTo(DoorRight->GetRelativeLocation(), DoorRTarget, 0.016f, DoorSpeed));
+    // Reopened by an obstruction while leaving: the doors close again on their own
+    if (Doors->IsHoldingOpen() && State == EElevatorState::ClosingDoors) return;
+
+    State = EElevatorState::Idle;
+    bDoorsOpen = true;
 
-    if (FVector::DistSquared(DoorLeft->GetRelativeLocation(), DoorLTarget) < 1.f)
+    if (FloorQueue.Num() > 0)
     {
-        GetWorldTimerManager().ClearTimer(DoorAnimationTimer);
-        
-        if (bAnimatingDoorsForward)
-        {
-            State = EElevatorState::Idle;
+        CloseDoors();
+    }
+    else if (MainOccupantCount == 0 && !bWasCalledExternally)
+    {
+        GetWorldTimerManager().SetTimer(AutoMoveTimerHandle, this, &AElevator::CloseDoors, CloseDoorCooldown, false);
+    }
+}
 
-            if (FloorQueue.Num() > 0)
-            {
-                CloseDoors();
-            }
-            else if (MainOccupantCount == 0 && !bWasCalledExternally)
-            {
-                GetWorldTimerManager().SetTimer(AutoMoveTimerHandle, this, &AElevator::CloseDoors, CloseDoorCooldown, false);
-            }
-        }
-        else
-        {
-            if (FloorQueue.Num() > 0) 
-            {
-                StartNextSegment();
-            }
-            else 
-            {
-                State = EElevatorState::Idle;
-            }
-        }
+void AElevator::OnDoorsClosed()
+{
+    if (FloorQueue.Num() > 0) 
+    {
+        StartNextSegment();
+    }
+    else 
+    {
+        State = EElevatorState::Idle;
     }
 }
 
@@ -175,7 +222,7 @@ void AElevator::MovementTick(float DeltaTime)
     float t = FMath::Clamp(MoveTimer / TravelTime, 0.f, 1.f);
     float Curved = MovementCurve ? MovementCurve->GetFloatValue(t) : t;
 
-    SetActorLocation(FMath::Lerp(StartPos, EndPos, Curved), false, nullptr, ETeleportType::TeleportPhysics);
+    Platform->MoveTo(FMath::Lerp(StartPos, EndPos, Curved), GetActorQuat(), DeltaTime);
 
     if (t >= 1.f) {
         CurrentFloor = TargetFloor;
@@ -190,12 +237,15 @@ void AElevator::RotationTick(float DeltaTime)
     float t = FMath::Clamp(RotationTimer / ArrivalRotationTime, 0.f, 1.f);
     float Curved = RotationCurve ? RotationCurve->GetFloatValue(t) : t;
 
-    SetActorRotation(FQuat::Slerp(StartRot, EndRot, Curved), ETeleportType::TeleportPhysics);
+    Platform->MoveTo(GetActorLocation(), FQuat::Slerp(StartRot, EndRot, Curved), DeltaTime);
     if (t >= 1.f) FinishMovement();
 }
 
 void AElevator::FinishMovement()
 {
+    if (State == EElevatorState::Moving) OnArrivedAtFloor.Broadcast(this, CurrentFloor);
+    Platform->Stop();
+
     float Angle = FQuat::ErrorAutoNormalize(GetActorQuat(), EndRot);
     if (Angle > 0.01f && ArrivalRotationTime > 0.f)
     {
@@ -206,6 +256,12 @@ void AElevator::FinishMovement()
     else { OpenDoors(); }
 }
 
+int32 AElevator::GetOccupantCount() const
+{
+    // The platform is bound to the trigger and tracks every rider in it
+    return Platform ? Platform->GetRiderCount() : 0;
+}
+
 void AElevator::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
     if (!OtherActor) return;
@@ -233,7 +289,7 @@ void AElevator::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* Othe
         }
         
         // If this is a main occupant and there are only 2 floors, auto-move to the other floor after cooldown
-        if (Floors.Num() == 2)
+        if (Floors.Num() == 2 && !Bank)
         {
             int32 NextF = (CurrentFloor == 0) ? 1 : 0;
             GetWorldTimerManager().SetTimer(AutoMoveTimerHandle, [this, NextF]() { MoveToFloor(NextF); }, CloseDoorCooldown, false);
@@ -15,6 +15,10 @@ enum class EElevatorState : uint8
     OpeningDoors
 };
 
+class AElevator;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnElevatorArrived, AElevator*, Elevator, int32, Floor);
+
 UCLASS()
 class MECHANICS_TEST_LVN_API AElevator : public AActor
 {
@@ -33,6 +37,14 @@ public:
     UPROPERTY(BlueprintReadWrite, Category="Doors")
     class USceneComponent* DoorRight;
 
+    // Raised when the car stops at a floor, before the doors open
+    UPROPERTY(BlueprintAssignable, Category="Events")
+    FOnElevatorArrived OnArrivedAtFloor;
+
+    // Set by AElevatorBank. Bank cars forward calls to the bank instead of moving on their own.
+    UPROPERTY(Transient, BlueprintReadOnly, Category="Bank")
+    class AElevatorBank* Bank = nullptr;
+
 protected:
     virtual void BeginPlay() override;
     virtual void Tick(float DeltaTime) override;
@@ -40,6 +52,18 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components")
     class UBoxComponent* ElevatorTrigger;
 
+    // Size it over the doorway: anything inside while the doors close reopens them. Zero extent by default (never obstructed).
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components")
+    class UBoxComponent* DoorObstruction;
+
+    // Animates the door leaves on this actor's tick. Filled from DoorLeft / DoorRight when it has no leaves.
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components")
+    class UDoorActuatorComponent* Doors;
+
+    // Moves the car without physics teleports and carries occupants (characters via their MovementBase)
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components")
+    class UMovingPlatformComponent* Platform;
+
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="State")
     EElevatorState State = EElevatorState::Idle;
 
@@ -76,25 +100,20 @@ protected:
 private:
     int32 CurrentFloor = 0;
     int32 TargetFloor = 0;
+    int32 TripDestination = 0;
     TArray<int32> FloorQueue;
 
     FVector StartPos; FVector EndPos;
     FQuat StartRot; FQuat EndRot;
 
-    FVector LeftClosedPos; FVector RightClosedPos;
-    FVector LeftOpenPos; FVector RightOpenPos;
-
     int32 MainOccupantCount = 0;
     float MoveTimer = 0.f;
     float RotationTimer = 0.f;
 
     FTimerHandle AutoMoveTimerHandle;
-    FTimerHandle DoorAnimationTimer;
-
-    bool bAnimatingDoorsForward = false;
-    FVector DoorLTarget; FVector DoorRTarget;
 
     bool bWasCalledExternally;
+    bool bDoorsOpen = false;
 
     void MovementTick(float DeltaTime);
     void RotationTick(float DeltaTime);
@@ -102,10 +121,14 @@ private:
     void FinishMovement();
     
     void AnimateDoors(bool bOpening);
-    void DoorAnimationTick();
-    void OpenDoors();
     void CloseDoors();
 
+    UFUNCTION()
+    void OnDoorsOpened();
+
+    UFUNCTION()
+    void OnDoorsClosed();
+
 public:
     UFUNCTION(BlueprintCallable)
     void CallElevator(int32 FloorIndex);
@@ -113,6 +136,37 @@ public:
     UFUNCTION(BlueprintCallable)
     void MoveToFloor(int32 FloorIndex);
 
+    void OpenDoors();
+
+    // Direct move used by AElevatorBank (and by MoveToFloor for standalone cars)
+    void StartTrip(int32 FloorIndex);
+
+    // Changes the destination of the trip in progress without stopping. Only floors still ahead are accepted.
+    bool RetargetTrip(int32 FloorIndex);
+
+    UFUNCTION(BlueprintPure, Category="State")
+    bool IsIdle() const { return State == EElevatorState::Idle; }
+
+    UFUNCTION(BlueprintPure, Category="State")
+    bool AreDoorsOpen() const { return bDoorsOpen; }
+
+    UFUNCTION(BlueprintPure, Category="State")
+    int32 GetCurrentFloor() const { return CurrentFloor; }
+
+    UFUNCTION(BlueprintPure, Category="State")
+    int32 GetTripDestination() const { return TripDestination; }
+
+    UFUNCTION(BlueprintPure, Category="State")
+    int32 GetFloorCount() const { return Floors.Num(); }
+
+    // Every actor inside the car (props and non-main characters included), like the Unity car's OccupantCount
+    UFUNCTION(BlueprintPure, Category="State")
+    int32 GetOccupantCount() const;
+
+    // Position in floors, fractional while travelling between two floors
+    UFUNCTION(BlueprintPure, Category="State")
+    float GetFloorPosition() const;
+
     UFUNCTION()
     void OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
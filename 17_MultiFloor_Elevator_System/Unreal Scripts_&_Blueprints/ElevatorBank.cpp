@@ -0,0 +1,131 @@
+#include "ElevatorBank.h"
+
+#include "Elevator.h"
+
+AElevatorBank::AElevatorBank()
+{
+    PrimaryActorTick.bCanEverTick = true;
+
+    RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+void AElevatorBank::BeginPlay()
+{
+    Super::BeginPlay();
+
+    int32 FloorCount = 0;
+    for (AElevator* Car : Cars)
+    {
+        if (Car) FloorCount = FMath::Max(FloorCount, Car->GetFloorCount());
+    }
+
+    Logic.Initialize(FloorCount, Cars.Num(), CarCapacity);
+    Logic.FloorsPerSecond = 1.f / FMath::Max(0.01f, EstimatedSecondsPerFloor);
+    Logic.DoorCycleSeconds = DoorDwellTime;
+    Logic.FullCarPenalty = FullCarPenalty;
+    Logic.LoadPenalty = LoadPenalty;
+
+    DwellTimers.Init(0.f, Cars.Num());
+    Travelling.Init(false, Cars.Num());
+
+    for (AElevator* Car : Cars)
+    {
+        if (!Car) continue;
+        Car->Bank = this;
+        Car->OnArrivedAtFloor.AddDynamic(this, &AElevatorBank::HandleArrival);
+    }
+}
+
+void AElevatorBank::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    for (AElevator* Car : Cars)
+    {
+        if (!IsValid(Car)) continue;
+        Car->OnArrivedAtFloor.RemoveDynamic(this, &AElevatorBank::HandleArrival);
+        if (Car->Bank == this) Car->Bank = nullptr;
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AElevatorBank::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    for (int32 i = 0; i < Cars.Num(); ++i)
+    {
+        AElevator* Car = Cars[i];
+        if (!IsValid(Car)) continue;
+
+        FElevatorBankLogic::FCar& State = Logic.Cars[i];
+        State.Position = Car->GetFloorPosition();
+        State.Load = Car->GetOccupantCount();
+        State.bDoorsOpen = Car->AreDoorsOpen();
+
+        if (Travelling[i])
+        {
+            // LOOK: stop on the way if a closer call appeared ahead of the car
+            const int32 Ahead = Logic.GetNextStop(i);
+            if (Ahead != INDEX_NONE && Ahead != Car->GetTripDestination() && IsAhead(Car, Ahead)) Car->RetargetTrip(Ahead);
+            continue;
+        }
+
+        if (DwellTimers[i] > 0.f)
+        {
+            DwellTimers[i] -= DeltaTime;
+            continue;
+        }
+
+        if (!Car->IsIdle()) continue;
+
+        const int32 Next = Logic.GetNextStop(i);
+        if (Next == INDEX_NONE) continue;
+
+        if (Next == Car->GetCurrentFloor())
+        {
+            HandleArrival(Car, Next);
+            Car->OpenDoors();
+            continue;
+        }
+
+        Travelling[i] = true;
+        State.bMoving = true;
+        Car->StartTrip(Next);
+    }
+}
+
+int32 AElevatorBank::CallElevator(int32 FloorIndex)
+{
+    return RequestHallCall(FloorIndex, FloorIndex < Logic.GetFloorCount() - 1 ? EHallCallDirection::Up : EHallCallDirection::Down);
+}
+
+int32 AElevatorBank::RequestHallCall(int32 FloorIndex, EHallCallDirection Direction)
+{
+    const int32 CarIndex = Logic.RequestHallCall(FloorIndex, Direction);
+    if (CarIndex != INDEX_NONE) OnHallCallAssigned.Broadcast(FloorIndex, CarIndex);
+    return CarIndex;
+}
+
+void AElevatorBank::RequestFloor(AElevator* Car, int32 FloorIndex)
+{
+    Logic.RequestCarCall(Cars.IndexOfByKey(Car), FloorIndex);
+}
+
+void AElevatorBank::HandleArrival(AElevator* Car, int32 Floor)
+{
+    const int32 CarIndex = Cars.IndexOfByKey(Car);
+    if (CarIndex == INDEX_NONE) return;
+
+    Travelling[CarIndex] = false;
+    Logic.NotifyArrived(CarIndex, Floor);
+    DwellTimers[CarIndex] = DoorDwellTime;
+}
+
+bool AElevatorBank::IsAhead(const AElevator* Car, int32 Floor) const
+{
+    const float Position = Car->GetFloorPosition();
+    const int32 Destination = Car->GetTripDestination();
+    return Destination > Position
+        ? Floor > Position + 0.5f && Floor < Destination
+        : Floor < Position - 0.5f && Floor > Destination;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "ElevatorBankLogic.h"
+#include "ElevatorBank.generated.h"
+
+class AElevator;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnHallCallAssigned, int32, Floor, int32, CarIndex);
+
+/* --------------------------------------------------------------------------
+   Coordinates several AElevator cars sharing the same floors.
+   Hall calls are assigned by FElevatorBankLogic's cost function and every car
+   runs LOOK scheduling. Cars in the bank forward their own CallElevator /
+   MoveToFloor calls here, so existing button Blueprints keep working.
+   -------------------------------------------------------------------------- */
+UCLASS()
+class MECHANICS_TEST_LVN_API AElevatorBank : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AElevatorBank();
+
+    // All cars must share the same floor list
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cars")
+    TArray<AElevator*> Cars;
+
+    // Main occupants before a car stops taking hall calls
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Cars", meta=(ClampMin="1"))
+    int32 CarCapacity = 8;
+
+    // Time the doors stay open at a stop before the car leaves
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Cars")
+    float DoorDwellTime = 3.f;
+
+    // Should roughly match the cars' TravelTime
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Dispatch Cost")
+    float EstimatedSecondsPerFloor = 5.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Dispatch Cost")
+    float FullCarPenalty = 600.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Dispatch Cost")
+    float LoadPenalty = 4.f;
+
+    UPROPERTY(BlueprintAssignable, Category="Events")
+    FOnHallCallAssigned OnHallCallAssigned;
+
+    // Hall call buttons
+    UFUNCTION(BlueprintCallable, Category="Bank")
+    int32 CallUp(int32 FloorIndex) { return RequestHallCall(FloorIndex, EHallCallDirection::Up); }
+
+    UFUNCTION(BlueprintCallable, Category="Bank")
+    int32 CallDown(int32 FloorIndex) { return RequestHallCall(FloorIndex, EHallCallDirection::Down); }
+
+    // Single-button callers: everything goes up except from the top floor
+    UFUNCTION(BlueprintCallable, Category="Bank")
+    int32 CallElevator(int32 FloorIndex);
+
+    UFUNCTION(BlueprintCallable, Category="Bank")
+    int32 RequestHallCall(int32 FloorIndex, EHallCallDirection Direction);
+
+    // Car (panel) calls
+    UFUNCTION(BlueprintCallable, Category="Bank")
+    void RequestFloor(AElevator* Car, int32 FloorIndex);
+
+    const FElevatorBankLogic& GetLogic() const { return Logic; }
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void Tick(float DeltaTime) override;
+
+private:
+    FElevatorBankLogic Logic;
+    TArray<float> DwellTimers;
+    TBitArray<> Travelling;
+
+    UFUNCTION()
+    void HandleArrival(AElevator* Car, int32 Floor);
+
+    bool IsAhead(const AElevator* Car, int32 Floor) const;
+};
@@ -0,0 +1,451 @@
+#include "ElevatorBankLogic.h"
+
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+void FElevatorBankLogic::Initialize(int32 InFloorCount, int32 CarCount, int32 Capacity)
+{
+    FloorCount = FMath::Max(1, InFloorCount);
+
+    Cars.SetNum(FMath::Max(0, CarCount));
+    for (FCar& Car : Cars)
+    {
+        Car = FCar();
+        Car.Capacity = FMath::Max(1, Capacity);
+        Car.CarCalls.Init(false, FloorCount);
+        Car.UpCalls.Init(false, FloorCount);
+        Car.DownCalls.Init(false, FloorCount);
+    }
+
+    UpAssignment.Init(INDEX_NONE, FloorCount);
+    DownAssignment.Init(INDEX_NONE, FloorCount);
+}
+
+int32 FElevatorBankLogic::RequestHallCall(int32 Floor, EHallCallDirection Dir)
+{
+    if (Floor < 0 || Floor >= FloorCount || Cars.Num() == 0) return INDEX_NONE;
+
+    TArray<int32>& Assignment = Dir == EHallCallDirection::Up ? UpAssignment : DownAssignment;
+    const int32 Current = Assignment[Floor];
+    if (Current != INDEX_NONE && !Cars[Current].IsFull() && !Cars[Current].bOutOfService) return Current;
+
+    int32 Best = INDEX_NONE;
+    float BestCost = TNumericLimits<float>::Max();
+    for (int32 i = 0; i < Cars.Num(); ++i)
+    {
+        if (Cars[i].bOutOfService) continue;
+
+        const float Cost = EstimateCost(Cars[i], Floor, Dir);
+        if (Cost < BestCost) { BestCost = Cost; Best = i; }
+    }
+
+    // No car in service, or the full one is still the cheapest
+    if (Best == INDEX_NONE || Best == Current) return Current;
+
+    if (Current != INDEX_NONE) ClearHallCall(Current, Floor, Dir);
+
+    Assignment[Floor] = Best;
+    if (Dir == EHallCallDirection::Up) Cars[Best].UpCalls[Floor] = true;
+    else Cars[Best].DownCalls[Floor] = true;
+    return Best;
+}
+
+void FElevatorBankLogic::SetOutOfService(int32 CarIndex, bool bOutOfService)
+{
+    if (!Cars.IsValidIndex(CarIndex)) return;
+
+    Cars[CarIndex].bOutOfService = bOutOfService;
+    if (!bOutOfService) return;
+
+    for (int32 Floor = 0; Floor < FloorCount; ++Floor)
+    {
+        if (Cars[CarIndex].UpCalls[Floor]) RequestHallCall(Floor, EHallCallDirection::Up);
+        if (Cars[CarIndex].DownCalls[Floor]) RequestHallCall(Floor, EHallCallDirection::Down);
+    }
+}
+
+void FElevatorBankLogic::RequestCarCall(int32 Car, int32 Floor)
+{
+    if (!Cars.IsValidIndex(Car) || Floor < 0 || Floor >= FloorCount) return;
+    Cars[Car].CarCalls[Floor] = true;
+}
+
+float FElevatorBankLogic::EstimateCost(const FCar& Car, int32 Floor, EHallCallDirection Dir) const
+{
+    const float Distance = FMath::Abs(Car.Position - Floor);
+    const bool bCallUp = Dir == EHallCallDirection::Up;
+    const float MinAhead = Car.bMoving ? 0.5f : 0.f; // A moving car can't stop at the floor it is passing
+
+    float TravelFloors;
+    if (Car.Direction == ECarDirection::Idle
+        || (Car.Direction == ECarDirection::Up && bCallUp && Floor - Car.Position >= MinAhead)
+        || (Car.Direction == ECarDirection::Down && !bCallUp && Car.Position - Floor >= MinAhead))
+    {
+        TravelFloors = Distance; // Idle or on the way
+    }
+    else
+    {
+        // Finish the current sweep, then come back
+        int32 Extreme = Car.Direction == ECarDirection::Up ? HighestStop(Car) : LowestStop(Car);
+        if (Extreme == INDEX_NONE) Extreme = FMath::RoundToInt(Car.Position);
+        TravelFloors = FMath::Abs(Car.Position - Extreme) + FMath::Abs(Extreme - Floor);
+    }
+
+    float Cost = TravelFloors / FMath::Max(0.01f, FloorsPerSecond);
+    Cost += CountStops(Car) * DoorCycleSeconds;
+    Cost += LoadPenalty * Car.Load / FMath::Max(1, Car.Capacity);
+
+    if (Car.bDoorsOpen) Cost += DoorCycleSeconds * 0.5f; // Has to finish its dwell first
+    if (Car.IsFull()) Cost += FullCarPenalty;
+
+    return Cost;
+}
+
+int32 FElevatorBankLogic::GetNextStop(int32 CarIndex)
+{
+    if (!Cars.IsValidIndex(CarIndex)) return INDEX_NONE;
+
+    FCar& Car = Cars[CarIndex];
+    const int32 P = FMath::Clamp(FMath::RoundToInt(Car.Position), 0, FloorCount - 1);
+
+    // Requests at the floor the car is standing on are served first (a full car skips hall calls)
+    const bool bHall = !Car.IsFull();
+    if (!Car.bMoving && (Car.CarCalls[P]
+        || (bHall && Car.Direction != ECarDirection::Down && Car.UpCalls[P])
+        || (bHall && Car.Direction != ECarDirection::Up && Car.DownCalls[P])))
+    {
+        return P;
+    }
+
+    const int32 Up = NextStopUp(Car, P);
+    const int32 Down = NextStopDown(Car, P);
+
+    switch (Car.Direction)
+    {
+    case ECarDirection::Up:
+        if (Up != INDEX_NONE) return Up;
+        break;
+    case ECarDirection::Down:
+        if (Down != INDEX_NONE) return Down;
+        break;
+    default:
+        // Idle: nearest stop
+        if (Up != INDEX_NONE && (Down == INDEX_NONE || Up - P <= P - Down)) { Car.Direction = ECarDirection::Up; return Up; }
+        if (Down != INDEX_NONE) { Car.Direction = ECarDirection::Down; return Down; }
+        break;
+    }
+
+    // Nothing left in the current direction: turn around
+    if (Car.Direction == ECarDirection::Up && Down != INDEX_NONE) { Car.Direction = ECarDirection::Down; return Down; }
+    if (Car.Direction == ECarDirection::Down && Up != INDEX_NONE) { Car.Direction = ECarDirection::Up; return Up; }
+
+    if (bHall && (Car.UpCalls[P] || Car.DownCalls[P])) return P;
+
+    Car.Direction = ECarDirection::Idle;
+    return INDEX_NONE;
+}
+
+ECarDirection FElevatorBankLogic::NotifyArrived(int32 CarIndex, int32 Floor)
+{
+    if (!Cars.IsValidIndex(CarIndex) || Floor < 0 || Floor >= FloorCount) return ECarDirection::Idle;
+
+    FCar& Car = Cars[CarIndex];
+    Car.Position = Floor;
+    Car.bMoving = false;
+
+    const bool bAbove = HasStopsAbove(Car, Floor);
+    const bool bBelow = HasStopsBelow(Car, Floor);
+
+    switch (Car.Direction)
+    {
+    case ECarDirection::Up:
+        if (!bAbove && !Car.UpCalls[Floor])
+            Car.Direction = (Car.DownCalls[Floor] || bBelow) ? ECarDirection::Down : ECarDirection::Idle;
+        break;
+    case ECarDirection::Down:
+        if (!bBelow && !Car.DownCalls[Floor])
+            Car.Direction = (Car.UpCalls[Floor] || bAbove) ? ECarDirection::Up : ECarDirection::Idle;
+        break;
+    default:
+        if (Car.UpCalls[Floor]) Car.Direction = ECarDirection::Up;
+        else if (Car.DownCalls[Floor]) Car.Direction = ECarDirection::Down;
+        else if (bAbove) Car.Direction = ECarDirection::Up;
+        else if (bBelow) Car.Direction = ECarDirection::Down;
+        break;
+    }
+
+    Car.CarCalls[Floor] = false;
+
+    if (Car.Direction != ECarDirection::Down) ClearHallCall(CarIndex, Floor, EHallCallDirection::Up);
+    if (Car.Direction != ECarDirection::Up) ClearHallCall(CarIndex, Floor, EHallCallDirection::Down);
+
+    return Car.Direction;
+}
+
+void FElevatorBankLogic::ClearHallCall(int32 CarIndex, int32 Floor, EHallCallDirection Dir)
+{
+    FCar& Car = Cars[CarIndex];
+    if (Dir == EHallCallDirection::Up)
+    {
+        Car.UpCalls[Floor] = false;
+        if (UpAssignment[Floor] == CarIndex) UpAssignment[Floor] = INDEX_NONE;
+    }
+    else
+    {
+        Car.DownCalls[Floor] = false;
+        if (DownAssignment[Floor] == CarIndex) DownAssignment[Floor] = INDEX_NONE;
+    }
+}
+
+int32 FElevatorBankLogic::NextStopUp(const FCar& Car, int32 P) const
+{
+    const bool bHall = !Car.IsFull();
+    for (int32 F = P + 1; F < FloorCount; ++F)
+    {
+        if (Car.CarCalls[F] || (bHall && Car.UpCalls[F])) return F;
+    }
+
+    // Highest down call above: go up to it and turn there
+    for (int32 F = FloorCount - 1; F > P && bHall; --F)
+    {
+        if (Car.DownCalls[F]) return F;
+    }
+    return INDEX_NONE;
+}
+
+int32 FElevatorBankLogic::NextStopDown(const FCar& Car, int32 P) const
+{
+    const bool bHall = !Car.IsFull();
+    for (int32 F = P - 1; F >= 0; --F)
+    {
+        if (Car.CarCalls[F] || (bHall && Car.DownCalls[F])) return F;
+    }
+
+    // Lowest up call below: go down to it and turn there
+    for (int32 F = 0; F < P && bHall; ++F)
+    {
+        if (Car.UpCalls[F]) return F;
+    }
+    return INDEX_NONE;
+}
+
+bool FElevatorBankLogic::HasStopsAbove(const FCar& Car, int32 Floor) const
+{
+    for (int32 F = Floor + 1; F < FloorCount; ++F) { if (Car.HasStopAt(F)) return true; }
+    return false;
+}
+
+bool FElevatorBankLogic::HasStopsBelow(const FCar& Car, int32 Floor) const
+{
+    for (int32 F = Floor - 1; F >= 0; --F) { if (Car.HasStopAt(F)) return true; }
+    return false;
+}
+
+int32 FElevatorBankLogic::HighestStop(const FCar& Car) const
+{
+    for (int32 F = FloorCount - 1; F >= 0; --F) { if (Car.HasStopAt(F)) return F; }
+    return INDEX_NONE;
+}
+
+int32 FElevatorBankLogic::LowestStop(const FCar& Car) const
+{
+    for (int32 F = 0; F < FloorCount; ++F) { if (Car.HasStopAt(F)) return F; }
+    return INDEX_NONE;
+}
+
+int32 FElevatorBankLogic::CountStops(const FCar& Car) const
+{
+    int32 Count = 0;
+    for (int32 F = 0; F < FloorCount; ++F) { if (Car.HasStopAt(F)) ++Count; }
+    return Count;
+}
+
+// ---------------------------------------------------------------------------
+// Simulator
+// ---------------------------------------------------------------------------
+
+namespace ElevatorBankSim
+{
+    struct FPassenger
+    {
+        int32 Origin = 0;
+        int32 Destination = 0;
+        float SpawnTime = 0.f;
+        float BoardTime = -1.f;
+        float ArriveTime = -1.f;
+
+        EHallCallDirection Direction() const { return Destination > Origin ? EHallCallDirection::Up : EHallCallDirection::Down; }
+    };
+
+    struct FCarRuntime
+    {
+        int32 Target = INDEX_NONE;
+        float DwellRemaining = 0.f;
+        TArray<int32> Riders; // Passenger indices
+    };
+
+    // True when Candidate lies between the car and its current target
+    static bool IsAhead(float Position, int32 Target, int32 Candidate)
+    {
+        return Target > Position
+            ? Candidate > Position + 0.5f && Candidate < Target
+            : Candidate < Position - 0.5f && Candidate > Target;
+    }
+}
+
+FString FElevatorBankSimResult::ToString() const
+{
+    return FString::Printf(TEXT("delivered %d, avg wait %.1fs, max wait %.1fs, avg travel %.1fs, throughput %.1f/min, simulated %.0fs in %.2fms"),
+        Delivered, AverageWait, MaxWait, AverageTravel, ThroughputPerMinute, SimulatedSeconds, WallClockMs);
+}
+
+FElevatorBankSimResult FElevatorBankSimulator::Run(const FElevatorBankSimSettings& Settings)
+{
+    using namespace ElevatorBankSim;
+
+    const double StartTime = FPlatformTime::Seconds();
+    FRandomStream Random(Settings.Seed);
+
+    const int32 FloorCount = FMath::Max(2, Settings.FloorCount);
+    FElevatorBankLogic Logic;
+    Logic.Initialize(FloorCount, FMath::Max(1, Settings.CarCount), FMath::Max(1, Settings.CarCapacity));
+    Logic.FloorsPerSecond = 1.f / FMath::Max(0.01f, Settings.SecondsPerFloor);
+    Logic.DoorCycleSeconds = Settings.DoorDwellSeconds;
+
+    // Generate passengers up front, ordered by spawn time
+    TArray<FPassenger> Passengers;
+    Passengers.SetNum(FMath::Max(0, Settings.PassengerCount));
+    for (FPassenger& P : Passengers)
+    {
+        P.Origin = Random.FRand() < Settings.LobbyShare ? 0 : Random.RandRange(0, FloorCount - 1);
+        do { P.Destination = Random.RandRange(0, FloorCount - 1); } while (P.Destination == P.Origin);
+        P.SpawnTime = Random.FRand() * Settings.SpawnWindowSeconds;
+    }
+    Passengers.Sort([](const FPassenger& A, const FPassenger& B) { return A.SpawnTime < B.SpawnTime; });
+
+    TArray<TArray<int32>> Waiting;
+    Waiting.SetNum(FloorCount);
+
+    TArray<FCarRuntime> Runtimes;
+    Runtimes.SetNum(Logic.Cars.Num());
+
+    const float Dt = FMath::Max(0.001f, Settings.TimeStep);
+    const float Speed = 1.f / FMath::Max(0.01f, Settings.SecondsPerFloor);
+    float Time = 0.f;
+    int32 NextSpawn = 0;
+    int32 Delivered = 0;
+
+    while (Delivered < Passengers.Num() && Time < Settings.MaxSimulatedSeconds)
+    {
+        // Spawn
+        while (NextSpawn < Passengers.Num() && Passengers[NextSpawn].SpawnTime <= Time)
+        {
+            const FPassenger& P = Passengers[NextSpawn];
+            Waiting[P.Origin].Add(NextSpawn++);
+            Logic.RequestHallCall(P.Origin, P.Direction());
+        }
+
+        // Cars
+        for (int32 C = 0; C < Runtimes.Num(); ++C)
+        {
+            FCarRuntime& Runtime = Runtimes[C];
+            FElevatorBankLogic::FCar& Car = Logic.Cars[C];
+
+            if (Runtime.DwellRemaining > 0.f)
+            {
+                Runtime.DwellRemaining -= Dt;
+                if (Runtime.DwellRemaining <= 0.f) Car.bDoorsOpen = false;
+                continue;
+            }
+
+            if (Runtime.Target == INDEX_NONE)
+            {
+                Runtime.Target = Logic.GetNextStop(C);
+                if (Runtime.Target == INDEX_NONE) continue;
+            }
+
+            const float Delta = Runtime.Target - Car.Position;
+            const float Step = Speed * Dt;
+            if (FMath::Abs(Delta) > Step)
+            {
+                Car.bMoving = true;
+                Car.Position += FMath::Sign(Delta) * Step;
+
+                // LOOK may pick a closer stop while the car is travelling
+                const int32 Retarget = Logic.GetNextStop(C);
+                if (Retarget != INDEX_NONE && Retarget != Runtime.Target && IsAhead(Car.Position, Runtime.Target, Retarget))
+                {
+                    Runtime.Target = Retarget;
+                }
+                continue;
+            }
+
+            const int32 Floor = Runtime.Target;
+            Runtime.Target = INDEX_NONE;
+            ECarDirection Leaving = Logic.NotifyArrived(C, Floor);
+
+            // Unload
+            for (int32 R = Runtime.Riders.Num() - 1; R >= 0; --R)
+            {
+                FPassenger& Rider = Passengers[Runtime.Riders[R]];
+                if (Rider.Destination != Floor) continue;
+
+                Rider.ArriveTime = Time;
+                Runtime.Riders.RemoveAtSwap(R);
+                ++Delivered;
+            }
+
+            // Board passengers heading the same way (an idle car takes the first in line's direction)
+            TArray<int32>& Queue = Waiting[Floor];
+            for (int32 W = 0; W < Queue.Num() && Runtime.Riders.Num() < Car.Capacity;)
+            {
+                FPassenger& P = Passengers[Queue[W]];
+                if (Leaving == ECarDirection::Idle)
+                {
+                    Leaving = P.Direction() == EHallCallDirection::Up ? ECarDirection::Up : ECarDirection::Down;
+                }
+
+                if ((Leaving == ECarDirection::Up) != (P.Direction() == EHallCallDirection::Up)) { ++W; continue; }
+
+                P.BoardTime = Time;
+                Runtime.Riders.Add(Queue[W]);
+                Queue.RemoveAt(W);
+                Logic.RequestCarCall(C, P.Destination);
+            }
+
+            Car.Direction = Leaving;
+            Car.Load = Runtime.Riders.Num();
+            Car.bDoorsOpen = true;
+            Runtime.DwellRemaining = Settings.DoorDwellSeconds;
+
+            // Whoever is still waiting presses the button again
+            for (int32 Index : Queue) Logic.RequestHallCall(Floor, Passengers[Index].Direction());
+        }
+
+        Time += Dt;
+    }
+
+    FElevatorBankSimResult Result;
+    Result.Delivered = Delivered;
+    Result.SimulatedSeconds = Time;
+    Result.WallClockMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+    float WaitSum = 0.f, TravelSum = 0.f;
+    int32 Boarded = 0;
+    for (const FPassenger& P : Passengers)
+    {
+        if (P.BoardTime < 0.f) continue;
+
+        const float Wait = P.BoardTime - P.SpawnTime;
+        WaitSum += Wait;
+        Result.MaxWait = FMath::Max(Result.MaxWait, Wait);
+        ++Boarded;
+
+        if (P.ArriveTime >= 0.f) TravelSum += P.ArriveTime - P.BoardTime;
+    }
+
+    Result.AverageWait = Boarded > 0 ? WaitSum / Boarded : 0.f;
+    Result.AverageTravel = Delivered > 0 ? TravelSum / Delivered : 0.f;
+    Result.ThroughputPerMinute = Time > 0.f ? Delivered / (Time / 60.f) : 0.f;
+    return Result;
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ElevatorBankLogic.generated.h"
+
+UENUM(BlueprintType)
+enum class EHallCallDirection : uint8
+{
+    Up,
+    Down
+};
+
+UENUM(BlueprintType)
+enum class ECarDirection : uint8
+{
+    Idle,
+    Up,
+    Down
+};
+
+/* --------------------------------------------------------------------------
+   Engine-free dispatcher for a bank of elevator cars.
+   Hall calls are assigned to the car with the lowest estimated cost (distance,
+   direction, pending stops, load, door state). Each car runs LOOK scheduling:
+   it keeps its direction while there are car calls or same-direction hall calls
+   ahead, then takes the farthest opposite call and turns. Up and down hall calls
+   are kept apart so a car going up never serves a "down" call on its way past.
+   A hall call pressed again while its car is full or out of service goes back
+   through the cost function, so passengers left behind get another car.
+   -------------------------------------------------------------------------- */
+class MECHANICS_TEST_LVN_API FElevatorBankLogic
+{
+public:
+
+    struct FCar
+    {
+        float Position = 0.f; // In floors, fractional while moving
+        bool bMoving = false;
+        bool bDoorsOpen = false;
+        ECarDirection Direction = ECarDirection::Idle;
+        int32 Load = 0;
+        int32 Capacity = 8;
+        bool bOutOfService = false; // Gets no hall calls, see SetOutOfService
+
+        TBitArray<> CarCalls;
+        TBitArray<> UpCalls;   // Hall calls assigned to this car
+        TBitArray<> DownCalls;
+
+        bool IsFull() const { return Load >= Capacity; }
+        bool HasStopAt(int32 Floor) const { return CarCalls[Floor] || UpCalls[Floor] || DownCalls[Floor]; }
+    };
+
+    // Cost tuning (all costs are estimated seconds)
+    float FloorsPerSecond = 0.5f;
+    float DoorCycleSeconds = 4.f; // Door open + dwell + close per stop
+    float FullCarPenalty = 600.f;
+    float LoadPenalty = 4.f;      // Scaled by Load / Capacity
+
+    TArray<FCar> Cars;
+
+    void Initialize(int32 InFloorCount, int32 CarCount, int32 Capacity);
+
+    // Assigns a hall call and returns the chosen car. A call that already has a car keeps it,
+    // unless that car is full or out of service: then the call is assigned again.
+    int32 RequestHallCall(int32 Floor, EHallCallDirection Dir);
+    void RequestCarCall(int32 Car, int32 Floor);
+
+    // Takes a car out of dispatch (or puts it back). Its hall calls go to the other cars, its car calls stay.
+    void SetOutOfService(int32 CarIndex, bool bOutOfService);
+
+    float EstimateCost(const FCar& Car, int32 Floor, EHallCallDirection Dir) const;
+
+    // LOOK: next floor the car should travel to, INDEX_NONE when it has nothing to do
+    int32 GetNextStop(int32 CarIndex);
+
+    // Call when the car stops at a floor. Clears the calls served there and returns the leaving direction.
+    ECarDirection NotifyArrived(int32 CarIndex, int32 Floor);
+
+    bool HasPendingStops(int32 CarIndex) const { return CountStops(Cars[CarIndex]) > 0; }
+    int32 GetFloorCount() const { return FloorCount; }
+
+private:
+
+    int32 FloorCount = 0;
+    TArray<int32> UpAssignment;   // Car serving each up hall call (INDEX_NONE when none)
+    TArray<int32> DownAssignment;
+
+    void ClearHallCall(int32 CarIndex, int32 Floor, EHallCallDirection Dir);
+    int32 NextStopUp(const FCar& Car, int32 P) const;
+    int32 NextStopDown(const FCar& Car, int32 P) const;
+    bool HasStopsAbove(const FCar& Car, int32 Floor) const;
+    bool HasStopsBelow(const FCar& Car, int32 Floor) const;
+    int32 HighestStop(const FCar& Car) const;
+    int32 LowestStop(const FCar& Car) const;
+    int32 CountStops(const FCar& Car) const;
+};
+
+USTRUCT(BlueprintType)
+struct FElevatorBankSimSettings
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Simulation")
+    int32 FloorCount = 12;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Simulation")
+    int32 CarCount = 4;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Simulation")
+    int32 CarCapacity = 8;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Simulation")
+    int32 PassengerCount = 100;
+
+    // Passengers appear uniformly over this window
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Simulation")
+    float SpawnWindowSeconds = 120.f;
+
+    // Fraction of passengers starting at floor 0 (morning rush)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Simulation", meta=(ClampMin="0", ClampMax="1"))
+    float LobbyShare = 0.5f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Simulation")
+    float SecondsPerFloor = 2.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Simulation")
+    float DoorDwellSeconds = 4.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Simulation")
+    float TimeStep = 0.1f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Simulation")
+    float MaxSimulatedSeconds = 3600.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Simulation")
+    int32 Seed = 1234;
+};
+
+USTRUCT(BlueprintType)
+struct FElevatorBankSimResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Simulation")
+    int32 Delivered = 0;
+
+    // Spawn -> boarding
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Simulation")
+    float AverageWait = 0.f;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Simulation")
+    float MaxWait = 0.f;
+
+    // Boarding -> arrival
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Simulation")
+    float AverageTravel = 0.f;
+
+    // Delivered passengers per simulated minute
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Simulation")
+    float ThroughputPerMinute = 0.f;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Simulation")
+    float SimulatedSeconds = 0.f;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Simulation")
+    float WallClockMs = 0.f;
+
+    FString ToString() const;
+};
+
+// Headless fixed-step simulation of FElevatorBankLogic. Seeded, so equal settings give equal numbers.
+struct MECHANICS_TEST_LVN_API FElevatorBankSimulator
+{
+    static FElevatorBankSimResult Run(const FElevatorBankSimSettings& Settings);
+};
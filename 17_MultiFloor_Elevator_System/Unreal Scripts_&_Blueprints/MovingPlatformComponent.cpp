@@ -0,0 +1,250 @@
+#include "MovingPlatformComponent.h"
+#include "MovingPlatformSubsystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+UMovingPlatformComponent::UMovingPlatformComponent()
+{
+    // Moved by the owner's tick through MoveTo
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UMovingPlatformComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (UMovingPlatformSubsystem* Subsystem = GetWorld()->GetSubsystem<UMovingPlatformSubsystem>())
+    {
+        Subsystem->RegisterPlatform(this);
+    }
+}
+
+void UMovingPlatformComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    for (int32 i = Riders.Num() - 1; i >= 0; --i) RemoveRiderAt(i, false);
+
+    if (UMovingPlatformSubsystem* Subsystem = GetWorld()->GetSubsystem<UMovingPlatformSubsystem>())
+    {
+        Subsystem->UnregisterPlatform(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UMovingPlatformComponent::BindToVolume(UPrimitiveComponent* Volume)
+{
+    if (!Volume || BoundVolume == Volume) return;
+
+    if (UPrimitiveComponent* Previous = BoundVolume.Get())
+    {
+        Previous->OnComponentBeginOverlap.RemoveDynamic(this, &UMovingPlatformComponent::OnVolumeBeginOverlap);
+        Previous->OnComponentEndOverlap.RemoveDynamic(this, &UMovingPlatformComponent::OnVolumeEndOverlap);
+    }
+
+    BoundVolume = Volume;
+    Volume->OnComponentBeginOverlap.AddDynamic(this, &UMovingPlatformComponent::OnVolumeBeginOverlap);
+    Volume->OnComponentEndOverlap.AddDynamic(this, &UMovingPlatformComponent::OnVolumeEndOverlap);
+}
+
+void UMovingPlatformComponent::MoveTo(const FVector& Location, const FQuat& Rotation, float DeltaTime)
+{
+    AActor* Owner = GetOwner();
+    USceneComponent* Root = Owner ? Owner->GetRootComponent() : nullptr;
+    if (!Root) return;
+
+    const FVector OldLocation = Root->GetComponentLocation();
+    const FQuat OldRotation = Root->GetComponentQuat();
+    const FVector DeltaLocation = Location - OldLocation;
+    const FQuat DeltaRotation = Rotation * OldRotation.Inverse();
+
+    // Not a physics teleport: kinematic children keep a velocity for contacts
+    Owner->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::None);
+
+    if (DeltaTime > KINDA_SMALL_NUMBER)
+    {
+        LinearVelocity = DeltaLocation / DeltaTime;
+
+        FVector Axis; float Angle;
+        DeltaRotation.GetNormalized().ToAxisAndAngle(Axis, Angle);
+        Angle = FMath::UnwindRadians(Angle);
+        AngularVelocity = FMath::IsNearlyZero(Angle) ? FVector::ZeroVector : Axis * (Angle / DeltaTime);
+    }
+    else
+    {
+        LinearVelocity = FVector::ZeroVector;
+        AngularVelocity = FVector::ZeroVector;
+    }
+
+    // Read by MovementBaseUtility::GetMovementBaseVelocity for non-simulated bases
+    Root->ComponentVelocity = LinearVelocity;
+
+    if (DeltaLocation.IsNearlyZero() && DeltaRotation.Equals(FQuat::Identity)) return;
+
+    for (int32 i = Riders.Num() - 1; i >= 0; --i)
+    {
+        if (!Riders[i].Actor.IsValid()) { RemoveRiderAt(i, false); continue; }
+        CarryRider(Riders[i], OldLocation, DeltaLocation, DeltaRotation);
+    }
+}
+
+void UMovingPlatformComponent::CarryRider(FRider& Rider, const FVector& Pivot, const FVector& DeltaLocation, const FQuat& DeltaRotation)
+{
+    // Characters follow through their MovementBase
+    if (Rider.Movement.IsValid()) return;
+
+    AActor* Actor = Rider.Actor.Get();
+    UPrimitiveComponent* Body = Rider.Body.Get();
+    USceneComponent* Moved = Body ? Body : Actor->GetRootComponent();
+    if (!Moved || Moved->Mobility != EComponentMobility::Movable) return;
+
+    const FVector From = Moved->GetComponentLocation();
+    const FVector To = Pivot + DeltaLocation + DeltaRotation.RotateVector(From - Pivot);
+    const FQuat NewRotation = bRotateRiders ? DeltaRotation * Moved->GetComponentQuat() : Moved->GetComponentQuat();
+
+    // The platform is in the rider's MoveIgnoreActors, so only walls / other props stop the sweep
+    if (Body)
+    {
+        Body->SetWorldLocationAndRotation(To, NewRotation, true, nullptr, ETeleportType::None);
+    }
+    else
+    {
+        Actor->SetActorLocationAndRotation(To, NewRotation, true, nullptr, ETeleportType::None);
+    }
+}
+
+void UMovingPlatformComponent::Stop()
+{
+    LinearVelocity = FVector::ZeroVector;
+    AngularVelocity = FVector::ZeroVector;
+
+    if (USceneComponent* Root = GetOwner() ? GetOwner()->GetRootComponent() : nullptr)
+    {
+        Root->ComponentVelocity = FVector::ZeroVector;
+    }
+}
+
+FVector UMovingPlatformComponent::GetPointVelocity(const FVector& WorldPoint) const
+{
+    const AActor* Owner = GetOwner();
+    const FVector Pivot = Owner ? Owner->GetActorLocation() : FVector::ZeroVector;
+    return LinearVelocity + FVector::CrossProduct(AngularVelocity, WorldPoint - Pivot);
+}
+
+// ---------------------------------------------------------------------------
+// Attachment
+// ---------------------------------------------------------------------------
+
+int32 UMovingPlatformComponent::FindRider(const AActor* Actor) const
+{
+    return Riders.IndexOfByPredicate([Actor](const FRider& Rider) { return Rider.Actor.Get() == Actor; });
+}
+
+bool UMovingPlatformComponent::IsRiding(const AActor* Rider) const
+{
+    return Rider && FindRider(Rider) != INDEX_NONE;
+}
+
+void UMovingPlatformComponent::Attach(AActor* Rider, UPrimitiveComponent* Body)
+{
+    AActor* Owner = GetOwner();
+    if (!Rider || Rider == Owner || Rider->IsAttachedTo(Owner)) return;
+
+    const int32 Existing = FindRider(Rider);
+    if (Existing != INDEX_NONE)
+    {
+        ++Riders[Existing].OverlapCount;
+        return;
+    }
+
+    // A rider has a single base: leave the previous platform first
+    if (UMovingPlatformSubsystem* Subsystem = GetWorld()->GetSubsystem<UMovingPlatformSubsystem>())
+    {
+        if (UMovingPlatformComponent* Previous = Subsystem->SetBase(Rider, this))
+        {
+            Previous->Detach(Rider);
+        }
+    }
+
+    FRider& Entry = Riders.AddDefaulted_GetRef();
+    Entry.Actor = Rider;
+    Entry.OverlapCount = 1;
+
+    if (const ACharacter* Character = Cast<ACharacter>(Rider))
+    {
+        // Tick after the platform owner so the MovementBase has already moved this frame
+        Entry.Movement = Character->GetCharacterMovement();
+        if (Entry.Movement.IsValid()) Entry.Movement->AddTickPrerequisiteActor(Owner);
+    }
+    else
+    {
+        UPrimitiveComponent* RootBody = Cast<UPrimitiveComponent>(Rider->GetRootComponent());
+        if (RootBody && RootBody->IsSimulatingPhysics()) Entry.Body = RootBody;
+        else if (Body && Body->IsSimulatingPhysics()) Entry.Body = Body;
+
+        if (UPrimitiveComponent* Moved = Entry.Body.IsValid() ? Entry.Body.Get() : RootBody)
+        {
+            Moved->IgnoreActorWhenMoving(Owner, true);
+        }
+    }
+
+    Rider->OnDestroyed.AddUniqueDynamic(this, &UMovingPlatformComponent::OnRiderDestroyed);
+}
+
+void UMovingPlatformComponent::Detach(AActor* Rider)
+{
+    const int32 Index = FindRider(Rider);
+    if (Index != INDEX_NONE) RemoveRiderAt(Index, bImpartVelocityOnDetach);
+}
+
+void UMovingPlatformComponent::RemoveRiderAt(int32 Index, bool bImpartVelocity)
+{
+    FRider Rider = Riders[Index];
+    Riders.RemoveAtSwap(Index);
+
+    AActor* Actor = Rider.Actor.Get();
+    if (!Actor) return;
+
+    AActor* Owner = GetOwner();
+    Actor->OnDestroyed.RemoveDynamic(this, &UMovingPlatformComponent::OnRiderDestroyed);
+
+    if (UCharacterMovementComponent* Movement = Rider.Movement.Get())
+    {
+        Movement->RemoveTickPrerequisiteActor(Owner);
+    }
+
+    UPrimitiveComponent* Body = Rider.Body.Get();
+    if (UPrimitiveComponent* Moved = Body ? Body : Cast<UPrimitiveComponent>(Actor->GetRootComponent()))
+    {
+        Moved->IgnoreActorWhenMoving(Owner, false);
+    }
+
+    if (bImpartVelocity && Body && Body->IsSimulatingPhysics())
+    {
+        Body->SetPhysicsLinearVelocity(GetPointVelocity(Body->GetComponentLocation()), true);
+    }
+
+    if (UMovingPlatformSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UMovingPlatformSubsystem>() : nullptr)
+    {
+        Subsystem->ClearBase(Actor, this);
+    }
+}
+
+void UMovingPlatformComponent::OnVolumeBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+    Attach(OtherActor, OtherComp);
+}
+
+void UMovingPlatformComponent::OnVolumeEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+    const int32 Index = FindRider(OtherActor);
+    if (Index == INDEX_NONE) return;
+
+    if (--Riders[Index].OverlapCount <= 0) RemoveRiderAt(Index, bImpartVelocityOnDetach);
+}
+
+void UMovingPlatformComponent::OnRiderDestroyed(AActor* DestroyedActor)
+{
+    const int32 Index = FindRider(DestroyedActor);
+    if (Index != INDEX_NONE) RemoveRiderAt(Index, false);
+}
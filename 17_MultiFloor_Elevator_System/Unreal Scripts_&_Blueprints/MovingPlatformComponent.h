@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "MovingPlatformComponent.generated.h"
+
+class UPrimitiveComponent;
+class UCharacterMovementComponent;
+
+/* --------------------------------------------------------------------------
+   Reusable moving platform (elevator cars, lifts, trains...).
+
+   • The owner moves through MoveTo() instead of teleporting: the move is not a
+     physics teleport, so kinematic floors keep a velocity, and LinearVelocity /
+     AngularVelocity are published every step (also as the root ComponentVelocity,
+     which UCharacterMovementComponent reads when a character leaves its base).
+   • Characters ride through their own MovementBase; the platform only makes their
+     movement tick after the owner so the base has already moved this frame.
+   • Physics bodies and plain actors are carried with a sweep that ignores the
+     platform, so a fast car can't push a prop through the cabin walls.
+   -------------------------------------------------------------------------- */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class MECHANICS_TEST_LVN_API UMovingPlatformComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UMovingPlatformComponent();
+
+    // Characters only receive the yaw part of the rotation (through their MovementBase)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Moving Platform")
+    bool bRotateRiders = true;
+
+    // Physics bodies keep the platform's momentum when they leave
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Moving Platform")
+    bool bImpartVelocityOnDetach = true;
+
+    // Starts attaching / detaching the actors overlapping Volume
+    UFUNCTION(BlueprintCallable, Category="Moving Platform")
+    void BindToVolume(UPrimitiveComponent* Volume);
+
+    UFUNCTION(BlueprintCallable, Category="Moving Platform", meta=(DisplayName="Move To"))
+    void K2_MoveTo(FVector Location, FRotator Rotation, float DeltaTime) { MoveTo(Location, Rotation.Quaternion(), DeltaTime); }
+
+    void MoveTo(const FVector& Location, const FQuat& Rotation, float DeltaTime);
+
+    // Clears the published velocity once the owner stops moving the platform
+    UFUNCTION(BlueprintCallable, Category="Moving Platform")
+    void Stop();
+
+    UFUNCTION(BlueprintCallable, Category="Moving Platform")
+    void Attach(AActor* Rider, UPrimitiveComponent* Body = nullptr);
+
+    // Removes a rider regardless of its overlap counter
+    UFUNCTION(BlueprintCallable, Category="Moving Platform")
+    void Detach(AActor* Rider);
+
+    UFUNCTION(BlueprintPure, Category="Moving Platform")
+    bool IsRiding(const AActor* Rider) const;
+
+    UFUNCTION(BlueprintPure, Category="Moving Platform")
+    int32 GetRiderCount() const { return Riders.Num(); }
+
+    UFUNCTION(BlueprintPure, Category="Moving Platform")
+    FVector GetLinearVelocity() const { return LinearVelocity; }
+
+    // World space, radians per second
+    UFUNCTION(BlueprintPure, Category="Moving Platform")
+    FVector GetAngularVelocity() const { return AngularVelocity; }
+
+    UFUNCTION(BlueprintPure, Category="Moving Platform")
+    FVector GetPointVelocity(const FVector& WorldPoint) const;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    UFUNCTION()
+    void OnVolumeBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+    UFUNCTION()
+    void OnVolumeEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+
+    UFUNCTION()
+    void OnRiderDestroyed(AActor* DestroyedActor);
+
+private:
+    struct FRider
+    {
+        TWeakObjectPtr<AActor> Actor;
+        TWeakObjectPtr<UPrimitiveComponent> Body; // Simulating body, if any
+        TWeakObjectPtr<UCharacterMovementComponent> Movement;
+        int32 OverlapCount = 0;
+    };
+
+    TArray<FRider> Riders;
+    TWeakObjectPtr<UPrimitiveComponent> BoundVolume;
+    FVector LinearVelocity = FVector::ZeroVector;
+    FVector AngularVelocity = FVector::ZeroVector;
+
+    int32 FindRider(const AActor* Actor) const;
+    void RemoveRiderAt(int32 Index, bool bImpartVelocity);
+    void CarryRider(FRider& Rider, const FVector& Pivot, const FVector& DeltaLocation, const FQuat& DeltaRotation);
+};
@@ -0,0 +1,81 @@
+#include "MovingPlatformStressTest.h"
+#include "MovingPlatformComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+AMovingPlatformStressTest::AMovingPlatformStressTest()
+{
+    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.TickGroup = TG_PrePhysics;
+}
+
+void AMovingPlatformStressTest::BeginPlay()
+{
+    Super::BeginPlay();
+
+    PlatformComponent = Platform ? Platform->FindComponentByClass<UMovingPlatformComponent>() : nullptr;
+    if (!PlatformComponent)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MovingPlatformStressTest: Platform has no UMovingPlatformComponent."));
+        SetActorTickEnabled(false);
+        return;
+    }
+
+    // The stress test drives the platform itself
+    Platform->SetActorTickEnabled(false);
+    BaseLocation = Platform->GetActorLocation();
+    BaseRotation = Platform->GetActorQuat();
+
+    FActorSpawnParameters Params;
+    Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    const int32 Characters = CharacterClass ? FMath::RoundToInt(RiderCount * CharacterShare) : 0;
+    for (int32 i = 0; i < RiderCount; ++i)
+    {
+        UClass* Class = i < Characters ? CharacterClass.Get() : PropClass.Get();
+        if (!Class) continue;
+
+        const FVector Local(FMath::FRandRange(-SpawnExtent.X, SpawnExtent.X), FMath::FRandRange(-SpawnExtent.Y, SpawnExtent.Y), SpawnExtent.Z);
+        const FVector Location = Platform->GetActorTransform().TransformPosition(Local);
+
+        if (AActor* Rider = GetWorld()->SpawnActor<AActor>(Class, Location, Platform->GetActorRotation(), Params))
+        {
+            if (APawn* Pawn = Cast<APawn>(Rider)) Pawn->SpawnDefaultController();
+            Riders.Add(Rider);
+        }
+    }
+}
+
+void AMovingPlatformStressTest::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // Cosine travel: peak velocity = amplitude * angular frequency
+    Time += DeltaTime;
+    const float Amplitude = TravelHeight * 0.5f;
+    const float Frequency = PeakSpeed / FMath::Max(1.f, Amplitude);
+    const FVector Location = BaseLocation + FVector::UpVector * (Amplitude - Amplitude * FMath::Cos(Time * Frequency));
+    const FQuat Rotation = BaseRotation * FQuat(FVector::UpVector, FMath::DegreesToRadians(SpinDegreesPerSecond * Time));
+
+    PlatformComponent->MoveTo(Location, Rotation, DeltaTime);
+
+    int32 Lost = 0;
+    const FTransform PlatformTransform = Platform->GetActorTransform();
+    for (const TWeakObjectPtr<AActor>& Rider : Riders)
+    {
+        const AActor* Actor = Rider.Get();
+        if (!Actor) { ++Lost; continue; }
+
+        const float LocalZ = PlatformTransform.InverseTransformPosition(Actor->GetActorLocation()).Z;
+        if (!PlatformComponent->IsRiding(Actor) || LocalZ < SpawnExtent.Z - 100.f) { ++Lost; continue; }
+
+        WorstSink = FMath::Max(WorstSink, SpawnExtent.Z - LocalZ);
+    }
+
+    ReportTimer += DeltaTime;
+    if (ReportTimer < ReportInterval) return;
+
+    ReportTimer = 0.f;
+    UE_LOG(LogTemp, Log, TEXT("[MovingPlatformStressTest] %d riders at %.0f cm/s: %d lost, worst sink %.1f cm"),
+        Riders.Num(), PlatformComponent->GetLinearVelocity().Size(), Lost, WorstSink);
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "MovingPlatformStressTest.generated.h"
+
+class UMovingPlatformComponent;
+
+/* --------------------------------------------------------------------------
+   Stress scene helper: spawns riders on a fast moving platform and logs how
+   many fall off or sink into the floor. Point Platform at an actor with a
+   UMovingPlatformComponent bound to a volume above its floor.
+   -------------------------------------------------------------------------- */
+UCLASS()
+class MECHANICS_TEST_LVN_API AMovingPlatformStressTest : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AMovingPlatformStressTest();
+
+    UPROPERTY(EditAnywhere, Category="Stress Test")
+    AActor* Platform;
+
+    UPROPERTY(EditAnywhere, Category="Stress Test", meta=(ClampMin="1"))
+    int32 RiderCount = 50;
+
+    // Spawned for the first CharacterShare of the riders (leave empty to only spawn props)
+    UPROPERTY(EditAnywhere, Category="Stress Test")
+    TSubclassOf<APawn> CharacterClass;
+
+    // Should simulate physics (e.g. a cube Blueprint)
+    UPROPERTY(EditAnywhere, Category="Stress Test")
+    TSubclassOf<AActor> PropClass;
+
+    UPROPERTY(EditAnywhere, Category="Stress Test", meta=(ClampMin="0", ClampMax="1"))
+    float CharacterShare = 0.5f;
+
+    // Platform-local XY extents and height of the walkable surface
+    UPROPERTY(EditAnywhere, Category="Stress Test")
+    FVector SpawnExtent = FVector(250.f, 250.f, 100.f);
+
+    UPROPERTY(EditAnywhere, Category="Stress Test")
+    float TravelHeight = 4000.f;
+
+    // cm/s at the middle of the trip
+    UPROPERTY(EditAnywhere, Category="Stress Test")
+    float PeakSpeed = 2000.f;
+
+    UPROPERTY(EditAnywhere, Category="Stress Test")
+    float SpinDegreesPerSecond = 0.f;
+
+    UPROPERTY(EditAnywhere, Category="Stress Test")
+    float ReportInterval = 2.f;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void Tick(float DeltaTime) override;
+
+private:
+    UPROPERTY()
+    UMovingPlatformComponent* PlatformComponent;
+
+    TArray<TWeakObjectPtr<AActor>> Riders;
+    FVector BaseLocation;
+    FQuat BaseRotation;
+    float Time = 0.f;
+    float ReportTimer = 0.f;
+    float WorstSink = 0.f;
+};
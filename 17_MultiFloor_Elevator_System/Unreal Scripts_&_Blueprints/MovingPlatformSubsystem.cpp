@@ -0,0 +1,46 @@
+#include "MovingPlatformSubsystem.h"
+#include "MovingPlatformComponent.h"
+
+UMovingPlatformComponent* UMovingPlatformSubsystem::GetBase(const AActor* Rider) const
+{
+    const TWeakObjectPtr<UMovingPlatformComponent>* Base = RiderBases.Find(Rider);
+    return Base ? Base->Get() : nullptr;
+}
+
+FVector UMovingPlatformSubsystem::GetBaseVelocity(const AActor* Rider) const
+{
+    const UMovingPlatformComponent* Base = GetBase(Rider);
+    return (Base && Rider) ? Base->GetPointVelocity(Rider->GetActorLocation()) : FVector::ZeroVector;
+}
+
+void UMovingPlatformSubsystem::RegisterPlatform(UMovingPlatformComponent* Platform)
+{
+    if (Platform) Platforms.AddUnique(Platform);
+}
+
+void UMovingPlatformSubsystem::UnregisterPlatform(UMovingPlatformComponent* Platform)
+{
+    Platforms.RemoveSingleSwap(Platform);
+
+    // Drop this platform's riders and any entries whose rider died
+    for (auto It = RiderBases.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().ResolveObjectPtr() || !It.Value().IsValid() || It.Value().Get() == Platform) It.RemoveCurrent();
+    }
+}
+
+UMovingPlatformComponent* UMovingPlatformSubsystem::SetBase(AActor* Rider, UMovingPlatformComponent* Platform)
+{
+    if (!Rider) return nullptr;
+
+    TWeakObjectPtr<UMovingPlatformComponent>& Base = RiderBases.FindOrAdd(Rider);
+    UMovingPlatformComponent* Previous = Base.Get();
+    Base = Platform;
+    return Previous != Platform ? Previous : nullptr;
+}
+
+void UMovingPlatformSubsystem::ClearBase(AActor* Rider, UMovingPlatformComponent* Platform)
+{
+    const TWeakObjectPtr<UMovingPlatformComponent>* Base = RiderBases.Find(Rider);
+    if (Base && Base->Get() == Platform) RiderBases.Remove(Rider);
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "MovingPlatformSubsystem.generated.h"
+
+class UMovingPlatformComponent;
+
+/* --------------------------------------------------------------------------
+   World registry of moving platforms and their riders.
+   Like a character's MovementBase, every rider has at most one base platform,
+   so a prop standing in two overlapping platform volumes is only carried once.
+   -------------------------------------------------------------------------- */
+UCLASS()
+class MECHANICS_TEST_LVN_API UMovingPlatformSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category="Moving Platform")
+    UMovingPlatformComponent* GetBase(const AActor* Rider) const;
+
+    // Velocity the rider inherits from its base at its current location (zero without a base)
+    UFUNCTION(BlueprintCallable, Category="Moving Platform")
+    FVector GetBaseVelocity(const AActor* Rider) const;
+
+    UFUNCTION(BlueprintCallable, Category="Moving Platform")
+    const TArray<UMovingPlatformComponent*>& GetPlatforms() const { return Platforms; }
+
+    void RegisterPlatform(UMovingPlatformComponent* Platform);
+    void UnregisterPlatform(UMovingPlatformComponent* Platform);
+
+    // Returns the previous base (if any) so it can release the rider
+    UMovingPlatformComponent* SetBase(AActor* Rider, UMovingPlatformComponent* Platform);
+    void ClearBase(AActor* Rider, UMovingPlatformComponent* Platform);
+
+private:
+    UPROPERTY()
+    TArray<UMovingPlatformComponent*> Platforms;
+
+    TMap<TObjectKey<AActor>, TWeakObjectPtr<UMovingPlatformComponent>> RiderBases;
+};
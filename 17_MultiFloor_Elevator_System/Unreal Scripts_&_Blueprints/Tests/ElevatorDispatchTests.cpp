@@ -0,0 +1,93 @@
+#include "Misc/AutomationTest.h"
+#include "ElevatorBankLogic.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Dispatch quality of FElevatorBankLogic, run headless through FElevatorBankSimulator: 100 passengers over 12 floors with
+// the default seed, for one to four cars. Every passenger must arrive, and average wait, max wait and throughput must stay
+// within the committed thresholds below (the numbers the simulator gave when they were set, plus about 10%).
+// Also checks that hall calls move off a car that is full or out of service.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Elevator.Dispatch; Quit" -nullrhi -unattended
+
+namespace ElevatorDispatchTests
+{
+    constexpr int32 PassengerCount = 100;
+
+    struct FThreshold
+    {
+        int32 CarCount;
+        float MaxAverageWait; // Seconds
+        float MaxWait;
+        float MinThroughput;  // Passengers per minute
+    };
+
+    const FThreshold Thresholds[] =
+    {
+        { 1, 201.f, 531.f, 8.6f },
+        { 2, 100.f, 264.f, 14.2f },
+        { 3, 60.f, 138.f, 20.3f },
+        { 4, 41.f, 94.f, 24.4f },
+    };
+
+    // Ten floors, car 0 idle at the bottom and car 1 idle at the top
+    FElevatorBankLogic TwoCarBank()
+    {
+        FElevatorBankLogic Logic;
+        Logic.Initialize(10, 2, 4);
+        Logic.Cars[1].Position = 9.f;
+        return Logic;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FElevatorDispatchSimulatorTest, "LVN.Elevator.Dispatch.Simulator", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FElevatorDispatchSimulatorTest::RunTest(const FString& Parameters)
+{
+    using namespace ElevatorDispatchTests;
+
+    for (const FThreshold& Threshold : Thresholds)
+    {
+        FElevatorBankSimSettings Settings;
+        Settings.PassengerCount = PassengerCount;
+        Settings.CarCount = Threshold.CarCount;
+
+        const FElevatorBankSimResult Result = FElevatorBankSimulator::Run(Settings);
+        const FString What = FString::Printf(TEXT("%d car(s)"), Threshold.CarCount);
+        AddInfo(What + TEXT(": ") + Result.ToString());
+
+        TestEqual(What + TEXT(" delivered"), Result.Delivered, PassengerCount);
+        TestTrue(FString::Printf(TEXT("%s average wait %.1fs <= %.1fs"), *What, Result.AverageWait, Threshold.MaxAverageWait), Result.AverageWait <= Threshold.MaxAverageWait);
+        TestTrue(FString::Printf(TEXT("%s max wait %.1fs <= %.1fs"), *What, Result.MaxWait, Threshold.MaxWait), Result.MaxWait <= Threshold.MaxWait);
+        TestTrue(FString::Printf(TEXT("%s throughput %.1f/min >= %.1f/min"), *What, Result.ThroughputPerMinute, Threshold.MinThroughput), Result.ThroughputPerMinute >= Threshold.MinThroughput);
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FElevatorDispatchReassignTest, "LVN.Elevator.Dispatch.Reassign", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FElevatorDispatchReassignTest::RunTest(const FString& Parameters)
+{
+    using namespace ElevatorDispatchTests;
+
+    // A car with room keeps its call
+    FElevatorBankLogic Logic = TwoCarBank();
+    TestEqual(TEXT("Assigned"), Logic.RequestHallCall(2, EHallCallDirection::Up), 0);
+    TestEqual(TEXT("Pressed again"), Logic.RequestHallCall(2, EHallCallDirection::Up), 0);
+
+    // Left with a full car, the passenger presses again
+    Logic.Cars[0].Load = Logic.Cars[0].Capacity;
+    TestEqual(TEXT("Pressed again at a full car"), Logic.RequestHallCall(2, EHallCallDirection::Up), 1);
+    TestFalse(TEXT("Full car's up call"), static_cast<bool>(Logic.Cars[0].UpCalls[2]));
+    TestTrue(TEXT("Other car's up call"), static_cast<bool>(Logic.Cars[1].UpCalls[2]));
+
+    // Out of service: hall calls move, car calls stay, new calls skip it
+    Logic = TwoCarBank();
+    TestEqual(TEXT("Assigned"), Logic.RequestHallCall(3, EHallCallDirection::Down), 0);
+    Logic.RequestCarCall(0, 5);
+    Logic.SetOutOfService(0, true);
+    TestFalse(TEXT("Out of service car's down call"), static_cast<bool>(Logic.Cars[0].DownCalls[3]));
+    TestTrue(TEXT("Other car's down call"), static_cast<bool>(Logic.Cars[1].DownCalls[3]));
+    TestTrue(TEXT("Car call stays"), static_cast<bool>(Logic.Cars[0].CarCalls[5]));
+    TestEqual(TEXT("New call"), Logic.RequestHallCall(1, EHallCallDirection::Up), 1);
+    return true;
+}
+
+#endif
@@ -0,0 +1,66 @@
+#include "Misc/AutomationTest.h"
+#include "PerfTesting.h"
+#include "MovingPlatformComponent.h"
+#include "MovingPlatformStressTest.h"
+#include "Components/BoxComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Times world ticks in a temporary world while the moving platform stress test carries 50 characters up and down a fast
+// car. Props need a physics Blueprint, so only characters ride here. Compared with PerfBaselines/Elevator.json.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Elevator.Performance; Quit" -nullrhi -unattended
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FElevatorPerformanceRidersTest, "LVN.Elevator.Performance.Riders", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FElevatorPerformanceRidersTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 RiderCount = 50;
+
+    FPerfTestWorld World;
+    FActorSpawnParameters Params;
+    Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    // Car: a floor whose top is 25 cm above the root, and a volume above it
+    AActor* Platform = World.Get()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+    USceneComponent* Root = NewObject<USceneComponent>(Platform);
+    Root->SetMobility(EComponentMobility::Movable);
+    Platform->SetRootComponent(Root);
+    Root->RegisterComponent();
+
+    UStaticMeshComponent* Floor = NewObject<UStaticMeshComponent>(Platform);
+    Floor->SetMobility(EComponentMobility::Movable);
+    Floor->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")));
+    Floor->SetRelativeScale3D(FVector(6.f, 6.f, 0.5f));
+    Floor->SetupAttachment(Root);
+    Floor->RegisterComponent();
+
+    UBoxComponent* Volume = NewObject<UBoxComponent>(Platform);
+    Volume->InitBoxExtent(FVector(300.f, 300.f, 100.f));
+    Volume->SetRelativeLocation(FVector(0.f, 0.f, 125.f));
+    Volume->SetGenerateOverlapEvents(true);
+    Volume->SetupAttachment(Root);
+    Volume->RegisterComponent();
+
+    UMovingPlatformComponent* MovingPlatform = NewObject<UMovingPlatformComponent>(Platform);
+    MovingPlatform->RegisterComponent();
+    MovingPlatform->BindToVolume(Volume);
+
+    // Riders spawn in the stress test's BeginPlay
+    AMovingPlatformStressTest* StressTest = World.Get()->SpawnActorDeferred<AMovingPlatformStressTest>(AMovingPlatformStressTest::StaticClass(), FTransform::Identity, nullptr, nullptr, Params.SpawnCollisionHandlingOverride);
+    StressTest->Platform = Platform;
+    StressTest->RiderCount = RiderCount;
+    StressTest->CharacterClass = ACharacter::StaticClass();
+    StressTest->CharacterShare = 1.f;
+    StressTest->SpawnExtent = FVector(250.f, 250.f, 120.f);
+    StressTest->FinishSpawning(FTransform::Identity);
+
+    // Lost riders still count towards the frame, the stress test's report says how many there are
+    FPerfRecorder Recorder;
+    Recorder.MeasureTicks(FString::Printf(TEXT("Frame_%dRiders"), RiderCount), World, 300, [](int32) {});
+    return Recorder.CheckBaseline(*this, TEXT("Elevator"), __FILE__);
+}
+
+#endif
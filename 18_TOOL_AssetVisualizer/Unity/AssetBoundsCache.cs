@@ -0,0 +1,225 @@
+#if UNITY_EDITOR
+using System;
+using System.Collections.Generic;
+using System.IO;
+using UnityEditor;
+using UnityEngine;
+
+/* --------------------------------------------------------------------------
+   Persistent prefab bounds cache for the Asset Grid Visualizer (editor only).
+
+   • Bounds are measured once per prefab in prefab space (root collider, else root
+     renderer, like AssetGrid.GetAssetBounds) and stored in Library/AssetGridBoundsCache.json,
+     so reopening the project or rebuilding a grid doesn't instantiate anything to measure.
+   • Entries are keyed by asset GUID + local file id and carry the asset's dependency hash:
+     a changed prefab, mesh or import setting misses even if the editor was closed meanwhile.
+   • Reimported or deleted assets are dropped right away by BoundsCachePostprocessor.
+   • TryGetSize() returns the axis aligned size at a given rotation / scale, so the layout
+     can place entries before they are spawned.
+   -------------------------------------------------------------------------- */
+public static class AssetBoundsCache
+{
+    [Serializable]
+    private class Entry
+    {
+        public string key;
+        public string contentHash;
+        public Vector3 center;
+        public Vector3 size;
+    }
+
+    [Serializable]
+    private class CacheFile
+    {
+        public List<Entry> entries = new List<Entry>();
+    }
+
+    private const string CachePath = "Library/AssetGridBoundsCache.json";
+
+    private static Dictionary<string, Entry> entries;
+    private static bool saveQueued;
+
+    public static int Hits { get; private set; }
+    public static int Misses { get; private set; }
+    public static int Invalidations { get; private set; }
+    public static int Count { get { Load(); return entries.Count; } }
+
+    // Prefab space bounds of an asset. False for scene objects, which have no GUID to key on.
+    public static bool TryGetBounds(GameObject prefab, out Bounds bounds)
+    {
+        bounds = default;
+        if (prefab == null || !TryGetKey(prefab, out string key, out string path))
+            return false;
+
+        Load();
+        string contentHash = AssetDatabase.GetAssetDependencyHash(path).ToString();
+
+        if (entries.TryGetValue(key, out Entry entry) && entry.contentHash == contentHash)
+        {
+            Hits++;
+            bounds = new Bounds(entry.center, entry.size);
+            return true;
+        }
+
+        Misses++;
+        bounds = Measure(prefab);
+        entries[key] = new Entry { key = key, contentHash = contentHash, center = bounds.center, size = bounds.size };
+        QueueSave();
+        return true;
+    }
+
+    // Axis aligned size once rotated and scaled, the same box a spawned instance would report
+    public static bool TryGetSize(GameObject prefab, Quaternion rotation, float scale, out Vector3 size)
+    {
+        size = Vector3.zero;
+        if (!TryGetBounds(prefab, out Bounds bounds))
+            return false;
+
+        Vector3 extents = bounds.extents * scale;
+        Vector3 right = rotation * new Vector3(extents.x, 0f, 0f);
+        Vector3 up = rotation * new Vector3(0f, extents.y, 0f);
+        Vector3 forward = rotation * new Vector3(0f, 0f, extents.z);
+
+        size = 2f * new Vector3(
+            Mathf.Abs(right.x) + Mathf.Abs(up.x) + Mathf.Abs(forward.x),
+            Mathf.Abs(right.y) + Mathf.Abs(up.y) + Mathf.Abs(forward.y),
+            Mathf.Abs(right.z) + Mathf.Abs(up.z) + Mathf.Abs(forward.z));
+        return true;
+    }
+
+    public static void Invalidate(string guid)
+    {
+        if (string.IsNullOrEmpty(guid))
+            return;
+
+        Load();
+        string prefix = guid + ":";
+        List<string> stale = null;
+        foreach (string key in entries.Keys)
+        {
+            if (key.StartsWith(prefix, StringComparison.Ordinal))
+                (stale ??= new List<string>()).Add(key);
+        }
+
+        if (stale == null)
+            return;
+
+        foreach (string key in stale)
+            entries.Remove(key);
+
+        Invalidations += stale.Count;
+        QueueSave();
+    }
+
+    // True while any object of the asset has an entry, whether or not it is still up to date
+    public static bool Contains(string guid)
+    {
+        if (string.IsNullOrEmpty(guid))
+            return false;
+
+        Load();
+        string prefix = guid + ":";
+        foreach (string key in entries.Keys)
+        {
+            if (key.StartsWith(prefix, StringComparison.Ordinal))
+                return true;
+        }
+        return false;
+    }
+
+    public static void Clear()
+    {
+        entries = new Dictionary<string, Entry>();
+        Hits = Misses = Invalidations = 0;
+        Save();
+    }
+
+    private static bool TryGetKey(GameObject prefab, out string key, out string path)
+    {
+        key = path = null;
+        if (!AssetDatabase.TryGetGUIDAndLocalFileIdentifier(prefab, out string guid, out long localId))
+            return false;
+
+        path = AssetDatabase.GUIDToAssetPath(guid);
+        key = $"{guid}:{localId}";
+        return !string.IsNullOrEmpty(path);
+    }
+
+    // One hidden instance at the origin; asset objects report empty collider / renderer bounds
+    private static Bounds Measure(GameObject prefab)
+    {
+        GameObject instance = UnityEngine.Object.Instantiate(prefab);
+        instance.hideFlags = HideFlags.HideAndDontSave;
+        instance.transform.SetPositionAndRotation(Vector3.zero, Quaternion.identity);
+        instance.transform.localScale = Vector3.one;
+
+        try
+        {
+            Physics.SyncTransforms();
+            return AssetGrid.GetAssetBounds(instance);
+        }
+        finally
+        {
+            UnityEngine.Object.DestroyImmediate(instance);
+        }
+    }
+
+    private static void Load()
+    {
+        if (entries != null)
+            return;
+
+        entries = new Dictionary<string, Entry>();
+        if (!File.Exists(CachePath))
+            return;
+
+        try
+        {
+            CacheFile file = JsonUtility.FromJson<CacheFile>(File.ReadAllText(CachePath));
+            if (file?.entries == null)
+                return;
+
+            foreach (Entry entry in file.entries)
+                entries[entry.key] = entry;
+        }
+        catch (Exception e)
+        {
+            Debug.LogWarning($"[AssetBoundsCache] Ignoring unreadable cache file: {e.Message}");
+        }
+    }
+
+    // Batches the writes of one layout pass into a single file write
+    private static void QueueSave()
+    {
+        if (saveQueued)
+            return;
+
+        saveQueued = true;
+        EditorApplication.delayCall += Save;
+    }
+
+    private static void Save()
+    {
+        saveQueued = false;
+        if (entries == null)
+            return;
+
+        var file = new CacheFile { entries = new List<Entry>(entries.Values) };
+        File.WriteAllText(CachePath, JsonUtility.ToJson(file));
+    }
+}
+
+// Drops cached bounds as soon as an asset is reimported or deleted (moving keeps the GUID and the bounds)
+public class BoundsCachePostprocessor : AssetPostprocessor
+{
+    private static void OnPostprocessAllAssets(string[] importedAssets, string[] deletedAssets, string[] movedAssets, string[] movedFromAssetPaths)
+    {
+        foreach (string path in importedAssets)
+            AssetBoundsCache.Invalidate(AssetDatabase.AssetPathToGUID(path));
+
+        // Deleted assets no longer resolve through AssetPathToGUID in every version, so ask for deleted ones too
+        foreach (string path in deletedAssets)
+            AssetBoundsCache.Invalidate(AssetDatabase.AssetPathToGUID(path, AssetPathToGUIDOptions.IncludeRecentlyDeletedAssets));
+    }
+}
+#endif
@@ -0,0 +1,427 @@
+using System.Collections.Generic;
+using UnityEngine;
+using Stopwatch = System.Diagnostics.Stopwatch;
+
+#if UNITY_EDITOR
+using UnityEditor;
+#endif
+
+/* --------------------------------------------------------------------------
+   Keyed, incremental layout for one AssetGrid.
+
+   • Every entry is hashed (prefab, scale, rotation, offset) and every row is hashed
+     (its entries + horizontal separation). Rows whose hash didn't change are skipped.
+   • Instances of changed rows go back to a pool keyed by entry hash and by prefab, and
+     new entries claim from it first: identical entries are reused untouched, same prefab
+     entries are reused and re-transformed, only the rest are spawned. Leftovers are destroyed.
+   • Instances live under one container per row and rows under the grid container, so a
+     row shifting down or a grid shifting sideways is a single transform write.
+   • Sizes come from AssetBoundsCache when the prefab is an asset, so with DeferSpawns the
+     layout is final right away and new instances are spawned later by ProcessPending()
+     within a per-frame budget. Scene objects are still instantiated and measured inline.
+   • Hashing is O(entries) arithmetic; spawning, destroying, measuring and moving are O(changed).
+   -------------------------------------------------------------------------- */
+public class AssetGridLayout
+{
+    private class Slot
+    {
+        public GameObject instance;
+        public GameObject prefab;
+        public int hash;
+        public Vector3 size; // Measured bounds at the current scale / rotation
+        public Vector3 localPosition;
+        public bool claimed;
+
+        // Deferred spawn
+        public bool pending;
+        public Transform parent;
+        public Quaternion rotation;
+        public float scale;
+    }
+
+    private class Row
+    {
+        public Transform container;
+        public int hash;
+        public float width;
+        public float height;
+        public float z = float.NaN;
+        public readonly List<Slot> slots = new List<Slot>();
+    }
+
+    private readonly List<Row> rows = new List<Row>();
+    private readonly Dictionary<int, Stack<Slot>> poolByHash = new Dictionary<int, Stack<Slot>>();
+    private readonly Dictionary<GameObject, Stack<Slot>> poolByPrefab = new Dictionary<GameObject, Stack<Slot>>();
+    private readonly List<Slot> pooled = new List<Slot>();
+    private readonly List<int> changedRows = new List<int>();
+    private readonly List<Slot> pendingSpawns = new List<Slot>();
+    private int pendingCursor;
+
+    private Transform container;
+    private float xOffset = float.NaN;
+
+    public Transform Container => container;
+    public float Width { get; private set; }
+    public int AppliedHash { get; private set; }
+    public int InstanceCount { get; private set; }
+    public int PendingCount => pendingSpawns.Count - pendingCursor; // May include cancelled spawns
+    public bool DeferSpawns { get; set; }
+
+    public static int HashEntry(AssetData data)
+    {
+        unchecked
+        {
+            int hash = data.prefab != null ? data.prefab.GetInstanceID() : 0;
+            hash = hash * 31 + data.scaleMultiplier.GetHashCode();
+            hash = hash * 31 + data.rotation.GetHashCode();
+            hash = hash * 31 + data.positionOffset.GetHashCode();
+            return hash;
+        }
+    }
+
+    public void Sync(AssetGrid grid, int gridIndex, Transform parent, float gridXOffset, ref AssetGridLayoutStats stats)
+    {
+        EnsureContainer(gridIndex, parent);
+
+        if (xOffset != gridXOffset)
+        {
+            xOffset = gridXOffset;
+            container.localPosition = new Vector3(gridXOffset, 0f, 0f);
+            stats.gridsShifted++;
+        }
+
+        // 1. Find the rows that changed and pool their instances
+        changedRows.Clear();
+        for (int r = 0; r < grid.rows.Count; r++)
+        {
+            int hash = HashRow(grid.rows[r], grid.HorizontalSeparation);
+            stats.entries += grid.rows[r].assets.Count;
+
+            if (r < rows.Count && rows[r].hash == hash && rows[r].container != null)
+                continue;
+
+            if (r >= rows.Count)
+                rows.Add(new Row());
+
+            rows[r].hash = hash;
+            changedRows.Add(r);
+            PoolSlots(rows[r]);
+        }
+
+        for (int r = rows.Count - 1; r >= grid.rows.Count; r--)
+        {
+            PoolSlots(rows[r]);
+            if (rows[r].container != null)
+                Object.DestroyImmediate(rows[r].container.gameObject);
+            rows.RemoveAt(r);
+        }
+
+        // 2. Rebuild the changed rows from the pool, spawning only what's missing
+        foreach (int r in changedRows)
+            BuildRow(rows[r], grid.rows[r].assets, r, grid.HorizontalSeparation, ref stats);
+
+        foreach (Slot slot in pooled)
+        {
+            if (slot.claimed)
+                continue;
+            if (slot.instance != null)
+                Object.DestroyImmediate(slot.instance);
+            stats.destroyed++;
+        }
+        ClearPool();
+
+        // 3. Stack the rows (one transform write per row that moved)
+        float currentZ = 0f;
+        float width = 0f;
+        int instances = 0;
+        foreach (Row row in rows)
+        {
+            if (row.z != currentZ)
+            {
+                row.z = currentZ;
+                row.container.localPosition = new Vector3(0f, 0f, currentZ);
+                stats.rowsShifted++;
+            }
+
+            currentZ -= row.height + grid.VerticalSeparation;
+            width = Mathf.Max(width, row.width);
+            instances += row.slots.Count;
+        }
+
+        Width = width;
+        InstanceCount = instances;
+        AppliedHash = grid.ComputeHash();
+    }
+
+    public void Clear(ref AssetGridLayoutStats stats)
+    {
+        foreach (Row row in rows)
+            stats.destroyed += row.slots.Count;
+
+        rows.Clear();
+        ClearPool();
+        CancelPending();
+
+        if (container != null)
+            Object.DestroyImmediate(container.gameObject);
+
+        container = null;
+        xOffset = float.NaN;
+        Width = 0f;
+        InstanceCount = 0;
+        AppliedHash = 0;
+    }
+
+    private void BuildRow(Row row, List<AssetData> assets, int rowIndex, float horizontalSeparation, ref AssetGridLayoutStats stats)
+    {
+        if (row.container == null)
+        {
+            row.container = new GameObject($"Row {rowIndex + 1}").transform;
+            row.container.SetParent(container, false);
+            row.z = float.NaN;
+        }
+
+        row.slots.Clear();
+        float currentX = 0f;
+        float height = 0f;
+
+        foreach (AssetData data in assets)
+        {
+            if (data.prefab == null)
+                continue;
+
+            int hash = HashEntry(data);
+            Slot slot = Claim(poolByHash, hash) ?? Claim(poolByPrefab, data.prefab);
+
+            if (slot == null)
+            {
+                slot = Spawn(data, row.container);
+                if (slot.pending)
+                    stats.queued++;
+                else
+                    stats.spawned++;
+            }
+            else
+            {
+                if (slot.instance.transform.parent != row.container)
+                    slot.instance.transform.SetParent(row.container, false);
+
+                if (slot.hash != hash)
+                {
+                    slot.instance.transform.localRotation = Quaternion.Euler(data.rotation);
+                    slot.instance.transform.localScale = Vector3.one * data.scaleMultiplier;
+                    slot.size = MeasureSize(data, slot.instance);
+                    stats.updated++;
+                }
+                else
+                {
+                    stats.reused++;
+                }
+            }
+
+            slot.hash = hash;
+            slot.parent = row.container;
+
+            Vector3 localPosition = new Vector3(currentX, 0f, 0f) + data.positionOffset;
+            if (slot.localPosition != localPosition)
+            {
+                slot.localPosition = localPosition;
+                if (slot.instance != null)
+                    slot.instance.transform.localPosition = localPosition; // Pending spawns are placed when spawned
+                stats.moved++;
+            }
+
+            row.slots.Add(slot);
+            height = Mathf.Max(height, slot.size.y);
+            currentX += slot.size.x + horizontalSeparation;
+        }
+
+        row.width = currentX;
+        row.height = height;
+        row.container.name = $"Row {rowIndex + 1}";
+        stats.rowsRepacked++;
+    }
+
+    private Slot Spawn(AssetData data, Transform parent)
+    {
+        var slot = new Slot
+        {
+            prefab = data.prefab,
+            parent = parent,
+            rotation = Quaternion.Euler(data.rotation),
+            scale = data.scaleMultiplier,
+            localPosition = new Vector3(float.NaN, 0f, 0f) // Forces the first placement
+        };
+
+#if UNITY_EDITOR
+        if (DeferSpawns && AssetBoundsCache.TryGetSize(data.prefab, slot.rotation, slot.scale, out slot.size))
+        {
+            slot.pending = true;
+            pendingSpawns.Add(slot);
+            return slot;
+        }
+#endif
+
+        Instantiate(slot);
+        slot.size = MeasureSize(data, slot.instance);
+        return slot;
+    }
+
+    // Spawns queued instances until the stopwatch passes budgetMs. Returns the spawns still queued.
+    public int ProcessPending(Stopwatch stopwatch, double budgetMs, ref int spawned)
+    {
+        while (pendingCursor < pendingSpawns.Count && stopwatch.Elapsed.TotalMilliseconds < budgetMs)
+        {
+            Slot slot = pendingSpawns[pendingCursor++];
+            if (!slot.pending || slot.parent == null)
+                continue; // Cancelled: its row changed or the grid was cleared before it spawned
+
+            slot.pending = false;
+            Instantiate(slot);
+            slot.instance.transform.localPosition = slot.localPosition;
+            spawned++;
+        }
+
+        if (pendingCursor >= pendingSpawns.Count)
+        {
+            pendingSpawns.Clear();
+            pendingCursor = 0;
+        }
+
+        return PendingCount;
+    }
+
+    private static void Instantiate(Slot slot)
+    {
+        GameObject instance = null;
+#if UNITY_EDITOR
+        instance = PrefabUtility.InstantiatePrefab(slot.prefab) as GameObject;
+#endif
+        if (instance == null)
+            instance = Object.Instantiate(slot.prefab); // Scene objects / non-prefab assets
+
+        instance.name = slot.prefab.name;
+        instance.transform.SetParent(slot.parent, false);
+        instance.transform.localRotation = slot.rotation;
+        instance.transform.localScale = Vector3.one * slot.scale;
+        slot.instance = instance;
+    }
+
+    private void CancelPending()
+    {
+        foreach (Slot slot in pendingSpawns)
+            slot.pending = false;
+
+        pendingSpawns.Clear();
+        pendingCursor = 0;
+    }
+
+    private void PoolSlots(Row row)
+    {
+        foreach (Slot slot in row.slots)
+        {
+            if (slot.instance == null)
+            {
+                slot.pending = false; // Not spawned yet (cancels it) or deleted by hand; respawned if still needed
+                continue;
+            }
+
+            slot.claimed = false;
+            pooled.Add(slot);
+            Push(poolByHash, slot.hash, slot);
+            Push(poolByPrefab, slot.prefab, slot);
+        }
+        row.slots.Clear();
+    }
+
+    private static void Push<TKey>(Dictionary<TKey, Stack<Slot>> pool, TKey key, Slot slot)
+    {
+        if (!pool.TryGetValue(key, out Stack<Slot> stack))
+        {
+            stack = new Stack<Slot>();
+            pool.Add(key, stack);
+        }
+        stack.Push(slot);
+    }
+
+    private static Slot Claim<TKey>(Dictionary<TKey, Stack<Slot>> pool, TKey key)
+    {
+        if (!pool.TryGetValue(key, out Stack<Slot> stack))
+            return null;
+
+        // A slot sits in both pools, so skip the ones the other pool already handed out
+        while (stack.Count > 0)
+        {
+            Slot slot = stack.Pop();
+            if (slot.claimed)
+                continue;
+
+            slot.claimed = true;
+            return slot;
+        }
+        return null;
+    }
+
+    private void ClearPool()
+    {
+        pooled.Clear();
+        poolByHash.Clear();
+        poolByPrefab.Clear();
+    }
+
+    private void EnsureContainer(int gridIndex, Transform parent)
+    {
+        if (container == null)
+        {
+            container = new GameObject().transform;
+            container.SetParent(parent, false);
+            xOffset = float.NaN;
+
+            // Rows were destroyed with the old container
+            rows.Clear();
+        }
+
+        container.name = $"Grid {gridIndex + 1}";
+    }
+
+    private static int HashRow(AssetRow row, float horizontalSeparation)
+    {
+        unchecked
+        {
+            int hash = horizontalSeparation.GetHashCode();
+            foreach (AssetData data in row.assets)
+                hash = hash * 31 + HashEntry(data);
+            return hash;
+        }
+    }
+
+    private static Vector3 MeasureSize(AssetData data, GameObject instance)
+    {
+#if UNITY_EDITOR
+        if (AssetBoundsCache.TryGetSize(data.prefab, Quaternion.Euler(data.rotation), data.scaleMultiplier, out Vector3 size))
+            return size;
+#endif
+        return AssetGrid.GetAssetBounds(instance).size;
+    }
+}
+
+public struct AssetGridLayoutStats
+{
+    public int entries;
+    public int spawned;
+    public int queued;   // Left to the time-sliced spawn queue
+    public int destroyed;
+    public int updated;  // Reused with a new scale / rotation
+    public int reused;   // Reused untouched
+    public int moved;
+    public int rowsRepacked;
+    public int rowsShifted;
+    public int gridsShifted;
+    public double milliseconds;
+
+    public override string ToString()
+    {
+        return $"{entries} entries in {milliseconds:F2} ms: {spawned} spawned, {queued} queued, {destroyed} destroyed, {updated} updated, " +
+               $"{reused} reused, {moved} moved, {rowsRepacked} rows repacked, {rowsShifted} rows shifted, {gridsShifted} grids shifted";
+    }
+}
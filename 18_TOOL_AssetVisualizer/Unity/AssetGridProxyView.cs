@@ -0,0 +1,231 @@
+#if UNITY_EDITOR
+using System.Collections.Generic;
+using UnityEditor;
+using UnityEngine;
+using UnityEngine.Rendering;
+
+/* --------------------------------------------------------------------------
+   Lightweight proxy display for the Asset Grid Visualizer.
+
+   • Lays the grids out exactly like AssetGridLayout (sizes from AssetBoundsCache) but
+     spawns nothing: every entry becomes a flat quad on the grid plane, textured from
+     AssetThumbnailAtlas, and all quads are one mesh, one material, one draw call.
+   • Prefabs are never instantiated for display, so their scripts, colliders and lights
+     cost nothing. Inspect() spawns the real prefab of one entry on demand (hover / selection).
+   • Quads are square (thumbnails aren't stretched) and fit inside the entry's layout cell.
+   -------------------------------------------------------------------------- */
+public class AssetGridProxyView
+{
+    private struct Entry
+    {
+        public GameObject prefab;
+        public Vector3 localPosition;
+        public Quaternion rotation;
+        public float scale;
+        public Rect cell; // Local XZ area used for picking
+    }
+
+    private const float SurfaceHeight = 0.01f; // Keeps the quads above a floor at the grid origin
+
+    private readonly List<Entry> entries = new List<Entry>();
+    private readonly List<int> tiles = new List<int>();
+
+    private GameObject container;
+    private Mesh mesh;
+    private Material material;
+
+    public bool IsBuilt => container != null;
+    public int Count => entries.Count;
+    public int AppliedHash { get; private set; }
+    public Transform Container => container != null ? container.transform : null;
+
+    public void Build(List<AssetGrid> grids, Transform parent, float gridSeparation, int hash)
+    {
+        EnsureContainer(parent);
+        entries.Clear();
+        tiles.Clear();
+
+        float gridX = 0f;
+        foreach (AssetGrid grid in grids)
+        {
+            float currentZ = 0f;
+            float gridWidth = 0f;
+
+            foreach (AssetRow row in grid.rows)
+            {
+                float currentX = 0f;
+                float rowHeight = 0f;
+
+                foreach (AssetData data in row.assets)
+                {
+                    if (data.prefab == null)
+                        continue;
+
+                    Quaternion rotation = Quaternion.Euler(data.rotation);
+                    if (!AssetBoundsCache.TryGetSize(data.prefab, rotation, data.scaleMultiplier, out Vector3 size))
+                        size = AssetGrid.GetAssetBounds(data.prefab).size * data.scaleMultiplier; // Scene objects
+
+                    Vector3 position = new Vector3(gridX + currentX, 0f, currentZ) + data.positionOffset;
+                    entries.Add(new Entry
+                    {
+                        prefab = data.prefab,
+                        localPosition = position,
+                        rotation = rotation,
+                        scale = data.scaleMultiplier,
+                        cell = new Rect(position.x - size.x * 0.5f, position.z - size.y * 0.5f, size.x, size.y)
+                    });
+                    tiles.Add(AssetThumbnailAtlas.GetTile(data.prefab));
+
+                    rowHeight = Mathf.Max(rowHeight, size.y);
+                    currentX += size.x + grid.HorizontalSeparation;
+                }
+
+                gridWidth = Mathf.Max(gridWidth, currentX);
+                currentZ -= rowHeight + grid.VerticalSeparation;
+            }
+
+            gridX -= gridWidth + gridSeparation;
+        }
+
+        // Tile rects are only final once the atlas stopped growing
+        AssetThumbnailAtlas.Flush();
+        BuildMesh();
+        material.mainTexture = AssetThumbnailAtlas.Texture;
+
+        AppliedHash = hash;
+    }
+
+    public void Clear()
+    {
+        if (container != null)
+            Object.DestroyImmediate(container);
+        if (mesh != null)
+            Object.DestroyImmediate(mesh);
+        if (material != null)
+            Object.DestroyImmediate(material);
+
+        container = null;
+        mesh = null;
+        material = null;
+        entries.Clear();
+        tiles.Clear();
+        AppliedHash = 0;
+    }
+
+    // Index of the entry under a world space ray, -1 if none
+    public int Pick(Ray worldRay)
+    {
+        if (container == null)
+            return -1;
+
+        Transform local = container.transform;
+        Vector3 origin = local.InverseTransformPoint(worldRay.origin);
+        Vector3 direction = local.InverseTransformDirection(worldRay.direction);
+        if (Mathf.Abs(direction.y) < 1e-5f)
+            return -1;
+
+        float distance = (SurfaceHeight - origin.y) / direction.y;
+        if (distance < 0f)
+            return -1;
+
+        Vector3 hit = origin + direction * distance;
+        var point = new Vector2(hit.x, hit.z);
+        for (int i = 0; i < entries.Count; i++)
+        {
+            if (entries[i].cell.Contains(point))
+                return i;
+        }
+        return -1;
+    }
+
+    // Spawns the real prefab of one entry where its instance would be
+    public GameObject Inspect(int index)
+    {
+        if (container == null || index < 0 || index >= entries.Count)
+            return null;
+
+        Entry entry = entries[index];
+        GameObject instance = PrefabUtility.InstantiatePrefab(entry.prefab) as GameObject;
+        if (instance == null)
+            instance = Object.Instantiate(entry.prefab);
+
+        instance.name = $"[Inspect] {entry.prefab.name}";
+        instance.hideFlags = HideFlags.DontSave;
+        instance.transform.SetParent(container.transform, false);
+        instance.transform.localPosition = entry.localPosition;
+        instance.transform.localRotation = entry.rotation;
+        instance.transform.localScale = Vector3.one * entry.scale;
+        return instance;
+    }
+
+    private void EnsureContainer(Transform parent)
+    {
+        if (container != null)
+            return;
+
+        container = new GameObject("Grid Proxies") { hideFlags = HideFlags.DontSave };
+        container.transform.SetParent(parent, false);
+
+        mesh = new Mesh { name = "AssetGridProxies", hideFlags = HideFlags.HideAndDontSave };
+        material = new Material(FindUnlitShader()) { name = "AssetGridProxies", hideFlags = HideFlags.HideAndDontSave };
+
+        container.AddComponent<MeshFilter>().sharedMesh = mesh;
+        var meshRenderer = container.AddComponent<MeshRenderer>();
+        meshRenderer.sharedMaterial = material;
+        meshRenderer.shadowCastingMode = ShadowCastingMode.Off;
+        meshRenderer.receiveShadows = false;
+    }
+
+    private void BuildMesh()
+    {
+        int count = entries.Count;
+        var vertices = new Vector3[count * 4];
+        var uvs = new Vector2[count * 4];
+        var normals = new Vector3[count * 4];
+        var triangles = new int[count * 6];
+
+        for (int i = 0; i < count; i++)
+        {
+            Rect cell = entries[i].cell;
+            float side = Mathf.Min(cell.width, cell.height);
+            Vector2 center = cell.center;
+            float x0 = center.x - side * 0.5f, x1 = center.x + side * 0.5f;
+            float z0 = center.y - side * 0.5f, z1 = center.y + side * 0.5f;
+            Rect uv = AssetThumbnailAtlas.GetTileRect(tiles[i]);
+
+            int v = i * 4;
+            vertices[v] = new Vector3(x0, SurfaceHeight, z0);
+            vertices[v + 1] = new Vector3(x0, SurfaceHeight, z1);
+            vertices[v + 2] = new Vector3(x1, SurfaceHeight, z1);
+            vertices[v + 3] = new Vector3(x1, SurfaceHeight, z0);
+
+            uvs[v] = new Vector2(uv.xMin, uv.yMin);
+            uvs[v + 1] = new Vector2(uv.xMin, uv.yMax);
+            uvs[v + 2] = new Vector2(uv.xMax, uv.yMax);
+            uvs[v + 3] = new Vector2(uv.xMax, uv.yMin);
+
+            normals[v] = normals[v + 1] = normals[v + 2] = normals[v + 3] = Vector3.up;
+
+            int t = i * 6;
+            triangles[t] = v; triangles[t + 1] = v + 1; triangles[t + 2] = v + 2;
+            triangles[t + 3] = v; triangles[t + 4] = v + 2; triangles[t + 5] = v + 3;
+        }
+
+        mesh.Clear();
+        mesh.indexFormat = vertices.Length > 65535 ? IndexFormat.UInt32 : IndexFormat.UInt16;
+        mesh.vertices = vertices;
+        mesh.uv = uvs;
+        mesh.normals = normals;
+        mesh.triangles = triangles;
+        mesh.RecalculateBounds();
+    }
+
+    private static Shader FindUnlitShader()
+    {
+        Shader shader = GraphicsSettings.currentRenderPipeline != null
+            ? Shader.Find("Universal Render Pipeline/Unlit")
+            : Shader.Find("Unlit/Transparent");
+        return shader != null ? shader : Shader.Find("Unlit/Texture");
+    }
+}
+#endif
@@ -8,12 +8,41 @@ using UnityEditor;
 [ExecuteInEditMode]
 public class AssetGridVisualizer : MonoBehaviour
 {
+    // Instances: every entry is a real prefab instance. Proxies: one thumbnail quad per entry,
+    // the real prefab is only spawned for the entry under the mouse or selected (AssetGridProxyView).
+    public enum DisplayMode { Instances, Proxies }
+
     [SerializeField] private bool enabledInEditorMode = true;
+    [SerializeField] private DisplayMode displayMode = DisplayMode.Instances;
     [SerializeField] private float gridSeparation = 1f;
     [SerializeField] private List<AssetGrid> grids = new List<AssetGrid>();
 
-    private List<GameObject> gridContainers = new List<GameObject>();
+    [Header("Instantiation")]
+    [SerializeField] private float instantiationBudgetMs = 8f; // Per editor frame. 0 = spawn everything in the layout pass
+
+    // One incremental layout per grid (index matched), see AssetGridLayout
+    private readonly List<AssetGridLayout> layouts = new List<AssetGridLayout>();
     private bool isDirty = true;
+    private bool forceRebuild = true;
+
+#if UNITY_EDITOR
+    private readonly AssetGridProxyView proxyView = new AssetGridProxyView();
+    private GameObject hoverInstance;
+    private GameObject selectedInstance;
+    private int hoveredEntry = -1;
+#endif
+
+    public AssetGridLayoutStats LastLayoutStats { get; private set; }
+
+    public int PendingInstantiations
+    {
+        get
+        {
+            int pending = 0;
+            foreach (var layout in layouts) pending += layout.PendingCount;
+            return pending;
+        }
+    }
 
     private void OnValidate()
     {
@@ -54,9 +83,15 @@ public class AssetGridVisualizer : MonoBehaviour
 
     private bool HasGridConfigChanged()
     {
-        foreach (var grid in grids)
+        if (displayMode == DisplayMode.Proxies)
+            return !proxyView.IsBuilt || proxyView.AppliedHash != ComputeProxyHash();
+
+        if (proxyView.IsBuilt || layouts.Count != grids.Count)
+            return true;
+
+        for (int i = 0; i < grids.Count; i++)
         {
-            if (grid.HasConfigChanged())
+            if (grids[i].HasConfigChanged(layouts[i]))
                 return true;
         }
         return false;
@@ -64,38 +99,236 @@ public class AssetGridVisualizer : MonoBehaviour
 
     private void RecalculateLayout()
     {
-        CleanupGridContainers();
+        var stats = new AssetGridLayoutStats();
+        var stopwatch = System.Diagnostics.Stopwatch.StartNew();
 
-        if (grids.Count == 0)
+        if (forceRebuild)
+        {
+            CleanupGridContainers(ref stats);
+            proxyView.Clear();
+            RemoveOrphanContainers();
+            forceRebuild = false;
+        }
+
+        ReleaseInspectedInstances();
+
+        if (displayMode == DisplayMode.Proxies)
+        {
+            CleanupGridContainers(ref stats); // Leaving instance mode
+            proxyView.Build(grids, transform, gridSeparation, ComputeProxyHash());
+
+            stats.entries = proxyView.Count;
+            stats.milliseconds = stopwatch.Elapsed.TotalMilliseconds;
+            LastLayoutStats = stats;
             return;
+        }
+
+        proxyView.Clear();
+
+        // Grids removed from the end (a grid removed in the middle is diffed against the next one)
+        for (int i = layouts.Count - 1; i >= grids.Count; i--)
+        {
+            layouts[i].Clear(ref stats);
+            layouts.RemoveAt(i);
+        }
 
         float currentXOffset = 0f;
 
         for (int i = 0; i < grids.Count; i++)
         {
-            GameObject gridContainer = CreateGridContainer(i);
-            grids[i].InstantiateAndLayoutAssets(currentXOffset, gridContainer.transform);
-            currentXOffset -= grids[i].GetGridWidth() + gridSeparation;
+            if (i >= layouts.Count)
+                layouts.Add(new AssetGridLayout());
+
+            layouts[i].DeferSpawns = instantiationBudgetMs > 0f;
+            layouts[i].Sync(grids[i], i, transform, currentXOffset, ref stats);
+            currentXOffset -= layouts[i].Width + gridSeparation;
         }
+
+        stats.milliseconds = stopwatch.Elapsed.TotalMilliseconds;
+        LastLayoutStats = stats;
+
+        if (stats.queued > 0)
+            StartSpawnQueue();
     }
 
-    private GameObject CreateGridContainer(int index)
+    // ---------------------------------------------------------------------
+    // Time-sliced instantiation: queued spawns run on the editor update within
+    // instantiationBudgetMs, with progress in the editor's background tasks
+    // ---------------------------------------------------------------------
+
+    private bool spawnQueueRunning;
+    private int spawnProgressId = -1;
+    private int spawnedFromQueue;
+
+    private void StartSpawnQueue()
+    {
+        if (spawnQueueRunning)
+            return;
+
+        spawnQueueRunning = true;
+        spawnedFromQueue = 0;
+        spawnProgressId = Progress.Start("Asset Grid Visualizer", "Instantiating grid assets");
+        EditorApplication.update += PumpSpawnQueue;
+    }
+
+    private void StopSpawnQueue()
+    {
+        if (!spawnQueueRunning)
+            return;
+
+        spawnQueueRunning = false;
+        EditorApplication.update -= PumpSpawnQueue;
+        if (Progress.Exists(spawnProgressId))
+            Progress.Finish(spawnProgressId);
+        spawnProgressId = -1;
+    }
+
+    private void PumpSpawnQueue()
+    {
+        if (this == null)
+        {
+            StopSpawnQueue();
+            return;
+        }
+
+        var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+        int remaining = 0;
+        foreach (var layout in layouts)
+            remaining += layout.ProcessPending(stopwatch, instantiationBudgetMs, ref spawnedFromQueue);
+
+        Progress.Report(spawnProgressId, spawnedFromQueue, spawnedFromQueue + remaining, $"{spawnedFromQueue} / {spawnedFromQueue + remaining}");
+        SceneView.RepaintAll();
+
+        if (remaining == 0)
+            StopSpawnQueue();
+    }
+
+    // Spawns everything still queued right away (e.g. before a build or a screenshot)
+    [ContextMenu("Finish Pending Instantiations")]
+    public void FinishPendingInstantiations()
+    {
+        var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+        foreach (var layout in layouts)
+            layout.ProcessPending(stopwatch, double.MaxValue, ref spawnedFromQueue);
+        StopSpawnQueue();
+    }
+
+    private void CleanupGridContainers(ref AssetGridLayoutStats stats)
     {
-        GameObject container = new GameObject($"Grid {index + 1}");
-        container.transform.SetParent(transform);
-        container.transform.localPosition = Vector3.zero;
-        gridContainers.Add(container);
-        return container;
+        foreach (var layout in layouts)
+            layout.Clear(ref stats);
+        layouts.Clear();
     }
 
     private void CleanupGridContainers()
     {
-        foreach (var container in gridContainers)
+        var stats = new AssetGridLayoutStats();
+        CleanupGridContainers(ref stats);
+        ReleaseInspectedInstances();
+        proxyView.Clear();
+    }
+
+    private int ComputeProxyHash()
+    {
+        unchecked
+        {
+            int hash = gridSeparation.GetHashCode();
+            foreach (var grid in grids)
+                hash = hash * 31 + grid.ComputeHash();
+            return hash;
+        }
+    }
+
+    // ---------------------------------------------------------------------
+    // Proxy inspection: the real prefab of the hovered entry is spawned while hovered,
+    // and kept while it (or one of its children) is selected
+    // ---------------------------------------------------------------------
+
+    private void OnEnable()
+    {
+        SceneView.duringSceneGui += OnSceneGUI;
+        Selection.selectionChanged += OnSelectionChanged;
+    }
+
+    private void OnDisable()
+    {
+        SceneView.duringSceneGui -= OnSceneGUI;
+        Selection.selectionChanged -= OnSelectionChanged;
+        ReleaseInspectedInstances();
+    }
+
+    private void OnSceneGUI(SceneView sceneView)
+    {
+        Event e = Event.current;
+        if (displayMode != DisplayMode.Proxies || !proxyView.IsBuilt || Application.isPlaying)
+            return;
+        if (e.type != EventType.MouseMove && e.type != EventType.MouseDrag)
+            return;
+
+        int entry = proxyView.Pick(HandleUtility.GUIPointToWorldRay(e.mousePosition));
+        if (entry == hoveredEntry)
+            return;
+
+        ReleaseHoverInstance();
+        hoveredEntry = entry;
+        hoverInstance = proxyView.Inspect(entry);
+    }
+
+    private void OnSelectionChanged()
+    {
+        if (selectedInstance != null && !IsSelected(selectedInstance))
         {
-            if (container != null)
-                DestroyImmediate(container);
+            DestroyImmediate(selectedInstance);
+            selectedInstance = null;
+        }
+    }
+
+    private void ReleaseHoverInstance()
+    {
+        if (hoverInstance == null)
+            return;
+
+        // Clicked while hovered: it stays until deselected
+        if (IsSelected(hoverInstance))
+        {
+            if (selectedInstance != null)
+                DestroyImmediate(selectedInstance);
+            selectedInstance = hoverInstance;
+        }
+        else
+        {
+            DestroyImmediate(hoverInstance);
+        }
+
+        hoverInstance = null;
+    }
+
+    private void ReleaseInspectedInstances()
+    {
+        if (hoverInstance != null)
+            DestroyImmediate(hoverInstance);
+        if (selectedInstance != null)
+            DestroyImmediate(selectedInstance);
+
+        hoverInstance = selectedInstance = null;
+        hoveredEntry = -1;
+    }
+
+    private static bool IsSelected(GameObject instance)
+    {
+        Transform active = Selection.activeTransform;
+        return active != null && active.IsChildOf(instance.transform);
+    }
+
+    // Containers left behind by a domain reload, when the layouts that owned them were lost
+    private void RemoveOrphanContainers()
+    {
+        for (int i = transform.childCount - 1; i >= 0; i--)
+        {
+            Transform child = transform.GetChild(i);
+            if (child.name.StartsWith("Grid "))
+                DestroyImmediate(child.gameObject);
         }
-        gridContainers.Clear();
     }
 
     private void OnDestroy()
@@ -103,11 +336,17 @@ public class AssetGridVisualizer : MonoBehaviour
         if (!Application.isEditor)
             return;
 
+        StopSpawnQueue();
         CleanupGridContainers();
     }
 
+    // Full rebuild, e.g. after deleting instances by hand
     [ContextMenu("Refresh Layout")]
-    public void RefreshLayout() => isDirty = true;
+    public void RefreshLayout()
+    {
+        forceRebuild = true;
+        isDirty = true;
+    }
 
     [ContextMenu("RESET SCRIPT [DANGER]")]
     public void ResetScript()
@@ -135,53 +374,30 @@ public class AssetGrid
     [SerializeField] private float verticalSeparation = 1f;
     public List<AssetRow> rows = new List<AssetRow>();
 
-    private List<GameObject> instantiatedAssets = new List<GameObject>();
-
-    public bool HasConfigChanged()
-    {
-        int totalAssets = 0;
-        foreach (var row in rows)
-            totalAssets += row.assets.Count;
-
-        return totalAssets != instantiatedAssets.Count;
-    }
+    public float HorizontalSeparation => horizontalSeparation;
+    public float VerticalSeparation => verticalSeparation;
 
-    public void InstantiateAndLayoutAssets(float xOffset, Transform parent)
+    // Hash of everything that affects the layout, compared against what was last applied
+    public int ComputeHash()
     {
-        instantiatedAssets.Clear();
-        float currentY = 0f;
-
-        for (int rowIndex = 0; rowIndex < rows.Count; rowIndex++)
+        unchecked
         {
-            float rowHeight = 0f;
-            float currentX = xOffset;
-
-            for (int colIndex = 0; colIndex < rows[rowIndex].assets.Count; colIndex++)
+            int hash = horizontalSeparation.GetHashCode() * 31 + verticalSeparation.GetHashCode();
+            foreach (var row in rows)
             {
-                AssetData assetData = rows[rowIndex].assets[colIndex];
-                if (assetData.prefab == null)
-                    continue;
-
-                GameObject instantiatedAsset = PrefabUtility.InstantiatePrefab(assetData.prefab) as GameObject;
-                instantiatedAsset.name = assetData.prefab.name;
-                instantiatedAsset.transform.SetParent(parent);
-
-                Vector3 basePosition = new Vector3(currentX, 0, currentY);
-                instantiatedAsset.transform.localPosition = basePosition + assetData.positionOffset;
-                instantiatedAsset.transform.localRotation = Quaternion.Euler(assetData.rotation);
-                instantiatedAsset.transform.localScale = Vector3.one * assetData.scaleMultiplier;
-
-                instantiatedAssets.Add(instantiatedAsset);
-
-                Bounds bounds = GetAssetBounds(instantiatedAsset);
-                rowHeight = Mathf.Max(rowHeight, bounds.size.y);
-                currentX += bounds.size.x + horizontalSeparation;
+                hash = hash * 31 + row.assets.Count;
+                foreach (var assetData in row.assets)
+                    hash = hash * 31 + AssetGridLayout.HashEntry(assetData);
             }
-
-            currentY -= rowHeight + verticalSeparation;
+            return hash;
         }
     }
 
+    public bool HasConfigChanged(AssetGridLayout layout)
+    {
+        return layout == null || layout.AppliedHash != ComputeHash();
+    }
+
     public float GetGridWidth()
     {
         float maxWidth = 0f;
@@ -203,7 +419,7 @@ public class AssetGrid
         return maxWidth;
     }
 
-    private Bounds GetAssetBounds(GameObject asset)
+    public static Bounds GetAssetBounds(GameObject asset)
     {
         Collider collider = asset.GetComponent<Collider>();
         if (collider != null)
@@ -218,6 +434,10 @@ public class AssetGrid
 
     private Bounds GetPrefabBounds(GameObject prefab)
     {
+#if UNITY_EDITOR
+        if (AssetBoundsCache.TryGetBounds(prefab, out Bounds cached))
+            return cached;
+#endif
         Collider collider = prefab.GetComponent<Collider>();
         if (collider != null)
             return collider.bounds;
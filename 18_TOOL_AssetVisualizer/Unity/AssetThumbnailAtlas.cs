@@ -0,0 +1,296 @@
+#if UNITY_EDITOR
+using System;
+using System.Collections.Generic;
+using System.IO;
+using UnityEditor;
+using UnityEditor.SceneManagement;
+using UnityEngine;
+using UnityEngine.Rendering;
+using UnityEngine.SceneManagement;
+
+/* --------------------------------------------------------------------------
+   Thumbnail atlas for the Asset Grid Visualizer proxy mode (editor only).
+
+   • Each prefab is rendered once, offscreen, in an isolated preview scene (own camera
+     and light) into a TileSize square, and copied into one atlas texture.
+   • The atlas and its index are cached in Library/AssetGridThumbnails, keyed like
+     AssetBoundsCache (GUID + local file id) with the asset dependency hash, so only
+     new or changed prefabs are rendered again.
+   • Plain camera rendering only, so it runs on any graphics device including software
+     GL (e.g. Mesa llvmpipe in CI). With -nographics nothing can be rendered and tiles
+     get a flat colour per asset instead, so the layout still works headless.
+   • Tiles are allocated with GetTile(); call Flush() once per pass before GetTileRect(),
+     since the atlas may have grown.
+   -------------------------------------------------------------------------- */
+public static class AssetThumbnailAtlas
+{
+    public const int TileSize = 128;
+    private const int Columns = 32;
+
+    [Serializable]
+    private class Entry
+    {
+        public string key;
+        public string contentHash;
+        public int tile;
+    }
+
+    [Serializable]
+    private class AtlasIndex
+    {
+        public int tileCount;
+        public List<Entry> entries = new List<Entry>();
+    }
+
+    private const string Folder = "Library/AssetGridThumbnails";
+    private static string AtlasPath => Path.Combine(Folder, "Atlas.png");
+    private static string IndexPath => Path.Combine(Folder, "Atlas.json");
+
+    private static Dictionary<string, Entry> entries;
+    private static Texture2D atlas;
+    private static int tileCount;
+    private static bool dirty;
+
+    public static int Rendered { get; private set; }
+    public static int Hits { get; private set; }
+    public static bool CanRender => SystemInfo.graphicsDeviceType != GraphicsDeviceType.Null;
+
+    public static Texture2D Texture { get { Load(); return atlas; } }
+
+    // Tile index for a prefab asset, rendering it if it's new or changed. -1 for scene objects.
+    public static int GetTile(GameObject prefab)
+    {
+        if (prefab == null || !AssetDatabase.TryGetGUIDAndLocalFileIdentifier(prefab, out string guid, out long localId))
+            return -1;
+
+        string path = AssetDatabase.GUIDToAssetPath(guid);
+        if (string.IsNullOrEmpty(path))
+            return -1;
+
+        Load();
+        string key = $"{guid}:{localId}";
+        string contentHash = AssetDatabase.GetAssetDependencyHash(path).ToString();
+
+        if (entries.TryGetValue(key, out Entry entry))
+        {
+            if (entry.contentHash == contentHash)
+            {
+                Hits++;
+                return entry.tile;
+            }
+        }
+        else
+        {
+            entry = new Entry { key = key, tile = tileCount++ };
+            entries.Add(key, entry);
+            EnsureCapacity(tileCount);
+        }
+
+        entry.contentHash = contentHash;
+        Color32[] pixels = CanRender ? RenderThumbnail(prefab) : Placeholder(key);
+        atlas.SetPixels32((entry.tile % Columns) * TileSize, (entry.tile / Columns) * TileSize, TileSize, TileSize, pixels);
+        dirty = true;
+        Rendered++;
+        return entry.tile;
+    }
+
+    public static Rect GetTileRect(int tile)
+    {
+        Load();
+        if (tile < 0)
+            return new Rect(0f, 0f, 0f, 0f);
+
+        float width = atlas.width, height = atlas.height;
+        return new Rect((tile % Columns) * TileSize / width, (tile / Columns) * TileSize / height, TileSize / width, TileSize / height);
+    }
+
+    // Uploads the new tiles and writes the atlas + index to disk
+    public static void Flush()
+    {
+        if (!dirty)
+            return;
+
+        dirty = false;
+        atlas.Apply(false);
+
+        Directory.CreateDirectory(Folder);
+        File.WriteAllBytes(AtlasPath, atlas.EncodeToPNG());
+        var index = new AtlasIndex { tileCount = tileCount, entries = new List<Entry>(entries.Values) };
+        File.WriteAllText(IndexPath, JsonUtility.ToJson(index));
+    }
+
+    [MenuItem("Tools/Asset Grid Visualizer/Clear Thumbnail Atlas")]
+    public static void Clear()
+    {
+        if (atlas != null)
+            UnityEngine.Object.DestroyImmediate(atlas);
+
+        atlas = null;
+        entries = new Dictionary<string, Entry>();
+        tileCount = 0;
+        Rendered = Hits = 0;
+        EnsureCapacity(1);
+
+        if (File.Exists(AtlasPath)) File.Delete(AtlasPath);
+        if (File.Exists(IndexPath)) File.Delete(IndexPath);
+    }
+
+    private static void Load()
+    {
+        if (entries != null)
+            return;
+
+        entries = new Dictionary<string, Entry>();
+        tileCount = 0;
+
+        if (File.Exists(AtlasPath) && File.Exists(IndexPath))
+        {
+            try
+            {
+                AtlasIndex index = JsonUtility.FromJson<AtlasIndex>(File.ReadAllText(IndexPath));
+                var loaded = new Texture2D(2, 2, TextureFormat.RGBA32, false);
+
+                if (index != null && loaded.LoadImage(File.ReadAllBytes(AtlasPath)) && loaded.width == Columns * TileSize)
+                {
+                    atlas = Configure(loaded);
+                    tileCount = index.tileCount;
+                    foreach (Entry entry in index.entries)
+                        entries[entry.key] = entry;
+                }
+                else
+                {
+                    UnityEngine.Object.DestroyImmediate(loaded);
+                }
+            }
+            catch (Exception e)
+            {
+                Debug.LogWarning($"[AssetThumbnailAtlas] Ignoring unreadable atlas cache: {e.Message}");
+                entries.Clear();
+                tileCount = 0;
+            }
+        }
+
+        EnsureCapacity(Mathf.Max(1, tileCount));
+    }
+
+    // Grows the atlas upwards by doubling its rows; existing tiles keep their pixel position
+    private static void EnsureCapacity(int tiles)
+    {
+        int rows = Mathf.CeilToInt(tiles / (float)Columns);
+        if (atlas != null && atlas.height >= rows * TileSize)
+            return;
+
+        int height = TileSize;
+        while (height < rows * TileSize)
+            height *= 2;
+
+        var grown = Configure(new Texture2D(Columns * TileSize, height, TextureFormat.RGBA32, false));
+        var clear = new Color32[grown.width * grown.height];
+        grown.SetPixels32(clear);
+
+        if (atlas != null)
+        {
+            grown.SetPixels32(0, 0, atlas.width, atlas.height, atlas.GetPixels32());
+            UnityEngine.Object.DestroyImmediate(atlas);
+        }
+
+        atlas = grown;
+        dirty = true;
+    }
+
+    private static Texture2D Configure(Texture2D texture)
+    {
+        texture.name = "AssetGridThumbnailAtlas";
+        texture.hideFlags = HideFlags.HideAndDontSave;
+        texture.wrapMode = TextureWrapMode.Clamp;
+        texture.filterMode = FilterMode.Bilinear;
+        return texture;
+    }
+
+    private static Color32[] RenderThumbnail(GameObject prefab)
+    {
+        Scene scene = EditorSceneManager.NewPreviewScene();
+        RenderTexture target = RenderTexture.GetTemporary(TileSize, TileSize, 24, RenderTextureFormat.ARGB32);
+        RenderTexture previous = RenderTexture.active;
+
+        try
+        {
+            GameObject instance = UnityEngine.Object.Instantiate(prefab);
+            SceneManager.MoveGameObjectToScene(instance, scene);
+            instance.transform.SetPositionAndRotation(Vector3.zero, Quaternion.identity);
+            Bounds bounds = GetRenderBounds(instance);
+
+            var lightObject = new GameObject("Thumbnail Light");
+            SceneManager.MoveGameObjectToScene(lightObject, scene);
+            Light light = lightObject.AddComponent<Light>();
+            light.type = LightType.Directional;
+            lightObject.transform.rotation = Quaternion.Euler(50f, -30f, 0f);
+
+            var cameraObject = new GameObject("Thumbnail Camera");
+            SceneManager.MoveGameObjectToScene(cameraObject, scene);
+            Camera camera = cameraObject.AddComponent<Camera>();
+            camera.scene = scene;
+            camera.enabled = false;
+            camera.clearFlags = CameraClearFlags.SolidColor;
+            camera.backgroundColor = new Color(0f, 0f, 0f, 0f);
+            camera.fieldOfView = 30f;
+
+            // Frame the bounding sphere from the front-right, slightly above
+            float radius = Mathf.Max(bounds.extents.magnitude, 0.01f);
+            float distance = radius / Mathf.Sin(camera.fieldOfView * 0.5f * Mathf.Deg2Rad);
+            cameraObject.transform.position = bounds.center + new Vector3(1f, 0.8f, -1f).normalized * distance;
+            cameraObject.transform.LookAt(bounds.center);
+            camera.nearClipPlane = Mathf.Max(0.01f, distance - radius * 1.1f);
+            camera.farClipPlane = distance + radius * 1.1f;
+
+            camera.targetTexture = target;
+            camera.Render();
+
+            RenderTexture.active = target;
+            var readback = new Texture2D(TileSize, TileSize, TextureFormat.RGBA32, false);
+            readback.ReadPixels(new Rect(0, 0, TileSize, TileSize), 0, 0);
+            Color32[] pixels = readback.GetPixels32();
+            UnityEngine.Object.DestroyImmediate(readback);
+            return pixels;
+        }
+        finally
+        {
+            RenderTexture.active = previous;
+            RenderTexture.ReleaseTemporary(target);
+            EditorSceneManager.ClosePreviewScene(scene);
+        }
+    }
+
+    private static Bounds GetRenderBounds(GameObject instance)
+    {
+        Renderer[] renderers = instance.GetComponentsInChildren<Renderer>();
+        if (renderers.Length == 0)
+            return AssetGrid.GetAssetBounds(instance);
+
+        Bounds bounds = renderers[0].bounds;
+        for (int i = 1; i < renderers.Length; i++)
+            bounds.Encapsulate(renderers[i].bounds);
+        return bounds;
+    }
+
+    // Stable colour per asset with a darker border, for devices that can't render
+    private static Color32[] Placeholder(string key)
+    {
+        Color fill = Color.HSVToRGB((key.GetHashCode() & 0xFFFF) / 65535f, 0.45f, 0.85f);
+        Color darker = fill * 0.6f;
+        darker.a = 1f;
+        Color32 inner = fill, border = darker;
+
+        var pixels = new Color32[TileSize * TileSize];
+        for (int y = 0; y < TileSize; y++)
+        {
+            for (int x = 0; x < TileSize; x++)
+            {
+                bool edge = x < 4 || y < 4 || x >= TileSize - 4 || y >= TileSize - 4;
+                pixels[y * TileSize + x] = edge ? border : inner;
+            }
+        }
+        return pixels;
+    }
+}
+#endif
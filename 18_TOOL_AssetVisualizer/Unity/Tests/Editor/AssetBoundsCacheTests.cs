@@ -0,0 +1,86 @@
+using NUnit.Framework;
+using UnityEditor;
+using UnityEngine;
+
+// Checks bounds cache hits, invalidation on reimport and delete, and rotated sizes on a prefab saved to a temporary folder.
+public class AssetBoundsCacheTests
+{
+    private string folder;
+    private string path;
+    private GameObject source;
+
+    [SetUp]
+    public void SetUp()
+    {
+        folder = AssetDatabase.GUIDToAssetPath(AssetDatabase.CreateFolder("Assets", "AssetBoundsCacheTests"));
+        path = folder + "/Cube.prefab";
+        source = GameObject.CreatePrimitive(PrimitiveType.Cube);
+    }
+
+    [TearDown]
+    public void TearDown()
+    {
+        Object.DestroyImmediate(source);
+        AssetDatabase.DeleteAsset(folder);
+    }
+
+    [Test]
+    public void SecondLookup_IsAHit()
+    {
+        GameObject prefab = PrefabUtility.SaveAsPrefabAsset(source, path);
+
+        int misses = AssetBoundsCache.Misses, hits = AssetBoundsCache.Hits;
+        Assert.IsTrue(AssetBoundsCache.TryGetBounds(prefab, out Bounds first));
+        Assert.AreEqual(misses + 1, AssetBoundsCache.Misses);
+        Assert.That(Vector3.Distance(first.size, Vector3.one), Is.LessThan(0.001f));
+
+        Assert.IsTrue(AssetBoundsCache.TryGetBounds(prefab, out _));
+        Assert.AreEqual(hits + 1, AssetBoundsCache.Hits);
+    }
+
+    [Test]
+    public void Reimport_MeasuresAgain()
+    {
+        GameObject prefab = PrefabUtility.SaveAsPrefabAsset(source, path);
+        AssetBoundsCache.TryGetBounds(prefab, out _);
+
+        // The postprocessor drops the entry and the new size is measured
+        source.GetComponent<BoxCollider>().size = new Vector3(2f, 1f, 1f);
+        prefab = PrefabUtility.SaveAsPrefabAsset(source, path);
+        AssetDatabase.ImportAsset(path, ImportAssetOptions.ForceUpdate);
+
+        int misses = AssetBoundsCache.Misses;
+        AssetBoundsCache.TryGetBounds(prefab, out Bounds edited);
+        Assert.AreEqual(misses + 1, AssetBoundsCache.Misses);
+        Assert.AreEqual(2f, edited.size.x, 0.001f);
+    }
+
+    [Test]
+    public void TryGetSize_AppliesRotationAndScale()
+    {
+        source.GetComponent<BoxCollider>().size = new Vector3(2f, 1f, 1f);
+        GameObject prefab = PrefabUtility.SaveAsPrefabAsset(source, path);
+
+        Assert.IsTrue(AssetBoundsCache.TryGetSize(prefab, Quaternion.Euler(0f, 90f, 0f), 2f, out Vector3 rotated));
+        Assert.AreEqual(2f, rotated.x, 0.001f);
+        Assert.AreEqual(4f, rotated.z, 0.001f);
+    }
+
+    [Test]
+    public void DeletedAsset_IsDropped()
+    {
+        GameObject prefab = PrefabUtility.SaveAsPrefabAsset(source, path);
+        string guid = AssetDatabase.AssetPathToGUID(path);
+        AssetBoundsCache.TryGetBounds(prefab, out _);
+        Assert.IsTrue(AssetBoundsCache.Contains(guid));
+
+        AssetDatabase.DeleteAsset(path);
+        Assert.IsFalse(AssetBoundsCache.Contains(guid));
+    }
+
+    [Test]
+    public void SceneObject_HasNoBounds()
+    {
+        Assert.IsFalse(AssetBoundsCache.TryGetBounds(source, out _));
+    }
+}
@@ -0,0 +1,119 @@
+using NUnit.Framework;
+using UnityEngine;
+
+// Checks that the incremental layout only touches what changed on a 2000 entry grid: an edit repacks its own row
+// and reuses every instance it can. The prefab is a scene cube, so sizes are measured inline and nothing is deferred.
+public class AssetGridLayoutTests
+{
+    private const int EntryCount = 2000;
+    private const int EntriesPerRow = 50;
+
+    private GameObject prefab;
+    private GameObject parent;
+    private AssetGrid grid;
+    private AssetGridLayout layout;
+
+    private AssetRow MiddleRow => grid.rows[grid.rows.Count / 2];
+
+    [SetUp]
+    public void SetUp()
+    {
+        prefab = GameObject.CreatePrimitive(PrimitiveType.Cube);
+        prefab.hideFlags = HideFlags.HideAndDontSave;
+        parent = new GameObject("AssetGridLayoutTests") { hideFlags = HideFlags.DontSave };
+
+        grid = new AssetGrid();
+        for (int i = 0; i < EntryCount; i++)
+        {
+            if (i % EntriesPerRow == 0)
+                grid.rows.Add(new AssetRow());
+            grid.rows[grid.rows.Count - 1].assets.Add(new AssetData { prefab = prefab });
+        }
+
+        layout = new AssetGridLayout();
+    }
+
+    [TearDown]
+    public void TearDown()
+    {
+        var stats = new AssetGridLayoutStats();
+        layout.Clear(ref stats);
+        Object.DestroyImmediate(parent);
+        Object.DestroyImmediate(prefab);
+    }
+
+    private AssetGridLayoutStats Sync()
+    {
+        var stats = new AssetGridLayoutStats();
+        layout.Sync(grid, 0, parent.transform, 0f, ref stats);
+        return stats;
+    }
+
+    [Test]
+    public void FirstSync_SpawnsEveryEntry()
+    {
+        AssetGridLayoutStats stats = Sync();
+
+        Assert.AreEqual(EntryCount, stats.entries);
+        Assert.AreEqual(EntryCount, stats.spawned);
+        Assert.AreEqual(EntryCount / EntriesPerRow, stats.rowsRepacked);
+        Assert.AreEqual(EntryCount, layout.InstanceCount);
+    }
+
+    [Test]
+    public void SyncWithoutChanges_TouchesNothing()
+    {
+        Sync();
+        AssetGridLayoutStats stats = Sync();
+
+        Assert.AreEqual(0, stats.spawned + stats.destroyed + stats.updated + stats.moved);
+        Assert.AreEqual(0, stats.rowsRepacked + stats.rowsShifted + stats.gridsShifted);
+    }
+
+    [Test]
+    public void OffsettingOneEntry_RepacksOnlyItsRow()
+    {
+        Sync();
+        MiddleRow.assets[0].positionOffset = Vector3.up;
+        AssetGridLayoutStats stats = Sync();
+
+        Assert.AreEqual(1, stats.rowsRepacked);
+        Assert.AreEqual(0, stats.spawned);
+        Assert.AreEqual(0, stats.destroyed);
+        Assert.AreEqual(1, stats.updated);
+        Assert.AreEqual(EntriesPerRow - 1, stats.reused);
+        Assert.AreEqual(0, stats.rowsShifted);
+    }
+
+    [Test]
+    public void InsertingAndRemovingOneEntry_SpawnsAndDestroysOnlyThatEntry()
+    {
+        Sync();
+
+        MiddleRow.assets.Insert(0, new AssetData { prefab = prefab });
+        AssetGridLayoutStats inserted = Sync();
+        Assert.AreEqual(1, inserted.rowsRepacked);
+        Assert.AreEqual(1, inserted.spawned);
+        Assert.AreEqual(0, inserted.destroyed);
+
+        MiddleRow.assets.RemoveAt(0);
+        AssetGridLayoutStats removed = Sync();
+        Assert.AreEqual(1, removed.rowsRepacked);
+        Assert.AreEqual(0, removed.spawned);
+        Assert.AreEqual(1, removed.destroyed);
+        Assert.AreEqual(EntryCount, layout.InstanceCount);
+    }
+
+    [Test]
+    public void Clear_DestroysEveryInstance()
+    {
+        Sync();
+
+        var stats = new AssetGridLayoutStats();
+        layout.Clear(ref stats);
+
+        Assert.AreEqual(EntryCount, stats.destroyed);
+        Assert.AreEqual(0, layout.InstanceCount);
+        Assert.AreEqual(0, parent.transform.childCount);
+    }
+}
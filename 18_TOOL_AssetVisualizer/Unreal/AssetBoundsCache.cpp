@@ -0,0 +1,170 @@
+#include "AssetBoundsCache.h"
+#include "Engine/StaticMesh.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+
+FAssetBoundsCache& FAssetBoundsCache::Get()
+{
+    static FAssetBoundsCache Instance;
+    return Instance;
+}
+
+FAssetBoundsCache::FAssetBoundsCache()
+{
+    Load();
+
+#if WITH_EDITOR
+    PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FAssetBoundsCache::OnObjectPropertyChanged);
+#endif
+}
+
+FAssetBoundsCache::~FAssetBoundsCache()
+{
+#if WITH_EDITOR
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+#endif
+}
+
+bool FAssetBoundsCache::TryGetBounds(const UObject* Asset, FBox& OutBounds)
+{
+    if (!Asset)
+        return false;
+
+    const FString ContentHash = GetContentHash(Asset);
+
+    // Cooked builds have no content hash to validate against, measure directly
+    if (ContentHash.IsEmpty())
+        return Measure(Asset, OutBounds);
+
+    const FString Key = Asset->GetPathName();
+    if (const FAssetBoundsCacheEntry* Entry = Entries.Find(Key))
+    {
+        if (Entry->ContentHash == ContentHash)
+        {
+            Hits++;
+            OutBounds = FBox::BuildAABB(Entry->Center, Entry->Size * 0.5f);
+            return true;
+        }
+    }
+
+    if (!Measure(Asset, OutBounds))
+        return false;
+
+    Misses++;
+
+    FAssetBoundsCacheEntry& Entry = Entries.FindOrAdd(Key);
+    Entry.Key = Key;
+    Entry.ContentHash = ContentHash;
+    Entry.Center = OutBounds.GetCenter();
+    Entry.Size = OutBounds.GetSize();
+    MarkDirty();
+    return true;
+}
+
+bool FAssetBoundsCache::TryGetSize(const UObject* Asset, const FRotator& Rotation, float Scale, FVector& OutSize)
+{
+    FBox Bounds;
+    if (!TryGetBounds(Asset, Bounds))
+        return false;
+
+    // Same axis aligned box the spawned actor reports through GetActorBounds
+    OutSize = Bounds.TransformBy(FTransform(Rotation, FVector::ZeroVector, FVector(Scale))).GetSize();
+    return true;
+}
+
+void FAssetBoundsCache::Invalidate(const UObject* Asset)
+{
+    if (Asset && Entries.Remove(Asset->GetPathName()) > 0)
+    {
+        Invalidations++;
+        MarkDirty();
+    }
+}
+
+void FAssetBoundsCache::Clear()
+{
+    Entries.Empty();
+    Hits = Misses = Invalidations = 0;
+    MarkDirty();
+    Flush();
+}
+
+void FAssetBoundsCache::Flush()
+{
+    if (!bDirty)
+        return;
+
+    bDirty = false;
+
+    FAssetBoundsCacheFile File;
+    Entries.GenerateValueArray(File.Entries);
+
+    FString Json;
+    if (FJsonObjectConverter::UStructToJsonObjectString(File, Json))
+    {
+        FFileHelper::SaveStringToFile(Json, *GetCachePath());
+    }
+}
+
+FString FAssetBoundsCache::GetCachePath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("AssetGridVisualizer") / TEXT("BoundsCache.json");
+}
+
+FString FAssetBoundsCache::GetContentHash(const UObject* Asset)
+{
+    if (const UStaticMesh* Mesh = Cast<UStaticMesh>(Asset))
+    {
+        const FGuid& Guid = Mesh->GetLightingGuid();
+        return Guid.IsValid() ? Guid.ToString() : FString();
+    }
+    return FString();
+}
+
+bool FAssetBoundsCache::Measure(const UObject* Asset, FBox& OutBounds)
+{
+    // Only accept Static Mesh for this version
+    if (const UStaticMesh* Mesh = Cast<UStaticMesh>(Asset))
+    {
+        OutBounds = Mesh->GetBoundingBox();
+        return true;
+    }
+    return false;
+}
+
+void FAssetBoundsCache::Load()
+{
+    FString Json;
+    if (!FFileHelper::LoadFileToString(Json, *GetCachePath()))
+        return;
+
+    FAssetBoundsCacheFile File;
+    if (!FJsonObjectConverter::JsonObjectStringToUStruct(Json, &File, 0, 0))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AssetBoundsCache: Ignoring unreadable cache file %s"), *GetCachePath());
+        return;
+    }
+
+    for (const FAssetBoundsCacheEntry& Entry : File.Entries)
+    {
+        Entries.Add(Entry.Key, Entry);
+    }
+}
+
+void FAssetBoundsCache::MarkDirty()
+{
+    bDirty = true;
+}
+
+#if WITH_EDITOR
+void FAssetBoundsCache::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+    // Reimports and build setting changes go through PostEditChange
+    if (Cast<UStaticMesh>(Object))
+    {
+        Invalidate(Object);
+    }
+}
+#endif
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetBoundsCache.generated.h"
+
+USTRUCT()
+struct FAssetBoundsCacheEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FString Key;
+
+    UPROPERTY()
+    FString ContentHash;
+
+    UPROPERTY()
+    FVector Center = FVector::ZeroVector;
+
+    UPROPERTY()
+    FVector Size = FVector::ZeroVector;
+};
+
+USTRUCT()
+struct FAssetBoundsCacheFile
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FAssetBoundsCacheEntry> Entries;
+};
+
+/* --------------------------------------------------------------------------
+   Persistent mesh bounds cache for the Asset Grid Visualizer.
+
+   • Bounds are stored in Saved/AssetGridVisualizer/BoundsCache.json, keyed by the
+     mesh's object path and carrying a content hash (the lighting GUID, regenerated
+     whenever the mesh is rebuilt or reimported), so stale entries miss on their own.
+   • Meshes edited in the editor are dropped right away (property changed delegate).
+   • TryGetSize() returns the axis aligned size at a rotation / scale, so the layout can
+     place entries before their actors are spawned.
+   • Writes are batched: owners call Flush() once a layout pass is done.
+   -------------------------------------------------------------------------- */
+class MECHANICS_TEST_LVN_API FAssetBoundsCache
+{
+public:
+    static FAssetBoundsCache& Get();
+
+    bool TryGetBounds(const UObject* Asset, FBox& OutBounds);
+    bool TryGetSize(const UObject* Asset, const FRotator& Rotation, float Scale, FVector& OutSize);
+
+    void Invalidate(const UObject* Asset);
+    void Clear();
+    void Flush();
+
+    int32 GetHits() const { return Hits; }
+    int32 GetMisses() const { return Misses; }
+    int32 GetInvalidations() const { return Invalidations; }
+    int32 Num() const { return Entries.Num(); }
+
+private:
+    FAssetBoundsCache();
+    ~FAssetBoundsCache();
+
+    static FString GetCachePath();
+    static FString GetContentHash(const UObject* Asset);
+    static bool Measure(const UObject* Asset, FBox& OutBounds);
+
+    void Load();
+    void MarkDirty();
+
+#if WITH_EDITOR
+    void OnObjectPropertyChanged(UObject* Object, struct FPropertyChangedEvent& Event);
+    FDelegateHandle PropertyChangedHandle;
+#endif
+
+    TMap<FString, FAssetBoundsCacheEntry> Entries;
+    bool bDirty = false;
+
+    int32 Hits = 0;
+    int32 Misses = 0;
+    int32 Invalidations = 0;
+};
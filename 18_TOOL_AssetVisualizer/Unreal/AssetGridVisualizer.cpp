@@ -1,32 +1,105 @@
 #include "AssetGridVisualizer.h"
+#include "AssetBoundsCache.h"
+#include "AssetThumbnailAtlas.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Materials/MaterialInstanceDynamic.h"
 #include "Engine/World.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/StaticMeshActor.h"
 #include "GameFramework/Character.h"
 #include "Components/StaticMeshComponent.h"
+#include "HAL/PlatformTime.h"
 
-bool FAssetGrid::HasConfigChanged() const
+uint32 FAssetGrid::HashEntry(const FVisualAssetData& AssetData)
+{
+	uint32 Hash = GetTypeHash(AssetData.PrefabReference);
+	Hash = HashCombine(Hash, GetTypeHash(AssetData.ScaleMultiplier));
+	Hash = HashCombine(Hash, GetTypeHash(AssetData.Rotation.Pitch));
+	Hash = HashCombine(Hash, GetTypeHash(AssetData.Rotation.Yaw));
+	Hash = HashCombine(Hash, GetTypeHash(AssetData.Rotation.Roll));
+	Hash = HashCombine(Hash, GetTypeHash(AssetData.PositionOffset.X));
+	Hash = HashCombine(Hash, GetTypeHash(AssetData.PositionOffset.Y));
+	Hash = HashCombine(Hash, GetTypeHash(AssetData.PositionOffset.Z));
+	return Hash;
+}
+
+static uint32 HashAssetRow(const FAssetRow& Row, float HorizontalSeparation)
+{
+	uint32 Hash = GetTypeHash(HorizontalSeparation);
+	for (const FVisualAssetData& AssetData : Row.Assets)
+	{
+		Hash = HashCombine(Hash, FAssetGrid::HashEntry(AssetData));
+	}
+	return Hash;
+}
+
+uint32 FAssetGrid::ComputeHash() const
 {
-	int32 TotalAssets = 0;
+	uint32 Hash = GetTypeHash(VerticalSeparation);
 	for (const FAssetRow& Row : Rows)
 	{
-		TotalAssets += Row.Assets.Num();
+		Hash = HashCombine(Hash, HashAssetRow(Row, HorizontalSeparation));
 	}
-	return TotalAssets != InstantiatedAssets.Num();
+	return Hash;
+}
+
+bool FAssetGrid::HasConfigChanged() const
+{
+	return ComputeHash() != AppliedHash;
+}
+
+FString FAssetGridLayoutStats::ToString() const
+{
+	return FString::Printf(TEXT("%d entries in %.2f ms: %d spawned, %d queued, %d destroyed, %d updated, %d reused, %d moved, %d rows repacked, %d rows shifted"),
+		Entries, Milliseconds, Spawned, Queued, Destroyed, Updated, Reused, Moved, RowsRepacked, RowsShifted);
 }
 
 AAssetGridVisualizer::AAssetGridVisualizer()
 {
-	PrimaryActorTick.bCanEverTick = false;
+	// Only ticks in game, for proxy hover inspection
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 }
 
 void AAssetGridVisualizer::BeginPlay()
 {
 	Super::BeginPlay();
+	SetActorTickEnabled(DisplayMode == EAssetGridDisplayMode::Proxies && bInspectOnHover);
+}
+
+void AAssetGridVisualizer::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	if (!PlayerController || !ProxyComponent)
+		return;
+
+	int32 Entry = INDEX_NONE;
+	FHitResult Hit;
+	if (PlayerController->GetHitResultUnderCursor(ECC_Visibility, false, Hit))
+	{
+		if (Hit.GetComponent() == ProxyComponent)
+		{
+			Entry = Hit.Item; // Instance index, which is the proxy entry index
+		}
+		else if (InspectedActor && Hit.GetActor() == InspectedActor)
+		{
+			Entry = HoveredEntry; // Now hovering the spawned mesh itself
+		}
+	}
+
+	if (Entry != HoveredEntry)
+	{
+		HoveredEntry = Entry;
+		InspectEntry(Entry);
+	}
 }
 
 void AAssetGridVisualizer::BeginDestroy()
 {
+	StopSpawnQueue();
 	CleanupGridContainers();
 	Super::BeginDestroy();
 }
@@ -34,6 +107,7 @@ void AAssetGridVisualizer::BeginDestroy()
 #if WITH_EDITOR
 void AAssetGridVisualizer::Destroyed()
 {
+	StopSpawnQueue();
 	CleanupGridContainers();
 	Super::Destroyed();
 }
@@ -44,18 +118,53 @@ void AAssetGridVisualizer::RefreshLayout()
 	RecalculateLayout();
 }
 
+void AAssetGridVisualizer::ForceRebuildLayout()
+{
+	CleanupGridContainers();
+	RecalculateLayout();
+}
+
 void AAssetGridVisualizer::ResetScript()
 {
 	CleanupGridContainers();
 	Grids.Empty();
 }
 
+/* --------------------------------------------------------------------------
+   Incremental layout.
+
+   • Every entry and every row is hashed. Rows whose hash didn't change keep their
+     actors; the actors of changed rows go back to a pool keyed by entry hash and by
+     mesh, and the rebuilt rows claim from it before spawning anything new.
+   • Rows are then stacked along -X; a row whose origin moved moves its actors,
+     otherwise only its new / re-transformed actors are placed.
+   • Hashing is an O(entries) pass, spawning / destroying / measuring / moving is O(changed).
+   -------------------------------------------------------------------------- */
 void AAssetGridVisualizer::RecalculateLayout()
 {
-	CleanupGridContainers();
+	const double StartTime = FPlatformTime::Seconds();
+	FAssetGridLayoutStats Stats;
 
-	if (Grids.Num() == 0)
+	if (DisplayMode == EAssetGridDisplayMode::Proxies)
+	{
+		if (OwnedActors.Num() > 0)
+		{
+			CleanupGridContainers(); // Leaving instance mode
+		}
+
+		BuildProxies();
+
+		Stats.Entries = ProxyEntries.Num();
+		Stats.Milliseconds = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+		LastLayoutStats = Stats;
 		return;
+	}
+
+	ClearProxies();
+
+	// Pending spawns are queued again by PlaceRow, with this pass's indices
+	SpawnQueue.Reset();
+	SpawnQueueCursor = 0;
 
 	FVector ActorWorldPosition = GetActorLocation();
 	
@@ -63,53 +172,558 @@ void AAssetGridVisualizer::RecalculateLayout()
 
 	for (int32 i = 0; i < Grids.Num(); ++i)
 	{
-		InstantiateGrid(i, ActorWorldPosition, CurrentYOffset);
-		CurrentYOffset += GetGridWidth(i) + GridSeparation;
+		SyncGrid(i, ActorWorldPosition, CurrentYOffset, Stats);
+		CurrentYOffset += Grids[i].LayoutWidth + GridSeparation;
+	}
+
+	DestroyOrphanedActors(Stats);
+	FAssetBoundsCache::Get().Flush();
+
+	Stats.Milliseconds = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	LastLayoutStats = Stats;
+
+	PendingSpawns = SpawnQueue.Num();
+	if (PendingSpawns > 0)
+	{
+		StartSpawnQueue();
 	}
 }
 
-void AAssetGridVisualizer::InstantiateGrid(int32 GridIndex, FVector ActorWorldPosition, float YOffset)
+void AAssetGridVisualizer::SyncGrid(int32 GridIndex, const FVector& ActorWorldPosition, float YOffset, FAssetGridLayoutStats& Stats)
 {
 	if (!Grids.IsValidIndex(GridIndex))
 		return;
 
 	FAssetGrid& Grid = Grids[GridIndex];
-	Grid.InstantiatedAssets.Empty();
 
-	float CurrentX = 0.0f;
+	TArray<FAssetGridSlot> Pool;
+	TMultiMap<uint32, int32> PoolByHash;
+	TMultiMap<UObject*, int32> PoolByPrefab;
 
+	auto PoolRow = [&](FAssetGridRowLayout& RowLayout)
+	{
+		for (FAssetGridSlot& Slot : RowLayout.Slots)
+		{
+			if (!IsValid(Slot.Actor))
+				continue; // Not spawned yet or deleted by hand in the level; respawned if still needed
+
+			Slot.bClaimed = false;
+			const int32 Index = Pool.Add(Slot);
+			PoolByHash.Add(Slot.Hash, Index);
+			PoolByPrefab.Add(Slot.Prefab, Index);
+		}
+		RowLayout.Slots.Reset();
+	};
+
+	// 1. Find the rows that changed and pool their actors
+	TArray<int32> ChangedRows;
 	for (int32 RowIndex = 0; RowIndex < Grid.Rows.Num(); ++RowIndex)
 	{
-		FAssetRow& Row = Grid.Rows[RowIndex];
-		float RowWidth = 0.0f;
-		float CurrentY = YOffset;
+		const uint32 Hash = HashAssetRow(Grid.Rows[RowIndex], Grid.HorizontalSeparation);
+		Stats.Entries += Grid.Rows[RowIndex].Assets.Num();
 
-		for (int32 ColIndex = 0; ColIndex < Row.Assets.Num(); ++ColIndex)
+		if (Grid.LayoutRows.IsValidIndex(RowIndex) && Grid.LayoutRows[RowIndex].Hash == Hash)
 		{
-			FVisualAssetData& AssetData = Row.Assets[ColIndex];
+			bool bStale = false;
+			for (const FAssetGridSlot& Slot : Grid.LayoutRows[RowIndex].Slots)
+			{
+				bStale |= !Slot.bPending && !IsValid(Slot.Actor);
+			}
 
-			if (!AssetData.PrefabReference)
+			if (!bStale)
 				continue;
+		}
+
+		if (!Grid.LayoutRows.IsValidIndex(RowIndex))
+		{
+			Grid.LayoutRows.AddDefaulted();
+		}
+
+		Grid.LayoutRows[RowIndex].Hash = Hash;
+		ChangedRows.Add(RowIndex);
+		PoolRow(Grid.LayoutRows[RowIndex]);
+	}
+
+	for (int32 RowIndex = Grid.LayoutRows.Num() - 1; RowIndex >= Grid.Rows.Num(); --RowIndex)
+	{
+		PoolRow(Grid.LayoutRows[RowIndex]);
+		Grid.LayoutRows.RemoveAt(RowIndex);
+	}
+
+	// 2. Rebuild the changed rows from the pool, spawning only what's missing
+	for (int32 RowIndex : ChangedRows)
+	{
+		BuildRow(Grid, RowIndex, Pool, PoolByHash, PoolByPrefab, Stats);
+	}
+
+	for (const FAssetGridSlot& Slot : Pool)
+	{
+		if (Slot.bClaimed)
+			continue;
+
+		DestroyGridActor(Slot.Actor);
+		OwnedActors.Remove(Slot.Actor);
+		Stats.Destroyed++;
+	}
+
+	// 3. Stack the rows, moving the actors of rows whose origin changed
+	Grid.InstantiatedAssets.Reset();
 
-			FVector WorldPosition = ActorWorldPosition + FVector(CurrentX, CurrentY, 0.0f) + AssetData.PositionOffset;
-			AActor* SpawnedActor = SpawnFromReference(AssetData.PrefabReference, WorldPosition, AssetData.Rotation);
+	float CurrentX = 0.0f;
+	float Width = 0.0f;
+
+	for (int32 RowIndex = 0; RowIndex < Grid.LayoutRows.Num(); ++RowIndex)
+	{
+		FAssetGridRowLayout& RowLayout = Grid.LayoutRows[RowIndex];
+		PlaceRow(RowLayout, ActorWorldPosition + FVector(CurrentX, YOffset, 0.0f), GridIndex, RowIndex, Stats);
 
-			if (SpawnedActor)
+		CurrentX -= RowLayout.Depth + Grid.VerticalSeparation;
+		Width = FMath::Max(Width, RowLayout.Width);
+
+		for (const FAssetGridSlot& Slot : RowLayout.Slots)
+		{
+			if (Slot.Actor)
 			{
-				SpawnedActor->SetActorLocation(WorldPosition);
+				Grid.InstantiatedAssets.Add(Slot.Actor);
+			}
+		}
+	}
+
+	Grid.LayoutWidth = Width;
+	Grid.AppliedHash = Grid.ComputeHash();
+}
+
+void AAssetGridVisualizer::BuildRow(FAssetGrid& Grid, int32 RowIndex, TArray<FAssetGridSlot>& Pool, TMultiMap<uint32, int32>& PoolByHash, TMultiMap<UObject*, int32>& PoolByPrefab, FAssetGridLayoutStats& Stats)
+{
+	const FAssetRow& Row = Grid.Rows[RowIndex];
+	FAssetGridRowLayout& RowLayout = Grid.LayoutRows[RowIndex];
+
+	float CurrentY = 0.0f;
+	float RowDepth = 0.0f;
+	RowLayout.PendingCount = 0;
+
+	FAssetBoundsCache& BoundsCache = FAssetBoundsCache::Get();
+
+	for (const FVisualAssetData& AssetData : Row.Assets)
+	{
+		if (!AssetData.PrefabReference)
+			continue;
+
+		const uint32 Hash = FAssetGrid::HashEntry(AssetData);
+		FAssetGridSlot Slot;
+
+		int32 PoolIndex = ClaimFromPool(Pool, PoolByHash, Hash);
+		if (PoolIndex == INDEX_NONE)
+		{
+			PoolIndex = ClaimFromPool(Pool, PoolByPrefab, AssetData.PrefabReference);
+		}
+
+		if (PoolIndex != INDEX_NONE)
+		{
+			Slot = Pool[PoolIndex];
+
+			if (Slot.Hash != Hash)
+			{
+				Slot.Actor->SetActorRotation(AssetData.Rotation);
+				Slot.Actor->SetActorScale3D(FVector(AssetData.ScaleMultiplier));
+				if (!BoundsCache.TryGetSize(AssetData.PrefabReference, AssetData.Rotation, AssetData.ScaleMultiplier, Slot.Size))
+				{
+					Slot.Size = GetAssetBounds(Slot.Actor);
+				}
+				Stats.Updated++;
+			}
+			else
+			{
+				Stats.Reused++;
+			}
+		}
+		else
+		{
+			Slot.Prefab = AssetData.PrefabReference;
+			Slot.Rotation = AssetData.Rotation;
+			Slot.Scale = AssetData.ScaleMultiplier;
+
+			const bool bHasCachedSize = BoundsCache.TryGetSize(AssetData.PrefabReference, AssetData.Rotation, AssetData.ScaleMultiplier, Slot.Size);
+
+			// With a known size the actor can be placed now and spawned later by the queue
+			if (SpawnBudgetMs > 0.0f && bHasCachedSize)
+			{
+				Slot.bPending = true;
+				RowLayout.PendingCount++;
+				Stats.Queued++;
+			}
+			else
+			{
+				AActor* SpawnedActor = SpawnFromReference(AssetData.PrefabReference, GetActorLocation(), AssetData.Rotation);
+				if (!SpawnedActor)
+					continue;
+
 				SpawnedActor->SetActorRotation(AssetData.Rotation);
 				SpawnedActor->SetActorScale3D(FVector(AssetData.ScaleMultiplier));
+				OwnedActors.Add(SpawnedActor);
+
+				Slot.Actor = SpawnedActor;
+				Slot.Location = SpawnedActor->GetActorLocation();
+				if (!bHasCachedSize)
+				{
+					Slot.Size = GetAssetBounds(SpawnedActor);
+				}
+				Stats.Spawned++;
+			}
+		}
+
+		Slot.Hash = Hash;
+
+		Slot.LocalLocation = FVector(0.0f, CurrentY, 0.0f) + AssetData.PositionOffset;
+
+		RowLayout.Slots.Add(Slot);
+		RowDepth = FMath::Max(RowDepth, Slot.Size.Y);
+		CurrentY += Slot.Size.Y + Grid.HorizontalSeparation;
+	}
+
+	RowLayout.Width = CurrentY;
+	RowLayout.Depth = RowDepth;
+	RowLayout.bRebuilt = true;
+	Stats.RowsRepacked++;
+}
+
+void AAssetGridVisualizer::PlaceRow(FAssetGridRowLayout& Row, const FVector& RowOrigin, int32 GridIndex, int32 RowIndex, FAssetGridLayoutStats& Stats)
+{
+	const bool bShifted = !Row.bPlaced || !Row.Origin.Equals(RowOrigin);
+	if (bShifted)
+	{
+		Row.Origin = RowOrigin;
+		Row.bPlaced = true;
+		Stats.RowsShifted++;
+	}
+
+	// Untouched rows that didn't move have nothing to place
+	if (!bShifted && !Row.bRebuilt && Row.PendingCount == 0)
+		return;
+
+	Row.bRebuilt = false;
+
+	// Reused actors may come from another row, so compare against where they actually are
+	for (int32 SlotIndex = 0; SlotIndex < Row.Slots.Num(); ++SlotIndex)
+	{
+		FAssetGridSlot& Slot = Row.Slots[SlotIndex];
+		const FVector Location = RowOrigin + Slot.LocalLocation;
+
+		if (Slot.bPending)
+		{
+			Slot.Location = Location;
+			SpawnQueue.Add(FIntVector(GridIndex, RowIndex, SlotIndex));
+			continue;
+		}
 
-				Grid.InstantiatedAssets.Add(SpawnedActor);
+		if (Slot.Location.Equals(Location))
+			continue;
 
-				FVector Bounds = GetAssetBounds(SpawnedActor);
-				RowWidth = FMath::Max(RowWidth, Bounds.Y);
-				
-				CurrentY += Bounds.Y + Grid.HorizontalSeparation;
+		Slot.Actor->SetActorLocation(Location);
+		Slot.Location = Location;
+		Stats.Moved++;
+	}
+}
+
+int32 AAssetGridVisualizer::ClaimFromPool(TArray<FAssetGridSlot>& Pool, TMultiMap<uint32, int32>& PoolByHash, uint32 Key)
+{
+	// A slot sits in both pools, so skip the ones the other pool already handed out
+	while (const int32* Found = PoolByHash.Find(Key))
+	{
+		const int32 Index = *Found;
+		PoolByHash.RemoveSingle(Key, Index);
+
+		if (!Pool[Index].bClaimed)
+		{
+			Pool[Index].bClaimed = true;
+			return Index;
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 AAssetGridVisualizer::ClaimFromPool(TArray<FAssetGridSlot>& Pool, TMultiMap<UObject*, int32>& PoolByPrefab, UObject* Key)
+{
+	while (const int32* Found = PoolByPrefab.Find(Key))
+	{
+		const int32 Index = *Found;
+		PoolByPrefab.RemoveSingle(Key, Index);
+
+		if (!Pool[Index].bClaimed)
+		{
+			Pool[Index].bClaimed = true;
+			return Index;
+		}
+	}
+	return INDEX_NONE;
+}
+
+/* --------------------------------------------------------------------------
+   Time-sliced instantiation.
+
+   • The layout pass places queued entries with cached sizes, so only the spawning is
+     left. The core ticker (which also runs in the editor without PIE) spawns them in
+     SpawnBudgetMs slices, logging progress every 10%.
+   • A new layout pass rebuilds the queue, so spawns of rows that changed meanwhile are dropped.
+   -------------------------------------------------------------------------- */
+void AAssetGridVisualizer::StartSpawnQueue()
+{
+	if (SpawnTickerHandle.IsValid())
+		return;
+
+	SpawnedFromQueue = 0;
+	LastReportedProgress = -1;
+	SpawnTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &AAssetGridVisualizer::TickSpawnQueue));
+}
+
+void AAssetGridVisualizer::StopSpawnQueue()
+{
+	if (!SpawnTickerHandle.IsValid())
+		return;
+
+	FTSTicker::GetCoreTicker().RemoveTicker(SpawnTickerHandle);
+	SpawnTickerHandle.Reset();
+}
+
+bool AAssetGridVisualizer::TickSpawnQueue(float DeltaTime)
+{
+	ProcessSpawnQueue(SpawnBudgetMs / 1000.0);
+
+	const int32 Total = SpawnedFromQueue + PendingSpawns;
+	const int32 Progress = Total > 0 ? (SpawnedFromQueue * 10) / Total : 10;
+	if (Progress != LastReportedProgress)
+	{
+		LastReportedProgress = Progress;
+		UE_LOG(LogTemp, Log, TEXT("AssetGridVisualizer: Spawned %d / %d assets"), SpawnedFromQueue, Total);
+	}
+
+	if (PendingSpawns > 0)
+		return true;
+
+	SpawnTickerHandle.Reset();
+	return false;
+}
+
+void AAssetGridVisualizer::ProcessSpawnQueue(double BudgetSeconds)
+{
+	const double EndTime = FPlatformTime::Seconds() + BudgetSeconds;
+
+	while (SpawnQueueCursor < SpawnQueue.Num() && FPlatformTime::Seconds() < EndTime)
+	{
+		const FIntVector Entry = SpawnQueue[SpawnQueueCursor++];
+		if (!Grids.IsValidIndex(Entry.X) || !Grids[Entry.X].LayoutRows.IsValidIndex(Entry.Y))
+			continue;
+
+		FAssetGrid& Grid = Grids[Entry.X];
+		FAssetGridRowLayout& Row = Grid.LayoutRows[Entry.Y];
+		if (!Row.Slots.IsValidIndex(Entry.Z) || !Row.Slots[Entry.Z].bPending)
+			continue;
+
+		FAssetGridSlot& Slot = Row.Slots[Entry.Z];
+		Slot.bPending = false;
+		Row.PendingCount--;
+
+		AActor* SpawnedActor = SpawnFromReference(Slot.Prefab, Slot.Location, Slot.Rotation);
+		if (!SpawnedActor)
+			continue;
+
+		SpawnedActor->SetActorLocationAndRotation(Slot.Location, Slot.Rotation);
+		SpawnedActor->SetActorScale3D(FVector(Slot.Scale));
+		OwnedActors.Add(SpawnedActor);
+		Grid.InstantiatedAssets.Add(SpawnedActor);
+
+		Slot.Actor = SpawnedActor;
+		SpawnedFromQueue++;
+	}
+
+	PendingSpawns = SpawnQueue.Num() - SpawnQueueCursor;
+}
+
+void AAssetGridVisualizer::FinishPendingSpawns()
+{
+	ProcessSpawnQueue(TNumericLimits<double>::Max() / 2.0);
+	StopSpawnQueue();
+}
+
+/* --------------------------------------------------------------------------
+   Proxy display.
+
+   • Same layout as the actors (sizes from FAssetBoundsCache) but nothing is spawned:
+     each entry is one instance of a plane in a single instanced static mesh component,
+     textured from FAssetThumbnailAtlas through ProxyMaterial and per-instance custom data.
+   • The real mesh of an entry is only spawned by InspectEntry: on hover in game, or
+     from the details panel with Inspect Proxy Entry.
+   -------------------------------------------------------------------------- */
+void AAssetGridVisualizer::BuildProxies()
+{
+	ClearInspected();
+	ProxyEntries.Reset();
+
+	FAssetBoundsCache& BoundsCache = FAssetBoundsCache::Get();
+	FAssetThumbnailAtlas& Atlas = FAssetThumbnailAtlas::Get();
+	TArray<int32> Tiles;
+
+	const FVector ActorWorldPosition = GetActorLocation();
+	float CurrentYOffset = 0.0f;
+
+	for (const FAssetGrid& Grid : Grids)
+	{
+		float CurrentX = 0.0f;
+		float GridWidth = 0.0f;
+
+		for (const FAssetRow& Row : Grid.Rows)
+		{
+			float CurrentY = CurrentYOffset;
+			float RowDepth = 0.0f;
+
+			for (const FVisualAssetData& AssetData : Row.Assets)
+			{
+				FVector Size;
+				if (!AssetData.PrefabReference || !BoundsCache.TryGetSize(AssetData.PrefabReference, AssetData.Rotation, AssetData.ScaleMultiplier, Size))
+					continue;
+
+				FAssetGridProxyEntry& Entry = ProxyEntries.AddDefaulted_GetRef();
+				Entry.Prefab = AssetData.PrefabReference;
+				Entry.Location = ActorWorldPosition + FVector(CurrentX, CurrentY, 0.0f) + AssetData.PositionOffset;
+				Entry.Rotation = AssetData.Rotation;
+				Entry.Scale = AssetData.ScaleMultiplier;
+				Tiles.Add(Atlas.GetTile(GetWorld(), Cast<UStaticMesh>(AssetData.PrefabReference)));
+
+				RowDepth = FMath::Max(RowDepth, Size.Y);
+				CurrentY += Size.Y + Grid.HorizontalSeparation;
 			}
+
+			GridWidth = FMath::Max(GridWidth, CurrentY - CurrentYOffset);
+			CurrentX -= RowDepth + Grid.VerticalSeparation;
 		}
 
-		CurrentX -= RowWidth + Grid.VerticalSeparation;
+		CurrentYOffset += GridWidth + GridSeparation;
+	}
+
+	FAssetBoundsCache::Get().Flush();
+
+	// Tile rects are only final once the atlas stopped growing
+	Atlas.Flush();
+
+	if (!ProxyComponent)
+	{
+		UStaticMesh* Plane = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Plane.Plane"));
+
+		ProxyComponent = NewObject<UInstancedStaticMeshComponent>(this, TEXT("GridProxies"), RF_Transient);
+		ProxyComponent->SetStaticMesh(Plane);
+		ProxyComponent->NumCustomDataFloats = 4;
+		ProxyComponent->SetCastShadow(false);
+		ProxyComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		ProxyComponent->SetCollisionResponseToAllChannels(ECR_Ignore);
+		ProxyComponent->SetCollisionResponseToChannel(ECC_Visibility, ECR_Block);
+		if (RootComponent)
+		{
+			ProxyComponent->SetupAttachment(RootComponent);
+		}
+		ProxyComponent->RegisterComponent();
+	}
+
+	if (ProxyMaterial)
+	{
+		if (!ProxyMaterialInstance || ProxyMaterialInstance->Parent != ProxyMaterial)
+		{
+			ProxyMaterialInstance = UMaterialInstanceDynamic::Create(ProxyMaterial, this);
+		}
+		ProxyMaterialInstance->SetTextureParameterValue(TEXT("Atlas"), Atlas.GetTexture());
+		ProxyComponent->SetMaterial(0, ProxyMaterialInstance);
+	}
+
+	// The engine plane is 100 x 100 units; each quad is a square filling the entry's cell
+	ProxyComponent->ClearInstances();
+	for (int32 i = 0; i < ProxyEntries.Num(); ++i)
+	{
+		const FAssetGridProxyEntry& Entry = ProxyEntries[i];
+
+		FVector Size;
+		BoundsCache.TryGetSize(Entry.Prefab, Entry.Rotation, Entry.Scale, Size);
+		const float Side = FMath::Max(Size.Y, 1.0f) / 100.0f;
+
+		const FTransform Transform(FRotator::ZeroRotator, Entry.Location + FVector(0.0f, 0.0f, 1.0f), FVector(Side, Side, 1.0f));
+		const int32 Instance = ProxyComponent->AddInstance(Transform, true);
+
+		const FVector4 Tile = Atlas.GetTileRect(Tiles[i]);
+		ProxyComponent->SetCustomDataValue(Instance, 0, Tile.X, false);
+		ProxyComponent->SetCustomDataValue(Instance, 1, Tile.Y, false);
+		ProxyComponent->SetCustomDataValue(Instance, 2, Tile.Z, false);
+		ProxyComponent->SetCustomDataValue(Instance, 3, Tile.W, false);
+	}
+	ProxyComponent->MarkRenderStateDirty();
+}
+
+void AAssetGridVisualizer::ClearProxies()
+{
+	ClearInspected();
+	ProxyEntries.Reset();
+
+	if (ProxyComponent && !ProxyComponent->IsBeingDestroyed())
+	{
+		ProxyComponent->DestroyComponent();
+	}
+	ProxyComponent = nullptr;
+}
+
+AActor* AAssetGridVisualizer::InspectEntry(int32 EntryIndex)
+{
+	ClearInspected();
+
+	if (!ProxyEntries.IsValidIndex(EntryIndex))
+		return nullptr;
+
+	const FAssetGridProxyEntry& Entry = ProxyEntries[EntryIndex];
+	InspectedActor = SpawnFromReference(Entry.Prefab, Entry.Location, Entry.Rotation);
+	if (InspectedActor)
+	{
+		InspectedActor->SetActorScale3D(FVector(Entry.Scale));
+	}
+	return InspectedActor;
+}
+
+void AAssetGridVisualizer::InspectProxyEntry()
+{
+	InspectEntry(InspectIndex);
+}
+
+void AAssetGridVisualizer::ClearInspected()
+{
+	DestroyGridActor(InspectedActor);
+	InspectedActor = nullptr;
+}
+
+void AAssetGridVisualizer::DestroyOrphanedActors(FAssetGridLayoutStats& Stats)
+{
+	int32 LiveActors = 0;
+	for (const FAssetGrid& Grid : Grids)
+	{
+		LiveActors += Grid.InstantiatedAssets.Num();
+	}
+
+	// Only true after a grid was removed or an actor deleted by hand
+	if (LiveActors == OwnedActors.Num())
+		return;
+
+	TSet<AActor*> Live;
+	Live.Reserve(LiveActors);
+	for (const FAssetGrid& Grid : Grids)
+	{
+		Live.Append(Grid.InstantiatedAssets);
+	}
+
+	for (auto It = OwnedActors.CreateIterator(); It; ++It)
+	{
+		if (Live.Contains(*It))
+			continue;
+
+		if (IsValid(*It))
+		{
+			DestroyGridActor(*It);
+			Stats.Destroyed++;
+		}
+		It.RemoveCurrent();
 	}
 }
 
@@ -163,23 +777,44 @@ float AAssetGridVisualizer::GetGridWidth(int32 GridIndex) const
 
 void AAssetGridVisualizer::CleanupGridContainers()
 {
+	ClearProxies();
+
+	SpawnQueue.Reset();
+	SpawnQueueCursor = 0;
+	PendingSpawns = 0;
+
 	for (FAssetGrid& Grid : Grids)
 	{
 		for (AActor* Asset : Grid.InstantiatedAssets)
 		{
-			if (Asset && !Asset->IsActorBeingDestroyed())
-			{
-#if WITH_EDITOR
-				if (GIsEditor && GetWorld() && !GetWorld()->IsGameWorld())
-				{
-					Asset->SetFlags(RF_Transient);
-				}
-#endif
-				Asset->Destroy();
-			}
+			DestroyGridActor(Asset);
+			OwnedActors.Remove(Asset);
 		}
 		Grid.InstantiatedAssets.Empty();
+		Grid.LayoutRows.Empty();
+		Grid.LayoutWidth = 0.0f;
+		Grid.AppliedHash = 0;
+	}
+
+	for (AActor* Asset : OwnedActors)
+	{
+		DestroyGridActor(Asset);
 	}
+	OwnedActors.Empty();
+}
+
+void AAssetGridVisualizer::DestroyGridActor(AActor* Asset) const
+{
+	if (!IsValid(Asset) || Asset->IsActorBeingDestroyed())
+		return;
+
+#if WITH_EDITOR
+	if (GIsEditor && GetWorld() && !GetWorld()->IsGameWorld())
+	{
+		Asset->SetFlags(RF_Transient);
+	}
+#endif
+	Asset->Destroy();
 }
 
 FVector AAssetGridVisualizer::GetAssetBounds(AActor* Asset) const
@@ -197,12 +832,9 @@ FVector AAssetGridVisualizer::GetPrefabBounds(UObject* PrefabReference) const
 	if (!PrefabReference)
 		return FVector(0.1f, 0.1f, 0.1f);
 
-	// Only accept Static Mesh for this version
-	if (UStaticMesh* Mesh = Cast<UStaticMesh>(PrefabReference))
-	{
-		FBox MeshBounds = Mesh->GetBoundingBox();
-		return MeshBounds.GetSize();
-	}
+	FBox CachedBounds;
+	if (FAssetBoundsCache::Get().TryGetBounds(PrefabReference, CachedBounds))
+		return CachedBounds.GetSize();
 
 	return FVector(0.1f, 0.1f, 0.1f);
 }
\ No newline at end of file
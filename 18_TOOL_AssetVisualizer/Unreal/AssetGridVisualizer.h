@@ -2,8 +2,21 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Containers/Ticker.h"
 #include "AssetGridVisualizer.generated.h"
 
+class UStaticMesh;
+class UMaterialInterface;
+class UMaterialInstanceDynamic;
+class UInstancedStaticMeshComponent;
+
+UENUM(BlueprintType)
+enum class EAssetGridDisplayMode : uint8
+{
+	Instances,  // Every entry is a spawned actor
+	Proxies     // One thumbnail quad per entry; the real mesh is only spawned when inspected
+};
+
 USTRUCT(BlueprintType)
 struct FVisualAssetData
 {
@@ -31,6 +44,80 @@ struct FAssetRow
 	TArray<FVisualAssetData> Assets;
 };
 
+// One laid out entry: the spawned actor and what it was built from
+USTRUCT()
+struct FAssetGridSlot
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	AActor* Actor = nullptr;
+
+	UPROPERTY()
+	UObject* Prefab = nullptr;
+
+	uint32 Hash = 0;
+	FVector Size = FVector::ZeroVector;           // Measured bounds at the current scale / rotation
+	FVector LocalLocation = FVector::ZeroVector;  // Relative to the row origin, offset included
+	FVector Location = FVector::ZeroVector;       // World location last written to the actor
+	bool bClaimed = false;
+
+	// Deferred spawn (see AAssetGridVisualizer::TickSpawnQueue)
+	bool bPending = false;
+	FRotator Rotation = FRotator::ZeroRotator;
+	float Scale = 1.0f;
+};
+
+USTRUCT()
+struct FAssetGridRowLayout
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FAssetGridSlot> Slots;
+
+	uint32 Hash = 0;
+	float Width = 0.0f;  // Along Y
+	float Depth = 0.0f;  // Along X
+	FVector Origin = FVector::ZeroVector; // World origin the row's actors were last placed from
+	bool bPlaced = false;
+	bool bRebuilt = false;
+	int32 PendingCount = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FAssetGridLayoutStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid") int32 Entries = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid") int32 Spawned = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid") int32 Queued = 0;   // Left to the time-sliced spawn queue
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid") int32 Destroyed = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid") int32 Updated = 0;  // Reused with a new scale / rotation
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid") int32 Reused = 0;   // Reused untouched
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid") int32 Moved = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid") int32 RowsRepacked = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid") int32 RowsShifted = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid") float Milliseconds = 0.0f;
+
+	FString ToString() const;
+};
+
+// One entry of the proxy display, laid out like its actor would be
+USTRUCT()
+struct FAssetGridProxyEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UObject* Prefab = nullptr;
+
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	float Scale = 1.0f;
+};
+
 USTRUCT(BlueprintType)
 struct FAssetGrid
 {
@@ -49,6 +136,15 @@ struct FAssetGrid
 	UPROPERTY(VisibleAnywhere, Category = "Grid")
 	TArray<AActor*> InstantiatedAssets;
 
+	// Incremental layout state (see AAssetGridVisualizer::SyncGrid)
+	UPROPERTY(Transient)
+	TArray<FAssetGridRowLayout> LayoutRows;
+
+	uint32 AppliedHash = 0;
+	float LayoutWidth = 0.0f;
+
+	static uint32 HashEntry(const FVisualAssetData& AssetData);
+	uint32 ComputeHash() const;
 	bool HasConfigChanged() const;
 };
 
@@ -63,12 +159,40 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid")
 	bool bEnabledInEditor = true;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid")
+	EAssetGridDisplayMode DisplayMode = EAssetGridDisplayMode::Instances;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid")
 	float GridSeparation = 1000.0f;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid")
 	TArray<FAssetGrid> Grids;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid")
+	FAssetGridLayoutStats LastLayoutStats;
+
+	// Spawn time per editor frame for new actors. 0 spawns everything in the layout pass.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Instantiation", meta = (ClampMin = "0"))
+	float SpawnBudgetMs = 8.0f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid|Instantiation")
+	int32 PendingSpawns = 0;
+
+	// Material for the proxy quads: reads the UV rect of its tile from PerInstanceCustomData 0-3
+	// (U, V, width, height) and samples the "Atlas" texture parameter. Default material when empty.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Proxies", meta = (EditCondition = "DisplayMode == EAssetGridDisplayMode::Proxies"))
+	UMaterialInterface* ProxyMaterial = nullptr;
+
+	// In game, spawns the real mesh of the proxy under the mouse cursor
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Proxies", meta = (EditCondition = "DisplayMode == EAssetGridDisplayMode::Proxies"))
+	bool bInspectOnHover = true;
+
+	// Entry spawned by Inspect Proxy Entry (flattened over grids and rows)
+	UPROPERTY(EditAnywhere, Category = "Grid|Proxies", meta = (ClampMin = "0", EditCondition = "DisplayMode == EAssetGridDisplayMode::Proxies"))
+	int32 InspectIndex = 0;
+
+	virtual void Tick(float DeltaSeconds) override;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void BeginDestroy() override;
@@ -78,9 +202,28 @@ protected:
 #endif
 
 public:
+	// Applies the changes since the last layout, only touching the entries that changed
 	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Grid")
 	void RefreshLayout();
 
+	// Destroys every spawned actor and lays everything out again
+	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Grid")
+	void ForceRebuildLayout();
+
+	// Spawns everything still queued right away
+	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Grid|Instantiation")
+	void FinishPendingSpawns();
+
+	// Spawns the real mesh of one proxy entry (INDEX_NONE clears it)
+	UFUNCTION(BlueprintCallable, Category = "Grid|Proxies")
+	AActor* InspectEntry(int32 EntryIndex);
+
+	UFUNCTION(CallInEditor, Category = "Grid|Proxies")
+	void InspectProxyEntry();
+
+	UFUNCTION(CallInEditor, Category = "Grid|Proxies")
+	void ClearInspected();
+
 	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Grid")
 	void ResetScript();
 
@@ -88,9 +231,48 @@ public:
 	float GetGridWidth(int32 GridIndex) const;
 
 private:
+	// Every actor spawned by the grids, to catch the ones orphaned when a grid is removed
+	UPROPERTY(Transient)
+	TSet<AActor*> OwnedActors;
+
+	// Grid / row / slot of every pending spawn, rebuilt by each layout pass
+	TArray<FIntVector> SpawnQueue;
+	int32 SpawnQueueCursor = 0;
+	int32 SpawnedFromQueue = 0;
+	int32 LastReportedProgress = -1;
+	FTSTicker::FDelegateHandle SpawnTickerHandle;
+
+	UPROPERTY(Transient)
+	UInstancedStaticMeshComponent* ProxyComponent = nullptr;
+
+	UPROPERTY(Transient)
+	UMaterialInstanceDynamic* ProxyMaterialInstance = nullptr;
+
+	UPROPERTY(Transient)
+	TArray<FAssetGridProxyEntry> ProxyEntries;
+
+	UPROPERTY(Transient)
+	AActor* InspectedActor = nullptr;
+
+	int32 HoveredEntry = INDEX_NONE;
+
+	void BuildProxies();
+	void ClearProxies();
+
+	bool TickSpawnQueue(float DeltaTime);
+	void ProcessSpawnQueue(double BudgetSeconds);
+	void StartSpawnQueue();
+	void StopSpawnQueue();
+
 	void RecalculateLayout();
 	void CleanupGridContainers();
-	void InstantiateGrid(int32 GridIndex, FVector ActorWorldPosition, float YOffset);
+	void SyncGrid(int32 GridIndex, const FVector& ActorWorldPosition, float YOffset, FAssetGridLayoutStats& Stats);
+	void BuildRow(FAssetGrid& Grid, int32 RowIndex, TArray<FAssetGridSlot>& Pool, TMultiMap<uint32, int32>& PoolByHash, TMultiMap<UObject*, int32>& PoolByPrefab, FAssetGridLayoutStats& Stats);
+	void PlaceRow(FAssetGridRowLayout& Row, const FVector& RowOrigin, int32 GridIndex, int32 RowIndex, FAssetGridLayoutStats& Stats);
+	static int32 ClaimFromPool(TArray<FAssetGridSlot>& Pool, TMultiMap<uint32, int32>& PoolByHash, uint32 Key);
+	static int32 ClaimFromPool(TArray<FAssetGridSlot>& Pool, TMultiMap<UObject*, int32>& PoolByPrefab, UObject* Key);
+	void DestroyOrphanedActors(FAssetGridLayoutStats& Stats);
+	void DestroyGridActor(AActor* Asset) const;
 	FVector GetAssetBounds(AActor* Asset) const;
 	FVector GetPrefabBounds(UObject* PrefabReference) const;
 	AActor* SpawnFromReference(UObject* Reference, const FVector& Location, const FRotator& Rotation);
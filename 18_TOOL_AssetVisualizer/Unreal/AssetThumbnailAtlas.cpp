@@ -0,0 +1,269 @@
+#include "AssetThumbnailAtlas.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/Texture2D.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Engine/World.h"
+#include "JsonObjectConverter.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "TextureResource.h"
+
+FAssetThumbnailAtlas& FAssetThumbnailAtlas::Get()
+{
+    static FAssetThumbnailAtlas Instance;
+    return Instance;
+}
+
+FAssetThumbnailAtlas::FAssetThumbnailAtlas()
+{
+    Load();
+}
+
+int32 FAssetThumbnailAtlas::GetTile(UWorld* World, UStaticMesh* Mesh)
+{
+    if (!Mesh)
+        return INDEX_NONE;
+
+    const FString Key = Mesh->GetPathName();
+    const FGuid& Guid = Mesh->GetLightingGuid();
+    const FString ContentHash = Guid.IsValid() ? Guid.ToString() : FString();
+
+    FAssetThumbnailAtlasEntry* Entry = Entries.Find(Key);
+    if (Entry && !ContentHash.IsEmpty() && Entry->ContentHash == ContentHash)
+    {
+        Hits++;
+        return Entry->Tile;
+    }
+
+    if (!Entry)
+    {
+        Entry = &Entries.Add(Key);
+        Entry->Key = Key;
+        Entry->Tile = TileCount++;
+        EnsureCapacity(TileCount);
+    }
+
+    Entry->ContentHash = ContentHash;
+
+    TArray<FColor> TilePixels;
+    if (!RenderThumbnail(World, Mesh, TilePixels))
+    {
+        Placeholder(Key, TilePixels);
+    }
+
+    WriteTile(Entry->Tile, TilePixels);
+    Rendered++;
+    return Entry->Tile;
+}
+
+FVector4 FAssetThumbnailAtlas::GetTileRect(int32 Tile) const
+{
+    if (Tile < 0 || Height <= 0)
+        return FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+
+    const float Width = Columns * TileSize;
+    return FVector4((Tile % Columns) * TileSize / Width, (Tile / Columns) * TileSize / static_cast<float>(Height),
+        TileSize / Width, TileSize / static_cast<float>(Height));
+}
+
+void FAssetThumbnailAtlas::Flush()
+{
+    if (!bDirty && Texture)
+        return;
+
+    bDirty = false;
+    UploadTexture();
+
+    // Raw BGRA pixels next to a JSON index, so no image codec module is needed
+    FAssetThumbnailAtlasIndex Index;
+    Index.Height = Height;
+    Index.TileCount = TileCount;
+    Entries.GenerateValueArray(Index.Entries);
+
+    FString Json;
+    if (FJsonObjectConverter::UStructToJsonObjectString(Index, Json))
+    {
+        FFileHelper::SaveStringToFile(Json, *(GetFolder() / TEXT("Atlas.json")));
+        FFileHelper::SaveArrayToFile(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Pixels.GetData()), Pixels.Num() * sizeof(FColor)),
+            *(GetFolder() / TEXT("Atlas.bgra")));
+    }
+}
+
+void FAssetThumbnailAtlas::Clear()
+{
+    Entries.Empty();
+    Pixels.Empty();
+    Height = 0;
+    TileCount = 0;
+    Rendered = Hits = 0;
+    EnsureCapacity(1);
+    Flush();
+}
+
+FString FAssetThumbnailAtlas::GetFolder()
+{
+    return FPaths::ProjectSavedDir() / TEXT("AssetGridVisualizer");
+}
+
+void FAssetThumbnailAtlas::Load()
+{
+    FString Json;
+    TArray<uint8> Raw;
+    FAssetThumbnailAtlasIndex Index;
+
+    const bool bLoaded = FFileHelper::LoadFileToString(Json, *(GetFolder() / TEXT("Atlas.json")))
+        && FFileHelper::LoadFileToArray(Raw, *(GetFolder() / TEXT("Atlas.bgra")))
+        && FJsonObjectConverter::JsonObjectStringToUStruct(Json, &Index, 0, 0)
+        && Raw.Num() == Index.Height * Columns * TileSize * static_cast<int32>(sizeof(FColor));
+
+    if (bLoaded)
+    {
+        Height = Index.Height;
+        TileCount = Index.TileCount;
+        Pixels.SetNumUninitialized(Raw.Num() / sizeof(FColor));
+        FMemory::Memcpy(Pixels.GetData(), Raw.GetData(), Raw.Num());
+
+        for (const FAssetThumbnailAtlasEntry& Entry : Index.Entries)
+        {
+            Entries.Add(Entry.Key, Entry);
+        }
+    }
+
+    EnsureCapacity(FMath::Max(1, TileCount));
+}
+
+// Grows the atlas downwards by doubling its rows; existing tiles keep their pixel position
+void FAssetThumbnailAtlas::EnsureCapacity(int32 Tiles)
+{
+    const int32 Rows = FMath::DivideAndRoundUp(Tiles, Columns);
+    if (Height >= Rows * TileSize)
+        return;
+
+    int32 NewHeight = TileSize;
+    while (NewHeight < Rows * TileSize)
+    {
+        NewHeight *= 2;
+    }
+
+    Pixels.AddZeroed((NewHeight - Height) * Columns * TileSize);
+    Height = NewHeight;
+    bDirty = true;
+}
+
+void FAssetThumbnailAtlas::WriteTile(int32 Tile, const TArray<FColor>& TilePixels)
+{
+    const int32 Width = Columns * TileSize;
+    const int32 X = (Tile % Columns) * TileSize;
+    const int32 Y = (Tile / Columns) * TileSize;
+
+    for (int32 Row = 0; Row < TileSize; ++Row)
+    {
+        FMemory::Memcpy(&Pixels[(Y + Row) * Width + X], &TilePixels[Row * TileSize], TileSize * sizeof(FColor));
+    }
+    bDirty = true;
+}
+
+void FAssetThumbnailAtlas::UploadTexture()
+{
+    if (!FApp::CanEverRender())
+        return;
+
+    UTexture2D* NewTexture = UTexture2D::CreateTransient(Columns * TileSize, Height, PF_B8G8R8A8);
+    if (!NewTexture)
+        return;
+
+    NewTexture->Filter = TF_Bilinear;
+    NewTexture->AddressX = TA_Clamp;
+    NewTexture->AddressY = TA_Clamp;
+
+    FTexture2DMipMap& Mip = NewTexture->GetPlatformData()->Mips[0];
+    void* Data = Mip.BulkData.Lock(LOCK_READ_WRITE);
+    FMemory::Memcpy(Data, Pixels.GetData(), Pixels.Num() * sizeof(FColor));
+    Mip.BulkData.Unlock();
+    NewTexture->UpdateResource();
+
+    NewTexture->AddToRoot();
+    if (Texture)
+    {
+        Texture->RemoveFromRoot();
+    }
+    Texture = NewTexture;
+}
+
+bool FAssetThumbnailAtlas::RenderThumbnail(UWorld* World, UStaticMesh* Mesh, TArray<FColor>& OutPixels)
+{
+    if (!World || !FApp::CanEverRender())
+        return false;
+
+    // Staged far below the level; the show-only list keeps everything else out of the capture
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.ObjectFlags = RF_Transient;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    const FVector StageLocation(0.0f, 0.0f, -100000.0f);
+    AStaticMeshActor* Subject = World->SpawnActor<AStaticMeshActor>(StageLocation, FRotator::ZeroRotator, SpawnParams);
+    if (!Subject)
+        return false;
+
+    Subject->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
+    Subject->GetStaticMeshComponent()->SetStaticMesh(Mesh);
+
+    UTextureRenderTarget2D* Target = NewObject<UTextureRenderTarget2D>(GetTransientPackage());
+    Target->RenderTargetFormat = RTF_RGBA8;
+    Target->ClearColor = FLinearColor::Transparent;
+    Target->InitAutoFormat(TileSize, TileSize);
+    Target->UpdateResourceImmediate(true);
+
+    USceneCaptureComponent2D* Capture = NewObject<USceneCaptureComponent2D>(Subject);
+    Capture->bCaptureEveryFrame = false;
+    Capture->bCaptureOnMovement = false;
+    Capture->PrimitiveRenderMode = ESceneCapturePrimitiveRenderMode::PRM_UseShowOnlyList;
+    Capture->ShowOnlyActors.Add(Subject);
+    Capture->CaptureSource = SCS_FinalColorLDR;
+    Capture->FOVAngle = 30.0f;
+    Capture->TextureTarget = Target;
+    Capture->RegisterComponent();
+
+    // Frame the bounding sphere from the front-right, slightly above
+    const FBoxSphereBounds Bounds = Mesh->GetBounds();
+    const FVector Center = StageLocation + Bounds.Origin;
+    const float Radius = FMath::Max(Bounds.SphereRadius, 1.0f);
+    const float Distance = Radius / FMath::Sin(FMath::DegreesToRadians(Capture->FOVAngle * 0.5f));
+    const FVector CameraLocation = Center + FVector(1.0f, 1.0f, 0.8f).GetSafeNormal() * Distance;
+
+    Capture->SetWorldLocationAndRotation(CameraLocation, (Center - CameraLocation).Rotation());
+    Capture->CaptureScene();
+
+    bool bRead = false;
+    if (FTextureRenderTargetResource* Resource = Target->GameThread_GetRenderTargetResource())
+    {
+        bRead = Resource->ReadPixels(OutPixels) && OutPixels.Num() == TileSize * TileSize;
+    }
+
+    Capture->DestroyComponent();
+    Subject->Destroy();
+    Target->ReleaseResource();
+    return bRead;
+}
+
+// Stable colour per mesh with a darker border, for -nullrhi runs
+void FAssetThumbnailAtlas::Placeholder(const FString& Key, TArray<FColor>& OutPixels)
+{
+    const uint8 Hue = static_cast<uint8>(GetTypeHash(Key) & 0xFF);
+    const FColor Fill = FLinearColor::MakeFromHSV8(Hue, 115, 215).ToFColor(true);
+    const FColor Border = FLinearColor::MakeFromHSV8(Hue, 115, 130).ToFColor(true);
+
+    OutPixels.SetNumUninitialized(TileSize * TileSize);
+    for (int32 Y = 0; Y < TileSize; ++Y)
+    {
+        for (int32 X = 0; X < TileSize; ++X)
+        {
+            const bool bEdge = X < 4 || Y < 4 || X >= TileSize - 4 || Y >= TileSize - 4;
+            OutPixels[Y * TileSize + X] = bEdge ? Border : Fill;
+        }
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetThumbnailAtlas.generated.h"
+
+class UStaticMesh;
+class UTexture2D;
+class UWorld;
+
+USTRUCT()
+struct FAssetThumbnailAtlasEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FString Key;
+
+    UPROPERTY()
+    FString ContentHash;
+
+    UPROPERTY()
+    int32 Tile = 0;
+};
+
+USTRUCT()
+struct FAssetThumbnailAtlasIndex
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 Height = 0;
+
+    UPROPERTY()
+    int32 TileCount = 0;
+
+    UPROPERTY()
+    TArray<FAssetThumbnailAtlasEntry> Entries;
+};
+
+/* --------------------------------------------------------------------------
+   Thumbnail atlas for the Asset Grid Visualizer proxy mode.
+
+   • Each mesh is rendered once by a scene capture (show-only list, so nothing else in
+     the level is drawn) into a TileSize square and copied into one BGRA atlas.
+   • The pixels and a JSON index live in Saved/AssetGridVisualizer, keyed like
+     FAssetBoundsCache (object path + lighting GUID), so only new or rebuilt meshes are
+     rendered again.
+   • Works on any RHI, software Vulkan (lavapipe / SwiftShader) included. With -nullrhi
+     nothing can be rendered and tiles get a flat colour per mesh instead.
+   • Tiles are allocated with GetTile(); call Flush() once per pass before GetTileRect()
+     and GetTexture(), since the atlas may have grown.
+   -------------------------------------------------------------------------- */
+class MECHANICS_TEST_LVN_API FAssetThumbnailAtlas
+{
+public:
+    static constexpr int32 TileSize = 128;
+    static constexpr int32 Columns = 32;
+
+    static FAssetThumbnailAtlas& Get();
+
+    int32 GetTile(UWorld* World, UStaticMesh* Mesh);
+    FVector4 GetTileRect(int32 Tile) const; // U, V, width, height
+    UTexture2D* GetTexture() const { return Texture; }
+
+    void Flush();
+    void Clear();
+
+    int32 GetRendered() const { return Rendered; }
+    int32 GetHits() const { return Hits; }
+
+private:
+    FAssetThumbnailAtlas();
+
+    static FString GetFolder();
+    static bool RenderThumbnail(UWorld* World, UStaticMesh* Mesh, TArray<FColor>& OutPixels);
+    static void Placeholder(const FString& Key, TArray<FColor>& OutPixels);
+
+    void Load();
+    void EnsureCapacity(int32 Tiles);
+    void WriteTile(int32 Tile, const TArray<FColor>& TilePixels);
+    void UploadTexture();
+
+    TMap<FString, FAssetThumbnailAtlasEntry> Entries;
+    TArray<FColor> Pixels; // Atlas, top row first
+    int32 Height = 0;
+    int32 TileCount = 0;
+    bool bDirty = false;
+
+    UTexture2D* Texture = nullptr; // Rooted, the atlas outlives any visualizer
+
+    int32 Rendered = 0;
+    int32 Hits = 0;
+};
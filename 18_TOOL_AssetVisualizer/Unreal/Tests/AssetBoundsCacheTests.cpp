@@ -0,0 +1,58 @@
+#include "Misc/AutomationTest.h"
+#include "AssetBoundsCache.h"
+#include "Engine/StaticMesh.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Checks bounds cache hits, invalidation after a rebuild and rotated sizes on a transient mesh, with no level or viewport.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.AssetVisualizer; Quit" -nullrhi -unattended
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAssetBoundsCacheTest, "LVN.AssetVisualizer.BoundsCache.HitsAndInvalidation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FAssetBoundsCacheTest::RunTest(const FString& Parameters)
+{
+	FAssetBoundsCache& Cache = FAssetBoundsCache::Get();
+
+	UStaticMesh* Mesh = NewObject<UStaticMesh>(GetTransientPackage(), NAME_None, RF_Transient);
+	Mesh->SetExtendedBounds(FBoxSphereBounds(FBox(FVector(-50.0f), FVector(50.0f))));
+	Mesh->SetLightingGuid();
+
+	int32 Misses = Cache.GetMisses();
+	const int32 Hits = Cache.GetHits();
+
+	FBox First;
+	TestTrue(TEXT("Transient mesh is measured"), Cache.TryGetBounds(Mesh, First));
+	TestEqual(TEXT("First lookup is a miss"), Cache.GetMisses(), Misses + 1);
+	TestTrue(TEXT("Measured a 100 unit cube"), First.GetSize().Equals(FVector(100.0f)));
+
+	FBox Second;
+	Cache.TryGetBounds(Mesh, Second);
+	TestEqual(TEXT("Second lookup is a hit"), Cache.GetHits(), Hits + 1);
+
+	// A rebuilt / reimported mesh gets a new lighting GUID
+	Mesh->SetExtendedBounds(FBoxSphereBounds(FBox(FVector(-100.0f, -50.0f, -50.0f), FVector(100.0f, 50.0f, 50.0f))));
+	Mesh->SetLightingGuid();
+
+	Misses = Cache.GetMisses();
+	FBox Rebuilt;
+	Cache.TryGetBounds(Mesh, Rebuilt);
+	TestEqual(TEXT("Lookup after a rebuild is a miss"), Cache.GetMisses(), Misses + 1);
+	TestEqual(TEXT("Rebuilt size is measured again"), Rebuilt.GetSize().X, 200.0, 0.001);
+
+	FVector Rotated;
+	Cache.TryGetSize(Mesh, FRotator(0.0f, 90.0f, 0.0f), 2.0f, Rotated);
+	TestEqual(TEXT("Rotated / scaled size X"), Rotated.X, 200.0, 0.1);
+	TestEqual(TEXT("Rotated / scaled size Y"), Rotated.Y, 400.0, 0.1);
+
+	const int32 Invalidations = Cache.GetInvalidations();
+	const int32 Count = Cache.Num();
+	Cache.Invalidate(Mesh);
+	TestEqual(TEXT("Invalidation is counted"), Cache.GetInvalidations(), Invalidations + 1);
+	TestEqual(TEXT("Invalidated mesh is dropped"), Cache.Num(), Count - 1);
+
+	Mesh->MarkAsGarbage();
+	Cache.Flush();
+	return true;
+}
+
+#endif
@@ -0,0 +1,89 @@
+#include "Misc/AutomationTest.h"
+#include "AssetGridVisualizer.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Checks that the incremental layout only touches what changed on a 2000 entry grid: an edit repacks its own row
+// and reuses every actor it can. SpawnBudgetMs is 0, so every actor is spawned inside the layout pass.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.AssetVisualizer; Quit" -nullrhi -unattended
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAssetGridLayoutIncrementalTest, "LVN.AssetVisualizer.Layout.Incremental", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FAssetGridLayoutIncrementalTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 EntryCount = 2000;
+	constexpr int32 EntriesPerRow = 50;
+
+	UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Engine cube"), Cube))
+		return false;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+	Context.SetCurrentWorld(World);
+
+	AAssetGridVisualizer* Visualizer = World->SpawnActor<AAssetGridVisualizer>();
+	Visualizer->SpawnBudgetMs = 0.0f;
+
+	FAssetGrid& Grid = Visualizer->Grids.AddDefaulted_GetRef();
+	FVisualAssetData Entry;
+	Entry.PrefabReference = Cube;
+	for (int32 i = 0; i < EntryCount; ++i)
+	{
+		if (i % EntriesPerRow == 0)
+		{
+			Grid.Rows.AddDefaulted();
+		}
+		Grid.Rows.Last().Assets.Add(Entry);
+	}
+
+	const int32 MiddleRow = Grid.Rows.Num() / 2;
+	auto Assets = [Visualizer, MiddleRow]() -> TArray<FVisualAssetData>& { return Visualizer->Grids[0].Rows[MiddleRow].Assets; };
+
+	Visualizer->RefreshLayout();
+	FAssetGridLayoutStats Stats = Visualizer->LastLayoutStats;
+	TestEqual(TEXT("First layout: entries"), Stats.Entries, EntryCount);
+	TestEqual(TEXT("First layout: spawned"), Stats.Spawned, EntryCount);
+	TestEqual(TEXT("First layout: rows repacked"), Stats.RowsRepacked, EntryCount / EntriesPerRow);
+
+	Visualizer->RefreshLayout();
+	Stats = Visualizer->LastLayoutStats;
+	TestEqual(TEXT("No change: actors touched"), Stats.Spawned + Stats.Destroyed + Stats.Updated + Stats.Moved, 0);
+	TestEqual(TEXT("No change: rows touched"), Stats.RowsRepacked + Stats.RowsShifted, 0);
+
+	Assets()[0].PositionOffset = FVector(0.0f, 0.0f, 50.0f);
+	Visualizer->RefreshLayout();
+	Stats = Visualizer->LastLayoutStats;
+	TestEqual(TEXT("Offset one entry: rows repacked"), Stats.RowsRepacked, 1);
+	TestEqual(TEXT("Offset one entry: spawned"), Stats.Spawned, 0);
+	TestEqual(TEXT("Offset one entry: destroyed"), Stats.Destroyed, 0);
+	TestEqual(TEXT("Offset one entry: updated"), Stats.Updated, 1);
+	TestEqual(TEXT("Offset one entry: reused"), Stats.Reused, EntriesPerRow - 1);
+	TestEqual(TEXT("Offset one entry: rows shifted"), Stats.RowsShifted, 0);
+
+	Assets().Insert(Entry, 0);
+	Visualizer->RefreshLayout();
+	Stats = Visualizer->LastLayoutStats;
+	TestEqual(TEXT("Insert one entry: rows repacked"), Stats.RowsRepacked, 1);
+	TestEqual(TEXT("Insert one entry: spawned"), Stats.Spawned, 1);
+	TestEqual(TEXT("Insert one entry: destroyed"), Stats.Destroyed, 0);
+
+	Assets().RemoveAt(0);
+	Visualizer->RefreshLayout();
+	Stats = Visualizer->LastLayoutStats;
+	TestEqual(TEXT("Remove one entry: rows repacked"), Stats.RowsRepacked, 1);
+	TestEqual(TEXT("Remove one entry: spawned"), Stats.Spawned, 0);
+	TestEqual(TEXT("Remove one entry: destroyed"), Stats.Destroyed, 1);
+	TestEqual(TEXT("Remove one entry: actors"), Visualizer->Grids[0].InstantiatedAssets.Num(), EntryCount);
+
+	Visualizer->ForceRebuildLayout();
+	TestEqual(TEXT("Full rebuild: spawned"), Visualizer->LastLayoutStats.Spawned, EntryCount);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif
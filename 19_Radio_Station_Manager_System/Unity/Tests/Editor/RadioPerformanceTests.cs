@@ -0,0 +1,99 @@
+using System.Collections;
+using System.Diagnostics;
+using System.IO;
+using NUnit.Framework;
+using Unity.PerformanceTesting;
+using UnityEditor;
+using UnityEngine;
+using UnityEngine.TestTools;
+
+// Times loading a generated 10 s, 44.1 kHz stereo WAV into a station through LoadMusicFromFolder, the same
+// UnityWebRequestMultimedia load the Custom station uses, in Play mode. Compared with PerfBaselines/Radio.json.
+public class RadioPerformanceTests
+{
+    private const string MusicFolder = "PerfTestRadioMusic";
+    private const int Loads = 20;
+
+    private string folderPath;
+
+    [UnityTearDown]
+    public IEnumerator TearDown()
+    {
+        if (folderPath != null && Directory.Exists(folderPath))
+            Directory.Delete(folderPath, true);
+        if (Application.isPlaying)
+            yield return new ExitPlayMode();
+    }
+
+    [UnityTest, Performance]
+    public IEnumerator LoadWav_10s()
+    {
+        yield return new EnterPlayMode();
+
+        // A folder of its own, so the player's custom music is neither loaded nor touched
+        folderPath = Path.Combine(Application.persistentDataPath, MusicFolder);
+        Directory.CreateDirectory(folderPath);
+        File.WriteAllBytes(Path.Combine(folderPath, "PerfTest.wav"), CreateTestWav(10f, 44100, 2));
+
+        // Inactive until the folder is set, the manager reads it in Awake
+        var go = new GameObject("GameRadioManager");
+        go.SetActive(false);
+        var manager = go.AddComponent<GameRadioManager>();
+        var settings = new SerializedObject(manager);
+        settings.FindProperty("musicFolderName").stringValue = MusicFolder;
+        settings.ApplyModifiedPropertiesWithoutUndo();
+        go.SetActive(true);
+
+        // Each load clears the station first, so one track is left after every sample
+        var station = new GameRadioManager.Station { stationName = "PerfTest" };
+        var group = new SampleGroup("LoadWav_10s", SampleUnit.Millisecond);
+        for (int i = -1; i < Loads; i++) // One warmup load
+        {
+            bool done = false;
+            var stopwatch = Stopwatch.StartNew();
+            manager.LoadMusicFromFolder(station, () => done = true);
+            yield return new WaitUntil(() => done);
+            stopwatch.Stop();
+
+            Assert.AreEqual(1, station.tracks.Count, "The WAV didn't load");
+            Object.Destroy(station.tracks[0]);
+            if (i >= 0)
+                Measure.Custom(group, stopwatch.Elapsed.TotalMilliseconds);
+        }
+
+        PerfBaseline.AssertWithin("Radio");
+    }
+
+    // 16-bit PCM sine tone, the format the Custom station expects from players' files
+    private static byte[] CreateTestWav(float seconds, int sampleRate, int channels)
+    {
+        int frames = Mathf.RoundToInt(seconds * sampleRate);
+        int dataSize = frames * channels * 2;
+
+        using (var stream = new MemoryStream(44 + dataSize))
+        using (var writer = new BinaryWriter(stream))
+        {
+            writer.Write(System.Text.Encoding.ASCII.GetBytes("RIFF"));
+            writer.Write(36 + dataSize);
+            writer.Write(System.Text.Encoding.ASCII.GetBytes("WAVEfmt "));
+            writer.Write(16);
+            writer.Write((short)1); // PCM
+            writer.Write((short)channels);
+            writer.Write(sampleRate);
+            writer.Write(sampleRate * channels * 2);
+            writer.Write((short)(channels * 2));
+            writer.Write((short)16);
+            writer.Write(System.Text.Encoding.ASCII.GetBytes("data"));
+            writer.Write(dataSize);
+
+            for (int i = 0; i < frames; i++)
+            {
+                short sample = (short)(Mathf.Sin(2f * Mathf.PI * 440f * i / sampleRate) * short.MaxValue * 0.25f);
+                for (int c = 0; c < channels; c++)
+                    writer.Write(sample);
+            }
+
+            return stream.ToArray();
+        }
+    }
+}
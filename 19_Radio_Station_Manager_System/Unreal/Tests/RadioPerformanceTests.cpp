@@ -0,0 +1,67 @@
+#include "Misc/AutomationTest.h"
+#include "PerfTesting.h"
+#include "RadioStationManager.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Times decoding a generated 10 s, 44.1 kHz stereo WAV into the custom station through LoadCustomMusicFromFolder, in a
+// temporary world. Compared with PerfBaselines/Radio.json.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Radio.Performance; Quit" -nullrhi -unattended
+
+namespace RadioPerformanceTests
+{
+	// 16-bit PCM sine tone, the only format DecodeWAVFile accepts
+	TArray<uint8> CreateTestWAV(float Seconds, int32 SampleRate, int32 NumChannels)
+	{
+		const int32  Frames   = FMath::RoundToInt(Seconds * SampleRate);
+		const uint32 DataSize = Frames * NumChannels * 2;
+
+		TArray<uint8> WAVData;
+		WAVData.Reserve(44 + DataSize);
+		auto Write   = [&WAVData](const void* Bytes, int32 Count) { WAVData.Append(static_cast<const uint8*>(Bytes), Count); };
+		auto Write16 = [&Write](uint16 Value) { Write(&Value, 2); };
+		auto Write32 = [&Write](uint32 Value) { Write(&Value, 4); };
+
+		Write("RIFF", 4); Write32(36 + DataSize); Write("WAVEfmt ", 8);
+		Write32(16); Write16(1); Write16(NumChannels); Write32(SampleRate);
+		Write32(SampleRate * NumChannels * 2); Write16(NumChannels * 2); Write16(16);
+		Write("data", 4); Write32(DataSize);
+		for (int32 i = 0; i < Frames; ++i)
+		{
+			const int16 Sample = static_cast<int16>(FMath::Sin(2.f * PI * 440.f * i / SampleRate) * MAX_int16 * 0.25f);
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+				Write16(static_cast<uint16>(Sample));
+		}
+		return WAVData;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRadioPerformanceDecodeTest, "LVN.Radio.Performance.DecodeWav", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FRadioPerformanceDecodeTest::RunTest(const FString& Parameters)
+{
+	using namespace RadioPerformanceTests;
+
+	const FString Folder = FPaths::AutomationTransientDir() / TEXT("RadioPerformance");
+	if (!TestTrue(TEXT("Test WAV written"), FFileHelper::SaveArrayToFile(CreateTestWAV(10.f, 44100, 2), *(Folder / TEXT("PerfTest.wav")))))
+		return false;
+
+	FPerfTestWorld World;
+	URadioStationManager* Manager = World.Get()->GetSubsystem<URadioStationManager>();
+	if (!TestNotNull(TEXT("RadioStationManager"), Manager))
+		return false;
+
+	// Creating the station loads the player's folder once, unmeasured. Each load then empties it first, so it holds one track after every sample
+	Manager->CreateCustomStation();
+	FPerfRecorder Recorder;
+	Recorder.Measure(TEXT("DecodeWav_10s"), 20, [Manager, &Folder](int32) { Manager->LoadCustomMusicFromFolder(Folder); }, 1);
+	TestEqual(TEXT("Custom station tracks"), Manager->GetStation(Manager->GetStationCount() - 1).Tracks.Num(), 1);
+
+	IFileManager::Get().DeleteDirectory(*Folder, false, true);
+	return Recorder.CheckBaseline(*this, TEXT("Radio"), __FILE__);
+}
+
+#endif
@@ -10,7 +10,7 @@ using UnityEngine;
     This is achieved by auto-loading all PlaceableItemSO assets from Resources/PlaceableItems/ at Start and caching them in the knownItems list. 
     If you add new PlaceableItemSO assets, make sure they are in that folder or added to the knownItems list manually in the Inspector.
 */
-public class ObjectPlacementManager : MonoBehaviour
+public class ObjectPlacementManager : MonoBehaviour, IPlacementJournalTarget
 {
     private enum PlacementMode { None, Placing, Editing, Removing }
     private enum EditPhase { SelectingObject, RepositioningObject }
@@ -26,6 +26,29 @@ public class ObjectPlacementManager : MonoBehaviour
     [Tooltip("Dedicated layer for placed objects only. Manager assigns objects to this layer after placing.")]
     [SerializeField] private LayerMask placedObjectLayerMask;
 
+    [Header("Overlap Index")]
+    [Tooltip("Cell size of the placed objects spatial grid. Around the size of a typical placeable works best.")]
+    [SerializeField] private float spatialCellSize = 2f;
+    [Tooltip("Confirms index hits with Physics.OverlapBox against the candidates' real colliders. Only runs when the index reports candidates.")]
+    [SerializeField] private bool exactOverlapCheck = true;
+
+    [Header("Snapping")]
+    [Tooltip("Socket, grid (per item) and alignment guide snapping of the preview.")]
+    [SerializeField] private bool snappingEnabled = true;
+    [Tooltip("Max distance between two compatible sockets for them to connect.")]
+    [SerializeField] private float socketSnapRadius = 0.35f;
+    [Tooltip("Bounds edges / centers closer than this to a nearby object's snap into alignment.")]
+    [SerializeField] private float guideTolerance = 0.1f;
+    [Tooltip("How far around the preview neighbours are considered for alignment guides.")]
+    [SerializeField] private float guideRadius = 2f;
+    [SerializeField] private bool drawAlignmentGuides = true;
+
+    [Header("Undo / Redo")]
+    [Tooltip("Memory budget of the undo history. The oldest steps are dropped past it. 0 = no cap.")]
+    [SerializeField] private int undoMemoryBudgetKB = 256;
+    [Tooltip("Moves of the same object closer together than this (seconds) undo as a single step.")]
+    [SerializeField] private float nudgeMergeWindow = 1f;
+
     [Header("Hover Materials")]
     [SerializeField] private Material hoverValidMaterial;
     [SerializeField] private Material hoverEditMaterial;
@@ -41,12 +64,37 @@ public class ObjectPlacementManager : MonoBehaviour
 
     private GameObject _previewInstance;
     private Renderer[] _previewRenderers;
+    private Bounds _previewLocalBounds;
+    private PlacementSocketData[] _previewSockets;
     private float _rotationOffset;
 
     private PlacedObject _targetedObject;
     private readonly List<PlacedObject> _placedObjects = new();
+    private readonly Dictionary<string, PlacedObject> _placedById = new();
     private Material _lastAppliedMaterial;
 
+    private PlacementSpatialIndex _spatialIndex;
+    private readonly List<int> _overlapCandidates = new();
+    private readonly Collider[] _overlapBuffer = new Collider[32];
+
+    private PlacementSnapSolver _snapSolver;
+    private readonly List<PlacementGuide> _guides = new();
+
+    private PlacementSpatialIndex SpatialIndex => _spatialIndex ??= new PlacementSpatialIndex(spatialCellSize);
+    private PlacementSnapSolver SnapSolver => _snapSolver ??= new PlacementSnapSolver(SpatialIndex);
+
+    private PlacementJournal _journal;
+
+    // Undo / redo history of placing, editing and removing, plus the recovery log SaveManager persists
+    public PlacementJournal Journal => _journal ??= new PlacementJournal(this)
+    {
+        MaxMemoryBytes = undoMemoryBudgetKB * 1024L,
+        MergeWindow = nudgeMergeWindow
+    };
+
+    // The object being repositioned must not block or snap to its own old pose
+    private int IgnoredHandle => _currentMode == PlacementMode.Editing && _targetedObject != null ? _targetedObject.SpatialHandle : -1;
+
     private void Start()
     {
         if (fpController != null)
@@ -128,11 +176,10 @@ public class ObjectPlacementManager : MonoBehaviour
     {
         for (int i = _placedObjects.Count - 1; i >= 0; i--)
         {
-            if (_placedObjects[i] == null || _placedObjects[i].MarkedForRemoval)
-            {
-                if (_placedObjects[i] != null) Destroy(_placedObjects[i].gameObject);
+            if (_placedObjects[i] == null)
                 _placedObjects.RemoveAt(i);
-            }
+            else if (_placedObjects[i].MarkedForRemoval)
+                DestroyPlacedObject(_placedObjects[i]);
         }
 
         Debug.Log($"[ObjectPlacer] Prepared for save — {_placedObjects.Count} active placed objects.");
@@ -141,6 +188,9 @@ public class ObjectPlacementManager : MonoBehaviour
     // Loads placed objects from the save file. Called by SaveManager.LoadGameSave() after the standard scene sweep.
     public void LoadPlacedObjects()
     {
+        // History from before the load no longer matches the scene
+        Journal.Clear();
+
         SaveManager saveManager = FindFirstObjectByType<SaveManager>();
         if (saveManager == null)
         {
@@ -154,10 +204,13 @@ public class ObjectPlacementManager : MonoBehaviour
         string json = System.IO.File.ReadAllText(path);
         JsonWrapper wrapper = JsonUtility.FromJson<JsonWrapper>(json);
         if (wrapper == null || wrapper.entries == null) return;
+        SaveSchemas.MigrateAll(wrapper);
 
         int loaded = 0;
         foreach (SaveEntry entry in wrapper.entries)
         {
+            if (SaveSchemas.ResolveType(entry.type) != typeof(PlacedObjectSaveData)) continue;
+
             PlacedObjectSaveData data = JsonUtility.FromJson<PlacedObjectSaveData>(entry.jsonData);
             if (data == null || string.IsNullOrEmpty(data.prefabID)) continue;
 
@@ -188,6 +241,10 @@ public class ObjectPlacementManager : MonoBehaviour
                 Destroy(_placedObjects[i].gameObject);
         }
         _placedObjects.Clear();
+        _placedById.Clear();
+        SpatialIndex.Clear();
+        SnapSolver.Clear();
+        Journal.Clear();
 
         Debug.Log("[ObjectPlacer] All placed objects cleared from scene.");
     }
@@ -220,7 +277,9 @@ public class ObjectPlacementManager : MonoBehaviour
             _previewInstance.transform.position,
             _previewInstance.transform.rotation);
 
-        RegisterPlacedObject(placed, _selectedItem, null);
+        PlacedObject po = RegisterPlacedObject(placed, _selectedItem, null);
+        Journal.Record(PlacementCommand.Place(GetID(po), _selectedItem.prefabID, placed.transform.position, placed.transform.rotation, placed.transform.localScale),
+                       Time.unscaledTimeAsDouble, $"Place {_selectedItem.displayName}");
         Debug.Log($"[ObjectPlacer] Placed: {_selectedItem.displayName}");
 
         _rotationOffset = 0f;
@@ -307,6 +366,12 @@ public class ObjectPlacementManager : MonoBehaviour
         _targetedObject.transform.SetPositionAndRotation(
             _previewInstance.transform.position,
             _previewInstance.transform.rotation);
+        UpdateIndexedBox(_targetedObject);
+
+        Transform t = _targetedObject.transform;
+        Pose before = _targetedObject.Snapshot;
+        Journal.Record(PlacementCommand.Move(GetID(_targetedObject), _targetedObject.Definition.prefabID, before.position, before.rotation, t.position, t.rotation, t.localScale),
+                       Time.unscaledTimeAsDouble, $"Move {_targetedObject.Definition.displayName}");
 
         DestroyPreview();
         _rotationOffset = 0f;
@@ -350,12 +415,123 @@ public class ObjectPlacementManager : MonoBehaviour
     private void StageForRemoval(PlacedObject obj)
     {
         _targetedObject = null;
-        obj.MarkForRemoval(true);
-        obj.gameObject.SetActive(false);
+        obj.RestoreMaterials();
+        HideForRemoval(obj);
+
+        Transform t = obj.transform;
+        Journal.Record(PlacementCommand.Remove(GetID(obj), obj.Definition != null ? obj.Definition.prefabID : string.Empty, t.position, t.rotation, t.localScale),
+                       Time.unscaledTimeAsDouble, "Remove");
+
         string name = obj.Definition != null ? obj.Definition.displayName : obj.gameObject.name;
         Debug.Log($"[ObjectPlacer] Staged for removal: {name}. Press Save to commit.");
     }
 
+    // Stages every placed object for removal as a single undo step.
+    public void StageAllForRemoval()
+    {
+        ExitCurrentMode();
+
+        Journal.BeginBatch("Remove All", Time.unscaledTimeAsDouble);
+        foreach (PlacedObject po in _placedObjects.ToArray())
+        {
+            if (po == null || po.MarkedForRemoval) continue;
+            StageForRemoval(po);
+        }
+        Journal.EndBatch();
+    }
+
+    public void Undo()
+    {
+        string label = Journal.UndoLabel;
+        PrepareForJournalStep();
+        if (Journal.Undo()) Debug.Log($"[ObjectPlacer] Undo: {label}");
+    }
+
+    public void Redo()
+    {
+        string label = Journal.RedoLabel;
+        PrepareForJournalStep();
+        if (Journal.Redo()) Debug.Log($"[ObjectPlacer] Redo: {label}");
+    }
+
+    // An object mid-reposition or highlighted would fight the journal over its transform and materials
+    private void PrepareForJournalStep()
+    {
+        if (_currentMode == PlacementMode.Editing && _editPhase == EditPhase.RepositioningObject)
+            CancelEdit();
+        ClearTargetedObject();
+    }
+
+    // Applies one undo / redo / recovery command. Objects are looked up by GUID; the ones that no longer
+    // exist (a committed removal being undone, a replay on top of a save) are respawned from their prefabID.
+    void IPlacementJournalTarget.Apply(in PlacementCommand command)
+    {
+        _placedById.TryGetValue(command.id ?? string.Empty, out PlacedObject po);
+
+        switch (command.type)
+        {
+            case PlacementCommandType.Place:
+            case PlacementCommandType.Restore:
+                if (po == null)
+                {
+                    SpawnFromCommand(command);
+                }
+                else if (po.MarkedForRemoval)
+                {
+                    po.MarkForRemoval(false);
+                    po.gameObject.SetActive(true);
+                    AddToIndex(po);
+                }
+                break;
+
+            case PlacementCommandType.Delete:
+                if (po != null) DestroyPlacedObject(po);
+                break;
+
+            case PlacementCommandType.Transform:
+                if (po == null) break;
+                po.transform.SetPositionAndRotation(command.toPosition, command.toRotation);
+                UpdateIndexedBox(po);
+                break;
+
+            case PlacementCommandType.Remove:
+                if (po != null && !po.MarkedForRemoval) HideForRemoval(po);
+                break;
+        }
+    }
+
+    private void SpawnFromCommand(in PlacementCommand command)
+    {
+        PlaceableItemSO definition = FindDefinitionByPrefabID(command.prefabID);
+        if (definition == null)
+        {
+            Debug.LogWarning($"[ObjectPlacer] No PlaceableItemSO found for prefabID '{command.prefabID}'. Journal command skipped.");
+            return;
+        }
+
+        GameObject go = Instantiate(definition.prefab, command.toPosition, command.toRotation);
+        go.transform.localScale = command.scale;
+        RegisterPlacedObject(go, definition, command.id);
+    }
+
+    private void HideForRemoval(PlacedObject obj)
+    {
+        obj.MarkForRemoval(true);
+        obj.gameObject.SetActive(false);
+        RemoveFromIndex(obj);
+    }
+
+    private void DestroyPlacedObject(PlacedObject po)
+    {
+        if (po == _targetedObject) _targetedObject = null;
+        RemoveFromIndex(po);
+        _placedObjects.Remove(po);
+        _placedById.Remove(GetID(po));
+        Destroy(po.gameObject);
+    }
+
+    private static string GetID(PlacedObject po) => po.GetComponent<GUIDComponent>().ID;
+
     private bool EvaluatePlacement(PlaceableItemSO definition, out RaycastHit hit, out PlacementSurfaceType surfaceType)
     {
         surfaceType = PlacementSurfaceType.Floor;
@@ -379,27 +555,47 @@ public class ObjectPlacementManager : MonoBehaviour
     }
 
     // Checks if the preview object is overlapping any existing placed objects, which would block placement.
+    // The spatial index answers first; physics only runs to confirm when the index found candidates.
+    // Boxes of physics driven objects follow them through PlacedObject.Moved, so no candidates means no overlap.
     private bool IsPreviewOverlapping(RaycastHit surfaceHit)
     {
         if (_previewInstance == null) return false;
 
-        Renderer[] renderers = _previewInstance.GetComponentsInChildren<Renderer>();
-        if (renderers.Length == 0) return false;
+        // Shrink the box slightly to avoid the resting surface and touching neighbours counting as an overlap.
+        PlacementBox box = PlacementBox.FromLocalBounds(_previewLocalBounds, _previewInstance.transform, 0.95f);
+        if (SpatialIndex.Query(box, _overlapCandidates, IgnoredHandle) == 0) return false;
 
-        Bounds bounds = renderers[0].bounds;
-        for (int i = 1; i < renderers.Length; i++)
-            bounds.Encapsulate(renderers[i].bounds);
+        for (int i = _overlapCandidates.Count - 1; i >= 0; i--)
+        {
+            // Objects destroyed behind the manager's back are dropped lazily
+            int handle = _overlapCandidates[i];
+            if (SpatialIndex.GetOwner(handle) != null) continue;
+
+            SnapSolver.RemoveSockets(handle);
+            SpatialIndex.Remove(handle);
+            _overlapCandidates[i] = _overlapCandidates[_overlapCandidates.Count - 1];
+            _overlapCandidates.RemoveAt(_overlapCandidates.Count - 1);
+        }
 
-        int mask = placedObjectLayerMask;
+        if (_overlapCandidates.Count == 0 || !exactOverlapCheck) return _overlapCandidates.Count > 0;
 
-        Collider[] hits = Physics.OverlapBox(
-            bounds.center,
-            bounds.extents * 0.95f, // Shrink the box slightly to avoid the resting surface counting as an overlap.
-            _previewInstance.transform.rotation,
-            mask,
+        int hits = Physics.OverlapBoxNonAlloc(
+            box.center,
+            box.extents,
+            _overlapBuffer,
+            box.rotation,
+            placedObjectLayerMask,
             QueryTriggerInteraction.Ignore);
 
-        return hits.Length > 0;
+        // Only the candidates' colliders count: the object being edited, or anything else on the layer, doesn't block
+        for (int i = 0; i < hits; i++)
+        {
+            PlacedObject owner = _overlapBuffer[i].GetComponentInParent<PlacedObject>();
+            if (owner != null && _overlapCandidates.Contains(owner.SpatialHandle))
+                return true;
+        }
+
+        return false;
     }
 
     private void SpawnPreview(GameObject prefab)
@@ -408,6 +604,10 @@ public class ObjectPlacementManager : MonoBehaviour
         _previewInstance = Instantiate(prefab);
         _lastAppliedMaterial = null;
 
+        // Measured once per preview, before colliders are disabled (they're the fallback without renderers)
+        _previewLocalBounds = PlacementSpatialIndex.MeasureLocalBounds(_previewInstance);
+        _previewSockets = PlacementSocket.Collect(_previewInstance);
+
         // Disable colliders so the preview doesn't block its own placement raycasts
         foreach (Collider col in _previewInstance.GetComponentsInChildren<Collider>())
             col.enabled = false;
@@ -422,6 +622,8 @@ public class ObjectPlacementManager : MonoBehaviour
         Destroy(_previewInstance);
         _previewInstance = null;
         _previewRenderers = null;
+        _previewSockets = null;
+        _guides.Clear();
         _lastAppliedMaterial = null;
     }
 
@@ -452,8 +654,11 @@ public class ObjectPlacementManager : MonoBehaviour
         // ── Position ──────────────────────────────────────────────────────
         if (hasHit)
         {
-            float offset = GetExtentAlongNormal(_previewInstance, hit.normal);
+            float offset = GetExtentAlongNormal(hit.normal);
             _previewInstance.transform.position = hit.point + hit.normal * offset;
+
+            if (snappingEnabled)
+                ApplySnapping(hit, definition);
         }
         else
         {
@@ -462,23 +667,46 @@ public class ObjectPlacementManager : MonoBehaviour
         }
     }
 
-    // Calculates the distance from the object's pivot to its outer edge along the given normal direction.
-    private static float GetExtentAlongNormal(GameObject go, Vector3 normal)
+    // Runs the snap solver on the surface aligned preview pose: sockets first, then the item's grid, then alignment guides.
+    private void ApplySnapping(RaycastHit hit, PlaceableItemSO definition)
     {
-        Renderer[] renderers = go.GetComponentsInChildren<Renderer>();
-        if (renderers.Length == 0) return 0f;
+        Transform t = _previewInstance.transform;
+
+        PlacementSnapSolver solver = SnapSolver;
+        solver.socketRadius = socketSnapRadius;
+        solver.guideTolerance = guideTolerance;
+        solver.guideRadius = guideRadius;
 
-        Bounds combined = renderers[0].bounds;
-        for (int i = 1; i < renderers.Length; i++)
-            combined.Encapsulate(renderers[i].bounds);
+        var request = new PlacementSnapRequest
+        {
+            position = t.position,
+            rotation = t.rotation,
+            scale = t.lossyScale,
+            surfaceNormal = hit.normal,
+            localBounds = _previewLocalBounds,
+            sockets = _previewSockets,
+            gridMode = definition.gridMode,
+            gridCellSize = definition.gridCellSize,
+            gridOrigin = hit.transform != null ? new Pose(hit.transform.position, hit.transform.rotation) : Pose.identity,
+            ignoreHandle = IgnoredHandle
+        };
+
+        PlacementSnapResult snap = solver.Solve(request, _guides);
+        t.SetPositionAndRotation(snap.position, snap.rotation);
 
-        Vector3 absNormal = new Vector3(
-            Mathf.Abs(normal.x),
-            Mathf.Abs(normal.y),
-            Mathf.Abs(normal.z));
+        if (!drawAlignmentGuides) return;
+        foreach (PlacementGuide guide in _guides)
+            Debug.DrawLine(guide.from, guide.to, Color.cyan);
+    }
+
+    // Calculates the distance from the preview's pivot to its outer edge along the given normal direction.
+    private float GetExtentAlongNormal(Vector3 normal)
+    {
+        Transform t = _previewInstance.transform;
+        PlacementBox box = PlacementBox.FromLocalBounds(_previewLocalBounds, t);
 
-        float halfExtent = Vector3.Dot(combined.extents, absNormal);
-        float pivotOffset = Vector3.Dot(combined.center - go.transform.position, -normal);
+        float halfExtent = box.ExtentAlong(normal);
+        float pivotOffset = Vector3.Dot(box.center - t.position, -normal);
 
         return halfExtent + pivotOffset;
     }
@@ -509,7 +737,7 @@ public class ObjectPlacementManager : MonoBehaviour
         return null;
     }
 
-    private void RegisterPlacedObject(GameObject go, PlaceableItemSO definition, string existingGUID)
+    private PlacedObject RegisterPlacedObject(GameObject go, PlaceableItemSO definition, string existingGUID)
     {
         PlacedObject po = go.GetComponent<PlacedObject>();
         if (po == null) po = go.AddComponent<PlacedObject>();
@@ -518,11 +746,41 @@ public class ObjectPlacementManager : MonoBehaviour
         GUIDComponent guid = go.GetComponent<GUIDComponent>();
         if (guid == null) guid = go.AddComponent<GUIDComponent>();
 
-        if (!string.IsNullOrEmpty(existingGUID))
-            ForceGUID(guid, existingGUID);
+        // New placements get their own identity; the prefab's serialized id would be shared by every copy
+        string id = string.IsNullOrEmpty(existingGUID) ? System.Guid.NewGuid().ToString() : existingGUID;
+        ForceGUID(guid, id);
 
         SetLayerRecursive(go, LayerMaskToIndex(placedObjectLayerMask));
         _placedObjects.Add(po);
+        _placedById[id] = po;
+
+        AddToIndex(po);
+        return po;
+    }
+
+    private void AddToIndex(PlacedObject po)
+    {
+        if (po.SpatialHandle >= 0) return;
+        po.SpatialHandle = SpatialIndex.Add(PlacementBox.FromLocalBounds(po.LocalBounds, po.transform), po);
+        SnapSolver.SetSockets(po.SpatialHandle, po.Sockets, po.transform.localToWorldMatrix);
+        po.Moved -= UpdateIndexedBox;
+        po.Moved += UpdateIndexedBox;
+    }
+
+    private void UpdateIndexedBox(PlacedObject po)
+    {
+        if (po == null || po.SpatialHandle < 0) return;
+        SpatialIndex.Move(po.SpatialHandle, PlacementBox.FromLocalBounds(po.LocalBounds, po.transform));
+        SnapSolver.SetSockets(po.SpatialHandle, po.Sockets, po.transform.localToWorldMatrix);
+    }
+
+    private void RemoveFromIndex(PlacedObject po)
+    {
+        if (po.SpatialHandle < 0) return;
+        SnapSolver.RemoveSockets(po.SpatialHandle);
+        SpatialIndex.Remove(po.SpatialHandle);
+        po.SpatialHandle = -1;
+        po.Moved -= UpdateIndexedBox;
     }
 
     private void ApplyMaterialToObject(PlacedObject obj, Material mat)
@@ -21,11 +21,44 @@ public class PlacedObject : MonoBehaviour, ISaveable
 
     public bool MarkedForRemoval { get; private set; }
 
+    // Combined bounds in local space, measured once at Initialize for the spatial index
+    public Bounds LocalBounds { get; private set; }
+
+    // Snap sockets in local space, collected once at Initialize
+    public PlacementSocketData[] Sockets { get; private set; } = System.Array.Empty<PlacementSocketData>();
+
+    // Handle in the manager's PlacementSpatialIndex, -1 while not indexed
+    public int SpatialHandle { get; set; } = -1;
+
+    // Raised when the transform is changed outside the manager (snapshot revert, save restore, physics)
+    public event System.Action<PlacedObject> Moved;
+
+    private Rigidbody _body;
+    private Vector3 _reportedPosition;
+    private Quaternion _reportedRotation;
+
     // Called by ObjectPlacementManager immediately after instantiating a new placed object.
     public void Initialize(PlaceableItemSO definition)
     {
         Definition = definition;
         CacheMaterials();
+        LocalBounds = PlacementSpatialIndex.MeasureLocalBounds(gameObject);
+        Sockets = PlacementSocket.Collect(gameObject);
+        _body = GetComponent<Rigidbody>();
+        _reportedPosition = transform.position;
+        _reportedRotation = transform.rotation;
+    }
+
+    // Non-kinematic bodies (restored from a save, knocked over) move on their own; report it so the
+    // manager's spatial index doesn't keep a stale box for them
+    private void FixedUpdate()
+    {
+        if (_body == null || _body.isKinematic) return;
+        if (transform.position == _reportedPosition && transform.rotation == _reportedRotation) return;
+
+        _reportedPosition = transform.position;
+        _reportedRotation = transform.rotation;
+        Moved?.Invoke(this);
     }
 
     private void CacheMaterials()
@@ -51,10 +84,14 @@ public class PlacedObject : MonoBehaviour, ISaveable
         _snapshotRotation = transform.rotation;
     }
 
+    // Pose captured by SnapshotForEdit, the "before" of an edit in the undo journal
+    public Pose Snapshot => new Pose(_snapshotPosition, _snapshotRotation);
+
     public void RevertToSnapshot()
     {
         transform.position = _snapshotPosition;
         transform.rotation = _snapshotRotation;
+        Moved?.Invoke(this);
     }
 
     public void MarkForRemoval(bool value) => MarkedForRemoval = value;
@@ -90,6 +127,7 @@ public class PlacedObject : MonoBehaviour, ISaveable
             transform.position = data.position;
             transform.rotation = data.rotation;
             transform.localScale = data.scale;
+            Moved?.Invoke(this);
             yield return null;
             rb.isKinematic = false;
         }
@@ -98,6 +136,7 @@ public class PlacedObject : MonoBehaviour, ISaveable
             transform.position = data.position;
             transform.rotation = data.rotation;
             transform.localScale = data.scale;
+            Moved?.Invoke(this);
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,8 @@
+// Grid snapping mode of a placeable item. Used by PlaceableItemSO and solved by PlacementSnapSolver.
+// World snaps to a grid anchored at the world origin, Local to a grid aligned with the surface object that was hit.
+public enum PlacementGridMode
+{
+    None,
+    World,
+    Local
+}
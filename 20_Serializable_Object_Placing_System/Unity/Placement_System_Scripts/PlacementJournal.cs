@@ -0,0 +1,312 @@
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+
+public enum PlacementCommandType { Place, Delete, Transform, Remove, Restore }
+
+// One reversible placement operation. Commands carry absolute poses, so applying one never depends on
+// what happened before it, which is what makes replaying them on top of a save safe.
+[Serializable]
+public struct PlacementCommand
+{
+    public PlacementCommandType type;
+    public string id;        // GUIDComponent.ID of the placed object
+    public string prefabID;  // To respawn it when undoing a committed removal or replaying
+    public Vector3 fromPosition;
+    public Quaternion fromRotation;
+    public Vector3 toPosition;
+    public Quaternion toRotation;
+    public Vector3 scale;
+
+    public static PlacementCommand Place(string id, string prefabID, Vector3 position, Quaternion rotation, Vector3 scale) =>
+        Create(PlacementCommandType.Place, id, prefabID, position, rotation, position, rotation, scale);
+
+    public static PlacementCommand Move(string id, string prefabID, Vector3 fromPosition, Quaternion fromRotation, Vector3 toPosition, Quaternion toRotation, Vector3 scale) =>
+        Create(PlacementCommandType.Transform, id, prefabID, fromPosition, fromRotation, toPosition, toRotation, scale);
+
+    public static PlacementCommand Remove(string id, string prefabID, Vector3 position, Quaternion rotation, Vector3 scale) =>
+        Create(PlacementCommandType.Remove, id, prefabID, position, rotation, position, rotation, scale);
+
+    private static PlacementCommand Create(PlacementCommandType type, string id, string prefabID, Vector3 fromPosition, Quaternion fromRotation, Vector3 toPosition, Quaternion toRotation, Vector3 scale)
+    {
+        return new PlacementCommand
+        {
+            type = type, id = id, prefabID = prefabID,
+            fromPosition = fromPosition, fromRotation = fromRotation,
+            toPosition = toPosition, toRotation = toRotation, scale = scale
+        };
+    }
+
+    public PlacementCommand Inverse()
+    {
+        PlacementCommand inverse = this;
+        inverse.fromPosition = toPosition;
+        inverse.fromRotation = toRotation;
+        inverse.toPosition = fromPosition;
+        inverse.toRotation = fromRotation;
+        inverse.type = type switch
+        {
+            PlacementCommandType.Place => PlacementCommandType.Delete,
+            PlacementCommandType.Delete => PlacementCommandType.Place,
+            PlacementCommandType.Remove => PlacementCommandType.Restore,
+            PlacementCommandType.Restore => PlacementCommandType.Remove,
+            _ => PlacementCommandType.Transform
+        };
+        return inverse;
+    }
+
+    // Rough in-memory cost, used by the journal's memory cap
+    public long EstimateBytes() => 96 + 2L * ((id?.Length ?? 0) + (prefabID?.Length ?? 0));
+}
+
+// Implemented by whatever owns the placed objects (ObjectPlacementManager, or the fake world of PlacementJournalTests)
+public interface IPlacementJournalTarget
+{
+    void Apply(in PlacementCommand command);
+}
+
+/* --------------------------------------------------------------------------
+   Undo / redo journal for the placement system.
+
+   • Operations are recorded after they happened (Record) as steps of one or more commands.
+     BeginBatch / EndBatch groups several into one step. Undo applies the inverse commands in
+     reverse order, Redo applies them again.
+   • History is unbounded in count but capped in memory (MaxMemoryBytes, <= 0 for no cap):
+     the oldest steps are dropped first. Consecutive moves of the same object within
+     MergeWindow seconds merge into one step, so nudging doesn't flood the history.
+   • Every command that changes the world (recorded, undone, redone or replayed) is also
+     appended to a recovery log, cleared by MarkSaved. Replaying that log on top of the last
+     save rebuilds the unsaved session. Moves of the same object are compacted as they arrive.
+   -------------------------------------------------------------------------- */
+public class PlacementJournal
+{
+    [Serializable]
+    private class RecoveryLog
+    {
+        public int version = 1;
+        public List<PlacementCommand> commands = new List<PlacementCommand>();
+    }
+
+    private class Step
+    {
+        public string label;
+        public double time;
+        public long bytes;
+        public readonly List<PlacementCommand> commands = new List<PlacementCommand>();
+    }
+
+    private const long StepOverheadBytes = 64;
+
+    private readonly IPlacementJournalTarget target;
+    private readonly List<Step> steps = new List<Step>(); // Undo at [0, cursor), redo at [cursor, Count)
+    private readonly RecoveryLog recoveryLog = new RecoveryLog();
+    private int cursor;
+    private Step openBatch;
+    private int batchDepth;
+
+    public long MaxMemoryBytes = 256 * 1024;
+    public double MergeWindow = 1.0;
+
+    public int UndoCount => cursor;
+    public int RedoCount => steps.Count - cursor;
+    public bool CanUndo => cursor > 0 && openBatch == null;
+    public bool CanRedo => cursor < steps.Count && openBatch == null;
+    public string UndoLabel => cursor > 0 ? steps[cursor - 1].label : null;
+    public string RedoLabel => cursor < steps.Count ? steps[cursor].label : null;
+    public long MemoryBytes { get; private set; }
+    public int DroppedSteps { get; private set; }
+    public int RecoveryCount => recoveryLog.commands.Count;
+
+    // Raised whenever the recovery log changed, so it can be persisted
+    public event Action RecoveryLogChanged;
+
+    public PlacementJournal(IPlacementJournalTarget target)
+    {
+        this.target = target;
+    }
+
+    // Records a command that was already applied to the world
+    public void Record(in PlacementCommand command, double time, string label = null)
+    {
+        AppendToLog(command);
+
+        if (openBatch != null)
+        {
+            openBatch.commands.Add(command);
+            return;
+        }
+
+        ClearRedo();
+        if (TryMerge(command, time)) return;
+
+        var step = new Step { label = label ?? command.type.ToString(), time = time };
+        step.commands.Add(command);
+        Push(step);
+    }
+
+    public void BeginBatch(string label, double time)
+    {
+        if (batchDepth++ == 0)
+            openBatch = new Step { label = label, time = time };
+    }
+
+    public void EndBatch()
+    {
+        if (batchDepth == 0 || --batchDepth > 0) return;
+
+        Step step = openBatch;
+        openBatch = null;
+        if (step.commands.Count == 0) return;
+
+        ClearRedo();
+        Push(step);
+    }
+
+    public bool Undo()
+    {
+        if (!CanUndo) return false;
+
+        Step step = steps[--cursor];
+        for (int i = step.commands.Count - 1; i >= 0; i--)
+        {
+            PlacementCommand inverse = step.commands[i].Inverse();
+            target.Apply(inverse);
+            AppendToLog(inverse);
+        }
+        return true;
+    }
+
+    public bool Redo()
+    {
+        if (!CanRedo) return false;
+
+        Step step = steps[cursor++];
+        for (int i = 0; i < step.commands.Count; i++)
+        {
+            target.Apply(step.commands[i]);
+            AppendToLog(step.commands[i]);
+        }
+        return true;
+    }
+
+    // Forgets history and the recovery log (after loading or deleting a save)
+    public void Clear()
+    {
+        steps.Clear();
+        cursor = 0;
+        openBatch = null;
+        batchDepth = 0;
+        MemoryBytes = 0;
+        DroppedSteps = 0;
+        recoveryLog.commands.Clear();
+        RecoveryLogChanged?.Invoke();
+    }
+
+    // The world now matches the save file: the recovery log restarts empty, undo history is kept
+    public void MarkSaved()
+    {
+        recoveryLog.commands.Clear();
+        RecoveryLogChanged?.Invoke();
+    }
+
+    public string SerializeRecoveryLog() => JsonUtility.ToJson(recoveryLog);
+
+    // Applies a serialized recovery log on top of the current world. Replayed commands join the new
+    // recovery log (still unsaved) but not the undo history. Returns how many commands were applied.
+    public int Replay(string json)
+    {
+        if (string.IsNullOrEmpty(json)) return 0;
+
+        RecoveryLog log;
+        try
+        {
+            log = JsonUtility.FromJson<RecoveryLog>(json);
+        }
+        catch (Exception e)
+        {
+            Debug.LogWarning($"[PlacementJournal] Ignoring unreadable recovery log: {e.Message}");
+            return 0;
+        }
+
+        if (log?.commands == null) return 0;
+
+        foreach (PlacementCommand command in log.commands)
+        {
+            target.Apply(command);
+            AppendToLog(command);
+        }
+        return log.commands.Count;
+    }
+
+    private bool TryMerge(in PlacementCommand command, double time)
+    {
+        if (command.type != PlacementCommandType.Transform || cursor == 0) return false;
+
+        Step last = steps[cursor - 1];
+        if (last.commands.Count != 1 || time - last.time > MergeWindow) return false;
+
+        PlacementCommand previous = last.commands[0];
+        if (previous.type != PlacementCommandType.Transform || previous.id != command.id) return false;
+
+        previous.toPosition = command.toPosition;
+        previous.toRotation = command.toRotation;
+        last.commands[0] = previous;
+        last.time = time;
+        return true;
+    }
+
+    private void AppendToLog(in PlacementCommand command)
+    {
+        List<PlacementCommand> log = recoveryLog.commands;
+        int last = log.Count - 1;
+
+        // Two moves of the same object in a row replay as one
+        if (command.type == PlacementCommandType.Transform && last >= 0
+            && log[last].type == PlacementCommandType.Transform && log[last].id == command.id)
+        {
+            PlacementCommand merged = log[last];
+            merged.toPosition = command.toPosition;
+            merged.toRotation = command.toRotation;
+            log[last] = merged;
+        }
+        else
+        {
+            log.Add(command);
+        }
+
+        RecoveryLogChanged?.Invoke();
+    }
+
+    private void Push(Step step)
+    {
+        step.bytes = StepOverheadBytes;
+        foreach (PlacementCommand command in step.commands)
+            step.bytes += command.EstimateBytes();
+
+        steps.Add(step);
+        cursor++;
+        MemoryBytes += step.bytes;
+
+        // Drop the oldest steps over the cap, always keeping the newest one
+        int drop = 0;
+        while (MaxMemoryBytes > 0 && MemoryBytes > MaxMemoryBytes && cursor - drop > 1)
+        {
+            MemoryBytes -= steps[drop].bytes;
+            drop++;
+        }
+
+        if (drop > 0)
+        {
+            steps.RemoveRange(0, drop);
+            cursor -= drop;
+            DroppedSteps += drop;
+        }
+    }
+
+    private void ClearRedo()
+    {
+        for (int i = cursor; i < steps.Count; i++)
+            MemoryBytes -= steps[i].bytes;
+        steps.RemoveRange(cursor, steps.Count - cursor);
+    }
+}
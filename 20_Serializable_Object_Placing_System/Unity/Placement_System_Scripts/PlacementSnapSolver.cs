@@ -0,0 +1,295 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+public enum PlacementSnapKind { None, Grid, Socket, Guide }
+
+// Everything the solver needs about the preview, after surface alignment
+public struct PlacementSnapRequest
+{
+    public Vector3 position;
+    public Quaternion rotation;
+    public Vector3 scale;
+    public Vector3 surfaceNormal;
+    public Bounds localBounds;
+    public PlacementSocketData[] sockets;
+    public PlacementGridMode gridMode;
+    public Vector3 gridCellSize;
+    public Pose gridOrigin; // Frame of the Local grid, usually the surface object
+    public int ignoreHandle; // Object being edited, so it doesn't snap to itself
+}
+
+public struct PlacementSnapResult
+{
+    public Vector3 position;
+    public Quaternion rotation;
+    public PlacementSnapKind kind;
+    public int targetHandle;
+    public int socketIndex;
+    public int targetSocketIndex;
+}
+
+// Line between the aligned feature of the preview and the neighbour it was aligned to
+public struct PlacementGuide
+{
+    public Vector3 from;
+    public Vector3 to;
+    public int axis;
+    public int targetHandle;
+}
+
+/* --------------------------------------------------------------------------
+   Snapping for the placement preview, solved in priority order:
+
+   • Socket: a preview socket within socketRadius of a compatible socket on a nearby placed
+     object connects to it (positions meet, normals face each other). Candidates come from a
+     PlacementSpatialIndex query around the preview.
+   • Grid: otherwise the pivot snaps to a World or Local (surface object) grid. The axis along
+     the surface normal is left to the surface offset.
+   • Guide: otherwise min / center / max of the preview's bounds align to a neighbour's within
+     guideTolerance, per axis along the surface, reporting the guide lines.
+
+   Pure data in, pure data out: ties are broken by handle and socket order, never by query or
+   dictionary order, so the same input always gives the same result (see PlacementSnapSolverTests).
+   -------------------------------------------------------------------------- */
+public class PlacementSnapSolver
+{
+    private struct WorldSocket
+    {
+        public PlacementSocketData data;
+        public Vector3 position;
+        public Vector3 normal;
+    }
+
+    private readonly PlacementSpatialIndex index;
+    private readonly Dictionary<int, WorldSocket[]> socketsByHandle = new Dictionary<int, WorldSocket[]>();
+    private readonly List<int> candidates = new List<int>();
+
+    public float socketRadius = 0.35f;
+    public float maxSocketAngle = 90f;
+    public float guideRadius = 2f;
+    public float guideTolerance = 0.1f;
+
+    public PlacementSnapSolver(PlacementSpatialIndex index)
+    {
+        this.index = index;
+    }
+
+    // Caches the world sockets of an indexed object. Call again whenever it moves.
+    public void SetSockets(int handle, PlacementSocketData[] localSockets, Matrix4x4 localToWorld)
+    {
+        if (localSockets == null || localSockets.Length == 0)
+        {
+            socketsByHandle.Remove(handle);
+            return;
+        }
+
+        if (!socketsByHandle.TryGetValue(handle, out WorldSocket[] world) || world.Length != localSockets.Length)
+        {
+            world = new WorldSocket[localSockets.Length];
+            socketsByHandle[handle] = world;
+        }
+
+        for (int i = 0; i < localSockets.Length; i++)
+        {
+            world[i] = new WorldSocket
+            {
+                data = localSockets[i],
+                position = localToWorld.MultiplyPoint3x4(localSockets[i].localPosition),
+                normal = localToWorld.MultiplyVector(localSockets[i].localNormal).normalized
+            };
+        }
+    }
+
+    public void RemoveSockets(int handle) => socketsByHandle.Remove(handle);
+    public void Clear() => socketsByHandle.Clear();
+
+    public PlacementSnapResult Solve(in PlacementSnapRequest request, List<PlacementGuide> guides = null)
+    {
+        guides?.Clear();
+
+        var result = new PlacementSnapResult
+        {
+            position = request.position,
+            rotation = request.rotation,
+            kind = PlacementSnapKind.None,
+            targetHandle = -1,
+            socketIndex = -1,
+            targetSocketIndex = -1
+        };
+
+        if (SnapToSocket(request, ref result)) return result;
+        if (SnapToGrid(request, ref result)) return result;
+        AlignToNeighbours(request, ref result, guides);
+        return result;
+    }
+
+    private bool SnapToSocket(in PlacementSnapRequest request, ref PlacementSnapResult result)
+    {
+        if (request.sockets == null || request.sockets.Length == 0 || socketsByHandle.Count == 0) return false;
+
+        PlacementBox area = PlacementBox.FromLocalBounds(request.localBounds, request.position, request.rotation, request.scale);
+        area.extents += Vector3.one * socketRadius;
+        index.Query(area, candidates, request.ignoreHandle);
+
+        float minDot = Mathf.Cos(maxSocketAngle * Mathf.Deg2Rad);
+        float bestDistance = socketRadius * socketRadius;
+        int bestHandle = -1, bestTarget = -1, bestSocket = -1;
+
+        for (int c = 0; c < candidates.Count; c++)
+        {
+            int handle = candidates[c];
+            if (!socketsByHandle.TryGetValue(handle, out WorldSocket[] targets)) continue;
+
+            for (int t = 0; t < targets.Length; t++)
+            {
+                for (int s = 0; s < request.sockets.Length; s++)
+                {
+                    if (!PlacementSocketData.Compatible(request.sockets[s], targets[t].data)) continue;
+
+                    Vector3 position = request.position + request.rotation * Vector3.Scale(request.scale, request.sockets[s].localPosition);
+                    Vector3 normal = request.rotation * request.sockets[s].localNormal;
+
+                    float distance = (targets[t].position - position).sqrMagnitude;
+                    if (distance > bestDistance) continue;
+                    if (Vector3.Dot(normal, -targets[t].normal) < minDot) continue;
+
+                    // Equal distances fall back to the lowest (handle, target socket, socket)
+                    if (bestHandle >= 0 && distance == bestDistance && !IsLower(handle, t, s, bestHandle, bestTarget, bestSocket)) continue;
+
+                    bestDistance = distance;
+                    bestHandle = handle;
+                    bestTarget = t;
+                    bestSocket = s;
+                }
+            }
+        }
+
+        if (bestHandle < 0) return false;
+
+        WorldSocket target = socketsByHandle[bestHandle][bestTarget];
+        PlacementSocketData socket = request.sockets[bestSocket];
+
+        // Turn the preview so both sockets face each other, then bring them together
+        Quaternion rotation = Quaternion.FromToRotation(request.rotation * socket.localNormal, -target.normal) * request.rotation;
+        result.rotation = rotation;
+        result.position = target.position - rotation * Vector3.Scale(request.scale, socket.localPosition);
+        result.kind = PlacementSnapKind.Socket;
+        result.targetHandle = bestHandle;
+        result.targetSocketIndex = bestTarget;
+        result.socketIndex = bestSocket;
+        return true;
+    }
+
+    private static bool IsLower(int handle, int target, int socket, int bestHandle, int bestTarget, int bestSocket)
+    {
+        if (handle != bestHandle) return handle < bestHandle;
+        if (target != bestTarget) return target < bestTarget;
+        return socket < bestSocket;
+    }
+
+    private static bool SnapToGrid(in PlacementSnapRequest request, ref PlacementSnapResult result)
+    {
+        if (request.gridMode == PlacementGridMode.None) return false;
+
+        Pose origin = request.gridMode == PlacementGridMode.Local ? request.gridOrigin : Pose.identity;
+        Quaternion toGrid = Quaternion.Inverse(origin.rotation);
+        Vector3 local = toGrid * (result.position - origin.position);
+        Vector3 normal = toGrid * request.surfaceNormal;
+
+        bool snapped = false;
+        for (int axis = 0; axis < 3; axis++)
+        {
+            float cell = request.gridCellSize[axis];
+            if (cell <= 0f || Mathf.Abs(normal[axis]) > 0.7f) continue;
+
+            local[axis] = Mathf.Round(local[axis] / cell) * cell;
+            snapped = true;
+        }
+
+        if (!snapped) return false;
+
+        result.position = origin.position + origin.rotation * local;
+        result.kind = PlacementSnapKind.Grid;
+        return true;
+    }
+
+    private void AlignToNeighbours(in PlacementSnapRequest request, ref PlacementSnapResult result, List<PlacementGuide> guides)
+    {
+        if (guideTolerance <= 0f) return;
+
+        PlacementBox box = PlacementBox.FromLocalBounds(request.localBounds, result.position, result.rotation, request.scale);
+        PlacementBox area = box;
+        area.extents += Vector3.one * guideRadius;
+        if (index.Query(area, candidates, request.ignoreHandle) == 0) return;
+
+        Bounds self = box.GetAABB();
+        Vector3 delta = Vector3.zero;
+        int firstGuide = guides?.Count ?? 0;
+
+        for (int axis = 0; axis < 3; axis++)
+        {
+            if (Mathf.Abs(request.surfaceNormal[axis]) > 0.7f) continue;
+
+            float bestDistance = guideTolerance;
+            float bestDelta = 0f;
+            int bestHandle = -1, bestPair = -1;
+            Bounds bestBounds = default;
+
+            for (int c = 0; c < candidates.Count; c++)
+            {
+                int handle = candidates[c];
+                Bounds other = index.GetBox(handle).GetAABB();
+
+                // min / center / max of the preview against min / center / max of the neighbour
+                for (int pair = 0; pair < 9; pair++)
+                {
+                    float difference = Feature(other, pair % 3, axis) - Feature(self, pair / 3, axis);
+                    float distance = Mathf.Abs(difference);
+                    if (distance > bestDistance) continue;
+                    if (bestHandle >= 0 && distance == bestDistance && (handle > bestHandle || (handle == bestHandle && pair >= bestPair))) continue;
+
+                    bestDistance = distance;
+                    bestDelta = difference;
+                    bestHandle = handle;
+                    bestPair = pair;
+                    bestBounds = other;
+                }
+            }
+
+            if (bestHandle < 0) continue;
+
+            delta[axis] = bestDelta;
+            result.kind = PlacementSnapKind.Guide;
+            result.targetHandle = bestHandle;
+
+            if (guides != null)
+            {
+                float value = Feature(bestBounds, bestPair % 3, axis);
+                Vector3 to = bestBounds.center;
+                to[axis] = value;
+                guides.Add(new PlacementGuide { from = self.center, to = to, axis = axis, targetHandle = bestHandle });
+            }
+        }
+
+        result.position += delta;
+
+        // Guides start on the aligned preview, so shift them by the final offset on every axis
+        for (int i = firstGuide; guides != null && i < guides.Count; i++)
+        {
+            PlacementGuide guide = guides[i];
+            guide.from += delta;
+            guide.from[guide.axis] = guide.to[guide.axis];
+            guides[i] = guide;
+        }
+    }
+
+    private static float Feature(in Bounds bounds, int feature, int axis)
+    {
+        switch (feature)
+        {
+            case 0: return bounds.min[axis];
+            case 1: return bounds.center[axis];
+            default: return bounds.max[axis];
+        }
+    }
+}
@@ -0,0 +1,65 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+// Snap socket authored on a placeable prefab. Add it to an empty child, place it on the connecting
+// face and point its blue axis (forward) outwards. Two sockets connect when each accepts the other's type.
+// e.g. a wall piece with "Edge" sockets on both sides, or a crate with "Top" (forward up) accepting "Bottom" (forward down).
+public class PlacementSocket : MonoBehaviour
+{
+    [Tooltip("Socket kind, matched against the other socket's Accepts list.")]
+    public string socketType = "Edge";
+
+    [Tooltip("Socket types this one connects to. Empty accepts any type.")]
+    public string[] accepts = new string[0];
+
+    // Collects the prefab's sockets in the root's local space, in hierarchy order
+    public static PlacementSocketData[] Collect(GameObject root)
+    {
+        PlacementSocket[] found = root.GetComponentsInChildren<PlacementSocket>(true);
+        if (found.Length == 0) return System.Array.Empty<PlacementSocketData>();
+
+        Matrix4x4 toLocal = root.transform.worldToLocalMatrix;
+        var sockets = new PlacementSocketData[found.Length];
+        for (int i = 0; i < found.Length; i++)
+        {
+            Transform t = found[i].transform;
+            sockets[i] = new PlacementSocketData
+            {
+                name = found[i].gameObject.name,
+                type = found[i].socketType,
+                accepts = found[i].accepts ?? System.Array.Empty<string>(),
+                localPosition = toLocal.MultiplyPoint3x4(t.position),
+                localNormal = toLocal.MultiplyVector(t.forward).normalized
+            };
+        }
+        return sockets;
+    }
+
+    private void OnDrawGizmos()
+    {
+        Gizmos.color = Color.yellow;
+        Gizmos.DrawWireSphere(transform.position, 0.05f);
+        Gizmos.DrawLine(transform.position, transform.position + transform.forward * 0.2f);
+    }
+}
+
+// Plain socket description used by PlacementSnapSolver, so the solver never touches GameObjects
+[System.Serializable]
+public struct PlacementSocketData
+{
+    public string name;
+    public string type;
+    public string[] accepts;
+    public Vector3 localPosition;
+    public Vector3 localNormal;
+
+    public bool Accepts(string otherType)
+    {
+        if (accepts == null || accepts.Length == 0) return true;
+        for (int i = 0; i < accepts.Length; i++)
+            if (accepts[i] == otherType) return true;
+        return false;
+    }
+
+    public static bool Compatible(in PlacementSocketData a, in PlacementSocketData b) => a.Accepts(b.type) && b.Accepts(a.type);
+}
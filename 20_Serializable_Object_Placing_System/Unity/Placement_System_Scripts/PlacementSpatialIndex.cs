@@ -0,0 +1,309 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+// Oriented bounding box of a placed object (or the preview), in world space.
+public struct PlacementBox
+{
+    public Vector3 center;
+    public Vector3 extents;
+    public Quaternion rotation;
+
+    public PlacementBox(Vector3 center, Vector3 extents, Quaternion rotation)
+    {
+        this.center = center;
+        this.extents = extents;
+        this.rotation = rotation;
+    }
+
+    // Places a bounds measured in the object's local space (see PlacementSpatialIndex.MeasureLocalBounds) at its transform
+    public static PlacementBox FromLocalBounds(Bounds local, Transform transform, float shrink = 1f)
+    {
+        return FromLocalBounds(local, transform.position, transform.rotation, transform.lossyScale, shrink);
+    }
+
+    public static PlacementBox FromLocalBounds(Bounds local, Vector3 position, Quaternion rotation, Vector3 scale, float shrink = 1f)
+    {
+        Vector3 extents = Vector3.Scale(local.extents, new Vector3(Mathf.Abs(scale.x), Mathf.Abs(scale.y), Mathf.Abs(scale.z)));
+        return new PlacementBox(position + rotation * Vector3.Scale(local.center, scale), extents * shrink, rotation);
+    }
+
+    // Half size of the box projected on a direction
+    public float ExtentAlong(Vector3 direction)
+    {
+        return Mathf.Abs(Vector3.Dot(rotation * Vector3.right, direction)) * extents.x
+             + Mathf.Abs(Vector3.Dot(rotation * Vector3.up, direction)) * extents.y
+             + Mathf.Abs(Vector3.Dot(rotation * Vector3.forward, direction)) * extents.z;
+    }
+
+    // World axis aligned bounds enclosing the box
+    public Bounds GetAABB()
+    {
+        Vector3 half = new Vector3(ExtentAlong(Vector3.right), ExtentAlong(Vector3.up), ExtentAlong(Vector3.forward));
+        return new Bounds(center, half * 2f);
+    }
+
+    // Separating axis test between two oriented boxes (15 axes)
+    public bool Intersects(in PlacementBox other)
+    {
+        Vector3 a0 = rotation * Vector3.right, a1 = rotation * Vector3.up, a2 = rotation * Vector3.forward;
+        Vector3 b0 = other.rotation * Vector3.right, b1 = other.rotation * Vector3.up, b2 = other.rotation * Vector3.forward;
+        Vector3 t = other.center - center;
+
+        if (Separated(a0, t, other)) return false;
+        if (Separated(a1, t, other)) return false;
+        if (Separated(a2, t, other)) return false;
+        if (Separated(b0, t, other)) return false;
+        if (Separated(b1, t, other)) return false;
+        if (Separated(b2, t, other)) return false;
+
+        if (Separated(Vector3.Cross(a0, b0), t, other)) return false;
+        if (Separated(Vector3.Cross(a0, b1), t, other)) return false;
+        if (Separated(Vector3.Cross(a0, b2), t, other)) return false;
+        if (Separated(Vector3.Cross(a1, b0), t, other)) return false;
+        if (Separated(Vector3.Cross(a1, b1), t, other)) return false;
+        if (Separated(Vector3.Cross(a1, b2), t, other)) return false;
+        if (Separated(Vector3.Cross(a2, b0), t, other)) return false;
+        if (Separated(Vector3.Cross(a2, b1), t, other)) return false;
+        if (Separated(Vector3.Cross(a2, b2), t, other)) return false;
+
+        return true;
+    }
+
+    private bool Separated(Vector3 axis, Vector3 t, in PlacementBox other)
+    {
+        // Parallel edges give a zero cross product, already covered by the face axes
+        if (axis.sqrMagnitude < 1e-8f) return false;
+        return Mathf.Abs(Vector3.Dot(t, axis)) > ExtentAlong(axis) + other.ExtentAlong(axis);
+    }
+}
+
+/* --------------------------------------------------------------------------
+   Uniform grid of placed objects' cached oriented boxes.
+
+   • Each object is registered once with its box and kept in every cell its world AABB
+     touches. Only placing, moving and removing touch the grid, nothing is measured per frame.
+   • Queries walk the cells under the query box, dedupe with a per query stamp and run an
+     OBB / OBB test. Results go into caller owned lists, so a query allocates nothing.
+   • Handles are plain ints (recycled after Remove), so the index can be driven without
+     GameObjects, which is what PlacementSpatialIndexTests does.
+   -------------------------------------------------------------------------- */
+public class PlacementSpatialIndex
+{
+    private struct Item
+    {
+        public PlacementBox box;
+        public PlacedObject owner;
+        public Vector3Int min, max;
+        public int stamp;
+        public bool alive;
+    }
+
+    private readonly Dictionary<Vector3Int, List<int>> cells = new Dictionary<Vector3Int, List<int>>();
+    private readonly Stack<List<int>> freeCellLists = new Stack<List<int>>();
+    private readonly List<Item> items = new List<Item>();
+    private readonly Stack<int> freeHandles = new Stack<int>();
+    private readonly float cellSize;
+    private int queryStamp;
+
+    public int Count { get; private set; }
+    public float CellSize => cellSize;
+
+    public PlacementSpatialIndex(float cellSize)
+    {
+        this.cellSize = Mathf.Max(0.01f, cellSize);
+    }
+
+    public int Add(in PlacementBox box, PlacedObject owner = null)
+    {
+        int handle = freeHandles.Count > 0 ? freeHandles.Pop() : items.Count;
+        var item = new Item { box = box, owner = owner, alive = true };
+        GetCellRange(box, out item.min, out item.max);
+
+        if (handle == items.Count) items.Add(item);
+        else items[handle] = item;
+
+        Link(handle, item.min, item.max);
+        Count++;
+        return handle;
+    }
+
+    public void Move(int handle, in PlacementBox box)
+    {
+        if (!IsValid(handle)) return;
+
+        Item item = items[handle];
+        item.box = box;
+        GetCellRange(box, out Vector3Int min, out Vector3Int max);
+
+        // Most edits stay inside the same cells
+        if (min != item.min || max != item.max)
+        {
+            Unlink(handle, item.min, item.max);
+            Link(handle, min, max);
+            item.min = min;
+            item.max = max;
+        }
+
+        items[handle] = item;
+    }
+
+    public void Remove(int handle)
+    {
+        if (!IsValid(handle)) return;
+
+        Item item = items[handle];
+        Unlink(handle, item.min, item.max);
+        items[handle] = default;
+        freeHandles.Push(handle);
+        Count--;
+    }
+
+    public void Clear()
+    {
+        foreach (List<int> list in cells.Values)
+        {
+            list.Clear();
+            freeCellLists.Push(list);
+        }
+        cells.Clear();
+        items.Clear();
+        freeHandles.Clear();
+        Count = 0;
+    }
+
+    public bool IsValid(int handle) => handle >= 0 && handle < items.Count && items[handle].alive;
+    public PlacedObject GetOwner(int handle) => IsValid(handle) ? items[handle].owner : null;
+    public PlacementBox GetBox(int handle) => IsValid(handle) ? items[handle].box : default;
+
+    // True as soon as one registered box intersects the query box
+    public bool Overlaps(in PlacementBox box, int ignoreHandle = -1)
+    {
+        return Query(box, null, ignoreHandle, true) > 0;
+    }
+
+    // Fills results (cleared first) with the handles of every box intersecting the query box
+    public int Query(in PlacementBox box, List<int> results, int ignoreHandle = -1)
+    {
+        results?.Clear();
+        return Query(box, results, ignoreHandle, false);
+    }
+
+    private int Query(in PlacementBox box, List<int> results, int ignoreHandle, bool firstOnly)
+    {
+        if (Count == 0) return 0;
+
+        GetCellRange(box, out Vector3Int min, out Vector3Int max);
+        int stamp = ++queryStamp;
+        int found = 0;
+
+        for (int x = min.x; x <= max.x; x++)
+        for (int y = min.y; y <= max.y; y++)
+        for (int z = min.z; z <= max.z; z++)
+        {
+            if (!cells.TryGetValue(new Vector3Int(x, y, z), out List<int> list)) continue;
+
+            for (int i = 0; i < list.Count; i++)
+            {
+                int handle = list[i];
+                Item item = items[handle];
+                if (handle == ignoreHandle || item.stamp == stamp) continue;
+
+                item.stamp = stamp;
+                items[handle] = item;
+
+                if (!item.box.Intersects(box)) continue;
+
+                found++;
+                results?.Add(handle);
+                if (firstOnly) return found;
+            }
+        }
+
+        return found;
+    }
+
+    private void GetCellRange(in PlacementBox box, out Vector3Int min, out Vector3Int max)
+    {
+        Bounds aabb = box.GetAABB();
+        min = Vector3Int.FloorToInt(aabb.min / cellSize);
+        max = Vector3Int.FloorToInt(aabb.max / cellSize);
+    }
+
+    private void Link(int handle, Vector3Int min, Vector3Int max)
+    {
+        for (int x = min.x; x <= max.x; x++)
+        for (int y = min.y; y <= max.y; y++)
+        for (int z = min.z; z <= max.z; z++)
+        {
+            var key = new Vector3Int(x, y, z);
+            if (!cells.TryGetValue(key, out List<int> list))
+            {
+                list = freeCellLists.Count > 0 ? freeCellLists.Pop() : new List<int>(4);
+                cells.Add(key, list);
+            }
+            list.Add(handle);
+        }
+    }
+
+    private void Unlink(int handle, Vector3Int min, Vector3Int max)
+    {
+        for (int x = min.x; x <= max.x; x++)
+        for (int y = min.y; y <= max.y; y++)
+        for (int z = min.z; z <= max.z; z++)
+        {
+            var key = new Vector3Int(x, y, z);
+            if (!cells.TryGetValue(key, out List<int> list)) continue;
+
+            int index = list.IndexOf(handle);
+            if (index < 0) continue;
+
+            // Order inside a cell doesn't matter, swap-remove
+            list[index] = list[list.Count - 1];
+            list.RemoveAt(list.Count - 1);
+
+            if (list.Count == 0)
+            {
+                cells.Remove(key);
+                freeCellLists.Push(list);
+            }
+        }
+    }
+
+    // Combined renderer bounds in the root's local space (falls back to colliders, then a 1m cube)
+    public static Bounds MeasureLocalBounds(GameObject root)
+    {
+        Matrix4x4 toLocal = root.transform.worldToLocalMatrix;
+        bool hasAny = false;
+        Bounds combined = default;
+
+        foreach (Renderer r in root.GetComponentsInChildren<Renderer>(true))
+        {
+            if (r is ParticleSystemRenderer || r is TrailRenderer || r is LineRenderer) continue;
+            Encapsulate(ref combined, ref hasAny, r.localBounds, toLocal * r.localToWorldMatrix);
+        }
+
+        if (!hasAny)
+        {
+            foreach (Collider c in root.GetComponentsInChildren<Collider>(true))
+            {
+                Bounds world = c.bounds;
+                Encapsulate(ref combined, ref hasAny, world, toLocal);
+            }
+        }
+
+        return hasAny ? combined : new Bounds(Vector3.zero, Vector3.one);
+    }
+
+    private static void Encapsulate(ref Bounds combined, ref bool hasAny, Bounds source, Matrix4x4 toLocal)
+    {
+        Vector3 c = source.center, e = source.extents;
+        for (int i = 0; i < 8; i++)
+        {
+            Vector3 corner = c + new Vector3((i & 1) == 0 ? -e.x : e.x, (i & 2) == 0 ? -e.y : e.y, (i & 4) == 0 ? -e.z : e.z);
+            Vector3 point = toLocal.MultiplyPoint3x4(corner);
+
+            if (!hasAny) { combined = new Bounds(point, Vector3.zero); hasAny = true; }
+            else combined.Encapsulate(point);
+        }
+    }
+}
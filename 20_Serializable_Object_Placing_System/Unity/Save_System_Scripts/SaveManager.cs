@@ -7,9 +7,40 @@ using UnityEngine.SceneManagement;
 public class SaveManager : MonoBehaviour
 {
     private const string SaveFile = "Game_Save.json";
+    private const string JournalFile = "Game_Save.journal.json";
     [SerializeField] private ObjectPlacementManager placementManager;
     // public GameObject loadingScreen; // Optional Loading Screen
 
+    // Placement changes a crashed session never saved, replayed by the next LoadGameSave
+    private string _pendingRecovery;
+
+    private void Awake()
+    {
+        // The journal file only survives a session that didn't shut down cleanly (see OnDestroy)
+        string journalPath = GetJournalPath();
+        if (!File.Exists(journalPath)) return;
+
+        _pendingRecovery = File.ReadAllText(journalPath);
+        File.Delete(journalPath);
+        Debug.Log("[SaveManager] Found unsaved placement changes from the last session. They will be replayed on load.");
+    }
+
+    private void Start()
+    {
+        if (placementManager != null)
+            placementManager.Journal.RecoveryLogChanged += WriteJournal;
+    }
+
+    private void OnDestroy()
+    {
+        if (placementManager != null)
+            placementManager.Journal.RecoveryLogChanged -= WriteJournal;
+
+        // Quitting or reloading the scene without saving discards the changes, same as before the journal existed
+        string journalPath = GetJournalPath();
+        if (File.Exists(journalPath)) File.Delete(journalPath);
+    }
+
     public void SaveGame()
     {
         // Give the placement manager a chance to clean up staged removals and prepare any pending placed objects for saving before we capture the scene state.
@@ -31,7 +62,8 @@ public class SaveManager : MonoBehaviour
                     {
                         id = guidComponent.ID,
                         jsonData = json,
-                        type = state.GetType().AssemblyQualifiedName
+                        type = SaveSchemas.GetTypeName(state.GetType()),
+                        version = SaveSchemas.GetVersion(state.GetType())
                     });
                 }
             }
@@ -40,17 +72,29 @@ public class SaveManager : MonoBehaviour
         string wrapperJson = JsonUtility.ToJson(wrapper, true);
         File.WriteAllText(GetSavesPath(), wrapperJson);
 
+        // Everything in the journal is in the save now
+        _pendingRecovery = null;
+        placementManager?.Journal.MarkSaved();
+
         Debug.Log("[SaveManager] Game saved.");
     }
 
     public void LoadGameSave()
     {
         string path = GetSavesPath();
-        if (!File.Exists(path)) return;
+        if (!File.Exists(path))
+        {
+            ReplayPendingJournal();
+            return;
+        }
 
         string json = File.ReadAllText(path);
         JsonWrapper wrapper = JsonUtility.FromJson<JsonWrapper>(json);
 
+        // Older entries are upgraded to their type's current schema (and current type name) first
+        int upgraded = SaveSchemas.MigrateAll(wrapper);
+        if (upgraded > 0) Debug.Log($"[SaveManager] Migrated {upgraded} entries from an older save format.");
+
         // First pass: restore all ISaveable objects in the scene to their saved state.
         foreach (var saveable in FindObjectsByType<MonoBehaviour>(FindObjectsSortMode.None))
         {
@@ -64,7 +108,7 @@ public class SaveManager : MonoBehaviour
 
                     if (entry != null)
                     {
-                        System.Type type = System.Type.GetType(entry.type);
+                        System.Type type = SaveSchemas.ResolveType(entry.type);
                         object state = JsonUtility.FromJson(entry.jsonData, type);
                         saveableComponent.RestoreState(state);
                     }
@@ -75,13 +119,41 @@ public class SaveManager : MonoBehaviour
         // Second pass: tell the placement manager to load any placed objects from the save data. 
         // This is necessary because placed objects are instantiated at runtime and won't exist in the scene until we explicitly spawn them based on the saved PlacedObjectSaveData.
         placementManager?.LoadPlacedObjects();
+        ReplayPendingJournal();
 
         Debug.Log("[SaveManager] Game loaded.");
     }
 
+    // Crash recovery: replays the placement journal of the last session on top of the save just loaded.
+    private void ReplayPendingJournal()
+    {
+        if (_pendingRecovery == null || placementManager == null) return;
+
+        int replayed = placementManager.Journal.Replay(_pendingRecovery);
+        _pendingRecovery = null;
+        Debug.Log($"[SaveManager] Recovered {replayed} unsaved placement changes.");
+    }
+
+    // Mirrors the journal's recovery log to disk after every change, so a crash loses at most the last action
+    private void WriteJournal()
+    {
+        if (placementManager == null) return;
+
+        string journalPath = GetJournalPath();
+        if (placementManager.Journal.RecoveryCount == 0)
+        {
+            if (File.Exists(journalPath)) File.Delete(journalPath);
+            return;
+        }
+
+        File.WriteAllText(journalPath, placementManager.Journal.SerializeRecoveryLog());
+    }
+
     // Deletes the save file and clears all placed objects from the scene. 
     public void DeleteSave()
     {
+        _pendingRecovery = null;
+
         // Clear placed objects from the scene before wiping the file
         placementManager?.ClearAllPlacedObjects();
 
@@ -109,6 +181,8 @@ public class SaveManager : MonoBehaviour
         return Path.Combine(folder, SaveFile);
     }
 
+    public string GetJournalPath() => Path.Combine(Path.GetDirectoryName(GetSavesPath()), JournalFile);
+
     // private void OnEnable()
     // {
     //     SceneManager.sceneLoaded += OnSceneLoaded;
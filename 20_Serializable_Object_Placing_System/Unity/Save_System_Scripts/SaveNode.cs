@@ -0,0 +1,291 @@
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.Text;
+
+public enum SaveNodeKind { Null, Bool, Number, String, Array, Object }
+
+/* --------------------------------------------------------------------------
+   Minimal JSON document tree for save migrations.
+
+   • JsonUtility only maps JSON onto the current version of a type, so a field that was
+     renamed or removed is lost before a migration could see it. Migrations work on this
+     tree instead: parse the old jsonData, edit it, write it back.
+   • Objects keep their field order, numbers are doubles written round-trip and culture
+     invariant, which JsonUtility reads back fine.
+   -------------------------------------------------------------------------- */
+public class SaveNode
+{
+    public SaveNodeKind Kind { get; private set; }
+
+    private bool _bool;
+    private double _number;
+    private string _string;
+    private List<SaveNode> _items;
+    private List<KeyValuePair<string, SaveNode>> _fields;
+
+    public static SaveNode Null() => new SaveNode { Kind = SaveNodeKind.Null };
+    public static SaveNode From(bool value) => new SaveNode { Kind = SaveNodeKind.Bool, _bool = value };
+    public static SaveNode From(double value) => new SaveNode { Kind = SaveNodeKind.Number, _number = value };
+    public static SaveNode From(string value) => value == null ? Null() : new SaveNode { Kind = SaveNodeKind.String, _string = value };
+    public static SaveNode NewArray() => new SaveNode { Kind = SaveNodeKind.Array, _items = new List<SaveNode>() };
+    public static SaveNode NewObject() => new SaveNode { Kind = SaveNodeKind.Object, _fields = new List<KeyValuePair<string, SaveNode>>() };
+
+    public bool IsObject => Kind == SaveNodeKind.Object;
+    public bool IsArray => Kind == SaveNodeKind.Array;
+
+    public bool AsBool => Kind == SaveNodeKind.Bool ? _bool : _number != 0;
+    public double AsDouble => Kind == SaveNodeKind.Number ? _number : 0;
+    public float AsFloat => (float)AsDouble;
+    public int AsInt => (int)AsDouble;
+    public string AsString => Kind == SaveNodeKind.String ? _string : null;
+
+    /* ----- Objects ----- */
+
+    public IEnumerable<string> Keys
+    {
+        get
+        {
+            if (_fields == null) yield break;
+            foreach (var field in _fields) yield return field.Key;
+        }
+    }
+
+    public bool Has(string key) => IndexOf(key) >= 0;
+
+    // Missing fields read as null, never throw, so migrations can probe freely
+    public SaveNode this[string key]
+    {
+        get
+        {
+            int index = IndexOf(key);
+            return index >= 0 ? _fields[index].Value : null;
+        }
+        set
+        {
+            if (_fields == null) throw new InvalidOperationException("SaveNode is not an object.");
+
+            int index = IndexOf(key);
+            var field = new KeyValuePair<string, SaveNode>(key, value ?? Null());
+            if (index >= 0) _fields[index] = field;
+            else _fields.Add(field);
+        }
+    }
+
+    public bool Remove(string key)
+    {
+        int index = IndexOf(key);
+        if (index < 0) return false;
+        _fields.RemoveAt(index);
+        return true;
+    }
+
+    // Renames a field in place, keeping its position. False when from is missing or to already exists.
+    public bool Rename(string from, string to)
+    {
+        int index = IndexOf(from);
+        if (index < 0 || Has(to)) return false;
+        _fields[index] = new KeyValuePair<string, SaveNode>(to, _fields[index].Value);
+        return true;
+    }
+
+    private int IndexOf(string key)
+    {
+        if (_fields == null) return -1;
+        for (int i = 0; i < _fields.Count; i++)
+            if (_fields[i].Key == key) return i;
+        return -1;
+    }
+
+    /* ----- Arrays ----- */
+
+    public int Count => _items?.Count ?? _fields?.Count ?? 0;
+    public SaveNode this[int index] => _items[index];
+    public void Add(SaveNode item) => _items.Add(item ?? Null());
+
+    /* ----- Writing ----- */
+
+    public override string ToString()
+    {
+        var builder = new StringBuilder();
+        Write(builder);
+        return builder.ToString();
+    }
+
+    private void Write(StringBuilder builder)
+    {
+        switch (Kind)
+        {
+            case SaveNodeKind.Null: builder.Append("null"); break;
+            case SaveNodeKind.Bool: builder.Append(_bool ? "true" : "false"); break;
+            case SaveNodeKind.Number: builder.Append(_number.ToString("R", CultureInfo.InvariantCulture)); break;
+            case SaveNodeKind.String: WriteString(builder, _string); break;
+            case SaveNodeKind.Array:
+                builder.Append('[');
+                for (int i = 0; i < _items.Count; i++)
+                {
+                    if (i > 0) builder.Append(',');
+                    _items[i].Write(builder);
+                }
+                builder.Append(']');
+                break;
+            case SaveNodeKind.Object:
+                builder.Append('{');
+                for (int i = 0; i < _fields.Count; i++)
+                {
+                    if (i > 0) builder.Append(',');
+                    WriteString(builder, _fields[i].Key);
+                    builder.Append(':');
+                    _fields[i].Value.Write(builder);
+                }
+                builder.Append('}');
+                break;
+        }
+    }
+
+    private static void WriteString(StringBuilder builder, string value)
+    {
+        builder.Append('"');
+        foreach (char c in value)
+        {
+            switch (c)
+            {
+                case '"': builder.Append("\\\""); break;
+                case '\\': builder.Append("\\\\"); break;
+                case '\n': builder.Append("\\n"); break;
+                case '\r': builder.Append("\\r"); break;
+                case '\t': builder.Append("\\t"); break;
+                default:
+                    if (c < 0x20) builder.Append("\\u").Append(((int)c).ToString("x4"));
+                    else builder.Append(c);
+                    break;
+            }
+        }
+        builder.Append('"');
+    }
+
+    /* ----- Parsing ----- */
+
+    public static SaveNode Parse(string json)
+    {
+        int index = 0;
+        SaveNode node = ParseValue(json, ref index);
+        SkipWhitespace(json, ref index);
+        if (index != json.Length) throw new FormatException($"Unexpected '{json[index]}' at {index}.");
+        return node;
+    }
+
+    private static SaveNode ParseValue(string json, ref int index)
+    {
+        SkipWhitespace(json, ref index);
+        if (index >= json.Length) throw new FormatException("Unexpected end of JSON.");
+
+        char c = json[index];
+        if (c == '{') return ParseObject(json, ref index);
+        if (c == '[') return ParseArray(json, ref index);
+        if (c == '"') return From(ParseString(json, ref index));
+        if (Match(json, ref index, "true")) return From(true);
+        if (Match(json, ref index, "false")) return From(false);
+        if (Match(json, ref index, "null")) return Null();
+        return From(ParseNumber(json, ref index));
+    }
+
+    private static SaveNode ParseObject(string json, ref int index)
+    {
+        SaveNode node = NewObject();
+        index++; // {
+
+        SkipWhitespace(json, ref index);
+        if (index < json.Length && json[index] == '}') { index++; return node; }
+
+        while (true)
+        {
+            SkipWhitespace(json, ref index);
+            string key = ParseString(json, ref index);
+            SkipWhitespace(json, ref index);
+            Expect(json, ref index, ':');
+            node[key] = ParseValue(json, ref index);
+
+            SkipWhitespace(json, ref index);
+            if (index < json.Length && json[index] == ',') { index++; continue; }
+            Expect(json, ref index, '}');
+            return node;
+        }
+    }
+
+    private static SaveNode ParseArray(string json, ref int index)
+    {
+        SaveNode node = NewArray();
+        index++; // [
+
+        SkipWhitespace(json, ref index);
+        if (index < json.Length && json[index] == ']') { index++; return node; }
+
+        while (true)
+        {
+            node.Add(ParseValue(json, ref index));
+
+            SkipWhitespace(json, ref index);
+            if (index < json.Length && json[index] == ',') { index++; continue; }
+            Expect(json, ref index, ']');
+            return node;
+        }
+    }
+
+    private static string ParseString(string json, ref int index)
+    {
+        Expect(json, ref index, '"');
+        var builder = new StringBuilder();
+
+        while (index < json.Length)
+        {
+            char c = json[index++];
+            if (c == '"') return builder.ToString();
+            if (c != '\\') { builder.Append(c); continue; }
+
+            char escaped = json[index++];
+            switch (escaped)
+            {
+                case 'n': builder.Append('\n'); break;
+                case 'r': builder.Append('\r'); break;
+                case 't': builder.Append('\t'); break;
+                case 'b': builder.Append('\b'); break;
+                case 'f': builder.Append('\f'); break;
+                case 'u':
+                    builder.Append((char)int.Parse(json.Substring(index, 4), NumberStyles.HexNumber));
+                    index += 4;
+                    break;
+                default: builder.Append(escaped); break; // " \ /
+            }
+        }
+
+        throw new FormatException("Unterminated string.");
+    }
+
+    private static double ParseNumber(string json, ref int index)
+    {
+        int start = index;
+        while (index < json.Length && "+-0123456789.eE".IndexOf(json[index]) >= 0) index++;
+        if (start == index) throw new FormatException($"Unexpected '{json[index]}' at {index}.");
+        return double.Parse(json.Substring(start, index - start), NumberStyles.Float, CultureInfo.InvariantCulture);
+    }
+
+    private static bool Match(string json, ref int index, string literal)
+    {
+        if (string.CompareOrdinal(json, index, literal, 0, literal.Length) != 0) return false;
+        index += literal.Length;
+        return true;
+    }
+
+    private static void Expect(string json, ref int index, char c)
+    {
+        if (index >= json.Length || json[index] != c)
+            throw new FormatException($"Expected '{c}' at {index}.");
+        index++;
+    }
+
+    private static void SkipWhitespace(string json, ref int index)
+    {
+        while (index < json.Length && char.IsWhiteSpace(json[index])) index++;
+    }
+}
@@ -32,4 +32,11 @@ public class PlaceableItemSO : ScriptableObject
         "When disabled, rotation is purely world-Y and the surface normal is only used " +
         "to position the pivot point.")]
     public bool snapRotationToSurface = true;
+
+    [Header("Snapping")]
+    [Tooltip("Grid the pivot snaps to along the surface. Socket snaps take priority over the grid.")]
+    public PlacementGridMode gridMode = PlacementGridMode.None;
+
+    [Tooltip("Grid cell size per axis, in meters. Axes at 0 are left free.")]
+    public Vector3 gridCellSize = new Vector3(0.5f, 0.5f, 0.5f);
 }
@@ -3,6 +3,7 @@ using UnityEngine;
 // Data class used for saving/loading PlacedObject state. 
 // Captured by PlacedObject.CaptureState() and used by ObjectPlacementManager to restore objects on load.
 [System.Serializable]
+[SaveSchema(1)]
 public class PlacedObjectSaveData
 {
     public string prefabID;
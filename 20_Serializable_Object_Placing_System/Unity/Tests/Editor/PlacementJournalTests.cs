@@ -0,0 +1,236 @@
+using System;
+using System.Collections.Generic;
+using System.Text;
+using NUnit.Framework;
+using UnityEngine;
+
+// Random place / move / remove / batch / undo / redo sequences against an in-memory stand-in for the scene:
+// every undo and redo must land on the expected state, and the recovery log must replay to the same world.
+public class PlacementJournalTests
+{
+    private class FakeWorld : IPlacementJournalTarget
+    {
+        public struct State
+        {
+            public string prefabID;
+            public Vector3 position;
+            public Quaternion rotation;
+            public Vector3 scale;
+            public bool removed;
+        }
+
+        public readonly SortedDictionary<string, State> objects = new SortedDictionary<string, State>(StringComparer.Ordinal);
+
+        public void Apply(in PlacementCommand c)
+        {
+            objects.TryGetValue(c.id, out State state);
+            bool exists = objects.ContainsKey(c.id);
+
+            switch (c.type)
+            {
+                case PlacementCommandType.Place:
+                    objects[c.id] = new State { prefabID = c.prefabID, position = c.toPosition, rotation = c.toRotation, scale = c.scale };
+                    break;
+                case PlacementCommandType.Delete:
+                    objects.Remove(c.id);
+                    break;
+                case PlacementCommandType.Transform:
+                    if (!exists) break;
+                    state.position = c.toPosition;
+                    state.rotation = c.toRotation;
+                    objects[c.id] = state;
+                    break;
+                case PlacementCommandType.Remove:
+                    if (!exists) break;
+                    state.removed = true;
+                    objects[c.id] = state;
+                    break;
+                case PlacementCommandType.Restore:
+                    objects[c.id] = exists
+                        ? new State { prefabID = state.prefabID, position = state.position, rotation = state.rotation, scale = state.scale }
+                        : new State { prefabID = c.prefabID, position = c.toPosition, rotation = c.toRotation, scale = c.scale };
+                    break;
+            }
+        }
+
+        public string Snapshot()
+        {
+            var builder = new StringBuilder();
+            foreach (KeyValuePair<string, State> pair in objects)
+            {
+                State s = pair.Value;
+                builder.Append(pair.Key).Append('|').Append(s.prefabID).Append('|')
+                       .Append(s.position.x.ToString("R")).Append(',').Append(s.position.y.ToString("R")).Append(',').Append(s.position.z.ToString("R")).Append('|')
+                       .Append(s.rotation.x.ToString("R")).Append(',').Append(s.rotation.y.ToString("R")).Append(',')
+                       .Append(s.rotation.z.ToString("R")).Append(',').Append(s.rotation.w.ToString("R")).Append('|')
+                       .Append(s.removed ? '1' : '0').Append(';');
+            }
+            return builder.ToString();
+        }
+    }
+
+    [TestCase(7, 200, 60)]
+    public void RandomSequences_UndoRedoAndRecoveryMatch(int seed, int sequences, int length)
+    {
+        var random = new System.Random(seed);
+        int undoFailures = 0, redoFailures = 0, replayFailures = 0, roundTripFailures = 0;
+        int totalMerges = 0;
+
+        for (int sequence = 0; sequence < sequences; sequence++)
+        {
+            var world = new FakeWorld();
+            var journal = new PlacementJournal(world) { MaxMemoryBytes = 0 };
+            var done = new List<(string before, string after)>();
+            var undone = new List<(string before, string after)>();
+            string initial = world.Snapshot();
+            double time = 0;
+            int nextId = 0;
+
+            for (int op = 0; op < length; op++)
+            {
+                int roll = random.Next(100);
+                time += random.Next(2) == 0 ? 0.3 : 2.0;
+
+                if (roll < 70)
+                {
+                    string before = world.Snapshot();
+                    int undoCount = journal.UndoCount;
+                    bool batch = roll >= 60;
+
+                    if (batch) journal.BeginBatch("Batch", time);
+                    int count = batch ? random.Next(2, 5) : 1;
+                    int recorded = 0;
+                    for (int i = 0; i < count; i++)
+                        if (RandomOperation(world, journal, random, roll < 60 ? roll : random.Next(60), time, ref nextId)) recorded++;
+                    if (batch) journal.EndBatch();
+
+                    if (recorded == 0) continue; // Nothing left to move or remove
+
+                    undone.Clear();
+                    if (journal.UndoCount > undoCount)
+                        done.Add((before, world.Snapshot()));
+                    else if (done.Count > 0)
+                    {
+                        done[done.Count - 1] = (done[done.Count - 1].before, world.Snapshot());
+                        totalMerges++;
+                    }
+                }
+                else if (roll < 85)
+                {
+                    bool undid = journal.Undo();
+                    if (undid != done.Count > 0) { undoFailures++; continue; }
+                    if (!undid) continue;
+
+                    var top = done[done.Count - 1];
+                    done.RemoveAt(done.Count - 1);
+                    undone.Add(top);
+                    if (world.Snapshot() != top.before) undoFailures++;
+                }
+                else
+                {
+                    bool redid = journal.Redo();
+                    if (redid != undone.Count > 0) { redoFailures++; continue; }
+                    if (!redid) continue;
+
+                    var top = undone[undone.Count - 1];
+                    undone.RemoveAt(undone.Count - 1);
+                    done.Add(top);
+                    if (world.Snapshot() != top.after) redoFailures++;
+                }
+            }
+
+            // Crash recovery: the serialized log replayed on the initial world rebuilds the session
+            string final = world.Snapshot();
+            var recovered = new FakeWorld();
+            new PlacementJournal(recovered).Replay(journal.SerializeRecoveryLog());
+            if (recovered.Snapshot() != final) replayFailures++;
+
+            while (journal.Undo()) { }
+            if (world.Snapshot() != initial) roundTripFailures++;
+            while (journal.Redo()) { }
+            if (world.Snapshot() != final) roundTripFailures++;
+        }
+
+        Assert.AreEqual(0, undoFailures, "undo did not restore the previous state");
+        Assert.AreEqual(0, redoFailures, "redo did not restore the next state");
+        Assert.AreEqual(0, replayFailures, "recovery log replayed to a different world");
+        Assert.AreEqual(0, roundTripFailures, "undo all / redo all did not round-trip");
+        Assert.Greater(totalMerges, 0, "no consecutive nudges were merged");
+    }
+
+    [Test]
+    public void MemoryCap_KeepsTheNewestSteps()
+    {
+        const long budget = 8 * 1024;
+        var world = new FakeWorld();
+        var journal = new PlacementJournal(world) { MaxMemoryBytes = budget };
+        for (int i = 0; i < 500; i++)
+        {
+            PlacementCommand place = PlacementCommand.Place($"cap{i}", "Crate", new Vector3(i, 0f, 0f), Quaternion.identity, Vector3.one);
+            world.Apply(place);
+            journal.Record(place, i * 10.0);
+        }
+
+        int kept = journal.UndoCount;
+        Assert.Less(kept, 500);
+        Assert.LessOrEqual(journal.MemoryBytes, budget);
+        Assert.AreEqual(500 - kept, journal.DroppedSteps);
+
+        // The rest still undo cleanly, down to the oldest kept step
+        while (journal.Undo()) { }
+        Assert.AreEqual(500 - kept, world.objects.Count);
+    }
+
+    [Test]
+    public void QuickNudges_UndoAsOneStep()
+    {
+        var world = new FakeWorld();
+        var journal = new PlacementJournal(world);
+        PlacementCommand crate = PlacementCommand.Place("nudge", "Crate", Vector3.zero, Quaternion.identity, Vector3.one);
+        world.Apply(crate);
+        journal.Record(crate, 0.0);
+
+        for (int i = 1; i <= 10; i++)
+        {
+            PlacementCommand nudge = PlacementCommand.Move("nudge", "Crate", new Vector3(i - 1, 0f, 0f), Quaternion.identity, new Vector3(i, 0f, 0f), Quaternion.identity, Vector3.one);
+            world.Apply(nudge);
+            journal.Record(nudge, 10.0 + i * 0.1);
+        }
+
+        journal.Undo();
+        Assert.AreEqual(1, journal.UndoCount);
+        Assert.AreEqual(Vector3.zero, world.objects["nudge"].position);
+        Assert.AreEqual(2, journal.RecoveryCount, "moves of the same object are compacted in the recovery log");
+    }
+
+    // 0-24 place, 25-49 move (nudge), 50-59 remove. Returns false when there was nothing to move or remove.
+    private static bool RandomOperation(FakeWorld world, PlacementJournal journal, System.Random random, int roll, double time, ref int nextId)
+    {
+        if (roll < 25 || world.objects.Count == 0)
+        {
+            PlacementCommand place = PlacementCommand.Place($"obj{nextId++}", random.Next(2) == 0 ? "Crate" : "Lamp",
+                new Vector3(random.Next(-20, 20), 0f, random.Next(-20, 20)), Quaternion.Euler(0f, random.Next(8) * 45f, 0f), Vector3.one);
+            world.Apply(place);
+            journal.Record(place, time);
+            return true;
+        }
+
+        // Pick a live object deterministically from the sorted ids
+        var live = new List<string>();
+        foreach (KeyValuePair<string, FakeWorld.State> pair in world.objects)
+            if (!pair.Value.removed) live.Add(pair.Key);
+        if (live.Count == 0) return false;
+
+        string id = live[random.Next(live.Count)];
+        FakeWorld.State state = world.objects[id];
+
+        PlacementCommand command = roll < 50
+            ? PlacementCommand.Move(id, state.prefabID, state.position, state.rotation,
+                state.position + new Vector3(random.Next(-1, 2) * 0.25f, 0f, random.Next(-1, 2) * 0.25f), state.rotation, state.scale)
+            : PlacementCommand.Remove(id, state.prefabID, state.position, state.rotation, state.scale);
+
+        world.Apply(command);
+        journal.Record(command, time);
+        return true;
+    }
+}
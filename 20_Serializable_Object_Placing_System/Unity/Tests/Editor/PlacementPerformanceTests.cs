@@ -0,0 +1,77 @@
+using System.Collections.Generic;
+using NUnit.Framework;
+using Unity.PerformanceTesting;
+using UnityEngine;
+
+// Times what grows with the placed count on a 5000 crate floor: registering a crate in the spatial index and snap solver,
+// then the preview's per-tick snap solve and overlap query, alternating between crate tops (socket snaps) and the gaps
+// between crates. Handles only, like the other placement tests. Compared with PerfBaselines/Placement.json.
+public class PlacementPerformanceTests
+{
+    private const int PlacedCount = 5000;
+    private const int PreviewTicks = 2000;
+    private const float CellSize = 2f;
+    private const float Spacing = 2.1f; // Crate size * 2 + 0.1, as the manager's cell size expects
+
+    private static readonly Bounds UnitBounds = new Bounds(Vector3.zero, Vector3.one);
+    private static readonly PlacementSocketData[] CrateSockets =
+    {
+        new PlacementSocketData { name = "Top", type = "Top", accepts = new[] { "Bottom" }, localPosition = new Vector3(0f, 0.5f, 0f), localNormal = Vector3.up },
+        new PlacementSocketData { name = "Bottom", type = "Bottom", accepts = new[] { "Top" }, localPosition = new Vector3(0f, -0.5f, 0f), localNormal = Vector3.down }
+    };
+
+    [Test, Performance]
+    public void PreviewTick_With5000Placed()
+    {
+        var index = new PlacementSpatialIndex(CellSize);
+        var solver = new PlacementSnapSolver(index);
+        int side = Mathf.CeilToInt(Mathf.Sqrt(PlacedCount));
+
+        int placed = 0;
+        Measure.Method(() =>
+            {
+                var center = new Vector3(placed % side * Spacing, 0.5f, placed / side * Spacing);
+                int handle = index.Add(PlacementBox.FromLocalBounds(UnitBounds, center, Quaternion.identity, Vector3.one));
+                solver.SetSockets(handle, CrateSockets, Matrix4x4.TRS(center, Quaternion.identity, Vector3.one));
+                placed++;
+            })
+            .WarmupCount(0)
+            .MeasurementCount(PlacedCount)
+            .SampleGroup("AddPlaced")
+            .Run();
+
+        var request = new PlacementSnapRequest
+        {
+            rotation = Quaternion.identity,
+            scale = Vector3.one,
+            surfaceNormal = Vector3.up,
+            localBounds = UnitBounds,
+            sockets = CrateSockets,
+            gridOrigin = Pose.identity,
+            ignoreHandle = -1
+        };
+        var guides = new List<PlacementGuide>();
+        var candidates = new List<int>(64);
+
+        int tick = 0;
+        Measure.Method(() =>
+            {
+                // Even ticks rest on a crate, odd ones on the floor halfway to the next
+                int cell = (tick * 7919) % PlacedCount;
+                bool onTop = (tick & 1) == 0;
+                request.position = new Vector3((cell % side + (onTop ? 0f : 0.5f)) * Spacing, onTop ? 1.55f : 0.5f, cell / side * Spacing);
+
+                PlacementSnapResult result = solver.Solve(request, guides);
+                // Shrunk like the manager's preview box, so resting on a crate is no overlap
+                index.Query(PlacementBox.FromLocalBounds(UnitBounds, result.position, result.rotation, Vector3.one, 0.95f), candidates);
+                tick++;
+            })
+            .WarmupCount(10)
+            .MeasurementCount(PreviewTicks)
+            .SampleGroup($"PreviewTick_{PlacedCount}Placed")
+            .GC()
+            .Run();
+
+        PerfBaseline.AssertWithin("Placement");
+    }
+}
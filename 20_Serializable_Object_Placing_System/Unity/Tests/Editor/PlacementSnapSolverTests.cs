@@ -0,0 +1,158 @@
+using System.Collections.Generic;
+using NUnit.Framework;
+using UnityEngine;
+
+// Headless checks of every snap kind and of tie-breaking: the solver only sees boxes and sockets registered by handle.
+public class PlacementSnapSolverTests
+{
+    private static readonly Bounds UnitBounds = new Bounds(Vector3.zero, Vector3.one);
+
+    private static readonly PlacementSocketData Top = new PlacementSocketData { name = "Top", type = "Top", accepts = new[] { "Bottom" }, localPosition = new Vector3(0f, 0.5f, 0f), localNormal = Vector3.up };
+    private static readonly PlacementSocketData Bottom = new PlacementSocketData { name = "Bottom", type = "Bottom", accepts = new[] { "Top" }, localPosition = new Vector3(0f, -0.5f, 0f), localNormal = Vector3.down };
+    private static readonly PlacementSocketData[] CrateSockets = { Top, Bottom };
+
+    private PlacementSpatialIndex index;
+    private PlacementSnapSolver solver;
+    private PlacementSnapRequest request;
+
+    [SetUp]
+    public void SetUp()
+    {
+        index = new PlacementSpatialIndex(2f);
+        solver = new PlacementSnapSolver(index);
+        request = new PlacementSnapRequest
+        {
+            rotation = Quaternion.identity,
+            scale = Vector3.one,
+            surfaceNormal = Vector3.up,
+            localBounds = UnitBounds,
+            gridCellSize = new Vector3(0.5f, 0.5f, 0.5f),
+            gridOrigin = Pose.identity,
+            ignoreHandle = -1
+        };
+    }
+
+    private int AddCrate(Vector3 center)
+    {
+        int handle = index.Add(new PlacementBox(center, Vector3.one * 0.5f, Quaternion.identity));
+        solver.SetSockets(handle, CrateSockets, Matrix4x4.TRS(center, Quaternion.identity, Vector3.one));
+        return handle;
+    }
+
+    private static void AssertPosition(Vector3 expected, Vector3 actual)
+    {
+        Assert.That((expected - actual).sqrMagnitude, Is.LessThan(1e-6f), $"expected {expected}, got {actual}");
+    }
+
+    [Test]
+    public void WorldGrid_SnapsAlongTheSurfaceOnly()
+    {
+        request.gridMode = PlacementGridMode.World;
+        request.position = new Vector3(0.26f, 0.5f, 0.74f);
+
+        PlacementSnapResult result = solver.Solve(request);
+        Assert.AreEqual(PlacementSnapKind.Grid, result.kind);
+        AssertPosition(new Vector3(0.5f, 0.5f, 0.5f), result.position);
+    }
+
+    [Test]
+    public void LocalGrid_FollowsTheSurfaceObject()
+    {
+        request.gridMode = PlacementGridMode.Local;
+        request.gridOrigin = new Pose(new Vector3(10f, 0f, 0f), Quaternion.Euler(0f, 90f, 0f));
+        request.position = new Vector3(10.2f, 0.5f, -0.9f);
+
+        PlacementSnapResult result = solver.Solve(request);
+        Assert.AreEqual(PlacementSnapKind.Grid, result.kind);
+        AssertPosition(new Vector3(10f, 0.5f, -1f), result.position);
+    }
+
+    [Test]
+    public void Socket_CrateStacksOnTheCrateBelow()
+    {
+        int crate = AddCrate(new Vector3(0f, 0.5f, 0f));
+        request.sockets = CrateSockets;
+        request.position = new Vector3(0.1f, 1.55f, 0.05f);
+
+        PlacementSnapResult result = solver.Solve(request);
+        Assert.AreEqual(PlacementSnapKind.Socket, result.kind);
+        Assert.AreEqual(crate, result.targetHandle);
+        Assert.AreEqual(1, result.socketIndex);
+        AssertPosition(new Vector3(0f, 1.5f, 0f), result.position);
+    }
+
+    [Test]
+    public void Socket_WallPieceConnectsEdgeToEdgeAndStraightens()
+    {
+        var left = new PlacementSocketData { name = "Left", type = "Edge", localPosition = new Vector3(-1f, 0f, 0f), localNormal = Vector3.left };
+        var right = new PlacementSocketData { name = "Right", type = "Edge", localPosition = new Vector3(1f, 0f, 0f), localNormal = Vector3.right };
+        var wallSockets = new[] { left, right };
+
+        int wall = index.Add(new PlacementBox(new Vector3(0f, 1f, 0f), new Vector3(1f, 1f, 0.1f), Quaternion.identity));
+        solver.SetSockets(wall, wallSockets, Matrix4x4.TRS(new Vector3(0f, 1f, 0f), Quaternion.identity, Vector3.one));
+
+        request.sockets = wallSockets;
+        request.localBounds = new Bounds(Vector3.zero, new Vector3(2f, 2f, 0.2f));
+        request.position = new Vector3(2.2f, 1f, 0.1f);
+        request.rotation = Quaternion.Euler(0f, 5f, 0f);
+
+        PlacementSnapResult result = solver.Solve(request);
+        Assert.AreEqual(PlacementSnapKind.Socket, result.kind);
+        Assert.AreEqual(0, result.socketIndex);
+        Assert.AreEqual(1, result.targetSocketIndex);
+        AssertPosition(new Vector3(2f, 1f, 0f), result.position);
+        Assert.That(Quaternion.Angle(result.rotation, Quaternion.identity), Is.LessThan(0.01f));
+    }
+
+    [Test]
+    public void Socket_EqualDistancesPickTheLowestHandle()
+    {
+        // Sockets registered in reverse handle order, so neither registration nor query order decides
+        int first = index.Add(new PlacementBox(new Vector3(-0.2f, 0.5f, 0f), Vector3.one * 0.5f, Quaternion.identity));
+        int second = index.Add(new PlacementBox(new Vector3(0.2f, 0.5f, 0f), Vector3.one * 0.5f, Quaternion.identity));
+        solver.SetSockets(second, CrateSockets, Matrix4x4.TRS(new Vector3(0.2f, 0.5f, 0f), Quaternion.identity, Vector3.one));
+        solver.SetSockets(first, CrateSockets, Matrix4x4.TRS(new Vector3(-0.2f, 0.5f, 0f), Quaternion.identity, Vector3.one));
+
+        request.sockets = CrateSockets;
+        request.position = new Vector3(0f, 1.5f, 0f);
+
+        PlacementSnapResult result = solver.Solve(request);
+        PlacementSnapResult again = solver.Solve(request);
+        Assert.AreEqual(Mathf.Min(first, second), result.targetHandle);
+        Assert.AreEqual(result.position, again.position);
+        Assert.AreEqual(result.rotation, again.rotation);
+        Assert.AreEqual(result.targetHandle, again.targetHandle);
+    }
+
+    [Test]
+    public void Socket_IgnoresTheObjectBeingEdited()
+    {
+        int crate = AddCrate(new Vector3(0f, 0.5f, 0f));
+        request.sockets = CrateSockets;
+        request.position = new Vector3(0.1f, 1.55f, 0.05f);
+        request.ignoreHandle = crate;
+
+        Assert.AreEqual(PlacementSnapKind.None, solver.Solve(request).kind);
+    }
+
+    [Test]
+    public void Guide_AlignsToTheNeighbourWithinTolerance()
+    {
+        int neighbour = index.Add(new PlacementBox(new Vector3(3f, 0.5f, 0f), Vector3.one * 0.5f, Quaternion.identity));
+        var guides = new List<PlacementGuide>();
+
+        request.position = new Vector3(1f, 0.5f, 0.06f);
+        PlacementSnapResult result = solver.Solve(request, guides);
+        Assert.AreEqual(PlacementSnapKind.Guide, result.kind);
+        Assert.AreEqual(neighbour, result.targetHandle);
+        AssertPosition(new Vector3(1f, 0.5f, 0f), result.position);
+        Assert.AreEqual(1, guides.Count);
+        Assert.AreEqual(2, guides[0].axis);
+        Assert.AreEqual(guides[0].to.z, guides[0].from.z, 1e-5f);
+
+        request.position = new Vector3(1f, 0.5f, 0.3f);
+        result = solver.Solve(request, guides);
+        Assert.AreEqual(PlacementSnapKind.None, result.kind);
+        Assert.AreEqual(0, guides.Count);
+    }
+}
@@ -0,0 +1,122 @@
+using System.Collections.Generic;
+using NUnit.Framework;
+using UnityEngine;
+
+// Grid queries against a brute force scan on 5000 synthetic boxes, roughly a furnished 100 x 100 m floor with some stacking.
+// Handles only, no GameObjects or physics involved.
+public class PlacementSpatialIndexTests
+{
+    private const int BoxCount = 5000;
+    private const int ProbeCount = 2000;
+    private const float CellSize = 2f;
+
+    private PlacementBox[] boxes;
+    private PlacementBox[] probes;
+    private PlacementSpatialIndex index;
+
+    [SetUp]
+    public void SetUp()
+    {
+        var random = new System.Random(1234);
+        float Range(float min, float max) => min + (float)random.NextDouble() * (max - min);
+        PlacementBox RandomBox(float minExtent, float maxExtent) => new PlacementBox(
+            new Vector3(Range(-50f, 50f), Range(0f, 3f), Range(-50f, 50f)),
+            new Vector3(Range(minExtent, maxExtent), Range(minExtent, maxExtent), Range(minExtent, maxExtent)),
+            Quaternion.Euler(0f, Range(0f, 360f), 0f));
+
+        boxes = new PlacementBox[BoxCount];
+        for (int i = 0; i < BoxCount; i++) boxes[i] = RandomBox(0.1f, 1.2f);
+
+        probes = new PlacementBox[ProbeCount];
+        for (int i = 0; i < ProbeCount; i++) probes[i] = RandomBox(0.2f, 1f);
+
+        index = new PlacementSpatialIndex(CellSize);
+        for (int i = 0; i < BoxCount; i++) index.Add(boxes[i]);
+    }
+
+    private int BruteForce(in PlacementBox probe, int ignore = -1)
+    {
+        int hits = 0;
+        for (int j = 0; j < BoxCount; j++)
+            if (j != ignore && index.IsValid(j) && index.GetBox(j).Intersects(probe)) hits++;
+        return hits;
+    }
+
+    [Test]
+    public void Query_MatchesBruteForce()
+    {
+        var results = new List<int>();
+        int total = 0;
+        for (int i = 0; i < ProbeCount; i++)
+        {
+            Assert.AreEqual(BruteForce(probes[i]), index.Query(probes[i], results), $"probe {i}");
+            Assert.AreEqual(results.Count, new HashSet<int>(results).Count, $"probe {i} reported a handle twice");
+            total += results.Count;
+        }
+
+        Assert.Greater(total, 0, "the probes never hit anything");
+    }
+
+    [Test]
+    public void Query_MatchesBruteForceAfterMovingEveryBox()
+    {
+        // Moving every box once exercises the relink path
+        for (int i = 0; i < BoxCount; i++)
+        {
+            PlacementBox moved = boxes[i];
+            moved.center += new Vector3(0.25f * CellSize, 0f, 0.25f * CellSize);
+            index.Move(i, moved);
+        }
+
+        var results = new List<int>();
+        for (int i = 0; i < ProbeCount; i++)
+            Assert.AreEqual(BruteForce(probes[i]), index.Query(probes[i], results), $"probe {i}");
+    }
+
+    [Test]
+    public void Query_SkipsIgnoredAndRemovedHandles()
+    {
+        var results = new List<int>();
+        int probe = System.Array.FindIndex(probes, p => index.Query(p, results) > 1);
+        Assume.That(probe, Is.GreaterThanOrEqualTo(0), "no probe with two hits");
+
+        int ignored = results[0];
+        Assert.AreEqual(BruteForce(probes[probe], ignored), index.Query(probes[probe], results, ignored));
+        CollectionAssert.DoesNotContain(results, ignored);
+
+        index.Remove(ignored);
+        Assert.IsFalse(index.IsValid(ignored));
+        Assert.AreEqual(BruteForce(probes[probe]), index.Query(probes[probe], results));
+        Assert.AreEqual(BoxCount - 1, index.Count);
+
+        // Handles are recycled
+        Assert.AreEqual(ignored, index.Add(boxes[ignored]));
+    }
+
+    [Test]
+    public void Query_DoesNotAllocate()
+    {
+        var results = new List<int>(256);
+        index.Query(probes[0], results); // Warm up
+
+        long allocated = System.GC.GetAllocatedBytesForCurrentThread();
+        for (int i = 0; i < ProbeCount; i++)
+            index.Query(probes[i], results);
+        allocated = System.GC.GetAllocatedBytesForCurrentThread() - allocated;
+
+        Assert.AreEqual(0, allocated);
+    }
+
+    [Test]
+    public void Intersects_RotatedBoxes()
+    {
+        var a = new PlacementBox(Vector3.zero, new Vector3(1f, 0.5f, 0.1f), Quaternion.identity);
+        var b = new PlacementBox(new Vector3(0f, 0f, 0.5f), new Vector3(1f, 0.5f, 0.1f), Quaternion.identity);
+        Assert.IsFalse(a.Intersects(b));
+
+        // Turned a quarter, the second plank reaches back across the first one
+        b.rotation = Quaternion.Euler(0f, 90f, 0f);
+        Assert.IsTrue(a.Intersects(b));
+        Assert.IsTrue(b.Intersects(a));
+    }
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EPlacementGridMode.generated.h"
+
+// Grid snapping mode of a placeable item. World snaps to a grid anchored at the world origin, Local to a grid aligned with the surface actor that was hit.
+UENUM(BlueprintType)
+enum class EPlacementGridMode : uint8
+{
+	None   UMETA(DisplayName = "None"),
+	World  UMETA(DisplayName = "World"),
+	Local  UMETA(DisplayName = "Local (Surface Actor)"),
+};
@@ -1,6 +1,7 @@
 #include "ObjectPlacementManager.h"
 #include "Camera/CameraComponent.h"
 #include "Components/MeshComponent.h"
+#include "DrawDebugHelpers.h"
 #include "Engine/OverlapResult.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
@@ -11,6 +12,7 @@
 #include "Mechanics_Test_LVN/SaveGameData.h"
 #include "Mechanics_Test_LVN/SaveDataEntry.h"
 #include "Mechanics_Test_LVN/GUIDComponent.h"
+#include "Mechanics_Test_LVN/SaveManagerSubsystem.h"
 #include "PlacedObjectSaveData.h"
 #include "JsonObjectConverter.h"
 
@@ -22,6 +24,30 @@ UObjectPlacementManager::UObjectPlacementManager()
 void UObjectPlacementManager::BeginPlay()
 {
 	Super::BeginPlay();
+	SpatialIndex.Reset(SpatialCellSize);
+
+	Journal.MaxMemoryBytes = UndoMemoryBudgetKB * 1024LL;
+	Journal.MergeWindow    = NudgeMergeWindow;
+
+	// The save subsystem mirrors the recovery log to disk for crash recovery
+	if (UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr)
+		if (USaveManagerSubsystem* Saves = GameInstance->GetSubsystem<USaveManagerSubsystem>())
+			Journal.OnRecoveryLogChanged.AddUObject(Saves, &USaveManagerSubsystem::WritePlacementJournal);
+}
+
+void UObjectPlacementManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Leaving the level without saving discards the changes, so the recovery log goes with them
+	Journal.Clear();
+	Journal.OnRecoveryLogChanged.Clear();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+static FGuid GetPlacedGUID(const AActor* Actor)
+{
+	const UGUIDComponent* GUIDComp = Actor ? Actor->FindComponentByClass<UGUIDComponent>() : nullptr;
+	return GUIDComp ? GUIDComp->GUID : FGuid();
 }
 
 void UObjectPlacementManager::TickComponent(float DeltaTime, ELevelTick TickType,
@@ -295,52 +321,92 @@ EPlacementSurfaceType UObjectPlacementManager::ClassifySurface(const FVector& No
 	return EPlacementSurfaceType::Wall;
 }
 
-bool UObjectPlacementManager::IsPreviewOverlapping() const
+// The spatial index answers first; physics only runs to confirm when the index found candidates
+bool UObjectPlacementManager::IsPreviewOverlapping()
 {
-    if (!PreviewActor || !GetWorld()) return false;
-
-    FBox LocalCombinedBox(EForceInit::ForceInitToZero);
-    bool bHasAny = false;
-
-    const FTransform ActorWorldInverse = PreviewActor->GetActorTransform().Inverse();
-
-    for (UMeshComponent* Mesh : PreviewMeshes)
-    {
-        if (!Mesh) continue;
+	if (!PreviewActor || !GetWorld()) return false;
 
-        const FBox ComponentLocalBox = Mesh->CalcLocalBounds().GetBox();
+	// Shrunk so the resting surface and touching neighbours don't count as an overlap
+	const FPlacementBox Box = GetPreviewBox(0.85f);
 
-        const FTransform ComponentToActorLocal =
-            Mesh->GetComponentTransform() * ActorWorldInverse;
+	if (SpatialIndex.Query(Box, OverlapCandidates, GetIgnoredHandle()) == 0) return false;
 
-        LocalCombinedBox += ComponentLocalBox.TransformBy(ComponentToActorLocal);
-        bHasAny = true;
-    }
+	for (int32 i = OverlapCandidates.Num() - 1; i >= 0; --i)
+	{
+		// Actors destroyed behind the manager's back are dropped lazily
+		const int32 Handle = OverlapCandidates[i];
+		if (SpatialIndex.GetOwner(Handle)) continue;
 
-    if (!bHasAny)
-    {
-        LocalCombinedBox = FBox::BuildAABB(FVector::ZeroVector, FVector(50.f));
-    }
+		SnapSolver.RemoveSockets(Handle);
+		SpatialIndex.Remove(Handle);
+		OverlapCandidates.RemoveAtSwap(i);
+	}
 
-    const FVector WorldCenter =
-        PreviewActor->GetActorTransform().TransformPosition(LocalCombinedBox.GetCenter());
+	if (OverlapCandidates.Num() == 0 || !bExactOverlapCheck) return OverlapCandidates.Num() > 0;
 
-    const FVector HalfExt = LocalCombinedBox.GetExtent() * 0.85f;
+	FCollisionQueryParams Params;
+	Params.AddIgnoredActor(GetOwner());
+	Params.AddIgnoredActor(PreviewActor);
+	if (TargetedActor) Params.AddIgnoredActor(TargetedActor);
+
+	OverlapResults.Reset();
+	GetWorld()->OverlapMultiByChannel(
+		OverlapResults,
+		Box.Center,
+		Box.Rotation,
+		PlacedObjectChannel,
+		FCollisionShape::MakeBox(Box.Extent), Params);
+
+	// Only the candidates' own primitives count, anything else on the channel doesn't block
+	for (const FOverlapResult& Result : OverlapResults)
+	{
+		const UPlacedObjectComponent* POC = Result.GetActor() ? Result.GetActor()->FindComponentByClass<UPlacedObjectComponent>() : nullptr;
+		if (POC && OverlapCandidates.Contains(POC->SpatialHandle))
+			return true;
+	}
+	return false;
+}
 
-    FCollisionShape Box = FCollisionShape::MakeBox(HalfExt);
+FPlacementBox UObjectPlacementManager::GetPreviewBox(float Shrink) const
+{
+	return FPlacementBox::FromLocalBox(PreviewLocalBox, PreviewActor->GetActorTransform(), Shrink);
+}
 
-    FCollisionQueryParams Params;
-    Params.AddIgnoredActor(GetOwner());
-    Params.AddIgnoredActor(PreviewActor);
+// The actor being repositioned must not block or snap to its own old pose
+int32 UObjectPlacementManager::GetIgnoredHandle() const
+{
+	if (CurrentMode != EPlacementMode::Editing || !TargetedActor) return INDEX_NONE;
 
-    TArray<FOverlapResult> Overlaps;
+	const UPlacedObjectComponent* POC = TargetedActor->FindComponentByClass<UPlacedObjectComponent>();
+	return POC ? POC->SpatialHandle : INDEX_NONE;
+}
 
-    return GetWorld()->OverlapMultiByChannel(
-        Overlaps,
-        WorldCenter,
-        PreviewActor->GetActorQuat(),
-        PlacedObjectChannel,
-        Box, Params);
+// Runs the snap solver on the surface aligned preview pose: sockets first, then the item's grid, then alignment guides
+void UObjectPlacementManager::ApplySnapping(const FHitResult& Hit, UPlaceableItemData* Item)
+{
+	SnapSolver.SocketRadius   = SocketSnapRadius;
+	SnapSolver.GuideTolerance = GuideTolerance;
+	SnapSolver.GuideRadius    = GuideRadius;
+
+	FPlacementSnapRequest Request;
+	Request.Location      = PreviewActor->GetActorLocation();
+	Request.Rotation      = PreviewActor->GetActorQuat();
+	Request.Scale         = PreviewActor->GetActorScale3D();
+	Request.SurfaceNormal = Hit.ImpactNormal;
+	Request.LocalBox      = PreviewLocalBox;
+	Request.Sockets       = PreviewSockets;
+	Request.GridMode      = Item->GridMode;
+	Request.GridCellSize  = Item->GridCellSize;
+	Request.GridOrigin    = Hit.GetActor() ? Hit.GetActor()->GetActorTransform() : FTransform::Identity;
+	Request.IgnoreHandle  = GetIgnoredHandle();
+
+	const FPlacementSnapResult Snap = SnapSolver.Solve(Request, &Guides);
+	PreviewActor->SetActorLocationAndRotation(Snap.Location, Snap.Rotation);
+
+	if (!bDrawAlignmentGuides) return;
+
+	for (const FPlacementGuide& Guide : Guides)
+		DrawDebugLine(GetWorld(), Guide.From, Guide.To, FColor::Cyan, false, -1.f, 0, 1.5f);
 }
 
 void UObjectPlacementManager::SpawnPreview(UPlaceableItemData* Item)
@@ -372,6 +438,10 @@ void UObjectPlacementManager::SpawnPreview(UPlaceableItemData* Item)
 	for (UMeshComponent* Mesh : Meshes)
 		if (Mesh) PreviewMeshes.Add(Mesh);
 
+	// Measured once per preview, every tick only transforms it
+	PreviewLocalBox = FPlacementSpatialIndex::MeasureLocalBox(PreviewActor);
+	UPlacementSocketComponent::Collect(PreviewActor, PreviewSockets);
+
 	bLastValidState = false;
 	SetPreviewMaterial(HoverInvalidMaterial);
 }
@@ -384,6 +454,8 @@ void UObjectPlacementManager::DestroyPreview()
 		PreviewActor = nullptr;
 	}
 	PreviewMeshes.Empty();
+	PreviewSockets.Reset();
+	Guides.Reset();
 }
 
 void UObjectPlacementManager::PositionAndRotatePreview(bool bValidHit,
@@ -438,31 +510,19 @@ void UObjectPlacementManager::PositionAndRotatePreview(bool bValidHit,
 	PreviewActor->SetActorLocationAndRotation(DisplayHit.ImpactPoint, NewRotation);
 	PreviewActor->MarkComponentsRenderStateDirty();
 
-	FBox Bounds(EForceInit::ForceInitToZero);
-	bool bHasAny = false;
-
-	for (UMeshComponent* Mesh : PreviewMeshes)
-	{
-		if (!Mesh) continue;
-		Bounds += Mesh->CalcBounds(Mesh->GetComponentTransform()).GetBox();
-		bHasAny = true;
-	}
-
-	if (!bHasAny) return;
+	if (PreviewMeshes.Num() == 0) return;
 
-	FVector BoundsCenter = Bounds.GetCenter();
-	FVector BoundsExtent = Bounds.GetExtent();
-	FVector Normal       = DisplayHit.ImpactNormal;
+	const FPlacementBox Box = GetPreviewBox();
+	FVector Normal          = DisplayHit.ImpactNormal;
 
-	float ExtentAlongNormal =
-		FMath::Abs(BoundsExtent.X * Normal.X) +
-		FMath::Abs(BoundsExtent.Y * Normal.Y) +
-		FMath::Abs(BoundsExtent.Z * Normal.Z);
+	float ExtentAlongNormal = Box.ExtentAlong(Normal);
 
-	float PivotToCenterAlongNormal = FVector::DotProduct(BoundsCenter - DisplayHit.ImpactPoint, Normal);
+	float PivotToCenterAlongNormal = FVector::DotProduct(Box.Center - DisplayHit.ImpactPoint, Normal);
 
 	float FinalOffset = ExtentAlongNormal - PivotToCenterAlongNormal;
 	PreviewActor->SetActorLocation(DisplayHit.ImpactPoint + Normal * FinalOffset);
+
+	if (bSnappingEnabled) ApplySnapping(DisplayHit, Item);
 }
 
 void UObjectPlacementManager::SetPreviewMaterial(UMaterialInterface* Mat)
@@ -523,9 +583,10 @@ void UObjectPlacementManager::RegisterPlacedActor(AActor* Actor, UPlaceableItemD
 
 	POC->Initialize(Item);
 
-	if (!Actor->FindComponentByClass<UGUIDComponent>())
+	UGUIDComponent* GUIDComp = Actor->FindComponentByClass<UGUIDComponent>();
+	if (!GUIDComp)
 	{
-		UGUIDComponent* GUIDComp = NewObject<UGUIDComponent>(Actor);
+		GUIDComp = NewObject<UGUIDComponent>(Actor);
 		GUIDComp->RegisterComponent();
 	}
 
@@ -535,6 +596,46 @@ void UObjectPlacementManager::RegisterPlacedActor(AActor* Actor, UPlaceableItemD
 		if (Prim) Prim->SetCollisionResponseToChannel(PlacedObjectChannel, ECR_Block);
 
 	PlacedActors.Add(Actor);
+	PlacedByGUID.Add(GUIDComp->GUID, Actor);
+
+	AddToIndex(POC);
+}
+
+void UObjectPlacementManager::AddToIndex(UPlacedObjectComponent* POC)
+{
+	AActor* Actor = POC ? POC->GetOwner() : nullptr;
+	if (!Actor) return;
+
+	if (POC->SpatialHandle != INDEX_NONE)
+	{
+		UpdateIndexedBox(POC);
+		return;
+	}
+
+	POC->SpatialHandle = SpatialIndex.Add(
+		FPlacementBox::FromLocalBox(POC->LocalBounds, Actor->GetActorTransform()), Actor);
+	SnapSolver.SetSockets(POC->SpatialHandle, POC->Sockets, Actor->GetActorTransform());
+	POC->OnMoved.AddUObject(this, &UObjectPlacementManager::UpdateIndexedBox);
+}
+
+void UObjectPlacementManager::UpdateIndexedBox(UPlacedObjectComponent* POC)
+{
+	if (!POC || !POC->GetOwner() || POC->SpatialHandle == INDEX_NONE) return;
+
+	SpatialIndex.Move(POC->SpatialHandle,
+		FPlacementBox::FromLocalBox(POC->LocalBounds, POC->GetOwner()->GetActorTransform()));
+	SnapSolver.SetSockets(POC->SpatialHandle, POC->Sockets, POC->GetOwner()->GetActorTransform());
+}
+
+void UObjectPlacementManager::RemoveFromIndex(AActor* Actor)
+{
+	UPlacedObjectComponent* POC = Actor ? Actor->FindComponentByClass<UPlacedObjectComponent>() : nullptr;
+	if (!POC || POC->SpatialHandle == INDEX_NONE) return;
+
+	SnapSolver.RemoveSockets(POC->SpatialHandle);
+	SpatialIndex.Remove(POC->SpatialHandle);
+	POC->SpatialHandle = INDEX_NONE;
+	POC->OnMoved.RemoveAll(this);
 }
 
 void UObjectPlacementManager::ClearTargetedActor()
@@ -568,6 +669,8 @@ void UObjectPlacementManager::CommitPlacement()
 	if (!Placed) return;
 
 	RegisterPlacedActor(Placed, SelectedItem);
+	Journal.Record(FPlacementCommand::Place(GetPlacedGUID(Placed), SelectedItem->PrefabID, Placed->GetActorTransform()),
+		FPlatformTime::Seconds(), FString::Printf(TEXT("Place %s"), *SelectedItem->DisplayName.ToString()));
 
 	UE_LOG(LogTemp, Log, TEXT("[ObjectPlacer] Placed: %s"),
 		*SelectedItem->DisplayName.ToString());
@@ -623,6 +726,14 @@ void UObjectPlacementManager::CommitEdit()
 	UPlacedObjectComponent* POC = Cast<UPlacedObjectComponent>(
 		TargetedActor->GetComponentByClass(UPlacedObjectComponent::StaticClass()));
 	if (POC) POC->RestoreMaterials();
+	UpdateIndexedBox(POC);
+
+	if (POC && POC->Definition)
+	{
+		Journal.Record(FPlacementCommand::Move(GetPlacedGUID(TargetedActor), POC->Definition->PrefabID,
+				POC->GetSnapshotPosition(), POC->GetSnapshotRotation(), TargetedActor->GetActorTransform()),
+			FPlatformTime::Seconds(), FString::Printf(TEXT("Move %s"), *POC->Definition->DisplayName.ToString()));
+	}
 
 	DestroyPreview();
 	RotationOffset = 0.f;
@@ -660,11 +771,14 @@ void UObjectPlacementManager::StageForRemoval(AActor* Actor)
 
 	UPlacedObjectComponent* POC = Cast<UPlacedObjectComponent>(
 		Actor->GetComponentByClass(UPlacedObjectComponent::StaticClass()));
-	if (POC) POC->MarkForRemoval(true);
+	if (POC) POC->RestoreMaterials();
 
-	Actor->SetActorHiddenInGame(true);
+	HideForRemoval(Actor);
 	TargetedActor = nullptr;
 
+	Journal.Record(FPlacementCommand::Remove(GetPlacedGUID(Actor), POC && POC->Definition ? POC->Definition->PrefabID : NAME_None,
+		Actor->GetActorTransform()), FPlatformTime::Seconds(), TEXT("Remove"));
+
 	FString Name = POC && POC->Definition
 		? POC->Definition->DisplayName.ToString()
 		: Actor->GetName();
@@ -684,16 +798,144 @@ void UObjectPlacementManager::PrepareForSave()
 			Actor->GetComponentByClass(UPlacedObjectComponent::StaticClass()));
 
 		if (POC && POC->IsMarkedForRemoval())
-		{
-			Actor->Destroy();
-			PlacedActors.RemoveAt(i);
-		}
+			DestroyPlacedActor(Actor);
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("[ObjectPlacer] Prepared for save — %d active placed actors."),
 		PlacedActors.Num());
 }
 
+void UObjectPlacementManager::StageAllForRemoval()
+{
+	ExitCurrentMode();
+
+	Journal.BeginBatch(TEXT("Remove All"), FPlatformTime::Seconds());
+	for (AActor* Actor : TArray<TObjectPtr<AActor>>(PlacedActors))
+	{
+		UPlacedObjectComponent* POC = Actor ? Actor->FindComponentByClass<UPlacedObjectComponent>() : nullptr;
+		if (POC && !POC->IsMarkedForRemoval()) StageForRemoval(Actor);
+	}
+	Journal.EndBatch();
+}
+
+void UObjectPlacementManager::Undo()
+{
+	const FString Label = Journal.GetUndoLabel();
+	PrepareForJournalStep();
+	if (Journal.Undo())
+		UE_LOG(LogTemp, Log, TEXT("[ObjectPlacer] Undo: %s"), *Label);
+}
+
+void UObjectPlacementManager::Redo()
+{
+	const FString Label = Journal.GetRedoLabel();
+	PrepareForJournalStep();
+	if (Journal.Redo())
+		UE_LOG(LogTemp, Log, TEXT("[ObjectPlacer] Redo: %s"), *Label);
+}
+
+// An actor mid-reposition or highlighted would fight the journal over its transform and materials
+void UObjectPlacementManager::PrepareForJournalStep()
+{
+	if (CurrentMode == EPlacementMode::Editing && EditPhase == EEditPhase::RepositioningObject)
+		CancelEdit();
+	ClearTargetedActor();
+}
+
+// Applies one undo / redo / recovery command. Actors are looked up by GUID; the ones that no longer
+// exist (a committed removal being undone, a replay on top of a save) are respawned from their PrefabID.
+void UObjectPlacementManager::ApplyJournalCommand(const FPlacementCommand& Command)
+{
+	const TWeakObjectPtr<AActor>* Found = PlacedByGUID.Find(Command.GUID);
+	AActor* Actor = Found ? Found->Get() : nullptr;
+	UPlacedObjectComponent* POC = Actor ? Actor->FindComponentByClass<UPlacedObjectComponent>() : nullptr;
+
+	switch (Command.Type)
+	{
+		case EPlacementCommandType::Place:
+		case EPlacementCommandType::Restore:
+		{
+			if (!Actor)
+			{
+				UPlaceableItemData* Definition = FindDefinitionByPrefabID(Command.PrefabID);
+				if (Definition)
+					SpawnPlacedActor(Definition, Command.GetToTransform(), Command.GUID);
+				else
+					UE_LOG(LogTemp, Warning, TEXT("[ObjectPlacer] No DataAsset found for PrefabID '%s'. Journal command skipped."),
+						*Command.PrefabID.ToString());
+			}
+			else if (POC && POC->IsMarkedForRemoval())
+			{
+				POC->MarkForRemoval(false);
+				Actor->SetActorHiddenInGame(false);
+				AddToIndex(POC);
+			}
+			break;
+		}
+		case EPlacementCommandType::Delete:
+			if (Actor) DestroyPlacedActor(Actor);
+			break;
+
+		case EPlacementCommandType::Transform:
+			if (!Actor) break;
+			Actor->SetActorLocationAndRotation(Command.ToLocation, Command.ToRotation);
+			UpdateIndexedBox(POC);
+			break;
+
+		case EPlacementCommandType::Remove:
+			if (POC && !POC->IsMarkedForRemoval()) HideForRemoval(Actor);
+			break;
+	}
+}
+
+void UObjectPlacementManager::HideForRemoval(AActor* Actor)
+{
+	if (UPlacedObjectComponent* POC = Actor->FindComponentByClass<UPlacedObjectComponent>())
+		POC->MarkForRemoval(true);
+
+	Actor->SetActorHiddenInGame(true);
+	RemoveFromIndex(Actor);
+}
+
+void UObjectPlacementManager::DestroyPlacedActor(AActor* Actor)
+{
+	if (TargetedActor == Actor) TargetedActor = nullptr;
+
+	RemoveFromIndex(Actor);
+	PlacedActors.Remove(Actor);
+	PlacedByGUID.Remove(GetPlacedGUID(Actor));
+	Actor->Destroy();
+}
+
+AActor* UObjectPlacementManager::SpawnPlacedActor(UPlaceableItemData* Definition, const FTransform& Transform, const FGuid& GUID)
+{
+	UClass* ActorClass = Definition->ActorClass.LoadSynchronous();
+	if (!ActorClass || !GetWorld()) return nullptr;
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride =
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AActor* Spawned = GetWorld()->SpawnActor<AActor>(
+		ActorClass, Transform.GetLocation(), Transform.Rotator(), Params);
+
+	if (!Spawned) return nullptr;
+
+	Spawned->SetActorScale3D(Transform.GetScale3D());
+
+	// Restore the GUID so the SaveManager sweep and the journal match it
+	UGUIDComponent* GUIDComp = Spawned->FindComponentByClass<UGUIDComponent>();
+	if (!GUIDComp)
+	{
+		GUIDComp = NewObject<UGUIDComponent>(Spawned);
+		GUIDComp->RegisterComponent();
+	}
+	GUIDComp->GUID = GUID;
+
+	RegisterPlacedActor(Spawned, Definition);
+	return Spawned;
+}
+
 UPlaceableItemData* UObjectPlacementManager::FindDefinitionByPrefabID(const FName& PrefabID)
 {
 	for (UPlaceableItemData* Item : KnownItems)
@@ -731,6 +973,9 @@ void UObjectPlacementManager::LoadPlacedObjects(USaveGameData* SaveData)
 
 	if (!SaveData || !GetWorld()) return;
 
+	// History from before the load no longer matches the level
+	Journal.Clear();
+
 	if (PlacedActors.Num() > 0)
 	{
 		UE_LOG(LogTemp, Warning,
@@ -759,31 +1004,8 @@ void UObjectPlacementManager::LoadPlacedObjects(USaveGameData* SaveData)
 			continue;
 		}
 
-		UClass* ActorClass = Definition->ActorClass.LoadSynchronous();
-		if (!ActorClass) continue;
-
-		FActorSpawnParameters Params;
-		Params.SpawnCollisionHandlingOverride =
-			ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-		AActor* Spawned = GetWorld()->SpawnActor<AActor>(
-			ActorClass, Data.Position, Data.Rotation, Params);
-
-		if (!Spawned) continue;
-
-		Spawned->SetActorScale3D(Data.Scale);
-
-		// Restore the GUID so the SaveManager sweep matches it on next save
-		UGUIDComponent* GUIDComp = Spawned->FindComponentByClass<UGUIDComponent>();
-		if (!GUIDComp)
-		{
-			GUIDComp = NewObject<UGUIDComponent>(Spawned);
-			GUIDComp->RegisterComponent();
-		}
-		GUIDComp->GUID = Entry.GUID;
-
-		RegisterPlacedActor(Spawned, Definition);
-		Loaded++;
+		if (SpawnPlacedActor(Definition, FTransform(Data.Rotation, Data.Position, Data.Scale), Entry.GUID))
+			Loaded++;
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("[ObjectPlacer] Loaded %d placed actors."), Loaded);
@@ -797,6 +1019,10 @@ void UObjectPlacementManager::ClearAllPlacedObjects()
 		if (PlacedActors[i]) PlacedActors[i]->Destroy();
 
 	PlacedActors.Empty();
+	PlacedByGUID.Reset();
+	SpatialIndex.Reset(SpatialCellSize);
+	SnapSolver.Reset();
+	Journal.Clear();
 
 	UE_LOG(LogTemp, Log, TEXT("[ObjectPlacer] All placed actors cleared."));
 }
@@ -4,7 +4,11 @@
 #include "Components/ActorComponent.h"
 #include "PlaceableItemData.h"
 #include "PlacedObjectComponent.h"
+#include "PlacementSpatialIndex.h"
+#include "PlacementSnapSolver.h"
+#include "PlacementJournal.h"
 #include "Camera/CameraComponent.h"
+#include "Engine/OverlapResult.h"
 #include "ObjectPlacementManager.generated.h"
 
 UENUM(BlueprintType)
@@ -33,6 +37,7 @@ public:
 	UObjectPlacementManager();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
 		FActorComponentTickFunction* ThisTickFunction) override;
 
@@ -49,6 +54,41 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement|Settings")
 	TEnumAsByte<ECollisionChannel> PlacedObjectChannel = ECC_GameTraceChannel1;
 
+	// Cell size of the placed objects spatial grid. Around the size of a typical placeable works best.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Placement|Overlap", meta = (ClampMin = "10.0"))
+	float SpatialCellSize = 200.f;
+
+	// Confirms index hits with a physics overlap against the real collision. Only runs when the index reports candidates.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement|Overlap")
+	bool bExactOverlapCheck = true;
+
+	// Socket, grid (per item) and alignment guide snapping of the preview
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement|Snapping")
+	bool bSnappingEnabled = true;
+
+	// Max distance between two compatible sockets for them to connect
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement|Snapping", meta = (ClampMin = "0.0"))
+	float SocketSnapRadius = 35.f;
+
+	// Bounds edges / centers closer than this to a nearby object's snap into alignment
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement|Snapping", meta = (ClampMin = "0.0"))
+	float GuideTolerance = 10.f;
+
+	// How far around the preview neighbours are considered for alignment guides
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement|Snapping", meta = (ClampMin = "0.0"))
+	float GuideRadius = 200.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement|Snapping")
+	bool bDrawAlignmentGuides = true;
+
+	// Memory budget of the undo history. The oldest steps are dropped past it. 0 = no cap.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Placement|Undo", meta = (ClampMin = "0"))
+	int32 UndoMemoryBudgetKB = 256;
+
+	// Moves of the same actor closer together than this (seconds) undo as a single step
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Placement|Undo", meta = (ClampMin = "0.0"))
+	float NudgeMergeWindow = 1.f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement|Materials")
 	TObjectPtr<UMaterialInterface> HoverValidMaterial;
 
@@ -97,6 +137,25 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Placement|Save")
 	void ClearAllPlacedObjects();
 
+	// Stages every placed actor for removal as a single undo step
+	UFUNCTION(BlueprintCallable, Category = "Placement")
+	void StageAllForRemoval();
+
+	UFUNCTION(BlueprintCallable, Category = "Placement|Undo")
+	void Undo();
+
+	UFUNCTION(BlueprintCallable, Category = "Placement|Undo")
+	void Redo();
+
+	UFUNCTION(BlueprintPure, Category = "Placement|Undo")
+	bool CanUndo() const { return Journal.CanUndo(); }
+
+	UFUNCTION(BlueprintPure, Category = "Placement|Undo")
+	bool CanRedo() const { return Journal.CanRedo(); }
+
+	// Undo / redo history of placing, editing and removing, plus the recovery log the save subsystem persists
+	FPlacementJournal& GetJournal() { return Journal; }
+
 private:
 
 	EPlacementMode CurrentMode  = EPlacementMode::None;
@@ -105,6 +164,9 @@ private:
 	TObjectPtr<UPlaceableItemData> SelectedItem;
 	TObjectPtr<AActor>             PreviewActor;
 	TArray<TObjectPtr<UMeshComponent>> PreviewMeshes;
+	FBox PreviewLocalBox = FBox(EForceInit::ForceInitToZero);
+	TArray<FPlacementSocketData> PreviewSockets;
+	TArray<FPlacementGuide>      Guides;
 
 	bool  bLastValidState = false;
 	float RotationOffset  = 0.f;
@@ -112,6 +174,14 @@ private:
 	TObjectPtr<AActor>         TargetedActor;
 	TArray<TObjectPtr<AActor>> PlacedActors;
 
+	FPlacementSpatialIndex SpatialIndex;
+	TArray<int32>          OverlapCandidates;
+	TArray<FOverlapResult> OverlapResults;
+	FPlacementSnapSolver   SnapSolver{ SpatialIndex };
+
+	TMap<FGuid, TWeakObjectPtr<AActor>> PlacedByGUID;
+	FPlacementJournal Journal{ [this](const FPlacementCommand& Command) { ApplyJournalCommand(Command); } };
+
 	void SetBobbingEnabled(bool bEnabled);
 
 	void TickPlacing();
@@ -123,7 +193,10 @@ private:
 	bool EvaluatePlacement(UPlaceableItemData* Item,
 		FHitResult& OutHit, EPlacementSurfaceType& OutSurfaceType);
 	EPlacementSurfaceType ClassifySurface(const FVector& Normal) const;
-	bool IsPreviewOverlapping() const;
+	bool IsPreviewOverlapping();
+	FPlacementBox GetPreviewBox(float Shrink = 1.f) const;
+	int32 GetIgnoredHandle() const;
+	void  ApplySnapping(const FHitResult& Hit, UPlaceableItemData* Item);
 
 	void SpawnPreview(UPlaceableItemData* Item);
 	void DestroyPreview();
@@ -134,6 +207,14 @@ private:
 	AActor* LineTraceForPlacedActor() const;
 	void    RegisterPlacedActor(AActor* Actor, UPlaceableItemData* Item);
 	void    ClearTargetedActor();
+	void    UpdateIndexedBox(UPlacedObjectComponent* POC);
+	void    AddToIndex(UPlacedObjectComponent* POC);
+	void    RemoveFromIndex(AActor* Actor);
+	AActor* SpawnPlacedActor(UPlaceableItemData* Definition, const FTransform& Transform, const FGuid& GUID);
+	void    DestroyPlacedActor(AActor* Actor);
+	void    HideForRemoval(AActor* Actor);
+	void    PrepareForJournalStep();
+	void    ApplyJournalCommand(const FPlacementCommand& Command);
 
 	void CommitPlacement();
 	void BeginRepositioning(AActor* Actor);
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
 #include "EPlacementSurfaceType.h"
+#include "EPlacementGridMode.h"
 #include "PlaceableItemData.generated.h"
 
 // It is mandatory to have a Data Asset per "Placeable" due to it containing the spawnable actor, and it's placement characteristics.
@@ -50,4 +51,14 @@ public:
 	// If true the object will rotate to be adapted to the surface normal on placement, instead of keeping its original rotation.
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Rotation")
 	bool bSnapRotationToSurface = false;
+
+
+	// Grid the pivot snaps to along the surface. Socket snaps take priority over the grid.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Snapping")
+	EPlacementGridMode GridMode = EPlacementGridMode::None;
+
+	// Grid cell size per axis. Axes at 0 are left free.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Snapping",
+		Meta = (EditCondition = "GridMode != EPlacementGridMode::None"))
+	FVector GridCellSize = FVector(50.f);
 };
\ No newline at end of file
@@ -2,7 +2,16 @@
 #include "Components/StaticMeshComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "PlacedObjectSaveData.h"
+#include "PlacementSpatialIndex.h"
 #include "JsonObjectConverter.h"
+#include "Mechanics_Test_LVN/SaveSchemaRegistry.h"
+
+// Version stamp for FPlacedObjectSaveData. Migrations from v1 go here when the struct changes.
+static const bool GPlacedObjectSaveSchemaRegistered = []
+{
+	FSaveSchemaRegistry::Get().Register(TEXT("FPlacedObjectSaveData"), 1);
+	return true;
+}();
 
 UPlacedObjectComponent::UPlacedObjectComponent()
 {
@@ -14,6 +23,8 @@ void UPlacedObjectComponent::Initialize(UPlaceableItemData* InDefinition)
 {
 	Definition = InDefinition;
 	CacheMaterials();
+	LocalBounds = FPlacementSpatialIndex::MeasureLocalBox(GetOwner());
+	UPlacementSocketComponent::Collect(GetOwner(), Sockets);
 }
 
 
@@ -92,6 +103,7 @@ void UPlacedObjectComponent::RevertToSnapshot()
 	if (!GetOwner()) return;
 
 	GetOwner()->SetActorLocationAndRotation(SnapshotPosition, SnapshotRotation);
+	OnMoved.Broadcast(this);
 }
 
 void UPlacedObjectComponent::MarkForRemoval(bool bMark)
@@ -130,5 +142,6 @@ void UPlacedObjectComponent::RestoreState(const FString& JsonData)
 		GetOwner()->SetActorLocation(Data.Position);
 		GetOwner()->SetActorRotation(Data.Rotation);
 		GetOwner()->SetActorScale3D(Data.Scale);
+		OnMoved.Broadcast(this);
 	}
 }
\ No newline at end of file
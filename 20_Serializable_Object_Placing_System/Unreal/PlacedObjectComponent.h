@@ -3,8 +3,13 @@
 #include "CoreMinimal.h"
 #include "Mechanics_Test_LVN/SaveableComponent.h" // Include for the SaveableComponent made in a previous section
 #include "PlaceableItemData.h"
+#include "PlacementSocketComponent.h"
 #include "PlacedObjectComponent.generated.h"
 
+class UPlacedObjectComponent;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPlacedObjectMoved, UPlacedObjectComponent*);
+
 // This Component has to be attached along GUIDComponent (Part of the Save System) in the "Placeable" Actor
 UCLASS(ClassGroup = "Placement", Meta = (BlueprintSpawnableComponent))
 class MECHANICS_TEST_LVN_API UPlacedObjectComponent : public USaveableComponent
@@ -33,12 +38,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Placement")
 	void RevertToSnapshot();
 
+	// Pose captured by SnapshotForEdit, the "before" of an edit in the undo journal
+	FVector GetSnapshotPosition() const { return SnapshotPosition; }
+	FQuat   GetSnapshotRotation() const { return SnapshotRotation; }
+
 	UFUNCTION(BlueprintCallable, Category = "Placement")
 	void MarkForRemoval(bool bMark);
 
 	UFUNCTION(BlueprintPure, Category = "Placement")
 	bool IsMarkedForRemoval() const { return bMarkedForRemoval; }
 
+	// Combined mesh bounds in actor space, measured once at Initialize for the placement spatial index
+	FBox LocalBounds = FBox(EForceInit::ForceInitToZero);
+
+	// Snap sockets in actor space, collected once at Initialize
+	TArray<FPlacementSocketData> Sockets;
+
+	// Handle in the manager's FPlacementSpatialIndex, INDEX_NONE while not indexed
+	int32 SpatialHandle = INDEX_NONE;
+
+	// Broadcast when the transform is changed outside the manager (snapshot revert, save restore)
+	FOnPlacedObjectMoved OnMoved;
+
 	virtual FString CaptureState() override;
 	virtual void    RestoreState(const FString& JsonData) override;
 	virtual FString GetSaveDataType() const override { return TEXT("FPlacedObjectSaveData"); }
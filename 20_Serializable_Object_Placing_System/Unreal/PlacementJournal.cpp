@@ -0,0 +1,223 @@
+#include "PlacementJournal.h"
+#include "JsonObjectConverter.h"
+
+static constexpr int64 StepOverheadBytes = 64;
+
+FPlacementCommand FPlacementCommand::Place(const FGuid& GUID, FName PrefabID, const FTransform& Transform)
+{
+    FPlacementCommand Command;
+    Command.Type         = EPlacementCommandType::Place;
+    Command.GUID         = GUID;
+    Command.PrefabID     = PrefabID;
+    Command.FromLocation = Command.ToLocation = Transform.GetLocation();
+    Command.FromRotation = Command.ToRotation = Transform.GetRotation();
+    Command.Scale        = Transform.GetScale3D();
+    return Command;
+}
+
+FPlacementCommand FPlacementCommand::Move(const FGuid& GUID, FName PrefabID, const FVector& FromLocation, const FQuat& FromRotation, const FTransform& To)
+{
+    FPlacementCommand Command = Place(GUID, PrefabID, To);
+    Command.Type         = EPlacementCommandType::Transform;
+    Command.FromLocation = FromLocation;
+    Command.FromRotation = FromRotation;
+    return Command;
+}
+
+FPlacementCommand FPlacementCommand::Remove(const FGuid& GUID, FName PrefabID, const FTransform& Transform)
+{
+    FPlacementCommand Command = Place(GUID, PrefabID, Transform);
+    Command.Type = EPlacementCommandType::Remove;
+    return Command;
+}
+
+FPlacementCommand FPlacementCommand::Inverse() const
+{
+    FPlacementCommand Inverse = *this;
+    Inverse.FromLocation = ToLocation;
+    Inverse.FromRotation = ToRotation;
+    Inverse.ToLocation   = FromLocation;
+    Inverse.ToRotation   = FromRotation;
+
+    switch (Type)
+    {
+        case EPlacementCommandType::Place:   Inverse.Type = EPlacementCommandType::Delete;  break;
+        case EPlacementCommandType::Delete:  Inverse.Type = EPlacementCommandType::Place;   break;
+        case EPlacementCommandType::Remove:  Inverse.Type = EPlacementCommandType::Restore; break;
+        case EPlacementCommandType::Restore: Inverse.Type = EPlacementCommandType::Remove;  break;
+        default: break;
+    }
+    return Inverse;
+}
+
+void FPlacementJournal::Record(const FPlacementCommand& Command, double Time, const FString& Label)
+{
+    AppendToLog(Command);
+
+    if (BatchDepth > 0)
+    {
+        Batch.Commands.Add(Command);
+        return;
+    }
+
+    ClearRedo();
+    if (TryMerge(Command, Time)) return;
+
+    FStep Step;
+    Step.Label = Label.IsEmpty() ? StaticEnum<EPlacementCommandType>()->GetNameStringByValue(static_cast<int64>(Command.Type)) : Label;
+    Step.Time  = Time;
+    Step.Commands.Add(Command);
+    Push(MoveTemp(Step));
+}
+
+void FPlacementJournal::BeginBatch(const FString& Label, double Time)
+{
+    if (BatchDepth++ > 0) return;
+
+    Batch = FStep();
+    Batch.Label = Label;
+    Batch.Time  = Time;
+}
+
+void FPlacementJournal::EndBatch()
+{
+    if (BatchDepth == 0 || --BatchDepth > 0) return;
+    if (Batch.Commands.Num() == 0) return;
+
+    ClearRedo();
+    Push(MoveTemp(Batch));
+    Batch = FStep();
+}
+
+bool FPlacementJournal::Undo()
+{
+    if (!CanUndo()) return false;
+
+    const FStep& Step = Steps[--Cursor];
+    for (int32 i = Step.Commands.Num() - 1; i >= 0; i--)
+    {
+        const FPlacementCommand Inverse = Step.Commands[i].Inverse();
+        Apply(Inverse);
+        AppendToLog(Inverse);
+    }
+    return true;
+}
+
+bool FPlacementJournal::Redo()
+{
+    if (!CanRedo()) return false;
+
+    const FStep& Step = Steps[Cursor++];
+    for (const FPlacementCommand& Command : Step.Commands)
+    {
+        Apply(Command);
+        AppendToLog(Command);
+    }
+    return true;
+}
+
+void FPlacementJournal::Clear()
+{
+    Steps.Reset();
+    Batch = FStep();
+    Cursor       = 0;
+    BatchDepth   = 0;
+    MemoryBytes  = 0;
+    DroppedSteps = 0;
+    RecoveryLog.Commands.Reset();
+    OnRecoveryLogChanged.Broadcast(*this);
+}
+
+void FPlacementJournal::MarkSaved()
+{
+    RecoveryLog.Commands.Reset();
+    OnRecoveryLogChanged.Broadcast(*this);
+}
+
+FString FPlacementJournal::SerializeRecoveryLog() const
+{
+    FString Json;
+    FJsonObjectConverter::UStructToJsonObjectString(RecoveryLog, Json);
+    return Json;
+}
+
+int32 FPlacementJournal::Replay(const FString& Json)
+{
+    if (Json.IsEmpty()) return 0;
+
+    FPlacementRecoveryLog Log;
+    if (!FJsonObjectConverter::JsonObjectStringToUStruct(Json, &Log))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[PlacementJournal] Ignoring unreadable recovery log."));
+        return 0;
+    }
+
+    for (const FPlacementCommand& Command : Log.Commands)
+    {
+        Apply(Command);
+        AppendToLog(Command);
+    }
+    return Log.Commands.Num();
+}
+
+bool FPlacementJournal::TryMerge(const FPlacementCommand& Command, double Time)
+{
+    if (Command.Type != EPlacementCommandType::Transform || Cursor == 0) return false;
+
+    FStep& Last = Steps[Cursor - 1];
+    if (Last.Commands.Num() != 1 || Time - Last.Time > MergeWindow) return false;
+
+    FPlacementCommand& Previous = Last.Commands[0];
+    if (Previous.Type != EPlacementCommandType::Transform || Previous.GUID != Command.GUID) return false;
+
+    Previous.ToLocation = Command.ToLocation;
+    Previous.ToRotation = Command.ToRotation;
+    Last.Time = Time;
+    return true;
+}
+
+void FPlacementJournal::AppendToLog(const FPlacementCommand& Command)
+{
+    TArray<FPlacementCommand>& Log = RecoveryLog.Commands;
+
+    // Two moves of the same actor in a row replay as one
+    if (Command.Type == EPlacementCommandType::Transform && Log.Num() > 0
+        && Log.Last().Type == EPlacementCommandType::Transform && Log.Last().GUID == Command.GUID)
+    {
+        Log.Last().ToLocation = Command.ToLocation;
+        Log.Last().ToRotation = Command.ToRotation;
+    }
+    else
+    {
+        Log.Add(Command);
+    }
+
+    OnRecoveryLogChanged.Broadcast(*this);
+}
+
+void FPlacementJournal::Push(FStep&& Step)
+{
+    Step.Bytes = StepOverheadBytes + Step.Commands.Num() * static_cast<int64>(sizeof(FPlacementCommand)) + Step.Label.GetAllocatedSize();
+    MemoryBytes += Step.Bytes;
+    Steps.Add(MoveTemp(Step));
+    Cursor++;
+
+    // Drop the oldest steps over the cap, always keeping the newest one
+    int32 Drop = 0;
+    while (MaxMemoryBytes > 0 && MemoryBytes > MaxMemoryBytes && Cursor - Drop > 1)
+        MemoryBytes -= Steps[Drop++].Bytes;
+
+    if (Drop > 0)
+    {
+        Steps.RemoveAt(0, Drop);
+        Cursor       -= Drop;
+        DroppedSteps += Drop;
+    }
+}
+
+void FPlacementJournal::ClearRedo()
+{
+    for (int32 i = Cursor; i < Steps.Num(); i++)
+        MemoryBytes -= Steps[i].Bytes;
+    Steps.SetNum(Cursor);
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PlacementJournal.generated.h"
+
+class FPlacementJournal;
+
+UENUM()
+enum class EPlacementCommandType : uint8
+{
+    Place,
+    Delete,
+    Transform,
+    Remove,
+    Restore,
+};
+
+// One reversible placement operation. Commands carry absolute poses, so applying one never depends on
+// what happened before it, which is what makes replaying them on top of a save safe.
+USTRUCT()
+struct MECHANICS_TEST_LVN_API FPlacementCommand
+{
+    GENERATED_BODY()
+
+    UPROPERTY() EPlacementCommandType Type = EPlacementCommandType::Place;
+    UPROPERTY() FGuid   GUID;     // UGUIDComponent::GUID of the placed actor
+    UPROPERTY() FName   PrefabID; // To respawn it when undoing a committed removal or replaying
+    UPROPERTY() FVector FromLocation = FVector::ZeroVector;
+    UPROPERTY() FQuat   FromRotation = FQuat::Identity;
+    UPROPERTY() FVector ToLocation = FVector::ZeroVector;
+    UPROPERTY() FQuat   ToRotation = FQuat::Identity;
+    UPROPERTY() FVector Scale = FVector::OneVector;
+
+    static FPlacementCommand Place(const FGuid& GUID, FName PrefabID, const FTransform& Transform);
+    static FPlacementCommand Move(const FGuid& GUID, FName PrefabID, const FVector& FromLocation, const FQuat& FromRotation, const FTransform& To);
+    static FPlacementCommand Remove(const FGuid& GUID, FName PrefabID, const FTransform& Transform);
+
+    FPlacementCommand Inverse() const;
+
+    FTransform GetToTransform() const { return FTransform(ToRotation, ToLocation, Scale); }
+};
+
+// What the journal file on disk holds
+USTRUCT()
+struct MECHANICS_TEST_LVN_API FPlacementRecoveryLog
+{
+    GENERATED_BODY()
+
+    UPROPERTY() int32 Version = 1;
+    UPROPERTY() TArray<FPlacementCommand> Commands;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPlacementRecoveryLogChanged, const FPlacementJournal&);
+
+/* --------------------------------------------------------------------------
+   Undo / redo journal for the placement system.
+
+   • Operations are recorded after they happened (Record) as steps of one or more commands.
+     BeginBatch / EndBatch groups several into one step. Undo applies the inverse commands in
+     reverse order through the Apply callback, Redo applies them again.
+   • History is unbounded in count but capped in memory (MaxMemoryBytes, <= 0 for no cap):
+     the oldest steps are dropped first. Consecutive moves of the same actor within
+     MergeWindow seconds merge into one step, so nudging doesn't flood the history.
+   • Every command that changes the world (recorded, undone, redone or replayed) is also
+     appended to a recovery log, cleared by MarkSaved. Replaying that log on top of the last
+     save rebuilds the unsaved session (see the LVN.Placement.Journal tests).
+   -------------------------------------------------------------------------- */
+class MECHANICS_TEST_LVN_API FPlacementJournal
+{
+public:
+    using FApplyCommand = TFunction<void(const FPlacementCommand&)>;
+
+    explicit FPlacementJournal(FApplyCommand InApply) : Apply(MoveTemp(InApply)) {}
+
+    int64  MaxMemoryBytes = 256 * 1024;
+    double MergeWindow = 1.0;
+
+    // Records a command that was already applied to the world
+    void Record(const FPlacementCommand& Command, double Time, const FString& Label = FString());
+
+    void BeginBatch(const FString& Label, double Time);
+    void EndBatch();
+
+    bool Undo();
+    bool Redo();
+
+    // Forgets history and the recovery log (after loading or deleting a save)
+    void Clear();
+
+    // The world now matches the save: the recovery log restarts empty, undo history is kept
+    void MarkSaved();
+
+    FString SerializeRecoveryLog() const;
+
+    // Applies a serialized recovery log on top of the current world. Replayed commands join the new
+    // recovery log (still unsaved) but not the undo history. Returns how many commands were applied.
+    int32 Replay(const FString& Json);
+
+    int32   GetUndoCount() const { return Cursor; }
+    int32   GetRedoCount() const { return Steps.Num() - Cursor; }
+    bool    CanUndo() const { return Cursor > 0 && BatchDepth == 0; }
+    bool    CanRedo() const { return Cursor < Steps.Num() && BatchDepth == 0; }
+    FString GetUndoLabel() const { return Cursor > 0 ? Steps[Cursor - 1].Label : FString(); }
+    FString GetRedoLabel() const { return Cursor < Steps.Num() ? Steps[Cursor].Label : FString(); }
+    int64   GetMemoryBytes() const { return MemoryBytes; }
+    int32   GetDroppedSteps() const { return DroppedSteps; }
+    int32   GetRecoveryCount() const { return RecoveryLog.Commands.Num(); }
+
+    FOnPlacementRecoveryLogChanged OnRecoveryLogChanged;
+
+private:
+    struct FStep
+    {
+        FString Label;
+        double  Time = 0.0;
+        int64   Bytes = 0;
+        TArray<FPlacementCommand> Commands;
+    };
+
+    bool TryMerge(const FPlacementCommand& Command, double Time);
+    void AppendToLog(const FPlacementCommand& Command);
+    void Push(FStep&& Step);
+    void ClearRedo();
+
+    FApplyCommand Apply;
+    TArray<FStep> Steps; // Undo at [0, Cursor), redo at [Cursor, Num)
+    FStep Batch;
+    FPlacementRecoveryLog RecoveryLog;
+    int32 Cursor = 0;
+    int32 BatchDepth = 0;
+    int64 MemoryBytes = 0;
+    int32 DroppedSteps = 0;
+};
@@ -0,0 +1,205 @@
+#include "PlacementSnapSolver.h"
+
+void FPlacementSnapSolver::SetSockets(int32 Handle, TArrayView<const FPlacementSocketData> LocalSockets, const FTransform& ActorTransform)
+{
+    if (LocalSockets.Num() == 0)
+    {
+        SocketsByHandle.Remove(Handle);
+        return;
+    }
+
+    TArray<FWorldSocket>& World = SocketsByHandle.FindOrAdd(Handle);
+    World.SetNum(LocalSockets.Num());
+
+    for (int32 i = 0; i < LocalSockets.Num(); i++)
+    {
+        World[i].Data     = LocalSockets[i];
+        World[i].Location = ActorTransform.TransformPosition(LocalSockets[i].LocalPosition);
+        World[i].Normal   = ActorTransform.TransformVectorNoScale(LocalSockets[i].LocalNormal).GetSafeNormal();
+    }
+}
+
+FPlacementSnapResult FPlacementSnapSolver::Solve(const FPlacementSnapRequest& Request, TArray<FPlacementGuide>* OutGuides) const
+{
+    if (OutGuides) OutGuides->Reset();
+
+    FPlacementSnapResult Result;
+    Result.Location = Request.Location;
+    Result.Rotation = Request.Rotation;
+
+    if (SnapToSocket(Request, Result)) return Result;
+    if (SnapToGrid(Request, Result)) return Result;
+    AlignToNeighbours(Request, Result, OutGuides);
+    return Result;
+}
+
+bool FPlacementSnapSolver::SnapToSocket(const FPlacementSnapRequest& Request, FPlacementSnapResult& Result) const
+{
+    if (Request.Sockets.Num() == 0 || SocketsByHandle.Num() == 0) return false;
+
+    FPlacementBox Area = FPlacementBox::FromLocalBox(Request.LocalBox, FTransform(Request.Rotation, Request.Location, Request.Scale));
+    Area.Extent += FVector(SocketRadius);
+    Index->Query(Area, Candidates, Request.IgnoreHandle);
+
+    const float MinDot = FMath::Cos(FMath::DegreesToRadians(MaxSocketAngle));
+    float BestDistance = SocketRadius * SocketRadius;
+    int32 BestHandle = INDEX_NONE, BestTarget = INDEX_NONE, BestSocket = INDEX_NONE;
+
+    for (const int32 Handle : Candidates)
+    {
+        const TArray<FWorldSocket>* Targets = SocketsByHandle.Find(Handle);
+        if (!Targets) continue;
+
+        for (int32 T = 0; T < Targets->Num(); T++)
+        {
+            const FWorldSocket& Target = (*Targets)[T];
+
+            for (int32 S = 0; S < Request.Sockets.Num(); S++)
+            {
+                const FPlacementSocketData& Socket = Request.Sockets[S];
+                if (!FPlacementSocketData::Compatible(Socket, Target.Data)) continue;
+
+                const FVector Location = Request.Location + Request.Rotation.RotateVector(Request.Scale * Socket.LocalPosition);
+                const FVector Normal   = Request.Rotation.RotateVector(Socket.LocalNormal);
+
+                const float Distance = FVector::DistSquared(Target.Location, Location);
+                if (Distance > BestDistance) continue;
+                if (FVector::DotProduct(Normal, -Target.Normal) < MinDot) continue;
+
+                // Equal distances fall back to the lowest (handle, target socket, socket)
+                if (BestHandle != INDEX_NONE && Distance == BestDistance
+                    && MakeTuple(Handle, T, S) >= MakeTuple(BestHandle, BestTarget, BestSocket)) continue;
+
+                BestDistance = Distance;
+                BestHandle   = Handle;
+                BestTarget   = T;
+                BestSocket   = S;
+            }
+        }
+    }
+
+    if (BestHandle == INDEX_NONE) return false;
+
+    const FWorldSocket& Target = SocketsByHandle[BestHandle][BestTarget];
+    const FPlacementSocketData& Socket = Request.Sockets[BestSocket];
+
+    // Turn the preview so both sockets face each other, then bring them together
+    const FQuat Rotation = FQuat::FindBetweenNormals(Request.Rotation.RotateVector(Socket.LocalNormal), -Target.Normal) * Request.Rotation;
+
+    Result.Rotation          = Rotation;
+    Result.Location          = Target.Location - Rotation.RotateVector(Request.Scale * Socket.LocalPosition);
+    Result.Kind              = EPlacementSnapKind::Socket;
+    Result.TargetHandle      = BestHandle;
+    Result.TargetSocketIndex = BestTarget;
+    Result.SocketIndex       = BestSocket;
+    return true;
+}
+
+bool FPlacementSnapSolver::SnapToGrid(const FPlacementSnapRequest& Request, FPlacementSnapResult& Result)
+{
+    if (Request.GridMode == EPlacementGridMode::None) return false;
+
+    FTransform Origin = Request.GridMode == EPlacementGridMode::Local ? Request.GridOrigin : FTransform::Identity;
+    Origin.SetScale3D(FVector::OneVector);
+
+    FVector Local        = Origin.InverseTransformPosition(Result.Location);
+    const FVector Normal = Origin.InverseTransformVectorNoScale(Request.SurfaceNormal);
+
+    bool bSnapped = false;
+    for (int32 Axis = 0; Axis < 3; Axis++)
+    {
+        const float Cell = Request.GridCellSize[Axis];
+        if (Cell <= 0.f || FMath::Abs(Normal[Axis]) > 0.7f) continue;
+
+        Local[Axis] = FMath::RoundToFloat(Local[Axis] / Cell) * Cell;
+        bSnapped = true;
+    }
+
+    if (!bSnapped) return false;
+
+    Result.Location = Origin.TransformPosition(Local);
+    Result.Kind     = EPlacementSnapKind::Grid;
+    return true;
+}
+
+static float BoxFeature(const FBox& Box, int32 Feature, int32 Axis)
+{
+    switch (Feature)
+    {
+        case 0:  return Box.Min[Axis];
+        case 1:  return Box.GetCenter()[Axis];
+        default: return Box.Max[Axis];
+    }
+}
+
+void FPlacementSnapSolver::AlignToNeighbours(const FPlacementSnapRequest& Request, FPlacementSnapResult& Result, TArray<FPlacementGuide>* OutGuides) const
+{
+    if (GuideTolerance <= 0.f) return;
+
+    const FPlacementBox Box = FPlacementBox::FromLocalBox(Request.LocalBox, FTransform(Result.Rotation, Result.Location, Request.Scale));
+    FPlacementBox Area = Box;
+    Area.Extent += FVector(GuideRadius);
+    if (Index->Query(Area, Candidates, Request.IgnoreHandle) == 0) return;
+
+    const FBox Self = Box.GetAABB();
+    FVector Delta = FVector::ZeroVector;
+    const int32 FirstGuide = OutGuides ? OutGuides->Num() : 0;
+
+    for (int32 Axis = 0; Axis < 3; Axis++)
+    {
+        if (FMath::Abs(Request.SurfaceNormal[Axis]) > 0.7f) continue;
+
+        float BestDistance = GuideTolerance;
+        float BestDelta    = 0.f;
+        int32 BestHandle   = INDEX_NONE;
+        int32 BestPair     = INDEX_NONE;
+        FBox  BestBox(EForceInit::ForceInitToZero);
+
+        for (const int32 Handle : Candidates)
+        {
+            const FBox Other = Index->GetBox(Handle).GetAABB();
+
+            // min / center / max of the preview against min / center / max of the neighbour
+            for (int32 Pair = 0; Pair < 9; Pair++)
+            {
+                const float Difference = BoxFeature(Other, Pair % 3, Axis) - BoxFeature(Self, Pair / 3, Axis);
+                const float Distance   = FMath::Abs(Difference);
+                if (Distance > BestDistance) continue;
+                if (BestHandle != INDEX_NONE && Distance == BestDistance
+                    && MakeTuple(Handle, Pair) >= MakeTuple(BestHandle, BestPair)) continue;
+
+                BestDistance = Distance;
+                BestDelta    = Difference;
+                BestHandle   = Handle;
+                BestPair     = Pair;
+                BestBox      = Other;
+            }
+        }
+
+        if (BestHandle == INDEX_NONE) continue;
+
+        Delta[Axis]         = BestDelta;
+        Result.Kind         = EPlacementSnapKind::Guide;
+        Result.TargetHandle = BestHandle;
+
+        if (OutGuides)
+        {
+            FPlacementGuide& Guide = OutGuides->AddDefaulted_GetRef();
+            Guide.From         = Self.GetCenter();
+            Guide.To           = BestBox.GetCenter();
+            Guide.To[Axis]     = BoxFeature(BestBox, BestPair % 3, Axis);
+            Guide.Axis         = Axis;
+            Guide.TargetHandle = BestHandle;
+        }
+    }
+
+    Result.Location += Delta;
+
+    // Guides start on the aligned preview, so shift them by the final offset on every axis
+    for (int32 i = FirstGuide; OutGuides && i < OutGuides->Num(); i++)
+    {
+        FPlacementGuide& Guide = (*OutGuides)[i];
+        Guide.From += Delta;
+        Guide.From[Guide.Axis] = Guide.To[Guide.Axis];
+    }
+}
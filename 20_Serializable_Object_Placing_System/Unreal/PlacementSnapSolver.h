@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EPlacementGridMode.h"
+#include "PlacementSocketComponent.h"
+#include "PlacementSpatialIndex.h"
+
+enum class EPlacementSnapKind : uint8
+{
+    None,
+    Grid,
+    Socket,
+    Guide,
+};
+
+// Everything the solver needs about the preview, after surface alignment
+struct FPlacementSnapRequest
+{
+    FVector Location = FVector::ZeroVector;
+    FQuat   Rotation = FQuat::Identity;
+    FVector Scale = FVector::OneVector;
+    FVector SurfaceNormal = FVector::UpVector;
+    FBox    LocalBox = FBox(EForceInit::ForceInitToZero);
+    TArrayView<const FPlacementSocketData> Sockets;
+    EPlacementGridMode GridMode = EPlacementGridMode::None;
+    FVector GridCellSize = FVector::ZeroVector;
+    FTransform GridOrigin = FTransform::Identity; // Frame of the Local grid, usually the surface actor
+    int32 IgnoreHandle = INDEX_NONE;              // Actor being edited, so it doesn't snap to itself
+};
+
+struct FPlacementSnapResult
+{
+    FVector Location = FVector::ZeroVector;
+    FQuat   Rotation = FQuat::Identity;
+    EPlacementSnapKind Kind = EPlacementSnapKind::None;
+    int32 TargetHandle = INDEX_NONE;
+    int32 SocketIndex = INDEX_NONE;
+    int32 TargetSocketIndex = INDEX_NONE;
+};
+
+// Line between the aligned feature of the preview and the neighbour it was aligned to
+struct FPlacementGuide
+{
+    FVector From = FVector::ZeroVector;
+    FVector To = FVector::ZeroVector;
+    int32 Axis = 0;
+    int32 TargetHandle = INDEX_NONE;
+};
+
+/* --------------------------------------------------------------------------
+   Snapping for the placement preview, solved in priority order:
+
+   • Socket: a preview socket within SocketRadius of a compatible socket on a nearby placed
+     actor connects to it (locations meet, normals face each other). Candidates come from an
+     FPlacementSpatialIndex query around the preview.
+   • Grid: otherwise the pivot snaps to a World or Local (surface actor) grid. The axis along
+     the surface normal is left to the surface offset.
+   • Guide: otherwise min / center / max of the preview's bounds align to a neighbour's within
+     GuideTolerance, per axis along the surface, reporting the guide lines.
+
+   Pure data in, pure data out: ties are broken by handle and socket order, never by query or
+   map order, so the same input always gives the same result (see the LVN.Placement.Snap tests).
+   -------------------------------------------------------------------------- */
+class MECHANICS_TEST_LVN_API FPlacementSnapSolver
+{
+public:
+    explicit FPlacementSnapSolver(const FPlacementSpatialIndex& InIndex) : Index(&InIndex) {}
+
+    float SocketRadius   = 35.f;
+    float MaxSocketAngle = 90.f;
+    float GuideRadius    = 200.f;
+    float GuideTolerance = 10.f;
+
+    // Caches the world sockets of an indexed actor. Call again whenever it moves.
+    void SetSockets(int32 Handle, TArrayView<const FPlacementSocketData> LocalSockets, const FTransform& ActorTransform);
+    void RemoveSockets(int32 Handle) { SocketsByHandle.Remove(Handle); }
+    void Reset() { SocketsByHandle.Reset(); }
+
+    FPlacementSnapResult Solve(const FPlacementSnapRequest& Request, TArray<FPlacementGuide>* OutGuides = nullptr) const;
+
+private:
+    struct FWorldSocket
+    {
+        FPlacementSocketData Data;
+        FVector Location = FVector::ZeroVector;
+        FVector Normal = FVector::ForwardVector;
+    };
+
+    bool SnapToSocket(const FPlacementSnapRequest& Request, FPlacementSnapResult& Result) const;
+    static bool SnapToGrid(const FPlacementSnapRequest& Request, FPlacementSnapResult& Result);
+    void AlignToNeighbours(const FPlacementSnapRequest& Request, FPlacementSnapResult& Result, TArray<FPlacementGuide>* OutGuides) const;
+
+    const FPlacementSpatialIndex* Index;
+    TMap<int32, TArray<FWorldSocket>> SocketsByHandle;
+    mutable TArray<int32> Candidates;
+};
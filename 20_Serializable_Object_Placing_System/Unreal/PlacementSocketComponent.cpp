@@ -0,0 +1,25 @@
+#include "PlacementSocketComponent.h"
+#include "GameFramework/Actor.h"
+
+void UPlacementSocketComponent::Collect(const AActor* Actor, TArray<FPlacementSocketData>& OutSockets)
+{
+    OutSockets.Reset();
+    if (!Actor) return;
+
+    TArray<UPlacementSocketComponent*> Found;
+    Actor->GetComponents<UPlacementSocketComponent>(Found);
+
+    const FTransform ActorWorldInverse = Actor->GetActorTransform().Inverse();
+
+    for (const UPlacementSocketComponent* Socket : Found)
+    {
+        if (!Socket) continue;
+
+        FPlacementSocketData& Data = OutSockets.AddDefaulted_GetRef();
+        Data.Name          = Socket->GetFName();
+        Data.Type          = Socket->SocketType;
+        Data.Accepts       = Socket->Accepts;
+        Data.LocalPosition = ActorWorldInverse.TransformPosition(Socket->GetComponentLocation());
+        Data.LocalNormal   = ActorWorldInverse.TransformVectorNoScale(Socket->GetForwardVector()).GetSafeNormal();
+    }
+}
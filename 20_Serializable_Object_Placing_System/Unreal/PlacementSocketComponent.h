@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "PlacementSocketComponent.generated.h"
+
+// Plain socket description used by FPlacementSnapSolver, so the solver never touches actors
+struct MECHANICS_TEST_LVN_API FPlacementSocketData
+{
+    FName Name;
+    FName Type;
+    TArray<FName> Accepts;
+    FVector LocalPosition = FVector::ZeroVector;
+    FVector LocalNormal = FVector::ForwardVector;
+
+    bool AcceptsType(const FName& OtherType) const { return Accepts.Num() == 0 || Accepts.Contains(OtherType); }
+
+    static bool Compatible(const FPlacementSocketData& A, const FPlacementSocketData& B)
+    {
+        return A.AcceptsType(B.Type) && B.AcceptsType(A.Type);
+    }
+};
+
+// Snap socket authored on a placeable actor. Add it to the Blueprint, place it on the connecting face and point
+// its X axis outwards. Two sockets connect when each accepts the other's type.
+// e.g. a wall piece with "Edge" sockets on both sides, or a crate with "Top" (X up) accepting "Bottom" (X down).
+UCLASS(ClassGroup = "Placement", Meta = (BlueprintSpawnableComponent))
+class MECHANICS_TEST_LVN_API UPlacementSocketComponent : public USceneComponent
+{
+    GENERATED_BODY()
+
+public:
+
+    // Socket kind, matched against the other socket's Accepts list
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Placement|Socket")
+    FName SocketType = FName("Edge");
+
+    // Socket types this one connects to. Empty accepts any type.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Placement|Socket")
+    TArray<FName> Accepts;
+
+    // Collects the actor's sockets in actor space (unscaled), in component order
+    static void Collect(const AActor* Actor, TArray<FPlacementSocketData>& OutSockets);
+};
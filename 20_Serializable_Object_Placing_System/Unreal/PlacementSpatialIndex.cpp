@@ -0,0 +1,231 @@
+#include "PlacementSpatialIndex.h"
+#include "Components/MeshComponent.h"
+#include "GameFramework/Actor.h"
+
+FPlacementBox FPlacementBox::FromLocalBox(const FBox& LocalBox, const FTransform& Transform, float Shrink)
+{
+    return FPlacementBox(
+        Transform.TransformPosition(LocalBox.GetCenter()),
+        LocalBox.GetExtent() * Transform.GetScale3D().GetAbs() * Shrink,
+        Transform.GetRotation());
+}
+
+float FPlacementBox::ExtentAlong(const FVector& Direction) const
+{
+    return FMath::Abs(FVector::DotProduct(Rotation.GetAxisX(), Direction)) * Extent.X
+         + FMath::Abs(FVector::DotProduct(Rotation.GetAxisY(), Direction)) * Extent.Y
+         + FMath::Abs(FVector::DotProduct(Rotation.GetAxisZ(), Direction)) * Extent.Z;
+}
+
+FBox FPlacementBox::GetAABB() const
+{
+    const FVector Half(ExtentAlong(FVector::XAxisVector), ExtentAlong(FVector::YAxisVector), ExtentAlong(FVector::ZAxisVector));
+    return FBox(Center - Half, Center + Half);
+}
+
+bool FPlacementBox::Intersects(const FPlacementBox& Other) const
+{
+    const FVector A[3] = { Rotation.GetAxisX(), Rotation.GetAxisY(), Rotation.GetAxisZ() };
+    const FVector B[3] = { Other.Rotation.GetAxisX(), Other.Rotation.GetAxisY(), Other.Rotation.GetAxisZ() };
+    const FVector T = Other.Center - Center;
+
+    auto Separated = [this, &Other, &T](const FVector& Axis)
+    {
+        // Parallel edges give a zero cross product, already covered by the face axes
+        if (Axis.SizeSquared() < UE_KINDA_SMALL_NUMBER) return false;
+        return FMath::Abs(FVector::DotProduct(T, Axis)) > ExtentAlong(Axis) + Other.ExtentAlong(Axis);
+    };
+
+    for (int32 i = 0; i < 3; i++)
+    {
+        if (Separated(A[i]) || Separated(B[i])) return false;
+    }
+
+    for (int32 i = 0; i < 3; i++)
+    {
+        for (int32 j = 0; j < 3; j++)
+        {
+            if (Separated(FVector::CrossProduct(A[i], B[j]))) return false;
+        }
+    }
+
+    return true;
+}
+
+FPlacementSpatialIndex::FPlacementSpatialIndex(float InCellSize)
+    : CellSize(FMath::Max(1.f, InCellSize))
+{
+}
+
+int32 FPlacementSpatialIndex::Add(const FPlacementBox& Box, AActor* Owner)
+{
+    const int32 Handle = FreeHandles.Num() > 0 ? FreeHandles.Pop(EAllowShrinking::No) : Items.AddDefaulted();
+
+    FItem& Item = Items[Handle];
+    Item = FItem();
+    Item.Box = Box;
+    Item.Owner = Owner;
+    Item.bAlive = true;
+    GetCellRange(Box, Item.Min, Item.Max);
+
+    Link(Handle, Item.Min, Item.Max);
+    Count++;
+    return Handle;
+}
+
+void FPlacementSpatialIndex::Move(int32 Handle, const FPlacementBox& Box)
+{
+    if (!IsValid(Handle)) return;
+
+    FItem& Item = Items[Handle];
+    Item.Box = Box;
+
+    FIntVector Min, Max;
+    GetCellRange(Box, Min, Max);
+
+    // Most edits stay inside the same cells
+    if (Min != Item.Min || Max != Item.Max)
+    {
+        Unlink(Handle, Item.Min, Item.Max);
+        Link(Handle, Min, Max);
+        Item.Min = Min;
+        Item.Max = Max;
+    }
+}
+
+void FPlacementSpatialIndex::Remove(int32 Handle)
+{
+    if (!IsValid(Handle)) return;
+
+    Unlink(Handle, Items[Handle].Min, Items[Handle].Max);
+    Items[Handle] = FItem();
+    FreeHandles.Add(Handle);
+    Count--;
+}
+
+void FPlacementSpatialIndex::Reset(float InCellSize)
+{
+    Cells.Reset();
+    Items.Reset();
+    FreeHandles.Reset();
+    CellSize = FMath::Max(1.f, InCellSize);
+    Count = 0;
+}
+
+AActor* FPlacementSpatialIndex::GetOwner(int32 Handle) const
+{
+    return IsValid(Handle) ? Items[Handle].Owner.Get() : nullptr;
+}
+
+bool FPlacementSpatialIndex::Overlaps(const FPlacementBox& Box, int32 IgnoreHandle) const
+{
+    return QueryInternal(Box, nullptr, IgnoreHandle, true) > 0;
+}
+
+int32 FPlacementSpatialIndex::Query(const FPlacementBox& Box, TArray<int32>& OutHandles, int32 IgnoreHandle) const
+{
+    OutHandles.Reset();
+    return QueryInternal(Box, &OutHandles, IgnoreHandle, false);
+}
+
+int32 FPlacementSpatialIndex::QueryInternal(const FPlacementBox& Box, TArray<int32>* OutHandles, int32 IgnoreHandle, bool bFirstOnly) const
+{
+    if (Count == 0) return 0;
+
+    FIntVector Min, Max;
+    GetCellRange(Box, Min, Max);
+
+    const uint32 Stamp = ++QueryStamp;
+    int32 Found = 0;
+
+    for (int32 X = Min.X; X <= Max.X; X++)
+    for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+    for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+    {
+        const TArray<int32>* Cell = Cells.Find(FIntVector(X, Y, Z));
+        if (!Cell) continue;
+
+        for (const int32 Handle : *Cell)
+        {
+            const FItem& Item = Items[Handle];
+            if (Handle == IgnoreHandle || Item.Stamp == Stamp) continue;
+
+            Item.Stamp = Stamp;
+            if (!Item.Box.Intersects(Box)) continue;
+
+            Found++;
+            if (OutHandles) OutHandles->Add(Handle);
+            if (bFirstOnly) return Found;
+        }
+    }
+
+    return Found;
+}
+
+void FPlacementSpatialIndex::GetCellRange(const FPlacementBox& Box, FIntVector& OutMin, FIntVector& OutMax) const
+{
+    const FBox AABB = Box.GetAABB();
+    OutMin = FIntVector(
+        FMath::FloorToInt32(AABB.Min.X / CellSize),
+        FMath::FloorToInt32(AABB.Min.Y / CellSize),
+        FMath::FloorToInt32(AABB.Min.Z / CellSize));
+    OutMax = FIntVector(
+        FMath::FloorToInt32(AABB.Max.X / CellSize),
+        FMath::FloorToInt32(AABB.Max.Y / CellSize),
+        FMath::FloorToInt32(AABB.Max.Z / CellSize));
+}
+
+void FPlacementSpatialIndex::Link(int32 Handle, const FIntVector& Min, const FIntVector& Max)
+{
+    for (int32 X = Min.X; X <= Max.X; X++)
+    for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+    for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+    {
+        Cells.FindOrAdd(FIntVector(X, Y, Z)).Add(Handle);
+    }
+}
+
+void FPlacementSpatialIndex::Unlink(int32 Handle, const FIntVector& Min, const FIntVector& Max)
+{
+    for (int32 X = Min.X; X <= Max.X; X++)
+    for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+    for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+    {
+        const FIntVector Key(X, Y, Z);
+        TArray<int32>* Cell = Cells.Find(Key);
+        if (!Cell) continue;
+
+        // Order inside a cell doesn't matter
+        Cell->RemoveSingleSwap(Handle, EAllowShrinking::No);
+        if (Cell->Num() == 0)
+        {
+            Cells.Remove(Key);
+        }
+    }
+}
+
+FBox FPlacementSpatialIndex::MeasureLocalBox(const AActor* Actor)
+{
+    FBox LocalBox(EForceInit::ForceInitToZero);
+    if (!Actor) return LocalBox;
+
+    const FTransform ActorWorldInverse = Actor->GetActorTransform().Inverse();
+
+    TArray<UMeshComponent*> Meshes;
+    Actor->GetComponents<UMeshComponent>(Meshes);
+
+    for (const UMeshComponent* Mesh : Meshes)
+    {
+        if (!Mesh) continue;
+
+        const FTransform ComponentToActorLocal = Mesh->GetComponentTransform() * ActorWorldInverse;
+        LocalBox += Mesh->CalcLocalBounds().GetBox().TransformBy(ComponentToActorLocal);
+    }
+
+    if (!LocalBox.IsValid)
+    {
+        LocalBox = FBox::BuildAABB(FVector::ZeroVector, FVector(50.f));
+    }
+
+    return LocalBox;
+}
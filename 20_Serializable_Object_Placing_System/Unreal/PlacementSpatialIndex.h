@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+
+// Oriented bounding box of a placed actor (or the preview), in world space
+struct MECHANICS_TEST_LVN_API FPlacementBox
+{
+    FVector Center = FVector::ZeroVector;
+    FVector Extent = FVector::ZeroVector;
+    FQuat   Rotation = FQuat::Identity;
+
+    FPlacementBox() = default;
+    FPlacementBox(const FVector& InCenter, const FVector& InExtent, const FQuat& InRotation)
+        : Center(InCenter), Extent(InExtent), Rotation(InRotation) {}
+
+    // Places a box measured in actor space (see FPlacementSpatialIndex::MeasureLocalBox) at a transform
+    static FPlacementBox FromLocalBox(const FBox& LocalBox, const FTransform& Transform, float Shrink = 1.f);
+
+    // Half size of the box projected on a direction
+    float ExtentAlong(const FVector& Direction) const;
+
+    FBox GetAABB() const;
+
+    // Separating axis test between two oriented boxes (15 axes)
+    bool Intersects(const FPlacementBox& Other) const;
+};
+
+/* --------------------------------------------------------------------------
+   Uniform grid of placed actors' cached oriented boxes.
+
+   • Each actor is registered once with its box and kept in every cell its world AABB
+     touches. Only placing, moving and removing touch the grid, nothing is measured per tick.
+   • Queries walk the cells under the query box, dedupe with a per query stamp and run an
+     OBB / OBB test. Results go into a caller owned array, so a query allocates nothing.
+   • Handles are plain ints (recycled after Remove), so the index can be driven without
+     actors, which is what the LVN.Placement.SpatialIndex automation tests do.
+   -------------------------------------------------------------------------- */
+class MECHANICS_TEST_LVN_API FPlacementSpatialIndex
+{
+public:
+    explicit FPlacementSpatialIndex(float InCellSize = 200.f);
+
+    int32 Add(const FPlacementBox& Box, AActor* Owner = nullptr);
+    void  Move(int32 Handle, const FPlacementBox& Box);
+    void  Remove(int32 Handle);
+    void  Reset(float InCellSize);
+    void  Reset() { Reset(CellSize); }
+
+    bool    IsValid(int32 Handle) const { return Items.IsValidIndex(Handle) && Items[Handle].bAlive; }
+    AActor* GetOwner(int32 Handle) const;
+    FPlacementBox GetBox(int32 Handle) const { return IsValid(Handle) ? Items[Handle].Box : FPlacementBox(); }
+    int32   Num() const { return Count; }
+    float   GetCellSize() const { return CellSize; }
+
+    // True as soon as one registered box intersects the query box
+    bool  Overlaps(const FPlacementBox& Box, int32 IgnoreHandle = INDEX_NONE) const;
+
+    // Fills OutHandles (reset first) with every box intersecting the query box
+    int32 Query(const FPlacementBox& Box, TArray<int32>& OutHandles, int32 IgnoreHandle = INDEX_NONE) const;
+
+    // Combined mesh bounds in actor space, unscaled (50 unit cube if the actor has no mesh)
+    static FBox MeasureLocalBox(const AActor* Actor);
+
+private:
+    struct FItem
+    {
+        FPlacementBox Box;
+        TWeakObjectPtr<AActor> Owner;
+        FIntVector Min = FIntVector::ZeroValue;
+        FIntVector Max = FIntVector::ZeroValue;
+        mutable uint32 Stamp = 0;
+        bool bAlive = false;
+    };
+
+    int32 QueryInternal(const FPlacementBox& Box, TArray<int32>* OutHandles, int32 IgnoreHandle, bool bFirstOnly) const;
+    void  GetCellRange(const FPlacementBox& Box, FIntVector& OutMin, FIntVector& OutMax) const;
+    void  Link(int32 Handle, const FIntVector& Min, const FIntVector& Max);
+    void  Unlink(int32 Handle, const FIntVector& Min, const FIntVector& Max);
+
+    TMap<FIntVector, TArray<int32>> Cells;
+    TArray<FItem> Items;
+    TArray<int32> FreeHandles;
+    float CellSize = 200.f;
+    int32 Count = 0;
+    mutable uint32 QueryStamp = 0;
+};
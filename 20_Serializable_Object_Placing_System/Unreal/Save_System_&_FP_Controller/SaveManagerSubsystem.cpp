@@ -4,8 +4,12 @@
 #include "GUIDComponent.h"
 #include "SaveableTransformComponent.h"
 #include "ObjectPlacementManager.h"
+#include "SaveSchemaRegistry.h"
 #include "Kismet/GameplayStatics.h"
 #include "EngineUtils.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
 UObjectPlacementManager* USaveManagerSubsystem::GetPlacementManager() const
 {
@@ -18,6 +22,18 @@ UObjectPlacementManager* USaveManagerSubsystem::GetPlacementManager() const
 	return PC->GetPawn()->FindComponentByClass<UObjectPlacementManager>();
 }
 
+void USaveManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// The journal file only survives a session that didn't shut down cleanly (see UObjectPlacementManager::EndPlay)
+	const FString JournalPath = GetJournalPath();
+	if (!FFileHelper::LoadFileToString(PendingRecovery, *JournalPath)) return;
+
+	IFileManager::Get().Delete(*JournalPath);
+	UE_LOG(LogTemp, Warning, TEXT("Found unsaved placement changes from the last session. They will be replayed on load."));
+}
+
 void USaveManagerSubsystem::SaveGame()
 {
 	if (UObjectPlacementManager* PM = GetPlacementManager())
@@ -49,11 +65,19 @@ void USaveManagerSubsystem::SaveGame()
 		Entry.GUID     = GUIDComp->GUID;
 		Entry.Type     = Saveable->GetSaveDataType();
 		Entry.JsonData = Saveable->CaptureState();
+		Entry.Version  = FSaveSchemaRegistry::Get().GetVersion(Entry.Type);
 
 		SaveData->Entries.Add(Entry);
 	}
 
-	UGameplayStatics::SaveGameToSlot(SaveData, TEXT("MainSave"), 0);
+	if (UGameplayStatics::SaveGameToSlot(SaveData, TEXT("MainSave"), 0))
+	{
+		// Everything in the journal is in the save now
+		PendingRecovery.Empty();
+		if (UObjectPlacementManager* PM = GetPlacementManager())
+			PM->GetJournal().MarkSaved();
+	}
+
 	UE_LOG(LogTemp, Warning, TEXT("Saving %d entries"), SaveData->Entries.Num());
 }
 
@@ -61,11 +85,20 @@ void USaveManagerSubsystem::LoadGame()
 {
 	USaveGameData* SaveData = Cast<USaveGameData>(
 		UGameplayStatics::LoadGameFromSlot(TEXT("MainSave"), 0));
-	if (!SaveData) return;
+	if (!SaveData)
+	{
+		ReplayPendingJournal();
+		return;
+	}
 
 	UWorld* World = GetWorld();
 	if (!World) return;
 
+	// Older entries are upgraded to their type's current schema (and current type name) before anyone reads them
+	const int32 Upgraded = FSaveSchemaRegistry::Get().MigrateAll(SaveData->Entries);
+	if (Upgraded > 0)
+		UE_LOG(LogTemp, Log, TEXT("[SaveManager] Migrated %d entries from an older save format."), Upgraded);
+
 	if (UObjectPlacementManager* PM = GetPlacementManager())
 		PM->LoadPlacedObjects(SaveData);
 
@@ -93,11 +126,46 @@ void USaveManagerSubsystem::LoadGame()
 		}
 	}
 
+	ReplayPendingJournal();
+
 	UE_LOG(LogTemp, Warning, TEXT("Loaded %d entries"), SaveData->Entries.Num());
 }
 
+void USaveManagerSubsystem::ReplayPendingJournal()
+{
+	if (PendingRecovery.IsEmpty()) return;
+
+	UObjectPlacementManager* PM = GetPlacementManager();
+	if (!PM) return;
+
+	const int32 Replayed = PM->GetJournal().Replay(PendingRecovery);
+	PendingRecovery.Empty();
+
+	UE_LOG(LogTemp, Warning, TEXT("Recovered %d unsaved placement changes"), Replayed);
+}
+
+void USaveManagerSubsystem::WritePlacementJournal(const FPlacementJournal& Journal)
+{
+	const FString JournalPath = GetJournalPath();
+
+	if (Journal.GetRecoveryCount() == 0)
+	{
+		IFileManager::Get().Delete(*JournalPath, false, false, true);
+		return;
+	}
+
+	FFileHelper::SaveStringToFile(Journal.SerializeRecoveryLog(), *JournalPath);
+}
+
+FString USaveManagerSubsystem::GetJournalPath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SaveGames"), TEXT("MainSave.journal.json"));
+}
+
 void USaveManagerSubsystem::DeleteSaveGame()
 {
+	PendingRecovery.Empty();
+
 	// Clear all placed actors from the scene before wiping the file.
 	if (UObjectPlacementManager* PM = GetPlacementManager())
 		PM->ClearAllPlacedObjects();
@@ -4,12 +4,16 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "SaveManagerSubsystem.generated.h"
 
+class FPlacementJournal;
+
 UCLASS()
 class MECHANICS_TEST_LVN_API USaveManagerSubsystem : public UGameInstanceSubsystem
 {
 	GENERATED_BODY()
 
 public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
 	UFUNCTION(BlueprintCallable)
 	void SaveGame();
 
@@ -22,8 +26,19 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void ResetAllToDefault();
 
+	// Mirrors the placement journal's recovery log to disk after every change (bound by UObjectPlacementManager)
+	void WritePlacementJournal(const FPlacementJournal& Journal);
+
 private:
 
 	// Finds the ObjectPlacementManager from the player pawn.
 	class UObjectPlacementManager* GetPlacementManager() const;
+
+	// Crash recovery: replays the placement journal of the last session on top of the save just loaded
+	void ReplayPendingJournal();
+
+	static FString GetJournalPath();
+
+	// Placement changes a crashed session never saved, replayed by the next LoadGame
+	FString PendingRecovery;
 };
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include "SaveSchemaRegistry.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+FSaveSchemaRegistry& FSaveSchemaRegistry::Get()
+{
+    static FSaveSchemaRegistry Registry;
+    return Registry;
+}
+
+FSaveSchemaRegistry& FSaveSchemaRegistry::Register(const FString& Type, int32 Version, const TArray<FString>& OldNames)
+{
+    Schemas.FindOrAdd(Type).Version = FMath::Max(Version, 1);
+    for (const FString& OldName : OldNames)
+    {
+        AddAlias(OldName, Type);
+    }
+    return *this;
+}
+
+FSaveSchemaRegistry& FSaveSchemaRegistry::AddAlias(const FString& OldName, const FString& Type)
+{
+    Aliases.Add(OldName, Type);
+    return *this;
+}
+
+FSaveSchemaRegistry& FSaveSchemaRegistry::AddMigration(const FString& Type, int32 FromVersion, FSaveMigration Migration)
+{
+    Schemas.FindOrAdd(Type).Migrations.Add(FromVersion, MoveTemp(Migration));
+    return *this;
+}
+
+int32 FSaveSchemaRegistry::GetVersion(const FString& Type) const
+{
+    const FSchema* Schema = Schemas.Find(ResolveType(Type));
+    return Schema ? Schema->Version : 1;
+}
+
+FString FSaveSchemaRegistry::ResolveType(const FString& Type) const
+{
+    const FString* Renamed = Aliases.Find(Type);
+    return Renamed ? *Renamed : Type;
+}
+
+bool FSaveSchemaRegistry::Migrate(FSaveDataEntry& Entry) const
+{
+    const FString Type = ResolveType(Entry.Type);
+    const FSchema* Schema = Schemas.Find(Type);
+    const int32 Current = Schema ? Schema->Version : 1;
+    const int32 Version = FMath::Max(Entry.Version, 1);
+
+    if (Version > Current)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[SaveSchemas] %s v%d (%s) was written by a newer build (v%d). Entry skipped."),
+            *Type, Version, *Entry.GUID.ToString(), Current);
+        return false;
+    }
+
+    if (Version < Current)
+    {
+        TSharedPtr<FJsonObject> Data;
+        const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Entry.JsonData);
+        if (!FJsonSerializer::Deserialize(Reader, Data) || !Data.IsValid())
+        {
+            UE_LOG(LogTemp, Error, TEXT("[SaveSchemas] %s (%s) has unreadable JSON. Entry skipped."), *Type, *Entry.GUID.ToString());
+            return false;
+        }
+
+        for (int32 V = Version; V < Current; V++)
+        {
+            const FSaveMigration* Migration = Schema->Migrations.Find(V);
+            if (!Migration)
+            {
+                UE_LOG(LogTemp, Error, TEXT("[SaveSchemas] %s has no migration from v%d. Entry %s skipped."), *Type, V, *Entry.GUID.ToString());
+                return false;
+            }
+            (*Migration)(*Data);
+        }
+
+        FString Json;
+        const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+        FJsonSerializer::Serialize(Data.ToSharedRef(), Writer);
+        Entry.JsonData = Json;
+    }
+
+    Entry.Type = Type;
+    Entry.Version = Current;
+    return true;
+}
+
+int32 FSaveSchemaRegistry::MigrateAll(TArray<FSaveDataEntry>& Entries) const
+{
+    int32 Upgraded = 0;
+    Entries.RemoveAll([this, &Upgraded](FSaveDataEntry& Entry)
+    {
+        const int32 Before = FMath::Max(Entry.Version, 1);
+        const FString TypeBefore = Entry.Type;
+        if (!Migrate(Entry)) return true;
+        if (Before != Entry.Version || !TypeBefore.Equals(Entry.Type, ESearchCase::CaseSensitive)) Upgraded++;
+        return false;
+    });
+    return Upgraded;
+}
+
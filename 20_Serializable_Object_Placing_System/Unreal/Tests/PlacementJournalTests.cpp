@@ -0,0 +1,257 @@
+#include "Misc/AutomationTest.h"
+#include "PlacementJournal.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Random place / move / remove / batch / undo / redo sequences against an in-memory stand-in for the level:
+// every undo and redo must land on the expected state, and the recovery log must replay to the same world.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Placement; Quit" -nullrhi -unattended
+
+namespace PlacementJournalTests
+{
+	struct FState
+	{
+		FName   PrefabID;
+		FVector Location = FVector::ZeroVector;
+		FQuat   Rotation = FQuat::Identity;
+		FVector Scale = FVector::OneVector;
+		bool    bRemoved = false;
+
+		bool operator==(const FState& Other) const
+		{
+			return PrefabID == Other.PrefabID && Location == Other.Location && Rotation == Other.Rotation
+				&& Scale == Other.Scale && bRemoved == Other.bRemoved;
+		}
+	};
+
+	// In-memory stand-in for the level, so random sequences run headless
+	using FWorld = TMap<FGuid, FState>;
+
+	void ApplyToWorld(FWorld& World, const FPlacementCommand& C)
+	{
+		FState* State = World.Find(C.GUID);
+		const FState Spawned{ C.PrefabID, C.ToLocation, C.ToRotation, C.Scale, false };
+
+		switch (C.Type)
+		{
+			case EPlacementCommandType::Place:
+				World.Add(C.GUID, Spawned);
+				break;
+			case EPlacementCommandType::Delete:
+				World.Remove(C.GUID);
+				break;
+			case EPlacementCommandType::Transform:
+				if (!State) break;
+				State->Location = C.ToLocation;
+				State->Rotation = C.ToRotation;
+				break;
+			case EPlacementCommandType::Remove:
+				if (State) State->bRemoved = true;
+				break;
+			case EPlacementCommandType::Restore:
+				if (State) State->bRemoved = false;
+				else World.Add(C.GUID, Spawned);
+				break;
+		}
+	}
+
+	bool Equal(const FWorld& A, const FWorld& B)
+	{
+		return A.OrderIndependentCompareEqual(B);
+	}
+
+	// 0-24 place, 25-49 move (nudge), 50-59 remove. Returns false when there was nothing to move or remove.
+	bool RandomOperation(FWorld& World, FPlacementJournal& Journal, FRandomStream& Random, int32 Roll, double Time, int32& NextId)
+	{
+		if (Roll < 25 || World.Num() == 0)
+		{
+			const FTransform Transform(FRotator(0.f, Random.RandRange(0, 7) * 45.f, 0.f),
+				FVector(Random.RandRange(-20, 19) * 100.f, Random.RandRange(-20, 19) * 100.f, 0.f));
+			const FPlacementCommand Place = FPlacementCommand::Place(FGuid(0, 0, 0, ++NextId),
+				Random.RandRange(0, 1) ? FName(TEXT("Crate")) : FName(TEXT("Lamp")), Transform);
+			ApplyToWorld(World, Place);
+			Journal.Record(Place, Time);
+			return true;
+		}
+
+		// Pick a live actor deterministically from the sorted GUIDs
+		TArray<FGuid> Live;
+		for (const TPair<FGuid, FState>& Pair : World)
+			if (!Pair.Value.bRemoved) Live.Add(Pair.Key);
+		if (Live.Num() == 0) return false;
+
+		Live.Sort([](const FGuid& A, const FGuid& B) { return A.D < B.D; });
+		const FGuid GUID = Live[Random.RandRange(0, Live.Num() - 1)];
+		const FState State = World[GUID];
+		const FTransform Current(State.Rotation, State.Location, State.Scale);
+
+		FPlacementCommand Command;
+		if (Roll < 50)
+		{
+			const FVector Nudge(Random.RandRange(-1, 1) * 25.f, Random.RandRange(-1, 1) * 25.f, 0.f);
+			Command = FPlacementCommand::Move(GUID, State.PrefabID, State.Location, State.Rotation,
+				FTransform(State.Rotation, State.Location + Nudge, State.Scale));
+		}
+		else
+		{
+			Command = FPlacementCommand::Remove(GUID, State.PrefabID, Current);
+		}
+
+		ApplyToWorld(World, Command);
+		Journal.Record(Command, Time);
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlacementJournalRandomSequencesTest, "LVN.Placement.Journal.RandomSequences", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPlacementJournalRandomSequencesTest::RunTest(const FString& Parameters)
+{
+	using namespace PlacementJournalTests;
+	constexpr int32 Sequences = 200;
+	constexpr int32 Length = 60;
+
+	FRandomStream Random(7);
+	int32 UndoFailures = 0, RedoFailures = 0, ReplayFailures = 0, RoundTripFailures = 0;
+	int32 TotalMerges = 0;
+
+	for (int32 Sequence = 0; Sequence < Sequences; Sequence++)
+	{
+		FWorld World;
+		FPlacementJournal Journal([&World](const FPlacementCommand& C) { ApplyToWorld(World, C); });
+		Journal.MaxMemoryBytes = 0;
+
+		TArray<TPair<FWorld, FWorld>> Done, Undone; // (before, after) of every step
+		const FWorld Initial = World;
+		double Time = 0.0;
+		int32 NextId = 0;
+
+		for (int32 Op = 0; Op < Length; Op++)
+		{
+			const int32 Roll = Random.RandRange(0, 99);
+			Time += Random.RandRange(0, 1) ? 0.3 : 2.0;
+
+			if (Roll < 70)
+			{
+				const FWorld Before = World;
+				const int32 UndoCount = Journal.GetUndoCount();
+				const bool bBatch = Roll >= 60;
+
+				if (bBatch) Journal.BeginBatch(TEXT("Batch"), Time);
+				const int32 Count = bBatch ? Random.RandRange(2, 4) : 1;
+				int32 Recorded = 0;
+				for (int32 i = 0; i < Count; i++)
+					if (RandomOperation(World, Journal, Random, bBatch ? Random.RandRange(0, 59) : Roll, Time, NextId)) Recorded++;
+				if (bBatch) Journal.EndBatch();
+
+				if (Recorded == 0) continue; // Nothing left to move or remove
+
+				Undone.Reset();
+				if (Journal.GetUndoCount() > UndoCount)
+				{
+					Done.Emplace(Before, World);
+				}
+				else if (Done.Num() > 0)
+				{
+					Done.Last().Value = World;
+					TotalMerges++;
+				}
+			}
+			else if (Roll < 85)
+			{
+				const bool bUndid = Journal.Undo();
+				if (bUndid != (Done.Num() > 0)) { UndoFailures++; continue; }
+				if (!bUndid) continue;
+
+				Undone.Add(Done.Pop());
+				if (!Equal(World, Undone.Last().Key)) UndoFailures++;
+			}
+			else
+			{
+				const bool bRedid = Journal.Redo();
+				if (bRedid != (Undone.Num() > 0)) { RedoFailures++; continue; }
+				if (!bRedid) continue;
+
+				Done.Add(Undone.Pop());
+				if (!Equal(World, Done.Last().Value)) RedoFailures++;
+			}
+		}
+
+		// Crash recovery: the serialized log replayed on the initial world rebuilds the session
+		const FWorld Final = World;
+		FWorld Recovered;
+		FPlacementJournal Replayer([&Recovered](const FPlacementCommand& C) { ApplyToWorld(Recovered, C); });
+		Replayer.Replay(Journal.SerializeRecoveryLog());
+		if (!Equal(Recovered, Final)) ReplayFailures++;
+
+		while (Journal.Undo()) {}
+		if (!Equal(World, Initial)) RoundTripFailures++;
+		while (Journal.Redo()) {}
+		if (!Equal(World, Final)) RoundTripFailures++;
+	}
+
+	TestEqual(TEXT("Every undo restores the previous state"), UndoFailures, 0);
+	TestEqual(TEXT("Every redo restores the next state"), RedoFailures, 0);
+	TestEqual(TEXT("Recovery log replays to the same world"), ReplayFailures, 0);
+	TestEqual(TEXT("Undo all / redo all round-trips"), RoundTripFailures, 0);
+	TestTrue(TEXT("Consecutive nudges merged"), TotalMerges > 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlacementJournalMemoryCapTest, "LVN.Placement.Journal.MemoryCap", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPlacementJournalMemoryCapTest::RunTest(const FString& Parameters)
+{
+	using namespace PlacementJournalTests;
+	constexpr int64 Cap = 16 * 1024;
+
+	FWorld World;
+	FPlacementJournal Journal([&World](const FPlacementCommand& C) { ApplyToWorld(World, C); });
+	Journal.MaxMemoryBytes = Cap;
+
+	for (int32 i = 0; i < 500; i++)
+	{
+		const FPlacementCommand Place = FPlacementCommand::Place(FGuid(0, 0, 1, i), TEXT("Crate"), FTransform(FVector(i * 100.f, 0.f, 0.f)));
+		ApplyToWorld(World, Place);
+		Journal.Record(Place, i * 10.0);
+	}
+
+	const int32 Kept = Journal.GetUndoCount();
+	TestTrue(TEXT("The oldest steps are dropped"), Kept < 500);
+	TestTrue(TEXT("Memory stays under the cap"), Journal.GetMemoryBytes() <= Cap);
+	TestEqual(TEXT("Dropped steps are counted"), Journal.GetDroppedSteps(), 500 - Kept);
+
+	// The rest still undo cleanly, down to the oldest kept step
+	while (Journal.Undo()) {}
+	TestEqual(TEXT("Undo stops at the oldest kept step"), World.Num(), 500 - Kept);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlacementJournalNudgeMergeTest, "LVN.Placement.Journal.NudgeMerge", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPlacementJournalNudgeMergeTest::RunTest(const FString& Parameters)
+{
+	using namespace PlacementJournalTests;
+
+	FWorld World;
+	FPlacementJournal Journal([&World](const FPlacementCommand& C) { ApplyToWorld(World, C); });
+	const FGuid GUID(0, 0, 2, 1);
+
+	const FPlacementCommand Place = FPlacementCommand::Place(GUID, TEXT("Crate"), FTransform::Identity);
+	ApplyToWorld(World, Place);
+	Journal.Record(Place, 0.0);
+
+	for (int32 i = 1; i <= 10; i++)
+	{
+		const FPlacementCommand Nudge = FPlacementCommand::Move(GUID, TEXT("Crate"), FVector((i - 1) * 10.f, 0.f, 0.f), FQuat::Identity,
+			FTransform(FVector(i * 10.f, 0.f, 0.f)));
+		ApplyToWorld(World, Nudge);
+		Journal.Record(Nudge, 10.0 + i * 0.1);
+	}
+
+	Journal.Undo();
+	TestEqual(TEXT("Ten quick nudges undo as one step"), Journal.GetUndoCount(), 1);
+	TestTrue(TEXT("Undo returns to the placed pose"), World[GUID].Location == FVector::ZeroVector);
+	TestEqual(TEXT("Moves of the same actor are compacted in the recovery log"), Journal.GetRecoveryCount(), 2);
+	return true;
+}
+
+#endif
@@ -0,0 +1,76 @@
+#include "Misc/AutomationTest.h"
+#include "PerfTesting.h"
+#include "PlacementSnapSolver.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Times what grows with the placed count on a 5000 crate floor: registering a crate in the spatial index and snap solver,
+// then the preview's per-tick snap solve and overlap query, alternating between crate tops (socket snaps) and the gaps
+// between crates. Handles only, like the other placement tests. Compared with PerfBaselines/Placement.json.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Placement.Performance; Quit" -nullrhi -unattended
+
+namespace PlacementPerformanceTests
+{
+	constexpr int32 PlacedCount  = 5000;
+	constexpr int32 PreviewTicks = 2000;
+	constexpr float CellSize     = 200.f;
+	constexpr float Spacing      = 210.f; // Crate size * 2 + 10, as the manager's cell size expects
+
+	const FBox UnitBox(FVector(-50.f), FVector(50.f));
+
+	// Top accepts a Bottom and the other way round, so crates stack
+	TArray<FPlacementSocketData> MakeCrateSockets()
+	{
+		TArray<FPlacementSocketData> Sockets;
+
+		FPlacementSocketData& Top = Sockets.AddDefaulted_GetRef();
+		Top.Name = TEXT("Top"); Top.Type = TEXT("Top"); Top.Accepts = { TEXT("Bottom") };
+		Top.LocalPosition = FVector(0.f, 0.f, 50.f); Top.LocalNormal = FVector::UpVector;
+
+		FPlacementSocketData& Bottom = Sockets.AddDefaulted_GetRef();
+		Bottom.Name = TEXT("Bottom"); Bottom.Type = TEXT("Bottom"); Bottom.Accepts = { TEXT("Top") };
+		Bottom.LocalPosition = FVector(0.f, 0.f, -50.f); Bottom.LocalNormal = FVector::DownVector;
+
+		return Sockets;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlacementPerformancePreviewTest, "LVN.Placement.Performance.Preview", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPlacementPerformancePreviewTest::RunTest(const FString& Parameters)
+{
+	using namespace PlacementPerformanceTests;
+
+	FPlacementSpatialIndex Index(CellSize);
+	FPlacementSnapSolver Solver(Index);
+	const TArray<FPlacementSocketData> CrateSockets = MakeCrateSockets();
+	const int32 Side = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(PlacedCount)));
+
+	FPerfRecorder Recorder;
+	Recorder.Measure(TEXT("AddPlaced"), PlacedCount, [&](int32 i)
+	{
+		const FTransform Crate(FVector((i % Side) * Spacing, (i / Side) * Spacing, 50.f));
+		Solver.SetSockets(Index.Add(FPlacementBox::FromLocalBox(UnitBox, Crate)), CrateSockets, Crate);
+	}, 0);
+
+	FPlacementSnapRequest Request;
+	Request.LocalBox = UnitBox;
+	Request.Sockets  = CrateSockets;
+	TArray<FPlacementGuide> Guides;
+	TArray<int32> Candidates;
+
+	Recorder.Measure(FString::Printf(TEXT("PreviewTick_%dPlaced"), PlacedCount), PreviewTicks, [&](int32 Tick)
+	{
+		// Even ticks rest on a crate, odd ones on the floor halfway to the next
+		const int32 Cell   = (Tick * 7919) % PlacedCount;
+		const bool  bOnTop = (Tick & 1) == 0;
+		Request.Location = FVector((Cell % Side + (bOnTop ? 0.f : 0.5f)) * Spacing, (Cell / Side) * Spacing, bOnTop ? 155.f : 50.f);
+
+		const FPlacementSnapResult Result = Solver.Solve(Request, &Guides);
+		// Shrunk like the manager's preview box, so resting on a crate is no overlap
+		Index.Query(FPlacementBox::FromLocalBox(UnitBox, FTransform(Result.Rotation, Result.Location), 0.85f), Candidates);
+	});
+
+	return Recorder.CheckBaseline(*this, TEXT("Placement"), __FILE__);
+}
+
+#endif
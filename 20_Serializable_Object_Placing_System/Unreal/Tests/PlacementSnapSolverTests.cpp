@@ -0,0 +1,176 @@
+#include "Misc/AutomationTest.h"
+#include "PlacementSnapSolver.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Headless checks of every snap kind and of tie-breaking: the solver only sees boxes and sockets registered by handle.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Placement; Quit" -nullrhi -unattended
+
+namespace PlacementSnapSolverTests
+{
+	const FBox UnitBox(FVector(-50.f), FVector(50.f));
+
+	FPlacementSnapRequest MakeRequest()
+	{
+		FPlacementSnapRequest Request;
+		Request.LocalBox     = UnitBox;
+		Request.GridCellSize = FVector(50.f);
+		return Request;
+	}
+
+	// Top accepts a Bottom and the other way round, so crates stack
+	TArray<FPlacementSocketData> MakeCrateSockets()
+	{
+		TArray<FPlacementSocketData> Sockets;
+
+		FPlacementSocketData& Top = Sockets.AddDefaulted_GetRef();
+		Top.Name = TEXT("Top"); Top.Type = TEXT("Top"); Top.Accepts = { TEXT("Bottom") };
+		Top.LocalPosition = FVector(0.f, 0.f, 50.f); Top.LocalNormal = FVector::UpVector;
+
+		FPlacementSocketData& Bottom = Sockets.AddDefaulted_GetRef();
+		Bottom.Name = TEXT("Bottom"); Bottom.Type = TEXT("Bottom"); Bottom.Accepts = { TEXT("Top") };
+		Bottom.LocalPosition = FVector(0.f, 0.f, -50.f); Bottom.LocalNormal = FVector::DownVector;
+
+		return Sockets;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlacementSnapGridTest, "LVN.Placement.Snap.Grid", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPlacementSnapGridTest::RunTest(const FString& Parameters)
+{
+	using namespace PlacementSnapSolverTests;
+	FPlacementSpatialIndex Index(200.f);
+	FPlacementSnapSolver Solver(Index);
+	FPlacementSnapRequest Request = MakeRequest();
+
+	Request.Location = FVector(26.f, 74.f, 50.f);
+	Request.GridMode = EPlacementGridMode::World;
+	FPlacementSnapResult Result = Solver.Solve(Request);
+	TestTrue(TEXT("World grid snaps"), Result.Kind == EPlacementSnapKind::Grid);
+	TestTrue(TEXT("World grid snaps along the surface only"), Result.Location.Equals(FVector(50.f, 50.f, 50.f), 0.01f));
+
+	Request.GridMode   = EPlacementGridMode::Local;
+	Request.GridOrigin = FTransform(FRotator(0.f, 90.f, 0.f), FVector(1000.f, 0.f, 0.f));
+	Request.Location   = FVector(980.f, 90.f, 50.f);
+	Result = Solver.Solve(Request);
+	TestTrue(TEXT("Local grid snaps"), Result.Kind == EPlacementSnapKind::Grid);
+	TestTrue(TEXT("Local grid follows the surface actor"), Result.Location.Equals(FVector(1000.f, 100.f, 50.f), 0.01f));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlacementSnapSocketTest, "LVN.Placement.Snap.Socket", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPlacementSnapSocketTest::RunTest(const FString& Parameters)
+{
+	using namespace PlacementSnapSolverTests;
+	FPlacementSpatialIndex Index(200.f);
+	FPlacementSnapSolver Solver(Index);
+	FPlacementSnapRequest Request = MakeRequest();
+
+	// Stacking: crate bottom socket onto crate top socket
+	const TArray<FPlacementSocketData> CrateSockets = MakeCrateSockets();
+	const FTransform CrateTransform(FVector(0.f, 0.f, 50.f));
+	const int32 Crate = Index.Add(FPlacementBox::FromLocalBox(UnitBox, CrateTransform));
+	Solver.SetSockets(Crate, CrateSockets, CrateTransform);
+
+	Request.Sockets  = CrateSockets;
+	Request.Location = FVector(10.f, 5.f, 155.f);
+	FPlacementSnapResult Result = Solver.Solve(Request);
+	TestTrue(TEXT("Crate snaps to a socket"), Result.Kind == EPlacementSnapKind::Socket);
+	TestEqual(TEXT("Crate stacks on the crate below"), Result.TargetHandle, Crate);
+	TestEqual(TEXT("Crate connects its bottom socket"), Result.SocketIndex, 1);
+	TestTrue(TEXT("Crate sits on top"), Result.Location.Equals(FVector(0.f, 0.f, 150.f), 0.01f));
+
+	Request.IgnoreHandle = Crate;
+	TestTrue(TEXT("The actor being edited is ignored"), Solver.Solve(Request).Kind == EPlacementSnapKind::None);
+	Request.IgnoreHandle = INDEX_NONE;
+
+	// Edge to edge: wall pieces side by side, preview slightly turned
+	TArray<FPlacementSocketData> WallSockets;
+	{
+		FPlacementSocketData& Left = WallSockets.AddDefaulted_GetRef();
+		Left.Name = TEXT("Left"); Left.Type = TEXT("Edge");
+		Left.LocalPosition = FVector(-100.f, 0.f, 0.f); Left.LocalNormal = FVector::BackwardVector;
+
+		FPlacementSocketData& Right = WallSockets.AddDefaulted_GetRef();
+		Right.Name = TEXT("Right"); Right.Type = TEXT("Edge");
+		Right.LocalPosition = FVector(100.f, 0.f, 0.f); Right.LocalNormal = FVector::ForwardVector;
+	}
+
+	const FBox WallBox(FVector(-100.f, -10.f, -100.f), FVector(100.f, 10.f, 100.f));
+	const FTransform WallTransform(FVector(0.f, 0.f, 100.f));
+
+	Index.Reset();
+	Solver.Reset();
+	const int32 Wall = Index.Add(FPlacementBox::FromLocalBox(WallBox, WallTransform));
+	Solver.SetSockets(Wall, WallSockets, WallTransform);
+
+	Request.Sockets  = WallSockets;
+	Request.LocalBox = WallBox;
+	Request.Location = FVector(220.f, 10.f, 100.f);
+	Request.Rotation = FRotator(0.f, 5.f, 0.f).Quaternion();
+	Result = Solver.Solve(Request);
+	TestTrue(TEXT("Wall piece snaps to a socket"), Result.Kind == EPlacementSnapKind::Socket);
+	TestEqual(TEXT("Wall piece connects its left edge"), Result.SocketIndex, 0);
+	TestEqual(TEXT("Wall piece connects to the right edge"), Result.TargetSocketIndex, 1);
+	TestTrue(TEXT("Wall piece connects edge to edge"), Result.Location.Equals(FVector(200.f, 0.f, 100.f), 0.01f));
+	TestTrue(TEXT("Wall piece straightens"), Result.Rotation.AngularDistance(FQuat::Identity) < 0.001f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlacementSnapTieBreakTest, "LVN.Placement.Snap.TieBreak", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPlacementSnapTieBreakTest::RunTest(const FString& Parameters)
+{
+	using namespace PlacementSnapSolverTests;
+	FPlacementSpatialIndex Index(200.f);
+	FPlacementSnapSolver Solver(Index);
+	FPlacementSnapRequest Request = MakeRequest();
+
+	// Two crates at the same distance, sockets registered in reverse handle order
+	const TArray<FPlacementSocketData> CrateSockets = MakeCrateSockets();
+	const FTransform FirstTransform(FVector(-20.f, 0.f, 50.f));
+	const FTransform SecondTransform(FVector(20.f, 0.f, 50.f));
+	const int32 First  = Index.Add(FPlacementBox::FromLocalBox(UnitBox, FirstTransform));
+	const int32 Second = Index.Add(FPlacementBox::FromLocalBox(UnitBox, SecondTransform));
+	Solver.SetSockets(Second, CrateSockets, SecondTransform);
+	Solver.SetSockets(First, CrateSockets, FirstTransform);
+
+	Request.Sockets  = CrateSockets;
+	Request.Location = FVector(0.f, 0.f, 150.f);
+	const FPlacementSnapResult Result = Solver.Solve(Request);
+	const FPlacementSnapResult Again  = Solver.Solve(Request);
+	TestEqual(TEXT("Equal distances pick the lowest handle"), Result.TargetHandle, FMath::Min(First, Second));
+	TestTrue(TEXT("Solving twice gives identical results"),
+		Result.Location == Again.Location && Result.Rotation == Again.Rotation && Result.TargetHandle == Again.TargetHandle);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlacementSnapGuideTest, "LVN.Placement.Snap.Guide", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPlacementSnapGuideTest::RunTest(const FString& Parameters)
+{
+	using namespace PlacementSnapSolverTests;
+	FPlacementSpatialIndex Index(200.f);
+	FPlacementSnapSolver Solver(Index);
+	FPlacementSnapRequest Request = MakeRequest();
+
+	const int32 Neighbour = Index.Add(FPlacementBox::FromLocalBox(UnitBox, FTransform(FVector(300.f, 0.f, 50.f))));
+
+	TArray<FPlacementGuide> Guides;
+	Request.Location = FVector(100.f, 6.f, 50.f);
+	FPlacementSnapResult Result = Solver.Solve(Request, &Guides);
+	TestTrue(TEXT("Preview snaps to a guide"), Result.Kind == EPlacementSnapKind::Guide);
+	TestEqual(TEXT("Guide targets the neighbour"), Result.TargetHandle, Neighbour);
+	TestTrue(TEXT("Preview aligns to the neighbour along Y"), Result.Location.Equals(FVector(100.f, 0.f, 50.f), 0.01f));
+	if (TestEqual(TEXT("One guide is reported"), Guides.Num(), 1))
+	{
+		TestEqual(TEXT("The guide runs along Y"), Guides[0].Axis, 1);
+		TestEqual(TEXT("The guide is straight"), Guides[0].From.Y, Guides[0].To.Y, 0.01);
+	}
+
+	Request.Location = FVector(100.f, 30.f, 50.f);
+	Result = Solver.Solve(Request, &Guides);
+	TestTrue(TEXT("Nothing snaps outside the tolerance"), Result.Kind == EPlacementSnapKind::None);
+	TestEqual(TEXT("No guide outside the tolerance"), Guides.Num(), 0);
+	return true;
+}
+
+#endif
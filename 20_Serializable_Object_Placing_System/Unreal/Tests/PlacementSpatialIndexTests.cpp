@@ -0,0 +1,109 @@
+#include "Misc/AutomationTest.h"
+#include "PlacementSpatialIndex.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Grid queries against a brute force scan on 5000 synthetic boxes, roughly a furnished 100 x 100 m floor with some stacking.
+// Handles only, no actors or physics involved.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Placement; Quit" -nullrhi -unattended
+
+namespace PlacementSpatialIndexTests
+{
+	constexpr int32 BoxCount   = 5000;
+	constexpr int32 ProbeCount = 2000;
+	constexpr float CellSize   = 200.f;
+
+	struct FFixture
+	{
+		TArray<FPlacementBox> Boxes;
+		TArray<FPlacementBox> Probes;
+		FPlacementSpatialIndex Index{ CellSize };
+
+		FFixture()
+		{
+			FRandomStream Random(1234);
+			auto RandomBox = [&Random](float MinExtent, float MaxExtent)
+			{
+				return FPlacementBox(
+					FVector(Random.FRandRange(-5000.f, 5000.f), Random.FRandRange(-5000.f, 5000.f), Random.FRandRange(0.f, 300.f)),
+					FVector(Random.FRandRange(MinExtent, MaxExtent), Random.FRandRange(MinExtent, MaxExtent), Random.FRandRange(MinExtent, MaxExtent)),
+					FRotator(0.f, Random.FRandRange(0.f, 360.f), 0.f).Quaternion());
+			};
+
+			for (int32 i = 0; i < BoxCount; i++) Boxes.Add(RandomBox(10.f, 120.f));
+			for (int32 i = 0; i < ProbeCount; i++) Probes.Add(RandomBox(20.f, 100.f));
+			for (const FPlacementBox& Box : Boxes) Index.Add(Box);
+		}
+
+		int32 BruteForce(const FPlacementBox& Probe, int32 Ignore = INDEX_NONE) const
+		{
+			int32 Hits = 0;
+			for (int32 j = 0; j < BoxCount; j++)
+				if (j != Ignore && Index.IsValid(j) && Index.GetBox(j).Intersects(Probe)) Hits++;
+			return Hits;
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlacementSpatialIndexBruteForceTest, "LVN.Placement.SpatialIndex.MatchesBruteForce", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPlacementSpatialIndexBruteForceTest::RunTest(const FString& Parameters)
+{
+	using namespace PlacementSpatialIndexTests;
+	FFixture Fixture;
+	TArray<int32> Results;
+
+	int32 Total = 0;
+	for (int32 i = 0; i < ProbeCount; i++)
+	{
+		const int32 Hits = Fixture.Index.Query(Fixture.Probes[i], Results);
+		if (!TestEqual(FString::Printf(TEXT("Probe %d"), i), Hits, Fixture.BruteForce(Fixture.Probes[i])))
+			return false;
+		TestEqual(FString::Printf(TEXT("Probe %d has no duplicate handle"), i), TSet<int32>(Results).Num(), Results.Num());
+		Total += Hits;
+	}
+	TestTrue(TEXT("The probes hit something"), Total > 0);
+
+	// Moving every box once exercises the relink path
+	for (int32 i = 0; i < BoxCount; i++)
+	{
+		FPlacementBox Moved = Fixture.Boxes[i];
+		Moved.Center += FVector(0.25f * CellSize, 0.25f * CellSize, 0.f);
+		Fixture.Index.Move(i, Moved);
+	}
+
+	for (int32 i = 0; i < ProbeCount; i++)
+	{
+		if (!TestEqual(FString::Printf(TEXT("Probe %d after moving"), i), Fixture.Index.Query(Fixture.Probes[i], Results), Fixture.BruteForce(Fixture.Probes[i])))
+			return false;
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlacementSpatialIndexRemoveTest, "LVN.Placement.SpatialIndex.IgnoreAndRemove", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FPlacementSpatialIndexRemoveTest::RunTest(const FString& Parameters)
+{
+	using namespace PlacementSpatialIndexTests;
+	FFixture Fixture;
+	TArray<int32> Results;
+
+	int32 Probe = INDEX_NONE;
+	for (int32 i = 0; i < ProbeCount && Probe == INDEX_NONE; i++)
+		if (Fixture.Index.Query(Fixture.Probes[i], Results) > 1) Probe = i;
+
+	if (!TestNotEqual(TEXT("A probe with two hits"), Probe, (int32)INDEX_NONE))
+		return false;
+
+	const int32 Ignored = Results[0];
+	TestEqual(TEXT("Ignored handle is skipped"), Fixture.Index.Query(Fixture.Probes[Probe], Results, Ignored), Fixture.BruteForce(Fixture.Probes[Probe], Ignored));
+	TestFalse(TEXT("Ignored handle is not reported"), Results.Contains(Ignored));
+
+	Fixture.Index.Remove(Ignored);
+	TestFalse(TEXT("Removed handle is invalid"), Fixture.Index.IsValid(Ignored));
+	TestEqual(TEXT("Removed handle is gone"), Fixture.Index.Query(Fixture.Probes[Probe], Results), Fixture.BruteForce(Fixture.Probes[Probe]));
+	TestEqual(TEXT("Count"), Fixture.Index.Num(), BoxCount - 1);
+	TestEqual(TEXT("Handles are recycled"), Fixture.Index.Add(Fixture.Boxes[Ignored]), Ignored);
+	return true;
+}
+
+#endif
@@ -0,0 +1,184 @@
+#include "Misc/AutomationTest.h"
+#include "SaveSchemaRegistry.h"
+#include "JsonObjectConverter.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/StructOnScope.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Migration regression corpus: every checked-in Save_System_&_FP_Controller/SaveCorpus/*.json holds placement entries exactly as
+// USaveGameData stored them at some historical version, { "entries": [ { guid, type, version, jsonData } ], "expected":
+// [ { guid, type, version, data } ] }, where "data" only lists the fields worth checking. Each expected entry must come out
+// of the migration in that state.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Save.Corpus; Quit" -nullrhi -unattended
+
+namespace SaveCorpusTests
+{
+	FString CorpusFolder()
+	{
+		return FPaths::ConvertRelativePathToFull(FPaths::GetPath(FString(__FILE__)) / TEXT("../Save_System_&_FP_Controller/SaveCorpus"));
+	}
+
+	// True when every field of Expected exists in Actual with the same value (objects recursively,
+	// arrays element by element, numbers within tolerance)
+	bool JsonContains(const TSharedPtr<FJsonValue>& Actual, const TSharedPtr<FJsonValue>& Expected, const FString& Path, FString& OutMismatch)
+	{
+		if (!Actual.IsValid())
+		{
+			OutMismatch = Path + TEXT(": missing");
+			return false;
+		}
+
+		switch (Expected->Type)
+		{
+		case EJson::Object:
+		{
+			const TSharedPtr<FJsonObject>* ActualObject = nullptr;
+			if (!Actual->TryGetObject(ActualObject))
+			{
+				OutMismatch = Path + TEXT(": expected an object");
+				return false;
+			}
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Expected->AsObject()->Values)
+			{
+				if (!JsonContains((*ActualObject)->TryGetField(Field.Key), Field.Value, Path + TEXT(".") + Field.Key, OutMismatch)) return false;
+			}
+			return true;
+		}
+		case EJson::Array:
+		{
+			const TArray<TSharedPtr<FJsonValue>>* ActualArray = nullptr;
+			const TArray<TSharedPtr<FJsonValue>>& ExpectedArray = Expected->AsArray();
+			if (!Actual->TryGetArray(ActualArray) || ActualArray->Num() != ExpectedArray.Num())
+			{
+				OutMismatch = FString::Printf(TEXT("%s: expected %d items"), *Path, ExpectedArray.Num());
+				return false;
+			}
+			for (int32 i = 0; i < ExpectedArray.Num(); i++)
+			{
+				if (!JsonContains((*ActualArray)[i], ExpectedArray[i], FString::Printf(TEXT("%s[%d]"), *Path, i), OutMismatch)) return false;
+			}
+			return true;
+		}
+		case EJson::Number:
+		{
+			double Value = 0.0;
+			if (Actual->TryGetNumber(Value) && FMath::Abs(Value - Expected->AsNumber()) <= 1e-3) return true;
+			break;
+		}
+		case EJson::Boolean:
+		{
+			bool bValue = false;
+			if (Actual->TryGetBool(bValue) && bValue == Expected->AsBool()) return true;
+			break;
+		}
+		case EJson::String:
+		{
+			FString Value;
+			if (Actual->TryGetString(Value) && Value == Expected->AsString()) return true;
+			break;
+		}
+		default:
+			if (Actual->IsNull()) return true;
+			break;
+		}
+
+		OutMismatch = FString::Printf(TEXT("%s: expected %s, got %s"), *Path, *Expected->AsString(), *Actual->AsString());
+		return false;
+	}
+
+	// Loads migrated JSON into the current struct and back, so fields the struct no longer has are dropped
+	// exactly as RestoreState would drop them
+	TSharedPtr<FJsonObject> RoundTrip(const FString& Type, const FString& Json)
+	{
+		TSharedPtr<FJsonObject> Object;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+		if (!FJsonSerializer::Deserialize(Reader, Object) || !Object.IsValid()) return nullptr;
+
+		const FString StructName = Type.StartsWith(TEXT("F")) ? Type.RightChop(1) : Type;
+		UScriptStruct* Struct = FindFirstObject<UScriptStruct>(*StructName, EFindFirstObjectOptions::NativeFirst);
+		if (!Struct) return Object;
+
+		FStructOnScope Scope(Struct);
+		if (!FJsonObjectConverter::JsonObjectToUStruct(Object.ToSharedRef(), Struct, Scope.GetStructMemory())) return nullptr;
+
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		FJsonObjectConverter::UStructToJsonObject(Struct, Scope.GetStructMemory(), Result);
+		return Result;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveCorpusMigrationTest, "LVN.Save.Corpus.Migrations", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveCorpusMigrationTest::RunTest(const FString& Parameters)
+{
+	using namespace SaveCorpusTests;
+
+	const FString Folder = CorpusFolder();
+	TArray<FString> Files;
+	IFileManager::Get().FindFiles(Files, *(Folder / TEXT("*.json")), true, false);
+	if (!TestTrue(FString::Printf(TEXT("Corpus files in %s"), *Folder), Files.Num() > 0))
+		return false;
+
+	for (const FString& File : Files)
+	{
+		FString Text;
+		FFileHelper::LoadFileToString(Text, *(Folder / File));
+
+		TSharedPtr<FJsonObject> Root;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Text);
+		const TArray<TSharedPtr<FJsonValue>>* EntryValues = nullptr;
+		const TArray<TSharedPtr<FJsonValue>>* ExpectedValues = nullptr;
+
+		if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid()
+			|| !Root->TryGetArrayField(TEXT("entries"), EntryValues) || !Root->TryGetArrayField(TEXT("expected"), ExpectedValues))
+		{
+			AddError(File + TEXT(": not a corpus file (needs 'entries' and 'expected')"));
+			continue;
+		}
+
+		TArray<FSaveDataEntry> Entries;
+		for (const TSharedPtr<FJsonValue>& Value : *EntryValues)
+		{
+			const TSharedPtr<FJsonObject> Object = Value->AsObject();
+			FSaveDataEntry& Entry = Entries.AddDefaulted_GetRef();
+			FGuid::Parse(Object->GetStringField(TEXT("guid")), Entry.GUID);
+			Entry.Type = Object->GetStringField(TEXT("type"));
+			Entry.Version = Object->HasField(TEXT("version")) ? static_cast<int32>(Object->GetNumberField(TEXT("version"))) : 0;
+			Entry.JsonData = Object->GetStringField(TEXT("jsonData"));
+		}
+
+		FSaveSchemaRegistry::Get().MigrateAll(Entries);
+
+		for (const TSharedPtr<FJsonValue>& Value : *ExpectedValues)
+		{
+			const TSharedPtr<FJsonObject> Want = Value->AsObject();
+			FGuid GUID;
+			FGuid::Parse(Want->GetStringField(TEXT("guid")), GUID);
+			const FString Type = Want->GetStringField(TEXT("type"));
+			const FString What = FString::Printf(TEXT("%s: %s %s"), *File, *Type, *GUID.ToString());
+
+			const FSaveDataEntry* Entry = Entries.FindByPredicate([&](const FSaveDataEntry& E) { return E.GUID == GUID && E.Type == Type; });
+			if (!TestNotNull(What + TEXT(" migrated"), Entry))
+				continue;
+
+			int32 WantVersion = 0;
+			if (Want->TryGetNumberField(TEXT("version"), WantVersion))
+				TestEqual(What + TEXT(" version"), Entry->Version, WantVersion);
+
+			TSharedPtr<FJsonValue> Migrated;
+			if (const TSharedPtr<FJsonObject> Object = RoundTrip(Entry->Type, Entry->JsonData))
+				Migrated = MakeShared<FJsonValueObject>(Object);
+
+			FString Mismatch;
+			if (Want->HasField(TEXT("data")) && !JsonContains(Migrated, Want->TryGetField(TEXT("data")), TEXT(""), Mismatch))
+				AddError(What + TEXT(" ") + Mismatch);
+		}
+	}
+	return true;
+}
+
+#endif
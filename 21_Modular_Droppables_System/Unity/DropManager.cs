@@ -36,7 +36,7 @@ public class DropManager : MonoBehaviour
     {
         if (droppableItemPrefabs.Count == 0)
         {
-            Debug.LogError("[DropManager] No DroppableItem prefabs assigned!");
+            Diag.Error(DiagCategory.Drops, this, "[DropManager] No DroppableItem prefabs assigned!");
             return;
         }
 
@@ -74,7 +74,7 @@ public class DropManager : MonoBehaviour
 
             pooledItemsByPrefab[prefab] = prefabPool;
 
-            Debug.Log($"[DropManager] Initialized pool for {prefab.name} with {poolSize} items");
+            Diag.Log(DiagCategory.Drops, this, "[DropManager] Initialized pool for {0} with {1} items", prefab, poolSize);
         }
     }
 
@@ -82,7 +82,7 @@ public class DropManager : MonoBehaviour
     {
         if (!pooledItemsByPrefab.ContainsKey(prefab))
         {
-            Debug.LogWarning($"[DropManager] Prefab {prefab.name} not in pool dictionary!");
+            Diag.Warning(DiagCategory.Drops, this, "[DropManager] Prefab {0} not in pool dictionary!", prefab);
             return null;
         }
 
@@ -122,7 +122,7 @@ public class DropManager : MonoBehaviour
         }
         else
         {
-            Debug.LogWarning("[DropManager] Returned item has no valid prefab reference!");
+            Diag.Warning(DiagCategory.Drops, item, "[DropManager] Returned item has no valid prefab reference!");
         }
     }
 
@@ -130,7 +130,7 @@ public class DropManager : MonoBehaviour
     {
         if (itemData == null)
         {
-            Debug.LogError("[DropManager] Cannot drop item with null ItemData!");
+            Diag.Error(DiagCategory.Drops, this, "[DropManager] Cannot drop item with null ItemData!");
             return null;
         }
 
@@ -138,13 +138,13 @@ public class DropManager : MonoBehaviour
 
         if (prefab == null)
         {
-            Debug.LogError($"[DropManager] ItemData {itemData.itemName} has no prefab assigned!");
+            Diag.Error(DiagCategory.Drops, itemData, "[DropManager] ItemData {0} has no prefab assigned!", itemData.itemName);
             return null;
         }
 
         if (!pooledItemsByPrefab.ContainsKey(prefab))
         {
-            Debug.LogError($"[DropManager] Prefab {prefab.name} is not registered in the pool!");
+            Diag.Error(DiagCategory.Drops, this, "[DropManager] Prefab {0} is not registered in the pool!", prefab);
             return null;
         }
 
@@ -152,7 +152,7 @@ public class DropManager : MonoBehaviour
 
         if (dropItem == null)
         {
-            Debug.LogError("[DropManager] Failed to get item from pool!");
+            Diag.Error(DiagCategory.Drops, this, "[DropManager] Failed to get item from pool!");
             return null;
         }
 
@@ -171,7 +171,8 @@ public class DropManager : MonoBehaviour
 
         dropItem.OnSpawn();
 
-        Debug.Log($"[DropManager] Dropped {itemData.itemName} x{finalQuantity}. Active drops: {activeDrops.Count}");
+        Diag.Verbose(DiagCategory.Drops, dropItem, "[DropManager] Dropped {0} x{1}. Active drops: {2}", itemData.itemName, finalQuantity, activeDrops.Count);
+        Diag.Sphere(DiagCategory.Drops, position, 0.25f, Color.cyan, 1f);
 
         
 
@@ -184,7 +185,7 @@ public class DropManager : MonoBehaviour
         {
             activeDrops.Remove(drop);
             ReturnToPool(drop);
-            Debug.Log($"[DropManager] Item returned to pool. Active drops: {activeDrops.Count}");
+            Diag.Verbose(DiagCategory.Drops, this, "[DropManager] Item returned to pool. Active drops: {0}", activeDrops.Count);
         }
     }
 
@@ -80,7 +80,7 @@ public class DroppableItem : MonoBehaviour, IDroppable
     private void Start()
     {
         if (DropManager.Instance == null)
-            Debug.LogWarning("[DroppableItem] No DropManager in scene — pool spawning unavailable.");
+            Diag.Warning(DiagCategory.Drops, this, "[DroppableItem] No DropManager in scene — pool spawning unavailable.");
 
         // Pre-placed path — ItemData assigned in Inspector, skip scatter/settle
         if (itemData != null && !isManagedByPool)
@@ -133,7 +133,7 @@ public class DroppableItem : MonoBehaviour, IDroppable
             rb.angularVelocity = Vector3.zero;
         }
 
-        Debug.Log($"[DroppableItem] Spawned: {itemData.itemName} x{itemData.baseQuantity} at {transform.position}");
+        Diag.Verbose(DiagCategory.Drops, this, "[DroppableItem] Spawned: {0} x{1} at {2}", itemData.itemName, itemData.baseQuantity, transform.position);
 
         if (collectibleCoroutine != null)
             StopCoroutine(collectibleCoroutine);
@@ -159,7 +159,7 @@ public class DroppableItem : MonoBehaviour, IDroppable
         rb.linearVelocity = scatterForce;
         rb.angularVelocity = Random.insideUnitSphere * (itemData.floatRotationSpeed * Mathf.Deg2Rad * settings.spinForceMultiplier);
 
-        Debug.Log($"[DroppableItem] Applied scatter force: {scatterForce}");
+        Diag.Verbose(DiagCategory.Drops, this, "[DroppableItem] Applied scatter force: {0}", scatterForce);
 
     }
 
@@ -209,7 +209,7 @@ public class DroppableItem : MonoBehaviour, IDroppable
 
         if (collision.CompareTag("Player"))
         {
-            Debug.Log($"[DroppableItem] Player entered trigger for {itemData.itemName}");
+            Diag.Verbose(DiagCategory.Drops, this, "[DroppableItem] Player entered trigger for {0}", itemData.itemName);
             StartCollecting(collision.transform);
         }
     }
@@ -231,7 +231,7 @@ public class DroppableItem : MonoBehaviour, IDroppable
         if (settings.enabled)
             StartCoroutine(FloatTransitionRoutine());
 
-        Debug.Log($"[DroppableItem] {itemData.itemName} is now collectible!");
+        Diag.Verbose(DiagCategory.Drops, this, "[DroppableItem] {0} is now collectible!", itemData.itemName);
     }
 
     private IEnumerator FloatTransitionRoutine()
@@ -276,7 +276,7 @@ public class DroppableItem : MonoBehaviour, IDroppable
 
         StartCoroutine(PopEffectRoutine());
 
-        Debug.Log($"[DroppableItem] Starting collection of {itemData.itemName}");
+        Diag.Verbose(DiagCategory.Drops, this, "[DroppableItem] Starting collection of {0}", itemData.itemName);
     }
 
     private IEnumerator PopEffectRoutine()
@@ -351,7 +351,7 @@ public class DroppableItem : MonoBehaviour, IDroppable
 
     public void OnCollected()
     {
-        Debug.Log($"[DroppableItem] Collected: {itemData.itemName} x{quantity}");
+        Diag.Log(DiagCategory.Drops, this, "[DroppableItem] Collected: {0} x{1}", itemData.itemName, quantity);
 
         onCollectedEventHook?.Invoke();
 
@@ -373,7 +373,7 @@ public class DroppableItem : MonoBehaviour, IDroppable
                 UIManager.Instance.AddKey(quantity);
                 break;
             default:
-                Debug.Log($"[DroppableItem] Collected {itemData.itemName} x{quantity}");
+                Diag.Log(DiagCategory.Drops, this, "[DroppableItem] Collected {0} x{1}", itemData.itemName, quantity);
                 break;
         }
         #endregion
@@ -0,0 +1,91 @@
+using System.Collections;
+using System.Collections.Generic;
+using NUnit.Framework;
+using Unity.PerformanceTesting;
+using UnityEditor;
+using UnityEngine;
+using UnityEngine.TestTools;
+
+// Times the drop manager in Play mode with 2000 drops on a grid over a floor: dropping them, frames while they are all
+// active, then collecting them again. Allocations aren't budgeted: each drop starts its collect delay coroutine.
+// Compared with PerfBaselines/Drops.json.
+public class DropPerformanceTests
+{
+    private const int DropCount = 2000;
+
+    [UnityTearDown]
+    public IEnumerator TearDown()
+    {
+        if (Application.isPlaying)
+            yield return new ExitPlayMode();
+    }
+
+    [UnityTest, Performance]
+    public IEnumerator DropAndCollect_2000()
+    {
+        yield return new EnterPlayMode();
+        Random.InitState(DropCount); // Same quantities and scatter every run
+
+        var floor = GameObject.CreatePrimitive(PrimitiveType.Cube);
+        floor.transform.localScale = new Vector3(200f, 1f, 200f);
+        floor.transform.position = Vector3.down * 0.5f;
+
+        // Inactive template the pool instantiates, like a prefab
+        var prefab = new GameObject("Drop");
+        prefab.SetActive(false);
+        prefab.AddComponent<SphereCollider>();
+        prefab.AddComponent<SphereCollider>().isTrigger = true;
+        prefab.AddComponent<Rigidbody>();
+        prefab.AddComponent<DroppableItem>();
+
+        var data = ScriptableObject.CreateInstance<DroppableItemData>();
+        data.itemPrefab = prefab;
+        data.itemID = data.itemName = "PerfTest";
+
+        // Inactive until the prefab is assigned, the manager builds its pool in Awake
+        var managerGO = new GameObject("DropManager");
+        managerGO.SetActive(false);
+        var manager = managerGO.AddComponent<DropManager>();
+        var settings = new SerializedObject(manager);
+        SerializedProperty prefabs = settings.FindProperty("droppableItemPrefabs");
+        prefabs.arraySize = 1;
+        prefabs.GetArrayElementAtIndex(0).objectReferenceValue = prefab;
+        settings.ApplyModifiedPropertiesWithoutUndo();
+        managerGO.SetActive(true);
+
+        int side = Mathf.CeilToInt(Mathf.Sqrt(DropCount));
+        var positions = new Vector3[DropCount];
+        for (int i = 0; i < DropCount; i++)
+            positions[i] = new Vector3(i % side - side * 0.5f, 1f, i / side - side * 0.5f);
+
+        // One unmeasured pass grows the pool, so the measured drops take the pooled path
+        var drops = new List<DroppableItem>(DropCount);
+        for (int i = 0; i < DropCount; i++)
+            drops.Add(manager.DropItem(data, positions[i]));
+        foreach (DroppableItem drop in drops)
+            manager.OnDropCollected(drop);
+        drops.Clear();
+        yield return null;
+
+        int next = 0;
+        Measure.Method(() => drops.Add(manager.DropItem(data, positions[next++])))
+            .WarmupCount(0)
+            .MeasurementCount(DropCount)
+            .SampleGroup("DropItem")
+            .Run();
+        Assert.AreEqual(DropCount, manager.GetActiveDropCount());
+
+        yield return PerfBaseline.Frames($"Frame_{DropCount}Active", 120);
+
+        next = 0;
+        Measure.Method(() => manager.OnDropCollected(drops[next++]))
+            .WarmupCount(0)
+            .MeasurementCount(DropCount)
+            .SampleGroup("OnDropCollected")
+            .Run();
+        Assert.AreEqual(0, manager.GetActiveDropCount());
+
+        Object.Destroy(data);
+        PerfBaseline.AssertWithin("Drops");
+    }
+}
@@ -1,10 +1,11 @@
 #include "DropManagerSubsystem.h"
+#include "Diagnostics.h"
 #include "Engine/World.h"
 
 void UDropManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
-    UE_LOG(LogTemp, Log, TEXT("[DropManagerSubsystem] Initialized"));
+    DIAG_LOG(Drops, Log, TEXT("[DropManagerSubsystem] Initialized"));
 }
 
 void UDropManagerSubsystem::Deinitialize()
@@ -17,14 +18,14 @@ ADroppableItem* UDropManagerSubsystem::DropItem(UDroppableItemData* ItemData, FV
 {
     if (!ItemData)
     {
-        UE_LOG(LogTemp, Error, TEXT("[DropManagerSubsystem] Cannot drop: null ItemData!"));
+        DIAG_LOG(Drops, Error, TEXT("[DropManagerSubsystem] Cannot drop: null ItemData!"));
         return nullptr;
     }
 
     TSubclassOf<ADroppableItem> ItemClass{ ItemData->ItemClass };
     if (!ItemClass)
     {
-        UE_LOG(LogTemp, Error, TEXT("[DropManagerSubsystem] ItemData %s has no class assigned!"),*ItemData->ItemName);
+        DIAG_LOG(Drops, Error, TEXT("[DropManagerSubsystem] ItemData %s has no class assigned!"),*ItemData->ItemName);
         return nullptr;
     }
 
@@ -35,7 +36,7 @@ ADroppableItem* UDropManagerSubsystem::DropItem(UDroppableItemData* ItemData, FV
 
     if (!Item)
     {
-        UE_LOG(LogTemp, Error, TEXT("[DropManagerSubsystem] SpawnActor failed for %s"), *ItemClass->GetName());
+        DIAG_LOG(Drops, Error, TEXT("[DropManagerSubsystem] SpawnActor failed for %s"), *ItemClass->GetName());
         return nullptr;
     }
 
@@ -48,7 +49,8 @@ ADroppableItem* UDropManagerSubsystem::DropItem(UDroppableItemData* ItemData, FV
     ActiveDrops.Add(Item);
     Item->OnSpawn();
 
-    UE_LOG(LogTemp, Log, TEXT("[DropManagerSubsystem] Dropped %s x%d | Active: %d"), *ItemData->ItemName, FinalQuantity, ActiveDrops.Num());
+    DIAG_LOG(Drops, Verbose, TEXT("[DropManagerSubsystem] Dropped %s x%d | Active: %d"), *ItemData->ItemName, FinalQuantity, ActiveDrops.Num());
+    DIAG_SPHERE(GetWorld(), Drops, Item->GetActorLocation(), 25.f, FColor::Cyan, 1.f);
 
     return Item;
 }
@@ -60,6 +62,6 @@ void UDropManagerSubsystem::OnDropCollected(ADroppableItem* Drop)
     ActiveDrops.Remove(Drop);
     Drop->Destroy();
 
-    UE_LOG(LogTemp, Log, TEXT("[DropManagerSubsystem] Item destroyed | Active: %d"),
+    DIAG_LOG(Drops, Verbose, TEXT("[DropManagerSubsystem] Item destroyed | Active: %d"),
         ActiveDrops.Num());
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "DroppableItem.h"
+#include "Diagnostics.h"
 #include "DropManagerSubsystem.h"
 #include "Components/SphereComponent.h"
 
@@ -65,7 +66,7 @@ void ADroppableItem::BeginPlay()
             DropState = EDropState::Floating;
         }
 
-        UE_LOG(LogTemp, Log, TEXT("[DroppableItem] Pre-placed: %s"), *ItemData->ItemName);
+        DIAG_LOG(Drops, Verbose, TEXT("[DroppableItem] Pre-placed: %s"), *ItemData->ItemName);
     }
 }
 
@@ -131,7 +132,7 @@ void ADroppableItem::OnSpawn()
 {
     if (!ItemData)
     {
-        UE_LOG(LogTemp, Error, TEXT("[DroppableItem] OnSpawn called with null ItemData!"));
+        DIAG_LOG(Drops, Error, TEXT("[DroppableItem] OnSpawn called with null ItemData!"));
         return;
     }
 
@@ -140,7 +141,7 @@ void ADroppableItem::OnSpawn()
     PhysicsCollider->SetEnableGravity(true);
     PhysicsCollider->SetSimulatePhysics(true);
 
-    UE_LOG(LogTemp, Log, TEXT("[DroppableItem] Spawned: %s x%d at %s"),*ItemData->ItemName, Quantity, *GetActorLocation().ToString());
+    DIAG_LOG(Drops, Verbose, TEXT("[DroppableItem] Spawned: %s x%d at %s"),*ItemData->ItemName, Quantity, *GetActorLocation().ToString());
 
     ApplyScatterEffect();
 
@@ -191,7 +192,7 @@ void ADroppableItem::OnTriggerBeginOverlap(UPrimitiveComponent* OverlappedComp,A
 
     if (OtherActor->Tags.Contains(FName("Player")))
     {
-        UE_LOG(LogTemp, Log, TEXT("[DroppableItem] Player overlapped: %s"), *ItemData->ItemName);
+        DIAG_LOG(Drops, Verbose, TEXT("[DroppableItem] Player overlapped: %s"), *ItemData->ItemName);
         StartCollecting(OtherActor);
     }
 }
@@ -219,7 +220,7 @@ void ADroppableItem::TickWaitingToSettle(float DeltaTime)
     {
         if (bTimedOut)
         {
-            UE_LOG(LogTemp, Warning,
+            DIAG_LOG(Drops, Warning,
                 TEXT("[DroppableItem] Settle timeout — forcing collectible"));
         }
 
@@ -262,7 +263,7 @@ void ADroppableItem::MakeCollectible()
         DropState = EDropState::Floating;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("[DroppableItem] %s is now collectible!"), *ItemData->ItemName);
+    DIAG_LOG(Drops, Verbose, TEXT("[DroppableItem] %s is now collectible!"), *ItemData->ItemName);
 }
 
 void ADroppableItem::StartCollecting(AActor* Collector)
@@ -278,14 +279,14 @@ void ADroppableItem::StartCollecting(AActor* Collector)
     bPopScalingUp = true;
     PopElapsed = 0.f;
 
-    UE_LOG(LogTemp, Log, TEXT("[DroppableItem] Starting collection: %s"), *ItemData->ItemName);
+    DIAG_LOG(Drops, Verbose, TEXT("[DroppableItem] Starting collection: %s"), *ItemData->ItemName);
 }
 
 void ADroppableItem::OnCollected()
 {
     if (!ItemData) return;
 
-    UE_LOG(LogTemp, Log, TEXT("[DroppableItem] Collected: %s x%d"),*ItemData->ItemName, Quantity);
+    DIAG_LOG(Drops, Log, TEXT("[DroppableItem] Collected: %s x%d"),*ItemData->ItemName, Quantity);
 
     OnCollectedEvent.Broadcast(); // You can add logic in a Blueprints binding this "OnCollectedEvent" to it.
 
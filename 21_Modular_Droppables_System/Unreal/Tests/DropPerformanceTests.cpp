@@ -0,0 +1,58 @@
+#include "Misc/AutomationTest.h"
+#include "PerfTesting.h"
+#include "DropManagerSubsystem.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "Components/StaticMeshComponent.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Times the drop manager subsystem with 2000 base ADroppableItem drops on a grid over a floor: dropping them, world ticks
+// while they are all active, then collecting them again. Compared with PerfBaselines/Drops.json.
+// Run with: UnrealEditor-Cmd <Project>.uproject -ExecCmds="Automation RunTests LVN.Drops.Performance; Quit" -nullrhi -unattended
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDropPerformanceDropAndCollectTest, "LVN.Drops.Performance.DropAndCollect", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FDropPerformanceDropAndCollectTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 DropCount = 2000;
+
+    FPerfTestWorld World;
+    UDropManagerSubsystem* Manager = World.Get()->GetSubsystem<UDropManagerSubsystem>();
+    if (!TestNotNull(TEXT("DropManagerSubsystem"), Manager))
+        return false;
+
+    FActorSpawnParameters Params;
+    Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    AStaticMeshActor* Floor = World.Get()->SpawnActor<AStaticMeshActor>(FVector(0.f, 0.f, -50.f), FRotator::ZeroRotator, Params);
+    Floor->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable); // Static meshes can't change once play began
+    Floor->GetStaticMeshComponent()->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")));
+    Floor->SetActorScale3D(FVector(100.f, 100.f, 1.f));
+
+    TStrongObjectPtr<UDroppableItemData> Data(NewObject<UDroppableItemData>()); // Nothing else references it
+    Data->ItemClass = ADroppableItem::StaticClass();
+    Data->ItemName = TEXT("PerfTest");
+
+    const int32 Side = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(DropCount)));
+    TArray<ADroppableItem*> Drops;
+    Drops.SetNumZeroed(DropCount);
+
+    FMath::RandInit(DropCount); // Same quantities and scatter every run
+    FPerfRecorder Recorder;
+    Recorder.Measure(TEXT("DropItem"), DropCount, [&](int32 i)
+    {
+        const FVector Position((i % Side - Side * 0.5f) * 100.f, (i / Side - Side * 0.5f) * 100.f, 100.f);
+        Drops[i] = Manager->DropItem(Data.Get(), Position);
+    }, 0);
+    TestEqual(TEXT("Active drops"), Manager->GetActiveDropCount(), DropCount);
+
+    Recorder.MeasureTicks(FString::Printf(TEXT("Frame_%dActive"), DropCount), World, 120, [](int32) {});
+
+    Recorder.Measure(TEXT("OnDropCollected"), DropCount, [&](int32 i) { Manager->OnDropCollected(Drops[i]); }, 0);
+    TestEqual(TEXT("Active drops"), Manager->GetActiveDropCount(), 0);
+
+    return Recorder.CheckBaseline(*this, TEXT("Drops"), __FILE__);
+}
+
+#endif